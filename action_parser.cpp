@@ -0,0 +1,414 @@
+#include "action_parser.h"
+
+static const struct {
+    const char* key;
+    ActionType type;
+} ACTION_KEYS[] = {
+    {"irrigationAuto", ACTION_IRRIGATION_AUTO},
+    {"forceIrrigation", ACTION_FORCE_IRRIGATION},
+    {"config", ACTION_CONFIG},
+    {"tankAuto", ACTION_TANK_AUTO},
+    {"forceTank", ACTION_FORCE_TANK},
+    {"securityAuto", ACTION_SECURITY_AUTO},
+    {"security", ACTION_SECURITY},
+    {"clearAlarm", ACTION_CLEAR_ALARM},
+    {"luminaryAuto", ACTION_LUMINARY_AUTO},
+    {"forceLuminary", ACTION_FORCE_LUMINARY},
+};
+
+// Accepted range per field, in ConfigField order. Values land in int and
+// unsigned long settings, so anything outside (or inf/NaN) is refused
+// before the cast rather than wrapped; a zero interval would also spin
+// the measurement or polling loop.
+static const struct {
+    const char* key;
+    float min;
+    float max;
+    const char* error;
+} CONFIG_FIELDS[CONFIG_FIELD_COUNT] = {
+    {"soilDry", 0, 4095, "soilDry must be 0-4095"},
+    {"soilWet", 0, 4095, "soilWet must be 0-4095"},
+    {"soilThreshold", 0, 100, "soilThreshold must be 0-100"},
+    {"tankEmpty", 2, 400, "tankEmpty must be 2-400"},
+    {"tankFull", 2, 400, "tankFull must be 2-400"},
+    {"tankCritical", 0, 100, "tankCritical must be 0-100"},
+    {"lightMin", 0, 4095, "lightMin must be 0-4095"},
+    {"lightMax", 0, 4095, "lightMax must be 0-4095"},
+    {"lightLow", 0, 100, "lightLow must be 0-100"},
+    {"lightHigh", 0, 100, "lightHigh must be 0-100"},
+    {"dataSendInterval", 1, 1440, "dataSendInterval must be 1-1440"},
+    {"serverPollingInterval", 1, 3600, "serverPollingInterval must be 1-3600"},
+    {"statusPollingInterval", 1, 3600, "statusPollingInterval must be 1-3600"},
+};
+
+const int MAX_DURATION_MIN = 1440; // forceIrrigation: a day at most
+
+static const int MAX_DEPTH = 8; // Nesting allowed inside values we skip
+
+// ==========================================
+// Tokenizer
+// ==========================================
+struct Cursor {
+    const char* p;
+    const char* end;
+    const char* error;
+};
+
+enum ValueKind : uint8_t { VALUE_NULL, VALUE_BOOL, VALUE_NUMBER, VALUE_STRING, VALUE_OBJECT, VALUE_ARRAY };
+
+struct Value {
+    ValueKind kind = VALUE_NULL;
+    bool boolean = false;
+    float number = 0;
+    const char* text = nullptr; // VALUE_STRING: raw slice of the body, escapes kept
+    size_t length = 0;
+};
+
+static bool fail(Cursor& c, const char* error) {
+    if (!c.error) c.error = error;
+    return false;
+}
+
+static void skipSpace(Cursor& c) {
+    while (c.p < c.end && (*c.p == ' ' || *c.p == '\t' || *c.p == '\r' || *c.p == '\n')) c.p++;
+}
+
+// Skips whitespace, then eats ch if it is next
+static bool consume(Cursor& c, char ch) {
+    skipSpace(c);
+    if (c.p < c.end && *c.p == ch) {
+        c.p++;
+        return true;
+    }
+    return false;
+}
+
+static bool matches(const char* text, size_t length, const char* word) {
+    return strlen(word) == length && !memcmp(text, word, length);
+}
+
+static bool readLiteral(Cursor& c, const char* word) {
+    size_t length = strlen(word);
+    if ((size_t)(c.end - c.p) < length || memcmp(c.p, word, length)) return fail(c, "invalid literal");
+    c.p += length;
+    return true;
+}
+
+// The keys and values we act on never need unescaping, so strings are
+// returned as a slice of the body
+static bool readString(Cursor& c, const char*& text, size_t& length) {
+    if (!consume(c, '"')) return fail(c, "expected a string");
+    text = c.p;
+    while (c.p < c.end && *c.p != '"') {
+        if ((uint8_t)*c.p < 0x20) return fail(c, "control character in string");
+        if (*c.p == '\\' && c.p + 1 < c.end) c.p++; // A trailing backslash must not step past the end
+        c.p++;
+    }
+    if (c.p >= c.end) return fail(c, "unterminated string");
+    length = c.p - text;
+    c.p++;
+    return true;
+}
+
+static bool isDigit(char ch) {
+    return ch >= '0' && ch <= '9';
+}
+
+static bool readNumber(Cursor& c, float& out) {
+    bool negative = false;
+    if (c.p < c.end && *c.p == '-') {
+        negative = true;
+        c.p++;
+    }
+    if (c.p >= c.end || !isDigit(*c.p)) return fail(c, "invalid number");
+
+    double value = 0;
+    while (c.p < c.end && isDigit(*c.p)) value = value * 10 + (*c.p++ - '0');
+    if (c.p < c.end && *c.p == '.') {
+        c.p++;
+        if (c.p >= c.end || !isDigit(*c.p)) return fail(c, "invalid number");
+        double scale = 0.1;
+        while (c.p < c.end && isDigit(*c.p)) {
+            value += (*c.p++ - '0') * scale;
+            scale *= 0.1;
+        }
+    }
+    if (c.p < c.end && (*c.p == 'e' || *c.p == 'E')) {
+        c.p++;
+        bool negativeExponent = false;
+        if (c.p < c.end && (*c.p == '+' || *c.p == '-')) negativeExponent = *c.p++ == '-';
+        if (c.p >= c.end || !isDigit(*c.p)) return fail(c, "invalid number");
+        int exponent = 0;
+        while (c.p < c.end && isDigit(*c.p)) {
+            if (exponent < 1000) exponent = exponent * 10 + (*c.p - '0');
+            c.p++;
+        }
+        value *= pow(10.0, negativeExponent ? -exponent : exponent);
+    }
+    out = negative ? -value : value;
+    return true;
+}
+
+static bool skipValue(Cursor& c, int depth);
+
+static bool skipContainer(Cursor& c, char close, bool object, int depth) {
+    if (depth > MAX_DEPTH) return fail(c, "nested too deep");
+    if (consume(c, close)) return true;
+    do {
+        if (object) {
+            const char* key;
+            size_t keyLength;
+            if (!readString(c, key, keyLength)) return false;
+            if (!consume(c, ':')) return fail(c, "expected ':'");
+        }
+        if (!skipValue(c, depth)) return false;
+    } while (consume(c, ','));
+    if (!consume(c, close)) return fail(c, object ? "expected ',' or '}'" : "expected ',' or ']'");
+    return true;
+}
+
+// Reads any value; objects and arrays are only checked and stepped over
+static bool readValue(Cursor& c, Value& value, int depth) {
+    skipSpace(c);
+    if (c.p >= c.end) return fail(c, "unexpected end");
+    switch (*c.p) {
+        case '{':
+            c.p++;
+            value.kind = VALUE_OBJECT;
+            return skipContainer(c, '}', true, depth + 1);
+        case '[':
+            c.p++;
+            value.kind = VALUE_ARRAY;
+            return skipContainer(c, ']', false, depth + 1);
+        case '"':
+            value.kind = VALUE_STRING;
+            return readString(c, value.text, value.length);
+        case 't':
+        case 'f':
+            value.kind = VALUE_BOOL;
+            value.boolean = *c.p == 't';
+            return readLiteral(c, value.boolean ? "true" : "false");
+        case 'n':
+            value.kind = VALUE_NULL;
+            return readLiteral(c, "null");
+        default:
+            value.kind = VALUE_NUMBER;
+            return readNumber(c, value.number);
+    }
+}
+
+static bool skipValue(Cursor& c, int depth) {
+    Value ignored;
+    return readValue(c, ignored, depth);
+}
+
+// ==========================================
+// Commands
+// ==========================================
+static void setName(ActionCommand& command, const char* text, size_t length) {
+    if (length >= ACTION_NAME_SIZE) length = ACTION_NAME_SIZE - 1;
+    memcpy(command.name, text, length);
+    command.name[length] = '\0';
+}
+
+// The slot for type in the current object; a repeated key reuses its slot
+// so the last value wins
+static ActionCommand* commandFor(Cursor& c, ActionBatch& batch, size_t objectStart, ActionType type) {
+    if (type != ACTION_UNKNOWN) {
+        for (size_t i = objectStart; i < batch.count; ++i) {
+            if (batch.commands[i].type == type) {
+                batch.commands[i].error = nullptr;
+                return &batch.commands[i];
+            }
+        }
+    }
+    if (batch.count == ACTION_MAX_COMMANDS) {
+        fail(c, "too many commands");
+        return nullptr;
+    }
+    ActionCommand& command = batch.commands[batch.count++];
+    command.type = type;
+    command.error = nullptr;
+    command.name[0] = '\0';
+    command.enable = false;
+    command.duration = 0;
+    command.start[0] = '\0';
+    command.end[0] = '\0';
+    command.configMask = 0;
+    return &command;
+}
+
+// Same coercion ArduinoJson applied: numbers are true when non-zero, null
+// is false
+static void readToggle(ActionCommand& command, const Value& value) {
+    if (value.kind == VALUE_BOOL) command.enable = value.boolean;
+    else if (value.kind == VALUE_NUMBER) command.enable = value.number != 0;
+    else if (value.kind == VALUE_NULL) command.enable = false;
+    else command.error = "expected a boolean";
+}
+
+// "H:MM" or "HH:MM"
+static bool readTime(const Value& value, char* out) {
+    if (value.kind != VALUE_STRING || value.length < 4 || value.length > 5) return false;
+    const char* colon = (const char*)memchr(value.text, ':', value.length);
+    if (!colon || colon == value.text) return false;
+    memcpy(out, value.text, value.length);
+    out[value.length] = '\0';
+    return true;
+}
+
+static bool readConfig(Cursor& c, ActionCommand& command) {
+    if (!consume(c, '{')) {
+        command.error = "expected an object";
+        return skipValue(c, 0);
+    }
+    if (consume(c, '}')) return true;
+    do {
+        const char* key;
+        size_t keyLength;
+        if (!readString(c, key, keyLength)) return false;
+        if (!consume(c, ':')) return fail(c, "expected ':'");
+
+        Value value;
+        if (!readValue(c, value, 1)) return false;
+        for (int field = 0; field < CONFIG_FIELD_COUNT; ++field) {
+            if (!matches(key, keyLength, CONFIG_FIELDS[field].key)) continue;
+            if (value.kind != VALUE_NUMBER) {
+                command.error = "config values must be numbers";
+            } else if (!(value.number >= CONFIG_FIELDS[field].min && value.number <= CONFIG_FIELDS[field].max)) {
+                command.error = CONFIG_FIELDS[field].error; // Also catches inf and NaN
+            } else {
+                command.config[field] = value.number;
+                command.configMask |= 1 << field;
+            }
+            break;
+        }
+        // Unknown config keys are ignored, as they always were
+    } while (consume(c, ','));
+    if (!consume(c, '}')) return fail(c, "expected ',' or '}'");
+    return true;
+}
+
+// Known keys become commands as they are read; duration and the schedule
+// pair only qualify other commands, so they are held until the object ends
+static bool readCommandObject(Cursor& c, ActionBatch& batch) {
+    if (!consume(c, '{')) return fail(c, "expected a command object");
+    size_t objectStart = batch.count;
+    Value duration;
+    Value securityStart;
+    Value securityEnd;
+    bool hasDuration = false, hasStart = false, hasEnd = false;
+
+    if (!consume(c, '}')) {
+        do {
+            const char* key;
+            size_t keyLength;
+            if (!readString(c, key, keyLength)) return false;
+            if (!consume(c, ':')) return fail(c, "expected ':'");
+
+            if (matches(key, keyLength, "duration")) {
+                if (!readValue(c, duration, 0)) return false;
+                hasDuration = true;
+                continue;
+            }
+            if (matches(key, keyLength, "securityStart")) {
+                if (!readValue(c, securityStart, 0)) return false;
+                hasStart = true;
+                continue;
+            }
+            if (matches(key, keyLength, "securityEnd")) {
+                if (!readValue(c, securityEnd, 0)) return false;
+                hasEnd = true;
+                continue;
+            }
+
+            ActionType type = ACTION_UNKNOWN;
+            for (size_t i = 0; i < sizeof(ACTION_KEYS) / sizeof(ACTION_KEYS[0]); ++i) {
+                if (matches(key, keyLength, ACTION_KEYS[i].key)) {
+                    type = ACTION_KEYS[i].type;
+                    break;
+                }
+            }
+            ActionCommand* command = commandFor(c, batch, objectStart, type);
+            if (!command) return false;
+            setName(*command, key, keyLength);
+
+            if (type == ACTION_CONFIG) {
+                command->configMask = 0;
+                if (!readConfig(c, *command)) return false;
+                continue;
+            }
+            Value value;
+            if (!readValue(c, value, 0)) return false;
+            if (type == ACTION_UNKNOWN) command->error = "unknown command";
+            else if (type != ACTION_CLEAR_ALARM) readToggle(*command, value); // clearAlarm ignores its value
+        } while (consume(c, ','));
+        if (!consume(c, '}')) return fail(c, "expected ',' or '}'");
+    }
+
+    if (hasDuration) {
+        // Without forceIrrigation, duration is ignored as it always was
+        for (size_t i = objectStart; i < batch.count; ++i) {
+            ActionCommand& command = batch.commands[i];
+            if (command.type != ACTION_FORCE_IRRIGATION) continue;
+            if (duration.kind == VALUE_NUMBER) {
+                if (duration.number >= 0 && duration.number <= MAX_DURATION_MIN) command.duration = (int)duration.number;
+                else command.error = "duration must be 0-1440";
+            } else if (duration.kind != VALUE_NULL) {
+                command.error = "duration must be a number";
+            }
+        }
+    }
+    if (hasStart || hasEnd) {
+        ActionCommand* command = commandFor(c, batch, objectStart, ACTION_SECURITY_SCHEDULE);
+        if (!command) return false;
+        setName(*command, "securitySchedule", 16);
+        if (!hasStart || !hasEnd) command->error = "securityStart and securityEnd go together";
+        else if (!readTime(securityStart, command->start) || !readTime(securityEnd, command->end)) command->error = "expected \"HH:MM\"";
+    }
+
+    // Stable insertion sort by type: the object's keys apply in the fixed
+    // order, whatever order they were sent in
+    for (size_t i = objectStart + 1; i < batch.count; ++i) {
+        ActionCommand command = batch.commands[i];
+        size_t j = i;
+        while (j > objectStart && batch.commands[j - 1].type > command.type) {
+            batch.commands[j] = batch.commands[j - 1];
+            j--;
+        }
+        batch.commands[j] = command;
+    }
+    return true;
+}
+
+bool parseActions(const char* body, size_t length, ActionBatch& batch) {
+    Cursor c = {body, body + length, nullptr};
+    batch.count = 0;
+    batch.error = nullptr;
+    batch.errorOffset = 0;
+
+    bool ok;
+    if (consume(c, '[')) {
+        ok = true;
+        if (!consume(c, ']')) {
+            do {
+                ok = readCommandObject(c, batch);
+            } while (ok && consume(c, ','));
+            if (ok && !consume(c, ']')) ok = fail(c, "expected ',' or ']'");
+        }
+    } else {
+        skipSpace(c);
+        ok = c.p < c.end && *c.p == '{' ? readCommandObject(c, batch) : fail(c, "expected an object or array");
+    }
+    if (ok) {
+        skipSpace(c);
+        if (c.p < c.end) ok = fail(c, "unexpected data after JSON");
+    }
+
+    if (!ok) {
+        batch.count = 0;
+        batch.error = c.error;
+        batch.errorOffset = c.p - body;
+    }
+    return ok;
+}
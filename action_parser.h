@@ -0,0 +1,82 @@
+#ifndef ACTION_PARSER_H
+#define ACTION_PARSER_H
+
+#include <Arduino.h>
+
+// ==========================================
+// Action Parser
+// ==========================================
+// Decodes a POST /action body in one pass, straight from the request
+// buffer into a fixed ActionBatch: no String copy, no JSON document. The
+// body is either one command object, as the pages always sent it (several
+// keys allowed), or an array of them so a page can send a combined change
+// in a single request:
+//
+//   {"securityAuto":false,"security":true}
+//   [{"luminaryAuto":false},{"forceLuminary":true},{"config":{"soilDry":3000}}]
+//
+// Within an object, keys expand in a fixed order (the order handleAction()
+// always applied them); objects apply in array order.
+const size_t ACTION_MAX_COMMANDS = 16;
+const size_t ACTION_NAME_SIZE = 24; // Longest known key is 21 chars
+
+enum ActionType : uint8_t {
+    ACTION_IRRIGATION_AUTO,
+    ACTION_FORCE_IRRIGATION,
+    ACTION_CONFIG,
+    ACTION_TANK_AUTO,
+    ACTION_FORCE_TANK,
+    ACTION_SECURITY_AUTO,
+    ACTION_SECURITY,
+    ACTION_SECURITY_SCHEDULE,
+    ACTION_CLEAR_ALARM,
+    ACTION_LUMINARY_AUTO,
+    ACTION_FORCE_LUMINARY,
+    ACTION_UNKNOWN
+};
+
+// "config" object members, in the order handleAction() assigns them
+enum ConfigField : uint8_t {
+    CONFIG_SOIL_DRY,
+    CONFIG_SOIL_WET,
+    CONFIG_SOIL_THRESHOLD,
+    CONFIG_TANK_EMPTY,
+    CONFIG_TANK_FULL,
+    CONFIG_TANK_CRITICAL,
+    CONFIG_LIGHT_MIN,
+    CONFIG_LIGHT_MAX,
+    CONFIG_LIGHT_LOW,
+    CONFIG_LIGHT_HIGH,
+    CONFIG_DATA_SEND_INTERVAL,
+    CONFIG_SERVER_POLLING_INTERVAL,
+    CONFIG_STATUS_POLLING_INTERVAL,
+    CONFIG_FIELD_COUNT
+};
+
+struct ActionCommand {
+    ActionType type;
+    const char* error;               // Set if the value was unusable; not applied
+    char name[ACTION_NAME_SIZE];     // Key as sent, for the per-command result
+    bool enable;                     // Toggles
+    int duration;                    // ACTION_FORCE_IRRIGATION, minutes
+    char start[6];                   // ACTION_SECURITY_SCHEDULE, "HH:MM"
+    char end[6];
+    uint16_t configMask;             // ACTION_CONFIG: bit per ConfigField sent
+    float config[CONFIG_FIELD_COUNT];
+};
+
+struct ActionBatch {
+    ActionCommand commands[ACTION_MAX_COMMANDS];
+    size_t count;
+    const char* error;  // Why parsing failed, nullptr on success
+    size_t errorOffset; // Byte offset into the body
+};
+
+// Fills batch from body[0, length). Returns false on malformed JSON or more
+// than ACTION_MAX_COMMANDS commands; batch.error says why and nothing
+// should be applied. Per-command problems (a string where a bool belongs,
+// an unknown key, a config value or duration out of range) only mark that
+// command. Every value left in config[] and duration fits its setting.
+bool parseActions(const char* body, size_t length, ActionBatch& batch);
+
+#endif // ACTION_PARSER_H
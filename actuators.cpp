@@ -1,46 +1,47 @@
-#include "actuators.h"
-
-void initActuators() {
-    pinMode(RELAY_PIN, OUTPUT);
-    pinMode(RELAY_TANK_PIN, OUTPUT);
-    pinMode(BUZZER_PIN, OUTPUT);
-    pinMode(SECURITY_LED_PIN, OUTPUT);
-    pinMode(LUMINARY_LED_PIN, OUTPUT);
-
-    // Inicializar estados (LEDs apagados)
-    digitalWrite(RELAY_PIN, LOW);
-    digitalWrite(RELAY_TANK_PIN, LOW);
-    digitalWrite(BUZZER_PIN, LOW);
-    digitalWrite(SECURITY_LED_PIN, LOW);
-    digitalWrite(LUMINARY_LED_PIN, LOW);
-}
-
-void setPumpState(bool state) {
-    digitalWrite(RELAY_PIN, state ? HIGH : LOW);
-}
-
-void setTankPumpState(bool state) {
-    digitalWrite(RELAY_TANK_PIN, state ? HIGH : LOW);
-}
-
-void setBuzzer(bool state) {
-    if (state) {
-        // Generate 2000Hz alarm tone (typical alarm frequency)
-        tone(BUZZER_PIN, 2000);
-    } else {
-        // Stop the tone
-        noTone(BUZZER_PIN);
-    }
-}
-
-void setBuzzerTone(int frequency, int duration) {
-    tone(BUZZER_PIN, frequency, duration);
-}
-
-void setSecurityLed(bool state) {
-    digitalWrite(SECURITY_LED_PIN, state ? HIGH : LOW);
-}
-
-void setLuminaryState(bool state) {
-    digitalWrite(LUMINARY_LED_PIN, state ? HIGH : LOW);
-}
+#include "actuators.h"
+#include "hal.h"
+
+void initActuators() {
+    halPinMode(RELAY_PIN, OUTPUT);
+    halPinMode(RELAY_TANK_PIN, OUTPUT);
+    halPinMode(BUZZER_PIN, OUTPUT);
+    halPinMode(SECURITY_LED_PIN, OUTPUT);
+    halPinMode(LUMINARY_LED_PIN, OUTPUT);
+
+    // Inicializar estados (LEDs apagados)
+    halDigitalWrite(RELAY_PIN, LOW);
+    halDigitalWrite(RELAY_TANK_PIN, LOW);
+    halDigitalWrite(BUZZER_PIN, LOW);
+    halDigitalWrite(SECURITY_LED_PIN, LOW);
+    halDigitalWrite(LUMINARY_LED_PIN, LOW);
+}
+
+void setPumpState(bool state) {
+    halDigitalWrite(RELAY_PIN, state ? HIGH : LOW);
+}
+
+void setTankPumpState(bool state) {
+    halDigitalWrite(RELAY_TANK_PIN, state ? HIGH : LOW);
+}
+
+void setBuzzer(bool state) {
+    if (state) {
+        // Generate 2000Hz alarm tone (typical alarm frequency)
+        halTone(BUZZER_PIN, 2000);
+    } else {
+        // Stop the tone
+        halNoTone(BUZZER_PIN);
+    }
+}
+
+void setBuzzerTone(int frequency, int duration) {
+    halTone(BUZZER_PIN, frequency, duration);
+}
+
+void setSecurityLed(bool state) {
+    halDigitalWrite(SECURITY_LED_PIN, state ? HIGH : LOW);
+}
+
+void setLuminaryState(bool state) {
+    halDigitalWrite(LUMINARY_LED_PIN, state ? HIGH : LOW);
+}
@@ -1,4 +1,4 @@
-#include "config.h"
-
-// Definition of NTP server address
-const char* NTP_SERVER = "pool.ntp.org";
+#include "config.h"
+
+// Definition of NTP server address
+const char* NTP_SERVER = "pool.ntp.org";
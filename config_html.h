@@ -1,431 +1,660 @@
-#ifndef CONFIG_HTML_H_H
-#define CONFIG_HTML_H_H
-
-#include <Arduino.h>
-
-const char config_html[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xED, 0x3D, 0xDB, 0x76, 0xDB, 0x46, 
-0x92, 0xEF, 0xF9, 0x8A, 0x36, 0x37, 0x09, 0xA9, 0x19, 0x82, 0xE2, 0x55, 0x17, 0x5A, 0xD2, 0xAE, 
-0x2C, 0xC9, 0xB1, 0xF7, 0x48, 0xB6, 0x8F, 0x25, 0x3B, 0x9B, 0xB3, 0xD9, 0x33, 0x69, 0x02, 0x4D, 
-0xB2, 0x63, 0x10, 0xE0, 0x02, 0xA0, 0x24, 0xC6, 0xA3, 0x6F, 0xD8, 0x6F, 0xC8, 0x07, 0xE4, 0x9C, 
-0xDD, 0x33, 0x6F, 0xFB, 0xB8, 0xFE, 0x93, 0xFD, 0x92, 0xAD, 0xEA, 0x06, 0x40, 0x5C, 0xBA, 0x41, 
-0xF0, 0x22, 0x4D, 0x66, 0xCE, 0xD2, 0x89, 0x4D, 0x02, 0xDD, 0xD5, 0x75, 0xEB, 0xEA, 0xAA, 0xAE, 
-0x42, 0xE3, 0xE8, 0xD9, 0xF9, 0xDB, 0xB3, 0x9B, 0x1F, 0xDE, 0x5D, 0x90, 0x71, 0x30, 0xB1, 0x4F, 
-0xBE, 0x3A, 0xC2, 0x7F, 0x88, 0x4D, 0x9D, 0xD1, 0x71, 0x85, 0xF9, 0x15, 0xBC, 0xC0, 0xA8, 0x75, 
-0xF2, 0x15, 0x81, 0xCF, 0xD1, 0x84, 0x05, 0x94, 0x98, 0x63, 0xEA, 0xF9, 0x2C, 0x38, 0xAE, 0x7C, 
-0xB8, 0x79, 0x69, 0x1C, 0x54, 0x92, 0xB7, 0x1C, 0x3A, 0x61, 0xC7, 0x95, 0x5B, 0xCE, 0xEE, 0xA6, 
-0xAE, 0x17, 0x54, 0x88, 0xE9, 0x3A, 0x01, 0x73, 0xA0, 0xE9, 0x1D, 0xB7, 0x82, 0xF1, 0xB1, 0xC5, 
-0x6E, 0xB9, 0xC9, 0x0C, 0xF1, 0xA3, 0x4E, 0xB8, 0xC3, 0x03, 0x4E, 0x6D, 0xC3, 0x37, 0xA9, 0xCD, 
-0x8E, 0x5B, 0x8D, 0x66, 0x04, 0x2A, 0xE0, 0x81, 0xCD, 0x4E, 0xCE, 0x5C, 0x67, 0xC8, 0x47, 0x33, 
-0x8F, 0x9A, 0xFC, 0xCB, 0x5F, 0x1C, 0x62, 0x90, 0x77, 0xD4, 0x61, 0x36, 0xB1, 0x18, 0x81, 0x3B, 
-0x81, 0xE7, 0xDA, 0x47, 0xBB, 0xB2, 0xA1, 0xEC, 0xE4, 0x9B, 0x1E, 0x9F, 0x06, 0xF2, 0x07, 0x7E, 
-0x76, 0x77, 0xC9, 0xE9, 0x74, 0x6A, 0xCF, 0x49, 0x30, 0x66, 0x13, 0x46, 0x5E, 0x5F, 0x5D, 0x5D, 
-0x9C, 0xBF, 0x3E, 0xBD, 0xB9, 0xB8, 0xFC, 0x81, 0x0C, 0xD8, 0xD0, 0xF5, 0x18, 0xA1, 0xCE, 0x3C, 
-0x18, 0x73, 0x67, 0x44, 0x98, 0xED, 0x33, 0x12, 0xB8, 0x64, 0xEA, 0xB1, 0x5B, 0xC0, 0x96, 0x0C, 
-0x6D, 0xEA, 0x8F, 0x63, 0x40, 0xB5, 0xE1, 0xCC, 0x31, 0x03, 0xEE, 0x3A, 0xB5, 0x1D, 0xF2, 0x39, 
-0xBE, 0x8A, 0x9F, 0xC0, 0x9B, 0x67, 0xAE, 0xE0, 0x07, 0x68, 0xF6, 0x03, 0xE2, 0xD3, 0x5B, 0x66, 
-0xDD, 0x88, 0xA1, 0x8F, 0x89, 0xED, 0x02, 0x89, 0xD7, 0x81, 0xEB, 0xD1, 0x11, 0x6B, 0x8C, 0x58, 
-0xF0, 0x3A, 0x60, 0x93, 0x5A, 0x55, 0x20, 0x56, 0xDD, 0x79, 0xAE, 0x81, 0x40, 0x11, 0xFB, 0x08, 
-0x82, 0x16, 0x87, 0xE8, 0xC3, 0x87, 0xA4, 0x66, 0xB9, 0xE6, 0x6C, 0x02, 0x04, 0x34, 0x06, 0xAE, 
-0x35, 0xD7, 0x35, 0x8C, 0x1A, 0x27, 0x11, 0x3C, 0x3E, 0x26, 0x55, 0x8B, 0x7A, 0x9F, 0xAA, 0x45, 
-0x9D, 0xF0, 0x13, 0x8F, 0x10, 0x7D, 0xB9, 0xB0, 0x99, 0xF8, 0x6D, 0x02, 0xCB, 0xFC, 0x4B, 0xEE, 
-0x07, 0x0D, 0x6A, 0x59, 0x35, 0x01, 0xCC, 0xD0, 0xD2, 0x57, 0x0A, 0x22, 0x68, 0xD8, 0x69, 0x10, 
-0x78, 0x7C, 0x30, 0x0B, 0x58, 0xAD, 0xEA, 0x07, 0x73, 0x9B, 0x55, 0xEB, 0xA4, 0x3A, 0xA0, 0xE6, 
-0xA7, 0x91, 0xE7, 0xCE, 0x1C, 0xCB, 0x30, 0x5D, 0xDB, 0xF5, 0xFA, 0xE4, 0x1F, 0x9A, 0xB4, 0x39, 
-0x6C, 0x31, 0xF2, 0x8C, 0x4F, 0x50, 0xE9, 0xA8, 0x13, 0x3C, 0x2F, 0x3D, 0x28, 0x32, 0x6A, 0x0B, 
-0xB8, 0x0B, 0x30, 0x9B, 0x20, 0x4C, 0xA2, 0x5B, 0x43, 0xF1, 0x29, 0x4B, 0xCB, 0x83, 0xF6, 0x0E, 
-0x68, 0xFF, 0x15, 0xD0, 0x11, 0x2A, 0x3F, 0xF5, 0x85, 0x36, 0x71, 0x66, 0xA1, 0x9A, 0xFB, 0x63, 
-0xF7, 0x2E, 0x9A, 0x99, 0x5A, 0x00, 0x85, 0x2C, 0x12, 0x50, 0x8D, 0x10, 0xA4, 0x0E, 0xC1, 0x3C, 
-0x72, 0x0F, 0xF9, 0x86, 0xB9, 0x0B, 0x2B, 0xAB, 0x66, 0x3C, 0xCF, 0x05, 0x8E, 0x30, 0xA9, 0x2D, 
-0x22, 0x78, 0xEF, 0x13, 0x3E, 0x99, 0x30, 0x8B, 0xD3, 0x80, 0xD9, 0x73, 0x65, 0xCF, 0xED, 0x29, 
-0xF3, 0x93, 0x2A, 0xF1, 0xE6, 0xD3, 0x7F, 0x61, 0x59, 0x6A, 0x3A, 0xD9, 0x49, 0x9B, 0xA8, 0x07, 
-0x01, 0x5C, 0x7F, 0x3D, 0x24, 0x38, 0x10, 0x10, 0xCF, 0x7C, 0xA7, 0x1A, 0x10, 0x76, 0x0F, 0x1C, 
-0x23, 0x73, 0x16, 0xD4, 0xC9, 0x1D, 0xE5, 0x60, 0x45, 0x5D, 0x8F, 0xF0, 0x12, 0x0A, 0x06, 0x3C, 
-0xBE, 0x40, 0xB3, 0x8B, 0x0C, 0x67, 0x0E, 0xF3, 0x6A, 0xD5, 0xF3, 0xB7, 0x57, 0x67, 0x52, 0x3D, 
-0x2F, 0x5D, 0x6A, 0x81, 0x86, 0xD5, 0x13, 0x28, 0x17, 0x4C, 0x07, 0x54, 0x05, 0xDB, 0x77, 0x85, 
-0x5D, 0x4E, 0x08, 0x1F, 0x16, 0x1A, 0x62, 0x52, 0x20, 0x27, 0x0B, 0x97, 0x50, 0xDB, 0x83, 0xB5, 
-0x6D, 0x4E, 0x86, 0xDC, 0x63, 0x56, 0xA1, 0xB5, 0x8C, 0xB1, 0x15, 0x1D, 0xAE, 0x03, 0x00, 0x2C, 
-0x75, 0xD3, 0x06, 0x48, 0xB0, 0x86, 0x94, 0xB7, 0x9C, 0xDB, 0x23, 0x77, 0xA9, 0x90, 0xF0, 0xB3, 
-0x5C, 0xD6, 0x02, 0x54, 0xD9, 0x19, 0x5C, 0x34, 0x24, 0xB0, 0x1F, 0x29, 0x13, 0x82, 0xB7, 0xF9, 
-0x68, 0x1C, 0x48, 0xEB, 0x53, 0x27, 0x13, 0xB4, 0x44, 0x0B, 0x1B, 0xB4, 0xB9, 0x02, 0x6F, 0xC1, 
-0x38, 0x2D, 0xE3, 0xDD, 0x6A, 0xF2, 0x5A, 0xBA, 0x3C, 0x6F, 0x0F, 0x73, 0x81, 0x7D, 0x79, 0x93, 
-0x9B, 0xBA, 0xF2, 0x00, 0xF3, 0x20, 0x30, 0xC7, 0x35, 0xA6, 0x42, 0x13, 0xBD, 0x0E, 0xD7, 0x66, 
-0x0D, 0xE6, 0x79, 0x2E, 0x50, 0x79, 0x81, 0xFF, 0x48, 0xF5, 0x41, 0x1F, 0x49, 0xE0, 0xD6, 0x07, 
-0x52, 0x55, 0x1A, 0x09, 0x92, 0xBF, 0x4E, 0x2C, 0x2A, 0x04, 0xDD, 0x28, 0x94, 0x28, 0x74, 0xF2, 
-0x58, 0x15, 0x8D, 0x32, 0x11, 0x50, 0x95, 0xD6, 0xBE, 0x94, 0xD4, 0x37, 0xE3, 0x5B, 0x86, 0x0B, 
-0xF1, 0xAF, 0x87, 0x9D, 0x68, 0x52, 0x1C, 0xED, 0x26, 0xFD, 0xC7, 0x23, 0x61, 0xA9, 0x13, 0xBE, 
-0xE4, 0x1F, 0xC8, 0x99, 0x07, 0xCE, 0x2A, 0x78, 0x71, 0xE1, 0x8A, 0x1A, 0x2E, 0x31, 0x59, 0xA7, 
-0x11, 0xBC, 0xD4, 0xC9, 0x0C, 0xAC, 0xE0, 0x80, 0x81, 0xD1, 0xB1, 0xB9, 0xC3, 0xC8, 0x1F, 0x76, 
-0x63, 0x28, 0xC2, 0xB1, 0x4E, 0x93, 0xA7, 0x58, 0x08, 0x86, 0x9D, 0x61, 0x77, 0xB8, 0xB7, 0xA0, 
-0xE1, 0x21, 0xD5, 0xBF, 0xB1, 0x58, 0x8C, 0x96, 0x83, 0xCA, 0xAF, 0x29, 0x0A, 0xA8, 0xC2, 0x86, 
-0xAF, 0x8C, 0x15, 0x7E, 0xA2, 0x7B, 0xAD, 0x61, 0xFB, 0xB0, 0xB3, 0x9F, 0xBE, 0x17, 0x78, 0xD4, 
-0xF1, 0x39, 0x4E, 0x89, 0x7E, 0x0E, 0x1C, 0x69, 0x36, 0x7A, 0x3E, 0x61, 0x60, 0x91, 0xEB, 0x24, 
-0x73, 0x21, 0x0D, 0xC4, 0x9D, 0x82, 0xEF, 0x1F, 0xCC, 0xFB, 0xA4, 0x55, 0x86, 0x1D, 0xE5, 0x08, 
-0x29, 0xE0, 0x49, 0x92, 0xA6, 0xBC, 0x1F, 0xA6, 0xC0, 0x00, 0xD4, 0xE2, 0x15, 0x87, 0x78, 0x24, 
-0x52, 0xFB, 0x99, 0x13, 0xF0, 0x48, 0x41, 0xF8, 0xC2, 0xE5, 0x4A, 0xA8, 0x00, 0xE2, 0xD8, 0x77, 
-0xDC, 0xA0, 0xD6, 0x48, 0xE9, 0x6C, 0x56, 0xEB, 0x63, 0xC2, 0x9B, 0x3A, 0x89, 0xA5, 0xFB, 0xEB, 
-0xBA, 0xB7, 0xF4, 0x42, 0x09, 0xDB, 0x00, 0xEB, 0x5B, 0x59, 0xD6, 0xA7, 0x08, 0x3C, 0xA3, 0x9E, 
-0x25, 0xBD, 0x2A, 0xA4, 0x92, 0x82, 0x4A, 0x7B, 0x7E, 0x56, 0xA9, 0x93, 0x52, 0x68, 0xC0, 0x1C, 
-0xE1, 0x03, 0x8F, 0xE2, 0x28, 0x86, 0x09, 0x9D, 0xB5, 0x22, 0xE9, 0x13, 0x9C, 0x20, 0xD4, 0x33, 
-0x46, 0x1E, 0x2C, 0xA1, 0xC0, 0xBF, 0x5A, 0xAB, 0xD3, 0xB3, 0xD8, 0xA8, 0x0E, 0x1A, 0xC5, 0x40, 
-0xA3, 0x06, 0xA4, 0xF9, 0x0D, 0x7E, 0xA7, 0xED, 0x4E, 0xA7, 0x4D, 0x5A, 0xCD, 0xE6, 0x37, 0x3B, 
-0x5A, 0xB1, 0x0D, 0x5C, 0xCF, 0x62, 0x5E, 0x2C, 0xE4, 0x4E, 0xA7, 0xDB, 0xEA, 0xF5, 0xB6, 0x23, 
-0xE4, 0x1C, 0x81, 0x48, 0x81, 0x31, 0x08, 0x9C, 0x02, 0xC2, 0x22, 0x02, 0x4A, 0xA2, 0xDB, 0xDD, 
-0xEF, 0xF5, 0xF6, 0x0E, 0xD7, 0xC6, 0xC3, 0xBF, 0x1D, 0x65, 0x70, 0x89, 0x00, 0xB3, 0x36, 0x3B, 
-0x18, 0x36, 0x97, 0x6B, 0xF1, 0x0D, 0xBB, 0x07, 0xA3, 0x2D, 0x7D, 0xD6, 0x25, 0xD2, 0x15, 0x41, 
-0xB9, 0x21, 0x02, 0xEF, 0x75, 0x24, 0x1B, 0xB2, 0x5C, 0x48, 0xD6, 0x1C, 0x58, 0x3D, 0xD6, 0x5A, 
-0x22, 0x59, 0xE3, 0x8E, 0x0D, 0x3E, 0xF1, 0xC0, 0x48, 0x4E, 0x65, 0x9B, 0x4F, 0xFB, 0x24, 0x40, 
-0x9C, 0x97, 0xF5, 0xC2, 0x46, 0xC6, 0x90, 0xDB, 0x76, 0xC4, 0x6B, 0x31, 0x05, 0xA6, 0xD4, 0xC3, 
-0xE9, 0xAA, 0x95, 0x4E, 0xE9, 0xA1, 0x0A, 0xA4, 0x93, 0x9B, 0x06, 0xE3, 0x8E, 0x46, 0x48, 0x21, 
-0x1B, 0x74, 0xD8, 0x2C, 0x6C, 0x41, 0x63, 0x7F, 0x55, 0x24, 0xB8, 0x33, 0x9D, 0x05, 0x06, 0xD2, 
-0x32, 0x25, 0x36, 0x1D, 0xB0, 0xEC, 0xF2, 0x53, 0x02, 0x85, 0x92, 0xD0, 0xC3, 0x1F, 0x63, 0x0E, 
-0x7C, 0x55, 0x8F, 0x71, 0xD8, 0xA5, 0x9D, 0xC1, 0xC1, 0x72, 0x5D, 0x7C, 0x8D, 0x80, 0x8A, 0x95, 
-0x30, 0x39, 0xB0, 0xF8, 0x5E, 0x34, 0x15, 0xC1, 0xDC, 0xEF, 0xB7, 0xE9, 0x16, 0xA6, 0x62, 0x92, 
-0x98, 0x61, 0x6B, 0xD8, 0x1B, 0xAE, 0x3C, 0x63, 0x73, 0x78, 0xF7, 0x87, 0xE0, 0xD6, 0xF8, 0x59, 
-0xEC, 0xD3, 0x18, 0xED, 0x35, 0x69, 0x6F, 0x58, 0x84, 0xFF, 0xBD, 0xE1, 0x8F, 0xA9, 0xE5, 0xDE, 
-0x81, 0x86, 0x88, 0x3F, 0x9D, 0xE9, 0x3D, 0xF1, 0x46, 0x03, 0x5A, 0x3B, 0xDC, 0xAB, 0x93, 0xD6, 
-0x5E, 0xAF, 0x4E, 0xDA, 0xBD, 0x66, 0x1D, 0xD4, 0xA7, 0xAD, 0x9E, 0x65, 0x2B, 0x21, 0xDC, 0x9F, 
-0xDA, 0xD4, 0x64, 0x63, 0xD7, 0x06, 0x14, 0x35, 0x82, 0xDE, 0xEB, 0xEE, 0x77, 0x0F, 0xD4, 0xB6, 
-0x2F, 0x25, 0xE8, 0x17, 0xB3, 0x20, 0x00, 0x97, 0xB3, 0x50, 0xD2, 0x60, 0xDE, 0x0C, 0x6A, 0x9A, 
-0x6C, 0x5A, 0x24, 0x62, 0xFD, 0x32, 0xB2, 0x47, 0x3B, 0x5D, 0x1A, 0x2E, 0x23, 0xBD, 0x83, 0x66, 
-0xC7, 0x2A, 0x30, 0x36, 0x45, 0x96, 0x16, 0xB0, 0x00, 0x06, 0x3B, 0x18, 0xEB, 0xAD, 0x83, 0x47, 
-0x77, 0xD8, 0xDD, 0x63, 0x3D, 0x89, 0x47, 0xB7, 0xD3, 0x39, 0x30, 0xE9, 0x7A, 0x78, 0x70, 0xB0, 
-0xBE, 0x60, 0x7A, 0x27, 0xE8, 0x8F, 0xAF, 0x81, 0x06, 0xDD, 0x3F, 0x18, 0x0C, 0x43, 0x76, 0x1C, 
-0x0C, 0x7A, 0xE6, 0x70, 0xAF, 0x14, 0x1A, 0x4A, 0x2F, 0x58, 0xAE, 0x03, 0x44, 0xAE, 0x03, 0x22, 
-0xD2, 0x77, 0x7C, 0x04, 0x40, 0xC0, 0xB2, 0x82, 0x6A, 0x20, 0x86, 0x09, 0xB9, 0x16, 0x2D, 0x1B, 
-0x43, 0x70, 0x2B, 0x0C, 0x9F, 0xFF, 0xC2, 0xFA, 0xA4, 0xDD, 0x68, 0x7B, 0x6C, 0xF2, 0x3C, 0x7F, 
-0xFB, 0x8E, 0x61, 0x38, 0xD9, 0x27, 0x07, 0xCD, 0xA6, 0x7A, 0x3E, 0xAA, 0x5C, 0x50, 0x88, 0x3A, 
-0x47, 0xDC, 0x49, 0xF9, 0x50, 0xF8, 0xB1, 0x59, 0x10, 0xC0, 0xF4, 0xF2, 0xD1, 0xAC, 0x3A, 0xA3, 
-0x3E, 0x31, 0x9A, 0x8D, 0x66, 0x3B, 0x39, 0x6A, 0x91, 0x51, 0xD7, 0x93, 0x91, 0x76, 0x94, 0x0B, 
-0x58, 0x0A, 0x91, 0xC6, 0x22, 0xB8, 0x38, 0x02, 0x61, 0x7D, 0x02, 0x9E, 0xD9, 0xC7, 0x15, 0x19, 
-0x51, 0x8C, 0x19, 0x0B, 0x2A, 0x64, 0xEC, 0xB1, 0x61, 0x78, 0xA5, 0x61, 0xFA, 0x7E, 0x45, 0x1D, 
-0x95, 0x44, 0xE8, 0xC4, 0x8E, 0x59, 0x06, 0xA5, 0x09, 0xBD, 0x97, 0x5B, 0xED, 0xE0, 0x08, 0x76, 
-0x9B, 0xCD, 0xE9, 0xFD, 0x73, 0x14, 0xE1, 0xF7, 0x1C, 0xA7, 0xEE, 0xA2, 0x0F, 0x0A, 0xAF, 0x8B, 
-0xE8, 0xCF, 0x26, 0xE9, 0xC9, 0x98, 0xE2, 0x21, 0xA1, 0xB3, 0xC0, 0x4D, 0x33, 0x72, 0x0A, 0xB1, 
-0x97, 0xE0, 0x60, 0x1B, 0x40, 0x83, 0xA1, 0x01, 0xF8, 0x09, 0x52, 0x73, 0x58, 0x62, 0x16, 0x21, 
-0x87, 0xA2, 0xC5, 0x7D, 0x30, 0x28, 0xB0, 0xB8, 0x0D, 0x6D, 0x76, 0x9F, 0x06, 0x0F, 0xEB, 0xE7, 
-0xC8, 0x31, 0x78, 0xC0, 0x26, 0x7E, 0x9F, 0x98, 0xA0, 0xC8, 0xCC, 0x4B, 0x37, 0x18, 0x51, 0x58, 
-0x9A, 0xD3, 0xC3, 0x2E, 0x50, 0x36, 0x06, 0x2E, 0x58, 0x97, 0x09, 0x20, 0xD7, 0xCD, 0x36, 0x08, 
-0xF1, 0x8E, 0x5B, 0xE4, 0x41, 0x84, 0x16, 0x38, 0x6E, 0x00, 0xE4, 0x41, 0x64, 0xCC, 0x2D, 0x72, 
-0x4B, 0xBD, 0x9A, 0x61, 0x24, 0x0D, 0xF4, 0x8E, 0x9A, 0x66, 0x8D, 0x8F, 0xB8, 0x09, 0xB9, 0x3F, 
-0x43, 0x5C, 0xC9, 0x87, 0x73, 0x23, 0x0C, 0x36, 0xD4, 0x8D, 0x42, 0x71, 0x77, 0x9B, 0x59, 0x92, 
-0xC6, 0xE1, 0x0C, 0xCA, 0xDF, 0x49, 0x9A, 0x0E, 0x49, 0x1F, 0xBA, 0x2B, 0xC6, 0x60, 0xB4, 0xA3, 
-0x62, 0x4A, 0x69, 0x6E, 0x24, 0xF8, 0x88, 0x86, 0x68, 0x06, 0x54, 0xB5, 0x72, 0x63, 0x9B, 0x33, 
-0xCF, 0xC7, 0x59, 0x33, 0x75, 0x79, 0x9E, 0x96, 0x64, 0xB4, 0x42, 0x6D, 0x1B, 0x17, 0x30, 0x55, 
-0x90, 0x18, 0x4E, 0x3C, 0x89, 0x8C, 0xF0, 0xF7, 0x7C, 0x06, 0x3C, 0x82, 0x69, 0x3B, 0x5F, 0x22, 
-0x9C, 0xFE, 0xD8, 0xBD, 0xCD, 0x69, 0x64, 0x9E, 0x1D, 0x83, 0x91, 0x92, 0xB8, 0xFC, 0xB8, 0x53, 
-0x8F, 0x4F, 0xD2, 0xA3, 0xC6, 0x64, 0xC0, 0x24, 0x9B, 0x84, 0xCE, 0xA7, 0x4D, 0x03, 0xF6, 0x2F, 
-0x35, 0xA3, 0x3D, 0xBD, 0x5F, 0xA6, 0x3B, 0x79, 0xBF, 0x3E, 0x14, 0x6F, 0x5B, 0x2B, 0xDE, 0xF4, 
-0x1D, 0xC5, 0x2C, 0x7C, 0x2C, 0x0B, 0xBC, 0x94, 0x0D, 0xEB, 0x5B, 0xE3, 0x1C, 0x0D, 0x23, 0x8F, 
-0x67, 0x97, 0xE1, 0x78, 0x62, 0xE1, 0xBD, 0x8C, 0x99, 0x80, 0x2B, 0x80, 0xD8, 0x64, 0x8A, 0x8C, 
-0x37, 0x42, 0x3B, 0xD7, 0x07, 0x9B, 0x3B, 0x65, 0x34, 0xA8, 0xB5, 0xC1, 0x45, 0x1A, 0x82, 0x68, 
-0xD1, 0x32, 0xB6, 0x63, 0x2B, 0x28, 0x76, 0x30, 0x01, 0x61, 0x34, 0x94, 0x22, 0xFE, 0xCD, 0x98, 
-0x45, 0x61, 0x7A, 0xF2, 0x96, 0xA5, 0xD0, 0xF4, 0x24, 0x08, 0xF9, 0x27, 0xB1, 0x35, 0x4D, 0x6A, 
-0x09, 0x03, 0x7D, 0x88, 0xF6, 0x39, 0xBB, 0x0D, 0x50, 0x40, 0x70, 0x01, 0x65, 0x40, 0x8F, 0x20, 
-0xA7, 0x15, 0x92, 0x43, 0x5C, 0x50, 0xA5, 0x09, 0xCC, 0x20, 0xA0, 0xC6, 0x37, 0x3D, 0xC6, 0xF2, 
-0x66, 0xFE, 0x41, 0xCD, 0xEE, 0xF2, 0x91, 0xFC, 0x23, 0x1B, 0x8E, 0x9C, 0x85, 0x5E, 0xAC, 0x3D, 
-0x07, 0x79, 0xE3, 0x9D, 0x74, 0x88, 0xD1, 0xE6, 0x80, 0xFF, 0x0B, 0x7F, 0x19, 0xBD, 0xC8, 0x2F, 
-0x6E, 0xD6, 0xC5, 0x9F, 0x46, 0x6B, 0x07, 0xBC, 0x62, 0x72, 0x80, 0x8B, 0x17, 0xB6, 0x32, 0xF6, 
-0xF2, 0x0D, 0x96, 0x59, 0xA4, 0x8E, 0x0F, 0x36, 0x6C, 0xC0, 0x4D, 0x63, 0xC0, 0x7E, 0xE1, 0xCC, 
-0xAB, 0x35, 0x1B, 0x5D, 0x80, 0x29, 0x9C, 0x6D, 0x50, 0xAC, 0x4C, 0xF7, 0x02, 0xEB, 0x8F, 0x57, 
-0x0C, 0x8B, 0x7B, 0xCC, 0x94, 0xD0, 0xA5, 0xE4, 0x14, 0xEB, 0x5D, 0xC1, 0x04, 0xCF, 0x48, 0x4B, 
-0x6D, 0xDD, 0x52, 0xCC, 0x11, 0x0B, 0x77, 0x57, 0xD0, 0x2E, 0x38, 0x90, 0x26, 0xBE, 0x27, 0xD8, 
-0x23, 0x19, 0xD8, 0xD4, 0x30, 0xB0, 0x28, 0x96, 0x92, 0x52, 0x0E, 0xAD, 0x81, 0x52, 0xCC, 0x2A, 
-0xD3, 0xF8, 0x43, 0xCD, 0xE8, 0x6A, 0x4D, 0xE3, 0xF2, 0xA0, 0x3A, 0x61, 0xCB, 0x5A, 0x8D, 0x4E, 
-0xB1, 0x2D, 0xDB, 0x5F, 0x6E, 0xCB, 0x54, 0x4B, 0x09, 0x7E, 0x92, 0x41, 0x79, 0x86, 0x26, 0xEC, 
-0x96, 0x20, 0x6C, 0x36, 0x9D, 0x32, 0xCF, 0xCC, 0xAD, 0x5A, 0x59, 0xBB, 0x07, 0x66, 0xAF, 0x97, 
-0x45, 0x56, 0x63, 0x32, 0x37, 0xF7, 0x99, 0xFE, 0x2A, 0x2E, 0x51, 0x52, 0x76, 0x18, 0xC8, 0xA8, 
-0x97, 0xB6, 0x5E, 0x5B, 0xB7, 0xB4, 0xE5, 0xEF, 0x64, 0xAD, 0x44, 0x8E, 0xAC, 0x47, 0x77, 0xB7, 
-0x8A, 0xD5, 0x29, 0xA5, 0x8B, 0xDD, 0x9C, 0x2E, 0x66, 0xE6, 0x22, 0x70, 0x34, 0x6F, 0x80, 0xDA, 
-0x1A, 0x66, 0x8A, 0x48, 0xD0, 0x77, 0xB9, 0x4D, 0x3E, 0x97, 0x0C, 0x85, 0x9B, 0x83, 0xC3, 0x83, 
-0x96, 0x8C, 0xFD, 0x9A, 0xBD, 0xC3, 0xBD, 0xBD, 0x43, 0x19, 0xFB, 0xC5, 0x95, 0x07, 0x77, 0x63, 
-0x60, 0xC6, 0xF3, 0xC4, 0x4A, 0x10, 0x46, 0x9B, 0x14, 0xE2, 0x93, 0x92, 0x63, 0x74, 0x06, 0x07, 
-0x6D, 0x08, 0x7D, 0xC4, 0x18, 0xED, 0xDE, 0x5E, 0x87, 0x0D, 0xCA, 0x8D, 0x21, 0x73, 0x85, 0x25, 
-0x07, 0x19, 0xF6, 0x0E, 0x59, 0x33, 0xDC, 0x1A, 0xB6, 0x0E, 0xF7, 0xF7, 0x9B, 0x7B, 0x25, 0x09, 
-0x09, 0xC3, 0xE6, 0x72, 0xA3, 0x84, 0xE1, 0xB1, 0x18, 0x65, 0xDF, 0xEC, 0x50, 0x66, 0xE9, 0x46, 
-0x49, 0x0C, 0x93, 0xD8, 0x2C, 0xC9, 0x06, 0x62, 0x29, 0xBF, 0x40, 0xE7, 0x16, 0x2C, 0xDD, 0xAE, 
-0x8B, 0xF5, 0x79, 0x60, 0xBB, 0xE6, 0x27, 0xAD, 0xB2, 0x35, 0x1B, 0x87, 0xBD, 0x62, 0xCB, 0xB7, 
-0xB7, 0xBE, 0xE5, 0xCB, 0xD0, 0x92, 0x5B, 0x7E, 0xB7, 0x64, 0xFF, 0x74, 0x6C, 0x51, 0x6D, 0xF7, 
-0x45, 0x31, 0x2E, 0x08, 0x48, 0xE3, 0x25, 0xA0, 0x69, 0x20, 0xAD, 0xBC, 0xAB, 0x50, 0xD6, 0xD7, 
-0x8F, 0x5C, 0x98, 0xF6, 0xFA, 0x2E, 0x4C, 0xCE, 0x7A, 0xA5, 0xAC, 0x43, 0xAB, 0x58, 0x5E, 0xBD, 
-0x75, 0xBD, 0xEE, 0x92, 0x31, 0x94, 0x18, 0x6C, 0x48, 0x27, 0xDC, 0x06, 0xE5, 0xAA, 0xBE, 0x46, 
-0x43, 0x57, 0xAD, 0x13, 0x1F, 0xFA, 0x82, 0x1E, 0x78, 0x7C, 0x58, 0x52, 0x2E, 0xCA, 0xED, 0x4C, 
-0x77, 0x16, 0xE0, 0x34, 0xEB, 0x13, 0xC7, 0x75, 0x98, 0x92, 0x47, 0xA5, 0xFD, 0x85, 0xF2, 0x1E, 
-0x67, 0x76, 0x4F, 0xB4, 0x1B, 0x59, 0xD6, 0xDE, 0x21, 0xF8, 0x65, 0x1D, 0xF0, 0xD0, 0xDA, 0xDD, 
-0x3D, 0x74, 0xD3, 0xC0, 0xCB, 0x59, 0x4E, 0x9C, 0x7E, 0x73, 0x3B, 0x3D, 0xEB, 0x72, 0x42, 0x5C, 
-0x79, 0x5A, 0x05, 0xEE, 0x54, 0x31, 0xA7, 0xF4, 0xDE, 0x06, 0x72, 0xD6, 0x88, 0x56, 0x48, 0x58, 
-0x64, 0xD4, 0xB4, 0x50, 0xE1, 0x55, 0x1A, 0x83, 0x70, 0xC3, 0xB5, 0xF4, 0x9E, 0x84, 0xF4, 0x16, 
-0x72, 0x9A, 0xAB, 0x5B, 0x1A, 0xC5, 0x06, 0xA1, 0xF8, 0x0A, 0xE6, 0x72, 0x90, 0xDF, 0xDD, 0xCD, 
-0xD2, 0xA9, 0xDF, 0x9A, 0xD1, 0xDC, 0x0E, 0xF5, 0x45, 0xDC, 0x5D, 0xC3, 0x03, 0x89, 0xD8, 0x90, 
-0xDB, 0x96, 0x59, 0xD8, 0x09, 0x5C, 0x81, 0x3B, 0x1A, 0x47, 0xA3, 0x40, 0x83, 0x4B, 0xCE, 0xF2, 
-0xE6, 0xCA, 0x66, 0x79, 0x0B, 0xFB, 0x23, 0x9B, 0xBB, 0x8B, 0xDA, 0x90, 0xA3, 0xD4, 0xEE, 0xBC, 
-0x14, 0x8F, 0x3F, 0x83, 0x76, 0xBE, 0x5F, 0xB4, 0x93, 0x22, 0x97, 0xD4, 0xC4, 0x40, 0x8A, 0x71, 
-0x96, 0x6E, 0xD9, 0x84, 0xCE, 0x4D, 0xA9, 0x38, 0xA3, 0x95, 0x8A, 0x33, 0x04, 0xA4, 0x94, 0xE1, 
-0x10, 0x8B, 0x46, 0x3B, 0xB2, 0x1C, 0x2D, 0xCC, 0xA6, 0x1C, 0xF4, 0xE0, 0xAF, 0xF6, 0xA1, 0xCC, 
-0xA6, 0xE8, 0x99, 0x52, 0x22, 0x59, 0xB0, 0xE5, 0x88, 0xB9, 0xCC, 0x82, 0xF0, 0xA0, 0x46, 0x72, 
-0xB3, 0x6D, 0x30, 0x95, 0x0D, 0x2F, 0xD8, 0x85, 0x8B, 0xBE, 0xC5, 0x5F, 0xC0, 0x66, 0x9C, 0x2F, 
-0x0A, 0x55, 0xFD, 0x29, 0x33, 0xF9, 0x90, 0x9B, 0x04, 0x51, 0xF2, 0xB8, 0xC5, 0x4A, 0x65, 0xA3, 
-0x95, 0x5B, 0xCB, 0xA9, 0x88, 0x25, 0x53, 0x19, 0xA0, 0xC2, 0xE8, 0x71, 0x0A, 0x19, 0x5A, 0xAD, 
-0x83, 0xF6, 0x7E, 0xE8, 0x76, 0xCB, 0x44, 0xE4, 0x4A, 0x85, 0x0C, 0x4B, 0xEB, 0x08, 0xF4, 0xFA, 
-0x1A, 0xC5, 0x10, 0x9D, 0x95, 0xD3, 0x4C, 0x25, 0x77, 0x12, 0x14, 0x59, 0x4A, 0xFD, 0x72, 0xAD, 
-0xE5, 0x50, 0xC8, 0x15, 0x99, 0xA3, 0x93, 0xDC, 0x5A, 0xC6, 0xA1, 0x24, 0xCD, 0x07, 0xD1, 0xEE, 
-0x44, 0x8A, 0xE6, 0xEE, 0xC6, 0x34, 0xE7, 0x77, 0x16, 0x36, 0xD6, 0xA7, 0x35, 0xB2, 0xD6, 0x85, 
-0xBA, 0xB1, 0xC9, 0xD0, 0xEA, 0xC4, 0x73, 0xBE, 0x82, 0xA5, 0x10, 0x81, 0xAC, 0xCC, 0x0B, 0x10, 
-0x28, 0xF4, 0x40, 0x16, 0xCB, 0xFA, 0x3A, 0xB4, 0x95, 0xB4, 0xB7, 0x65, 0x08, 0xCA, 0x8E, 0x8A, 
-0x9F, 0x74, 0x29, 0xCD, 0xCA, 0x18, 0x95, 0x58, 0xB0, 0x96, 0x4B, 0x5A, 0x96, 0x4E, 0x64, 0xC7, 
-0x8E, 0x13, 0x89, 0x47, 0xBB, 0xF2, 0x09, 0x9D, 0x23, 0x2C, 0x0C, 0x0B, 0x53, 0x85, 0x16, 0xBF, 
-0x95, 0x05, 0xF1, 0xC7, 0x95, 0x6C, 0x96, 0xB0, 0xB2, 0xC8, 0x20, 0x1E, 0x3D, 0x33, 0x0C, 0xF2, 
-0x4A, 0x5A, 0x4F, 0xC3, 0x48, 0x5C, 0xCF, 0x77, 0x97, 0x36, 0x36, 0xD1, 0x57, 0xB4, 0x93, 0x02, 
-0x8D, 0x9A, 0x46, 0x99, 0x8B, 0x0A, 0x71, 0x1D, 0xD3, 0xE6, 0xE6, 0xA7, 0xE3, 0xCA, 0xC8, 0x7D, 
-0x01, 0x17, 0x6B, 0x3B, 0x15, 0x42, 0x3D, 0x4E, 0x0D, 0x11, 0xD5, 0x1E, 0x57, 0x3E, 0xBA, 0xF6, 
-0x6D, 0x0E, 0x98, 0x00, 0x88, 0x39, 0x0F, 0x7C, 0x7C, 0xE8, 0x85, 0x7B, 0x7F, 0x5C, 0x41, 0xCF, 
-0xBD, 0xDD, 0x85, 0xFF, 0x2A, 0x04, 0x6B, 0x78, 0x8E, 0x2B, 0xE8, 0x80, 0x55, 0x88, 0x1F, 0x78, 
-0xEE, 0x27, 0x06, 0x98, 0xCD, 0x3C, 0xAC, 0xE3, 0x39, 0x43, 0x2E, 0x45, 0x57, 0xE5, 0x7E, 0xFA, 
-0x71, 0xA5, 0xAD, 0x00, 0x2E, 0x06, 0x98, 0xD2, 0x60, 0x4C, 0xAC, 0xE3, 0xCA, 0x55, 0xEB, 0x10, 
-0x8C, 0xE5, 0xAB, 0xDE, 0x55, 0xAB, 0x4D, 0x5A, 0x87, 0xB6, 0xB1, 0x6F, 0xEC, 0x13, 0xF8, 0xBF, 
-0xB2, 0xAB, 0x40, 0x6A, 0x17, 0xB0, 0xCA, 0x10, 0xBE, 0x2B, 0x29, 0xCF, 0x5C, 0x1D, 0xB7, 0x32, 
-0x5C, 0x13, 0xE9, 0x96, 0x4A, 0xE6, 0x51, 0x26, 0x90, 0x57, 0x2B, 0xC1, 0xEB, 0x5D, 0x60, 0xF6, 
-0xC9, 0x57, 0x69, 0x99, 0x9C, 0x2D, 0xCC, 0x51, 0x58, 0x81, 0xB7, 0x44, 0x3C, 0x98, 0x0B, 0xC8, 
-0x0A, 0x07, 0x01, 0x5D, 0xE3, 0x1E, 0x51, 0x12, 0x5A, 0x12, 0x4E, 0x0E, 0x56, 0xC6, 0x08, 0xAA, 
-0x04, 0x34, 0xEE, 0x68, 0x18, 0xAB, 0x81, 0x23, 0xB6, 0xFA, 0xE2, 0xED, 0xAA, 0xCA, 0xC9, 0xF5, 
-0x37, 0x21, 0xC1, 0x2A, 0x20, 0x21, 0xA2, 0xF2, 0x81, 0x2F, 0x8B, 0xD9, 0xE4, 0x7A, 0xC6, 0x6C, 
-0x57, 0x21, 0x10, 0x15, 0x16, 0x49, 0x0C, 0x12, 0x06, 0x4F, 0xA7, 0x08, 0x72, 0x83, 0x05, 0xBC, 
-0xC2, 0xE3, 0x0A, 0x62, 0x66, 0x58, 0xDE, 0xBC, 0x72, 0xF2, 0x91, 0x62, 0x39, 0xEA, 0x35, 0xB8, 
-0x2E, 0xA4, 0x76, 0x7A, 0x7E, 0xB6, 0x73, 0xB4, 0x2B, 0x9A, 0x69, 0x40, 0x48, 0x2B, 0x1E, 0xCC, 
-0xA7, 0xA0, 0x8C, 0xCE, 0x6C, 0x32, 0x00, 0x95, 0x26, 0xDC, 0x4A, 0xC0, 0x03, 0x7F, 0xC8, 0x9E, 
-0xC1, 0xCD, 0x36, 0x04, 0xF0, 0x15, 0x32, 0xE1, 0x0E, 0xE8, 0x74, 0x05, 0xF3, 0xF2, 0xC7, 0x95, 
-0x6E, 0xF3, 0xB0, 0xA7, 0x43, 0x2D, 0x47, 0x08, 0x46, 0x9E, 0x11, 0x72, 0xE6, 0x8C, 0x3A, 0x96, 
-0x4B, 0x00, 0x77, 0x9F, 0x39, 0x10, 0x1D, 0x10, 0xE6, 0x07, 0x5F, 0x7E, 0x25, 0xCC, 0x21, 0x94, 
-0x7B, 0x4C, 0xC3, 0x5C, 0xDD, 0xE5, 0xCD, 0x58, 0x76, 0xC7, 0x62, 0xAC, 0x5E, 0x7D, 0xF9, 0xEF, 
-0x09, 0xB3, 0x36, 0xE7, 0x1A, 0x82, 0x8C, 0xB8, 0x06, 0x7E, 0xC0, 0x53, 0x70, 0x6D, 0x34, 0xA3, 
-0x4F, 0xCA, 0x35, 0x8F, 0xDE, 0x45, 0x58, 0x9D, 0x79, 0x33, 0x40, 0xEA, 0x8A, 0x59, 0xDC, 0x72, 
-0x37, 0x60, 0x1A, 0x42, 0x8C, 0x98, 0xA6, 0xE4, 0x18, 0xC1, 0xA7, 0x56, 0x5C, 0xC7, 0x9E, 0xAF, 
-0xC6, 0xBA, 0x4B, 0x66, 0x06, 0x60, 0xB4, 0x08, 0xAC, 0xDE, 0x33, 0x6A, 0x8B, 0x09, 0x29, 0xB9, 
-0xF7, 0xA4, 0xFC, 0x0A, 0xC6, 0x1E, 0xF3, 0xB1, 0xE2, 0xAC, 0x72, 0xF2, 0x61, 0x02, 0xD6, 0x41, 
-0x3C, 0x02, 0xFA, 0x9E, 0xB3, 0x11, 0x68, 0xDB, 0x37, 0x9B, 0xE8, 0xDA, 0x02, 0x70, 0xC4, 0xBC, 
-0x6E, 0x96, 0x7B, 0xA0, 0x82, 0x2B, 0xAA, 0xDB, 0x29, 0x78, 0x3A, 0x10, 0x05, 0x11, 0x4F, 0x20, 
-0x18, 0xAA, 0xDD, 0x78, 0x06, 0x93, 0x03, 0xDC, 0x93, 0x23, 0x32, 0x13, 0x14, 0x94, 0xE7, 0x5F, 
-0x76, 0x75, 0x10, 0xD7, 0xD0, 0xB0, 0xDF, 0xE0, 0xC6, 0xFC, 0xEF, 0xC3, 0xB0, 0x63, 0x8E, 0xA0, 
-0x72, 0x72, 0xB3, 0x92, 0x61, 0x07, 0xF4, 0xFF, 0x7D, 0xC6, 0x1E, 0xDD, 0xB2, 0x23, 0x6A, 0x06, 
-0x9B, 0x4C, 0x03, 0xB0, 0xED, 0xE7, 0x1C, 0x2B, 0xD4, 0x4C, 0x4E, 0xC9, 0x47, 0x6A, 0x7E, 0xF9, 
-0x0D, 0xB4, 0xC7, 0x9C, 0xAC, 0xA9, 0x3E, 0x09, 0xB0, 0xB1, 0xB1, 0xEA, 0x35, 0x9A, 0xE8, 0x84, 
-0xB0, 0x29, 0x68, 0x4F, 0xA3, 0x95, 0x9B, 0x85, 0xAB, 0xEA, 0xD1, 0x02, 0x5B, 0x8A, 0xB4, 0xA0, 
-0x16, 0x21, 0xDF, 0x02, 0xC1, 0x37, 0x52, 0x6B, 0xA2, 0xE6, 0x3F, 0xCD, 0x24, 0x14, 0xC4, 0x0E, 
-0x67, 0xB6, 0x9D, 0x44, 0xEA, 0xD2, 0x66, 0xCE, 0xC6, 0x1C, 0x14, 0x40, 0x23, 0x06, 0x1E, 0x34, 
-0x7A, 0x8F, 0xC3, 0xBF, 0xC8, 0xF4, 0x0B, 0x83, 0x6F, 0x4B, 0xBC, 0x45, 0x88, 0xF9, 0xA4, 0x0C, 
-0x14, 0x56, 0x7F, 0x81, 0x94, 0xB0, 0xF9, 0x74, 0x53, 0x06, 0xA6, 0x0C, 0xFF, 0x32, 0xFD, 0xFB, 
-0x5B, 0x5D, 0x04, 0x04, 0xA5, 0x66, 0x58, 0x78, 0x5A, 0x39, 0x79, 0xC3, 0x6F, 0xE1, 0xCE, 0x99, 
-0xF7, 0xE5, 0x37, 0xB8, 0xB0, 0xC1, 0x12, 0x90, 0x06, 0x1B, 0x7B, 0x6A, 0x9B, 0xAF, 0x00, 0x12, 
-0xC1, 0xC9, 0x97, 0xDF, 0x1C, 0x3E, 0x71, 0xC9, 0x94, 0x02, 0xEF, 0xC4, 0x62, 0xB0, 0x05, 0xA3, 
-0x7F, 0x29, 0x32, 0xA5, 0xBF, 0x0F, 0xAB, 0x2F, 0xB2, 0xB6, 0xA0, 0x1E, 0x2B, 0x98, 0x7D, 0x72, 
-0x39, 0x33, 0x99, 0xFF, 0xE8, 0x46, 0x5F, 0x60, 0x66, 0x80, 0xF4, 0x22, 0x37, 0xEB, 0xEA, 0xCB, 
-0xAF, 0xF7, 0x28, 0x8B, 0x9A, 0x89, 0xFE, 0xD6, 0x9A, 0xFA, 0xB2, 0x80, 0xBA, 0xF0, 0x16, 0xD0, 
-0xB5, 0xDA, 0xD4, 0x3F, 0xBD, 0x9C, 0xFD, 0x42, 0x70, 0x77, 0xDF, 0xF1, 0x9F, 0xCC, 0x0D, 0x0D, 
-0x49, 0xE1, 0xCE, 0x82, 0x41, 0x52, 0x59, 0xB7, 0xC1, 0x20, 0x80, 0x5A, 0xE8, 0x8B, 0xAE, 0xC6, 
-0x9D, 0xB7, 0x3E, 0x44, 0xF9, 0x60, 0x29, 0xAD, 0xA7, 0xE5, 0xCD, 0x56, 0x7D, 0xF4, 0x05, 0xC8, 
-0xD8, 0x59, 0x68, 0xAB, 0x23, 0x9B, 0xAD, 0x98, 0xE8, 0xA7, 0xE5, 0x94, 0xED, 0xDE, 0xC5, 0x7E, 
-0xF9, 0x0B, 0xFA, 0xF3, 0x06, 0x06, 0x79, 0x01, 0x6F, 0x8B, 0xEE, 0xF8, 0x85, 0x63, 0x8A, 0x07, 
-0x12, 0x88, 0x8D, 0xA6, 0x87, 0xF8, 0x1C, 0xBE, 0xFC, 0x42, 0xBE, 0xB5, 0x83, 0xE7, 0x2B, 0xBB, 
-0xE2, 0xDB, 0xE0, 0xD6, 0x18, 0xFE, 0x8E, 0xD9, 0x75, 0x6A, 0x07, 0x1B, 0xB3, 0x4B, 0x00, 0x8C, 
-0xF8, 0xB5, 0xBF, 0x85, 0xF0, 0x65, 0x4A, 0x47, 0x34, 0xCB, 0xAD, 0xD1, 0x1A, 0xDC, 0xD2, 0x07, 
-0x2E, 0xB2, 0x10, 0xE7, 0x5B, 0xF2, 0xCE, 0xB5, 0x6D, 0xFC, 0x16, 0x6F, 0x8E, 0xFD, 0xB5, 0xC3, 
-0x18, 0x81, 0x58, 0xE5, 0xE4, 0x7F, 0xFF, 0xE3, 0xBF, 0x8A, 0x96, 0xB4, 0xF4, 0xA9, 0x44, 0xB0, 
-0xA8, 0xDD, 0x70, 0x88, 0x04, 0x1E, 0x7F, 0x93, 0xCA, 0xA2, 0x01, 0x35, 0xC0, 0xF3, 0xB2, 0x0C, 
-0x91, 0x0B, 0xBE, 0x45, 0x5F, 0xE8, 0x75, 0xF8, 0x0D, 0x63, 0x03, 0x72, 0xE1, 0xDC, 0x62, 0x54, 
-0x03, 0xDF, 0xCE, 0x69, 0xE0, 0xFA, 0xA4, 0x06, 0xE4, 0xAC, 0xA9, 0x5B, 0x8A, 0xB1, 0x16, 0x9B, 
-0x32, 0xA1, 0x8E, 0xB5, 0x22, 0x1D, 0x6B, 0xC7, 0x7E, 0x67, 0x6B, 0x45, 0x65, 0x3B, 0xA3, 0x16, 
-0xBA, 0xE7, 0x5F, 0x7E, 0x75, 0x10, 0x5F, 0x80, 0x3A, 0xC3, 0x7F, 0x7D, 0x46, 0x18, 0x92, 0x42, 
-0x1D, 0x62, 0xC3, 0x4F, 0x4B, 0x10, 0x43, 0xD1, 0xEB, 0xF4, 0x6E, 0xC1, 0x06, 0x3F, 0xDD, 0xE6, 
-0x03, 0x8C, 0xC7, 0x3C, 0x63, 0x2A, 0xD5, 0x54, 0xC7, 0xF5, 0x48, 0x8B, 0xC5, 0x6E, 0x65, 0x88, 
-0x21, 0xA9, 0xF9, 0x6C, 0xB4, 0xEE, 0xCE, 0x84, 0x66, 0xD4, 0xD8, 0x41, 0xCD, 0xB0, 0x7F, 0x6F, 
-0x4B, 0xDC, 0x07, 0x8C, 0x67, 0x10, 0x26, 0xF9, 0xB8, 0x45, 0x66, 0xDA, 0x98, 0xA3, 0x13, 0xCF, 
-0xB5, 0xFB, 0x33, 0x3B, 0xA0, 0x52, 0x06, 0x4F, 0xC6, 0xF7, 0x80, 0x06, 0x33, 0xBF, 0x3C, 0xDF, 
-0xC9, 0x05, 0xF4, 0xC0, 0xAD, 0xC7, 0x0D, 0x98, 0xAE, 0x19, 0x32, 0x62, 0x7A, 0x27, 0x52, 0xFA, 
-0x5E, 0xC8, 0xF5, 0x4E, 0x33, 0x66, 0xFB, 0xAA, 0x1E, 0x8D, 0x86, 0xED, 0xA0, 0xF5, 0xB7, 0x58, 
-0x6A, 0x05, 0xD1, 0x08, 0x8A, 0x80, 0x49, 0x9A, 0x44, 0xB4, 0x85, 0x07, 0x8F, 0x4C, 0x9E, 0xCC, 
-0x39, 0xC4, 0xD3, 0xDD, 0x10, 0x57, 0x3F, 0x70, 0x71, 0x47, 0xFC, 0x95, 0xF8, 0xC2, 0xE5, 0xAE, 
-0xDB, 0x77, 0xDE, 0x97, 0x5F, 0x01, 0x43, 0x34, 0x2E, 0x63, 0xD7, 0xA3, 0xFE, 0x9A, 0xEC, 0x4E, 
-0x0F, 0x11, 0xAF, 0xF6, 0x19, 0xCD, 0xC6, 0xB4, 0xCF, 0x7A, 0x9A, 0x7D, 0x3E, 0x4B, 0x6E, 0x35, 
-0x8D, 0x63, 0x0A, 0x26, 0xAE, 0x1F, 0x78, 0xC8, 0x56, 0x26, 0x4D, 0xCB, 0x28, 0x22, 0xA7, 0x98, 
-0xB7, 0xAA, 0x75, 0x4D, 0xD7, 0x44, 0x2C, 0x71, 0xA7, 0x22, 0xDB, 0x19, 0x3F, 0xE0, 0xAA, 0x4B, 
-0xDD, 0xA4, 0x93, 0xA2, 0xC5, 0xA9, 0xB5, 0x44, 0xED, 0xD2, 0xA2, 0x1A, 0x26, 0x91, 0x67, 0xC3, 
-0x23, 0xB3, 0xE4, 0xD2, 0x54, 0xDB, 0xD1, 0xE5, 0xD5, 0xA2, 0xD4, 0x18, 0xA8, 0xAE, 0x2C, 0x19, 
-0x93, 0xDF, 0x1F, 0x37, 0xDD, 0xE6, 0xDA, 0x73, 0x71, 0x0E, 0x8A, 0x28, 0x61, 0xF2, 0x71, 0x44, 
-0xB2, 0x47, 0x0E, 0x49, 0x6B, 0x9F, 0x74, 0x49, 0x0B, 0xBA, 0x1D, 0xED, 0x46, 0x4D, 0x4A, 0x25, 
-0xDE, 0xF0, 0x73, 0x8A, 0xB4, 0x53, 0x2F, 0x23, 0x16, 0x65, 0x42, 0xAE, 0x90, 0x89, 0x51, 0x8E, 
-0x36, 0xC1, 0xC6, 0xE8, 0x12, 0xAC, 0xA0, 0xF4, 0x77, 0xC6, 0xC8, 0x28, 0x6F, 0xD9, 0x6E, 0x91, 
-0x56, 0xEF, 0xB6, 0x4B, 0xDB, 0xA4, 0x2D, 0x4A, 0x1B, 0x5B, 0x06, 0x7C, 0x7B, 0xD5, 0x4B, 0xFE, 
-0x36, 0xDA, 0xB7, 0x46, 0x57, 0xB0, 0x16, 0x3A, 0x95, 0x15, 0x0C, 0xD6, 0x5D, 0x10, 0x4C, 0x86, 
-0xF6, 0x50, 0x38, 0xB0, 0xCC, 0x17, 0x8A, 0x46, 0xC0, 0x10, 0xFD, 0xEF, 0x5B, 0xE8, 0x03, 0x54, 
-0xC8, 0x1C, 0xFF, 0x05, 0xFB, 0x78, 0xDF, 0x0E, 0x7F, 0xC3, 0xBF, 0x1D, 0x04, 0xB2, 0x92, 0x6C, 
-0xCF, 0x99, 0x0F, 0x9E, 0x1D, 0xBA, 0xA0, 0xC2, 0x89, 0x59, 0x22, 0xE3, 0xC4, 0x64, 0x4C, 0x4E, 
-0x44, 0xD5, 0x59, 0x90, 0xEF, 0xE8, 0x88, 0x25, 0x4A, 0xE6, 0xE2, 0x13, 0x9B, 0xE2, 0x36, 0xD1, 
-0x05, 0xE2, 0xD0, 0x5B, 0x3E, 0xA2, 0x01, 0xFB, 0x9E, 0x07, 0xE3, 0x9B, 0xB8, 0x43, 0x6D, 0xE6, 
-0xD9, 0xD9, 0xE7, 0xB3, 0x0A, 0x0F, 0x25, 0x02, 0x47, 0x9A, 0x19, 0xEC, 0x1E, 0x3A, 0xE3, 0xE9, 
-0x60, 0xE9, 0xFC, 0xBE, 0xCF, 0x02, 0x70, 0x83, 0x99, 0x3B, 0x0B, 0xF4, 0x87, 0x4B, 0xE2, 0xE7, 
-0x8E, 0xC3, 0xDA, 0x70, 0xD7, 0xC0, 0xE3, 0x23, 0xB1, 0x4D, 0x03, 0x9F, 0x0B, 0x26, 0xC7, 0x04, 
-0x50, 0x49, 0xC3, 0x7B, 0xA8, 0x13, 0x88, 0x28, 0x8B, 0x0B, 0xAD, 0x62, 0xFA, 0xA2, 0x94, 0x7C, 
-0x66, 0x3C, 0xE0, 0xD1, 0xD9, 0x98, 0x99, 0x9F, 0xF0, 0x4C, 0x26, 0x6F, 0xE6, 0x38, 0xB8, 0xB8, 
-0xBA, 0x8E, 0x3C, 0xBA, 0x12, 0xEC, 0xE8, 0x2D, 0x91, 0x9E, 0x09, 0xA9, 0x89, 0x2B, 0x63, 0x30, 
-0xA5, 0xBB, 0xAD, 0xF6, 0x7E, 0xA3, 0xD9, 0xC0, 0xE7, 0x80, 0x08, 0x38, 0x3D, 0x17, 0xD7, 0xEF, 
-0x3A, 0xED, 0x14, 0x48, 0x9B, 0x81, 0xF5, 0xC7, 0xC7, 0xE8, 0x82, 0x0F, 0x59, 0x8C, 0xF1, 0xE0, 
-0xA7, 0x1C, 0x75, 0x00, 0x13, 0x0F, 0x10, 0x8D, 0x0E, 0x56, 0x0B, 0x87, 0xA9, 0x92, 0x3F, 0xFF, 
-0x39, 0xCF, 0x89, 0x54, 0xDB, 0x18, 0x11, 0xE5, 0x31, 0x6C, 0x40, 0xD9, 0x65, 0x44, 0x05, 0xB3, 
-0xDD, 0x29, 0x8A, 0x2C, 0xA2, 0xC6, 0x20, 0x00, 0x98, 0xDD, 0x37, 0xC4, 0xD9, 0x4C, 0xDC, 0xC7, 
-0xA3, 0xE2, 0xD0, 0xF9, 0xDD, 0x85, 0xB5, 0x10, 0x8F, 0x38, 0xC8, 0xC1, 0x8A, 0xC9, 0x01, 0x31, 
-0x54, 0x17, 0x5D, 0xAB, 0x19, 0x79, 0xC8, 0xD3, 0xC5, 0x54, 0x44, 0x4E, 0x3D, 0x37, 0x70, 0x4D, 
-0xD7, 0x96, 0x88, 0x83, 0x79, 0x60, 0x7D, 0x1D, 0xD2, 0x2F, 0xE1, 0x26, 0x89, 0xDB, 0x1B, 0xC4, 
-0x47, 0x7A, 0xB7, 0x81, 0x97, 0x72, 0x34, 0x21, 0xBE, 0x05, 0x5B, 0x46, 0x2E, 0x1E, 0x6E, 0x25, 
-0x20, 0xAD, 0x3B, 0x58, 0xEA, 0x57, 0x56, 0xD7, 0xDE, 0x84, 0xB3, 0x0C, 0x24, 0x0B, 0x86, 0x6D, 
-0x31, 0x31, 0x53, 0xED, 0x34, 0x53, 0x31, 0x1E, 0x5F, 0x5D, 0x82, 0x19, 0x6B, 0x7A, 0x72, 0x51, 
-0xCC, 0x3D, 0xAE, 0x8F, 0x47, 0xAC, 0x86, 0xA7, 0x18, 0x1C, 0x2B, 0x38, 0x82, 0x19, 0xC2, 0xBE, 
-0xEE, 0x30, 0x32, 0x6F, 0xDE, 0xC7, 0x8D, 0x5D, 0x9F, 0x81, 0x4B, 0xBA, 0x38, 0xBF, 0x0C, 0x70, 
-0x0A, 0xCF, 0x7D, 0x7C, 0x31, 0x7F, 0x0D, 0x16, 0x20, 0x2A, 0x03, 0xA8, 0xEE, 0x34, 0x84, 0x8B, 
-0xB3, 0x53, 0x57, 0x42, 0xBB, 0x63, 0x41, 0x69, 0x68, 0xD0, 0x76, 0x09, 0xB4, 0x38, 0xA9, 0x59, 
-0x1A, 0x66, 0xDC, 0x23, 0x86, 0x9C, 0x03, 0xFC, 0x90, 0x1F, 0x0B, 0xB7, 0xCF, 0x75, 0xFC, 0x11, 
-0x99, 0xB1, 0x70, 0xFC, 0x97, 0xB0, 0x9C, 0x16, 0x60, 0xB0, 0xC8, 0xA4, 0x2D, 0xA1, 0x0B, 0x73, 
-0x45, 0x2B, 0x80, 0xC4, 0xE6, 0x4B, 0x20, 0x46, 0x7B, 0xFF, 0x65, 0x18, 0x95, 0x4A, 0x16, 0xAC, 
-0xC4, 0x27, 0x5B, 0x96, 0x76, 0xAB, 0x19, 0x65, 0x63, 0x11, 0xE3, 0xF2, 0xD1, 0xE3, 0x9D, 0xB1, 
-0x25, 0x14, 0xE1, 0x66, 0x50, 0x79, 0x78, 0xD8, 0x7A, 0x35, 0x91, 0x8B, 0x0D, 0x12, 0xED, 0xA4, 
-0x00, 0xB3, 0x79, 0xCD, 0x1C, 0x2B, 0x8A, 0xD2, 0xCA, 0x20, 0x92, 0xDF, 0x67, 0x58, 0x42, 0xA1, 
-0x34, 0x4F, 0x61, 0xEC, 0xB7, 0xCA, 0x48, 0x9A, 0xB0, 0x7A, 0xD9, 0x70, 0x22, 0x2E, 0x5C, 0x67, 
-0x38, 0x75, 0x40, 0xB9, 0x4C, 0x23, 0x31, 0x2E, 0x92, 0x01, 0x57, 0x29, 0x03, 0x93, 0x8A, 0xA3, 
-0x0A, 0x44, 0x99, 0x36, 0xCB, 0xCF, 0xBF, 0xCA, 0x59, 0x42, 0x3C, 0xF6, 0xD1, 0x76, 0x47, 0xB5, 
-0x6A, 0x66, 0x77, 0x6B, 0x34, 0xA3, 0x9E, 0x05, 0xF1, 0x2A, 0x9E, 0xFB, 0x28, 0x6D, 0x65, 0xC6, 
-0x91, 0xC9, 0x5A, 0xF5, 0x9B, 0xB7, 0xE7, 0x6F, 0xFB, 0x04, 0xD5, 0x00, 0x57, 0x0F, 0xAC, 0x07, 
-0x84, 0xAF, 0xA9, 0x46, 0xD4, 0x66, 0x5E, 0xA0, 0x1D, 0x08, 0x0F, 0x91, 0x05, 0xB7, 0x8F, 0x22, 
-0x8D, 0xEC, 0xD9, 0x8F, 0xCE, 0x8F, 0xCE, 0x1B, 0x37, 0xA0, 0x7D, 0x11, 0xE2, 0x0B, 0xBB, 0x2E, 
-0x5A, 0x33, 0xE7, 0x96, 0x53, 0x0F, 0xB3, 0xB9, 0xC9, 0xFD, 0x21, 0xB9, 0x80, 0x61, 0x68, 0x47, 
-0x31, 0x94, 0xF6, 0x45, 0xD3, 0x21, 0x77, 0xA8, 0xDD, 0xA8, 0x2E, 0x59, 0x28, 0xD2, 0x6E, 0x7F, 
-0xDE, 0x31, 0x92, 0x64, 0xBD, 0x64, 0x81, 0x39, 0x16, 0x7A, 0x4E, 0x86, 0x9E, 0x3B, 0x89, 0xC8, 
-0x93, 0x87, 0xE3, 0x79, 0x0C, 0x17, 0xB3, 0xB3, 0xEB, 0x8F, 0xAA, 0x65, 0xC6, 0xBF, 0x0D, 0x0F, 
-0x0C, 0x85, 0xA5, 0x46, 0x6C, 0xAE, 0xF5, 0xB1, 0x44, 0x7E, 0x17, 0xAE, 0x3F, 0x8F, 0x0E, 0x53, 
-0x9F, 0x05, 0x43, 0xE3, 0xA0, 0x5E, 0xC9, 0x9F, 0xEE, 0xFB, 0x47, 0x52, 0x41, 0x5F, 0x11, 0x18, 
-0x30, 0x99, 0xD6, 0x6F, 0xC0, 0x54, 0x32, 0x8F, 0xE2, 0x6E, 0x7F, 0xFD, 0x95, 0x2C, 0x2A, 0xA9, 
-0x8B, 0x1A, 0xB9, 0xBA, 0x2C, 0xA8, 0xA8, 0x5F, 0xCE, 0x7E, 0xF9, 0xD1, 0xA9, 0xA8, 0x80, 0xB4, 
-0x9B, 0xED, 0xAE, 0xD1, 0x6C, 0xC1, 0x7F, 0xE0, 0xDC, 0xF7, 0x9B, 0xCD, 0x7A, 0xBB, 0xD7, 0xE8, 
-0xD5, 0xF7, 0x9A, 0xF5, 0x6E, 0xAF, 0x7E, 0xD0, 0xAC, 0xEF, 0xF7, 0x4A, 0xF5, 0x6B, 0x89, 0x7E, 
-0xFB, 0xF5, 0xBD, 0x56, 0xBD, 0xDB, 0xAD, 0xEF, 0x1F, 0xD6, 0xF7, 0xF7, 0xA0, 0x5F, 0x81, 0x52, 
-0x48, 0x0E, 0x30, 0xC7, 0x74, 0x2D, 0x66, 0x7D, 0xF0, 0x38, 0x70, 0x40, 0xFE, 0xF8, 0xF0, 0xFE, 
-0x75, 0x6D, 0xC1, 0x98, 0xDC, 0xE3, 0x0C, 0xD8, 0x4B, 0x1C, 0x8E, 0x73, 0xBC, 0x70, 0xB3, 0x25, 
-0x93, 0xC3, 0x29, 0x50, 0xAB, 0xD0, 0x4A, 0xA6, 0x17, 0xB6, 0x4F, 0x1F, 0xB9, 0x5C, 0x41, 0x8F, 
-0xB9, 0x52, 0x4F, 0x8C, 0xBF, 0xBC, 0x4B, 0x1C, 0x16, 0xD6, 0x85, 0xAC, 0x5C, 0xFF, 0x4F, 0xDC, 
-0x01, 0x7D, 0x72, 0xB0, 0xFE, 0xD5, 0x6D, 0x00, 0xCA, 0xD9, 0x61, 0xD3, 0x61, 0x00, 0x9D, 0x4E, 
-0x41, 0x29, 0xCE, 0xC6, 0xDC, 0xB6, 0x6A, 0x08, 0x5D, 0x35, 0xA0, 0x88, 0x36, 0xB3, 0xE7, 0xF1, 
-0xA6, 0xC1, 0x78, 0x6C, 0xE2, 0x82, 0xF7, 0xA2, 0x03, 0xA3, 0x9F, 0xC2, 0x72, 0xF3, 0xD7, 0x0A, 
-0xE3, 0x28, 0xCB, 0xF5, 0x35, 0xCA, 0x8F, 0x0E, 0xA6, 0x50, 0xE8, 0x30, 0x1C, 0x8D, 0x0A, 0xE3, 
-0x84, 0x7E, 0xE3, 0xB9, 0xA6, 0xEE, 0x74, 0x86, 0x0F, 0xCA, 0x10, 0x8F, 0xDE, 0xC1, 0x34, 0x62, 
-0xB6, 0xE5, 0xE7, 0x27, 0xCE, 0x10, 0x21, 0x9C, 0x49, 0x00, 0xBA, 0xC9, 0xA3, 0x8A, 0x2A, 0xE4, 
-0x5C, 0xC5, 0x53, 0x36, 0x84, 0x63, 0xEE, 0xF3, 0x09, 0x8E, 0x95, 0x75, 0xFF, 0x1E, 0x2B, 0x48, 
-0x50, 0xB5, 0x2D, 0xEB, 0x97, 0x27, 0x79, 0x5D, 0x91, 0x61, 0xC5, 0x04, 0x54, 0x0B, 0x8C, 0x5E, 
-0x48, 0x03, 0x10, 0x88, 0x1C, 0x43, 0x36, 0x66, 0x15, 0x25, 0x25, 0x65, 0xA5, 0x2F, 0x06, 0x3D, 
-0x23, 0x3B, 0x0E, 0x8A, 0xDF, 0x6E, 0x76, 0x0F, 0x56, 0x80, 0x10, 0x95, 0x84, 0x24, 0x20, 0xB4, 
-0xDA, 0x8D, 0xDE, 0x0A, 0x10, 0xE2, 0x4C, 0x65, 0x02, 0x44, 0x27, 0xF7, 0xF0, 0x29, 0x7E, 0x3C, 
-0x06, 0x36, 0xC8, 0xC9, 0x3A, 0xFC, 0xA9, 0x9F, 0x42, 0x37, 0x6A, 0xD5, 0x5D, 0xE4, 0x44, 0x35, 
-0xBF, 0x2A, 0xE1, 0x09, 0xA6, 0x4E, 0x0D, 0x5C, 0xCF, 0x29, 0x70, 0x14, 0x06, 0x3A, 0x21, 0xD1, 
-0xF7, 0xC6, 0xCF, 0x3E, 0xC6, 0xC3, 0xBA, 0x2E, 0x42, 0x41, 0xA1, 0xB9, 0xDA, 0x0D, 0xC1, 0x50, 
-0x3F, 0xD2, 0xDC, 0xF7, 0x20, 0x87, 0x8F, 0x48, 0x46, 0xBE, 0xE6, 0x00, 0x3F, 0xE2, 0xF0, 0x61, 
-0x00, 0xD6, 0x40, 0xD6, 0x63, 0xDB, 0x67, 0x20, 0xFA, 0x19, 0x84, 0x33, 0xB0, 0x68, 0xE0, 0x99, 
-0xAC, 0xAB, 0x88, 0x2A, 0x09, 0x27, 0xCF, 0xAD, 0xD4, 0x68, 0x28, 0xA6, 0xB0, 0x10, 0x88, 0x95, 
-0x1E, 0x52, 0x21, 0xDB, 0x1C, 0xB0, 0x46, 0xE0, 0xBE, 0xE4, 0xF7, 0xCC, 0xAA, 0x65, 0xCF, 0xE5, 
-0xC8, 0xA1, 0x20, 0xE4, 0xBC, 0x0A, 0xC5, 0x2A, 0xC5, 0x48, 0x41, 0x52, 0x0F, 0xB8, 0x54, 0x42, 
-0xE9, 0xDC, 0x9F, 0x94, 0x15, 0xA2, 0x49, 0x6F, 0x29, 0xB7, 0xE9, 0xC0, 0xCE, 0x57, 0x08, 0xA6, 
-0xE8, 0x08, 0x7D, 0x92, 0x32, 0xC7, 0x78, 0x2F, 0x0B, 0xCE, 0x22, 0x82, 0x24, 0x48, 0x21, 0xCA, 
-0x73, 0x6F, 0xAE, 0x26, 0x6B, 0x39, 0xE0, 0x44, 0x9C, 0xA6, 0x00, 0xFC, 0x3D, 0x0B, 0xD6, 0x05, 
-0x9C, 0x0B, 0xD6, 0x14, 0xE0, 0x6F, 0xA2, 0x36, 0xFA, 0x41, 0x56, 0x1F, 0x3D, 0x1F, 0xA8, 0x65, 
-0x46, 0xC6, 0x06, 0x17, 0x78, 0x7F, 0x0D, 0xD2, 0x72, 0x21, 0x9B, 0x02, 0xF6, 0x4B, 0xB8, 0xBD, 
-0x2E, 0xE8, 0x6C, 0xE4, 0xA6, 0x00, 0x1F, 0x9D, 0x6C, 0xB8, 0x4D, 0x9E, 0xC5, 0x15, 0x31, 0x9A, 
-0x71, 0xC5, 0xFD, 0x2B, 0xEE, 0xAC, 0x41, 0x56, 0x5C, 0x8D, 0x54, 0x08, 0x9A, 0xDE, 0xAF, 0x0D, 
-0x3A, 0x11, 0x6D, 0xAA, 0x40, 0x5F, 0xBA, 0x9A, 0x29, 0x5F, 0x02, 0x74, 0x32, 0xF0, 0x54, 0xC1, 
-0x7E, 0x05, 0x7F, 0x6D, 0x53, 0x0C, 0xFA, 0x28, 0x33, 0x33, 0x7A, 0x36, 0x84, 0x5D, 0x67, 0x92, 
-0x16, 0xC7, 0x99, 0xD9, 0xD9, 0xAA, 0x0A, 0x67, 0xD7, 0x19, 0xB5, 0x38, 0xDC, 0xCC, 0x8E, 0xAA, 
-0x8A, 0x6A, 0xD5, 0xA3, 0x2A, 0x5E, 0x28, 0xA0, 0x58, 0x96, 0xC3, 0x97, 0x0A, 0x88, 0x17, 0x06, 
-0xC0, 0xC2, 0xAC, 0x7C, 0x91, 0x80, 0xF0, 0x06, 0x44, 0xC2, 0x16, 0xC3, 0x1F, 0x7C, 0x8F, 0x00, 
-0x5E, 0xDE, 0xD9, 0x24, 0x30, 0x4B, 0xBB, 0xBD, 0xA1, 0xC3, 0x2B, 0x0A, 0xA5, 0x85, 0x0B, 0x8C, 
-0x71, 0xF1, 0x97, 0xBF, 0x78, 0x98, 0xDF, 0x6B, 0x34, 0x1A, 0xD9, 0x2D, 0xF8, 0xAC, 0x97, 0x9A, 
-0x0D, 0xEE, 0xA4, 0x68, 0x7E, 0x07, 0x0E, 0x0D, 0x2E, 0x76, 0xCF, 0x84, 0xF8, 0xC2, 0x40, 0x1F, 
-0xBD, 0xD7, 0xE4, 0xEF, 0x86, 0xCD, 0x9C, 0x51, 0x30, 0x16, 0x8E, 0x6B, 0xB3, 0xF0, 0xB5, 0x2F, 
-0x32, 0xF4, 0x7E, 0xE3, 0x92, 0x31, 0x9D, 0xE7, 0x99, 0x24, 0x4E, 0x0A, 0x70, 0x1D, 0x0E, 0xAB, 
-0xAE, 0x5F, 0xF4, 0xF2, 0x09, 0x95, 0xEB, 0x17, 0x7D, 0xD4, 0xEF, 0x11, 0xD1, 0xB9, 0x01, 0xDF, 
-0xE1, 0xFB, 0x34, 0xC2, 0xB0, 0x59, 0xEE, 0x03, 0xF3, 0x09, 0xF8, 0xE1, 0xB7, 0xCC, 0xC2, 0x54, 
-0xF4, 0x84, 0x06, 0x98, 0xD3, 0xC7, 0x02, 0xDA, 0x00, 0x0F, 0x94, 0x98, 0x8B, 0x5A, 0xDA, 0x09, 
-0x03, 0x7D, 0xCD, 0x73, 0x12, 0x3F, 0x98, 0x6E, 0x80, 0xF0, 0x0C, 0x37, 0xA5, 0xAB, 0xAB, 0xF9, 
-0x23, 0x8B, 0xB0, 0x9A, 0x81, 0xE0, 0xCD, 0x5C, 0x20, 0x12, 0x7D, 0x10, 0xFA, 0x1F, 0x01, 0xFC, 
-0xCD, 0xC5, 0xD5, 0xBB, 0x8B, 0xF7, 0xA7, 0x37, 0x1F, 0xDE, 0x9F, 0xFE, 0xE8, 0x68, 0xC6, 0x8A, 
-0xDA, 0xBE, 0x72, 0x3D, 0x8A, 0xB9, 0x73, 0xAC, 0x20, 0x14, 0xDB, 0x17, 0xC9, 0x20, 0x9E, 0xD4, 
-0xFE, 0xE7, 0x3F, 0xCF, 0x76, 0xB4, 0x30, 0x52, 0x62, 0x06, 0x96, 0x5C, 0x50, 0x50, 0x40, 0x8F, 
-0x99, 0xAE, 0x67, 0xE9, 0x15, 0x46, 0x0C, 0x2E, 0xE2, 0xE7, 0x20, 0xDA, 0x37, 0xC0, 0x17, 0x88, 
-0x09, 0x86, 0xC6, 0x3B, 0x09, 0x21, 0x94, 0x46, 0xDC, 0xA4, 0x1E, 0xFA, 0x73, 0xD4, 0x0F, 0xAE, 
-0x18, 0xF5, 0x81, 0x13, 0x68, 0x5E, 0xB0, 0x7D, 0x81, 0x2A, 0x84, 0xC3, 0x30, 0x31, 0x42, 0x04, 
-0x11, 0x7F, 0xA5, 0xFC, 0x4A, 0xF2, 0xED, 0xB7, 0xB9, 0x9B, 0xC6, 0xE1, 0xE1, 0x21, 0xF9, 0xC7, 
-0xE4, 0xE5, 0x84, 0xF7, 0x4A, 0xFA, 0xA4, 0x7A, 0xF1, 0xFE, 0xFD, 0xDB, 0xF7, 0x1A, 0xB6, 0x24, 
-0xD8, 0xFB, 0xD3, 0xD7, 0x9F, 0x63, 0x12, 0x1E, 0xEA, 0xF0, 0x03, 0x20, 0x3D, 0xFC, 0xE8, 0xFC, 
-0xA4, 0x51, 0x4F, 0x0D, 0x2D, 0x91, 0xAC, 0xB4, 0x82, 0xD0, 0x29, 0xCE, 0xAB, 0xD9, 0x84, 0x5B, 
-0xF8, 0x1A, 0x85, 0x32, 0x5A, 0xF3, 0xEA, 0xC3, 0xD5, 0xC5, 0xF9, 0xE9, 0x39, 0x79, 0x7F, 0x71, 
-0x79, 0x7A, 0xF3, 0xFA, 0xE3, 0x3A, 0xAA, 0x13, 0xEE, 0xF9, 0x60, 0xD5, 0xE0, 0xDF, 0xB8, 0xD2, 
-0x8C, 0x23, 0xCE, 0xC5, 0x8A, 0x13, 0x5F, 0xD1, 0x29, 0x4F, 0xAA, 0x41, 0x5A, 0x81, 0xA2, 0x5B, 
-0xB1, 0x12, 0x35, 0x37, 0x51, 0xA2, 0x08, 0xDA, 0x13, 0x2A, 0x92, 0x78, 0x4E, 0x77, 0xE2, 0x82, 
-0xD4, 0xCA, 0xDA, 0xA0, 0x48, 0x9B, 0xCE, 0x2F, 0x2E, 0xC9, 0xF5, 0x87, 0x8B, 0xCB, 0xB7, 0x1B, 
-0xA8, 0x53, 0xFC, 0xA8, 0xED, 0xDF, 0x81, 0x62, 0x89, 0x53, 0xF1, 0x62, 0xA5, 0x12, 0xBF, 0x74, 
-0x0A, 0x15, 0xDF, 0x4C, 0x2B, 0x13, 0x5E, 0xDE, 0x8E, 0x22, 0x21, 0xA4, 0x27, 0x54, 0x22, 0xF9, 
-0x78, 0x48, 0x19, 0xE5, 0xB9, 0xFC, 0x70, 0xF5, 0xFA, 0xCD, 0xDB, 0xEB, 0xD7, 0xA0, 0x40, 0x6B, 
-0xA8, 0xCD, 0x25, 0xCC, 0x0F, 0xC7, 0xF5, 0xF9, 0xDF, 0x87, 0x25, 0x92, 0xC7, 0x0F, 0xC6, 0x1A, 
-0x23, 0x7F, 0xEA, 0x54, 0x66, 0x71, 0x37, 0xAD, 0x33, 0xE2, 0xFA, 0x76, 0x94, 0x46, 0x80, 0x5A, 
-0x5D, 0x6B, 0x74, 0x4A, 0x71, 0x26, 0x33, 0x13, 0x91, 0x27, 0xAD, 0x16, 0xB5, 0x60, 0xC4, 0xC0, 
-0x76, 0x07, 0xC0, 0x07, 0x87, 0xDD, 0x91, 0x17, 0xF0, 0xB5, 0xF6, 0xAF, 0x80, 0xE0, 0xBF, 0xD5, 
-0xC9, 0x67, 0x51, 0xC1, 0x07, 0xF4, 0xA8, 0x73, 0x16, 0xCF, 0xAB, 0x7A, 0x45, 0x2E, 0xB1, 0x8B, 
-0x5F, 0xA5, 0x3A, 0x5F, 0x53, 0xF6, 0x9E, 0x89, 0x2A, 0x83, 0x0F, 0xEF, 0x2F, 0xC3, 0x7E, 0x6F, 
-0x07, 0x3F, 0x83, 0x7E, 0xC3, 0xEF, 0x1A, 0xA2, 0x5B, 0xD8, 0xD5, 0x71, 0xEF, 0x42, 0x72, 0x20, 
-0x7C, 0xD0, 0xBE, 0xFE, 0x4E, 0xB6, 0xC5, 0x0D, 0x5F, 0xB9, 0x55, 0x4C, 0x7E, 0xCA, 0x6D, 0xFA, 
-0xFF, 0xE9, 0xEB, 0xCF, 0x00, 0x0B, 0xA3, 0x2E, 0xDC, 0x84, 0xF8, 0x81, 0x51, 0xAF, 0xB6, 0xF3, 
-0x60, 0x7C, 0xFD, 0xB9, 0x16, 0x5E, 0xBD, 0x72, 0x9D, 0x60, 0x5C, 0xDB, 0xF9, 0x63, 0x6B, 0x07, 
-0x34, 0xE0, 0x3A, 0xC0, 0xB7, 0x1F, 0xD4, 0x76, 0x1A, 0x53, 0x6A, 0x5D, 0x07, 0xD4, 0xC3, 0x33, 
-0xA6, 0xAB, 0xCD, 0xAA, 0xE8, 0x10, 0xB6, 0x97, 0xE8, 0x14, 0xB5, 0x5D, 0x8C, 0xF8, 0xCA, 0x9D, 
-0x79, 0x7E, 0x71, 0xE3, 0x05, 0xE0, 0x2B, 0x2C, 0xA1, 0x66, 0x4B, 0x9A, 0x63, 0x0A, 0x43, 0xA3, 
-0x5B, 0x6A, 0xB7, 0x3A, 0x97, 0x22, 0xA9, 0x62, 0x56, 0x05, 0x42, 0xB8, 0x59, 0xAA, 0x02, 0x63, 
-0x49, 0x9F, 0x48, 0x01, 0xF1, 0x6D, 0x79, 0x21, 0xB3, 0x0B, 0x3B, 0x8B, 0x97, 0x1F, 0xDC, 0x72, 
-0x9F, 0x0F, 0xB8, 0x2D, 0xFD, 0x84, 0xEA, 0x98, 0x5B, 0x16, 0xD3, 0x1A, 0x9B, 0x55, 0xB2, 0x30, 
-0xA9, 0xA1, 0x94, 0xD9, 0x18, 0x35, 0xD8, 0x25, 0x59, 0x99, 0x42, 0x3E, 0x26, 0xC3, 0xD5, 0x9F, 
-0xCE, 0x17, 0xF9, 0x19, 0xF2, 0xF5, 0x67, 0x45, 0x38, 0xF7, 0x00, 0x96, 0x65, 0xC4, 0xB1, 0x38, 
-0xD0, 0xFF, 0x49, 0xF5, 0x46, 0xBB, 0xE5, 0x61, 0xB8, 0xDA, 0xBC, 0xAA, 0xDF, 0xF2, 0x67, 0xC7, 
-0x09, 0x23, 0x4F, 0x06, 0x86, 0x8B, 0x08, 0x5D, 0x4D, 0x61, 0x18, 0x4B, 0xC6, 0xDD, 0xDD, 0x81, 
-0x78, 0x39, 0x62, 0x22, 0x23, 0x2B, 0x1F, 0x14, 0x95, 0x05, 0xF1, 0xCA, 0x77, 0xF2, 0x95, 0x2C, 
-0x57, 0xCB, 0x5A, 0xFE, 0x84, 0xC9, 0xF7, 0xE7, 0x58, 0x19, 0xFD, 0xC6, 0xBD, 0xCB, 0x46, 0xBD, 
-0x22, 0x66, 0x8E, 0x1B, 0xEE, 0x84, 0x21, 0x2B, 0xA9, 0xBE, 0xD9, 0x3D, 0xCD, 0x68, 0x8F, 0x36, 
-0x59, 0xB5, 0x58, 0x7C, 0xB8, 0x4F, 0xD8, 0xD4, 0x35, 0xC7, 0xA4, 0x76, 0x42, 0x5A, 0xAC, 0xD5, 
-0x14, 0xC5, 0x6E, 0x13, 0x6E, 0xDB, 0x1C, 0x9F, 0x90, 0xC1, 0x4D, 0xFC, 0x81, 0xEB, 0x06, 0xB9, 
-0xF1, 0x17, 0x00, 0x4E, 0xF0, 0x44, 0xAB, 0xE8, 0xA3, 0xA9, 0xF5, 0xBA, 0x10, 0x23, 0xC4, 0x7D, 
-0x94, 0x69, 0xA7, 0x00, 0x39, 0xCB, 0x92, 0x26, 0x6D, 0x41, 0xA2, 0x2E, 0x43, 0x23, 0xBA, 0x80, 
-0x35, 0x10, 0x99, 0x2A, 0x16, 0xDA, 0x84, 0x2A, 0xF3, 0x8D, 0x8B, 0xEB, 0x2A, 0x9A, 0x76, 0xA5, 
-0x70, 0xE7, 0x60, 0xE1, 0xC0, 0xDE, 0x3B, 0xA0, 0xF8, 0x1E, 0x37, 0xA1, 0x9D, 0xB2, 0xD5, 0x04, 
-0xAD, 0x1E, 0x34, 0x6B, 0x1B, 0x16, 0x1F, 0xF1, 0x40, 0xD7, 0xCC, 0xC2, 0xB3, 0x07, 0x17, 0x8D, 
-0x94, 0x6D, 0xC6, 0x60, 0xE4, 0x96, 0x43, 0x12, 0x0F, 0x88, 0xB0, 0xA5, 0xC0, 0xE4, 0xC1, 0x73, 
-0x89, 0x66, 0x85, 0xAA, 0x27, 0x7E, 0x17, 0x94, 0xC5, 0x5D, 0x65, 0x05, 0x4D, 0x0C, 0x14, 0x06, 
-0xAC, 0x0D, 0x01, 0x66, 0x49, 0x3D, 0x86, 0x39, 0xBF, 0x5B, 0x26, 0x44, 0xA7, 0x91, 0x9A, 0x5C, 
-0x87, 0x50, 0x60, 0x0D, 0xF8, 0xAA, 0x32, 0x34, 0xE1, 0x0B, 0xBF, 0x47, 0x28, 0xDC, 0x58, 0xA9, 
-0x61, 0xA0, 0x58, 0xBE, 0xBA, 0x2E, 0xA2, 0x78, 0x17, 0xE7, 0x46, 0x52, 0x2B, 0x1C, 0xD1, 0x17, 
-0xA0, 0xE9, 0xB5, 0x22, 0xEE, 0xF7, 0xFF, 0xAA, 0x91, 0xFE, 0xE4, 0x54, 0xA3, 0x70, 0x7B, 0x72, 
-0xD3, 0x02, 0xC3, 0xF3, 0xAD, 0x15, 0x12, 0x86, 0x69, 0xA5, 0x2D, 0x15, 0x12, 0xA6, 0xB2, 0x48, 
-0x1B, 0x14, 0x12, 0xE6, 0x21, 0xE7, 0x2E, 0xC4, 0x69, 0xA3, 0x2D, 0xD6, 0x0B, 0x46, 0xE9, 0xA2, 
-0xED, 0xD5, 0x0B, 0x26, 0x33, 0x44, 0xEB, 0xD7, 0x0B, 0x96, 0x60, 0x47, 0x94, 0x12, 0x2A, 0x5F, 
-0xC6, 0x97, 0x48, 0x2F, 0x29, 0x06, 0x88, 0xF2, 0x40, 0x2B, 0xC0, 0x5B, 0xE4, 0x94, 0x74, 0xF0, 
-0x2E, 0xB7, 0x57, 0xB6, 0x18, 0x27, 0x7C, 0xD6, 0xAC, 0x5B, 0x2C, 0xC1, 0xD2, 0x47, 0x2F, 0x4C, 
-0x7C, 0xC2, 0xA2, 0xC4, 0x47, 0x2B, 0x48, 0x4C, 0x1B, 0xBD, 0xA2, 0x12, 0xC1, 0xEF, 0x44, 0xA9, 
-0x1E, 0xA6, 0x59, 0xCC, 0x54, 0x0D, 0x5F, 0xE9, 0x1A, 0xC1, 0xA2, 0xEA, 0xC0, 0x28, 0xC5, 0x22, 
-0x9F, 0xD4, 0xC1, 0x65, 0x28, 0xC7, 0x82, 0x09, 0x0B, 0xC6, 0x2E, 0xDA, 0xF0, 0x77, 0x6F, 0xAF, 
-0x6F, 0x14, 0x76, 0x5E, 0x1E, 0x54, 0xE8, 0xEB, 0xCA, 0x54, 0xAB, 0x61, 0xC1, 0x99, 0x71, 0x03, 
-0x41, 0x6D, 0x15, 0xC0, 0x88, 0x57, 0xE8, 0xCA, 0x22, 0xA0, 0x5D, 0xCC, 0xD3, 0x28, 0x40, 0x2A, 
-0x6A, 0x61, 0xC5, 0x8B, 0x7C, 0xC9, 0x3F, 0x5F, 0xBF, 0x7D, 0x03, 0x91, 0x0A, 0xAE, 0x9C, 0x7C, 
-0x38, 0xAF, 0x7D, 0x0E, 0x19, 0xD0, 0x8F, 0xEC, 0x7E, 0xC6, 0x4B, 0xCF, 0xFC, 0xCC, 0x27, 0x8C, 
-0xF2, 0x28, 0xA3, 0x27, 0x19, 0xA7, 0x91, 0xDC, 0x4F, 0xBA, 0xF4, 0xCE, 0x2A, 0x55, 0x95, 0xBA, 
-0x78, 0x1B, 0x44, 0xF3, 0x9E, 0x0D, 0xD1, 0x84, 0xC7, 0x35, 0x60, 0xE2, 0x89, 0xC4, 0xB9, 0xB2, 
-0x75, 0xBE, 0xF2, 0x4B, 0xE1, 0xE2, 0x17, 0xBD, 0x64, 0x3D, 0x1B, 0x41, 0x48, 0x64, 0xF1, 0xBD, 
-0x4B, 0x19, 0xC5, 0x2A, 0xF1, 0x42, 0xEF, 0x0C, 0x5F, 0x97, 0x06, 0x42, 0xAA, 0x20, 0xA8, 0x28, 
-0xE2, 0x49, 0xE1, 0x2A, 0x5F, 0xF8, 0x0C, 0x2C, 0x45, 0x16, 0x2F, 0x10, 0xCF, 0xA2, 0x99, 0x8E, 
-0x6F, 0xE2, 0xAF, 0xE2, 0x61, 0x14, 0xDC, 0x72, 0x45, 0x16, 0xDF, 0x81, 0x02, 0x10, 0x7C, 0x50, 
-0x88, 0x60, 0x64, 0xBC, 0xA8, 0x52, 0x5A, 0xF1, 0xE5, 0xF3, 0x19, 0x51, 0xE4, 0x5E, 0x69, 0x7E, 
-0xB4, 0x2B, 0x4F, 0x06, 0x3D, 0xDA, 0xC5, 0xC7, 0x34, 0x4E, 0xBE, 0xFA, 0x3F, 0xE2, 0x1D, 0xE3, 
-0xC1, 0xF3, 0x87, 0x00, 0x00, 0x00
-};
-
-#endif
+#ifndef CONFIG_HTML_H_H
+#define CONFIG_HTML_H_H
+
+#include <Arduino.h>
+
+// Generated by tools/build_assets.js from config.html - do not edit
+const char config_html[] PROGMEM = {
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xED, 0x3C, 0xED, 0x72, 0xE3, 0xC6, 
+0x91, 0xFF, 0xF9, 0x14, 0xBD, 0x88, 0x1D, 0x82, 0x65, 0x82, 0x02, 0x40, 0x52, 0x1F, 0x94, 0xA8, 
+0xDC, 0x5A, 0x92, 0xB3, 0x7B, 0x25, 0xED, 0xBA, 0x56, 0x5A, 0xE7, 0x52, 0x71, 0x2A, 0x1E, 0x02, 
+0x43, 0x72, 0x2C, 0x70, 0x86, 0x37, 0x18, 0x50, 0xA2, 0x15, 0x3D, 0xC3, 0x3D, 0x83, 0x1F, 0x20, 
+0x55, 0x77, 0x95, 0x7F, 0xF7, 0xF3, 0xF6, 0x4D, 0xEE, 0x49, 0xAE, 0x7A, 0x06, 0x00, 0x01, 0x12, 
+0xFC, 0x92, 0x37, 0xC9, 0x5D, 0xD5, 0x79, 0xAB, 0x2C, 0x02, 0x98, 0xEE, 0xE9, 0xEE, 0xE9, 0xEF, 
+0xC1, 0xE0, 0xEC, 0xD5, 0xE5, 0xFB, 0x8B, 0xBB, 0xDF, 0x7F, 0x7B, 0x05, 0x63, 0x35, 0x89, 0xCE, 
+0x6B, 0x67, 0xF8, 0x07, 0x22, 0xC2, 0x47, 0x7D, 0x8B, 0xC6, 0x16, 0xDE, 0xA0, 0x24, 0x3C, 0xAF, 
+0x9D, 0x4D, 0xA8, 0x22, 0x10, 0x8C, 0x89, 0x8C, 0xA9, 0xEA, 0x5B, 0x1F, 0xEF, 0xBE, 0x71, 0x8E, 
+0xAD, 0xEC, 0x36, 0x27, 0x13, 0xDA, 0xB7, 0x66, 0x8C, 0x3E, 0x4C, 0x85, 0x54, 0x16, 0x04, 0x82, 
+0x2B, 0xCA, 0x55, 0xDF, 0x7A, 0x60, 0xA1, 0x1A, 0xF7, 0x43, 0x3A, 0x63, 0x01, 0x75, 0xF4, 0x45, 
+0x13, 0x18, 0x67, 0x8A, 0x91, 0xC8, 0x89, 0x03, 0x12, 0xD1, 0xBE, 0xD7, 0x72, 0x11, 0x8D, 0x62, 
+0x2A, 0xA2, 0xE7, 0x17, 0x82, 0x0F, 0xD9, 0x28, 0x91, 0x24, 0x60, 0x9F, 0xFE, 0xCA, 0xC1, 0x81, 
+0x6F, 0x09, 0xA7, 0x11, 0x84, 0x14, 0x2E, 0x04, 0x57, 0x52, 0x44, 0x67, 0x07, 0x66, 0x60, 0xED, 
+0x2C, 0x0E, 0x24, 0x9B, 0xAA, 0xF3, 0x9A, 0x3D, 0x4C, 0x78, 0xA0, 0x98, 0xE0, 0x76, 0x03, 0x9E, 
+0x6A, 0x4A, 0xCE, 0xE1, 0xA9, 0x16, 0x08, 0x1E, 0x2B, 0x88, 0xC9, 0x8C, 0x86, 0x77, 0x63, 0x3A, 
+0xA1, 0xD0, 0x87, 0x48, 0x04, 0x24, 0xBA, 0x55, 0x42, 0x92, 0x11, 0x6D, 0x8D, 0xA8, 0x7A, 0xAB, 
+0xE8, 0xC4, 0xAE, 0x2B, 0x7C, 0x5A, 0x6F, 0x9C, 0xA6, 0x10, 0x64, 0x3A, 0x8D, 0xE6, 0x19, 0x44, 
+0x09, 0x2F, 0x1B, 0x82, 0x1D, 0x8A, 0x20, 0x99, 0x50, 0xAE, 0x5A, 0x03, 0x11, 0xCE, 0xB3, 0x9B, 
+0xC5, 0x49, 0xFA, 0x7D, 0xA8, 0x87, 0x44, 0xDE, 0xD7, 0xF1, 0x61, 0x3E, 0x3A, 0xFB, 0x71, 0x15, 
+0x51, 0x7D, 0x1D, 0x44, 0x24, 0x8E, 0xAF, 0x59, 0xAC, 0x5A, 0x24, 0x0C, 0x6D, 0x0D, 0xE0, 0xE4, 
+0x74, 0xAC, 0x85, 0x8A, 0xA9, 0x7A, 0xAD, 0x94, 0x64, 0x83, 0x44, 0x51, 0xBB, 0x1E, 0xAB, 0x79, 
+0x44, 0xEB, 0x4D, 0xA8, 0x0F, 0x48, 0x70, 0x3F, 0x92, 0x22, 0xE1, 0xA1, 0x13, 0x88, 0x48, 0xC8, 
+0x1E, 0xFC, 0xCA, 0x25, 0xEE, 0xD0, 0xA3, 0xF0, 0x8A, 0x4D, 0x70, 0x2D, 0x08, 0x57, 0xA7, 0x25, 
+0xC4, 0x48, 0xFC, 0x8E, 0x34, 0xE8, 0xA1, 0xBF, 0x64, 0x62, 0xC8, 0x1E, 0x0D, 0xF5, 0x7F, 0xCB, 
+0x34, 0x3D, 0x6F, 0xA6, 0x4A, 0x13, 0xE4, 0xE0, 0x9A, 0x30, 0x1A, 0x9A, 0xF1, 0xCF, 0xA7, 0xFF, 
+0xA7, 0x84, 0x5E, 0xA9, 0x35, 0x0B, 0x25, 0xB3, 0x91, 0x27, 0xA0, 0x51, 0x4C, 0x8B, 0xA4, 0x93, 
+0x30, 0xBC, 0x9A, 0x51, 0xAE, 0x90, 0x5A, 0xCA, 0xA9, 0xB4, 0xEB, 0x97, 0xEF, 0x6F, 0x2E, 0x8C, 
+0x41, 0x5D, 0x0B, 0x12, 0xD2, 0xB0, 0xDE, 0x2C, 0x68, 0xEA, 0xF2, 0x34, 0x92, 0x92, 0x70, 0x7E, 
+0xAB, 0x88, 0x4A, 0x65, 0x13, 0x09, 0x12, 0x32, 0x3E, 0x2A, 0x8B, 0x67, 0xFF, 0x39, 0x72, 0x3A, 
+0x97, 0xC8, 0xC7, 0x7F, 0xD9, 0xA3, 0x4A, 0x76, 0xF7, 0x5C, 0xE2, 0x97, 0x89, 0xA3, 0x64, 0xAB, 
+0x7B, 0xCE, 0x98, 0x73, 0x11, 0x10, 0x15, 0x8C, 0x6D, 0xDA, 0x48, 0x1D, 0x88, 0x88, 0x68, 0x8B, 
+0x4A, 0x29, 0xA4, 0x5D, 0xBF, 0xC2, 0x3F, 0x46, 0x1E, 0x8C, 0x8F, 0x40, 0xE3, 0xE8, 0xD5, 0x9B, 
+0x40, 0xD7, 0xAD, 0xF1, 0xDE, 0x7A, 0x5D, 0x7B, 0x6E, 0xA0, 0x38, 0xCF, 0x0E, 0x32, 0xB7, 0x76, 
+0xA6, 0xB5, 0xED, 0xBC, 0xA6, 0xBD, 0xF1, 0x53, 0xAD, 0x42, 0xE5, 0x86, 0xED, 0x61, 0x67, 0x78, 
+0x88, 0xD0, 0x38, 0xA6, 0xB5, 0x50, 0xE9, 0xEA, 0xE1, 0xAB, 0x1A, 0x5A, 0x7B, 0xAE, 0x21, 0x79, 
+0x9B, 0xB1, 0x67, 0xD7, 0xDE, 0xD0, 0x3F, 0x69, 0x1F, 0x9D, 0xD6, 0x94, 0x24, 0x3C, 0x66, 0x28, 
+0xEB, 0x1E, 0x2C, 0x83, 0x81, 0xDB, 0xEA, 0xC6, 0x40, 0x49, 0x4C, 0x9B, 0xB0, 0x74, 0xE3, 0xB4, 
+0x26, 0xA6, 0x24, 0x60, 0x6A, 0xDE, 0x03, 0xAF, 0x8A, 0xE4, 0xF5, 0x84, 0x54, 0xD0, 0xBD, 0xDE, 
+0xAB, 0xA4, 0x2C, 0xF5, 0xB8, 0x50, 0x76, 0xAB, 0x24, 0x67, 0x5C, 0x95, 0x9C, 0x04, 0x37, 0x1B, 
+0x58, 0x1E, 0x53, 0x1C, 0xE2, 0x95, 0x59, 0x4D, 0xEF, 0x83, 0xDB, 0xF2, 0x32, 0x86, 0x56, 0x99, 
+0x68, 0x05, 0x24, 0x62, 0x03, 0x49, 0x10, 0xC4, 0x09, 0x88, 0x0C, 0x4B, 0x1C, 0xF5, 0x20, 0x62, 
+0x9C, 0x12, 0xE9, 0x8C, 0x24, 0x09, 0x19, 0xE5, 0xCA, 0xF6, 0xDA, 0xDD, 0x90, 0x8E, 0x9A, 0xF0, 
+0x2B, 0x8F, 0xFA, 0x27, 0xED, 0x01, 0xB8, 0x5F, 0xE2, 0x6F, 0xE2, 0xB7, 0xDB, 0x3E, 0x78, 0xAE, 
+0xFB, 0x65, 0xA3, 0xC4, 0xDA, 0x40, 0xC8, 0x90, 0xCA, 0x5C, 0x2E, 0xED, 0x76, 0xC7, 0xEB, 0x76, 
+0x77, 0x97, 0xCB, 0x0A, 0xB1, 0x48, 0x99, 0x33, 0x50, 0x7C, 0x89, 0xC8, 0x8C, 0x98, 0x0D, 0x53, 
+0x77, 0x8E, 0xBA, 0xDD, 0xC3, 0x93, 0x9D, 0xF1, 0xC7, 0xB3, 0x91, 0x36, 0x29, 0x03, 0x4C, 0x7D, 
+0x7A, 0x3C, 0x74, 0xB7, 0x01, 0x07, 0x3A, 0x11, 0x70, 0x74, 0xB0, 0xDF, 0x55, 0x8A, 0x29, 0xDB, 
+0x5A, 0x8A, 0xC1, 0x20, 0xEC, 0x52, 0xAF, 0x42, 0x8A, 0xCE, 0x03, 0x1D, 0xDC, 0x33, 0xE5, 0x14, 
+0x35, 0x2D, 0x62, 0xD3, 0x1E, 0x28, 0xFA, 0xA8, 0x2A, 0x47, 0xE2, 0x03, 0x67, 0xC8, 0xA2, 0x28, 
+0xE3, 0x5F, 0xEB, 0xC5, 0x94, 0x48, 0xCA, 0xCB, 0x00, 0xDB, 0x51, 0xEE, 0xA2, 0x32, 0xE3, 0x76, 
+0x41, 0x58, 0x29, 0x1B, 0x45, 0x1C, 0x0B, 0x25, 0x6E, 0x1D, 0x6D, 0x43, 0xCE, 0xF8, 0x34, 0x51, 
+0x0E, 0xD2, 0x34, 0x85, 0x88, 0x0C, 0x68, 0xB4, 0x19, 0xF5, 0x16, 0x0C, 0xE9, 0xC5, 0x98, 0x71, 
+0x55, 0xC0, 0x73, 0xD2, 0x21, 0xED, 0xC1, 0xF1, 0x3E, 0x78, 0xF4, 0xEF, 0x65, 0xAD, 0x73, 0x87, 
+0xDE, 0x91, 0x4F, 0xF6, 0xD4, 0xBA, 0x5C, 0xE1, 0xBD, 0x61, 0x77, 0x78, 0xB2, 0x37, 0x0D, 0xBD, 
+0xA1, 0x08, 0x92, 0x18, 0x29, 0x29, 0xCF, 0x74, 0xE8, 0x92, 0xEE, 0x70, 0x99, 0x96, 0x47, 0x27, 
+0x1E, 0x93, 0x50, 0x3C, 0xF4, 0xC0, 0xD5, 0xFF, 0xDA, 0xD3, 0x47, 0x90, 0xA3, 0x01, 0xB1, 0x4F, 
+0x0E, 0x9B, 0xE0, 0x1D, 0x76, 0x9B, 0xE0, 0x77, 0xDD, 0x26, 0xB8, 0x2D, 0xBF, 0xB1, 0x3F, 0x21, 
+0xBD, 0x69, 0x44, 0x02, 0x3A, 0x16, 0x51, 0x48, 0x65, 0x41, 0xB6, 0x87, 0x9D, 0xA3, 0xCE, 0xF1, 
+0x60, 0xAB, 0xA1, 0x29, 0xEE, 0x90, 0x20, 0xA0, 0x53, 0xB5, 0xB3, 0xBF, 0x39, 0x24, 0xED, 0x0E, 
+0x49, 0xFD, 0x4D, 0xF7, 0xD8, 0x6D, 0x87, 0x15, 0x96, 0xB2, 0x66, 0xA6, 0x50, 0x3C, 0x70, 0xCC, 
+0x29, 0x76, 0x9D, 0xAB, 0x33, 0xEC, 0x1C, 0xD2, 0xAE, 0x99, 0xAB, 0xD3, 0x6E, 0x1F, 0x07, 0x64, 
+0xB7, 0xB9, 0x58, 0x20, 0xB8, 0xA3, 0xD8, 0x04, 0x03, 0xEE, 0x8E, 0x53, 0x91, 0xA3, 0xE3, 0xC1, 
+0x30, 0x65, 0xEB, 0x78, 0xD0, 0x0D, 0x86, 0x87, 0x95, 0x53, 0x2D, 0x3B, 0x97, 0xA1, 0xE0, 0xCA, 
+0x89, 0xD9, 0x4F, 0xB4, 0x07, 0x7E, 0xCB, 0x97, 0x74, 0x72, 0x6A, 0x6E, 0x3D, 0x50, 0x36, 0x1A, 
+0xAB, 0x1E, 0x1C, 0xBB, 0xEE, 0x6A, 0x1C, 0x9C, 0x10, 0x39, 0x62, 0x5C, 0x87, 0x92, 0x88, 0x2A, 
+0x45, 0xA5, 0x13, 0xA3, 0x61, 0xF2, 0x51, 0x0F, 0x1C, 0xB7, 0xE5, 0xFA, 0x88, 0x65, 0xBB, 0x5F, 
+0x2B, 0x47, 0xDB, 0x25, 0x3A, 0xCF, 0x0E, 0xD2, 0x1C, 0xE0, 0x2C, 0x62, 0xFC, 0x1E, 0x24, 0x8D, 
+0xFA, 0x96, 0xBE, 0x13, 0x8F, 0x29, 0x55, 0x16, 0x8C, 0x25, 0x1D, 0xF6, 0x2D, 0x33, 0xA8, 0xE5, 
+0x1F, 0x7A, 0x83, 0xB6, 0x17, 0x86, 0xAD, 0x20, 0xD6, 0x45, 0x5B, 0x0A, 0x9A, 0x4D, 0x88, 0x05, 
+0x19, 0x61, 0x5C, 0x6B, 0xD7, 0x84, 0x3C, 0x9A, 0x52, 0xAC, 0x07, 0x5E, 0xC7, 0x75, 0xA7, 0x8F, 
+0x05, 0x6E, 0x80, 0x24, 0x4A, 0x9C, 0xD6, 0xA6, 0x24, 0x0C, 0x35, 0x2F, 0xBE, 0x3B, 0x7D, 0x04, 
+0xEF, 0x10, 0xC7, 0x2C, 0x04, 0x87, 0x05, 0xA1, 0xC6, 0x14, 0xB2, 0x78, 0x1A, 0x91, 0x79, 0x0F, 
+0x86, 0x11, 0x7D, 0x3C, 0xAD, 0x91, 0x88, 0x8D, 0xB8, 0xC3, 0x14, 0x9D, 0xC4, 0x3D, 0x08, 0x28, 
+0x57, 0x54, 0x9E, 0xD6, 0x46, 0x64, 0xDA, 0x4B, 0x31, 0x98, 0x59, 0x9C, 0x81, 0x50, 0x4A, 0x4C, 
+0x7A, 0xE0, 0x77, 0xF0, 0x66, 0x3A, 0x55, 0x7E, 0xD7, 0x0C, 0x4D, 0x2D, 0x32, 0xBF, 0x39, 0x7D, 
+0x84, 0x58, 0x44, 0x2C, 0x84, 0x19, 0x91, 0xB6, 0xE3, 0x14, 0x0D, 0x56, 0x27, 0x50, 0xC5, 0x68, 
+0xB6, 0x0B, 0x55, 0x3F, 0x26, 0xB1, 0x62, 0xC3, 0xB9, 0x93, 0x16, 0xAA, 0x8B, 0x07, 0xA9, 0x60, 
+0x3A, 0x5A, 0x2C, 0xE3, 0x54, 0x03, 0xCC, 0x55, 0x51, 0x07, 0x0D, 0x19, 0xE8, 0xB0, 0x9D, 0xC1, 
+0xA8, 0x91, 0xD1, 0xBB, 0x95, 0xD0, 0xF4, 0x12, 0x35, 0x37, 0x89, 0x7B, 0xE0, 0x69, 0xBC, 0x41, 
+0x22, 0x63, 0xD4, 0x82, 0xA9, 0x60, 0x86, 0x86, 0x62, 0xE2, 0x41, 0xA2, 0x08, 0x7D, 0x4A, 0x96, 
+0x74, 0xA4, 0x0A, 0x63, 0x90, 0xEB, 0xC8, 0x14, 0xD3, 0x40, 0xF0, 0x90, 0xC8, 0x79, 0x59, 0x0E, 
+0xBD, 0xB1, 0x98, 0xE9, 0x35, 0x5A, 0xA5, 0x7A, 0x30, 0xCA, 0xE9, 0x59, 0x45, 0x37, 0x95, 0x6C, 
+0x62, 0x90, 0x69, 0x2A, 0x86, 0x42, 0x4E, 0xD2, 0x88, 0x17, 0x11, 0x45, 0xFF, 0xC5, 0x76, 0xFC, 
+0xE9, 0xE3, 0x92, 0xC4, 0x4D, 0x7C, 0x4F, 0x05, 0xE7, 0x97, 0x04, 0x67, 0xAE, 0x7E, 0x99, 0xC9, 
+0x55, 0x12, 0xB7, 0x9B, 0xF9, 0x65, 0xD3, 0x8E, 0x24, 0x0B, 0x8B, 0x8A, 0x81, 0xD7, 0xA7, 0x35, 
+0xFC, 0xBF, 0xA3, 0xE8, 0x64, 0x8A, 0x9C, 0xA1, 0x48, 0x92, 0x09, 0x8F, 0x7B, 0x20, 0xE9, 0x94, 
+0x12, 0x65, 0xFB, 0x4D, 0xF0, 0x86, 0x28, 0x23, 0xAD, 0xC0, 0x46, 0x57, 0x2B, 0x15, 0xF8, 0xB9, 
+0xF6, 0x4F, 0x13, 0x1A, 0x32, 0x02, 0x76, 0xC1, 0xB0, 0x4E, 0xD0, 0xAE, 0x30, 0xE7, 0x5C, 0x22, 
+0x61, 0xCD, 0x9C, 0xDE, 0x50, 0x9A, 0x32, 0x60, 0x5B, 0x0A, 0xF9, 0x99, 0xF4, 0xEE, 0xB0, 0x60, 
+0x79, 0x3D, 0xF0, 0x8F, 0x8D, 0xC9, 0x15, 0x43, 0x1C, 0xAA, 0x26, 0xF8, 0xDD, 0xE9, 0x23, 0x38, 
+0xDD, 0x2C, 0xD2, 0xB9, 0x4D, 0xFD, 0xAF, 0xE5, 0x35, 0x9A, 0xE0, 0xC2, 0x31, 0x7A, 0x06, 0x1C, 
+0xE5, 0x1C, 0xAE, 0x0E, 0xA8, 0x52, 0xE2, 0x76, 0x0C, 0x41, 0x32, 0x60, 0x81, 0x33, 0xA0, 0x3F, 
+0x31, 0x2A, 0x6D, 0xB7, 0xD5, 0x69, 0x82, 0x09, 0x99, 0x4D, 0x40, 0x90, 0x25, 0xC3, 0xC5, 0xFF, 
+0x3B, 0x21, 0x93, 0x34, 0x30, 0x58, 0x8C, 0xB4, 0xB2, 0x05, 0xC9, 0x35, 0x6B, 0x49, 0x60, 0x0B, 
+0xC5, 0x2F, 0xF1, 0xA3, 0x1D, 0x59, 0x47, 0x93, 0xAB, 0x89, 0x2E, 0xD3, 0xDB, 0xD5, 0x1C, 0x19, 
+0x9E, 0xDD, 0x35, 0x3C, 0x2F, 0x27, 0x24, 0x46, 0xD0, 0xA9, 0x4A, 0xE6, 0x92, 0xAE, 0xB2, 0x9A, 
+0xDF, 0xDB, 0x4E, 0x27, 0xB3, 0x9A, 0xEA, 0x7C, 0xAF, 0x60, 0x0F, 0x5E, 0xAB, 0xBD, 0x6A, 0x0F, 
+0x47, 0xD5, 0xF6, 0x50, 0xB4, 0xFD, 0x62, 0x5E, 0x78, 0x5A, 0xD3, 0x8F, 0x0B, 0xB4, 0x24, 0xD3, 
+0x29, 0x95, 0x81, 0x76, 0x21, 0xCB, 0xF6, 0xE2, 0xB6, 0xDC, 0x2E, 0x4E, 0x58, 0x30, 0xA9, 0xDD, 
+0xFD, 0xFA, 0xE7, 0x74, 0xE1, 0x45, 0xD1, 0x60, 0xF4, 0x5F, 0x38, 0x95, 0xAE, 0x5F, 0x74, 0x2A, 
+0xE6, 0x6A, 0x59, 0xA5, 0x35, 0x25, 0xBF, 0xC8, 0xF5, 0xAF, 0x4A, 0xBC, 0xB4, 0x2C, 0x1D, 0xBD, 
+0x2C, 0x4B, 0x5A, 0x35, 0x7D, 0x84, 0x55, 0xED, 0xF7, 0x0D, 0x3F, 0x3A, 0x83, 0x89, 0x05, 0x8B, 
+0xE0, 0x09, 0x76, 0x4B, 0xCB, 0xDC, 0xC1, 0xC9, 0xB1, 0x67, 0xF2, 0x17, 0xB7, 0x7B, 0x72, 0x78, 
+0x78, 0x62, 0xF2, 0x97, 0xBC, 0x8F, 0xF6, 0x30, 0x66, 0x8A, 0x9E, 0x42, 0x86, 0x5B, 0x11, 0x7E, 
+0xBF, 0x2B, 0xEE, 0xF6, 0xE0, 0xD8, 0x1F, 0x1E, 0x1A, 0xDC, 0x7E, 0xF7, 0xB0, 0x4D, 0x07, 0x9B, 
+0x71, 0x47, 0x28, 0x86, 0x5D, 0x91, 0x0F, 0xBB, 0x27, 0xD4, 0x4D, 0xEB, 0xD7, 0xF0, 0xE4, 0xE8, 
+0xC8, 0x3D, 0xDC, 0x42, 0x78, 0x9A, 0xD6, 0xED, 0x86, 0x3D, 0x4D, 0xE5, 0x34, 0xF6, 0xA3, 0xA0, 
+0x4D, 0x68, 0xB8, 0x1E, 0x7B, 0x21, 0xB3, 0x7E, 0x5A, 0x76, 0xD7, 0xA9, 0xB7, 0xAE, 0xAC, 0x8A, 
+0x72, 0xC5, 0x19, 0x44, 0x22, 0xB8, 0x2F, 0xAD, 0xBC, 0xDB, 0x3A, 0xE9, 0xAE, 0x5A, 0xE4, 0xE1, 
+0x76, 0x8B, 0x5C, 0x9A, 0x5E, 0x3B, 0xD9, 0x17, 0xD8, 0xE5, 0x12, 0xC5, 0x59, 0xF5, 0x94, 0x65, 
+0x70, 0xAE, 0xFB, 0x65, 0xC1, 0x95, 0xA3, 0x19, 0x80, 0x77, 0x5C, 0x9D, 0xAE, 0x14, 0x02, 0x7F, 
+0x16, 0x37, 0xFC, 0xFD, 0xE2, 0x86, 0xB6, 0xBC, 0x92, 0x55, 0x78, 0xAB, 0xA2, 0xE9, 0x6E, 0x0B, 
+0xDE, 0x1B, 0xF2, 0x1B, 0x8D, 0x68, 0x48, 0x26, 0x2C, 0x9A, 0xF7, 0xA0, 0xFE, 0x16, 0x0D, 0xB3, 
+0xDE, 0x84, 0x98, 0xF0, 0xD8, 0x89, 0xA9, 0x64, 0xC3, 0x6A, 0x71, 0xE4, 0x85, 0x9C, 0x48, 0x14, 
+0xAA, 0x51, 0x0F, 0xB8, 0xE0, 0x74, 0x37, 0x87, 0xBD, 0x39, 0xBA, 0x2E, 0x57, 0x7D, 0x9D, 0xCC, 
+0xD8, 0xBB, 0x27, 0x4D, 0xF0, 0xDA, 0x6E, 0x13, 0xFC, 0xCE, 0x21, 0x86, 0x30, 0xAF, 0xDB, 0x58, 
+0xA1, 0xAD, 0x5C, 0x30, 0x97, 0x55, 0x4A, 0x8B, 0x6D, 0x27, 0xFD, 0x51, 0x62, 0x9A, 0x2A, 0x4F, 
+0xD9, 0xC5, 0x23, 0xA3, 0x4E, 0xE6, 0x13, 0xBD, 0x56, 0x47, 0x4F, 0x4F, 0x74, 0xAC, 0x74, 0x06, 
+0x89, 0x52, 0x82, 0xC7, 0xAB, 0xC9, 0xB0, 0xF1, 0xDA, 0x7A, 0x19, 0xD7, 0xFA, 0xC1, 0xE2, 0xBC, 
+0xE5, 0x1C, 0xBD, 0x70, 0x2B, 0x15, 0xAD, 0xBE, 0xB3, 0xDD, 0xB5, 0x67, 0x64, 0xE9, 0xFC, 0x7C, 
+0xA1, 0xAC, 0xE8, 0x3A, 0xDB, 0x05, 0x6F, 0xBE, 0xB4, 0x6E, 0x1B, 0xD4, 0xCE, 0x5D, 0x6B, 0x92, 
+0x7B, 0x24, 0xD3, 0xBB, 0x87, 0xB9, 0x2C, 0xD9, 0x58, 0x5B, 0x6A, 0x1B, 0xC6, 0xE3, 0x24, 0x08, 
+0x68, 0x1C, 0x2F, 0xA7, 0xD7, 0xC6, 0x3F, 0x95, 0xE1, 0x2B, 0xF3, 0xF3, 0xD4, 0xEB, 0xAF, 0xCD, 
+0x22, 0x3C, 0x9D, 0x45, 0x94, 0xB5, 0x52, 0x1B, 0xBC, 0x9F, 0xA9, 0xA5, 0x87, 0xCD, 0x88, 0xE3, 
+0x6E, 0x13, 0x3C, 0xFF, 0xC4, 0x34, 0x23, 0xF2, 0x79, 0xD7, 0x14, 0xEE, 0x2F, 0xCC, 0x28, 0x37, 
+0xD9, 0xF7, 0xD2, 0x84, 0xBB, 0x95, 0x22, 0x55, 0xB6, 0x5A, 0x51, 0xE0, 0xAC, 0xAB, 0xA8, 0xF3, 
+0x9A, 0xB4, 0x94, 0x76, 0x2C, 0x75, 0x4B, 0x3F, 0x6F, 0xD3, 0xD6, 0xF3, 0x8E, 0xFD, 0xA3, 0x34, 
+0x5A, 0x9B, 0xEE, 0xD5, 0xD6, 0xA6, 0x6D, 0x65, 0x6F, 0x75, 0xFD, 0x6A, 0x66, 0x19, 0x45, 0xBB, 
+0xB1, 0x6F, 0x1B, 0xB1, 0x90, 0x05, 0x57, 0xB4, 0xB6, 0x4E, 0x77, 0xE3, 0x30, 0xE5, 0xCA, 0xB4, 
+0x89, 0x0C, 0xB7, 0x55, 0x1C, 0x16, 0xE9, 0x3F, 0xCE, 0x32, 0xE8, 0x12, 0xFD, 0x9D, 0xC6, 0xCB, 
+0xDA, 0xA0, 0x7B, 0xAF, 0xE5, 0x8E, 0x6D, 0xC6, 0x35, 0xCD, 0xF4, 0x7D, 0xBB, 0x86, 0xAB, 0x5D, 
+0xF3, 0xD3, 0x75, 0xF2, 0xAE, 0x40, 0xBC, 0xE2, 0xAA, 0x17, 0x2E, 0x75, 0x17, 0xBA, 0x36, 0x98, 
+0xF4, 0x3A, 0x62, 0x32, 0x6C, 0xE5, 0x56, 0xFC, 0x56, 0xEC, 0x6B, 0x5C, 0x55, 0xB5, 0x24, 0x4D, 
+0x3B, 0xB8, 0xDC, 0xBE, 0x3A, 0x48, 0xDF, 0x20, 0xC0, 0x1D, 0x97, 0xF3, 0xDA, 0x59, 0xC8, 0x66, 
+0xA0, 0xB7, 0xC4, 0xFA, 0xD6, 0x72, 0x77, 0xCA, 0xAA, 0x7C, 0x6C, 0x6C, 0x1B, 0x9F, 0x19, 0x61, 
+0x65, 0x8F, 0xB3, 0x0E, 0x84, 0x05, 0x82, 0x07, 0x11, 0x0B, 0xEE, 0xFB, 0xD6, 0x48, 0x7C, 0x4D, 
+0x82, 0x7B, 0xBB, 0x61, 0x01, 0x91, 0x8C, 0x38, 0x3A, 0xBD, 0xEB, 0x5B, 0xDF, 0x89, 0x68, 0x66, 
+0x10, 0x60, 0xAF, 0x02, 0x5F, 0x53, 0xF8, 0x5A, 0x3C, 0xF6, 0x2D, 0x0C, 0xE8, 0x7E, 0x07, 0xFC, 
+0x8E, 0x05, 0xD8, 0xDF, 0xEF, 0x5B, 0x18, 0x7D, 0x2C, 0x88, 0x95, 0x14, 0xF7, 0xB4, 0x6F, 0x05, 
+0x89, 0xC4, 0x1E, 0xFF, 0x05, 0x72, 0x96, 0xDD, 0x35, 0xF5, 0x7D, 0xDF, 0xF2, 0x11, 0xD9, 0x94, 
+0xA8, 0x31, 0x84, 0x7D, 0xEB, 0xC6, 0x3B, 0x01, 0xCF, 0x7F, 0xD3, 0xBD, 0xF1, 0x7C, 0xF0, 0x4E, 
+0x22, 0xE7, 0xC8, 0x39, 0x82, 0x23, 0xE7, 0xC8, 0x3A, 0x40, 0xDE, 0xE3, 0xD9, 0x08, 0xFF, 0x18, 
+0xCA, 0xF1, 0x6D, 0x0A, 0x6F, 0x89, 0x3B, 0xDD, 0x13, 0xB1, 0x96, 0x5E, 0x7D, 0x38, 0x3B, 0x18, 
+0x7B, 0x08, 0x16, 0xB2, 0x59, 0xA5, 0x48, 0xB0, 0x8F, 0xB0, 0x2C, 0xAC, 0x25, 0x13, 0xD2, 0xAF, 
+0x6E, 0xB4, 0xD7, 0x8F, 0xD1, 0x25, 0x56, 0x5E, 0xA3, 0x58, 0xE7, 0xB7, 0x5F, 0xA6, 0xD3, 0x5D, 
+0x98, 0x41, 0xE6, 0x15, 0x8C, 0x90, 0x46, 0x70, 0x9B, 0xD0, 0x48, 0xE0, 0x32, 0x2E, 0x61, 0x2B, 
+0x98, 0x06, 0x4E, 0x66, 0x72, 0xE9, 0xA1, 0x90, 0x7D, 0x0B, 0x31, 0x3A, 0xA1, 0x9C, 0x5B, 0xE7, 
+0xDF, 0x11, 0xDC, 0x07, 0xBC, 0xA5, 0x81, 0x00, 0xFB, 0xF5, 0xE5, 0x45, 0xE3, 0xEC, 0x40, 0x0F, 
+0x3B, 0xAF, 0x9D, 0x19, 0xFB, 0x54, 0xF3, 0x29, 0xED, 0x5B, 0x3C, 0x99, 0x0C, 0xA8, 0xB4, 0x80, 
+0x85, 0x05, 0x58, 0x98, 0x91, 0x28, 0xA1, 0x7D, 0xCB, 0xEF, 0xBA, 0xAE, 0x05, 0x13, 0xC6, 0xFB, 
+0x16, 0xFE, 0x25, 0x8F, 0x7D, 0xAB, 0xE3, 0x9E, 0x74, 0xAD, 0x2A, 0x62, 0x30, 0xD7, 0xCA, 0x26, 
+0x0D, 0x12, 0xC2, 0x43, 0x01, 0x34, 0x82, 0x98, 0xF2, 0x58, 0x48, 0xA0, 0xB1, 0xFA, 0xF4, 0x33, 
+0x50, 0x0E, 0x84, 0x49, 0x9A, 0xC9, 0x76, 0x55, 0xC4, 0x5B, 0xD8, 0x7A, 0xA0, 0xF9, 0x0C, 0x6F, 
+0x3E, 0xFD, 0xE7, 0x84, 0x86, 0xFB, 0x71, 0x86, 0xE0, 0x19, 0x67, 0x9E, 0xFB, 0xD9, 0x39, 0x1B, 
+0x25, 0xE4, 0xC5, 0x9C, 0x49, 0xF2, 0x90, 0xCD, 0x70, 0x21, 0x93, 0x50, 0xC0, 0x0D, 0x0D, 0x59, 
+0x28, 0x76, 0x64, 0x0C, 0xA1, 0x33, 0xC6, 0x2A, 0xB9, 0x02, 0x7C, 0x35, 0x41, 0xF0, 0x68, 0xBE, 
+0x9E, 0xBD, 0x6B, 0x1A, 0xA8, 0x44, 0x12, 0x20, 0x81, 0x4A, 0x48, 0xA4, 0x95, 0xCF, 0x70, 0xF8, 
+0x62, 0x9E, 0xD4, 0x58, 0xD2, 0x18, 0x37, 0x56, 0xAC, 0xF3, 0x8F, 0x93, 0x81, 0xD4, 0x48, 0xE1, 
+0x03, 0xA3, 0x23, 0x01, 0xF6, 0x97, 0xBB, 0xAE, 0xD9, 0x02, 0x49, 0xC6, 0x60, 0x67, 0x99, 0x43, 
+0xCF, 0x75, 0x37, 0x2C, 0xDB, 0xEB, 0x40, 0xB1, 0x19, 0x91, 0x20, 0xF5, 0xC4, 0xE9, 0xF2, 0x8D, 
+0x93, 0x09, 0x0D, 0x49, 0x08, 0x67, 0x90, 0x68, 0xCA, 0x96, 0x78, 0xAC, 0xB0, 0xFD, 0x17, 0x5B, 
+0x38, 0x76, 0x0A, 0xAC, 0xF3, 0xBB, 0xB5, 0x16, 0x7E, 0x47, 0xF8, 0xBF, 0x26, 0x74, 0x2F, 0x13, 
+0x47, 0x94, 0x0E, 0x9D, 0x4C, 0xD5, 0xDC, 0x3A, 0xBF, 0x64, 0xB1, 0x22, 0x3C, 0x60, 0x04, 0xBE, 
+0x23, 0xC1, 0xA7, 0xBF, 0x08, 0xB0, 0x83, 0xC9, 0x0E, 0xB2, 0x2D, 0xA0, 0xC8, 0x2D, 0xA2, 0xDB, 
+0x72, 0xD1, 0xD7, 0xD2, 0x69, 0xDF, 0x72, 0x5B, 0xDE, 0x8A, 0x1A, 0x6D, 0x12, 0xF2, 0x82, 0x0A, 
+0x82, 0x34, 0xA2, 0x88, 0x91, 0x37, 0xA5, 0x79, 0x03, 0xDB, 0xC5, 0xE5, 0xDE, 0x5F, 0x8B, 0x34, 
+0x91, 0xC3, 0x24, 0x8A, 0x8A, 0x13, 0x5C, 0x47, 0x94, 0xEF, 0xC5, 0xA5, 0x46, 0x90, 0x31, 0x79, 
+0xDC, 0xEA, 0xFE, 0x72, 0x1E, 0x33, 0x1F, 0xA0, 0x2D, 0x3F, 0x32, 0xF4, 0xE8, 0xEC, 0xEC, 0xC5, 
+0x4C, 0x6A, 0xF3, 0x5F, 0x4C, 0xA0, 0x8D, 0x9F, 0xEC, 0xC3, 0x64, 0xC9, 0x03, 0x6C, 0x5B, 0xC7, 
+0xBF, 0xB7, 0x37, 0xD0, 0x14, 0x06, 0x92, 0x29, 0x16, 0x90, 0xC8, 0x3A, 0x7F, 0xC7, 0x66, 0x34, 
+0x82, 0x0B, 0xF9, 0xE9, 0x2F, 0x8A, 0x05, 0x3B, 0xFA, 0x82, 0x32, 0x8A, 0x3C, 0x3C, 0xED, 0xE7, 
+0x0A, 0xCC, 0xC4, 0x93, 0x4F, 0x7F, 0xE1, 0x6C, 0x22, 0x60, 0x4A, 0x24, 0x31, 0x5E, 0xE1, 0x6F, 
+0x68, 0xFD, 0xBA, 0x97, 0x67, 0x9D, 0x5F, 0xAF, 0x31, 0x7F, 0xB8, 0x4E, 0x02, 0x1A, 0xEF, 0x65, 
+0xFC, 0x1A, 0xA3, 0x33, 0x21, 0x8F, 0x59, 0xBC, 0xB8, 0xF9, 0xF4, 0xF3, 0x23, 0xF2, 0x63, 0x07, 
+0x18, 0x38, 0x76, 0x90, 0xE5, 0x02, 0xC3, 0xC2, 0xA5, 0x62, 0x8C, 0xD8, 0x27, 0x18, 0x5E, 0x27, 
+0x3F, 0x01, 0x56, 0xF9, 0x3C, 0x7E, 0x51, 0xCC, 0x4B, 0x49, 0x60, 0x7C, 0xC1, 0x84, 0x59, 0x94, 
+0x7D, 0x99, 0x60, 0x7C, 0x73, 0xE0, 0x5B, 0xCF, 0xC1, 0xFB, 0x38, 0x48, 0x24, 0x0B, 0x49, 0xF8, 
+0x72, 0xFA, 0x5F, 0x1C, 0xB4, 0x17, 0xE0, 0xB9, 0xF3, 0xF5, 0xDD, 0xCF, 0x13, 0xB8, 0x5F, 0xCE, 
+0x4D, 0x24, 0x1E, 0xF2, 0x40, 0xFD, 0x35, 0xF9, 0x71, 0x47, 0xC3, 0x5C, 0xC0, 0xBE, 0x30, 0x3E, 
+0x5F, 0xF1, 0x80, 0x72, 0xEC, 0x1F, 0x44, 0x68, 0x0A, 0x10, 0x33, 0x88, 0x92, 0x9F, 0xE0, 0xD7, 
+0x91, 0x3A, 0xAD, 0x8E, 0xCD, 0x7B, 0x70, 0x34, 0x66, 0xA3, 0x71, 0xCE, 0xD2, 0xEB, 0x48, 0xED, 
+0xC5, 0x92, 0x06, 0xCE, 0x78, 0x3A, 0xDA, 0x33, 0xE7, 0x98, 0x92, 0x11, 0x59, 0xE6, 0x68, 0xB4, 
+0x8E, 0xA3, 0xCF, 0x9A, 0x6D, 0xE8, 0xF6, 0xBE, 0x75, 0xFE, 0xDF, 0xFF, 0xF6, 0x1F, 0x99, 0xC7, 
+0x29, 0xBF, 0xD7, 0x1D, 0x52, 0xB8, 0x63, 0x74, 0x32, 0xDD, 0xAF, 0xA8, 0x08, 0x89, 0x22, 0x4E, 
+0x4C, 0x79, 0xE8, 0xE8, 0xD6, 0xDE, 0x0C, 0xDD, 0xF8, 0xDB, 0xF4, 0x17, 0x86, 0x7A, 0xB8, 0xE2, 
+0x33, 0x4C, 0x3E, 0x42, 0x0A, 0x97, 0x44, 0x89, 0x18, 0xEC, 0x09, 0xE3, 0x3B, 0x88, 0xBA, 0x02, 
+0xEF, 0x22, 0x41, 0x4F, 0x45, 0xEE, 0x65, 0x22, 0xF7, 0xF3, 0xB0, 0xE6, 0x6D, 0x90, 0xFD, 0x05, 
+0x09, 0x31, 0x42, 0x7F, 0xFA, 0x99, 0x23, 0x1D, 0x13, 0xC6, 0x13, 0xFC, 0x1B, 0x53, 0xA0, 0x48, 
+0x22, 0xE1, 0x10, 0x89, 0x18, 0x42, 0x4D, 0x24, 0xC1, 0xA0, 0x26, 0x67, 0x2C, 0x7C, 0x61, 0x92, 
+0x4B, 0xE5, 0x8C, 0x4A, 0x67, 0x2A, 0xA2, 0x08, 0x3B, 0xB4, 0x6B, 0x24, 0xF3, 0xAD, 0x79, 0x6C, 
+0xAA, 0xB9, 0x74, 0x36, 0xB0, 0x63, 0x3A, 0xDA, 0x25, 0x03, 0x5E, 0x33, 0x43, 0x1E, 0xFF, 0x96, 
+0x44, 0x74, 0xF8, 0x02, 0x09, 0xC5, 0x74, 0x94, 0xF0, 0x50, 0xC4, 0x58, 0xD2, 0x04, 0x11, 0x76, 
+0xA1, 0x28, 0x9E, 0x21, 0x88, 0x93, 0x48, 0x11, 0x23, 0xA7, 0x17, 0xC9, 0x46, 0x11, 0x95, 0xC4, 
+0xBB, 0xCB, 0x06, 0xAE, 0x62, 0x45, 0xB0, 0x9C, 0xDB, 0x51, 0x30, 0x6B, 0xD0, 0x67, 0x82, 0x69, 
+0x67, 0xCA, 0xD3, 0x4D, 0x25, 0xD3, 0x76, 0x73, 0xD1, 0x74, 0xF7, 0x17, 0x4D, 0x4C, 0x61, 0x86, 
+0x5B, 0x20, 0x2C, 0x20, 0x28, 0x26, 0x6A, 0x68, 0xD5, 0x49, 0x11, 0xBE, 0x1A, 0x3D, 0x79, 0x51, 
+0x0C, 0xC4, 0xF3, 0x1C, 0x38, 0x6F, 0xAC, 0x04, 0x56, 0xEB, 0x6F, 0xF4, 0x0F, 0x66, 0xAA, 0xA4, 
+0xDF, 0xCA, 0x4F, 0x3F, 0x0F, 0x59, 0x80, 0x86, 0x34, 0x16, 0x92, 0xC4, 0x3B, 0x88, 0xA4, 0x8C, 
+0x2E, 0x77, 0xC6, 0x4B, 0x1A, 0x82, 0x0D, 0x97, 0xED, 0x1A, 0x72, 0x99, 0x14, 0x2B, 0x94, 0x71, 
+0x4E, 0xD9, 0x44, 0xC4, 0x4A, 0x22, 0xEB, 0xD4, 0x98, 0xD1, 0x28, 0x23, 0xB3, 0xDA, 0xA3, 0xAD, 
+0x4A, 0xA3, 0xDC, 0x78, 0x5B, 0x6D, 0x2B, 0x15, 0x36, 0x2B, 0x16, 0xFD, 0xFA, 0x42, 0x8F, 0x09, 
+0x4F, 0x1F, 0x18, 0x87, 0x66, 0x37, 0xB2, 0x9E, 0x52, 0xD6, 0x16, 0x72, 0x2D, 0x30, 0x5B, 0x32, 
+0xE6, 0xF7, 0xE7, 0x6B, 0x35, 0x89, 0x68, 0x8E, 0x7D, 0x5A, 0xB3, 0xAF, 0x11, 0x23, 0x76, 0x38, 
+0x84, 0x13, 0xF0, 0x8E, 0xA0, 0x03, 0x9E, 0x6F, 0x9D, 0x9F, 0x1D, 0x64, 0x43, 0xF2, 0xA6, 0xD3, 
+0x6B, 0xA4, 0x9B, 0xC8, 0x62, 0xF3, 0x69, 0x23, 0xA3, 0x59, 0xBF, 0xAF, 0xC0, 0x6A, 0x76, 0xEB, 
+0x92, 0x28, 0xF2, 0x77, 0x64, 0x36, 0xEB, 0xAB, 0xF9, 0x1E, 0x78, 0xDD, 0x59, 0x87, 0xF8, 0xE0, 
+0xEB, 0xDD, 0x37, 0xCF, 0xF1, 0xC1, 0x7F, 0xD3, 0x2D, 0x5E, 0x3B, 0xFE, 0xCC, 0xE9, 0x68, 0xF6, 
+0x89, 0x1A, 0x57, 0x09, 0x0A, 0x7B, 0xD6, 0x80, 0x8D, 0xB9, 0x2E, 0x0A, 0xCB, 0x73, 0x97, 0x44, 
+0xA5, 0xC7, 0x3E, 0x7A, 0xE8, 0xD9, 0x2D, 0x98, 0xE3, 0xDF, 0xAE, 0x05, 0x8F, 0x7E, 0x7A, 0xED, 
+0xF7, 0xAD, 0x36, 0x02, 0x94, 0xE4, 0x7A, 0x49, 0xE3, 0x80, 0x48, 0x8C, 0xAD, 0x3A, 0xCC, 0x14, 
+0xE5, 0x5B, 0xD6, 0xB9, 0xEC, 0x5D, 0xFE, 0xEC, 0x74, 0x02, 0x70, 0x32, 0x63, 0x23, 0xA2, 0xE8, 
+0xEF, 0x98, 0x1A, 0xDF, 0xE5, 0xFB, 0x52, 0x76, 0x22, 0xA3, 0xAD, 0x87, 0x06, 0xA6, 0x64, 0x44, 
+0x1D, 0xFA, 0xC8, 0x94, 0x3E, 0xCB, 0x71, 0x5A, 0x8B, 0xA9, 0xBA, 0x63, 0x13, 0x2A, 0x12, 0x55, 
+0x3E, 0x00, 0xF5, 0xC0, 0x78, 0x28, 0x1E, 0x5A, 0x78, 0xDC, 0x09, 0xEF, 0xB5, 0xF0, 0x25, 0x41, 
+0xE8, 0x43, 0x22, 0xA3, 0xD3, 0xDA, 0x73, 0x13, 0x7C, 0xD7, 0xD5, 0xDB, 0x28, 0x39, 0x49, 0x59, 
+0xC3, 0x14, 0x9E, 0x70, 0x03, 0x1A, 0x14, 0x91, 0x23, 0xAA, 0x3E, 0xE2, 0x68, 0x3C, 0xD8, 0xB0, 
+0x82, 0x4D, 0xC4, 0x0A, 0xCF, 0x7A, 0x65, 0x47, 0x4B, 0x02, 0x12, 0xE1, 0xAD, 0x3A, 0xFC, 0xF9, 
+0xCF, 0xB0, 0x79, 0xAC, 0xE7, 0x1F, 0xB5, 0xDC, 0x96, 0xDB, 0xF2, 0xF4, 0x41, 0x94, 0x7C, 0x1A, 
+0xE8, 0x43, 0x9D, 0xF1, 0x90, 0x3E, 0xB6, 0xB0, 0x05, 0x5D, 0xCF, 0x0F, 0x80, 0x54, 0x4D, 0x3E, 
+0x95, 0x42, 0x89, 0x40, 0x44, 0x06, 0xE1, 0x90, 0x45, 0xB4, 0xB7, 0x1B, 0xB2, 0x8D, 0x43, 0x6A, 
+0x6B, 0x16, 0x25, 0x07, 0x29, 0xCB, 0xAB, 0x68, 0xFC, 0xF9, 0x49, 0x33, 0xD3, 0x94, 0x85, 0x3E, 
+0x3C, 0xD5, 0xB0, 0x5F, 0xD4, 0xC3, 0xC5, 0x94, 0xF3, 0x1E, 0x56, 0x77, 0x31, 0x7D, 0xCB, 0xD5, 
+0xE2, 0x80, 0xC8, 0x88, 0x66, 0x87, 0x8B, 0xBE, 0x9E, 0xBF, 0x0D, 0xED, 0x7A, 0xD6, 0xEC, 0xAC, 
+0x37, 0x5A, 0xDA, 0x59, 0x36, 0x9A, 0xB5, 0x07, 0xAA, 0x76, 0x86, 0x7C, 0xA0, 0xAA, 0x00, 0x99, 
+0xB7, 0xA9, 0x76, 0x86, 0xCF, 0x21, 0x72, 0x2C, 0xB5, 0xE7, 0x66, 0x0D, 0xEB, 0x5C, 0xE4, 0x41, 
+0xB7, 0x66, 0x52, 0x5C, 0xDF, 0x44, 0x82, 0x6C, 0xC0, 0xB6, 0x68, 0xE5, 0x14, 0xE8, 0xC1, 0xA6, 
+0xC7, 0x1E, 0xE0, 0x38, 0xBC, 0x00, 0x9D, 0x15, 0xDA, 0xBB, 0x30, 0x53, 0xAA, 0xCC, 0x4B, 0xBC, 
+0x44, 0x66, 0x6F, 0xF8, 0xA9, 0x16, 0xE1, 0x06, 0xD5, 0x76, 0x4C, 0x79, 0x29, 0x51, 0xA0, 0x04, 
+0xB3, 0xF0, 0xDD, 0x61, 0x71, 0x74, 0x59, 0x9C, 0x3A, 0x1D, 0xD6, 0x4A, 0x41, 0x14, 0xB9, 0xA5, 
+0x3C, 0xCC, 0xF2, 0x8F, 0x5D, 0x90, 0xAE, 0x66, 0xA7, 0x05, 0xCA, 0x4C, 0x6E, 0x96, 0x66, 0x30, 
+0xFB, 0x60, 0x5D, 0x93, 0xD4, 0x15, 0x51, 0xEB, 0xEC, 0xE6, 0x25, 0xA8, 0xAB, 0xD3, 0xA2, 0xE2, 
+0xCA, 0x62, 0x96, 0x60, 0x52, 0x8D, 0x9D, 0x8C, 0xA4, 0x94, 0x55, 0x14, 0x44, 0x8B, 0xC7, 0x01, 
+0xB3, 0x93, 0x5A, 0x91, 0x18, 0xD9, 0xF5, 0xA5, 0x32, 0x63, 0x94, 0x10, 0x19, 0x92, 0x90, 0xE0, 
+0x51, 0x2D, 0x63, 0xA2, 0x0D, 0xDC, 0xE5, 0xA7, 0x52, 0xAD, 0x1D, 0x0A, 0xE8, 0x62, 0x45, 0x4C, 
+0x70, 0x72, 0xFA, 0xEA, 0x7B, 0xFE, 0x3D, 0x7F, 0x27, 0x14, 0xE9, 0xE9, 0xCC, 0x50, 0x9F, 0x32, 
+0xD3, 0xA3, 0x29, 0x9F, 0x31, 0x22, 0xB1, 0xEF, 0x56, 0x4C, 0xE3, 0xAF, 0x6E, 0xBF, 0x6D, 0xFB, 
+0x3A, 0x2B, 0x21, 0x98, 0xA9, 0xC5, 0x7A, 0xE8, 0x90, 0x71, 0x12, 0xB5, 0xEA, 0x65, 0x27, 0x52, 
+0x0E, 0xAB, 0x0B, 0x37, 0x12, 0xCF, 0xD2, 0x83, 0x6D, 0xD0, 0x07, 0x5D, 0x96, 0xF4, 0x70, 0x07, 
+0xFC, 0x20, 0x88, 0x67, 0xA7, 0xD9, 0xC1, 0xDB, 0x44, 0x0D, 0x9D, 0xE3, 0xA6, 0x55, 0xFB, 0x0A, 
+0x2C, 0xF4, 0xFF, 0xB1, 0x22, 0x93, 0x69, 0xF3, 0x8E, 0x4E, 0xA6, 0x54, 0x12, 0xAC, 0xC0, 0x9B, 
+0x6F, 0x4C, 0x57, 0xB9, 0xA9, 0x37, 0x6D, 0x9A, 0xA6, 0xB1, 0xDB, 0xBC, 0x4E, 0x7E, 0xFA, 0x9E, 
+0x6B, 0x20, 0xDF, 0xF5, 0x3B, 0x8E, 0xEB, 0x39, 0x2E, 0x1E, 0x8E, 0xE9, 0xB9, 0x6E, 0xD3, 0xEF, 
+0xB6, 0xBA, 0xCD, 0x43, 0xB7, 0xD9, 0xE9, 0x36, 0x8F, 0xDD, 0xE6, 0x51, 0xB7, 0x72, 0x9C, 0xA7, 
+0xC7, 0x1D, 0x35, 0x0F, 0xBD, 0x66, 0xA7, 0xD3, 0x3C, 0x3A, 0x69, 0x1E, 0x1D, 0x7E, 0xCF, 0xAD, 
+0xEC, 0xD8, 0x2C, 0xE5, 0x81, 0x08, 0x69, 0xF8, 0x51, 0x32, 0xE8, 0xA7, 0x17, 0x1F, 0x3F, 0xBC, 
+0xB5, 0x17, 0xEC, 0xE4, 0x07, 0x6C, 0xF5, 0x8B, 0xEC, 0x7D, 0xC8, 0x57, 0x3A, 0x90, 0x94, 0x28, 
+0x9A, 0x2E, 0xB6, 0x6D, 0x11, 0xAB, 0xA1, 0xDF, 0x6B, 0xB9, 0x2F, 0x9F, 0xBC, 0xB4, 0x30, 0x88, 
+0x59, 0xCD, 0xC2, 0x3C, 0xD5, 0xC3, 0xF2, 0x04, 0xA6, 0xA9, 0xA5, 0x27, 0xE2, 0x3F, 0x31, 0x3E, 
+0xA3, 0x92, 0xE3, 0xEE, 0xA1, 0x68, 0x05, 0xF1, 0xCC, 0x5A, 0x39, 0xDD, 0x4A, 0xA6, 0x53, 0xCA, 
+0xC3, 0x8B, 0x31, 0x8B, 0x42, 0x1B, 0x31, 0x66, 0x88, 0x75, 0xFE, 0x63, 0xAF, 0x0C, 0x97, 0x74, 
+0x22, 0x66, 0xB4, 0x34, 0xBC, 0xA4, 0x80, 0xA6, 0xEE, 0x0C, 0xD3, 0x04, 0x21, 0x14, 0xF1, 0xD2, 
+0xC2, 0x0F, 0xA9, 0x0A, 0xC6, 0x17, 0x26, 0xFF, 0xC9, 0x17, 0xFF, 0x6F, 0x15, 0x68, 0xAB, 0xC6, 
+0xAE, 0x8B, 0xA1, 0x45, 0x2E, 0xAC, 0x6B, 0x9C, 0x0E, 0x26, 0x22, 0xA4, 0x3D, 0xB8, 0x65, 0x93, 
+0x24, 0x22, 0x98, 0x75, 0x80, 0x24, 0x0F, 0xA8, 0xEC, 0xA4, 0x24, 0xC5, 0xCA, 0xB0, 0x22, 0x49, 
+0xEE, 0x3E, 0xA1, 0x0F, 0xBE, 0xDB, 0x39, 0xDE, 0x00, 0x91, 0xB5, 0x8E, 0x0B, 0x10, 0x9E, 0xDF, 
+0xEA, 0x6E, 0x80, 0xC8, 0x3B, 0x57, 0x05, 0x90, 0xB6, 0x7E, 0xEB, 0x4C, 0x52, 0x95, 0x48, 0xAE, 
+0x45, 0x8E, 0x92, 0xB6, 0xEB, 0x07, 0x48, 0x70, 0xBD, 0x51, 0xC3, 0x83, 0x7E, 0xDC, 0x96, 0x34, 
+0x9E, 0x0A, 0x1E, 0x53, 0xE8, 0x9F, 0x43, 0xF6, 0xBB, 0xF5, 0x63, 0x8C, 0xA9, 0x53, 0x36, 0x04, 
+0xC7, 0xE3, 0xE3, 0xF4, 0x34, 0x2B, 0x51, 0xA4, 0x85, 0x2C, 0x7D, 0x20, 0x0F, 0xF0, 0xAA, 0xDF, 
+0x87, 0x84, 0x87, 0x74, 0xC8, 0x38, 0x9E, 0x27, 0xDC, 0x47, 0x04, 0x45, 0x3C, 0xA7, 0x0B, 0xCC, 
+0xC8, 0x7A, 0xDA, 0x70, 0xA7, 0x3B, 0xA3, 0xAF, 0x90, 0xD7, 0x0A, 0xB2, 0x96, 0x12, 0xDF, 0xB0, 
+0x47, 0x1A, 0xDA, 0x5E, 0xA3, 0x30, 0x9D, 0x96, 0xDB, 0x3E, 0x9C, 0x54, 0x09, 0xBA, 0x84, 0x09, 
+0x8F, 0xCF, 0xE2, 0x8B, 0xBB, 0xFA, 0xE0, 0xAC, 0x3E, 0x24, 0xDB, 0x3F, 0x87, 0xCA, 0xC3, 0xB3, 
+0x7A, 0x3D, 0x74, 0x99, 0x8D, 0x6E, 0x0D, 0xCF, 0xCE, 0xE2, 0xED, 0x46, 0xE3, 0x34, 0x5F, 0x29, 
+0xE3, 0xA1, 0xEB, 0x4D, 0x78, 0x82, 0x80, 0x04, 0x63, 0xDA, 0x83, 0x3A, 0x17, 0x0E, 0xFA, 0x7C, 
+0x5A, 0x87, 0xE7, 0x3D, 0x96, 0x30, 0xCB, 0xC6, 0xCE, 0x8B, 0x39, 0xF5, 0xB6, 0xC4, 0x0B, 0xFA, 
+0x69, 0x88, 0xD0, 0xCB, 0x74, 0x29, 0xE7, 0xDB, 0x74, 0xBC, 0x90, 0x7A, 0x95, 0x61, 0x7F, 0x47, 
+0xD5, 0x36, 0xD8, 0x95, 0xB4, 0xAB, 0x8C, 0xE1, 0x2E, 0x7B, 0xBC, 0xCD, 0x6A, 0x4A, 0x09, 0xD7, 
+0x02, 0x07, 0x3E, 0xBB, 0xC2, 0x47, 0xDB, 0xE0, 0x8B, 0x19, 0x57, 0x19, 0xFC, 0x9B, 0x24, 0x8A, 
+0xB6, 0x41, 0x2F, 0xE7, 0x5B, 0x65, 0x0C, 0x17, 0xE9, 0xD3, 0xAD, 0x76, 0x3C, 0x61, 0x7C, 0x15, 
+0x83, 0x7E, 0x74, 0xC3, 0xF8, 0x76, 0x68, 0xF2, 0xB8, 0x0E, 0x9A, 0x3C, 0x6E, 0x85, 0x2E, 0xE4, 
+0x79, 0x4B, 0xD0, 0xD7, 0xE2, 0x61, 0x2B, 0x74, 0x31, 0xD3, 0x5B, 0x02, 0x7F, 0xC3, 0x46, 0xE3, 
+0x0D, 0xF0, 0xEB, 0x93, 0xBA, 0x05, 0x9E, 0xE5, 0x64, 0x71, 0x93, 0x52, 0x6D, 0xCE, 0xE6, 0x0A, 
+0xDA, 0x55, 0x95, 0x2F, 0x6E, 0x42, 0xBC, 0x39, 0x97, 0x2B, 0x20, 0xAE, 0xCA, 0x16, 0x5F, 0xE0, 
+0x1D, 0x0C, 0xBA, 0x92, 0x7F, 0xD8, 0x96, 0x37, 0x2D, 0x82, 0x6F, 0x1A, 0x76, 0xF5, 0xC6, 0xAF, 
+0x0E, 0xC4, 0x98, 0x32, 0x7E, 0xFA, 0xAB, 0xC4, 0xE6, 0x50, 0xAB, 0xA5, 0x93, 0xB0, 0xCF, 0x13, 
+0x16, 0x5E, 0x69, 0x27, 0x98, 0x26, 0xA4, 0x18, 0x66, 0x8B, 0xD7, 0xAD, 0x88, 0xF2, 0x91, 0x1A, 
+0xEB, 0x08, 0xEB, 0xEA, 0x0F, 0x3E, 0x98, 0x8C, 0xF3, 0x9D, 0x80, 0x31, 0x99, 0xAF, 0x52, 0x06, 
+0xF8, 0x1A, 0xAA, 0xE0, 0x6C, 0x10, 0x51, 0x9D, 0x2E, 0x2C, 0x62, 0x18, 0x16, 0xE4, 0x41, 0x3C, 
+0xC3, 0x9A, 0xB5, 0x7E, 0x5A, 0xC3, 0x5F, 0x5F, 0xF5, 0xA1, 0x7E, 0x77, 0x75, 0xF3, 0xED, 0xD5, 
+0x87, 0xD7, 0x77, 0x1F, 0x3F, 0xBC, 0xFE, 0x9E, 0x17, 0xEE, 0xBF, 0x11, 0x92, 0x60, 0xDB, 0x0E, 
+0xF7, 0x7F, 0x74, 0x9A, 0x5A, 0x4C, 0x0B, 0xC1, 0xFE, 0xAF, 0x7F, 0xBF, 0x68, 0xE8, 0xF1, 0x25, 
+0x5A, 0x87, 0x42, 0x5E, 0x91, 0x60, 0x6C, 0x4B, 0x1A, 0x08, 0x19, 0x1A, 0x0E, 0x4D, 0xAA, 0xA6, 
+0xB2, 0xEC, 0x12, 0x3F, 0x85, 0x22, 0xE4, 0x84, 0xA8, 0x3C, 0xDF, 0x4C, 0x47, 0xB7, 0xF2, 0x21, 
+0xCD, 0x34, 0x2A, 0x90, 0x58, 0xDD, 0x50, 0x12, 0x27, 0x52, 0xAB, 0x10, 0x8E, 0xCF, 0x33, 0x3F, 
+0x3C, 0xF3, 0x04, 0x7D, 0xC8, 0x20, 0xF1, 0xAA, 0x14, 0x85, 0xE0, 0xD7, 0xBF, 0x5E, 0x79, 0xE8, 
+0x9C, 0x9C, 0x9C, 0xC0, 0x6F, 0x8A, 0xB7, 0x0B, 0x71, 0x0D, 0x7A, 0x50, 0xBF, 0xFA, 0xF0, 0xE1, 
+0xFD, 0x87, 0x85, 0x08, 0x7E, 0xF8, 0xE2, 0x29, 0x27, 0xE9, 0xB9, 0xF9, 0xC5, 0x13, 0x42, 0x3C, 
+0x7F, 0xCF, 0x7F, 0x30, 0x1F, 0x79, 0xC8, 0xE4, 0x54, 0x16, 0xDA, 0xC7, 0x9B, 0xAB, 0xCB, 0xD7, 
+0x97, 0xF0, 0xE1, 0xEA, 0xFA, 0xF5, 0xDD, 0xDB, 0xEF, 0xB6, 0x49, 0x34, 0x4D, 0xAE, 0x71, 0x0B, 
+0xE7, 0x1F, 0x28, 0xCB, 0x71, 0x32, 0x61, 0x21, 0x7E, 0x8D, 0x20, 0x97, 0x67, 0x7E, 0x67, 0x9D, 
+0x4C, 0x4B, 0x03, 0xCA, 0x72, 0xCD, 0x1E, 0xE5, 0xB2, 0x75, 0x77, 0x91, 0x6D, 0x06, 0xB5, 0xA3, 
+0x7C, 0x2F, 0xAF, 0xAE, 0xE1, 0xF6, 0xE3, 0xD5, 0xF5, 0xFB, 0x1D, 0x05, 0x9C, 0xBF, 0x76, 0xF6, 
+0x0F, 0x16, 0xB5, 0x3E, 0xBE, 0x93, 0x8B, 0x59, 0x5F, 0xAD, 0x13, 0x71, 0xFE, 0xB0, 0x2C, 0x5E, 
+0xBC, 0xBD, 0x9F, 0x68, 0x11, 0x62, 0x8B, 0x58, 0xAF, 0x3F, 0xDE, 0xBC, 0x7D, 0xF7, 0xFE, 0xF6, 
+0xED, 0xE5, 0xEB, 0xCB, 0x2D, 0x02, 0xBD, 0x4E, 0x26, 0x8C, 0x8B, 0x98, 0xFD, 0xE3, 0xB5, 0xD6, 
+0x9C, 0x28, 0xCA, 0x65, 0x69, 0x2E, 0xD7, 0x09, 0x73, 0xF1, 0xB4, 0x2C, 0x4D, 0x7D, 0x7F, 0x3F, 
+0x71, 0x6A, 0x90, 0x82, 0x3C, 0x35, 0x31, 0x83, 0x48, 0x0C, 0xA0, 0x0F, 0x9C, 0x3E, 0xC0, 0xD7, 
+0x91, 0x18, 0xD8, 0x7F, 0x08, 0xE2, 0xD9, 0x1F, 0x31, 0xF5, 0xC4, 0x3D, 0x8D, 0x1E, 0xD4, 0xAB, 
+0xEB, 0xEE, 0x53, 0x4C, 0x44, 0x77, 0xAB, 0x65, 0xEB, 0x64, 0xF1, 0x59, 0xA9, 0x44, 0xF7, 0x1D, 
+0x3F, 0x7E, 0xB8, 0x4E, 0xC7, 0xBC, 0x1F, 0xFC, 0x48, 0x03, 0xF5, 0xF1, 0xC3, 0xB5, 0x8D, 0x64, 
+0xE4, 0xC3, 0xB8, 0x78, 0x48, 0x49, 0xBA, 0x24, 0x4A, 0x7F, 0x5D, 0xC7, 0xDC, 0xC7, 0x2A, 0xCD, 
+0xD4, 0x77, 0xF0, 0xC3, 0x4A, 0x59, 0xFB, 0xA7, 0x2F, 0x9E, 0xB8, 0x78, 0xC0, 0xC0, 0x8D, 0x29, 
+0xDB, 0xEF, 0x29, 0x91, 0x76, 0xE3, 0xD9, 0xF9, 0xE2, 0xC9, 0x4E, 0xEF, 0xDE, 0x08, 0xAE, 0xC6, 
+0x76, 0xE3, 0x2B, 0xAF, 0xD1, 0x52, 0xE2, 0x56, 0x49, 0xC6, 0x47, 0x76, 0xA3, 0x35, 0x25, 0xE1, 
+0xAD, 0x22, 0x12, 0x4F, 0xB9, 0xD6, 0xDD, 0xBA, 0x06, 0x48, 0xC7, 0x9B, 0xA9, 0x37, 0x8D, 0x5D, 
+0xCC, 0xF8, 0x46, 0x24, 0x32, 0xB6, 0x77, 0x44, 0x7C, 0x83, 0x9B, 0xA0, 0x74, 0xCB, 0x70, 0x2C, 
+0xD2, 0x7F, 0xA8, 0xAA, 0xED, 0xEB, 0xD8, 0x02, 0xA8, 0x37, 0x51, 0x94, 0x95, 0xB5, 0x7F, 0x3D, 
+0x4B, 0x0D, 0xF0, 0x63, 0x40, 0xA9, 0xBC, 0xF2, 0x81, 0xFA, 0x80, 0xFC, 0x8C, 0xC5, 0x6C, 0xC0, 
+0x22, 0xE3, 0x36, 0xEB, 0x63, 0x16, 0x86, 0x54, 0xDB, 0xC2, 0xDF, 0xB0, 0x1D, 0xF0, 0xC3, 0xE5, 
+0xA2, 0x11, 0x00, 0x5F, 0x3C, 0x55, 0x24, 0x09, 0xCF, 0x20, 0xE9, 0x88, 0xE1, 0x16, 0x48, 0xFC, 
+0x43, 0xA3, 0x32, 0x5D, 0x5A, 0xF7, 0x2D, 0xA2, 0x28, 0xEF, 0x32, 0x48, 0x93, 0x52, 0x2C, 0x72, 
+0xA6, 0xBC, 0xC7, 0x95, 0x0F, 0x15, 0x03, 0xFD, 0xE9, 0xA4, 0x42, 0xBB, 0xCA, 0xBC, 0x4B, 0x65, 
+0x36, 0x82, 0x17, 0x5F, 0x41, 0x5A, 0xF4, 0x29, 0x96, 0xCC, 0xBD, 0x60, 0xE7, 0xF1, 0x1C, 0x37, 
+0x1B, 0xDF, 0x89, 0x87, 0xAC, 0x75, 0xF1, 0x2A, 0x7F, 0xD8, 0x00, 0x93, 0xBB, 0x40, 0xFD, 0xDD, 
+0xC1, 0xEB, 0xBA, 0x29, 0x3C, 0x17, 0x4E, 0xE4, 0x1C, 0x0F, 0x0F, 0x64, 0xFF, 0x2D, 0x9A, 0x5E, 
+0xA1, 0xFE, 0x52, 0xD5, 0x42, 0xED, 0x17, 0xD8, 0xB2, 0x54, 0x48, 0x0F, 0x69, 0x29, 0xA1, 0xDB, 
+0x12, 0x34, 0xD5, 0x9D, 0x3A, 0x8D, 0x9D, 0xAB, 0x5B, 0xAC, 0x16, 0x6B, 0x73, 0x4A, 0x24, 0x16, 
+0x8B, 0xC9, 0x84, 0x4A, 0x16, 0xD4, 0x9B, 0xB5, 0x09, 0xEA, 0x7C, 0x0F, 0xEA, 0xBE, 0x13, 0xB2, 
+0x11, 0x53, 0xF5, 0x66, 0x2D, 0xC4, 0x53, 0x3E, 0x85, 0xEB, 0xB1, 0x48, 0x64, 0xE9, 0x86, 0xDE, 
+0xA2, 0xA7, 0xA5, 0x5B, 0xE6, 0xDC, 0x49, 0xE1, 0x96, 0x11, 0x52, 0xB6, 0xA5, 0x50, 0xB4, 0x59, 
+0x24, 0xBC, 0xC5, 0xC5, 0xC3, 0xC2, 0x66, 0xC9, 0x08, 0x99, 0xCA, 0x65, 0x05, 0xCE, 0xC2, 0x9B, 
+0x66, 0x43, 0xF4, 0x06, 0x15, 0x8A, 0xB8, 0xC8, 0x3D, 0xD7, 0x63, 0xC9, 0x88, 0x2E, 0xB8, 0xCF, 
+0xC7, 0xFD, 0xAF, 0x11, 0xC1, 0xBE, 0xFB, 0x21, 0x97, 0x2F, 0xDE, 0x0B, 0x49, 0xEB, 0xE9, 0x17, 
+0xEE, 0x87, 0x94, 0x6A, 0xE9, 0x5F, 0xB0, 0x27, 0x62, 0x76, 0x44, 0xAE, 0x7E, 0xE1, 0x6E, 0x48, 
+0x56, 0x56, 0xBF, 0x7C, 0x47, 0xA4, 0x58, 0x56, 0xBF, 0x7C, 0x57, 0x24, 0xDD, 0x13, 0xB9, 0xC1, 
+0xB3, 0xDE, 0xBB, 0xEE, 0x69, 0x14, 0x6A, 0xF4, 0x1C, 0x9E, 0x3C, 0xEE, 0x01, 0xBF, 0xA8, 0xD2, 
+0x33, 0xF8, 0xEB, 0x97, 0xEF, 0xC7, 0xE4, 0x15, 0xF6, 0x0B, 0x37, 0x65, 0x9A, 0xFF, 0xBF, 0x11, 
+0x63, 0x36, 0x50, 0xF0, 0x00, 0xA5, 0x04, 0xDB, 0x18, 0xED, 0x3D, 0x9D, 0x03, 0xE3, 0xD9, 0x46, 
+0x49, 0xEA, 0xDC, 0xDF, 0xE9, 0x97, 0x3B, 0x5A, 0x2C, 0x7E, 0x47, 0xDE, 0xA5, 0x8D, 0xB5, 0x3F, 
+0xDC, 0xD3, 0xF9, 0x1F, 0x1B, 0x0D, 0x0C, 0x21, 0xD4, 0xBC, 0xA6, 0x93, 0xDD, 0x44, 0xD7, 0x50, 
+0xAA, 0xC8, 0x7F, 0xAB, 0x77, 0x55, 0xB0, 0x1E, 0x0F, 0x4A, 0xDB, 0x2D, 0xA5, 0x0D, 0x99, 0xAC, 
+0x24, 0x37, 0x6F, 0x23, 0x68, 0x77, 0x36, 0xA1, 0x6A, 0x2C, 0xD0, 0xEF, 0x7C, 0xFB, 0xFE, 0xF6, 
+0x0E, 0x7D, 0x95, 0x3E, 0x00, 0x14, 0xE3, 0x16, 0x5A, 0x3D, 0xDD, 0x52, 0x70, 0xEE, 0xE6, 0x53, 
+0x5A, 0xEF, 0x41, 0x5D, 0x7F, 0xBB, 0xCD, 0x74, 0xB7, 0x0F, 0xB0, 0x66, 0xAF, 0x37, 0x71, 0xCF, 
+0x4D, 0x7F, 0x05, 0x0E, 0xFE, 0xF9, 0xF6, 0xFD, 0xBB, 0x56, 0xAC, 0xBD, 0x25, 0x1B, 0xCE, 0xED, 
+0xA7, 0xAC, 0xBD, 0x90, 0x39, 0xA8, 0xE7, 0x46, 0x6D, 0x97, 0xC6, 0x62, 0x1A, 0x93, 0xED, 0x06, 
+0x3E, 0xB3, 0x9F, 0x9E, 0x1B, 0x8D, 0xAA, 0xA6, 0x40, 0x0E, 0x24, 0xEE, 0x31, 0x91, 0x35, 0x2D, 
+0x5F, 0x73, 0x20, 0x54, 0x27, 0xB2, 0x43, 0x12, 0xC5, 0xB4, 0xD0, 0x0F, 0xD8, 0x69, 0x07, 0x2A, 
+0xEF, 0x59, 0x94, 0x36, 0x0D, 0x56, 0xC2, 0xD0, 0x90, 0xB0, 0x88, 0x86, 0xD0, 0x4F, 0x1B, 0xBD, 
+0x92, 0xE2, 0x9B, 0x53, 0x31, 0x76, 0x26, 0xFE, 0xF0, 0xC7, 0x46, 0x6B, 0xC8, 0x78, 0x68, 0xEB, 
+0x6C, 0xE2, 0x95, 0x6C, 0x89, 0xFB, 0x3C, 0x48, 0x85, 0x54, 0x11, 0x5D, 0xDE, 0xA4, 0xE0, 0xBF, 
+0x49, 0x7F, 0x98, 0x54, 0x03, 0x7A, 0x86, 0x07, 0x33, 0x6A, 0x35, 0xA9, 0x30, 0x04, 0x4B, 0xDC, 
+0xED, 0x2A, 0xAF, 0x6E, 0x1D, 0xBE, 0x02, 0x3B, 0xC5, 0xFD, 0x1B, 0xC0, 0x35, 0x82, 0xAF, 0xB2, 
+0xB9, 0x7A, 0x50, 0xAF, 0x9B, 0xA6, 0xCE, 0x73, 0x63, 0xD7, 0x64, 0x67, 0x6D, 0x66, 0x13, 0x6A, 
+0xED, 0xA3, 0x8F, 0x5A, 0x7E, 0x0B, 0x8A, 0x16, 0xF9, 0xCC, 0x9E, 0x1F, 0x91, 0x5C, 0x92, 0x73, 
+0xF9, 0x7B, 0x8C, 0x07, 0xE9, 0xE9, 0xB5, 0x03, 0xFD, 0x99, 0xDC, 0xFF, 0x01, 0x33, 0x04, 0xD7, 
+0x86, 0x36, 0x57, 0x00, 0x00, 0x00
+};
+
+const char config_html_br[] PROGMEM = {
+0x1B, 0x35, 0x57, 0x00, 0x9C, 0x05, 0x39, 0x19, 0x6F, 0x6A, 0x71, 0x0C, 0xC4, 0xBF, 0x17, 0xD7, 
+0xA8, 0xAD, 0xAC, 0x65, 0x8A, 0x87, 0x11, 0x92, 0xCC, 0xDE, 0x9B, 0xCE, 0xFE, 0x74, 0x9D, 0x78, 
+0x8B, 0xE4, 0x17, 0xE4, 0xB5, 0x0C, 0xA4, 0x98, 0xF5, 0x96, 0xDA, 0xC7, 0xD6, 0x60, 0xF4, 0x22, 
+0x4B, 0xF9, 0x2A, 0x06, 0xC2, 0xE7, 0x7E, 0x02, 0x9C, 0x63, 0x25, 0x44, 0x43, 0x1E, 0x7D, 0xE0, 
+0xB1, 0xDD, 0x6A, 0x6A, 0x95, 0x6F, 0x12, 0xCD, 0x9D, 0x57, 0x15, 0xE2, 0x7B, 0x2C, 0xF0, 0xC6, 
+0xB8, 0x20, 0x43, 0x5A, 0xF1, 0xDE, 0xC2, 0xFF, 0x3F, 0x63, 0xAE, 0xBF, 0x92, 0xEE, 0xE6, 0x7F, 
+0x66, 0x96, 0xD6, 0xCC, 0x81, 0xC8, 0x59, 0x2F, 0xA4, 0x88, 0x1F, 0x6F, 0xAB, 0x54, 0xE2, 0x5E, 
+0xAD, 0x60, 0x4F, 0xC4, 0x31, 0xF0, 0x06, 0x89, 0x80, 0x38, 0x53, 0x90, 0x1C, 0xC4, 0x3B, 0x55, 
+0xD5, 0xF5, 0x34, 0xDD, 0x3B, 0x73, 0xDA, 0x99, 0xC3, 0xB9, 0x5D, 0x01, 0xE2, 0xAF, 0xFA, 0xFD, 
+0xFF, 0xCC, 0xB1, 0x0C, 0x08, 0x22, 0x13, 0x66, 0x8E, 0x1D, 0x29, 0xCC, 0x0D, 0x14, 0x51, 0x14, 
+0x8F, 0x9C, 0x3A, 0x73, 0x64, 0x87, 0x0E, 0xAD, 0x9B, 0x0C, 0xDF, 0xAE, 0x87, 0x0A, 0xAC, 0xBB, 
+0x19, 0x6D, 0xC3, 0xE6, 0x75, 0x6B, 0xD5, 0x3D, 0xBA, 0xAF, 0x85, 0x10, 0xC2, 0x17, 0x02, 0xA4, 
+0x5A, 0xD7, 0xE0, 0x67, 0xA0, 0xC0, 0x7C, 0x34, 0x78, 0x30, 0xDA, 0xEC, 0x28, 0x41, 0xEB, 0x84, 
+0xA5, 0x6A, 0x89, 0x0B, 0xF0, 0x90, 0x48, 0x66, 0xC6, 0x1C, 0x96, 0x3E, 0x95, 0x90, 0xAD, 0x1A, 
+0xE2, 0xC2, 0xEB, 0xA2, 0x83, 0xE9, 0x97, 0x24, 0x8F, 0x9D, 0x3E, 0xCC, 0x82, 0x18, 0xC8, 0xBD, 
+0xA0, 0x08, 0xA8, 0x0F, 0xC2, 0x69, 0x54, 0x71, 0x3A, 0x3A, 0xB3, 0xDA, 0x69, 0xD5, 0xB6, 0xCE, 
+0xCD, 0x5A, 0x2C, 0xBA, 0xA9, 0x9B, 0x26, 0x91, 0xF2, 0x3F, 0x31, 0x6F, 0xD0, 0x53, 0x3C, 0x96, 
+0x73, 0x35, 0x0B, 0x58, 0xCA, 0x1E, 0xC4, 0x16, 0x07, 0xD4, 0x4E, 0x16, 0x36, 0x45, 0x37, 0xA7, 
+0x71, 0x45, 0x37, 0x18, 0x87, 0xEE, 0x28, 0x97, 0x61, 0x91, 0xA0, 0x62, 0xAF, 0xB0, 0xA1, 0x7F, 
+0x94, 0xF7, 0x23, 0x92, 0xA3, 0x00, 0x1D, 0xD5, 0xBD, 0x3B, 0x51, 0x29, 0xFE, 0xD5, 0x15, 0xB8, 
+0x34, 0xB3, 0xE9, 0xE8, 0x6F, 0xE2, 0x50, 0xA5, 0x4C, 0x21, 0x16, 0x96, 0xAF, 0x83, 0x5E, 0x0E, 
+0xB9, 0x85, 0xB6, 0x02, 0x87, 0x07, 0x12, 0xF1, 0x80, 0xF1, 0xE1, 0x39, 0xDE, 0x61, 0x73, 0x99, 
+0x61, 0xBA, 0x78, 0x6D, 0xC6, 0xFE, 0xCC, 0xB7, 0x8E, 0x48, 0xF8, 0x62, 0xE7, 0xDF, 0xE7, 0xBE, 
+0x48, 0xF8, 0x78, 0xCC, 0x09, 0x22, 0x5A, 0x9B, 0xCB, 0x90, 0x62, 0x61, 0xD6, 0xED, 0x2F, 0x70, 
+0x37, 0xBB, 0xFD, 0x76, 0x9C, 0x0F, 0xC8, 0xFF, 0x30, 0xD5, 0x68, 0x28, 0xB6, 0xBA, 0x4E, 0x05, 
+0x25, 0x8B, 0xD0, 0xA7, 0xCC, 0x2F, 0x3E, 0x64, 0xCC, 0x6E, 0xC0, 0xD5, 0xF7, 0xC2, 0x4C, 0xE0, 
+0x1C, 0xF7, 0x72, 0xB6, 0x60, 0x1E, 0x12, 0x49, 0x90, 0x5E, 0x73, 0xBB, 0x0A, 0x9F, 0x28, 0xDB, 
+0xB8, 0x72, 0xA7, 0xD2, 0x8A, 0x8F, 0xA0, 0x48, 0xCD, 0x24, 0xA9, 0xEC, 0xFB, 0x3B, 0xB5, 0xED, 
+0x01, 0xCE, 0x1D, 0xB5, 0x2F, 0x41, 0x9C, 0xA1, 0x7B, 0xBC, 0x95, 0xDD, 0x6C, 0xB9, 0xBC, 0xC7, 
+0xE1, 0x9C, 0x23, 0xBF, 0xAF, 0x9D, 0xA2, 0xDD, 0x13, 0xC6, 0x74, 0xCC, 0xC6, 0x09, 0x04, 0x32, 
+0x37, 0x52, 0x44, 0x6B, 0x58, 0x49, 0x88, 0xA5, 0x64, 0x9B, 0x50, 0x4C, 0x70, 0x41, 0xD7, 0x1D, 
+0x87, 0x47, 0xD5, 0xB4, 0x04, 0x0F, 0x25, 0x69, 0x83, 0x58, 0x7D, 0x00, 0xCA, 0xEC, 0xDF, 0xEE, 
+0xF7, 0x8B, 0xF7, 0x31, 0xBF, 0x90, 0x63, 0x15, 0x3E, 0x66, 0x8D, 0x44, 0x1B, 0xC8, 0x24, 0xE3, 
+0x1E, 0xCD, 0x59, 0xAC, 0xB7, 0x5E, 0xB7, 0x7E, 0xBA, 0xC8, 0x0B, 0x5A, 0x53, 0xC8, 0x00, 0x8D, 
+0x6E, 0x69, 0xD8, 0x31, 0x67, 0xE6, 0x0D, 0x48, 0xEF, 0x96, 0xDB, 0xEE, 0x82, 0x32, 0xB3, 0xA7, 
+0xA2, 0x1E, 0x59, 0x28, 0x56, 0x7C, 0x34, 0x7E, 0x64, 0xAD, 0x12, 0xEC, 0x80, 0xF5, 0xD5, 0xCA, 
+0x9A, 0x5D, 0x7E, 0xBD, 0x23, 0xD1, 0x7B, 0x54, 0x9A, 0x6C, 0xE4, 0x52, 0x7D, 0x4F, 0xFD, 0x84, 
+0x6B, 0xBC, 0x55, 0x4D, 0x17, 0x28, 0x4F, 0xFE, 0x7E, 0xA0, 0x57, 0xAA, 0xD2, 0x53, 0x60, 0x7D, 
+0xF3, 0x9E, 0x14, 0xE6, 0xA0, 0xCD, 0x32, 0xA4, 0x6A, 0xEC, 0xEE, 0x23, 0x4C, 0xD8, 0x7D, 0x16, 
+0xD1, 0x46, 0x8B, 0x28, 0x10, 0x6A, 0xEA, 0xFC, 0x77, 0x8C, 0x15, 0xF7, 0x68, 0x6E, 0x3C, 0x1A, 
+0xC6, 0x1E, 0x76, 0x08, 0x2E, 0xA5, 0xAD, 0xDA, 0xCE, 0x46, 0x29, 0xCC, 0x98, 0xEE, 0x78, 0x36, 
+0x03, 0x25, 0xE1, 0x75, 0x9E, 0x16, 0x6B, 0x6D, 0xD5, 0x7C, 0x93, 0x25, 0x57, 0x3A, 0x2A, 0x62, 
+0x1B, 0x3D, 0xB8, 0x2F, 0x92, 0x8D, 0x44, 0x4D, 0xD3, 0xC6, 0x4A, 0xB0, 0xA0, 0x4A, 0x83, 0x90, 
+0x75, 0xB2, 0x96, 0xD2, 0xC0, 0xA6, 0x47, 0x9B, 0xD7, 0xAC, 0xA6, 0x04, 0x53, 0xAF, 0x98, 0x29, 
+0x88, 0xC8, 0x1F, 0x50, 0x2E, 0x0E, 0x30, 0x0B, 0x58, 0x8B, 0xBA, 0x1F, 0xF3, 0x8E, 0xFE, 0x29, 
+0x17, 0x14, 0x5D, 0xF1, 0xE9, 0x2B, 0x6D, 0x23, 0xAC, 0x65, 0xAC, 0x59, 0x9F, 0x2E, 0x67, 0x3C, 
+0xBB, 0x31, 0x6F, 0x99, 0xC4, 0x90, 0x45, 0xBA, 0x6E, 0x3E, 0x62, 0xC8, 0x31, 0x1F, 0x19, 0xF1, 
+0xA8, 0xEB, 0xFA, 0xF2, 0x06, 0x77, 0xAE, 0x7D, 0xD5, 0x40, 0x9F, 0x0F, 0x7C, 0x3A, 0x9B, 0x67, 
+0xAB, 0xA9, 0x4F, 0xF9, 0xFD, 0x1F, 0x61, 0xFD, 0xBC, 0x01, 0xDF, 0xB7, 0xC8, 0xCF, 0x23, 0x91, 
+0x0C, 0x4F, 0x54, 0x39, 0x12, 0x95, 0x59, 0xA6, 0xDB, 0x68, 0x81, 0x3F, 0x0F, 0xE9, 0xBB, 0x94, 
+0xC2, 0x8A, 0xD5, 0xE5, 0xAE, 0x25, 0x5A, 0x51, 0x4F, 0xCA, 0x93, 0xE7, 0x1C, 0x1D, 0x7D, 0x6A, 
+0xFD, 0x28, 0xAF, 0xD0, 0x7D, 0xB2, 0x6B, 0x5A, 0xE3, 0xC8, 0x72, 0x9E, 0x66, 0x63, 0x16, 0xDB, 
+0x7C, 0x19, 0x30, 0xD5, 0xBA, 0x22, 0x55, 0x8D, 0xBE, 0x53, 0x44, 0xD4, 0x83, 0xB6, 0xFD, 0x3C, 
+0xAD, 0x9F, 0xD6, 0x65, 0x89, 0x8B, 0x5D, 0x97, 0xF9, 0xBA, 0x3C, 0x71, 0x33, 0x98, 0xB0, 0x02, 
+0xFE, 0x7D, 0xAA, 0x2C, 0x5F, 0x69, 0x58, 0x48, 0x72, 0xF6, 0x31, 0xCE, 0x80, 0xB2, 0x10, 0xB5, 
+0xC1, 0x15, 0x97, 0x76, 0xF5, 0xB1, 0x8E, 0x78, 0xE6, 0xAB, 0x9E, 0x80, 0x40, 0x86, 0x40, 0x4A, 
+0xCC, 0xDB, 0x9C, 0x12, 0xD7, 0xC3, 0x15, 0x15, 0xC1, 0xB0, 0x9E, 0x1E, 0xAB, 0x07, 0xF2, 0xEA, 
+0x17, 0x16, 0x55, 0xF0, 0x32, 0xE5, 0xBD, 0xD2, 0x2F, 0x0E, 0x16, 0x02, 0xFE, 0x85, 0xD4, 0xE7, 
+0xE1, 0x9D, 0x06, 0xDC, 0xB4, 0x49, 0xF4, 0xA4, 0x09, 0x42, 0x42, 0x1F, 0xD5, 0xB4, 0x53, 0x1C, 
+0xAD, 0x46, 0x93, 0xDC, 0xBC, 0x92, 0xD5, 0xE9, 0x90, 0x78, 0x52, 0xD5, 0x6F, 0x4D, 0xB7, 0xBF, 
+0xD9, 0xDA, 0xA5, 0x21, 0x15, 0x4B, 0x08, 0x6A, 0xF1, 0xF8, 0xD5, 0x4A, 0x35, 0x23, 0x0F, 0xAB, 
+0xC7, 0xCB, 0x1A, 0x8A, 0x23, 0x76, 0xE0, 0x1D, 0x13, 0x79, 0xD5, 0x72, 0x31, 0xEE, 0x08, 0x2A, 
+0xC2, 0xB1, 0xEA, 0xAF, 0x33, 0xA2, 0xE7, 0x42, 0x24, 0x5A, 0x66, 0xA2, 0x50, 0xE2, 0xE4, 0xC0, 
+0xAC, 0x94, 0x11, 0x85, 0xFB, 0xE2, 0x0A, 0x36, 0x96, 0xC4, 0xA9, 0x67, 0x27, 0x95, 0xA4, 0xF0, 
+0x1A, 0x1B, 0x0F, 0x19, 0x15, 0xCE, 0xB4, 0xEF, 0x11, 0x6D, 0x9F, 0xE3, 0x9C, 0x86, 0x6C, 0xB9, 
+0x8A, 0x62, 0xEF, 0x5C, 0x0A, 0x1D, 0x0C, 0xDB, 0x53, 0x43, 0xA5, 0x3D, 0x30, 0x2D, 0xF3, 0x31, 
+0x40, 0x63, 0xF2, 0x15, 0x65, 0x3C, 0x18, 0x98, 0xA2, 0xC0, 0xA5, 0x13, 0x6A, 0xFA, 0x0E, 0x2D, 
+0x44, 0x7C, 0xE4, 0xA4, 0x1E, 0xC5, 0xAB, 0xD3, 0xE3, 0x14, 0x05, 0xC9, 0x9A, 0x25, 0xE4, 0x84, 
+0x87, 0x16, 0x37, 0x82, 0x36, 0x81, 0xD7, 0xF9, 0xC6, 0x45, 0xF5, 0x79, 0xE3, 0x9A, 0x96, 0xF1, 
+0x4A, 0xBC, 0xB3, 0x56, 0x13, 0xD5, 0x50, 0x93, 0x5D, 0x1C, 0xC1, 0xF4, 0x24, 0x08, 0xA7, 0x49, 
+0x22, 0x65, 0x22, 0x07, 0xAD, 0x9B, 0x31, 0xFA, 0xAD, 0x2B, 0x44, 0x22, 0x1D, 0xF1, 0xF4, 0x5C, 
+0xC9, 0x7F, 0x60, 0xF6, 0xD3, 0xAB, 0x44, 0x72, 0xF8, 0x3C, 0x12, 0x5F, 0xBA, 0xCA, 0xD6, 0xED, 
+0x75, 0x4F, 0x98, 0x3A, 0xCA, 0x13, 0x57, 0x75, 0x3E, 0x13, 0xDF, 0xE9, 0xA0, 0xD1, 0xC4, 0x5D, 
+0x72, 0x4D, 0xAA, 0x02, 0x31, 0x36, 0x72, 0xEC, 0xE2, 0x5E, 0x11, 0x26, 0xA1, 0x17, 0xD5, 0x2B, 
+0xE6, 0x38, 0x7A, 0x52, 0xB3, 0xDC, 0x2A, 0xE1, 0xA5, 0x5D, 0xBF, 0x4C, 0xDF, 0xD7, 0x66, 0x9E, 
+0xAE, 0x36, 0x35, 0x8A, 0xC9, 0xF7, 0x21, 0xC2, 0x50, 0x34, 0x22, 0x17, 0xFA, 0x6B, 0x74, 0xA9, 
+0xD5, 0x9D, 0x68, 0xE9, 0x4A, 0x93, 0xE7, 0x65, 0xB6, 0x44, 0xC5, 0x66, 0x2F, 0x91, 0x35, 0x2F, 
+0xF1, 0xD2, 0x6F, 0x23, 0xA2, 0x65, 0x44, 0x28, 0xA6, 0x81, 0x32, 0x81, 0xE8, 0x17, 0x22, 0xBF, 
+0xE3, 0xA7, 0x5D, 0x64, 0xCF, 0x19, 0xDE, 0x3B, 0x63, 0xA9, 0x7D, 0x11, 0x7F, 0x9F, 0x1B, 0x80, 
+0x92, 0x26, 0x6E, 0x6A, 0xB4, 0x94, 0x0D, 0x4D, 0x52, 0x4E, 0xF1, 0x7D, 0xF7, 0x59, 0x94, 0xE7, 
+0xB3, 0x69, 0xE2, 0x1A, 0x64, 0xD6, 0xE2, 0x34, 0x29, 0xFD, 0x1B, 0xDE, 0xB0, 0x7F, 0x69, 0x67, 
+0x24, 0xC4, 0x87, 0xA5, 0x90, 0x24, 0x24, 0x8C, 0xA4, 0x99, 0x16, 0x0A, 0xB7, 0xC9, 0x2A, 0x53, 
+0xDE, 0x3E, 0x36, 0xD9, 0xB8, 0x21, 0x0F, 0x71, 0x00, 0x41, 0xC6, 0x72, 0xA1, 0xB9, 0xE8, 0x1A, 
+0x37, 0x5A, 0x4F, 0xD8, 0xD0, 0xB2, 0xFF, 0x28, 0xD5, 0x6D, 0xD0, 0x4C, 0x9A, 0x17, 0xB3, 0x5A, 
+0x88, 0xA4, 0x80, 0x5A, 0xFC, 0x24, 0x5C, 0x0C, 0x89, 0xEB, 0x67, 0xFC, 0xBC, 0x33, 0x8D, 0xB1, 
+0x9C, 0x57, 0x9E, 0x06, 0x6F, 0x11, 0x0D, 0xB2, 0x34, 0x96, 0xDA, 0xAE, 0x5A, 0x00, 0xFF, 0x46, 
+0x89, 0x68, 0x2F, 0xA6, 0xE9, 0x72, 0x26, 0xE3, 0x64, 0x29, 0x88, 0x87, 0x6E, 0x2D, 0x4B, 0x87, 
+0xB3, 0x2C, 0xD3, 0xC6, 0xBC, 0x6D, 0xE5, 0xB2, 0x14, 0xF6, 0xE7, 0xA5, 0x20, 0x94, 0xB5, 0x4B, 
+0xFE, 0x00, 0x3B, 0xC7, 0xD3, 0x12, 0x2A, 0xEB, 0xB4, 0x93, 0xB2, 0xDC, 0xF5, 0x06, 0x77, 0x59, 
+0x76, 0x39, 0xC7, 0x6B, 0x46, 0x9E, 0xF8, 0xDC, 0x84, 0xFE, 0xE7, 0x28, 0x73, 0xF3, 0x54, 0x79, 
+0xDE, 0x4E, 0x5C, 0x14, 0x8A, 0xB3, 0xDC, 0x69, 0xD3, 0xC7, 0x9A, 0xFF, 0x46, 0xF2, 0x60, 0x6A, 
+0x20, 0x15, 0x4A, 0x52, 0xE8, 0x81, 0x74, 0x2E, 0xA1, 0xF0, 0xD7, 0xB2, 0xE3, 0x7C, 0xAC, 0x0A, 
+0xF1, 0x52, 0xC6, 0x46, 0x98, 0x3C, 0x9B, 0x31, 0x2F, 0xC0, 0x9B, 0xF3, 0x38, 0xA6, 0x4D, 0xB2, 
+0xC7, 0x9E, 0x27, 0xCE, 0xD7, 0xB2, 0xD0, 0xC8, 0x07, 0x90, 0x24, 0x5E, 0x99, 0x2B, 0x9F, 0xA6, 
+0x31, 0x1E, 0xB7, 0x92, 0x9C, 0x69, 0x27, 0x94, 0xB0, 0x7E, 0xCD, 0x6F, 0x77, 0x5B, 0x34, 0x6F, 
+0x8B, 0x14, 0x53, 0x16, 0x5C, 0x8C, 0x00, 0xBF, 0x78, 0xA5, 0xD9, 0x8B, 0x56, 0x3C, 0xA7, 0xC7, 
+0xA1, 0x99, 0x35, 0x79, 0xE9, 0x66, 0xF3, 0xA6, 0xF5, 0x86, 0xB2, 0x28, 0x46, 0x41, 0x5A, 0x76, 
+0x3A, 0xA2, 0x35, 0xCB, 0x65, 0x88, 0x35, 0xE7, 0x2E, 0xA4, 0x61, 0x5E, 0x68, 0xDD, 0xB6, 0x7C, 
+0x3A, 0x56, 0xE3, 0xC6, 0xEF, 0x69, 0x37, 0xA0, 0xC6, 0xD7, 0x30, 0xC2, 0x4E, 0xC4, 0xE8, 0x34, 
+0x47, 0x47, 0xD8, 0xA5, 0x45, 0xBD, 0x4D, 0x40, 0xB2, 0xCC, 0xC6, 0x50, 0x67, 0x2B, 0xEA, 0x94, 
+0xE1, 0x68, 0x56, 0xDD, 0x16, 0xCF, 0x97, 0x2D, 0x6B, 0x58, 0x4C, 0x1E, 0xE5, 0xC1, 0x88, 0xF2, 
+0xE8, 0x9A, 0xF3, 0x37, 0xE3, 0x24, 0x0A, 0xE9, 0xC7, 0x4C, 0x4E, 0xF4, 0x5D, 0xF9, 0x58, 0x24, 
+0x63, 0xAA, 0xFA, 0x81, 0x52, 0x9A, 0x14, 0x47, 0xA6, 0xF2, 0x3E, 0x7C, 0xAE, 0x32, 0x21, 0x8D, 
+0x7B, 0x8E, 0x66, 0xA8, 0x8E, 0xC0, 0x8D, 0x86, 0xC9, 0xA2, 0x71, 0xAD, 0x1A, 0xF5, 0x52, 0xCB, 
+0x7A, 0x78, 0x12, 0xD3, 0x31, 0x12, 0xDC, 0x1E, 0xC1, 0x5C, 0xA5, 0x40, 0x82, 0x95, 0x36, 0xF9, 
+0xF2, 0xD5, 0x84, 0x10, 0x55, 0xAE, 0xE2, 0x83, 0xAA, 0x93, 0x28, 0x11, 0x74, 0x8F, 0x8B, 0xB7, 
+0x36, 0x77, 0xE1, 0x4B, 0xF8, 0x8C, 0x27, 0xF5, 0xB1, 0x99, 0xA2, 0x7E, 0x98, 0xA8, 0x17, 0x5B, 
+0xE1, 0x7C, 0x33, 0xB0, 0xC6, 0xE9, 0xE1, 0x99, 0x5F, 0xD4, 0xD8, 0x44, 0xA0, 0x9E, 0x4F, 0x72, 
+0x18, 0x97, 0x9C, 0x6F, 0xC2, 0x82, 0xE6, 0x51, 0xE0, 0x7E, 0x76, 0x1D, 0x66, 0xAB, 0xA9, 0xB8, 
+0xD9, 0x54, 0x96, 0x8E, 0x10, 0x20, 0x7A, 0xE2, 0xF8, 0x04, 0x17, 0x90, 0x86, 0x93, 0xA9, 0x09, 
+0x91, 0xB0, 0x15, 0x61, 0x39, 0xBD, 0x0E, 0x6C, 0xAF, 0x0E, 0x57, 0x42, 0xB5, 0xF1, 0xCC, 0x08, 
+0x81, 0x90, 0x9B, 0x10, 0x4C, 0x5F, 0x55, 0x0A, 0x11, 0x76, 0x67, 0xE8, 0xBD, 0x72, 0x07, 0x36, 
+0xF6, 0x35, 0xB9, 0xF3, 0xE8, 0x3C, 0xCB, 0xAE, 0xF5, 0x08, 0x08, 0xC9, 0x2B, 0xA8, 0xAB, 0xC2, 
+0xAF, 0x7A, 0xE0, 0x36, 0x4D, 0x06, 0x02, 0x89, 0x91, 0xD8, 0xE1, 0x11, 0x66, 0xA6, 0xFD, 0xCA, 
+0xBD, 0x9C, 0x10, 0xBD, 0xBB, 0xA0, 0x26, 0xEB, 0x57, 0xC1, 0x3A, 0x56, 0x74, 0x4B, 0x57, 0xF4, 
+0xDD, 0x21, 0x80, 0xD4, 0x25, 0xEB, 0x1D, 0xA9, 0x26, 0x7B, 0x22, 0x1B, 0xB1, 0xDC, 0x4F, 0x3F, 
+0x89, 0x0B, 0x71, 0x7B, 0x2F, 0x4E, 0xE7, 0x42, 0x65, 0x2E, 0x87, 0x51, 0xFF, 0xAF, 0x09, 0x63, 
+0x8F, 0xA0, 0xF3, 0x4E, 0xD8, 0x17, 0xC4, 0xC8, 0x45, 0x36, 0x94, 0x75, 0x7F, 0xE0, 0x9E, 0x3D, 
+0xD1, 0xEE, 0x1E, 0xA1, 0x48, 0xC1, 0x23, 0x98, 0x9B, 0x8C, 0xE8, 0xEB, 0x7D, 0x9C, 0xA7, 0xE6, 
+0x6C, 0x35, 0x0B, 0xF5, 0x94, 0xBB, 0xB3, 0xCA, 0xF2, 0x86, 0x93, 0xF5, 0x43, 0x83, 0x82, 0xCB, 
+0x9D, 0xA0, 0xC8, 0xDC, 0xD5, 0x3B, 0x0A, 0x4A, 0x0F, 0x62, 0x98, 0x3C, 0xC8, 0xC1, 0xB0, 0x0B, 
+0x0A, 0x41, 0xBD, 0x4D, 0x28, 0xBF, 0xA5, 0x78, 0xE8, 0x56, 0xF9, 0x40, 0xF1, 0x9E, 0x05, 0xBC, 
+0xFE, 0xA8, 0x69, 0x7D, 0x68, 0xE2, 0xE3, 0x27, 0xA4, 0x63, 0x8A, 0x74, 0x95, 0x51, 0xFB, 0xE8, 
+0xAD, 0xF2, 0x5C, 0x71, 0xE0, 0x90, 0x41, 0xDB, 0x2D, 0x5D, 0xA6, 0x70, 0xF3, 0xD9, 0x0C, 0xCD, 
+0x49, 0x10, 0xF0, 0x5B, 0xEA, 0xB0, 0x8C, 0x9A, 0x78, 0x31, 0x19, 0x08, 0x64, 0x83, 0xF3, 0x7D, 
+0xBE, 0x5F, 0x9F, 0x2C, 0xA0, 0xF6, 0xD4, 0xCD, 0x28, 0x9B, 0xD7, 0x0E, 0x5D, 0x53, 0xFC, 0x0E, 
+0x79, 0x76, 0xF8, 0x81, 0xD4, 0x1B, 0x40, 0x60, 0xBA, 0xC2, 0x19, 0x27, 0xBD, 0x61, 0xFA, 0x84, 
+0x87, 0x7A, 0x5C, 0xAF, 0x7D, 0xE8, 0x93, 0x7F, 0x07, 0xBC, 0x26, 0xA5, 0x95, 0x5B, 0x18, 0x82, 
+0x4E, 0xF1, 0x0B, 0x8D, 0x5C, 0xA6, 0xBE, 0x47, 0x0D, 0xBD, 0xF8, 0xF4, 0x11, 0x75, 0x31, 0x79, 
+0x54, 0xD8, 0xBB, 0x5C, 0xBD, 0x0D, 0xC7, 0x5F, 0x0F, 0xC4, 0x95, 0xA7, 0xB0, 0xBF, 0xE4, 0x3B, 
+0xD7, 0x43, 0xEB, 0x01, 0xFF, 0xA4, 0xC0, 0x07, 0x4D, 0xBD, 0x03, 0xEE, 0x09, 0x37, 0x00, 0x82, 
+0x27, 0x37, 0x60, 0x0B, 0x07, 0x67, 0xD3, 0xA0, 0x7B, 0x61, 0xBD, 0x8B, 0x7A, 0x44, 0x0F, 0xDE, 
+0x71, 0x0D, 0xC2, 0x5F, 0xB6, 0x4A, 0x03, 0x29, 0x54, 0x70, 0x9B, 0x84, 0x5D, 0xBC, 0x97, 0xF1, 
+0x58, 0xA4, 0x72, 0xDA, 0xC7, 0xF8, 0xB9, 0x5B, 0x7D, 0xC7, 0x7D, 0x42, 0xFB, 0x5F, 0xA2, 0x85, 
+0xC0, 0xD6, 0x62, 0x27, 0xD9, 0x7F, 0xD1, 0x5A, 0x3A, 0x44, 0xB4, 0x9D, 0x46, 0xF8, 0x82, 0xDD, 
+0x41, 0x07, 0x7C, 0x37, 0xD0, 0xD7, 0x82, 0x41, 0xAA, 0x98, 0xF2, 0x4C, 0xC7, 0xF0, 0xFA, 0xA3, 
+0x21, 0x33, 0xA1, 0xCF, 0xAD, 0x19, 0x4C, 0xFA, 0x68, 0x86, 0x9E, 0x90, 0xFF, 0x26, 0xE3, 0xD7, 
+0x04, 0x1E, 0x3B, 0x31, 0xF2, 0xA6, 0xFB, 0x95, 0xBA, 0xD3, 0x99, 0xF9, 0x8B, 0xF2, 0xCA, 0x90, 
+0x9D, 0x01, 0x04, 0xEF, 0x9F, 0xDA, 0x9A, 0x7D, 0xD6, 0x88, 0x24, 0xA9, 0x7F, 0xD6, 0xE0, 0xF4, 
+0x21, 0x8B, 0xC3, 0xA3, 0x9C, 0x05, 0xE0, 0x5D, 0x3E, 0xB7, 0x18, 0xBE, 0xDA, 0x5C, 0x20, 0x25, 
+0x2C, 0xDF, 0x3D, 0x39, 0x02, 0x26, 0xDD, 0xF7, 0x3A, 0x0F, 0x1B, 0xFE, 0xCE, 0x78, 0xE8, 0x0F, 
+0x46, 0xDD, 0x7D, 0x5A, 0x30, 0x78, 0x3F, 0xDF, 0x44, 0x1D, 0xBF, 0x69, 0xC0, 0x1D, 0x56, 0x0F, 
+0x6E, 0xCC, 0x0F, 0xE7, 0x0C, 0xE3, 0x9A, 0x03, 0xF0, 0x9E, 0xDE, 0x37, 0x65, 0xB4, 0x7C, 0xC7, 
+0xC1, 0xAB, 0xD4, 0x51, 0x38, 0x31, 0xD4, 0x7B, 0xC4, 0x80, 0x9B, 0x32, 0xE3, 0x8E, 0xD7, 0x07, 
+0x36, 0x7E, 0xEA, 0xF1, 0x5D, 0xE1, 0x91, 0x4A, 0x4F, 0x40, 0x01, 0x2D, 0xB9, 0x9C, 0xC8, 0x57, 
+0x20, 0xDE, 0x3D, 0x4A, 0x57, 0x70, 0x17, 0x88, 0x72, 0x97, 0x7B, 0x40, 0xE3, 0x35, 0xDA, 0x7A, 
+0xE4, 0x72, 0xD7, 0xEE, 0xA7, 0x6D, 0xCE, 0x22, 0xFD, 0xA7, 0x69, 0x1A, 0xBA, 0xE4, 0xB5, 0x42, 
+0xE5, 0x87, 0xFC, 0x05, 0x37, 0x6E, 0xF6, 0xE3, 0x3F, 0x80, 0x05, 0x6F, 0x43, 0xF2, 0xD1, 0x94, 
+0x71, 0x5A, 0x58, 0x93, 0xD6, 0x80, 0xF4, 0xC4, 0x09, 0xFB, 0x43, 0x29, 0xA3, 0x1F, 0x68, 0xDB, 
+0x8E, 0xAC, 0x0C, 0xA1, 0x32, 0xC9, 0xE1, 0x97, 0x42, 0xD0, 0x60, 0xD2, 0x15, 0xDC, 0x7C, 0x1F, 
+0x17, 0xE5, 0xF3, 0xD0, 0x7C, 0x45, 0x7D, 0xB2, 0xB1, 0x5C, 0x2F, 0xF7, 0x4D, 0x04, 0x00, 0x7C, 
+0x9C, 0x8F, 0xA5, 0xAE, 0x0F, 0xD6, 0xF0, 0x5E, 0x8B, 0x57, 0xE3, 0xCC, 0x71, 0x40, 0xC4, 0x3F, 
+0x73, 0x2F, 0xFC, 0xE7, 0x16, 0x54, 0x70, 0xF4, 0x2A, 0x87, 0x35, 0x29, 0xDF, 0xCC, 0x43, 0x2E, 
+0x1E, 0x09, 0x64, 0x95, 0xB8, 0xDF, 0x10, 0xAA, 0x41, 0xB4, 0x72, 0x70, 0x45, 0x7B, 0x6B, 0x5F, 
+0xD1, 0x1E, 0xDF, 0xBE, 0x30, 0xFE, 0xD0, 0x96, 0xDC, 0x71, 0xD8, 0x48, 0x15, 0x7A, 0xDA, 0x8D, 
+0x57, 0xB3, 0x14, 0x6D, 0x9B, 0xCA, 0xF4, 0x27, 0xBD, 0x16, 0x4F, 0xEF, 0xD2, 0x01, 0x1B, 0xDD, 
+0x8E, 0xF4, 0xEE, 0x08, 0x04, 0x84, 0xE6, 0x83, 0x68, 0xC1, 0x38, 0xAD, 0x74, 0x3F, 0x0D, 0x68, 
+0x20, 0x90, 0x1F, 0xB5, 0x7A, 0x91, 0x4E, 0xFF, 0x3F, 0x22, 0x71, 0xE9, 0x8C, 0xD1, 0xB6, 0xA7, 
+0xCE, 0xEC, 0x3B, 0x23, 0x52, 0xA3, 0x2B, 0x5D, 0xFC, 0xC6, 0x80, 0xFF, 0x50, 0x4F, 0xA2, 0xB8, 
+0x2B, 0x96, 0x4E, 0x1B, 0x92, 0x79, 0x0B, 0xC7, 0xAC, 0xA3, 0x79, 0x57, 0x90, 0xD9, 0x91, 0x82, 
+0xEE, 0xB4, 0x9B, 0x69, 0x95, 0x9D, 0x3E, 0x32, 0xC4, 0xE1, 0x74, 0x92, 0xBB, 0xDB, 0x9B, 0x7E, 
+0xB1, 0x4E, 0xC4, 0xA7, 0xAE, 0x46, 0xA0, 0xDD, 0x7C, 0x3F, 0xC5, 0x16, 0xF5, 0x2B, 0x7F, 0x98, 
+0x07, 0x8D, 0x46, 0xA4, 0xAA, 0x09, 0x5F, 0x0E, 0xD5, 0x72, 0xA8, 0x65, 0x76, 0x32, 0xF1, 0x90, 
+0x9E, 0x8E, 0x78, 0xB4, 0x68, 0xAA, 0xC6, 0x98, 0x6B, 0x4A, 0x4F, 0x7C, 0xEA, 0x0F, 0x2C, 0x75, 
+0x97, 0x98, 0x78, 0x28, 0x55, 0xDA, 0xD9, 0x05, 0x89, 0x0C, 0xD9, 0x8B, 0x25, 0x97, 0x59, 0xEC, 
+0x3D, 0x5A, 0xA9, 0x96, 0xD2, 0x5D, 0x61, 0x47, 0xAA, 0xC8, 0x2A, 0xEF, 0xFD, 0x59, 0x4A, 0x4A, 
+0xDD, 0x1E, 0x55, 0xF5, 0x7C, 0x52, 0xE6, 0xE6, 0x08, 0xDF, 0x22, 0xA2, 0xA5, 0xB0, 0xC1, 0x22, 
+0x90, 0xD9, 0x87, 0x72, 0x26, 0x1A, 0x81, 0x20, 0x99, 0xDA, 0x2A, 0x9E, 0xCB, 0x95, 0x54, 0x34, 
+0x14, 0x0E, 0xB5, 0xA1, 0xBF, 0xC7, 0x44, 0xDC, 0x34, 0x70, 0x66, 0x2B, 0xAB, 0x95, 0x5D, 0x7D, 
+0x90, 0x0B, 0x3F, 0x8F, 0x82, 0x1A, 0x71, 0x21, 0x23, 0x96, 0xED, 0x5B, 0x8A, 0x42, 0xF0, 0x54, 
+0xDD, 0xC7, 0xFD, 0x35, 0xE8, 0x05, 0x50, 0x09, 0x9E, 0x85, 0xCC, 0x2F, 0xBC, 0xEA, 0xEA, 0xFF, 
+0x91, 0x47, 0x18, 0xF1, 0x0A, 0xD9, 0xDA, 0x54, 0xC5, 0x2F, 0xF0, 0x9F, 0xB3, 0x5E, 0x91, 0x10, 
+0xE0, 0xD7, 0xE3, 0x59, 0x48, 0xEE, 0xA7, 0xD7, 0x3D, 0x30, 0xCB, 0x4F, 0x31, 0x23, 0x01, 0x59, 
+0x8C, 0x12, 0x8B, 0xE4, 0xD6, 0x2F, 0x20, 0x16, 0x62, 0x27, 0xFE, 0xDB, 0x23, 0x17, 0x9B, 0xEF, 
+0x6D, 0x64, 0xEE, 0x3E, 0x38, 0x64, 0xFB, 0x7B, 0xE1, 0x2B, 0x37, 0xD5, 0xBA, 0xA2, 0xAA, 0xD4, 
+0x92, 0xA5, 0x2D, 0xB4, 0x13, 0x71, 0x51, 0x03, 0x1A, 0xBB, 0xF1, 0x0E, 0xC3, 0x94, 0x74, 0x1E, 
+0x81, 0x7B, 0x62, 0x54, 0x91, 0x06, 0xE7, 0xE0, 0x98, 0x6C, 0x7F, 0x62, 0xC9, 0x9B, 0x81, 0x03, 
+0x6B, 0x3E, 0x63, 0x8F, 0x13, 0xD2, 0x46, 0x47, 0x6D, 0xFB, 0xF8, 0xE0, 0x45, 0x02, 0x14, 0x1D, 
+0x5E, 0xF6, 0xC2, 0x86, 0xE4, 0xCD, 0x42, 0xFB, 0xD0, 0x68, 0xC5, 0x6A, 0x7A, 0x07, 0x5A, 0x22, 
+0x34, 0x65, 0xEB, 0x0B, 0x86, 0xE2, 0x78, 0xD2, 0xF9, 0xCF, 0xDE, 0x0C, 0x6E, 0xF0, 0x21, 0x3E, 
+0xE2, 0x42, 0xB4, 0x38, 0xF4, 0x86, 0x36, 0x55, 0x66, 0xF5, 0x37, 0xC0, 0xF8, 0xFF, 0x3F, 0x98, 
+0xBF, 0x5F, 0x4A, 0xC9, 0xC8, 0x3D, 0x3E, 0x73, 0x0E, 0x4E, 0xB5, 0x81, 0x0E, 0x77, 0x5E, 0xB4, 
+0x9C, 0x0D, 0x02, 0x89, 0x22, 0xA0, 0xC3, 0x5A, 0xB7, 0xA7, 0xE3, 0x6D, 0x90, 0x0E, 0x30, 0xC1, 
+0xD8, 0xA6, 0x28, 0x60, 0x60, 0xCD, 0xA1, 0x99, 0xC9, 0x00, 0x30, 0xDA, 0x4C, 0x54, 0x07, 0xB4, 
+0x9B, 0x22, 0x1D, 0x9E, 0x05, 0x0A, 0xD0, 0x5B, 0xFD, 0xB6, 0x56, 0xF1, 0xD7, 0x68, 0xAC, 0xAF, 
+0x0A, 0x3C, 0xD7, 0x31, 0x8B, 0x2C, 0xDF, 0x31, 0x79, 0x48, 0x6B, 0x8A, 0xB6, 0x5B, 0xFA, 0x70, 
+0x82, 0xA8, 0x2A, 0x0F, 0x0C, 0xD8, 0x02, 0xA4, 0x39, 0xED, 0x63, 0x80, 0xF6, 0xC2, 0x1F, 0x24, 
+0x9E, 0xD1, 0xEB, 0xE7, 0xFB, 0xC4, 0x38, 0x3C, 0x43, 0x9C, 0x63, 0xAE, 0x24, 0xF8, 0xC8, 0x05, 
+0x82, 0xAC, 0x84, 0xEF, 0x5A, 0xD9, 0x4E, 0xF6, 0x90, 0xAD, 0x9D, 0xDB, 0x77, 0xE6, 0xA5, 0xE9, 
+0xF5, 0x13, 0x36, 0x6E, 0x0D, 0x0D, 0xD5, 0x89, 0x10, 0x1B, 0xE2, 0xC4, 0x33, 0xD9, 0x27, 0x1B, 
+0x16, 0x0D, 0x61, 0x89, 0xE9, 0x83, 0xB8, 0xCD, 0xF6, 0x47, 0x28, 0x0F, 0x92, 0x0C, 0x38, 0xC2, 
+0xA1, 0x86, 0xD8, 0x09, 0x7F, 0x56, 0x72, 0x31, 0xD9, 0x20, 0xC7, 0x19, 0x3B, 0x0B, 0x5E, 0x38, 
+0x9C, 0xEC, 0x13, 0x5B, 0x6E, 0x3C, 0x31, 0xA7, 0x30, 0xFB, 0x6C, 0x4E, 0x86, 0x6A, 0x39, 0x0B, 
+0xC0, 0xE2, 0x21, 0x81, 0x18, 0xAD, 0xB5, 0xC6, 0xB8, 0xDE, 0xBD, 0xAA, 0x46, 0x79, 0xBF, 0x15, 
+0x7B, 0x0A, 0xBF, 0x24, 0x99, 0xCE, 0xE7, 0x45, 0x8D, 0x74, 0x6E, 0x64, 0x9C, 0x54, 0xB6, 0x0E, 
+0x5C, 0xC0, 0xF7, 0xDB, 0xE8, 0xE8, 0x97, 0xCD, 0x0F, 0xBE, 0x71, 0x11, 0x6B, 0xEE, 0x50, 0x95, 
+0xC2, 0x88, 0x42, 0x06, 0x92, 0xBD, 0x19, 0x56, 0xFE, 0xC1, 0xC7, 0x1F, 0x67, 0x49, 0xE1, 0x4C, 
+0xBA, 0xA8, 0x31, 0x86, 0xEF, 0x68, 0xCC, 0x06, 0x58, 0x46, 0x62, 0x8A, 0x56, 0x73, 0x5D, 0x15, 
+0xC6, 0xE1, 0xD5, 0xFD, 0x86, 0xAA, 0x49, 0x55, 0xB7, 0x82, 0xB7, 0x6F, 0x71, 0xDD, 0xC5, 0xE0, 
+0xDB, 0x35, 0x29, 0x2E, 0xF1, 0xAC, 0x74, 0xB8, 0x3B, 0xA6, 0xEC, 0x39, 0x9E, 0xA4, 0x9D, 0x51, 
+0x0C, 0xC8, 0x63, 0x2D, 0x7C, 0xC5, 0xA4, 0x27, 0x59, 0xAE, 0x27, 0x4F, 0xD0, 0xA5, 0x08, 0x77, 
+0x9F, 0x34, 0x19, 0xA5, 0xAB, 0x5F, 0xD6, 0xE2, 0x5F, 0x7F, 0x05, 0xB1, 0x19, 0x3C, 0x83, 0x89, 
+0x71, 0x11, 0x48, 0xE2, 0xD9, 0x53, 0x20, 0x99, 0xA7, 0x8A, 0x54, 0xDC, 0xEC, 0x24, 0x17, 0xA5, 
+0xE0, 0xC3, 0x2D, 0x95, 0x36, 0x11, 0x3A, 0x74, 0xB6, 0x54, 0xDD, 0xB0, 0xFF, 0x67, 0xAF, 0xCB, 
+0x15, 0x9F, 0xF6, 0xF9, 0x43, 0xDF, 0xEF, 0xA5, 0x6E, 0x6E, 0x9A, 0x3B, 0xB3, 0x37, 0x19, 0x8B, 
+0x7C, 0x7F, 0xE4, 0x59, 0xCF, 0x8C, 0xCC, 0x39, 0xBB, 0xAB, 0xA0, 0x7B, 0x8F, 0x32, 0x1A, 0x72, 
+0xAB, 0xC1, 0x17, 0x98, 0x98, 0x3A, 0x44, 0xC1, 0x3F, 0x46, 0x17, 0xFE, 0x6A, 0x3B, 0x92, 0xB7, 
+0xA8, 0xC8, 0xBB, 0xA2, 0x0B, 0x63, 0x36, 0xC2, 0xD5, 0x0E, 0x86, 0x26, 0xA8, 0x25, 0x70, 0x57, 
+0x45, 0xBA, 0x6F, 0x45, 0x86, 0x4E, 0x9F, 0xD4, 0x46, 0x42, 0x66, 0x0A, 0x54, 0xFD, 0xF0, 0x47, 
+0x53, 0x2E, 0x04, 0xFE, 0xC3, 0x4B, 0x8A, 0xDD, 0x6A, 0x68, 0x39, 0x22, 0xC0, 0x38, 0x16, 0xB6, 
+0x30, 0x9F, 0x5A, 0x8E, 0x5A, 0x9F, 0xD4, 0x99, 0xFE, 0x38, 0x3A, 0xBA, 0x15, 0x0F, 0xF2, 0x51, 
+0x0F, 0x69, 0x64, 0xFE, 0x8B, 0x7B, 0xF0, 0xB8, 0x06, 0x85, 0x31, 0xA0, 0x12, 0x8A, 0x96, 0xD5, 
+0x1E, 0xB3, 0xD0, 0xD7, 0x83, 0x86, 0x0A, 0x56, 0x6D, 0x45, 0xF3, 0x6F, 0x67, 0x3A, 0x5C, 0x4A, 
+0xF6, 0x84, 0xBC, 0xD6, 0xFB, 0xA8, 0xA7, 0x3D, 0xCF, 0x64, 0x94, 0x3F, 0x91, 0x9D, 0xA9, 0x3D, 
+0xE0, 0xEC, 0x02, 0xD2, 0x03, 0x66, 0x3A, 0x7A, 0x97, 0xAA, 0x45, 0xE3, 0x96, 0xA6, 0xC2, 0xDF, 
+0x74, 0x64, 0x35, 0xBB, 0xB9, 0x31, 0xB2, 0x43, 0x46, 0x38, 0x68, 0x78, 0x4D, 0x55, 0x78, 0xEB, 
+0xD9, 0x1F, 0x70, 0x0D, 0x47, 0x57, 0xCA, 0xCA, 0x81, 0x3F, 0x68, 0x39, 0x64, 0x30, 0xB0, 0x46, 
+0x16, 0xD0, 0xC9, 0xFB, 0xAA, 0xC6, 0xCF, 0x73, 0x22, 0x1B, 0xCD, 0x7C, 0x80, 0xEB, 0x8A, 0xE8, 
+0x8E, 0x1F, 0xFC, 0x6B, 0xE5, 0xE4, 0x24, 0xD3, 0x2E, 0xE6, 0x9B, 0x7C, 0xC4, 0xB6, 0xD0, 0x5A, 
+0x67, 0xDF, 0x74, 0x54, 0x38, 0x79, 0xBC, 0x2C, 0x91, 0x2F, 0x3E, 0x80, 0x96, 0xC3, 0x84, 0x26, 
+0xFA, 0xE0, 0x77, 0xDA, 0x74, 0x6B, 0x6E, 0xC5, 0xD0, 0x92, 0x5C, 0xBA, 0xC5, 0xD6, 0x3B, 0x55, 
+0xCB, 0x4F, 0xAA, 0x61, 0xD6, 0x89, 0xC7, 0x47, 0xF4, 0xC1, 0x62, 0x1F, 0x8C, 0x02, 0x4C, 0xAE, 
+0xA9, 0xCC, 0x17, 0x7C, 0x27, 0x76, 0x39, 0xA8, 0xF6, 0x7F, 0xE4, 0xB7, 0x89, 0xEC, 0x57, 0xDC, 
+0xFE, 0x61, 0x5F, 0x29, 0xA6, 0xB3, 0x5E, 0x3E, 0x94, 0xEE, 0x27, 0x23, 0x80, 0x95, 0xC6, 0x74, 
+0x59, 0x38, 0xB4, 0xBD, 0x7A, 0x3C, 0x03, 0x46, 0x12, 0xD7, 0xE5, 0xBF, 0xD3, 0xFE, 0x63, 0x3E, 
+0x78, 0x0B, 0x7D, 0x7A, 0x5F, 0xBA, 0x9B, 0x9B, 0xA6, 0x90, 0x20, 0x42, 0x8F, 0xBC, 0xF0, 0xE6, 
+0x4F, 0xF0, 0xB5, 0xB6, 0x10, 0x2E, 0x15, 0x6E, 0x2E, 0x1B, 0x6E, 0xAE, 0x8D, 0x71, 0xEB, 0xFD, 
+0x5F, 0xB9, 0x75, 0x3A, 0xB7, 0x17, 0xFF, 0x68, 0x3F, 0x3B, 0xF0, 0x91, 0xCE, 0xD8, 0xF9, 0xB0, 
+0x5C, 0x86, 0x11, 0x20, 0x33, 0x72, 0x74, 0x16, 0xAE, 0xC3, 0x33, 0x02, 0x78, 0x7E, 0x7E, 0xCE, 
+0x4E, 0x71, 0x8E, 0x31, 0x77, 0x0E, 0x21, 0x20, 0xCD, 0x35, 0x8D, 0x77, 0x42, 0x01, 0xAC, 0x75, 
+0x73, 0x6E, 0xFC, 0xA5, 0x2B, 0x0B, 0x8E, 0x06, 0x87, 0x79, 0x01, 0x51, 0xAF, 0x28, 0x18, 0xB1, 
+0x71, 0x28, 0x1A, 0x6A, 0xC7, 0x52, 0x32, 0xA5, 0x54, 0xD4, 0x9A, 0x75, 0xAA, 0x2F, 0x87, 0x4A, 
+0xD9, 0x76, 0xF9, 0xA3, 0xCA, 0x75, 0xBE, 0x89, 0xA7, 0x0E, 0x56, 0xB8, 0xC5, 0x2E, 0xDC, 0xE3, 
+0x02, 0xA1, 0x19, 0x94, 0x63, 0x85, 0x21, 0xBE, 0x90, 0xEA, 0xAD, 0x03, 0x76, 0x49, 0x7F, 0xB5, 
+0x8F, 0x27, 0x3D, 0xF2, 0xF0, 0xFB, 0xDA, 0x8B, 0xFA, 0x6A, 0xFD, 0x7C, 0xED, 0xF6, 0xE3, 0x36, 
+0x52, 0xBB, 0x7C, 0x8F, 0x22, 0x78, 0xAD, 0xC0, 0xC8, 0xB0, 0x86, 0x4F, 0x02, 0xFE, 0xD7, 0x87, 
+0xB9, 0x1D, 0x8B, 0xEF, 0x60, 0xE9, 0xFC, 0xD1, 0xE2, 0x17, 0x7D, 0x71, 0xEC, 0x4B, 0x66, 0xD7, 
+0xA0, 0x40, 0x70, 0xB6, 0xD9, 0xBB, 0x2C, 0x78, 0xCE, 0xD2, 0xC6, 0xF2, 0xC2, 0xD8, 0xEC, 0x84, 
+0x08, 0x53, 0x06, 0xC3, 0xDD, 0x6C, 0x91, 0x1D, 0x70, 0x7F, 0xFD, 0x48, 0xD0, 0xD4, 0x36, 0xAD, 
+0xB1, 0x25, 0x11, 0xA9, 0x13, 0x72, 0x0D, 0xBC, 0x8E, 0x68, 0xAD, 0xD1, 0xB5, 0x4D, 0x61, 0xD9, 
+0x76, 0x27, 0x35, 0xEC, 0x19, 0xEE, 0x03, 0x19, 0x6E, 0xFD, 0x77, 0xBC, 0x43, 0x6B, 0x6E, 0x1F, 
+0x2A, 0xB4, 0xE9, 0x7D, 0xB0, 0xB5, 0xFF, 0xE2, 0x62, 0x40, 0x2B, 0x87, 0x70, 0xBF, 0x21, 0x9F, 
+0xC7, 0xED, 0x56, 0xBD, 0xC5, 0xCB, 0xC7, 0xA3, 0xFA, 0xAA, 0xBF, 0xA1, 0xAA, 0x32, 0xD8, 0xFF, 
+0xB5, 0xC0, 0x3D, 0xF4, 0xFC, 0x1E, 0xAB, 0x34, 0x68, 0xA5, 0xE3, 0x96, 0xA6, 0x58, 0xEB, 0xD2, 
+0x35, 0x6E, 0xC8, 0xD2, 0x16, 0x9B, 0x41, 0xDF, 0xF3, 0x5C, 0xAA, 0xCD, 0x1C, 0x34, 0x2E, 0x6E, 
+0xF3, 0x33, 0x06, 0x94, 0x63, 0x41, 0xD7, 0xB3, 0x77, 0x33, 0xB9, 0xA9, 0x48, 0x0E, 0x48, 0xCD, 
+0x6B, 0xA2, 0x64, 0xB6, 0x06, 0x40, 0x62, 0x6C, 0xCA, 0x48, 0x5E, 0xB2, 0x95, 0x42, 0xDA, 0xE2, 
+0xD5, 0xFD, 0xFD, 0xC9, 0x74, 0xD9, 0x1F, 0x29, 0x44, 0x2D, 0x46, 0xFF, 0xE7, 0xDA, 0xBA, 0xA0, 
+0x63, 0x2E, 0x97, 0x8D, 0xC1, 0x8D, 0x57, 0xC5, 0x6F, 0x30, 0xE1, 0xDD, 0xB0, 0x2D, 0xE3, 0x8D, 
+0xAD, 0xE9, 0x4D, 0x11, 0xBA, 0xBB, 0x35, 0xAE, 0xD5, 0xDB, 0xD5, 0x7E, 0xB0, 0x9D, 0xE3, 0x3F, 
+0x3F, 0x50, 0xFD, 0x66, 0x3F, 0x07, 0x71, 0x7B, 0x39, 0x37, 0xA8, 0x7B, 0x7F, 0x31, 0x2E, 0x9D, 
+0xD1, 0xBE, 0x3E, 0x7B, 0x2B, 0xEB, 0xCC, 0x74, 0x9D, 0x64, 0x8F, 0x0B, 0x9F, 0x3F, 0x8C, 0xCC, 
+0x89, 0x3A, 0xAF, 0x56, 0xAD, 0xF2, 0xA3, 0x02, 0xA3, 0xFB, 0x5B, 0xB7, 0xD6, 0xE7, 0x46, 0x0C, 
+0xDB, 0xA8, 0xA6, 0x26, 0x75, 0xBC, 0xF7, 0xCE, 0xBF, 0xAA, 0xED, 0xDA, 0xBF, 0xD7, 0x77, 0xBD, 
+0x54, 0x78, 0x13, 0xDB, 0x46, 0x4F, 0xF1, 0xC1, 0x9A, 0xFC, 0x13, 0x26, 0x3A, 0xFE, 0x85, 0x9F, 
+0x64, 0x84, 0x7B, 0xF2, 0xA0, 0x9C, 0x0E, 0xF1, 0xEC, 0x83, 0x79, 0xE4, 0x33, 0xAA, 0x43, 0x24, 
+0xF6, 0x60, 0x95, 0xCE, 0x70, 0x66, 0xA9, 0x9C, 0xD9, 0xF9, 0xE6, 0xE6, 0x03, 0x57, 0xF9, 0xD9, 
+0x48, 0xC8, 0x01, 0xBC, 0xBC, 0xB7, 0x52, 0x09, 0x6F, 0x54, 0x51, 0xDF, 0xE8, 0xBF, 0xFA, 0x7D, 
+0xC5, 0xC4, 0x00, 0x05, 0x23, 0x71, 0x79, 0xDC, 0x8C, 0xB2, 0x07, 0x2D, 0x9D, 0xD2, 0x0C, 0x86, 
+0x79, 0x90, 0x7C, 0xA0, 0xF6, 0x71, 0xBE, 0x81, 0x1D, 0x78, 0xED, 0x31, 0x16, 0x09, 0xBC, 0xE6, 
+0xDF, 0x23, 0x61, 0xC0, 0xC7, 0x82, 0xEB, 0xFF, 0x18, 0x85, 0xEE, 0x7E, 0x4F, 0x42, 0x1F, 0x33, 
+0xFC, 0xCB, 0x59, 0xA6, 0x66, 0xFA, 0x88, 0x96, 0x1B, 0x1D, 0xC9, 0x1C, 0x31, 0xC0, 0x37, 0x05, 
+0x72, 0x2E, 0x18, 0xEF, 0xBB, 0x56, 0x7D, 0x52, 0x28, 0xB2, 0x7A, 0x8D, 0xA2, 0xA6, 0x67, 0x96, 
+0x53, 0x58, 0x66, 0xCB, 0x4F, 0xF2, 0x61, 0x5A, 0x17, 0xD5, 0x71, 0xF7, 0xBC, 0x71, 0xEB, 0x9C, 
+0x21, 0x82, 0x81, 0x4E, 0xAE, 0xD3, 0xF9, 0x49, 0xEC, 0xCD, 0xAD, 0x1B, 0xAC, 0xB8, 0x60, 0x7A, 
+0x14, 0xEE, 0x20, 0xF1, 0x0D, 0x82, 0x2F, 0xD2, 0x59, 0x1B, 0x46, 0x7D, 0x58, 0x02, 0x3B, 0xC4, 
+0xC6, 0xD6, 0x15, 0xD1, 0x89, 0x26, 0x3A, 0x14, 0x7F, 0x9E, 0xC0, 0xB6, 0x20, 0x1E, 0x7F, 0xAC, 
+0x31, 0x3E, 0xA0, 0x2D, 0xA1, 0x9F, 0x7B, 0x69, 0x78, 0x94, 0x82, 0xFD, 0x90, 0x14, 0xEB, 0xB5, 
+0xAA, 0xC7, 0xAF, 0xE6, 0xBD, 0xEE, 0x75, 0xFC, 0x48, 0x85, 0xDB, 0x13, 0xA9, 0x24, 0xB4, 0x8B, 
+0xA8, 0x24, 0xB4, 0x67, 0x19, 0x7B, 0x12, 0x4E, 0x4C, 0x28, 0x6D, 0x56, 0x30, 0xE9, 0x96, 0x91, 
+0x6F, 0x17, 0xDB, 0xE0, 0xA5, 0x87, 0xBD, 0xC7, 0x40, 0xAF, 0x5B, 0x41, 0xD0, 0x97, 0x1A, 0xA3, 
+0x46, 0x2A, 0x26, 0xB3, 0xA1, 0x40, 0x65, 0xCD, 0x13, 0x04, 0xBC, 0xC0, 0xEC, 0x3F, 0x09, 0x32, 
+0x64, 0x6D, 0x13, 0xD9, 0x3A, 0x8F, 0xDA, 0x43, 0xB8, 0x4E, 0x3D, 0x9C, 0x17, 0xD4, 0xA7, 0x87, 
+0xD9, 0x2E, 0x22, 0xA7, 0xAD, 0xF9, 0xB8, 0x45, 0x44, 0xAB, 0xD6, 0x43, 0x7A, 0xC1, 0x34, 0xBC, 
+0x96, 0x11, 0x39, 0x51, 0x9E, 0xEC, 0xC2, 0x49, 0xAF, 0xA7, 0x03, 0xC6, 0xE5, 0x85, 0x1B, 0x5C, 
+0x31, 0x6D, 0xA5, 0x57, 0x6D, 0x32, 0xA8, 0x65, 0x0F, 0xA3, 0x61, 0xE6, 0x5F, 0xC0, 0x50, 0x63, 
+0x0C, 0x35, 0xA1, 0x3C, 0xB4, 0x74, 0x1E, 0x78, 0xC2, 0x7D, 0xDA, 0x05, 0x6D, 0x41, 0xDB, 0xF4, 
+0xAB, 0x19, 0xBC, 0x3C, 0xD6, 0xE9, 0x87, 0x75, 0x78, 0x83, 0x6F, 0x84, 0x6B, 0xED, 0x9F, 0xE2, 
+0xF9, 0xDF, 0x66, 0xBB, 0x43, 0x09, 0x37, 0x50, 0xF6, 0x60, 0x6B, 0xE5, 0x37, 0xDF, 0x4B, 0x3E, 
+0xA9, 0xD6, 0xEF, 0x9A, 0x5C, 0x4C, 0xA3, 0x0C, 0xAA, 0xE5, 0xD2, 0x23, 0x81, 0xB3, 0x34, 0x51, 
+0x74, 0xDA, 0x0A, 0x52, 0x5A, 0xDB, 0x5A, 0x32, 0x08, 0x68, 0x2E, 0xD4, 0x74, 0x87, 0x35, 0x2B, 
+0x54, 0xE2, 0x01, 0x56, 0xB6, 0x64, 0x46, 0xAF, 0x29, 0xD5, 0xDB, 0x5B, 0x2D, 0x2B, 0xF6, 0x21, 
+0x4D, 0x70, 0x74, 0x14, 0xC9, 0x45, 0xF5, 0xEB, 0x23, 0x7A, 0xB9, 0xE5, 0x3B, 0x11, 0x43, 0xF9, 
+0x3B, 0x49, 0x16, 0x93, 0xDF, 0xCA, 0x72, 0xB9, 0xC7, 0xED, 0xF2, 0x35, 0xF9, 0xEF, 0xC7, 0x4C, 
+0x30, 0x00, 0x8B, 0x0F, 0xB9, 0x0B, 0xB8, 0x79, 0xFA, 0x59, 0x0E, 0x0A, 0x65, 0x66, 0x96, 0x15, 
+0xC4, 0x12, 0x6D, 0xB3, 0xB5, 0x42, 0x41, 0x6E, 0x61, 0x1B, 0x0E, 0xFC, 0xA2, 0x48, 0xF4, 0xE9, 
+0x77, 0x1A, 0x61, 0x6F, 0xA9, 0xE8, 0x5D, 0xEE, 0xF9, 0x77, 0x65, 0x07, 0x82, 0x98, 0x39, 0x8A, 
+0x7B, 0x8E, 0xBE, 0x16, 0x8E, 0x53, 0x99, 0x8D, 0x7B, 0x9B, 0xE9, 0x36, 0x20, 0x3A, 0x77, 0xFF, 
+0x10, 0x76, 0x63, 0x05, 0xD4, 0xFE, 0x10, 0x93, 0x11, 0xC6, 0x42, 0x90, 0x6E, 0xD9, 0x86, 0x30, 
+0x84, 0x1F, 0x66, 0x1C, 0x13, 0x87, 0xFF, 0xC0, 0x5D, 0x62, 0x35, 0x2B, 0xCB, 0xB9, 0xA8, 0x57, 
+0xB0, 0xA9, 0x1C, 0xD9, 0x22, 0xC6, 0xF0, 0x34, 0xE3, 0x6E, 0x6A, 0x15, 0x03, 0x7B, 0xB4, 0x71, 
+0x38, 0xC4, 0x0A, 0x3C, 0x4D, 0x4E, 0x45, 0x92, 0x2E, 0xAD, 0x8D, 0x4E, 0x46, 0x5F, 0x8F, 0x3A, 
+0x00
+};
+
+const size_t config_html_len = 5573;
+const size_t config_html_br_len = 4672;
+const size_t config_html_size = 22326; // Uncompressed
+const char config_html_hash[] = "d77fb4e7";
+
+#endif
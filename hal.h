@@ -0,0 +1,72 @@
+#ifndef HAL_H
+#define HAL_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// ==========================================
+// Hardware Abstraction Layer
+// ==========================================
+// Everything the control code needs from the board goes through these
+// calls. hal_esp32.cpp implements them on the device over the Arduino core
+// and the sensor libraries; host/hal_linux.cpp implements them with mock
+// drivers so the same sources build natively (see host/CMakeLists.txt).
+// Pins are the config.h numbers on both, levels are HIGH/LOW.
+//
+// The HTTP server needs no calls of its own: it already talks BSD sockets,
+// which lwIP provides on the device and Linux on the host.
+
+// GPIO
+void halPinMode(uint8_t pin, uint8_t mode);
+void halDigitalWrite(uint8_t pin, uint8_t level);
+int halDigitalRead(uint8_t pin);
+void halAttachRisingInterrupt(uint8_t pin, void (*handler)());
+void halTone(uint8_t pin, unsigned int frequency, unsigned long durationMs = 0); // 0: until halNoTone()
+void halNoTone(uint8_t pin);
+
+// ADC, 12 bits: 0-4095
+int halAnalogRead(uint8_t pin);
+
+// Pulse timing: length in microseconds of the next pulse at level, 0 if
+// none completes within timeoutUs
+unsigned long halPulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs);
+
+// Clock
+unsigned long halMillis();
+unsigned long halMicros();
+void halDelay(unsigned long ms);
+void halDelayMicroseconds(unsigned int us);
+uint32_t halCycleCount();   // Wraps every 2^32 cycles
+uint32_t halCpuMhz();
+bool halLocalTime(struct tm* info, uint32_t timeoutMs); // false until the wall clock is set
+
+// DHT11 on DHT_PIN; NAN when a read fails
+void halDhtBegin();
+float halDhtReadTemperature();
+float halDhtReadHumidity();
+
+// DS18B20 on ONE_WIRE_BUS, first device; blocks for the conversion
+const float HAL_PROBE_DISCONNECTED = -127.0f; // DallasTemperature's DEVICE_DISCONNECTED_C
+void halSoilProbeBegin();
+float halSoilProbeReadC();
+
+// System
+uint32_t halFreeHeap();
+uint32_t halMinFreeHeap();      // Low-water mark since boot
+uint32_t halLargestFreeBlock();
+uint32_t halRandom();
+
+// Allocator hooks. A backend that sees the C allocator reports every
+// malloc, calloc, realloc and free to heapCountAllocation() and
+// heapCountFree() (heap_monitor.h) and has HAL_HEAP_HOOKS set. Linux wraps
+// the calls at link time (host/CMakeLists.txt); the ESP32 uses the IDF
+// heap hooks, compiled in when the core is built with CONFIG_HEAP_USE_HOOKS.
+#ifndef HAL_HEAP_HOOKS
+#ifdef CONFIG_HEAP_USE_HOOKS
+#define HAL_HEAP_HOOKS 1
+#else
+#define HAL_HEAP_HOOKS 0
+#endif
+#endif
+
+#endif // HAL_H
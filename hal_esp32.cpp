@@ -0,0 +1,64 @@
+#include "hal.h"
+#include "config.h"
+#include "heap_monitor.h"
+#include <DHT.h>
+#include <OneWire.h>
+#include <DallasTemperature.h>
+
+// ESP32 backend: the Arduino core and the sensor libraries, one call each
+
+static DHT dht(DHT_PIN, DHT11);
+static OneWire oneWire(ONE_WIRE_BUS);
+static DallasTemperature soilProbe(&oneWire);
+
+void halPinMode(uint8_t pin, uint8_t mode) { pinMode(pin, mode); }
+void halDigitalWrite(uint8_t pin, uint8_t level) { digitalWrite(pin, level); }
+int halDigitalRead(uint8_t pin) { return digitalRead(pin); }
+
+void halAttachRisingInterrupt(uint8_t pin, void (*handler)()) {
+    attachInterrupt(digitalPinToInterrupt(pin), handler, RISING);
+}
+
+void halTone(uint8_t pin, unsigned int frequency, unsigned long durationMs) { tone(pin, frequency, durationMs); }
+void halNoTone(uint8_t pin) { noTone(pin); }
+
+int halAnalogRead(uint8_t pin) { return analogRead(pin); }
+
+unsigned long halPulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs) {
+    return pulseIn(pin, level, timeoutUs);
+}
+
+unsigned long halMillis() { return millis(); }
+unsigned long halMicros() { return micros(); }
+void halDelay(unsigned long ms) { delay(ms); }
+void halDelayMicroseconds(unsigned int us) { delayMicroseconds(us); }
+uint32_t halCycleCount() { return ESP.getCycleCount(); }
+uint32_t halCpuMhz() { return getCpuFrequencyMhz(); }
+bool halLocalTime(struct tm* info, uint32_t timeoutMs) { return getLocalTime(info, timeoutMs); }
+
+void halDhtBegin() { dht.begin(); }
+float halDhtReadTemperature() { return dht.readTemperature(); }
+float halDhtReadHumidity() { return dht.readHumidity(); }
+
+void halSoilProbeBegin() { soilProbe.begin(); }
+
+float halSoilProbeReadC() {
+    soilProbe.requestTemperatures();
+    float t = soilProbe.getTempCByIndex(0);
+    return t == DEVICE_DISCONNECTED_C ? HAL_PROBE_DISCONNECTED : t;
+}
+
+uint32_t halFreeHeap() { return ESP.getFreeHeap(); }
+uint32_t halMinFreeHeap() { return ESP.getMinFreeHeap(); }
+uint32_t halLargestFreeBlock() { return ESP.getMaxAllocHeap(); }
+uint32_t halRandom() { return esp_random(); }
+
+#if HAL_HEAP_HOOKS
+// Called by heap_caps after every allocation and before every free, in the
+// allocating task and under the heap lock
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {
+    if (ptr) heapCountAllocation(size, __builtin_return_address(0));
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void* ptr) { heapCountFree(ptr); }
+#endif
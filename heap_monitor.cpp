@@ -0,0 +1,165 @@
+#include "heap_monitor.h"
+#include "logic.h"
+#include "logger.h"
+#include "hal.h"
+#include <new>
+
+static const char* const SUBSYSTEM_NAMES[HEAP_SUBSYSTEM_COUNT] = {"other", "wifi", "sensors", "logic", "http"};
+
+static HeapStats heapStats = {0, 0, 0, UINT32_MAX, 0};
+static unsigned long lastHeapSample = 0;
+static unsigned long reportedSteadyAllocations = 0;
+
+void updateHeapStats() {
+    unsigned long now = halMillis();
+    if (heapStats.samples > 0 && now - lastHeapSample < HEAP_SAMPLE_INTERVAL_MS) return;
+    lastHeapSample = now;
+
+    uint32_t freeBytes = halFreeHeap();
+    uint32_t largestBlock = halLargestFreeBlock();
+    bool newLow = largestBlock < heapStats.minLargestBlock;
+
+    lockState();
+    heapStats.freeBytes = freeBytes;
+    heapStats.largestBlock = largestBlock;
+    heapStats.minFreeEver = halMinFreeHeap();
+    if (newLow) heapStats.minLargestBlock = largestBlock;
+    heapStats.samples++;
+    unlockState();
+
+    if (newLow && heapStats.samples > 1) {
+        LOG_INFO("HEAP", "Largest free block down to %u bytes (free %u)", (unsigned)largestBlock, (unsigned)freeBytes);
+    }
+
+    HeapSteadyStats steady = getHeapSteadyStats();
+    if (steady.allocations != reportedSteadyAllocations) {
+        LOG_WARN("HEAP", "%lu allocations in loop() or the server task since setup(), last from %p",
+                 steady.allocations - reportedSteadyAllocations, steady.lastCaller);
+        reportedSteadyAllocations = steady.allocations;
+    }
+}
+
+HeapStats getHeapStats() {
+    lockState();
+    HeapStats stats = heapStats;
+    unlockState();
+    return stats;
+}
+
+const char* heapSubsystemName(HeapSubsystem subsystem) {
+    return SUBSYSTEM_NAMES[subsystem];
+}
+
+// ==========================================
+// Allocation Accounting
+// ==========================================
+// Counters are bumped from every task and both cores, hence the atomics;
+// the scope is per task. The hooks run for every allocation in the
+// firmware, some of them from interrupts with the flash cache off, so
+// they live in IRAM and touch nothing but these.
+static unsigned long allocations[HEAP_SUBSYSTEM_COUNT];
+static unsigned long frees[HEAP_SUBSYSTEM_COUNT];
+static unsigned long allocatedBytes[HEAP_SUBSYSTEM_COUNT];
+static __thread uint8_t currentSubsystem = HEAP_OTHER;
+static __thread uint8_t exemptDepth = 0;
+static __thread bool insideNew = false; // operator new counted it; its malloc must not again
+static volatile bool steadyState = false;
+static unsigned long steadyAllocations = 0;
+static void* volatile lastSteadyCaller = nullptr;
+
+void heapMarkSteadyState() {
+    steadyState = true;
+}
+
+HeapSteadyStats getHeapSteadyStats() {
+    HeapSteadyStats stats;
+    stats.allocations = __atomic_load_n(&steadyAllocations, __ATOMIC_RELAXED);
+    stats.lastCaller = lastSteadyCaller;
+    return stats;
+}
+
+HeapScope::HeapScope(HeapSubsystem subsystem) : previous((HeapSubsystem)currentSubsystem) {
+    currentSubsystem = subsystem;
+}
+
+HeapScope::~HeapScope() {
+    currentSubsystem = previous;
+}
+
+HeapExempt::HeapExempt() {
+    exemptDepth++;
+}
+
+HeapExempt::~HeapExempt() {
+    exemptDepth--;
+}
+
+HeapAllocStats getHeapAllocStats(HeapSubsystem subsystem) {
+    HeapAllocStats stats;
+    stats.allocations = __atomic_load_n(&allocations[subsystem], __ATOMIC_RELAXED);
+    stats.frees = __atomic_load_n(&frees[subsystem], __ATOMIC_RELAXED);
+    stats.bytes = __atomic_load_n(&allocatedBytes[subsystem], __ATOMIC_RELAXED);
+    return stats;
+}
+
+#if HEAP_ACCOUNTING
+static void IRAM_ATTR checkSteadyState(void* caller) {
+    if (!steadyState || currentSubsystem == HEAP_OTHER || exemptDepth > 0) return;
+    __atomic_fetch_add(&steadyAllocations, 1, __ATOMIC_RELAXED);
+    lastSteadyCaller = caller;
+#if HEAP_STRICT
+    abort();
+#endif
+}
+
+void IRAM_ATTR heapCountAllocation(size_t size, void* caller) {
+    if (insideNew) return;
+    checkSteadyState(caller);
+    __atomic_fetch_add(&allocations[currentSubsystem], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&allocatedBytes[currentSubsystem], size, __ATOMIC_RELAXED);
+}
+
+void IRAM_ATTR heapCountFree(void* p) {
+    if (!p || insideNew) return;
+    __atomic_fetch_add(&frees[currentSubsystem], 1, __ATOMIC_RELAXED);
+}
+
+static void* countedAlloc(size_t size, void* caller) {
+    heapCountAllocation(size, caller);
+    insideNew = true;
+    void* p = malloc(size ? size : 1);
+    insideNew = false;
+    return p;
+}
+
+static void countedFree(void* p) {
+    heapCountFree(p);
+    insideNew = true;
+    free(p);
+    insideNew = false;
+}
+
+static void* countedAllocOrThrow(size_t size, void* caller) {
+    void* p = countedAlloc(size, caller);
+    if (!p) {
+#if __cpp_exceptions
+        throw std::bad_alloc();
+#else
+        abort();
+#endif
+    }
+    return p;
+}
+
+void* operator new(size_t size) { return countedAllocOrThrow(size, __builtin_return_address(0)); }
+void* operator new[](size_t size) { return countedAllocOrThrow(size, __builtin_return_address(0)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size, __builtin_return_address(0)); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size, __builtin_return_address(0)); }
+void operator delete(void* p) noexcept { countedFree(p); }
+void operator delete[](void* p) noexcept { countedFree(p); }
+void operator delete(void* p, size_t) noexcept { countedFree(p); }
+void operator delete[](void* p, size_t) noexcept { countedFree(p); }
+#else
+void heapCountAllocation(size_t, void*) {}
+void heapCountFree(void*) {}
+#endif
@@ -0,0 +1,95 @@
+#ifndef HEAP_MONITOR_H
+#define HEAP_MONITOR_H
+
+#include <Arduino.h>
+
+// ==========================================
+// Heap Monitor
+// ==========================================
+// Samples free heap and the largest free block every
+// HEAP_SAMPLE_INTERVAL_MS from loop(). A largest block shrinking while free
+// heap holds steady is fragmentation; the lowest values seen are kept so a
+// dip between scrapes is not lost. Exported at /metrics; every history
+// record also carries the heap at its measurement.
+const unsigned long HEAP_SAMPLE_INTERVAL_MS = 10000;
+
+struct HeapStats {
+    uint32_t freeBytes;
+    uint32_t largestBlock;
+    uint32_t minFreeEver;      // Heap's own low-water mark since boot
+    uint32_t minLargestBlock;  // Lowest largest block sampled since boot
+    unsigned long samples;
+};
+
+// Per-subsystem allocation counters. Code runs inside a HeapScope for its
+// subsystem; allocations count against the innermost scope of the calling
+// task. The global operator new/delete are always seen. Where the HAL
+// backend hooks the C allocator (HAL_HEAP_HOOKS, see hal.h) malloc,
+// calloc, realloc and free are too, so String, ArduinoJson and library
+// buffers count; without it they only show up in the samples above.
+// Build with -DHEAP_ACCOUNTING=0 to drop the hooks.
+#ifndef HEAP_ACCOUNTING
+#define HEAP_ACCOUNTING 1
+#endif
+
+enum HeapSubsystem : uint8_t {
+    HEAP_OTHER,    // Outside any scope: setup(), library tasks
+    HEAP_WIFI,
+    HEAP_SENSORS,
+    HEAP_LOGIC,    // Automation and history
+    HEAP_HTTP,     // Request handlers
+    HEAP_SUBSYSTEM_COUNT
+};
+
+struct HeapAllocStats {
+    unsigned long allocations; // operator new, plus malloc/calloc/realloc with HAL_HEAP_HOOKS
+    unsigned long frees;       // operator delete, plus free with HAL_HEAP_HOOKS
+    unsigned long bytes;       // Requested by allocations, not net
+};
+
+// Steady state: once setup() calls heapMarkSteadyState(), everything that
+// runs in a scope other than HEAP_OTHER (all of loop() and the server
+// task) works on buffers sized at boot and must not allocate. Any
+// allocation that does is counted, its caller kept for the log, and with
+// -DHEAP_STRICT=1 it aborts so the panic backtrace points at it. Code that
+// allocates by design (a WiFi reconnect, the identity asset fallback) says
+// so with a HeapExempt.
+#ifndef HEAP_STRICT
+#define HEAP_STRICT 0
+#endif
+
+struct HeapSteadyStats {
+    unsigned long allocations;  // Guarded allocations since setup()
+    void* lastCaller;           // Return address of the latest one
+};
+
+class HeapScope {
+public:
+    explicit HeapScope(HeapSubsystem subsystem);
+    ~HeapScope();
+
+private:
+    HeapSubsystem previous;
+};
+
+// Allocations inside it still count against the subsystem, just not as
+// steady-state ones. Nests.
+class HeapExempt {
+public:
+    HeapExempt();
+    ~HeapExempt();
+};
+
+void updateHeapStats(); // Every loop(); samples when the interval is due
+void heapMarkSteadyState(); // Last thing in setup()
+HeapStats getHeapStats();
+HeapSteadyStats getHeapSteadyStats();
+HeapAllocStats getHeapAllocStats(HeapSubsystem subsystem);
+const char* heapSubsystemName(HeapSubsystem subsystem);
+
+// Allocator hooks for the HAL backends, called in the allocating task.
+// Safe from any context: atomics and a thread-local, nothing else.
+void heapCountAllocation(size_t size, void* caller);
+void heapCountFree(void* p);
+
+#endif // HEAP_MONITOR_H
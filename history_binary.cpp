@@ -0,0 +1,60 @@
+#include "history_binary.h"
+
+HistoryBinaryWriter::HistoryBinaryWriter(Print& out) : out(out), used(0) {}
+
+HistoryBinaryWriter::~HistoryBinaryWriter() {
+    flush();
+}
+
+void HistoryBinaryWriter::write(const HistoryRing& records, size_t first, bool delta, unsigned long since) {
+    if (first > records.size()) first = records.size();
+    size_t count = records.size() - first;
+
+    writeByte(HISTORY_BINARY_VERSION);
+    writeByte(delta ? HISTORY_FLAG_DELTA : 0);
+    writeU16(count);
+    writeU16(records.size());
+    writeU16(0);
+    writeU32(delta ? since : 0);
+
+    // Column by column: each one compresses and decodes as a single run
+    for (size_t i = first; i < records.size(); ++i) writeU32(records[i].timestamp);
+    for (size_t i = first; i < records.size(); ++i) writeF32(records[i].ambientTemp);
+    for (size_t i = first; i < records.size(); ++i) writeF32(records[i].ambientHumidity);
+    for (size_t i = first; i < records.size(); ++i) writeI16(records[i].soilMoisture);
+    for (size_t i = first; i < records.size(); ++i) writeI16(records[i].tankLevel);
+    for (size_t i = first; i < records.size(); ++i) writeI16(records[i].lightLevel);
+}
+
+void HistoryBinaryWriter::flush() {
+    if (used > 0) {
+        out.write(buffer, used);
+        used = 0;
+    }
+}
+
+void HistoryBinaryWriter::writeByte(uint8_t value) {
+    if (used == BUFFER_SIZE) flush();
+    buffer[used++] = value;
+}
+
+// Explicit byte order, so the layout does not depend on the CPU
+void HistoryBinaryWriter::writeU16(uint16_t value) {
+    writeByte(value & 0xFF);
+    writeByte(value >> 8);
+}
+
+void HistoryBinaryWriter::writeU32(uint32_t value) {
+    writeU16(value & 0xFFFF);
+    writeU16(value >> 16);
+}
+
+void HistoryBinaryWriter::writeI16(int value) {
+    writeU16((uint16_t)(int16_t)constrain(value, -32768, 32767));
+}
+
+void HistoryBinaryWriter::writeF32(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    writeU32(bits);
+}
@@ -0,0 +1,60 @@
+#ifndef HISTORY_BINARY_H
+#define HISTORY_BINARY_H
+
+#include <Arduino.h>
+#include "logic.h"
+
+// ==========================================
+// Binary History Writer
+// ==========================================
+// Packs history records column by column, little-endian, through a small
+// fixed buffer into any Print sink, same as JsonStreamWriter does for JSON.
+// Served by /history to clients that send Accept: application/octet-stream;
+// decodeHistory() in script.js / view.js reads it back. Layout:
+//
+//   offset  type      field
+//   0       uint8     format version (HISTORY_BINARY_VERSION)
+//   1       uint8     flags: bit 0 = delta, append to the client's copy
+//   2       uint16    n, records in this payload
+//   4       uint16    records in the ring; the client trims to this
+//   6       uint16    reserved, 0
+//   8       uint32    delta base timestamp, 0 for a full history
+//   12      uint32    timestamp[n]   millis() at measurement
+//           float32   temp[n]        -999 = sensor error
+//           float32   humidity[n]
+//           int16     soil[n]        %
+//           int16     tank[n]        %
+//           int16     light[n]       %
+const uint8_t HISTORY_BINARY_VERSION = 1;
+const uint8_t HISTORY_FLAG_DELTA = 0x01;
+const char HISTORY_BINARY_TYPE[] = "application/octet-stream";
+
+class HistoryBinaryWriter {
+public:
+    static const size_t HEADER_SIZE = 12;
+    static const size_t RECORD_SIZE = 18;
+
+    explicit HistoryBinaryWriter(Print& out);
+    ~HistoryBinaryWriter();
+
+    // Records [first, end) of the ring; since is the delta base timestamp
+    void write(const HistoryRing& records, size_t first, bool delta, unsigned long since);
+    void flush();
+
+    static size_t encodedSize(size_t count) { return HEADER_SIZE + count * RECORD_SIZE; }
+
+private:
+    static const size_t BUFFER_SIZE = 64;
+
+    void writeByte(uint8_t value);
+    void writeU16(uint16_t value);
+    void writeU32(uint32_t value);
+    void writeI16(int value);
+    void writeF32(float value);
+
+    Print& out;
+    uint8_t buffer[BUFFER_SIZE];
+    size_t used;
+};
+
+#endif // HISTORY_BINARY_H
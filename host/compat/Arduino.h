@@ -0,0 +1,80 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// ==========================================
+// Arduino core subset for the host build
+// ==========================================
+// What the sketch uses from the core besides the hardware: types and
+// constants, String, Print, Serial on stdout and the FreeRTOS task calls
+// the ESP32 core pulls in with Arduino.h. Pins, ADC, timing and sensors
+// are left out on purpose; they go through hal.h, so a direct
+// digitalWrite() or millis() in shared code fails the host build.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <string>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define RISING 0x01
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(text) (text)
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef uint8_t byte;
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    if (inMax == inMin) return outMin;
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// The clock is the system's and there is one fixed speed: no-ops
+inline void configTime(long gmtOffsetSec, int daylightOffsetSec, const char* server) {}
+inline bool setCpuFrequencyMhz(uint32_t mhz) { return true; }
+
+class String {
+public:
+    String(const char* text = "") : text(text ? text : "") {}
+
+    const char* c_str() const { return text.c_str(); }
+    size_t length() const { return text.size(); }
+    bool operator==(const String& other) const { return text == other.text; }
+
+private:
+    std::string text;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* data, size_t size) {
+        size_t n = 0;
+        while (n < size && write(data[n])) n++;
+        return n;
+    }
+    size_t print(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud) { setvbuf(stdout, nullptr, _IOLBF, 0); } // Lines show up as they are drained
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t* data, size_t size) override { return fwrite(data, 1, size, stdout); }
+};
+
+extern HardwareSerial Serial;
+
+#endif // HOST_ARDUINO_H
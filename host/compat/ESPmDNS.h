@@ -0,0 +1,15 @@
+#ifndef HOST_ESPMDNS_H
+#define HOST_ESPMDNS_H
+
+#include <stdint.h>
+
+// The host is reached by its own name; registering one is a no-op
+class MDNSResponder {
+public:
+    bool begin(const char* hostName) { return true; }
+    void addService(const char* service, const char* protocol, uint16_t port) {}
+};
+
+extern MDNSResponder MDNS;
+
+#endif // HOST_ESPMDNS_H
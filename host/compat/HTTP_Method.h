@@ -0,0 +1,17 @@
+#ifndef HOST_HTTP_METHOD_H
+#define HOST_HTTP_METHOD_H
+
+// Same values as the ESP32 core's, which takes them from http_parser
+enum HTTPMethod {
+    HTTP_DELETE = 0,
+    HTTP_GET = 1,
+    HTTP_HEAD = 2,
+    HTTP_POST = 3,
+    HTTP_PUT = 4,
+    HTTP_OPTIONS = 6,
+    HTTP_PATCH = 28,
+};
+
+#define HTTP_ANY ((HTTPMethod)255)
+
+#endif // HOST_HTTP_METHOD_H
@@ -0,0 +1,32 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+// ==========================================
+// WiFi for the host build
+// ==========================================
+// The host network is always up, so WiFi reports connected on loopback.
+#define WL_CONNECTED 3
+
+class IPAddress {
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : octets{a, b, c, d} {}
+    String toString() const;
+
+private:
+    uint8_t octets[4];
+};
+
+class WiFiClass {
+public:
+    void begin(const char* ssid, const char* password) {}
+    int status() const { return WL_CONNECTED; }
+    IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+    void setSleep(bool enable) {}
+};
+
+extern WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,58 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <ESPmDNS.h>
+#include <esp32/rom/miniz.h>
+#include <stdarg.h>
+
+HardwareSerial Serial;
+WiFiClass WiFi;
+MDNSResponder MDNS;
+
+size_t Print::printf(const char* format, ...) {
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (n <= 0) return 0;
+    return write((const uint8_t*)text, (size_t)n < sizeof(text) ? n : sizeof(text) - 1);
+}
+
+String IPAddress::toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return String(text);
+}
+
+// ==========================================
+// tinfl over zlib
+// ==========================================
+
+void tinfl_init(tinfl_decompressor* r) {
+    memset(&r->stream, 0, sizeof(r->stream));
+    r->open = inflateInit2(&r->stream, -15) == Z_OK; // Raw deflate, no header
+}
+
+tinfl_status tinfl_decompress(tinfl_decompressor* r, const uint8_t* in, size_t* inBytes, uint8_t* outStart,
+                              uint8_t* outNext, size_t* outBytes, uint32_t flags) {
+    if (!r->open) {
+        *inBytes = *outBytes = 0;
+        return TINFL_STATUS_FAILED;
+    }
+    r->stream.next_in = (Bytef*)in;
+    r->stream.avail_in = *inBytes;
+    r->stream.next_out = outNext;
+    r->stream.avail_out = *outBytes;
+    int result = inflate(&r->stream, Z_NO_FLUSH);
+    *inBytes -= r->stream.avail_in;
+    *outBytes -= r->stream.avail_out;
+
+    if (result == Z_OK || result == Z_BUF_ERROR) {
+        if (r->stream.avail_out == 0) return TINFL_STATUS_HAS_MORE_OUTPUT;
+        if (r->stream.avail_in == 0) return TINFL_STATUS_NEEDS_MORE_INPUT;
+    }
+    // Finished or corrupt: the caller stops here, so the zlib state goes now
+    inflateEnd(&r->stream);
+    r->open = false;
+    return result == Z_STREAM_END ? TINFL_STATUS_DONE : TINFL_STATUS_FAILED;
+}
@@ -0,0 +1,33 @@
+#ifndef HOST_MINIZ_H
+#define HOST_MINIZ_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+// ==========================================
+// ROM inflater for the host build
+// ==========================================
+// The tinfl calls web_server.cpp makes, over zlib: raw deflate into a
+// wrapping TINFL_LZ_DICT_SIZE output window. zlib keeps its own history,
+// so the window is only where output lands. Flags other than 0 are not
+// supported.
+#define TINFL_LZ_DICT_SIZE 32768
+
+typedef enum {
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+typedef struct {
+    z_stream stream;
+    bool open;
+} tinfl_decompressor;
+
+void tinfl_init(tinfl_decompressor* r);
+tinfl_status tinfl_decompress(tinfl_decompressor* r, const uint8_t* in, size_t* inBytes, uint8_t* outStart,
+                              uint8_t* outNext, size_t* outBytes, uint32_t flags);
+
+#endif // HOST_MINIZ_H
@@ -0,0 +1,6 @@
+#ifndef HOST_ESP_SLEEP_H
+#define HOST_ESP_SLEEP_H
+
+// The sketch only mentions light sleep in comments; nothing to provide
+
+#endif // HOST_ESP_SLEEP_H
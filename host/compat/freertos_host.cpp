@@ -0,0 +1,47 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <mutex>
+#include <thread>
+#include <chrono>
+
+// Handles are never deleted: the sketch creates its mutexes and tasks once
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char* name, uint32_t stackDepth, void* parameter,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    std::thread(task, parameter).detach();
+    if (handle) *handle = nullptr;
+    return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new std::mutex();
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return new std::recursive_mutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t ticks) {
+    static_cast<std::mutex*>(mutex)->lock();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) {
+    static_cast<std::mutex*>(mutex)->unlock();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t mutex, TickType_t ticks) {
+    static_cast<std::recursive_mutex*>(mutex)->lock();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t mutex) {
+    static_cast<std::recursive_mutex*>(mutex)->unlock();
+    return pdTRUE;
+}
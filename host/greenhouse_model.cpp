@@ -0,0 +1,100 @@
+#include "greenhouse_model.h"
+#include "config.h"
+#include "mock_hal.h"
+#include <math.h>
+
+const float TANK_BRIM_CM = 0.3f;
+
+static float clampf(float value, float low, float high) {
+    return value < low ? low : value > high ? high : value;
+}
+
+GreenhouseModel::GreenhouseModel(const ModelParams& params, uint32_t seed)
+    : params(params), rng(seed ? seed : 1), moisture(55.0f), infiltrating(0), tankVolume(params.tankLiters * 0.6f),
+      airTemp(params.meanTemp), humidity(70.0f), soilTemp(params.meanTemp - 2.0f), dayMean(params.meanTemp),
+      dayCloud(0), day(-1), pirRemaining(0), pirCount(0), irrigated(0), filled(0), dryRun(0) {}
+
+float GreenhouseModel::random01() {
+    // xorshift32, independent of halRandom() so the weather does not shift
+    // when the control code draws numbers
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return (rng >> 8) * (1.0f / 16777216.0f);
+}
+
+// Share of full sun on the LDR: a half sine from 06:00 to 18:00, dimmed by
+// the day's cloud cover
+float GreenhouseModel::daylight(const struct tm& local) {
+    float hour = local.tm_hour + local.tm_min / 60.0f + local.tm_sec / 3600.0f;
+    if (hour <= 6.0f || hour >= 18.0f) return 0;
+    return (1.0f - dayCloud) * sinf((float)M_PI * (hour - 6.0f) / 12.0f);
+}
+
+void GreenhouseModel::step(time_t wallTime, float dtSeconds) {
+    time_t localTime = wallTime + GMT_OFFSET_SEC + DAYLIGHT_OFFSET_SEC;
+    struct tm local;
+    gmtime_r(&localTime, &local);
+    if (local.tm_yday != day) {
+        day = local.tm_yday;
+        dayMean = params.meanTemp + (random01() - 0.5f) * 4.0f;
+        dayCloud = random01() * 0.7f;
+    }
+
+    // Pumps, as the control code left the relays
+    if (mockOutput(RELAY_PIN) == HIGH) {
+        float wanted = params.pumpLitersPerMin * dtSeconds / 60.0f;
+        float liters = wanted < tankVolume ? wanted : tankVolume;
+        if (liters < wanted) dryRun += dtSeconds * (1.0f - liters / wanted);
+        tankVolume -= liters;
+        irrigated += liters;
+        infiltrating += liters * params.moisturePerLiter;
+    }
+    if (mockOutput(RELAY_TANK_PIN) == HIGH) {
+        float liters = params.fillLitersPerMin * dtSeconds / 60.0f;
+        filled += liters; // Past full it overflows: still water used
+        tankVolume = clampf(tankVolume + liters, 0, params.tankLiters);
+    }
+
+    // Soil: irrigation reaches the probe with a lag; drying grows with heat and sun
+    float sun = daylight(local);
+    float reached = infiltrating * (1.0f - expf(-dtSeconds / (params.infiltrationMin * 60.0f)));
+    infiltrating -= reached;
+    float drying = params.dryingPerHour * (1.0f + 0.05f * (airTemp - 20.0f)) * (1.0f + 2.0f * sun) * dtSeconds / 3600.0f;
+    moisture = clampf(moisture + reached - (drying > 0 ? drying : 0), 0, 100);
+
+    // Air peaks mid-afternoon, relative humidity falls as it warms; the soil follows the air slowly
+    float hour = local.tm_hour + local.tm_min / 60.0f;
+    airTemp = dayMean + params.tempSwing * cosf(2.0f * (float)M_PI * (hour - 15.0f) / 24.0f) + 3.0f * sun;
+    humidity = clampf(90.0f - 2.5f * (airTemp - (dayMean - params.tempSwing)), 30.0f, 95.0f);
+    soilTemp += (airTemp - 2.0f - soilTemp) * (1.0f - expf(-dtSeconds / (3.0f * 3600.0f)));
+
+    // PIR: Poisson arrivals, each holding the output high for a while
+    if (pirRemaining > 0) {
+        pirRemaining -= dtSeconds;
+        if (pirRemaining <= 0) mockSetDigitalInput(PIR_PIN, LOW);
+    } else if (random01() < params.pirEventsPerDay * dtSeconds / 86400.0f) {
+        pirRemaining = params.pirPulseSec;
+        pirCount++;
+        mockSetDigitalInput(PIR_PIN, HIGH); // Fires the sketch's interrupt
+    }
+
+    float lamp = mockOutput(LUMINARY_LED_PIN) == HIGH ? params.luminaryLight : 0;
+    writeSensors(clampf(sun + lamp, 0, 1));
+}
+
+// The raw values each sensor would report, through the calibration in
+// config.h, so the control code reads back the model's state
+void GreenhouseModel::writeSensors(float light) {
+    mockSetDht(airTemp, humidity);
+    mockSetSoilProbe(soilTemp);
+    mockSetAnalog(SOIL_MOISTURE_PIN, (int)lroundf(SOIL_DRY + (SOIL_WET - SOIL_DRY) * moisture / 100.0f));
+    mockSetAnalog(LDR_PIN, (int)lroundf(LIGHT_MIN_RAW + (LIGHT_MAX_RAW - LIGHT_MIN_RAW) * light));
+
+    // Echo time for the water surface, with the same speed of sound
+    // correction readTankLevelPercent() applies. A full tank stands a few
+    // millimetres over the 100 % mark, so it reads 100 despite rounding.
+    float distanceCm = TANK_DEPTH_CM - tankLevel() * (TANK_DEPTH_CM - TANK_MIN_DISTANCE + TANK_BRIM_CM);
+    float cmPerUs = (331.3f + 0.606f * airTemp + 0.0124f * humidity) / 10000.0f;
+    mockSetPulse(ECHO_PIN, (unsigned long)(2.0f * distanceCm / cmPerUs));
+}
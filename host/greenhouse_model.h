@@ -0,0 +1,71 @@
+#ifndef GREENHOUSE_MODEL_H
+#define GREENHOUSE_MODEL_H
+
+#include <stdint.h>
+#include <time.h>
+
+// ==========================================
+// Greenhouse Model (host simulator)
+// ==========================================
+// A lumped plant for greenhouse_sim: one soil volume, one tank, air
+// temperature and humidity, daylight and a PIR sensor. step() integrates
+// it over dt with the actuators as the control code left them (read back
+// from the mock drivers), then writes what each sensor would read into
+// the mocks. Rates are per hour and sized for the prototype. They are
+// plausible, not calibrated, and only meant to compare automation changes
+// against each other.
+struct ModelParams {
+    float tankLiters = 40.0f;
+    float pumpLitersPerMin = 1.5f;      // Irrigation pump, from the tank
+    float fillLitersPerMin = 4.0f;      // Tank pump, from the mains
+    float moisturePerLiter = 1.2f;      // Soil moisture points per liter delivered
+    float infiltrationMin = 15.0f;      // Time constant from irrigation to the probe
+    float dryingPerHour = 0.6f;         // Moisture lost at 20 °C, no sun
+    float meanTemp = 24.0f;             // °C, daily mean drifts around it
+    float tempSwing = 6.0f;             // °C above/below the mean, peak at 15:00
+    float luminaryLight = 0.25f;        // Share of full sun the LDR sees from the lamp
+    float pirEventsPerDay = 3.0f;       // Poisson rate of motion in front of the PIR
+    float pirPulseSec = 2.0f;           // How long the PIR output stays high
+};
+
+class GreenhouseModel {
+public:
+    GreenhouseModel(const ModelParams& params, uint32_t seed);
+
+    // Advances to the given wall time (UTC, as halLocalTime() sees it)
+    void step(time_t wallTime, float dtSeconds);
+
+    // State and what went through the pumps, for the report
+    float soilMoisture() const { return moisture; }
+    float tankLevel() const { return tankVolume / params.tankLiters; }
+    float irrigatedLiters() const { return irrigated; }
+    float filledLiters() const { return filled; }
+    float dryRunSeconds() const { return dryRun; }  // Irrigation pump on an empty tank
+    unsigned long pirEvents() const { return pirCount; }
+
+private:
+    float random01();
+    float daylight(const struct tm& local);
+    void writeSensors(float light);
+
+    ModelParams params;
+    uint32_t rng;
+
+    float moisture;        // % of the probe's calibrated range
+    float infiltrating;    // Moisture points on their way down
+    float tankVolume;      // Liters
+    float airTemp;
+    float humidity;
+    float soilTemp;
+    float dayMean;         // Today's mean air temperature
+    float dayCloud;        // 0 clear .. 0.7 overcast
+    int day;               // tm_yday the two above belong to
+    float pirRemaining;    // Seconds the PIR stays high
+    unsigned long pirCount;
+
+    float irrigated;
+    float filled;
+    float dryRun;
+};
+
+#endif // GREENHOUSE_MODEL_H
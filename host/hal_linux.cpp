@@ -0,0 +1,240 @@
+#include "hal.h"
+#include "config.h"
+#include "mock_hal.h"
+#include "heap_monitor.h"
+#include "host_clock.h"
+#include <time.h>
+
+// Linux backend: mock drivers over plain state (see mock_hal.h), time from
+// the host clock (see host_clock.h), wall time in the sketch's time zone.
+// Reads that block on the device take their device time here too, so a
+// virtual clock sees the same measurement pass.
+
+const unsigned long DHT_READ_US = 25000;       // Start signal and 40 bits
+const unsigned long PROBE_CONVERSION_US = 750000; // DS18B20 at 12 bits
+
+const int MOCK_PIN_COUNT = 40; // GPIO0-39
+
+struct MockPin {
+    uint8_t mode;
+    int input;
+    int output;
+    int analog;
+    unsigned long pulseUs;
+    unsigned int tone;
+    void (*risingHandler)();
+};
+
+static MockPin pins[MOCK_PIN_COUNT];
+static float dhtTemperature;
+static float dhtHumidity;
+static float soilProbe;
+static uint32_t heapFree;
+static uint32_t heapMinFree;
+static uint32_t heapLargest;
+static uint32_t randomState = 1;
+
+static MockPin* pinAt(uint8_t pin) {
+    return pin < MOCK_PIN_COUNT ? &pins[pin] : nullptr;
+}
+
+void mockReset() {
+    for (int i = 0; i < MOCK_PIN_COUNT; ++i) pins[i] = MockPin{INPUT, LOW, LOW, 0, 0, 0, nullptr};
+    dhtTemperature = 25.0f;
+    dhtHumidity = 60.0f;
+    soilProbe = 22.0f;
+    pins[SOIL_MOISTURE_PIN].analog = 1750; // ~50 % between SOIL_DRY and SOIL_WET
+    pins[LDR_PIN].analog = 1850;           // ~50 % between LIGHT_MIN_RAW and LIGHT_MAX_RAW
+    pins[ECHO_PIN].pulseUs = 690;          // ~11.8 cm: tank about half full
+    heapFree = heapMinFree = 200000;
+    heapLargest = 110000;
+}
+
+static const bool mockDefaults = (mockReset(), true); // Before setup() runs
+
+void mockSetDigitalInput(uint8_t pin, int level) {
+    MockPin* p = pinAt(pin);
+    if (!p) return;
+    bool rising = p->input == LOW && level != LOW;
+    p->input = level;
+    if (rising && p->risingHandler) p->risingHandler();
+}
+
+void mockSetAnalog(uint8_t pin, int raw) {
+    if (MockPin* p = pinAt(pin)) p->analog = constrain(raw, 0, 4095);
+}
+
+void mockSetPulse(uint8_t pin, unsigned long us) {
+    if (MockPin* p = pinAt(pin)) p->pulseUs = us;
+}
+
+void mockSetDht(float temperature, float humidity) {
+    dhtTemperature = temperature;
+    dhtHumidity = humidity;
+}
+
+void mockSetSoilProbe(float celsius) {
+    soilProbe = celsius;
+}
+
+void mockSetHeap(uint32_t freeBytes, uint32_t largestBlock) {
+    heapFree = freeBytes;
+    heapLargest = largestBlock;
+    if (freeBytes < heapMinFree) heapMinFree = freeBytes;
+}
+
+void mockSeedRandom(uint32_t seed) {
+    randomState = seed ? seed : 1;
+}
+
+int mockOutput(uint8_t pin) {
+    MockPin* p = pinAt(pin);
+    return p ? p->output : LOW;
+}
+
+unsigned int mockToneFrequency(uint8_t pin) {
+    MockPin* p = pinAt(pin);
+    return p ? p->tone : 0;
+}
+
+// ==========================================
+// hal.h
+// ==========================================
+
+void halPinMode(uint8_t pin, uint8_t mode) {
+    if (MockPin* p = pinAt(pin)) p->mode = mode;
+}
+
+void halDigitalWrite(uint8_t pin, uint8_t level) {
+    if (MockPin* p = pinAt(pin)) p->output = level;
+}
+
+int halDigitalRead(uint8_t pin) {
+    MockPin* p = pinAt(pin);
+    if (!p) return LOW;
+    return p->mode == OUTPUT ? p->output : p->input;
+}
+
+void halAttachRisingInterrupt(uint8_t pin, void (*handler)()) {
+    if (MockPin* p = pinAt(pin)) p->risingHandler = handler;
+}
+
+void halTone(uint8_t pin, unsigned int frequency, unsigned long durationMs) {
+    if (MockPin* p = pinAt(pin)) p->tone = frequency; // A timed tone stays on: nothing times it out here
+}
+
+void halNoTone(uint8_t pin) {
+    if (MockPin* p = pinAt(pin)) p->tone = 0;
+}
+
+int halAnalogRead(uint8_t pin) {
+    MockPin* p = pinAt(pin);
+    return p ? p->analog : 0;
+}
+
+unsigned long halPulseIn(uint8_t pin, uint8_t level, unsigned long timeoutUs) {
+    MockPin* p = pinAt(pin);
+    if (!p || p->pulseUs == 0 || p->pulseUs > timeoutUs) {
+        hostClock().sleepUs(timeoutUs);
+        return 0;
+    }
+    hostClock().sleepUs(p->pulseUs);
+    return p->pulseUs;
+}
+
+unsigned long halMillis() {
+    return hostClock().nowUs() / 1000ULL;
+}
+
+unsigned long halMicros() {
+    return hostClock().nowUs();
+}
+
+void halDelay(unsigned long ms) {
+    hostClock().sleepUs(ms * 1000ULL);
+}
+
+void halDelayMicroseconds(unsigned int us) {
+    hostClock().sleepUs(us);
+}
+
+const uint32_t HOST_CPU_MHZ = 240; // The cycle counter ticks at the device's rate
+
+uint32_t halCycleCount() {
+    return (uint32_t)(hostClock().nowUs() * HOST_CPU_MHZ);
+}
+
+uint32_t halCpuMhz() {
+    return HOST_CPU_MHZ;
+}
+
+bool halLocalTime(struct tm* info, uint32_t timeoutMs) {
+    time_t now = hostClock().wallTime() + GMT_OFFSET_SEC + DAYLIGHT_OFFSET_SEC;
+    return gmtime_r(&now, info) != nullptr;
+}
+
+void halDhtBegin() {}
+
+float halDhtReadTemperature() {
+    hostClock().sleepUs(DHT_READ_US);
+    return dhtTemperature;
+}
+
+float halDhtReadHumidity() {
+    hostClock().sleepUs(DHT_READ_US);
+    return dhtHumidity;
+}
+
+void halSoilProbeBegin() {}
+
+float halSoilProbeReadC() {
+    hostClock().sleepUs(PROBE_CONVERSION_US);
+    return soilProbe;
+}
+
+uint32_t halFreeHeap() { return heapFree; }
+uint32_t halMinFreeHeap() { return heapMinFree; }
+uint32_t halLargestFreeBlock() { return heapLargest; }
+
+uint32_t halRandom() {
+    // xorshift32: reproducible runs from mockSeedRandom()
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+// ==========================================
+// C allocator hooks
+// ==========================================
+// Linked with -Wl,--wrap for each of these (see CMakeLists.txt): calls
+// from the sketch, compat and inline library code land here first.
+// Allocations libc and libstdc++ make internally are not seen.
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* p, size_t size);
+void __real_free(void* p);
+
+void* __wrap_malloc(size_t size) {
+    heapCountAllocation(size, __builtin_return_address(0));
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    heapCountAllocation(count * size, __builtin_return_address(0));
+    return __real_calloc(count, size);
+}
+
+// Counted as an allocation even when the block grows in place
+void* __wrap_realloc(void* p, size_t size) {
+    if (size > 0) heapCountAllocation(size, __builtin_return_address(0));
+    else heapCountFree(p);
+    return __real_realloc(p, size);
+}
+
+void __wrap_free(void* p) {
+    heapCountFree(p);
+    __real_free(p);
+}
+}
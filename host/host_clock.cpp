@@ -0,0 +1,40 @@
+#include "host_clock.h"
+
+static uint64_t monotonicNs() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+RealClock::RealClock() : bootNs(monotonicNs()) {}
+
+uint64_t RealClock::nowUs() {
+    return (monotonicNs() - bootNs) / 1000ULL;
+}
+
+void RealClock::sleepUs(uint64_t us) {
+    struct timespec wait = {(time_t)(us / 1000000ULL), (long)(us % 1000000ULL) * 1000L};
+    nanosleep(&wait, nullptr);
+}
+
+time_t RealClock::wallTime() {
+    return time(nullptr);
+}
+
+VirtualClock::VirtualClock(time_t startWallTime) : now(0), startWallTime(startWallTime) {}
+
+// Leaked on purpose, see hostSetClock()
+static HostClock& realClock() {
+    static RealClock* clock = new RealClock();
+    return *clock;
+}
+
+static HostClock* activeClock = nullptr;
+
+void hostSetClock(HostClock* clock) {
+    activeClock = clock;
+}
+
+HostClock& hostClock() {
+    return activeClock ? *activeClock : realClock();
+}
@@ -0,0 +1,63 @@
+#ifndef HOST_CLOCK_H
+#define HOST_CLOCK_H
+
+#include <stdint.h>
+#include <time.h>
+#include <atomic>
+
+// ==========================================
+// Host Clock
+// ==========================================
+// Every hal.h time call on the host (halMillis, halMicros, halDelay,
+// halDelayMicroseconds, halCycleCount, halLocalTime) reads the clock set
+// here, and so do the mock drivers' blocking reads. The default is the
+// real one. Swap in a VirtualClock and delays stop sleeping: they move
+// time forward, so a month of pump timeouts, measurement intervals and
+// alarm schedules runs as fast as the code between them.
+//
+// FreeRTOS waits (vTaskDelay, the HTTP task's select()) stay in real time.
+// They only pace background tasks and never decide anything by the clock.
+class HostClock {
+public:
+    virtual ~HostClock() {}
+    virtual uint64_t nowUs() = 0;            // Since boot
+    virtual void sleepUs(uint64_t us) = 0;
+    virtual time_t wallTime() = 0;           // UTC seconds
+};
+
+class RealClock : public HostClock {
+public:
+    RealClock();
+    uint64_t nowUs() override;
+    void sleepUs(uint64_t us) override;
+    time_t wallTime() override;
+
+private:
+    uint64_t bootNs;
+};
+
+// Starts at boot (0) with the wall clock at startWallTime. Safe to read
+// from any task; sleepUs() from several tasks at once adds up, so only the
+// loop task should advance it.
+class VirtualClock : public HostClock {
+public:
+    explicit VirtualClock(time_t startWallTime);
+    uint64_t nowUs() override { return now.load(std::memory_order_relaxed); }
+    void sleepUs(uint64_t us) override { now.fetch_add(us, std::memory_order_relaxed); }
+    time_t wallTime() override { return startWallTime + (time_t)(nowUs() / 1000000ULL); }
+
+    void advanceMs(uint64_t ms) { sleepUs(ms * 1000ULL); }
+
+private:
+    std::atomic<uint64_t> now;
+    time_t startWallTime;
+};
+
+// Before setup(): halMillis() must not go backwards under running code.
+// nullptr goes back to the real clock. Detached tasks (the server, the
+// log drain) keep reading it while the process exits, so it must never be
+// destroyed: allocate it and leave it.
+void hostSetClock(HostClock* clock);
+HostClock& hostClock();
+
+#endif // HOST_CLOCK_H
@@ -0,0 +1,37 @@
+#include "../Proyecto_Final_Arduino.ino"
+#include "host_clock.h"
+#include <signal.h>
+
+// The sketch as a Linux process: the Arduino core's main() is setup() and
+// then loop() forever. Sensors read the mock_hal.h defaults and the
+// dashboard is served on http://localhost:8080.
+//
+//   greenhouse                      real time, until killed
+//   greenhouse --days N [--start T] N days on a virtual clock starting at
+//                                   UTC epoch T (default 2025-01-01), then
+//                                   the loop profile and exit; status 1
+//                                   if loop() or the server task
+//                                   allocated after setup()
+const time_t DEFAULT_START = 1735689600; // 2025-01-01 00:00:00 UTC
+
+int main(int argc, char** argv) {
+    signal(SIGPIPE, SIG_IGN); // A client gone mid-send is a send() error, as with lwIP
+
+    unsigned long days = 0;
+    time_t start = DEFAULT_START;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!strcmp(argv[i], "--days")) days = strtoul(argv[i + 1], nullptr, 10);
+        else if (!strcmp(argv[i], "--start")) start = (time_t)strtoll(argv[i + 1], nullptr, 10);
+    }
+
+    VirtualClock& virtualClock = *new VirtualClock(start); // Never freed, see hostSetClock()
+    if (days > 0) hostSetClock(&virtualClock);
+
+    setup();
+    const unsigned long long endMs = days * 86400000ULL;
+    while (days == 0 || virtualClock.nowUs() / 1000ULL < endMs) loop();
+
+    logProfile();
+    vTaskDelay(pdMS_TO_TICKS(200)); // Let the log task drain
+    return getHeapSteadyStats().allocations > 0 ? 1 : 0;
+}
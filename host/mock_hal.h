@@ -0,0 +1,27 @@
+#ifndef MOCK_HAL_H
+#define MOCK_HAL_H
+
+#include <stdint.h>
+
+// ==========================================
+// Mock Drivers (host build)
+// ==========================================
+// hal_linux.cpp serves every hal.h read from the values set here and
+// records every write, so host code can stand in for the greenhouse.
+// Defaults after mockReset() are a quiet mid-range greenhouse: 25 °C / 60 %
+// air, 22 °C soil, soil and light at about half scale, tank half full,
+// PIR low.
+void mockReset();
+
+void mockSetDigitalInput(uint8_t pin, int level); // LOW->HIGH fires an attached rising interrupt
+void mockSetAnalog(uint8_t pin, int raw);          // 0-4095
+void mockSetPulse(uint8_t pin, unsigned long us);  // What halPulseIn() measures; 0: no echo
+void mockSetDht(float temperature, float humidity); // NAN: that read fails
+void mockSetSoilProbe(float celsius);              // HAL_PROBE_DISCONNECTED: no probe
+void mockSetHeap(uint32_t freeBytes, uint32_t largestBlock);
+void mockSeedRandom(uint32_t seed);
+
+int mockOutput(uint8_t pin);                 // Last level written
+unsigned int mockToneFrequency(uint8_t pin); // 0: silent
+
+#endif // MOCK_HAL_H
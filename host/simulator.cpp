@@ -0,0 +1,257 @@
+#include "config.h"
+#include "logic.h"
+#include "logger.h"
+#include "heap_monitor.h"
+#include "host_clock.h"
+#include "mock_hal.h"
+#include "greenhouse_model.h"
+#include <chrono>
+#include <stdarg.h>
+
+// ==========================================
+// greenhouse_sim
+// ==========================================
+// Runs the control code against GreenhouseModel on a virtual clock and
+// prints what it did: water, pump duty, soil and tank ranges, alarms.
+// Each step is one loop() pass as Proyecto_Final_Arduino.ino makes it,
+// measurement then automation under the state lock, then the heap sample,
+// without the WiFi and profiler bookkeeping. Steps are --step-ms apart
+// instead of 10 ms. PIR edges are latched by the interrupt either way, so
+// no motion is missed; the alarm just blinks at the step rate.
+//
+//   greenhouse_sim [--days 365] [--step-ms 1000] [--seed 1]
+//                  [--pir-per-day 3] [--clear-min 10] [--log]
+//
+// Security is armed 22:00-06:00 by the schedule. Nobody is there to clear
+// an alarm, so a neighbour does it after --clear-min minutes.
+//
+// Exits 1 after printing a FAIL line for each check that broke, which
+// makes a CTest run of it a regression test:
+//   - measurements came at the configured interval on the virtual clock
+//   - the irrigation pump never ran on an empty tank
+//   - nor on a tank reading below TANK_CRITICAL_LEVEL, nor for longer than
+//     one tank check below it in the model
+//   - nothing allocated after setup() (heap_monitor.h)
+const time_t SIM_START = 1735689600; // 2025-01-01 00:00:00 UTC
+
+struct Duty {
+    double onSeconds = 0;
+    unsigned long starts = 0;
+    double longestRun = 0;
+    double run = 0;
+    bool on = false;
+
+    void sample(bool now, double dt) {
+        if (now && !on) {
+            starts++;
+            run = 0;
+        }
+        on = now;
+        if (!on) return;
+        onSeconds += dt;
+        run += dt;
+        if (run > longestRun) longestRun = run;
+    }
+};
+
+struct Range {
+    double sum = 0;
+    double weight = 0;
+    double min = 1e9;
+    double max = -1e9;
+
+    void sample(double value, double dt) {
+        sum += value * dt;
+        weight += dt;
+        if (value < min) min = value;
+        if (value > max) max = value;
+    }
+    double mean() const { return weight > 0 ? sum / weight : 0; }
+};
+
+// Time between measurements, which the virtual clock must keep at the
+// configured interval however long a pass takes
+struct Cadence {
+    uint64_t lastUs = 0;
+    bool started = false;
+    double minGap = 1e9;
+    double maxGap = 0;
+
+    void sample(uint64_t nowUs) {
+        if (started) {
+            double gap = (nowUs - lastUs) / 1e6;
+            if (gap < minGap) minGap = gap;
+            if (gap > maxGap) maxGap = gap;
+        }
+        started = true;
+        lastUs = nowUs;
+    }
+};
+
+static int failures = 0;
+
+static void fail(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    fputs("FAIL: ", stderr);
+    vfprintf(stderr, format, args);
+    fputc('\n', stderr);
+    va_end(args);
+    failures++;
+}
+
+static double percent(double part, double whole) {
+    return whole > 0 ? 100.0 * part / whole : 0;
+}
+
+int main(int argc, char** argv) {
+    unsigned long days = 365;
+    unsigned long stepMs = 1000;
+    uint32_t seed = 1;
+    unsigned long clearMinutes = 10;
+    bool log = false;
+    ModelParams params;
+    for (int i = 1; i < argc; ++i) {
+        const char* option = argv[i];
+        if (!strcmp(option, "--log")) {
+            log = true;
+            continue;
+        }
+        const char* value = i + 1 < argc ? argv[++i] : nullptr;
+        if (!value) option = "";
+        if (!strcmp(option, "--days")) days = strtoul(value, nullptr, 10);
+        else if (!strcmp(option, "--step-ms")) stepMs = strtoul(value, nullptr, 10);
+        else if (!strcmp(option, "--seed")) seed = strtoul(value, nullptr, 10);
+        else if (!strcmp(option, "--pir-per-day")) params.pirEventsPerDay = atof(value);
+        else if (!strcmp(option, "--clear-min")) clearMinutes = strtoul(value, nullptr, 10);
+        else {
+            fprintf(stderr, "usage: %s [--days N] [--step-ms MS] [--seed N] [--pir-per-day N] [--clear-min N] [--log]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    if (stepMs == 0) stepMs = 1;
+
+    VirtualClock& clock = *new VirtualClock(SIM_START); // Never freed, see hostSetClock()
+    hostSetClock(&clock);
+    mockSeedRandom(seed);
+    GreenhouseModel model(params, seed);
+
+    if (log) {
+        Serial.begin(115200);
+        initLogging();
+    }
+    initActuators();
+    initSensors();
+    initLogic();
+    setSecuritySchedule("22:00", "06:00");
+    setSecurityAuto(true);
+    model.step(clock.wallTime(), 0); // First readings come from the model
+    heapMarkSteadyState();
+
+    Duty pump, tankPump, luminary, armed, alarm;
+    Range soil, tank;
+    Cadence cadence;
+    Duty belowCritical;  // Irrigating with the tank under TANK_CRITICAL_LEVEL
+    Duty onLowReading;   // ... and the firmware's reading saying so
+    unsigned long measurements = 0;
+    const uint64_t endUs = days * 86400000000ULL;
+    auto wallStart = std::chrono::steady_clock::now();
+
+    while (clock.nowUs() < endUs) {
+        uint64_t before = clock.nowUs();
+
+        bool measured;
+        SystemData data;
+        bool securityOn;
+        {
+            HeapScope heapScope(HEAP_LOGIC);
+            {
+                HeapScope sensorScope(HEAP_SENSORS);
+                measured = checkAndMeasure(); // Sampling moves the clock on by its own delays
+            }
+            lockState();
+            if (measured) checkSecurityOnly();
+            runAutomation();
+            data = getSystemData();
+            securityOn = getSecurityMode();
+            unlockState();
+            updateHeapStats();
+        }
+        if (measured) {
+            measurements++;
+            cadence.sample(before);
+        }
+
+        clock.advanceMs(stepMs);
+        double dt = (clock.nowUs() - before) / 1e6;
+        model.step(clock.wallTime(), dt);
+
+        pump.sample(data.pumpActive, dt);
+        tankPump.sample(data.tankPumpActive, dt);
+        luminary.sample(data.luminaryActive, dt);
+        armed.sample(securityOn, dt);
+        alarm.sample(data.status == STATUS_ALARM, dt);
+        soil.sample(model.soilMoisture(), dt);
+        tank.sample(100.0 * model.tankLevel(), dt);
+        belowCritical.sample(data.pumpActive && 100.0 * model.tankLevel() < TANK_CRITICAL_LEVEL, dt);
+        onLowReading.sample(data.pumpActive && data.tankLevel != -999 && data.tankLevel < TANK_CRITICAL_LEVEL, dt);
+
+        if (alarm.on && alarm.run >= clearMinutes * 60.0) {
+            lockState();
+            clearAlarm();
+            unlockState();
+        }
+    }
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    double simulated = clock.nowUs() / 1e6;
+    double simDays = simulated / 86400.0;
+
+    printf("Simulated %.1f days in %.2f s (%.0f days/min), step %lu ms, seed %u\n",
+           simDays, elapsed, elapsed > 0 ? simDays * 60.0 / elapsed : 0.0, stepMs, (unsigned)seed);
+    printf("Measurements        %lu, every %.0f-%.0f s\n", measurements, cadence.minGap, cadence.maxGap);
+    printf("Water irrigated     %.1f L (%.2f L/day), %.0f s pumping from an empty tank\n",
+           model.irrigatedLiters(), model.irrigatedLiters() / simDays, model.dryRunSeconds());
+    printf("Water refilled      %.1f L (%.2f L/day)\n", model.filledLiters(), model.filledLiters() / simDays);
+    printf("Irrigation pump     %.2f %% duty, %lu starts, longest %.0f s\n",
+           percent(pump.onSeconds, simulated), pump.starts, pump.longestRun);
+    printf("Tank pump           %.2f %% duty, %lu starts, longest %.0f s\n",
+           percent(tankPump.onSeconds, simulated), tankPump.starts, tankPump.longestRun);
+    printf("Luminary            %.1f %% on, %lu starts\n", percent(luminary.onSeconds, simulated), luminary.starts);
+    printf("Soil moisture       mean %.1f %%, min %.1f %%, max %.1f %% (threshold %d %%)\n",
+           soil.mean(), soil.min, soil.max, SOIL_MOISTURE_THRESHOLD);
+    printf("Tank level          mean %.1f %%, min %.1f %%, max %.1f %% (critical %d %%)\n",
+           tank.mean(), tank.min, tank.max, TANK_CRITICAL_LEVEL);
+    printf("Irrigating below    critical for %.0f s, longest %.0f s\n", belowCritical.onSeconds, belowCritical.longestRun);
+    printf("Security            armed %.1f %% of the time, %lu PIR events, %lu alarms, %.1f h in alarm\n",
+           percent(armed.onSeconds, simulated), model.pirEvents(), alarm.starts, alarm.onSeconds / 3600.0);
+    HeapSteadyStats steady = getHeapSteadyStats();
+    printf("Heap allocs         %lu after setup() (expected 0)\n", steady.allocations);
+
+    if (log) vTaskDelay(pdMS_TO_TICKS(200)); // Let the log task drain
+
+    // A step that measures can run up to a second of sensor delays past
+    // the next step boundary
+    double intervalS = DATA_SEND_INTERVAL_MIN * 60.0;
+    if (measurements < 2 || cadence.minGap <= intervalS || cadence.maxGap > intervalS + stepMs / 1000.0 + 1.0) {
+        fail("measurements every %.3f-%.3f s, expected just over %.0f s", cadence.minGap, cadence.maxGap, intervalS);
+    }
+    if (model.dryRunSeconds() > 0) {
+        fail("irrigation pump ran %.0f s on an empty tank", model.dryRunSeconds());
+    }
+    if (onLowReading.onSeconds > 0) {
+        fail("irrigation pump ran %.0f s on a tank reading below critical", onLowReading.onSeconds);
+    }
+    // The level is only known at readings, every TANK_MONITORING_ACTIVE_MS
+    // while a pump runs; crossing critical in between may go unseen that long
+    double tankCheckS = TANK_MONITORING_ACTIVE_MS / 1000.0 + stepMs / 1000.0 + 2.0;
+    if (belowCritical.longestRun > tankCheckS) {
+        fail("irrigation pump ran %.0f s with the tank below critical, more than one tank check (%.0f s)",
+             belowCritical.longestRun, tankCheckS);
+    }
+    if (steady.allocations > 0) {
+        fail("%lu allocations after setup(), last from %p", steady.allocations, steady.lastCaller);
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,366 @@
+#include "test_support.h"
+#include "action_parser.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// ==========================================
+// action_parser_test
+// ==========================================
+// parseActions() against the bodies the pages send (script.js, config.html),
+// the order the old ArduinoJson handleAction() applied keys in, the range
+// checks on config and duration, and seeded random input: whatever comes
+// in, the batch must stay within its bounds and never hold a value its
+// setting cannot take. A full batch of failing commands posted to /action
+// must come back whole. Prints parse time per recorded payload.
+
+// What JSON.stringify() produces for each sendAction()/saveConfig() call
+static const char* const RECORDED[] = {
+    "{\"irrigationAuto\":true}",
+    "{\"forceIrrigation\":true,\"duration\":15}",
+    "{\"forceIrrigation\":false,\"duration\":0}",
+    "{\"tankAuto\":false}",
+    "{\"forceTank\":true}",
+    "[{\"securityAuto\":false},{\"security\":true}]",
+    "[{\"security\":false}]",
+    "{\"securityAuto\":true}",
+    "{\"securityStart\":\"20:00\",\"securityEnd\":\"06:30\"}",
+    "{\"clearAlarm\":true}",
+    "{\"luminaryAuto\":true}",
+    "[{\"luminaryAuto\":false},{\"forceLuminary\":true}]",
+    "{\"config\":{\"soilDry\":3000,\"soilWet\":1200,\"soilThreshold\":40,\"tankEmpty\":100,\"tankFull\":20.5,"
+    "\"tankCritical\":15,\"lightMin\":100,\"lightMax\":3800,\"lightLow\":30,\"lightHigh\":70,\"dataSendInterval\":10,"
+    "\"serverPollingInterval\":5,\"statusPollingInterval\":2}}",
+};
+static const size_t RECORDED_COUNT = sizeof(RECORDED) / sizeof(RECORDED[0]);
+
+// Parses from an exact-size heap copy, so a read past the end is a read
+// past the allocation
+static bool parse(const std::string& body, ActionBatch& batch) {
+    std::vector<char> copy(body.begin(), body.end());
+    return parseActions(copy.data(), copy.size(), batch);
+}
+
+static std::vector<std::string> namesOf(const ActionBatch& batch) {
+    std::vector<std::string> names;
+    for (size_t i = 0; i < batch.count; ++i) names.push_back(batch.commands[i].name);
+    return names;
+}
+
+static void testRecorded() {
+    static ActionBatch batch;
+    for (size_t i = 0; i < RECORDED_COUNT; ++i) {
+        CHECK(parse(RECORDED[i], batch));
+        CHECK(batch.count > 0);
+        for (size_t j = 0; j < batch.count; ++j) CHECK(batch.commands[j].error == nullptr);
+    }
+
+    CHECK(parse(RECORDED[1], batch));
+    CHECK(batch.count == 1 && batch.commands[0].type == ACTION_FORCE_IRRIGATION);
+    CHECK(batch.commands[0].enable && batch.commands[0].duration == 15);
+
+    CHECK(parse(RECORDED[5], batch));
+    CHECK(namesOf(batch) == std::vector<std::string>({"securityAuto", "security"}));
+    CHECK(!batch.commands[0].enable && batch.commands[1].enable);
+
+    CHECK(parse(RECORDED[8], batch));
+    CHECK(batch.count == 1 && batch.commands[0].type == ACTION_SECURITY_SCHEDULE);
+    CHECK(!strcmp(batch.commands[0].start, "20:00") && !strcmp(batch.commands[0].end, "06:30"));
+
+    CHECK(parse(RECORDED[RECORDED_COUNT - 1], batch));
+    CHECK(batch.count == 1 && batch.commands[0].type == ACTION_CONFIG);
+    CHECK(batch.commands[0].configMask == (1 << CONFIG_FIELD_COUNT) - 1);
+    CHECK(batch.commands[0].config[CONFIG_TANK_FULL] == 20.5f);
+    CHECK(batch.commands[0].config[CONFIG_STATUS_POLLING_INTERVAL] == 2);
+}
+
+// The top-level keys in the order the old handleAction() tested and applied
+// them; securityStart/securityEnd set the schedule as one
+static const char* const OLD_ORDER[] = {
+    "irrigationAuto", "forceIrrigation", "config",   "tankAuto",   "forceTank",    "securityAuto",
+    "security",       "securitySchedule", "clearAlarm", "luminaryAuto", "forceLuminary",
+};
+
+static const struct {
+    const char* name; // As reported in the result
+    const char* members;
+} OBJECT_KEYS[] = {
+    {"irrigationAuto", "\"irrigationAuto\":true"},
+    {"forceIrrigation", "\"forceIrrigation\":true"},
+    {"forceIrrigation", "\"duration\":5"}, // Qualifies forceIrrigation only
+    {"config", "\"config\":{\"soilThreshold\":45}"},
+    {"tankAuto", "\"tankAuto\":false"},
+    {"forceTank", "\"forceTank\":true"},
+    {"securityAuto", "\"securityAuto\":false"},
+    {"security", "\"security\":true"},
+    {"securitySchedule", "\"securityStart\":\"21:00\""},
+    {"securitySchedule", "\"securityEnd\":\"05:00\""},
+    {"clearAlarm", "\"clearAlarm\":true"},
+    {"luminaryAuto", "\"luminaryAuto\":false"},
+    {"forceLuminary", "\"forceLuminary\":true"},
+};
+static const size_t OBJECT_KEY_COUNT = sizeof(OBJECT_KEYS) / sizeof(OBJECT_KEYS[0]);
+
+// Any subset of the keys, in any order, in one object must come out in
+// OLD_ORDER, the order the pages have always relied on
+static void testOldOrder() {
+    static ActionBatch batch;
+    std::mt19937 random(41);
+    for (int round = 0; round < 20000; ++round) {
+        std::vector<size_t> keys;
+        for (size_t i = 0; i < OBJECT_KEY_COUNT; ++i) {
+            if (random() & 1) keys.push_back(i);
+        }
+        std::shuffle(keys.begin(), keys.end(), random);
+
+        std::string body = "{";
+        std::vector<std::string> sent;
+        for (size_t key : keys) {
+            if (body.size() > 1) body += ",";
+            body += OBJECT_KEYS[key].members;
+            sent.push_back(OBJECT_KEYS[key].name);
+        }
+        body += "}";
+
+        std::vector<std::string> expected;
+        for (const char* name : OLD_ORDER) {
+            if (std::find(sent.begin(), sent.end(), name) == sent.end()) continue;
+            if (!strcmp(name, "forceIrrigation") &&
+                std::find(keys.begin(), keys.end(), (size_t)1) == keys.end()) {
+                continue; // duration alone is ignored
+            }
+            expected.push_back(name);
+        }
+
+        bool ok = parse(body, batch);
+        CHECK(ok);
+        if (!ok || namesOf(batch) != expected) {
+            CHECK(namesOf(batch) == expected);
+            fprintf(stderr, "  body: %s\n", body.c_str());
+            return;
+        }
+        for (size_t i = 1; i < batch.count; ++i) CHECK(batch.commands[i - 1].type < batch.commands[i].type);
+    }
+
+    // Objects in an array keep array order, each sorted on its own
+    CHECK(parse("[{\"forceLuminary\":true,\"luminaryAuto\":false},{\"luminaryAuto\":true}]", batch));
+    CHECK(namesOf(batch) == std::vector<std::string>({"luminaryAuto", "forceLuminary", "luminaryAuto"}));
+
+    // A repeated key keeps its place and takes the last value, as a
+    // JSON document would have
+    CHECK(parse("{\"security\":true,\"securityAuto\":true,\"security\":false}", batch));
+    CHECK(namesOf(batch) == std::vector<std::string>({"securityAuto", "security"}));
+    CHECK(!batch.commands[1].enable);
+
+    // Config members are applied in ConfigField order whatever the sending order
+    CHECK(parse("{\"config\":{\"statusPollingInterval\":3,\"soilDry\":2900,\"lightLow\":25}}", batch));
+    CHECK(batch.commands[0].configMask ==
+          ((1 << CONFIG_STATUS_POLLING_INTERVAL) | (1 << CONFIG_SOIL_DRY) | (1 << CONFIG_LIGHT_LOW)));
+}
+
+static const char* const CONFIG_KEYS[CONFIG_FIELD_COUNT] = {
+    "soilDry",  "soilWet",  "soilThreshold", "tankEmpty",        "tankFull",
+    "tankCritical", "lightMin", "lightMax", "lightLow", "lightHigh", "dataSendInterval",
+    "serverPollingInterval", "statusPollingInterval",
+};
+static const int CONFIG_MIN[CONFIG_FIELD_COUNT] = {0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 1, 1, 1};
+static const int CONFIG_MAX[CONFIG_FIELD_COUNT] = {4095, 4095, 100, 400, 400, 100, 4095, 4095, 100, 100, 1440, 3600, 3600};
+
+static std::string configBody(int field, const std::string& value) {
+    return std::string("[{\"config\":{\"") + CONFIG_KEYS[field] + "\":" + value + "}},{\"forceTank\":true}]";
+}
+
+static void testRanges() {
+    static ActionBatch batch;
+    for (int field = 0; field < CONFIG_FIELD_COUNT; ++field) {
+        std::string message = std::string(CONFIG_KEYS[field]) + " must be " + std::to_string(CONFIG_MIN[field]) +
+                              "-" + std::to_string(CONFIG_MAX[field]);
+        const std::string outside[] = {std::to_string(CONFIG_MIN[field] - 1), std::to_string(CONFIG_MAX[field] + 1),
+                                       "1e39", "-1e39"};
+        for (const std::string& value : outside) {
+            CHECK(parse(configBody(field, value), batch));
+            CHECK(batch.count == 2);
+            CHECK(batch.commands[0].error && message == batch.commands[0].error);
+            CHECK(batch.commands[0].configMask == 0);
+            CHECK(batch.commands[1].error == nullptr); // The rest of the batch still applies
+        }
+        const std::string inside[] = {std::to_string(CONFIG_MIN[field]), std::to_string(CONFIG_MAX[field])};
+        for (const std::string& value : inside) {
+            CHECK(parse(configBody(field, value), batch));
+            CHECK(batch.commands[0].error == nullptr);
+            CHECK(batch.commands[0].configMask == 1 << field);
+            CHECK(batch.commands[0].config[field] == atoi(value.c_str()));
+        }
+        CHECK(parse(configBody(field, "\"10\""), batch));
+        CHECK(batch.commands[0].error && !strcmp(batch.commands[0].error, "config values must be numbers"));
+    }
+
+    const char* const durations[] = {"1441", "-1", "1e10", "-1e39"};
+    for (const char* duration : durations) {
+        CHECK(parse(std::string("{\"forceIrrigation\":true,\"duration\":") + duration + "}", batch));
+        CHECK(batch.count == 1 && batch.commands[0].error);
+        CHECK(batch.commands[0].error && !strcmp(batch.commands[0].error, "duration must be 0-1440"));
+    }
+    CHECK(parse("{\"forceIrrigation\":true,\"duration\":1440}", batch));
+    CHECK(!batch.commands[0].error && batch.commands[0].duration == 1440);
+    CHECK(parse("{\"forceIrrigation\":true,\"duration\":\"5\"}", batch));
+    CHECK(batch.commands[0].error && !strcmp(batch.commands[0].error, "duration must be a number"));
+
+    CHECK(parse("{\"securityStart\":\"20:00\"}", batch));
+    CHECK(batch.commands[0].error && !strcmp(batch.commands[0].error, "securityStart and securityEnd go together"));
+    CHECK(parse("{\"securityStart\":\"2000\",\"securityEnd\":\"06:30\"}", batch));
+    CHECK(batch.commands[0].error && !strcmp(batch.commands[0].error, "expected \"HH:MM\""));
+    CHECK(parse("{\"security\":\"on\",\"lamp\":true}", batch));
+    CHECK(batch.count == 2);
+    CHECK(batch.commands[0].error && !strcmp(batch.commands[0].error, "expected a boolean"));
+    CHECK(batch.commands[1].error && !strcmp(batch.commands[1].error, "unknown command"));
+}
+
+static void testMalformed() {
+    static ActionBatch batch;
+    const char* const bodies[] = {
+        "", " ", "{", "}", "[", "[]]", "{\"security\":}", "{\"security\" true}", "{\"security\":tru}",
+        "{\"security\":true,}", "{\"security\":true} x", "{\"a\":\"unterminated}", "{\"a\":\"ctl\x01\"}",
+        "[{\"security\":true} {\"security\":false}]", "{\"config\":{\"soilDry\":}}", "{\"a\":-}", "{\"a\":1.}",
+        "{\"a\":1e}", "\"security\"", "true",
+    };
+    for (const char* body : bodies) {
+        bool ok = parse(body, batch);
+        CHECK(!ok);
+        CHECK(batch.count == 0 && batch.error);
+        CHECK(batch.errorOffset <= strlen(body));
+        if (ok) fprintf(stderr, "  accepted: %s\n", body);
+    }
+
+    std::string deep = "{\"a\":" + std::string(100000, '[') + std::string(100000, ']') + "}";
+    CHECK(!parse(deep, batch));
+    CHECK(batch.error && !strcmp(batch.error, "nested too deep"));
+
+    std::string many = "[";
+    for (size_t i = 0; i <= ACTION_MAX_COMMANDS; ++i) many += i ? ",{\"clearAlarm\":true}" : "{\"clearAlarm\":true}";
+    many += "]";
+    CHECK(!parse(many, batch));
+    CHECK(batch.count == 0 && batch.error && !strcmp(batch.error, "too many commands"));
+
+    std::string longName = "{\"" + std::string(200, 'k') + "\":1}";
+    CHECK(parse(longName, batch));
+    CHECK(batch.count == 1 && strlen(batch.commands[0].name) == ACTION_NAME_SIZE - 1);
+}
+
+// The promises of action_parser.h, whatever the input was
+static bool batchHolds(const ActionBatch& batch, bool ok, size_t length) {
+    if (!ok) return batch.count == 0 && batch.error && batch.errorOffset <= length;
+    if (batch.error || batch.count > ACTION_MAX_COMMANDS) return false;
+    for (size_t i = 0; i < batch.count; ++i) {
+        const ActionCommand& command = batch.commands[i];
+        if (command.type > ACTION_UNKNOWN) return false;
+        if (!memchr(command.name, '\0', sizeof(command.name))) return false;
+        if (!memchr(command.start, '\0', sizeof(command.start)) || !memchr(command.end, '\0', sizeof(command.end))) {
+            return false;
+        }
+        if (command.error) continue;
+        if (command.type == ACTION_FORCE_IRRIGATION && (command.duration < 0 || command.duration > 1440)) return false;
+        for (int field = 0; field < CONFIG_FIELD_COUNT; ++field) {
+            if (!(command.configMask & (1 << field))) continue;
+            float value = command.config[field];
+            if (!(value >= CONFIG_MIN[field] && value <= CONFIG_MAX[field])) return false;
+        }
+    }
+    return true;
+}
+
+static std::string mutate(std::string body, std::mt19937& random) {
+    static const char TOKENS[] = "{}[]\":,.-+eE0123456789 tfnul\\";
+    int edits = 1 + random() % 4;
+    for (int i = 0; i < edits; ++i) {
+        size_t at = body.empty() ? 0 : random() % body.size();
+        char ch = random() % 4 ? TOKENS[random() % (sizeof(TOKENS) - 1)] : (char)(random() & 0xff);
+        switch (random() % 5) {
+            case 0: if (!body.empty()) body[at] = ch; break;
+            case 1: body.insert(at, 1, ch); break;
+            case 2: if (!body.empty()) body.erase(at, 1); break;
+            case 3: body.resize(at); break;
+            default: body.insert(at, RECORDED[random() % RECORDED_COUNT]); break;
+        }
+    }
+    return body;
+}
+
+static void fuzz() {
+    const int ROUNDS = 300000;
+    static ActionBatch batch;
+    std::mt19937 random(1041);
+    int accepted = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        std::string body;
+        if (round % 10 == 0) {
+            body.resize(random() % 64);
+            for (char& ch : body) ch = (char)(random() & 0xff);
+        } else {
+            body = mutate(RECORDED[random() % RECORDED_COUNT], random);
+        }
+        bool ok = parse(body, batch);
+        accepted += ok;
+        if (!batchHolds(batch, ok, body.size())) {
+            CHECK(batchHolds(batch, ok, body.size()));
+            fprintf(stderr, "  body (%zu bytes): %s\n", body.size(), body.c_str());
+            return;
+        }
+    }
+    printf("Fuzz                %d bodies, %d parsed, all within bounds\n", ROUNDS, accepted);
+}
+
+// ACTION_MAX_COMMANDS unknown keys, each as long as a name is kept and
+// made of quotes that double in size when escaped: a reply larger than the
+// server's scratch buffer, which has to arrive chunked and complete
+static void testFullBatchReply() {
+    std::string name;
+    while (name.size() + 2 < ACTION_NAME_SIZE) name += "\\\"";
+    std::string body = "[";
+    for (size_t i = 0; i < ACTION_MAX_COMMANDS; ++i) body += std::string(i ? "," : "") + "{\"" + name + "\":true}";
+    body += "]";
+
+    HttpConnection client;
+    CHECK(client.send("POST /action HTTP/1.1\r\nHost: localhost\r\nContent-Type: application/json\r\nContent-Length: " +
+                      std::to_string(body.size()) + "\r\n\r\n" + body));
+    HttpResponse response;
+    CHECK(client.read(response));
+    CHECK(response.status == 200);
+    CHECK(response.chunked);
+
+    std::string escaped;
+    for (char ch : name) escaped += ch == '"' ? "\\\"" : "\\\\";
+    std::string result = "{\"command\":\"" + escaped + "\",\"ok\":false,\"error\":\"unknown command\"}";
+    std::string expected = "{\"success\":false,\"results\":[";
+    for (size_t i = 0; i < ACTION_MAX_COMMANDS; ++i) expected += (i ? "," : "") + result;
+    expected += "]}";
+    CHECK(response.body == expected);
+    printf("Full batch reply    %zu bytes\n", response.body.size());
+}
+
+static void bench() {
+    const int ROUNDS = 200000;
+    static ActionBatch batch;
+    size_t commands = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        const char* body = RECORDED[round % RECORDED_COUNT];
+        parseActions(body, strlen(body), batch);
+        commands += batch.count;
+    }
+    double elapsed = secondsSince(start);
+    printf("parseActions        %.2f us per recorded payload, %zu commands\n", elapsed * 1e6 / ROUNDS, commands);
+}
+
+int main() {
+    testRecorded();
+    testOldOrder();
+    testRanges();
+    testMalformed();
+    fuzz();
+    bench();
+
+    startSketch(0);
+    testFullBatchReply();
+    return testResult();
+}
@@ -0,0 +1,248 @@
+#include "test_support.h"
+#include "json_stream.h"
+#include <vector>
+
+// ==========================================
+// data_json_test
+// ==========================================
+// JsonStreamWriter and /data. The writer's output is checked against a
+// literal, then /data is fetched both ways the server can produce it: from
+// the shared cache with a Content-Length, and streamed as chunked output
+// (/data?since=0 renders the same full document past the scratch buffer).
+// Both must be byte-identical. Every state endpoint must revalidate with a
+// 304. Prints serializer and endpoint throughput.
+
+// Print sink that takes whatever the writer flushes, in any block size
+class StringPrint : public Print {
+public:
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t size) override {
+        text.append((const char*)data, size);
+        flushes++;
+        return size;
+    }
+
+    std::string text;
+    unsigned long flushes = 0;
+};
+
+class NullPrint : public Print {
+public:
+    size_t write(uint8_t) override { return 1; }
+    size_t write(const uint8_t*, size_t size) override { return size; }
+};
+
+static void writeSample(JsonStreamWriter& json) {
+    json.beginObject();
+    json.field("a", 8.6f);
+    json.field("b", -999);
+    json.field("c", 0.1f);
+    json.field("d", 1.0f);
+    json.field("neg", -0.25f);
+    json.field("negZero", -0.001f);
+    json.field("nan", NAN);
+    json.field("big", 1e30f);
+    json.field("s", "quote\" back\\ nl\n tab\t ctl\x01");
+    json.field("t", true);
+    json.field("u", 4294967295UL);
+    json.beginArray("arr");
+    json.field(nullptr, 1);
+    json.field(nullptr, 2.5f);
+    json.endArray();
+    json.beginObject("o");
+    json.endObject();
+    json.endObject();
+}
+
+static const char SAMPLE_JSON[] =
+    "{\"a\":8.6,\"b\":-999,\"c\":0.1,\"d\":1,\"neg\":-0.25,\"negZero\":0,\"nan\":null,\"big\":null,"
+    "\"s\":\"quote\\\" back\\\\ nl\\u000a tab\\u0009 ctl\\u0001\",\"t\":true,\"u\":4294967295,"
+    "\"arr\":[1,2.5],\"o\":{}}";
+
+// A history-sized document, well past the writer's 128-byte buffer
+static void writeRecords(JsonStreamWriter& json, int records) {
+    json.beginObject();
+    json.beginArray("history");
+    for (int i = 0; i < records; ++i) {
+        json.beginObject();
+        json.field("temp", 18.0f + 0.37f * i);
+        json.field("humidity", 40.0f + 1.3f * i);
+        json.field("soil", 30 + i);
+        json.field("tank", 60 - i);
+        json.field("light", 10 + 2 * i);
+        json.field("timestamp", 601000UL * i);
+        json.field("heapFree", 180000UL);
+        json.field("heapBlock", 110000UL);
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+}
+
+static size_t countOf(const std::string& text, const char* needle) {
+    size_t count = 0;
+    for (size_t at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1)) count++;
+    return count;
+}
+
+// Every value that follows key in the text, in order
+static std::vector<unsigned long> valuesOf(const std::string& text, const char* key) {
+    std::vector<unsigned long> values;
+    for (size_t at = text.find(key); at != std::string::npos; at = text.find(key, at + 1)) {
+        values.push_back(strtoul(text.c_str() + at + strlen(key), nullptr, 10));
+    }
+    return values;
+}
+
+static void testWriter() {
+    char buffer[512];
+    BufferPrint out(buffer, sizeof(buffer));
+    {
+        JsonStreamWriter json(out);
+        writeSample(json);
+        CHECK(json.bytesWritten() == strlen(SAMPLE_JSON));
+    }
+    CHECK(!out.overflowed());
+    CHECK(std::string(buffer, out.size()) == SAMPLE_JSON);
+
+    // Same bytes whether the sink is a fixed buffer or takes 128-byte flushes
+    static char large[16384];
+    BufferPrint whole(large, sizeof(large));
+    StringPrint pieces;
+    {
+        JsonStreamWriter a(whole);
+        JsonStreamWriter b(pieces);
+        writeRecords(a, 24);
+        writeRecords(b, 24);
+    }
+    CHECK(!whole.overflowed());
+    CHECK(pieces.flushes > 1);
+    CHECK(pieces.text == std::string(large, whole.size()));
+
+    // Too small a buffer reports it instead of returning a cut document
+    char tiny[16];
+    BufferPrint small(tiny, sizeof(tiny));
+    {
+        JsonStreamWriter json(small);
+        writeSample(json);
+    }
+    CHECK(small.overflowed());
+}
+
+static void benchWriter() {
+    const int ROUNDS = 20000;
+    NullPrint sink;
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ROUNDS; ++i) {
+        JsonStreamWriter json(sink);
+        writeRecords(json, 24);
+        bytes += json.bytesWritten();
+    }
+    double elapsed = secondsSince(start);
+    printf("JsonStreamWriter    %.1f MB/s, %.1f us per 24-record history (%zu bytes)\n",
+           bytes / elapsed / 1e6, elapsed * 1e6 / ROUNDS, bytes / ROUNDS);
+}
+
+static void testData() {
+    HttpConnection client;
+    CHECK(client.connected());
+
+    HttpResponse cached = client.get("/data");
+    HttpResponse streamed = client.get("/data?since=0");
+    CHECK(cached.status == 200);
+    CHECK(streamed.status == 200);
+    CHECK(!cached.chunked); // Fits the 8 KB cache
+    CHECK(streamed.chunked); // Past the 1.5 KB scratch buffer
+    CHECK(cached.body == streamed.body);
+    CHECK(cached.body.front() == '{' && cached.body.back() == '}');
+    CHECK(countOf(cached.body, "\"timestamp\":") == MAX_HISTORY);
+    CHECK(cached.body.find("\"historySize\":" + std::to_string(MAX_HISTORY)) != std::string::npos);
+
+    // A delta after the fourth-newest record carries the last three
+    std::vector<unsigned long> timestamps = valuesOf(cached.body, "\"timestamp\":");
+    HttpResponse delta = client.get("/data?since=" + std::to_string(timestamps[MAX_HISTORY - 4]));
+    CHECK(delta.status == 200);
+    CHECK(delta.body.find("\"historyDelta\":true") != std::string::npos);
+    CHECK(valuesOf(delta.body, "\"timestamp\":") ==
+          std::vector<unsigned long>(timestamps.end() - 3, timestamps.end()));
+
+    // Revalidation: same version, same ETag, no body
+    std::string etag = cached.header("ETag");
+    CHECK(!etag.empty());
+    HttpResponse notModified = client.get("/data", "If-None-Match: " + etag + "\r\n");
+    CHECK(notModified.status == 304);
+    CHECK(notModified.body.empty());
+}
+
+// Every state endpoint answers its own ETag with a bare 304, and a state
+// change makes the old one stale
+static void testRevalidation() {
+    HttpConnection client;
+    const char* const paths[] = {"/status", "/config", "/history", "/data"};
+    for (const char* path : paths) {
+        HttpResponse full = client.get(path);
+        std::string etag = full.header("ETag");
+        CHECK(full.status == 200 && !etag.empty());
+        HttpResponse again = client.get(path, "If-None-Match: " + etag + "\r\n");
+        CHECK(again.status == 304);
+        CHECK(again.header("ETag") == etag);
+        CHECK(again.body.empty());
+    }
+
+    std::string statusEtag = client.get("/status").header("ETag");
+    std::string configEtag = client.get("/config").header("ETag");
+    lockState();
+    setLuminaryManual(!getLuminaryMode());
+    unlockState();
+    HttpResponse changed = client.get("/status", "If-None-Match: " + statusEtag + "\r\n");
+    CHECK(changed.status == 200);
+    CHECK(changed.header("ETag") != statusEtag);
+    CHECK(client.get("/config", "If-None-Match: " + configEtag + "\r\n").status == 304); // Config untouched
+}
+
+static void benchNotModified() {
+    const int REQUESTS = 5000;
+    HttpConnection client;
+    std::string condition = "If-None-Match: " + client.get("/data").header("ETag") + "\r\n";
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REQUESTS; ++i) {
+        if (client.get("/data", condition).status != 304) {
+            CHECK(!"revalidation returned a body");
+            return;
+        }
+    }
+    double elapsed = secondsSince(start);
+    printf("GET /data 304        %.0f req/s over one keep-alive connection\n", REQUESTS / elapsed);
+}
+
+static void benchData(const char* path) {
+    const int REQUESTS = 2000;
+    HttpConnection client;
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REQUESTS; ++i) {
+        HttpResponse response = client.get(path);
+        if (response.status != 200) {
+            CHECK(response.status == 200);
+            return;
+        }
+        bytes += response.body.size();
+    }
+    double elapsed = secondsSince(start);
+    printf("GET %-16s %.0f req/s, %.1f MB/s over one keep-alive connection\n", path, REQUESTS / elapsed,
+           bytes / elapsed / 1e6);
+}
+
+int main() {
+    testWriter();
+    benchWriter();
+
+    startSketch(MAX_HISTORY + 3); // The ring has wrapped
+    testData();
+    testRevalidation();
+    benchData("/data");
+    benchData("/data?since=0");
+    benchNotModified();
+    return testResult();
+}
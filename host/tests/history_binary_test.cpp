@@ -0,0 +1,208 @@
+#include "test_support.h"
+#include "history_binary.h"
+#include <math.h>
+#include <vector>
+
+// ==========================================
+// history_binary_test
+// ==========================================
+// /history in both encodings must carry the same records: the packed
+// layout from history_binary.h is decoded here and compared value by value
+// with the JSON, for the full ring and for a delta. Prints payload size
+// and encode/serve time for each, the figures the binary format exists for.
+
+struct Record {
+    unsigned long timestamp;
+    float temp;
+    float humidity;
+    int soil;
+    int tank;
+    int light;
+};
+
+struct History {
+    bool delta = false;
+    unsigned long since = 0;
+    size_t ringSize = 0;
+    std::vector<Record> records;
+};
+
+static uint32_t readLE(const std::string& data, size_t at, size_t bytes) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) value |= (uint32_t)(uint8_t)data[at + i] << (8 * i);
+    return value;
+}
+
+static float readF32(const std::string& data, size_t at) {
+    uint32_t bits = readLE(data, at, 4);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static bool decodeBinary(const std::string& data, History& out) {
+    if (data.size() < HistoryBinaryWriter::HEADER_SIZE || (uint8_t)data[0] != HISTORY_BINARY_VERSION) return false;
+    size_t n = readLE(data, 2, 2);
+    if (data.size() != HistoryBinaryWriter::encodedSize(n)) return false;
+    out.delta = data[1] & HISTORY_FLAG_DELTA;
+    out.ringSize = readLE(data, 4, 2);
+    out.since = readLE(data, 8, 4);
+    out.records.assign(n, Record());
+
+    size_t column = HistoryBinaryWriter::HEADER_SIZE;
+    for (size_t i = 0; i < n; ++i) out.records[i].timestamp = readLE(data, column + 4 * i, 4);
+    column += 4 * n;
+    for (size_t i = 0; i < n; ++i) out.records[i].temp = readF32(data, column + 4 * i);
+    column += 4 * n;
+    for (size_t i = 0; i < n; ++i) out.records[i].humidity = readF32(data, column + 4 * i);
+    column += 4 * n;
+    for (size_t i = 0; i < n; ++i) out.records[i].soil = (int16_t)readLE(data, column + 2 * i, 2);
+    column += 2 * n;
+    for (size_t i = 0; i < n; ++i) out.records[i].tank = (int16_t)readLE(data, column + 2 * i, 2);
+    column += 2 * n;
+    for (size_t i = 0; i < n; ++i) out.records[i].light = (int16_t)readLE(data, column + 2 * i, 2);
+    return true;
+}
+
+// The history fields of the JSON, in document order
+static std::vector<double> numbersOf(const std::string& json, const char* key) {
+    std::string needle = std::string("\"") + key + "\":";
+    std::vector<double> values;
+    for (size_t at = json.find(needle); at != std::string::npos; at = json.find(needle, at + 1)) {
+        values.push_back(strtod(json.c_str() + at + needle.size(), nullptr));
+    }
+    return values;
+}
+
+static bool decodeJson(const std::string& json, History& out) {
+    std::vector<double> timestamps = numbersOf(json, "timestamp");
+    std::vector<double> temps = numbersOf(json, "temp");
+    std::vector<double> humidities = numbersOf(json, "humidity");
+    std::vector<double> soils = numbersOf(json, "soil");
+    std::vector<double> tanks = numbersOf(json, "tank");
+    std::vector<double> lights = numbersOf(json, "light");
+    size_t n = timestamps.size();
+    if (temps.size() != n || humidities.size() != n || soils.size() != n || tanks.size() != n || lights.size() != n) {
+        return false;
+    }
+    out.delta = json.find("\"historyDelta\":true") != std::string::npos;
+    std::vector<double> since = numbersOf(json, "since");
+    out.since = since.empty() ? 0 : (unsigned long)since[0];
+    std::vector<double> ringSize = numbersOf(json, "historySize");
+    out.ringSize = ringSize.empty() ? 0 : (size_t)ringSize[0];
+    out.records.clear();
+    for (size_t i = 0; i < n; ++i) {
+        out.records.push_back({(unsigned long)timestamps[i], (float)temps[i], (float)humidities[i], (int)soils[i],
+                               (int)tanks[i], (int)lights[i]});
+    }
+    return true;
+}
+
+// JSON floats carry two decimals
+static bool sameFloat(float json, float binary) {
+    return fabsf(json - binary) <= 0.0051f;
+}
+
+static void compare(const History& json, const History& binary) {
+    CHECK(json.delta == binary.delta);
+    CHECK(json.since == binary.since);
+    CHECK(json.ringSize == binary.ringSize);
+    CHECK(json.records.size() == binary.records.size());
+    for (size_t i = 0; i < json.records.size() && i < binary.records.size(); ++i) {
+        const Record& a = json.records[i];
+        const Record& b = binary.records[i];
+        CHECK(a.timestamp == b.timestamp);
+        CHECK(sameFloat(a.temp, b.temp));
+        CHECK(sameFloat(a.humidity, b.humidity));
+        CHECK(a.soil == b.soil);
+        CHECK(a.tank == b.tank);
+        CHECK(a.light == b.light);
+    }
+}
+
+static const char ACCEPT_BINARY[] = "Accept: application/octet-stream\r\n";
+
+static void testHistory() {
+    HttpConnection client;
+    CHECK(client.connected());
+
+    HttpResponse json = client.get("/history");
+    HttpResponse binary = client.get("/history", ACCEPT_BINARY);
+    CHECK(json.status == 200);
+    CHECK(binary.status == 200);
+    CHECK(json.header("Content-Type") == "application/json");
+    CHECK(binary.header("Content-Type") == HISTORY_BINARY_TYPE);
+    CHECK(json.header("ETag") != binary.header("ETag"));
+    CHECK(binary.body.size() == HistoryBinaryWriter::encodedSize(MAX_HISTORY));
+
+    History fromJson, fromBinary;
+    CHECK(decodeJson(json.body, fromJson));
+    CHECK(decodeBinary(binary.body, fromBinary));
+    CHECK(fromBinary.records.size() == MAX_HISTORY);
+    CHECK(!fromBinary.delta);
+    compare(fromJson, fromBinary);
+
+    // The readings moved every record, so equal values are not a fluke
+    for (size_t i = 1; i < fromBinary.records.size(); ++i) {
+        CHECK(fromBinary.records[i].timestamp > fromBinary.records[i - 1].timestamp);
+        CHECK(fromBinary.records[i].temp != fromBinary.records[i - 1].temp);
+    }
+
+    // Delta after the fifth-newest record
+    std::string since = std::to_string(fromBinary.records[MAX_HISTORY - 5].timestamp);
+    HttpResponse jsonDelta = client.get("/history?since=" + since);
+    HttpResponse binaryDelta = client.get("/history?since=" + since, ACCEPT_BINARY);
+    History jsonTail, binaryTail;
+    CHECK(decodeJson(jsonDelta.body, jsonTail));
+    CHECK(decodeBinary(binaryDelta.body, binaryTail));
+    CHECK(binaryTail.delta);
+    CHECK(binaryTail.records.size() == 4);
+    compare(jsonTail, binaryTail);
+}
+
+class NullPrint : public Print {
+public:
+    size_t write(uint8_t) override { return 1; }
+    size_t write(const uint8_t*, size_t size) override { return size; }
+};
+
+static void benchEncode() {
+    const int ROUNDS = 100000;
+    NullPrint sink;
+    lockState();
+    HistoryRing ring = history;
+    unlockState();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ROUNDS; ++i) {
+        HistoryBinaryWriter writer(sink);
+        writer.write(ring, 0, false, 0);
+    }
+    double elapsed = secondsSince(start);
+    printf("Binary encode       %.2f us per %u-record history\n", elapsed * 1e6 / ROUNDS, (unsigned)ring.size());
+}
+
+static void benchServe(const char* label, const std::string& headers) {
+    const int REQUESTS = 2000;
+    HttpConnection client;
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < REQUESTS; ++i) {
+        HttpResponse response = client.get("/history", headers);
+        if (response.status != 200) {
+            CHECK(response.status == 200);
+            return;
+        }
+        bytes = response.body.size();
+    }
+    double elapsed = secondsSince(start);
+    printf("GET /history %-6s %zu bytes, %.1f us per request\n", label, bytes, elapsed * 1e6 / REQUESTS);
+}
+
+int main() {
+    startSketch(MAX_HISTORY + 5);
+    testHistory();
+    benchEncode();
+    benchServe("json", "");
+    benchServe("binary", ACCEPT_BINARY);
+    return testResult();
+}
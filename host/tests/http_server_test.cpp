@@ -0,0 +1,328 @@
+#include "test_support.h"
+#include "web_assets.h"
+#include <zlib.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// ==========================================
+// http_server_test
+// ==========================================
+// HttpServer connection handling through the real routes: pipelined
+// requests on one keep-alive socket answered in order, a request that
+// trickles in a byte at a time, HTTP/1.0 closing after its response, the
+// reuse counters at /metrics agreeing with what was sent, the
+// /debug/profile budget only changing on a valid POST, a client that stops
+// reading its large replies never holding up the others, and event streams
+// that keep up or stall while state changes are pushed. Then every
+// slot loaded at once, with keep-alive and with a handshake per request,
+// printing requests per second for each.
+
+// A sample from /metrics, read on the given connection
+static unsigned long metric(HttpConnection& client, const char* name) {
+    HttpResponse response = client.get("/metrics");
+    std::string needle = std::string("\n") + name + " ";
+    size_t at = response.body.find(needle);
+    CHECK(at != std::string::npos);
+    return at == std::string::npos ? 0 : strtoul(response.body.c_str() + at + needle.size(), nullptr, 10);
+}
+
+static std::string post(const std::string& path, const std::string& body) {
+    return "POST " + path + " HTTP/1.1\r\nHost: localhost\r\nContent-Type: application/json\r\nContent-Length: " +
+           std::to_string(body.size()) + "\r\n\r\n" + body;
+}
+
+static std::string getRequest(const std::string& path) {
+    return "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+}
+
+static void testPipelined() {
+    HttpConnection client;
+    CHECK(client.connected());
+    unsigned long pipelined = metric(client, "http_pipelined_requests_total");
+    unsigned long keepAlive = metric(client, "http_keepalive_requests_total");
+    unsigned long accepted = metric(client, "http_connections_accepted_total");
+
+    // Everything in one write, as a browser pipelining or a proxy would
+    std::string batch = getRequest("/status") + getRequest("/config") + getRequest("/data") +
+                        post("/action", "[{\"luminaryAuto\":false},{\"forceLuminary\":true}]") +
+                        getRequest("/missing") + getRequest("/history");
+    CHECK(batch.size() < HTTP_REQUEST_BUFFER_SIZE);
+    CHECK(client.send(batch));
+
+    const int expected[] = {200, 200, 200, 200, 404, 200};
+    HttpResponse responses[6];
+    for (int i = 0; i < 6; ++i) {
+        CHECK(client.read(responses[i]));
+        CHECK(responses[i].status == expected[i]);
+    }
+    CHECK(responses[0].body.find("\"luminary\"") != std::string::npos);
+    CHECK(responses[1].body.find("\"soilDry\"") != std::string::npos);
+    CHECK(responses[2].body.find("\"history\"") != std::string::npos);
+    CHECK(responses[3].body.find("\"success\":true") != std::string::npos);
+    CHECK(responses[5].body.find("\"history\"") != std::string::npos);
+    CHECK(getLuminaryMode() && !getLuminaryAuto()); // The action was applied, in order
+
+    // More requests than the request buffer holds at once: the rest waits
+    // in the socket and is read as the buffer drains
+    const int BURST = 40;
+    std::string burst;
+    for (int i = 0; i < BURST; ++i) burst += getRequest("/status");
+    CHECK(burst.size() > HTTP_REQUEST_BUFFER_SIZE);
+    CHECK(client.send(burst));
+    int ok = 0;
+    for (int i = 0; i < BURST; ++i) {
+        HttpResponse response;
+        if (client.read(response) && response.status == 200) ok++;
+    }
+    CHECK(ok == BURST);
+
+    // Six metrics reads, six pipelined and BURST requests, all on this
+    // one socket: no new handshake, every request after the first reused it
+    const unsigned long sent = 3 + 6 + BURST;
+    CHECK(metric(client, "http_connections_accepted_total") == accepted);
+    CHECK(metric(client, "http_keepalive_requests_total") - keepAlive >= sent);
+    CHECK(metric(client, "http_pipelined_requests_total") - pipelined >= 5 + BURST - 1);
+}
+
+// A request written a byte at a time, headers and body
+static void testTrickle() {
+    HttpConnection client;
+    std::string request = post("/action", "{\"forceLuminary\":false}");
+    for (char ch : request) {
+        CHECK(client.send(std::string(1, ch)));
+        usleep(200);
+    }
+    HttpResponse response;
+    CHECK(client.read(response));
+    CHECK(response.status == 200);
+    CHECK(response.body.find("\"success\":true") != std::string::npos);
+    CHECK(!getLuminaryMode());
+
+    // The same connection still serves the next request
+    CHECK(client.get("/status").status == 200);
+}
+
+static void testHttp10() {
+    HttpConnection client;
+    CHECK(client.send("GET /status HTTP/1.0\r\n\r\n"));
+    HttpResponse response;
+    CHECK(client.read(response));
+    CHECK(response.status == 200);
+    CHECK(!response.chunked);
+    HttpResponse none;
+    CHECK(!client.read(none)); // Closed by the server
+}
+
+// The loop budget only changes on a POST with a value in range
+static void testProfileBudget() {
+    HttpConnection client;
+    const std::string before = "\"budgetMs\":" + std::to_string(LOOP_BUDGET_MS);
+
+    HttpResponse read = client.get("/debug/profile?budget=0&reset=1");
+    CHECK(read.status == 200);
+    CHECK(read.body.find(before) != std::string::npos);
+
+    const char* const rejected[] = {"0", "60001", "-5", "abc", "", "10ms", "99999999999999999999"};
+    for (const char* value : rejected) {
+        HttpResponse response;
+        CHECK(client.send(post(std::string("/debug/profile?budget=") + value, "")));
+        CHECK(client.read(response));
+        CHECK(response.status == 400);
+    }
+    CHECK(client.get("/debug/profile").body.find(before) != std::string::npos);
+
+    unsigned long original = LOOP_BUDGET_MS;
+    HttpResponse changed;
+    CHECK(client.send(post("/debug/profile?budget=400", "")));
+    CHECK(client.read(changed));
+    CHECK(changed.status == 200);
+    CHECK(changed.body.find("\"budgetMs\":400") != std::string::npos);
+    CHECK(LOOP_BUDGET_MS == 400);
+    LOOP_BUDGET_MS = original;
+}
+
+// The sample names of a Prometheus body, in order, without their values
+static std::vector<std::string> metricNames(const std::string& body) {
+    std::vector<std::string> names;
+    for (size_t at = 0; at < body.size();) {
+        size_t end = body.find('\n', at);
+        if (end == std::string::npos) end = body.size();
+        if (body[at] != '#') names.push_back(body.substr(at, body.find(' ', at) - at));
+        at = end + 1;
+    }
+    return names;
+}
+
+// A client pipelines more /metrics and identity script.js requests than the
+// socket buffers hold, then stops reading. Its replies wait in its own
+// queue while another client is served as usual; once it reads again every
+// body arrives whole, rendered or inflated a piece at a time.
+static void testSlowReader() {
+    const int ROUNDS = 100;
+    HttpConnection slow(4096);
+    std::string requests;
+    for (int i = 0; i < ROUNDS; ++i) requests += getRequest("/metrics") + getRequest(ASSET_SCRIPT_JS.path);
+    CHECK(slow.send(requests));
+    usleep(200000); // Until the socket is full
+
+    HttpConnection other;
+    double slowest = 0;
+    for (int i = 0; i < 50; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        CHECK(other.get("/status").status == 200);
+        slowest = std::max(slowest, secondsSince(start));
+    }
+    CHECK(slowest < 0.5);
+    const std::vector<std::string> names = metricNames(other.get("/metrics").body);
+
+    // The gzip trailer holds the CRC-32 of the uncompressed asset
+    const uint8_t* trailer = (const uint8_t*)ASSET_SCRIPT_JS.gzip + ASSET_SCRIPT_JS.gzipLength - 8;
+    uint32_t crc = trailer[0] | trailer[1] << 8 | trailer[2] << 16 | (uint32_t)trailer[3] << 24;
+    int whole = 0;
+    for (int i = 0; i < ROUNDS; ++i) {
+        HttpResponse metrics, script;
+        if (!slow.read(metrics) || !slow.read(script)) break;
+        bool ok = metrics.status == 200 && metrics.chunked && metricNames(metrics.body) == names &&
+                  script.status == 200 && script.header("Content-Encoding").empty() &&
+                  script.body.size() == ASSET_SCRIPT_JS.size &&
+                  crc32(0, (const Bytef*)script.body.data(), script.body.size()) == crc;
+        whole += ok;
+    }
+    CHECK(whole == ROUNDS);
+    printf("Slow reader         %d rounds of /metrics and %zu-byte script.js whole, slowest other request %.2f ms\n", ROUNDS,
+           ASSET_SCRIPT_JS.size, slowest * 1000);
+}
+
+// An event stream after its response head, split into frames; false if
+// any of them is not a whole "event: <name>\ndata: <json>\n\n". A stream
+// the server dropped may end inside a frame, which EventSource discards.
+static bool splitFrames(const std::string& stream, std::vector<std::string>& frames, bool dropped = false) {
+    frames.clear();
+    size_t at = stream.find("\r\n\r\n");
+    if (at == std::string::npos) return false;
+    for (at += 4; at < stream.size();) {
+        size_t end = stream.find("\n\n", at);
+        if (end == std::string::npos) {
+            if (dropped) break;
+            return false;
+        }
+        frames.push_back(stream.substr(at, end - at));
+        at = end + 2;
+    }
+    for (const std::string& frame : frames) {
+        if (frame == "retry: 3000") continue;
+        size_t data = frame.find("\ndata: {");
+        if (frame.compare(0, 7, "event: ") != 0 || data == std::string::npos || frame.back() != '}' ||
+            frame.find('\n', data + 1) != std::string::npos || frame.find("event: ", 1) != std::string::npos) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int countEvents(const std::vector<std::string>& frames, const char* event) {
+    std::string prefix = std::string("event: ") + event + "\n";
+    int count = 0;
+    for (const std::string& frame : frames) count += frame.compare(0, prefix.size(), prefix) == 0;
+    return count;
+}
+
+// Two dashboards on /events while the luminary is toggled: the one that
+// keeps reading gets every state change as a whole frame; the one that
+// stopped reading is dropped once the socket and its backlog are full, and
+// what reached it until then has no torn frame. Requests are served
+// throughout, with the stalled stream never waited on.
+static void testEventStreams() {
+    HttpConnection control;
+    const unsigned long dropped = metric(control, "http_event_streams_dropped_total");
+    HttpConnection reader;
+    HttpConnection stalled(4096);
+    CHECK(reader.send(getRequest("/events")));
+    CHECK(stalled.send(getRequest("/events")));
+    std::string readerStream;
+    while (readerStream.find("event: state") == std::string::npos && reader.readSome(readerStream)) {
+    }
+    reader.setReadTimeout(200);
+
+    // Toggled until the stalled stream is dropped; how long that takes
+    // depends on the kernel's socket buffers
+    const int MAX_TOGGLES = 200000;
+    int toggles = 0;
+    double slowest = 0;
+    while (toggles < MAX_TOGGLES) {
+        auto start = std::chrono::steady_clock::now();
+        HttpResponse response;
+        CHECK(control.send(post("/action", toggles % 2 ? "{\"forceLuminary\":false}" : "{\"forceLuminary\":true}")));
+        CHECK(control.read(response));
+        CHECK(response.status == 200);
+        slowest = std::max(slowest, secondsSince(start));
+        toggles++;
+        if (toggles % 100 == 0) reader.readSome(readerStream);
+        if (toggles % 1000 == 0 && metric(control, "http_event_streams_dropped_total") > dropped) break;
+    }
+    CHECK(metric(control, "http_event_streams_dropped_total") == dropped + 1);
+
+    // Toggles handled in one server pass share a frame, so the count varies;
+    // the last frame has the final state (an even number of toggles: off)
+    while (reader.readSome(readerStream)) {
+    }
+    std::vector<std::string> frames;
+    CHECK(splitFrames(readerStream, frames));
+    CHECK(!frames.empty() && frames.back().find("\"luminary\":false") != std::string::npos);
+
+    std::string stalledStream;
+    while (stalled.readSome(stalledStream)) {
+    }
+    std::vector<std::string> stalledFrames;
+    CHECK(splitFrames(stalledStream, stalledFrames, true));
+    CHECK(countEvents(stalledFrames, "state") < countEvents(frames, "state"));
+    printf("Event streams       %d frames to the reader, stalled reader dropped after %d, slowest request %.2f ms\n",
+           countEvents(frames, "state"), countEvents(stalledFrames, "state"), slowest * 1000);
+}
+
+// Each client runs its requests on one keep-alive connection, or opens a
+// new one per request with Connection: close
+static void load(int clients, int requestsEach, bool keepAlive) {
+    std::vector<std::thread> threads;
+    std::vector<int> served(clients, 0);
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < clients; ++t) {
+        threads.emplace_back([t, requestsEach, keepAlive, &served]() {
+            if (keepAlive) {
+                HttpConnection client;
+                for (int i = 0; i < requestsEach; ++i) {
+                    if (client.get("/status").status == 200) served[t]++;
+                }
+                return;
+            }
+            for (int i = 0; i < requestsEach; ++i) {
+                HttpConnection client;
+                if (client.get("/status", "Connection: close\r\n").status == 200) served[t]++;
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    double elapsed = secondsSince(start);
+
+    int total = 0;
+    for (int count : served) total += count;
+    CHECK(total == clients * requestsEach);
+    printf("GET /status %d client(s), %-10s %.0f req/s\n", clients, keepAlive ? "keep-alive" : "close", total / elapsed);
+}
+
+int main() {
+    startSketch(MAX_HISTORY);
+    testPipelined();
+    testTrickle();
+    testHttp10();
+    testProfileBudget();
+    testSlowReader();
+    testEventStreams();
+
+    // At most HTTP_MAX_CONNECTIONS clients, so none is turned away with a 503
+    load(1, 4000, true);
+    load(HTTP_MAX_CONNECTIONS, 4000, true);
+    load(HTTP_MAX_CONNECTIONS, 500, false);
+    return testResult();
+}
@@ -0,0 +1,100 @@
+#include "test_support.h"
+#include "hal.h"
+
+// ==========================================
+// pump_safety_test
+// ==========================================
+// The automatic pump rules in checkSecurityOnly() and checkAndMeasure(),
+// run pass by pass on a virtual clock the way loop() runs them:
+// - auto irrigation needs the tank above TANK_CRITICAL_LEVEL, and auto-fill
+//   starts at the critical level, so a tank resting on it is refilled;
+// - the tank is re-read every TANK_MONITORING_ACTIVE_MS while a pump runs,
+//   so filling stops when full and irrigation stops when the tank runs low;
+// - auto irrigation runs one burst per measurement: after the timeout it
+//   waits for fresh readings instead of restarting on the old dry one.
+
+static VirtualClock* virtualClock;
+static unsigned long irrigationStarts = 0;
+
+// One loop() pass, as greenhouse_sim drives it, then a second of idle
+static void pass() {
+    int before = mockOutput(RELAY_PIN);
+    bool measured = checkAndMeasure();
+    lockState();
+    if (measured) checkSecurityOnly();
+    runAutomation();
+    unlockState();
+    if (before != HIGH && mockOutput(RELAY_PIN) == HIGH) irrigationStarts++;
+    virtualClock->advanceMs(1000);
+}
+
+static void runFor(unsigned long ms) {
+    unsigned long start = halMillis();
+    while (halMillis() - start < ms) pass();
+}
+
+// The echo time that readTankLevelPercent() turns into exactly `percent`
+// at the mock's default 25 °C / 60 % air
+static void setTank(int percent) {
+    float cmPerUs = (331.3f + 0.606f * 25 + 0.0124f * 60) / 10000.0f;
+    float distanceCm = TANK_DEPTH_CM - percent / 100.0f * (TANK_DEPTH_CM - TANK_MIN_DISTANCE);
+    long guess = lroundf(2.0f * distanceCm / cmPerUs);
+    long first = -1, last = -1;
+    for (long us = guess - 40; us <= guess + 40; ++us) {
+        mockSetPulse(ECHO_PIN, us);
+        if (readTankLevelPercent(25, 60) != percent) continue;
+        if (first < 0) first = us;
+        last = us;
+    }
+    CHECK(first >= 0);
+    mockSetPulse(ECHO_PIN, (first + last) / 2); // Middle of the band, clear of rounding
+}
+
+int main() {
+    virtualClock = new VirtualClock(1735689600); // Never freed, see hostSetClock()
+    hostSetClock(virtualClock);
+    initActuators();
+    initSensors();
+    initLogic();
+    virtualClock->advanceMs(1000);
+    const unsigned long measureMs = DATA_SEND_INTERVAL_MIN * 60000UL;
+
+    // Dry soil, tank exactly at critical: no irrigation, the tank fills
+    mockSetAnalog(SOIL_MOISTURE_PIN, SOIL_DRY);
+    setTank(TANK_CRITICAL_LEVEL);
+    unsigned long firstMeasurement = halMillis();
+    pass();
+    CHECK(getSystemData().tankLevel == TANK_CRITICAL_LEVEL);
+    CHECK(mockOutput(RELAY_PIN) == LOW);
+    CHECK(mockOutput(RELAY_TANK_PIN) == HIGH);
+
+    // Full again: seen by the tank-only reading within a minute, then the
+    // still-dry soil starts one burst
+    setTank(100);
+    runFor(TANK_MONITORING_ACTIVE_MS + 3000);
+    CHECK(mockOutput(RELAY_TANK_PIN) == LOW);
+    CHECK(mockOutput(RELAY_PIN) == HIGH);
+    CHECK(irrigationStarts == 1);
+
+    // The burst times out and stays off until the next measurement
+    runFor(PUMP_RUN_TIME_MS + 2000);
+    CHECK(mockOutput(RELAY_PIN) == LOW);
+    runFor(measureMs - (halMillis() - firstMeasurement) - 5000);
+    CHECK(mockOutput(RELAY_PIN) == LOW);
+    CHECK(irrigationStarts == 1);
+
+    // Fresh readings, still dry: one more burst
+    runFor(10000);
+    CHECK(mockOutput(RELAY_PIN) == HIGH);
+    CHECK(irrigationStarts == 2);
+
+    // The tank drops under critical mid-burst: the next tank-only reading
+    // stops irrigation and starts the fill
+    setTank(TANK_CRITICAL_LEVEL - 5);
+    runFor(TANK_MONITORING_ACTIVE_MS + 3000);
+    CHECK(mockOutput(RELAY_PIN) == LOW);
+    CHECK(mockOutput(RELAY_TANK_PIN) == HIGH);
+    CHECK(getSystemData().tankLevel == TANK_CRITICAL_LEVEL - 5);
+    CHECK(irrigationStarts == 2);
+    return testResult();
+}
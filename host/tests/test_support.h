@@ -0,0 +1,211 @@
+#ifndef TEST_SUPPORT_H
+#define TEST_SUPPORT_H
+
+#include "config.h"
+#include "logic.h"
+#include "actuators.h"
+#include "sensors.h"
+#include "web_server.h"
+#include "host_clock.h"
+#include "mock_hal.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+
+// ==========================================
+// Host test support
+// ==========================================
+// The tests in this directory run the real sketch modules (greenhouse_core)
+// in-process: sensors on the mock HAL, the clock virtual, the web server
+// task listening on HTTP_PORT. They talk to it over loopback with the
+// small blocking client below, print their figures and exit 1 if a CHECK
+// failed. One server per process, so CTest runs them under the http_port
+// resource lock.
+
+inline int testFailures = 0;
+
+#define CHECK(condition)                                                                  \
+    do {                                                                                  \
+        if (!(condition)) {                                                               \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+            testFailures++;                                                               \
+        }                                                                                 \
+    } while (0)
+
+inline int testResult() {
+    if (testFailures > 0) fprintf(stderr, "%d check(s) failed\n", testFailures);
+    return testFailures > 0 ? 1 : 0;
+}
+
+inline double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Boots the modules setup() would and takes `records` measurements, one
+// DATA_SEND_INTERVAL_MIN apart on a virtual clock, each with different
+// readings so the history has something to tell apart
+inline VirtualClock& startSketch(size_t records) {
+    VirtualClock& clock = *new VirtualClock(1735689600); // 2025-01-01 00:00:00 UTC; never freed, see hostSetClock()
+    signal(SIGPIPE, SIG_IGN);
+    hostSetClock(&clock);
+    initActuators();
+    initSensors();
+    initLogic();
+    setupWebServer();
+
+    for (size_t i = 0; i < records; ++i) {
+        mockSetDht(18.0f + 0.37f * i, 40.0f + 1.3f * i);
+        mockSetAnalog(SOIL_MOISTURE_PIN, 1200 + 37 * (int)i);
+        mockSetAnalog(LDR_PIN, 300 + 101 * (int)i);
+        mockSetPulse(ECHO_PIN, 500 + 9 * i);
+        clock.advanceMs(DATA_SEND_INTERVAL_MIN * 60000UL + 1000);
+        checkAndMeasure();
+    }
+    return clock;
+}
+
+struct HttpResponse {
+    int status = 0;
+    std::string headers; // Raw, status line included
+    std::string body;    // De-chunked
+    bool chunked = false;
+
+    // Value of the first header with this name, "" if absent
+    std::string header(const char* name) const {
+        std::string key = std::string("\r\n") + name + ":";
+        size_t at = 0;
+        while ((at = headers.find("\r\n", at)) != std::string::npos) {
+            if (strncasecmp(headers.c_str() + at, key.c_str(), key.size()) == 0) {
+                size_t start = headers.find_first_not_of(' ', at + key.size());
+                return headers.substr(start, headers.find("\r\n", start) - start);
+            }
+            at += 2;
+        }
+        return "";
+    }
+};
+
+// One keep-alive connection. Responses are read in order from a private
+// buffer, so several pipelined requests can be sent before reading any.
+// receiveBuffer, when set, shrinks the socket's receive buffer so a client
+// that stops reading backs the server up quickly.
+class HttpConnection {
+public:
+    explicit HttpConnection(int receiveBuffer = 0) {
+        struct sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(HTTP_PORT);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        for (int attempt = 0; attempt < 100; ++attempt) { // The server task may still be starting
+            fd = socket(AF_INET, SOCK_STREAM, 0);
+            if (receiveBuffer > 0) setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+            if (connect(fd, (struct sockaddr*)&address, sizeof(address)) == 0) break;
+            close(fd);
+            fd = -1;
+            usleep(20000);
+        }
+        if (fd >= 0) {
+            int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            struct timeval timeout = {10, 0};
+            setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        }
+    }
+    ~HttpConnection() {
+        if (fd >= 0) close(fd);
+    }
+    HttpConnection(const HttpConnection&) = delete;
+    HttpConnection& operator=(const HttpConnection&) = delete;
+
+    bool connected() const { return fd >= 0; }
+
+    // How long a read waits for the next bytes, 10 s by default
+    void setReadTimeout(int ms) {
+        struct timeval timeout = {ms / 1000, (ms % 1000) * 1000};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+
+    bool send(const std::string& raw) {
+        size_t sent = 0;
+        while (sent < raw.size()) {
+            ssize_t n = ::send(fd, raw.data() + sent, raw.size() - sent, 0);
+            if (n <= 0) return false;
+            sent += n;
+        }
+        return true;
+    }
+
+    bool read(HttpResponse& response) {
+        response = HttpResponse();
+        size_t end;
+        while ((end = pending.find("\r\n\r\n")) == std::string::npos) {
+            if (!fill()) return false;
+        }
+        response.headers = pending.substr(0, end + 2);
+        pending.erase(0, end + 4);
+        response.status = atoi(response.headers.c_str() + 9); // "HTTP/1.1 200"
+
+        std::string length = response.header("Content-Length");
+        response.chunked = strcasecmp(response.header("Transfer-Encoding").c_str(), "chunked") == 0;
+        if (!response.chunked) {
+            size_t size = length.empty() ? 0 : strtoul(length.c_str(), nullptr, 10);
+            return take(response.body, size);
+        }
+        while (true) {
+            while ((end = pending.find("\r\n")) == std::string::npos) {
+                if (!fill()) return false;
+            }
+            size_t size = strtoul(pending.c_str(), nullptr, 16);
+            pending.erase(0, end + 2);
+            std::string chunk;
+            if (!take(chunk, size + 2)) return false; // Data and its CRLF
+            if (size == 0) return true;
+            response.body.append(chunk, 0, size);
+        }
+    }
+
+    // Whatever arrived next, appended to out, for bodies with no length
+    // (/events); false once the server closed the socket or timed out
+    bool readSome(std::string& out) {
+        if (pending.empty() && !fill()) return false;
+        out += pending;
+        pending.clear();
+        return true;
+    }
+
+    // A request and its response on this connection
+    HttpResponse get(const std::string& path, const std::string& extraHeaders = "") {
+        HttpResponse response;
+        send("GET " + path + " HTTP/1.1\r\nHost: localhost\r\n" + extraHeaders + "\r\n");
+        read(response);
+        return response;
+    }
+
+private:
+    bool fill() {
+        char buffer[4096];
+        ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+        if (n <= 0) return false;
+        pending.append(buffer, n);
+        return true;
+    }
+
+    bool take(std::string& out, size_t size) {
+        while (pending.size() < size) {
+            if (!fill()) return false;
+        }
+        out.assign(pending, 0, size);
+        pending.erase(0, size);
+        return true;
+    }
+
+    int fd = -1;
+    std::string pending;
+};
+
+#endif // TEST_SUPPORT_H
@@ -0,0 +1,813 @@
+#include "http_server.h"
+#include "json_stream.h"
+#include "logger.h"
+#include "hal.h"
+#include <lwip/sockets.h>
+#include <errno.h>
+
+static const char* statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 408: return "Request Timeout";
+        case 413: return "Payload Too Large";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 501: return "Not Implemented";
+        case 503: return "Service Unavailable";
+        default:  return "";
+    }
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Decodes %XX and '+' in place; the result is never longer than the input
+static void urlDecode(char* text) {
+    char* out = text;
+    for (char* in = text; *in; ++in) {
+        if (*in == '+') {
+            *out++ = ' ';
+        } else if (*in == '%' && hexValue(in[1]) >= 0 && hexValue(in[2]) >= 0) {
+            *out++ = (char)(hexValue(in[1]) * 16 + hexValue(in[2]));
+            in += 2;
+        } else {
+            *out++ = *in;
+        }
+    }
+    *out = '\0';
+}
+
+static void setNonBlocking(int fd) {
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+HttpServer::HttpServer(uint16_t port)
+    : port(port), listenFd(-1), routeCount(0), collectedCount(0), current(nullptr) {
+    memset(&counters, 0, sizeof(counters));
+    memset(&unmatched, 0, sizeof(unmatched));
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; ++i) {
+        connections[i].fd = -1;
+    }
+    resetResponse();
+}
+
+void HttpServer::begin() {
+    listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        LOG_ERROR("HTTP", "Error creando socket");
+        return;
+    }
+
+    int enable = 1;
+    ::setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+
+    if (::bind(listenFd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+        ::listen(listenFd, HTTP_MAX_CONNECTIONS) < 0) {
+        LOG_ERROR("HTTP", "Error abriendo puerto");
+        ::close(listenFd);
+        listenFd = -1;
+        return;
+    }
+    setNonBlocking(listenFd);
+}
+
+void HttpServer::on(const char* uri, HTTPMethod method, THandlerFunction handler) {
+    if (routeCount >= HTTP_MAX_ROUTES) {
+        LOG_ERROR("HTTP", "Route table full, ignoring %s", uri);
+        return;
+    }
+    routes[routeCount].uri = uri;
+    routes[routeCount].method = method;
+    routes[routeCount].handler = handler;
+    memset(&routes[routeCount].stats, 0, sizeof(HttpRouteStats));
+    routeCount++;
+}
+
+void HttpServer::onNotFound(THandlerFunction handler) {
+    notFoundHandler = handler;
+}
+
+void HttpServer::collectHeaders(const char* headerKeys[], size_t count) {
+    collectedCount = 0;
+    for (size_t i = 0; i < count && collectedCount < HTTP_MAX_COLLECTED_HEADERS; ++i) {
+        collectedKeys[collectedCount++] = headerKeys[i];
+    }
+}
+
+// ==========================================
+// Connection Handling
+// ==========================================
+
+void HttpServer::waitForActivity(unsigned long timeoutMs) {
+    if (listenFd < 0) {
+        halDelay(timeoutMs);
+        return;
+    }
+
+    fd_set readSet, writeSet;
+    FD_ZERO(&readSet);
+    FD_ZERO(&writeSet);
+    FD_SET(listenFd, &readSet);
+    int maxFd = listenFd;
+
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; ++i) {
+        const Connection& c = connections[i];
+        if (c.fd < 0) continue;
+        if (c.ready) timeoutMs = 0; // Pipelined request already buffered
+        FD_SET(c.fd, c.sending ? &writeSet : &readSet);
+        if (c.fd > maxFd) maxFd = c.fd;
+    }
+
+    struct timeval timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_usec = (timeoutMs % 1000) * 1000;
+    ::select(maxFd + 1, &readSet, &writeSet, nullptr, &timeout);
+}
+
+void HttpServer::handleClient() {
+    if (listenFd < 0) return;
+
+    acceptConnections();
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; ++i) {
+        if (connections[i].fd >= 0) service(connections[i]);
+    }
+}
+
+void HttpServer::acceptConnections() {
+    while (true) {
+        int fd = ::accept(listenFd, nullptr, nullptr);
+        if (fd < 0) return; // Backlog drained
+
+        Connection* slot = nullptr;
+        for (int i = 0; i < HTTP_MAX_CONNECTIONS && !slot; ++i) {
+            if (connections[i].fd < 0) slot = &connections[i];
+        }
+        if (!slot) {
+            // All slots taken: reclaim the keep-alive connection idle the longest.
+            // Only one that has served a request qualifies; a connection
+            // accepted in the same burst is waiting for its first request,
+            // and on a tie in lastActivity it would be dropped unanswered.
+            unsigned long now = halMillis();
+            for (int i = 0; i < HTTP_MAX_CONNECTIONS; ++i) {
+                Connection& c = connections[i];
+                if (c.sending || c.received > 0 || c.requestCount == 0) continue;
+                if (!slot || now - c.lastActivity > now - slot->lastActivity) slot = &c;
+            }
+            if (slot) {
+                closeConnection(*slot);
+                counters.idleEvictions++;
+            }
+        }
+        if (!slot) {
+            static const char busy[] = "HTTP/1.1 503 Service Unavailable\r\n"
+                                       "Connection: close\r\n"
+                                       "Content-Length: 0\r\n\r\n";
+            ::send(fd, busy, sizeof(busy) - 1, MSG_DONTWAIT);
+            ::close(fd);
+            counters.connectionsRejected++;
+            continue;
+        }
+
+        setNonBlocking(fd);
+        int enable = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        slot->fd = fd;
+        slot->requestCount = 0;
+        resetConnection(*slot);
+        counters.connectionsAccepted++;
+    }
+}
+
+void HttpServer::service(Connection& c) {
+    if (c.sending) {
+        writePending(c);
+        if (c.fd >= 0 && c.sending && halMillis() - c.lastActivity > HTTP_SEND_TIMEOUT_MS) {
+            closeConnection(c);
+        }
+        return;
+    }
+
+    readRequest(c);
+    c.ready = false;
+
+    // Requests already in the buffer are answered back to back, in order;
+    // a static body still draining holds the rest until it is done
+    while (c.fd >= 0 && !c.sending) {
+        bool complete = (c.headerLength > 0 || parseHead(c)) &&
+                        c.received >= c.headerLength + c.contentLength;
+        if (c.fd < 0) return; // Rejected by parseHead
+
+        if (!complete) {
+            if (halMillis() - c.lastActivity > HTTP_IDLE_TIMEOUT_MS) {
+                closeConnection(c); // Idle keep-alive or a stalled request
+                counters.idleTimeouts++;
+            }
+            return;
+        }
+        dispatch(c);
+    }
+}
+
+void HttpServer::readRequest(Connection& c) {
+    size_t space = HTTP_REQUEST_BUFFER_SIZE - c.received;
+    if (space == 0) return;
+
+    int n = ::recv(c.fd, c.buffer + c.received, space, MSG_DONTWAIT);
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        closeConnection(c); // Peer closed or reset
+        return;
+    }
+    if (n > 0) {
+        c.received += n;
+        c.buffer[c.received] = '\0';
+        c.lastActivity = halMillis();
+    }
+}
+
+// Parses the request head in place once the blank line has arrived. Returns
+// false while it is incomplete; malformed or oversized requests are answered
+// and closed here.
+bool HttpServer::parseHead(Connection& c) {
+    char* end = strstr(c.buffer, "\r\n\r\n");
+    if (!end) {
+        if (c.received >= HTTP_REQUEST_BUFFER_SIZE) sendError(c, 431);
+        return false;
+    }
+    char* blankLine = end + 2;
+    c.headerLength = blankLine + 2 - c.buffer;
+
+    // Request line: METHOD SP target SP version
+    char* line = c.buffer;
+    char* next = strstr(line, "\r\n");
+    *next = '\0';
+    char* target = strchr(line, ' ');
+    char* version = target ? strchr(target + 1, ' ') : nullptr;
+    if (!version) {
+        sendError(c, 400);
+        return false;
+    }
+    *target++ = '\0';
+    *version++ = '\0';
+
+    c.http11 = strcmp(version, "HTTP/1.1") == 0;
+    c.keepAlive = c.http11;
+    c.head = false;
+    if (!strcmp(line, "GET")) c.method = HTTP_GET;
+    else if (!strcmp(line, "HEAD")) { c.method = HTTP_GET; c.head = true; }
+    else if (!strcmp(line, "POST")) c.method = HTTP_POST;
+    else if (!strcmp(line, "PUT")) c.method = HTTP_PUT;
+    else if (!strcmp(line, "PATCH")) c.method = HTTP_PATCH;
+    else if (!strcmp(line, "DELETE")) c.method = HTTP_DELETE;
+    else if (!strcmp(line, "OPTIONS")) c.method = HTTP_OPTIONS;
+    else {
+        sendError(c, 501);
+        return false;
+    }
+
+    // Header lines
+    for (line = next + 2; line < blankLine; line = next + 2) {
+        next = strstr(line, "\r\n");
+        *next = '\0';
+        char* colon = strchr(line, ':');
+        if (!colon) continue;
+        *colon = '\0';
+        char* value = colon + 1;
+        while (*value == ' ' || *value == '\t') value++;
+
+        if (!strcasecmp(line, "Content-Length")) {
+            c.contentLength = strtoul(value, nullptr, 10);
+        } else if (!strcasecmp(line, "Connection")) {
+            if (!strcasecmp(value, "close")) c.keepAlive = false;
+            else if (!strcasecmp(value, "keep-alive")) c.keepAlive = true;
+        }
+        for (int k = 0; k < collectedCount; ++k) {
+            if (!strcasecmp(line, collectedKeys[k])) c.headerValues[k] = value;
+        }
+    }
+
+    if (c.contentLength > HTTP_REQUEST_BUFFER_SIZE - c.headerLength) {
+        sendError(c, 413);
+        return false;
+    }
+
+    c.path = target;
+    char* query = strchr(target, '?');
+    if (query) {
+        *query++ = '\0';
+        parseQuery(c, query);
+    }
+    c.body = c.buffer + c.headerLength;
+    return true;
+}
+
+void HttpServer::parseQuery(Connection& c, char* query) {
+    while (query && *query && c.argCount < HTTP_MAX_ARGS) {
+        char* next = strchr(query, '&');
+        if (next) *next++ = '\0';
+        char* value = strchr(query, '=');
+        if (value) *value++ = '\0';
+        else value = query + strlen(query); // "?flag": empty value
+
+        urlDecode(query);
+        urlDecode(value);
+        c.argNames[c.argCount] = query;
+        c.argValues[c.argCount] = value;
+        c.argCount++;
+        query = next;
+    }
+}
+
+void HttpServer::dispatch(Connection& c) {
+    // Body as a C string; the byte is the start of a pipelined request, if any
+    size_t end = c.headerLength + c.contentLength;
+    char next = c.buffer[end];
+    c.buffer[end] = '\0';
+
+    counters.requests++;
+    if (c.requestCount++ > 0) counters.keepAliveRequests++;
+
+    current = &c;
+    resetResponse();
+
+    Route* route = nullptr;
+    for (int i = 0; i < routeCount && !route; ++i) {
+        if ((routes[i].method == c.method || routes[i].method == HTTP_ANY) &&
+            strcmp(routes[i].uri, c.path) == 0) {
+            route = &routes[i];
+        }
+    }
+    HttpRouteStats& stats = route ? route->stats : unmatched;
+    unsigned long start = halMicros();
+    if (route) route->handler();
+    else if (notFoundHandler) notFoundHandler();
+    else send(404, "text/plain", "Not found");
+
+    if (detached) {
+        recordResponse(stats, halMicros() - start, responseCode, responseBytes, failed);
+        current = nullptr; // Socket and slot already handed over
+        return;
+    }
+    if (!responseStarted) send(500, "text/plain", "Empty response");
+    if (chunked && !chunkedDone) sendContent("", 0);
+    unsigned long elapsedUs = halMicros() - start;
+    current = nullptr;
+    c.buffer[end] = next;
+
+    if (c.stream && !failed) {
+        c.streamStats = &stats; // Recorded with its full length by endStream()
+        c.streamUs = elapsedUs;
+        c.streamCode = responseCode;
+        c.streamBytes = responseBytes;
+    } else {
+        recordResponse(stats, elapsedUs, responseCode, responseBytes, failed);
+    }
+    if (failed) {
+        closeConnection(c);
+        return;
+    }
+    c.sending = true;
+    writePending(c); // Usually all of it goes out right away
+}
+
+// Drains the response in order: the queued head and dynamic body, then a
+// static body one slice per pass, then a streamed body one piece per pass.
+// Returns as soon as the socket is full; select() says when it has room.
+void HttpServer::writePending(Connection& c) {
+    if (!flushOutput(c)) {
+        closeConnection(c);
+        return;
+    }
+    if (c.outputSent < c.outputLength) return;
+
+    if (c.pendingLength > 0) {
+        size_t slice = c.pendingLength < HTTP_WRITE_SLICE ? c.pendingLength : HTTP_WRITE_SLICE;
+        int n = ::send(c.fd, c.pending, slice, MSG_DONTWAIT);
+        if (n < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK) closeConnection(c);
+            return;
+        }
+        c.pending += n;
+        c.pendingLength -= n;
+        c.lastActivity = halMillis();
+        if (c.pendingLength > 0) return;
+    }
+
+    if (c.stream) {
+        if (!fillStream(c) || !flushOutput(c)) {
+            closeConnection(c);
+            return;
+        }
+        if (c.stream || c.outputSent < c.outputLength) return;
+    }
+    finishResponse(c);
+}
+
+// Writes as much of the output queue as the socket takes now. False on a
+// socket error; a full socket is not one.
+bool HttpServer::flushOutput(Connection& c) {
+    while (c.outputSent < c.outputLength) {
+        int n = ::send(c.fd, c.output + c.outputSent, c.outputLength - c.outputSent, MSG_DONTWAIT);
+        if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK;
+        c.outputSent += n;
+        c.lastActivity = halMillis();
+    }
+    c.outputLength = 0;
+    c.outputSent = 0;
+    return true;
+}
+
+// Appends to the output queue. When it is full, what the socket takes now
+// makes room; if that is not enough the reply is larger than the queue and
+// the client is not keeping up, and waiting for it would stall every other
+// connection, so the reply fails instead.
+bool HttpServer::queueOutput(Connection& c, const char* data, size_t length) {
+    while (length > 0) {
+        if (c.outputLength == sizeof(c.output)) {
+            if (!flushOutput(c)) return false;
+            if (c.outputSent > 0) {
+                memmove(c.output, c.output + c.outputSent, c.outputLength - c.outputSent);
+                c.outputLength -= c.outputSent;
+                c.outputSent = 0;
+            }
+            if (c.outputLength == sizeof(c.output)) {
+                LOG_WARN("HTTP", "Reply over %u queued bytes to a slow client, dropped", (unsigned)sizeof(c.output));
+                return false;
+            }
+        }
+        size_t room = sizeof(c.output) - c.outputLength;
+        size_t n = length < room ? length : room;
+        memcpy(c.output + c.outputLength, data, n);
+        c.outputLength += n;
+        data += n;
+        length -= n;
+    }
+    return true;
+}
+
+// Asks the stream for its next piece, straight into the drained output
+// queue behind room for the chunk header. False if the piece did not fit,
+// or was empty with more to come: a stream that cannot move would be asked
+// again on every pass.
+bool HttpServer::fillStream(Connection& c) {
+    static const size_t CHUNK_HEADER = 6;       // "%04x\r\n", enough for the queue size
+    static const size_t CHUNK_TRAILER = 2 + 5;  // "\r\n", then the last chunk
+    size_t header = c.streamChunked ? CHUNK_HEADER : 0;
+    size_t room = sizeof(c.output) - header - (c.streamChunked ? CHUNK_TRAILER : 0);
+
+    BufferPrint piece(c.output + header, room);
+    bool more = c.stream(piece, room);
+    if (piece.overflowed() || (more && piece.size() == 0)) {
+        if (piece.overflowed()) LOG_WARN("HTTP", "Stream piece over %u bytes", (unsigned)room);
+        else LOG_WARN("HTTP", "Stream made no progress");
+        endStream(c, false);
+        return false;
+    }
+
+    size_t length = 0;
+    if (piece.size() > 0) {
+        length = header + piece.size();
+        if (c.streamChunked) {
+            char size[CHUNK_HEADER + 1];
+            snprintf(size, sizeof(size), "%04x\r\n", (unsigned)piece.size());
+            memcpy(c.output, size, CHUNK_HEADER);
+            memcpy(c.output + length, "\r\n", 2);
+            length += 2;
+        }
+    }
+    if (!more && c.streamChunked) {
+        memcpy(c.output + length, "0\r\n\r\n", 5);
+        length += 5;
+    }
+    c.outputLength = length;
+    c.outputSent = 0;
+    c.streamBytes += length;
+    if (!more) endStream(c, true);
+    return true;
+}
+
+void HttpServer::endStream(Connection& c, bool ok) {
+    if (c.streamStats) recordResponse(*c.streamStats, c.streamUs, c.streamCode, c.streamBytes, !ok);
+    c.stream = nullptr;
+    c.streamStats = nullptr;
+}
+
+void HttpServer::finishResponse(Connection& c) {
+    if (!c.keepAlive) {
+        closeConnection(c);
+        return;
+    }
+
+    size_t used = c.headerLength + c.contentLength;
+    size_t pipelined = c.received - used;
+    resetConnection(c); // Wait for the next request on the same socket
+
+    // Bytes past this request belong to the next one: move them to the front
+    if (pipelined > 0) {
+        memmove(c.buffer, c.buffer + used, pipelined);
+        counters.pipelinedRequests++;
+    }
+    c.received = pipelined;
+    c.buffer[pipelined] = '\0';
+    c.ready = pipelined > 0;
+}
+
+void HttpServer::resetConnection(Connection& c) {
+    c.sending = false;
+    c.ready = false;
+    c.received = 0;
+    c.headerLength = 0;
+    c.contentLength = 0;
+    c.buffer[0] = '\0';
+    c.lastActivity = halMillis();
+    c.method = HTTP_GET;
+    c.path = "";
+    c.argCount = 0;
+    for (int k = 0; k < HTTP_MAX_COLLECTED_HEADERS; ++k) c.headerValues[k] = nullptr;
+    c.body = c.buffer;
+    c.http11 = true;
+    c.keepAlive = true;
+    c.head = false;
+    c.outputLength = 0;
+    c.outputSent = 0;
+    c.pending = nullptr;
+    c.pendingLength = 0;
+    c.stream = nullptr;
+    c.streamStats = nullptr;
+}
+
+void HttpServer::closeConnection(Connection& c) {
+    if (c.stream) endStream(c, false); // Client gone mid-stream
+    if (c.fd >= 0) ::close(c.fd);
+    c.fd = -1;
+    c.sending = false;
+    c.outputLength = 0;
+    c.outputSent = 0;
+    c.pending = nullptr;
+    c.pendingLength = 0;
+}
+
+void HttpServer::sendError(Connection& c, int code) {
+    current = &c;
+    resetResponse();
+    c.keepAlive = false;
+    c.head = false;
+    send(code, "text/plain", statusText(code));
+    recordResponse(unmatched, 0, responseCode, responseBytes, failed);
+    current = nullptr;
+    flushOutput(c); // Whatever the socket takes; the connection closes either way
+    closeConnection(c);
+}
+
+// ==========================================
+// Request Accessors
+// ==========================================
+
+HTTPMethod HttpServer::method() const {
+    return current ? current->method : HTTP_GET;
+}
+
+String HttpServer::uri() const {
+    return current ? String(current->path) : String("");
+}
+
+bool HttpServer::hasArg(const char* name) const {
+    if (!current) return false;
+    if (!strcmp(name, "plain")) return current->contentLength > 0;
+    for (int i = 0; i < current->argCount; ++i) {
+        if (!strcmp(current->argNames[i], name)) return true;
+    }
+    return false;
+}
+
+String HttpServer::arg(const char* name) const {
+    return String(argValue(name));
+}
+
+String HttpServer::header(const char* name) const {
+    return String(headerValue(name));
+}
+
+const char* HttpServer::argValue(const char* name) const {
+    if (!current) return "";
+    if (!strcmp(name, "plain")) return current->body;
+    for (int i = 0; i < current->argCount; ++i) {
+        if (!strcmp(current->argNames[i], name)) return current->argValues[i];
+    }
+    return "";
+}
+
+const char* HttpServer::headerValue(const char* name) const {
+    if (!current) return "";
+    for (int k = 0; k < collectedCount; ++k) {
+        if (!strcasecmp(collectedKeys[k], name) && current->headerValues[k]) {
+            return current->headerValues[k];
+        }
+    }
+    return "";
+}
+
+const char* HttpServer::body() const {
+    return current ? current->body : "";
+}
+
+size_t HttpServer::bodyLength() const {
+    return current ? current->contentLength : 0;
+}
+
+// ==========================================
+// Response
+// ==========================================
+
+void HttpServer::resetResponse() {
+    extraLength = 0;
+    extraHeaders[0] = '\0';
+    responseStarted = false;
+    streaming = false;
+    chunked = false;
+    chunkedDone = false;
+    detached = false;
+    failed = false;
+    responseCode = 0;
+    responseBytes = 0;
+}
+
+void HttpServer::recordResponse(HttpRouteStats& stats, unsigned long elapsedUs, int code, size_t bytes, bool error) {
+    stats.requests++;
+    if (error || code >= 400) stats.errors++;
+    stats.bytesSent += bytes;
+    stats.latencySumUs += elapsedUs;
+
+    int bucket = 0;
+    while (bucket < HTTP_LATENCY_BUCKETS && elapsedUs > HTTP_LATENCY_BOUNDS_US[bucket]) bucket++;
+    stats.latency[bucket]++;
+    bucket = 0;
+    while (bucket < HTTP_SIZE_BUCKETS && bytes > HTTP_SIZE_BOUNDS[bucket]) bucket++;
+    stats.size[bucket]++;
+}
+
+void HttpServer::sendHeader(const char* name, const String& value) {
+    sendHeader(name, value.c_str());
+}
+
+void HttpServer::sendHeader(const char* name, const char* value) {
+    size_t space = sizeof(extraHeaders) - extraLength;
+    int n = snprintf(extraHeaders + extraLength, space, "%s: %s\r\n", name, value);
+    if (n < 0 || (size_t)n >= space) {
+        extraHeaders[extraLength] = '\0';
+        LOG_WARN("HTTP", "Header buffer full, dropping %s", name);
+        return;
+    }
+    extraLength += n;
+}
+
+void HttpServer::setContentLength(size_t length) {
+    // Only "unknown" is needed: known lengths come from send()/send_P()
+    streaming = (length == CONTENT_LENGTH_UNKNOWN);
+}
+
+void HttpServer::writeHead(int code, const char* contentType, size_t contentLength) {
+    Connection& c = *current;
+    char head[HTTP_HEADER_BUFFER_SIZE + 192];
+    size_t length = 0;
+
+    length += snprintf(head + length, sizeof(head) - length, "HTTP/1.%d %d %s\r\n",
+                       c.http11 ? 1 : 0, code, statusText(code));
+    if (contentType) {
+        length += snprintf(head + length, sizeof(head) - length, "Content-Type: %s\r\n", contentType);
+    }
+    if (streaming) {
+        chunked = c.http11;
+        if (chunked) length += snprintf(head + length, sizeof(head) - length, "Transfer-Encoding: chunked\r\n");
+        else c.keepAlive = false; // HTTP/1.0: the close ends the body
+    } else if (code != 204 && code != 304) {
+        length += snprintf(head + length, sizeof(head) - length, "Content-Length: %u\r\n", (unsigned)contentLength);
+    }
+    if (c.keepAlive) {
+        length += snprintf(head + length, sizeof(head) - length,
+                           "Connection: keep-alive\r\nKeep-Alive: timeout=%lu\r\n",
+                           HTTP_IDLE_TIMEOUT_MS / 1000);
+    } else {
+        length += snprintf(head + length, sizeof(head) - length, "Connection: close\r\n");
+    }
+    if (length + extraLength + 2 > sizeof(head)) {
+        extraLength = 0; // Cannot happen with sane content types; keep the reply valid
+    }
+    memcpy(head + length, extraHeaders, extraLength);
+    length += extraLength;
+    memcpy(head + length, "\r\n", 2);
+    length += 2;
+
+    responseStarted = true;
+    responseCode = code;
+    queue(head, length);
+}
+
+// Dynamic bodies live in shared buffers, so they are copied into the
+// connection's output queue before the handler returns
+void HttpServer::queue(const char* data, size_t length) {
+    if (failed) return;
+    responseBytes += length;
+    failed = !queueOutput(*current, data, length);
+}
+
+void HttpServer::send(int code, const char* contentType, const char* content) {
+    send(code, contentType, content, strlen(content));
+}
+
+void HttpServer::send(int code, const char* contentType, const String& content) {
+    send(code, contentType, content.c_str(), content.length());
+}
+
+void HttpServer::send(int code, const char* contentType, const char* content, size_t length) {
+    if (!current || responseStarted) return;
+
+    writeHead(code, contentType, length);
+    if (streaming) {
+        if (length > 0) sendContent(content, length);
+    } else if (length > 0 && !current->head) {
+        queue(content, length);
+    }
+}
+
+void HttpServer::send_P(int code, const char* contentType, const char* content, size_t length) {
+    if (!current || responseStarted) return;
+
+    streaming = false;
+    writeHead(code, contentType, length);
+    if (!current->head && length > 0) {
+        responseBytes += length;
+        current->pending = content;
+        current->pendingLength = length;
+    }
+}
+
+void HttpServer::sendContent(const char* data, size_t length) {
+    if (!current || !responseStarted || failed || current->head) return;
+
+    if (!chunked) {
+        queue(data, length);
+        return;
+    }
+    if (chunkedDone) return;
+    if (length == 0) {
+        chunkedDone = true; // Last chunk
+        queue("0\r\n\r\n", 5);
+        return;
+    }
+
+    char size[12];
+    int n = snprintf(size, sizeof(size), "%x\r\n", (unsigned)length);
+    queue(size, n);
+    queue(data, length);
+    queue("\r\n", 2);
+}
+
+void HttpServer::sendContent(const String& content) {
+    sendContent(content.c_str(), content.length());
+}
+
+void HttpServer::sendStream(int code, const char* contentType, TStreamFunction more) {
+    if (!current || responseStarted) return;
+
+    streaming = true;
+    writeHead(code, contentType, 0);
+    if (current->head || failed) return;
+    current->stream = more;
+    current->streamChunked = chunked;
+    chunkedDone = true; // The stream writes its own last chunk
+}
+
+int HttpServer::openConnections() const {
+    int open = 0;
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; ++i) {
+        if (connections[i].fd >= 0) open++;
+    }
+    return open;
+}
+
+int HttpServer::detachClient() {
+    if (!current || current->fd < 0) return -1;
+
+    int fd = current->fd;
+    current->fd = -1; // The slot is free; the socket belongs to the caller now
+    current->sending = false;
+    current->outputLength = 0; // Detach before sending anything
+    current->outputSent = 0;
+    current->pending = nullptr;
+    detached = true;
+    return fd;
+}
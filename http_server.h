@@ -0,0 +1,234 @@
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <HTTP_Method.h>
+#include <functional>
+
+#ifndef CONTENT_LENGTH_UNKNOWN
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#endif
+
+// ==========================================
+// HTTP Server Limits
+// ==========================================
+// Every buffer is fixed per connection; nothing grows with traffic.
+const int HTTP_MAX_CONNECTIONS = 4;                // Concurrent client sockets
+const size_t HTTP_REQUEST_BUFFER_SIZE = 1024;      // Request line + headers + body
+const size_t HTTP_HEADER_BUFFER_SIZE = 512;        // Status line + response headers
+const size_t HTTP_OUTPUT_BUFFER_SIZE = 4096;       // Queued head + dynamic body, per connection
+const int HTTP_MAX_ARGS = 8;
+const int HTTP_MAX_COLLECTED_HEADERS = 4;
+const int HTTP_MAX_ROUTES = 24;
+const size_t HTTP_WRITE_SLICE = 1436;              // Static body bytes per socket per pass (one MSS)
+const unsigned long HTTP_IDLE_TIMEOUT_MS = 5000;   // Keep-alive wait / slow request
+const unsigned long HTTP_SEND_TIMEOUT_MS = 10000;  // No progress while sending
+
+// Connection reuse counters, exported at /metrics. Every accepted
+// connection is one TCP handshake; keep-alive and pipelining exist to make
+// that number small next to requests.
+struct HttpServerStats {
+    unsigned long connectionsAccepted; // TCP handshakes
+    unsigned long connectionsRejected; // 503: every slot busy
+    unsigned long idleEvictions;       // Idle keep-alive closed to admit a new client
+    unsigned long idleTimeouts;        // Closed after HTTP_IDLE_TIMEOUT_MS
+    unsigned long requests;
+    unsigned long keepAliveRequests;   // Served on an already used connection
+    unsigned long pipelinedRequests;   // Arrived before the previous response ended
+};
+
+// Per-route instrumentation, exported at /metrics as Prometheus histograms.
+// Latency is the handler's own run time; bodies drain on later passes, so
+// only their length is counted, and a streamed reply is recorded once its
+// last piece is queued. Buckets are per bucket here (the last one is +Inf)
+// and made cumulative on export.
+const int HTTP_LATENCY_BUCKETS = 9;
+const uint32_t HTTP_LATENCY_BOUNDS_US[HTTP_LATENCY_BUCKETS] = {
+    1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000
+};
+const int HTTP_SIZE_BUCKETS = 5;
+const uint32_t HTTP_SIZE_BOUNDS[HTTP_SIZE_BUCKETS] = {256, 1024, 4096, 16384, 65536};
+
+struct HttpRouteStats {
+    unsigned long requests;
+    unsigned long errors;      // Status >= 400, or the socket failed mid-reply
+    unsigned long bytesSent;   // Status line, headers and body
+    uint64_t latencySumUs;
+    unsigned long latency[HTTP_LATENCY_BUCKETS + 1];
+    unsigned long size[HTTP_SIZE_BUCKETS + 1];
+};
+
+// ==========================================
+// Non-blocking, multi-connection HTTP/1.1 server
+// ==========================================
+// Same handler API as the core WebServer (on/arg/header/send...) so routes
+// are unchanged, but sockets are non-blocking and each connection keeps its
+// own request buffer and send state. Nothing a handler sends is written
+// while it runs: the head, dynamic bodies and chunks are copied into the
+// connection's output queue, and static bodies (send_P) are referenced in
+// place. Both drain as the socket takes them, a slice per pass, so a slow
+// client never stalls the others. Bodies too large to queue come from
+// sendStream() a piece at a time; a plain send that outgrows the queue
+// while the client is not keeping up fails instead of waiting.
+// Connections stay open (keep-alive) until idle for HTTP_IDLE_TIMEOUT_MS,
+// and pipelined requests are answered in order from the same buffer.
+class HttpServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+    // Writes at most room bytes of the body to out; false once it is complete
+    typedef std::function<bool(Print& out, size_t room)> TStreamFunction;
+
+    explicit HttpServer(uint16_t port);
+
+    void begin();
+    void on(const char* uri, HTTPMethod method, THandlerFunction handler);
+    void onNotFound(THandlerFunction handler);
+    void collectHeaders(const char* headerKeys[], size_t count);
+
+    // Sleeps until a socket needs attention or timeoutMs elapses
+    void waitForActivity(unsigned long timeoutMs);
+    // Accepts, reads, dispatches and writes whatever is ready; never waits on a client
+    void handleClient();
+
+    // Request accessors (valid inside a handler)
+    HTTPMethod method() const;
+    String uri() const;
+    bool hasArg(const char* name) const;   // "plain" is the request body
+    String arg(const char* name) const;
+    String header(const char* name) const;
+    // Same without the copy: point into the request buffer, "" when absent
+    const char* argValue(const char* name) const;
+    const char* headerValue(const char* name) const;
+    const char* body() const;
+    size_t bodyLength() const;
+
+    // Response
+    void sendHeader(const char* name, const char* value);
+    void sendHeader(const char* name, const String& value);
+    void setContentLength(size_t length);  // CONTENT_LENGTH_UNKNOWN: chunked
+    void send(int code, const char* contentType = nullptr, const char* content = "");
+    void send(int code, const char* contentType, const String& content);
+    void send(int code, const char* contentType, const char* content, size_t length);
+    // Body is not copied and must stay valid until sent (PROGMEM assets)
+    void send_P(int code, const char* contentType, const char* content, size_t length);
+    void sendContent(const char* data, size_t length);
+    void sendContent(const String& content);
+    // Body produced on later passes, a piece each time the output queue has
+    // drained. Chunked on HTTP/1.1, ended by the close on 1.0. The function
+    // is kept until the body is complete, so its captures are its state;
+    // keep them small so std::function stores them in place.
+    void sendStream(int code, const char* contentType, TStreamFunction more);
+
+    // Hands the current socket over to the caller (event streams), still
+    // non-blocking; the server sends nothing more on it and frees the slot.
+    // -1 outside a handler.
+    int detachClient();
+
+    const HttpServerStats& stats() const { return counters; }
+    int openConnections() const;
+
+    // Routes in registration order; requests that matched none (404s and
+    // malformed requests) are counted apart
+    int routeTotal() const { return routeCount; }
+    const char* routeUri(int i) const { return routes[i].uri; }
+    const HttpRouteStats& routeStats(int i) const { return routes[i].stats; }
+    const HttpRouteStats& unmatchedStats() const { return unmatched; }
+
+private:
+    struct Route {
+        const char* uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+        HttpRouteStats stats;
+    };
+
+    struct Connection {
+        int fd;                      // -1 when the slot is free
+        bool sending;                // Waiting for body bytes to drain
+        char buffer[HTTP_REQUEST_BUFFER_SIZE + 1];
+        size_t received;
+        size_t headerLength;         // 0 until the blank line arrived
+        size_t contentLength;
+        unsigned long lastActivity;
+        unsigned long requestCount;  // Requests served on this socket
+        bool ready;                  // Pipelined bytes waiting to be parsed
+
+        // Parsed request, pointing into buffer
+        HTTPMethod method;
+        const char* path;
+        const char* argNames[HTTP_MAX_ARGS];
+        const char* argValues[HTTP_MAX_ARGS];
+        int argCount;
+        const char* headerValues[HTTP_MAX_COLLECTED_HEADERS];
+        const char* body;
+        bool http11;
+        bool keepAlive;
+        bool head;                   // HEAD request: headers only
+
+        // Queued head and dynamic body, sent before anything else
+        char output[HTTP_OUTPUT_BUFFER_SIZE];
+        size_t outputLength;
+        size_t outputSent;
+
+        // Pending static body
+        const char* pending;
+        size_t pendingLength;
+
+        // Pending streamed body; its route is recorded once it is complete
+        TStreamFunction stream;
+        bool streamChunked;
+        HttpRouteStats* streamStats;
+        unsigned long streamUs;
+        int streamCode;
+        size_t streamBytes;
+    };
+
+    void acceptConnections();
+    void service(Connection& c);
+    void readRequest(Connection& c);
+    bool parseHead(Connection& c);
+    void parseQuery(Connection& c, char* query);
+    void dispatch(Connection& c);
+    void writePending(Connection& c);
+    bool flushOutput(Connection& c);
+    bool queueOutput(Connection& c, const char* data, size_t length);
+    bool fillStream(Connection& c);
+    void endStream(Connection& c, bool ok);
+    void finishResponse(Connection& c);
+    void resetConnection(Connection& c);
+    void closeConnection(Connection& c);
+    void sendError(Connection& c, int code);
+
+    void resetResponse();
+    void recordResponse(HttpRouteStats& stats, unsigned long elapsedUs, int code, size_t bytes, bool error);
+    void writeHead(int code, const char* contentType, size_t contentLength);
+    void queue(const char* data, size_t length);
+
+    uint16_t port;
+    int listenFd;
+    Connection connections[HTTP_MAX_CONNECTIONS];
+
+    Route routes[HTTP_MAX_ROUTES];
+    int routeCount;
+    THandlerFunction notFoundHandler;
+    HttpRouteStats unmatched;
+
+    const char* collectedKeys[HTTP_MAX_COLLECTED_HEADERS];
+    int collectedCount;
+    HttpServerStats counters;
+
+    // Response being built by the running handler
+    Connection* current;
+    char extraHeaders[HTTP_HEADER_BUFFER_SIZE];
+    size_t extraLength;
+    bool responseStarted;
+    bool streaming;     // Length unknown: chunked on HTTP/1.1, close-delimited on 1.0
+    bool chunked;
+    bool chunkedDone;
+    bool detached;
+    bool failed;        // Socket error or queue overflow: drop the connection after the handler
+    int responseCode;
+    size_t responseBytes; // Queued so far, for HttpRouteStats
+};
+
+#endif // HTTP_SERVER_H
@@ -1,294 +1,422 @@
-#ifndef INDEX_HTML_H_H
-#define INDEX_HTML_H_H
-
-#include <Arduino.h>
-
-const char index_html[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xED, 0x5C, 0xEF, 0x72, 0xDB, 0x38, 
-0x92, 0xFF, 0xBE, 0x4F, 0x81, 0x70, 0x2A, 0x65, 0x79, 0xD6, 0x94, 0x29, 0xCA, 0x92, 0x6D, 0xC5, 
-0x72, 0x55, 0xC6, 0xC9, 0x6C, 0x52, 0xE5, 0xD4, 0xA4, 0xC6, 0xBE, 0xB9, 0xDA, 0x8F, 0x10, 0x09, 
-0x4A, 0x1C, 0x53, 0x24, 0x0F, 0x24, 0x65, 0x7B, 0x6E, 0xF3, 0x14, 0xFB, 0x6D, 0xEB, 0xBE, 0xDC, 
-0x03, 0x6C, 0xD5, 0x54, 0xED, 0x1B, 0xEC, 0xBC, 0xC9, 0x3E, 0xC9, 0x76, 0x03, 0x20, 0xC5, 0xFF, 
-0xA2, 0x64, 0xC5, 0xC9, 0x5D, 0x8D, 0xF2, 0x47, 0x22, 0x08, 0x36, 0xBA, 0x7F, 0x68, 0x34, 0xBA, 
-0x1B, 0x00, 0x2F, 0x5E, 0xBC, 0xF9, 0xE1, 0xEA, 0xF6, 0xCF, 0x1F, 0xDF, 0x92, 0x45, 0xBC, 0xF4, 
-0x2E, 0xFF, 0x70, 0x81, 0x5F, 0xC4, 0xA3, 0xFE, 0x7C, 0xAA, 0xB1, 0x48, 0xC3, 0x02, 0x46, 0xED, 
-0xCB, 0x3F, 0x10, 0xF8, 0x5C, 0x2C, 0x59, 0x4C, 0x89, 0xB5, 0xA0, 0x3C, 0x62, 0xF1, 0x54, 0xFB, 
-0x8F, 0xDB, 0xEF, 0xF5, 0x33, 0x2D, 0x7F, 0xCB, 0xA7, 0x4B, 0x36, 0xD5, 0x56, 0x2E, 0xBB, 0x0F, 
-0x03, 0x1E, 0x6B, 0xC4, 0x0A, 0xFC, 0x98, 0xF9, 0x50, 0xF5, 0xDE, 0xB5, 0xE3, 0xC5, 0xD4, 0x66, 
-0x2B, 0xD7, 0x62, 0xBA, 0xB8, 0x38, 0x22, 0xAE, 0xEF, 0xC6, 0x2E, 0xF5, 0xF4, 0xC8, 0xA2, 0x1E, 
-0x9B, 0x0E, 0xFA, 0x46, 0x4A, 0x2A, 0x76, 0x63, 0x8F, 0x5D, 0x7E, 0xA4, 0x3E, 0xF3, 0x88, 0xCD, 
-0xC8, 0x15, 0x10, 0xE1, 0x81, 0x47, 0xDE, 0xFB, 0x2B, 0xC6, 0x7D, 0x6A, 0x33, 0x1E, 0x5C, 0x1C, 
-0xCB, 0x3A, 0xB2, 0x7E, 0x64, 0x71, 0x37, 0x8C, 0xE5, 0x05, 0x7E, 0x8E, 0x8F, 0xC9, 0xEB, 0x30, 
-0xF4, 0x1E, 0x49, 0xBC, 0x60, 0x4B, 0x46, 0xDE, 0x7F, 0xF8, 0xF0, 0xF6, 0xCD, 0xFB, 0xD7, 0xB7, 
-0x6F, 0xAF, 0xFF, 0x4C, 0x66, 0xCC, 0x09, 0x38, 0x23, 0xD4, 0x7F, 0x8C, 0x17, 0xAE, 0x3F, 0x27, 
-0xCC, 0x8B, 0x18, 0x89, 0x03, 0x12, 0x72, 0xB6, 0x02, 0x46, 0x89, 0xE3, 0xD1, 0x68, 0x91, 0x11, 
-0xEA, 0x39, 0x89, 0x6F, 0xC5, 0x6E, 0xE0, 0xF7, 0x0E, 0xC9, 0x7F, 0x67, 0xA5, 0xF8, 0x89, 0xF9, 
-0x63, 0xA9, 0x04, 0x3F, 0x20, 0x6E, 0x14, 0x93, 0x88, 0xAE, 0x98, 0x7D, 0x2B, 0x9A, 0x9E, 0x12, 
-0x2F, 0x00, 0xE9, 0x6E, 0xE2, 0x80, 0xD3, 0x39, 0xEB, 0xCF, 0x59, 0xFC, 0x3E, 0x66, 0xCB, 0xDE, 
-0x81, 0x60, 0xEC, 0xE0, 0xF0, 0x55, 0x85, 0x82, 0xEB, 0x90, 0x5E, 0xFE, 0xF9, 0xE9, 0x94, 0x1C, 
-0xD8, 0x94, 0xDF, 0x1D, 0x94, 0x19, 0xA8, 0xC8, 0x6A, 0x01, 0xE7, 0x11, 0x08, 0x66, 0x93, 0x28, 
-0x7E, 0xF4, 0x58, 0x44, 0xDC, 0xE5, 0x92, 0xD9, 0x2E, 0x8D, 0x99, 0xF7, 0x58, 0xFB, 0xA4, 0x1D, 
-0x58, 0xC9, 0x12, 0x64, 0xEE, 0xA7, 0x3F, 0xDE, 0x7A, 0x4C, 0x5C, 0x0B, 0x4A, 0xD7, 0x6E, 0x14, 
-0xF7, 0xA9, 0x6D, 0xF7, 0x44, 0xF3, 0x7A, 0x23, 0xC3, 0xAD, 0x94, 0x40, 0x4B, 0x5E, 0xC7, 0x31, 
-0x77, 0x67, 0x49, 0xCC, 0x7A, 0x07, 0x82, 0xAF, 0x83, 0x23, 0x72, 0x30, 0xA3, 0xD6, 0xDD, 0x9C, 
-0x07, 0x89, 0x6F, 0xEB, 0x56, 0xE0, 0x05, 0x7C, 0x42, 0xBE, 0x31, 0xA8, 0xE1, 0x0C, 0x18, 0x79, 
-0xE1, 0x2E, 0x51, 0x71, 0xA8, 0x1F, 0xBF, 0x6A, 0x6A, 0x0C, 0x05, 0xF6, 0xA2, 0x80, 0x00, 0x6D, 
-0x32, 0x0B, 0xEC, 0x47, 0x29, 0x2E, 0x02, 0xE7, 0xC6, 0x84, 0x3D, 0x00, 0xDB, 0x51, 0xED, 0x73, 
-0x88, 0x6C, 0xC6, 0x28, 0x3E, 0xD8, 0x84, 0x68, 0x41, 0x22, 0xAC, 0xB8, 0x3D, 0x20, 0x55, 0x12, 
-0x4F, 0x41, 0x82, 0xA4, 0xB7, 0x1C, 0xF1, 0xE9, 0x02, 0xD2, 0x27, 0xA9, 0xD8, 0xCD, 0x02, 0x02, 
-0x8A, 0xEF, 0x1D, 0x89, 0x9F, 0x1D, 0xB0, 0xC8, 0x3F, 0x50, 0xD8, 0x91, 0x47, 0x16, 0x1F, 0x91, 
-0x7B, 0x0A, 0x58, 0xC2, 0x40, 0x01, 0x48, 0x37, 0xCB, 0x07, 0x98, 0xBC, 0xC5, 0xB1, 0x83, 0x00, 
-0x31, 0x9F, 0xF1, 0xDE, 0xC1, 0x9B, 0x1F, 0x3E, 0x5C, 0xC9, 0x81, 0x7F, 0x1D, 0xC0, 0x70, 0xB5, 
-0x41, 0xD2, 0xC6, 0x81, 0xF4, 0x19, 0x90, 0xFF, 0xE2, 0xE8, 0x8B, 0x1E, 0x68, 0xEA, 0x99, 0x4A, 
-0x69, 0xB1, 0xE4, 0x13, 0xB1, 0x68, 0x6C, 0x2D, 0x7A, 0xAC, 0x0E, 0x28, 0xB4, 0x2F, 0x81, 0xC7, 
-0xFA, 0x8C, 0xF3, 0x00, 0x70, 0x7E, 0x8B, 0x5F, 0x84, 0xE2, 0xF0, 0x47, 0x5B, 0x26, 0x80, 0x99, 
-0x80, 0x60, 0xAC, 0xD4, 0xF6, 0xBA, 0x85, 0x4F, 0x87, 0x3D, 0x75, 0xEF, 0xE2, 0x38, 0x6F, 0x35, 
-0x2F, 0x04, 0x26, 0x39, 0x0B, 0xFA, 0x2D, 0xB9, 0xE2, 0x60, 0x9D, 0xC1, 0x76, 0x29, 0x23, 0xAA, 
-0x8C, 0x4A, 0xD9, 0x54, 0x12, 0x9D, 0x2C, 0x13, 0x50, 0x9B, 0x19, 0x8C, 0x40, 0xDF, 0x73, 0x7D, 
-0x46, 0xBE, 0x3D, 0xCE, 0xA8, 0x88, 0x99, 0xA4, 0x28, 0x45, 0x0D, 0xE4, 0xCE, 0xD0, 0x39, 0x71, 
-0xC6, 0x79, 0x5C, 0x4B, 0x96, 0x96, 0xFA, 0x91, 0x8B, 0xBA, 0x33, 0xA9, 0x3C, 0x4D, 0x8C, 0xFE, 
-0x28, 0x22, 0x8C, 0x46, 0x6C, 0xFD, 0xCC, 0xA7, 0x42, 0xF3, 0xFD, 0xB5, 0xCA, 0x6C, 0xE6, 0xA4, 
-0xDA, 0xF9, 0x35, 0x54, 0xC5, 0x98, 0x79, 0xAA, 0x50, 0x69, 0xB5, 0x81, 0x63, 0x9E, 0x0F, 0x4F, 
-0x77, 0x11, 0xF8, 0x88, 0xEC, 0x80, 0x40, 0x37, 0xDE, 0x5B, 0x60, 0xC8, 0xF3, 0x5E, 0x1D, 0x0F, 
-0x35, 0x1C, 0xA0, 0x22, 0x51, 0x6E, 0xCB, 0x89, 0x09, 0xBD, 0x01, 0x0A, 0x3A, 0xC2, 0xA3, 0xB2, 
-0x96, 0xE4, 0x99, 0xEC, 0x5B, 0xF0, 0x40, 0x23, 0x97, 0x13, 0x82, 0x5A, 0x46, 0xB9, 0x3E, 0xE7, 
-0xD4, 0x76, 0x41, 0x0F, 0x7B, 0x83, 0xE1, 0xC8, 0x66, 0xF3, 0x23, 0x00, 0x93, 0x01, 0x98, 0x33, 
-0x62, 0xBC, 0xC4, 0xDF, 0xD4, 0x1C, 0x0E, 0x4D, 0x32, 0x30, 0x8C, 0x97, 0x87, 0x8D, 0x92, 0xCC, 
-0x02, 0x0E, 0xCE, 0x44, 0x26, 0xF7, 0x70, 0x78, 0x32, 0x18, 0x8D, 0xF6, 0x23, 0x77, 0x59, 0x28, 
-0xF4, 0xA1, 0x18, 0x6F, 0x91, 0x2A, 0xE5, 0xFE, 0xE9, 0xBC, 0x36, 0x33, 0xD1, 0xB7, 0xA4, 0x27, 
-0xA5, 0xBB, 0xE0, 0x84, 0xB4, 0xF1, 0x02, 0xFD, 0x7F, 0x6A, 0xD2, 0xAE, 0xBC, 0x9C, 0x9C, 0x8E, 
-0x46, 0xE3, 0xF3, 0x6D, 0x79, 0x81, 0x8A, 0x77, 0x3A, 0x98, 0x90, 0x58, 0x77, 0x5C, 0xCF, 0x63, 
-0x6D, 0x3D, 0xDE, 0xC6, 0xCF, 0xA6, 0x16, 0x56, 0x6E, 0x94, 0x80, 0x8F, 0x79, 0xCF, 0xC1, 0x4C, 
-0xB6, 0x76, 0x40, 0x27, 0xB5, 0x52, 0x8C, 0x6C, 0xA5, 0x56, 0xBB, 0xC1, 0x83, 0x4E, 0x76, 0xFC, 
-0x14, 0xB6, 0x15, 0xAB, 0x72, 0x34, 0x48, 0x11, 0x9A, 0xD9, 0x2E, 0x0C, 0xD8, 0x9B, 0x98, 0xC6, 
-0x09, 0xF8, 0x8F, 0xBE, 0x0D, 0xF6, 0x1F, 0x3C, 0xD7, 0xF6, 0xD1, 0x1A, 0x3D, 0xC2, 0xB4, 0xBF, 
-0xD4, 0x23, 0xF9, 0xD0, 0x2E, 0x8C, 0x8E, 0x4F, 0x58, 0x86, 0xEF, 0xC9, 0xE9, 0xD9, 0xE8, 0x74, 
-0x3B, 0x7C, 0x8D, 0xD1, 0xF9, 0x78, 0x7B, 0x7C, 0x8B, 0x6C, 0x47, 0x21, 0xF5, 0x4B, 0xBC, 0xA7, 
-0xE4, 0xED, 0x81, 0x43, 0xD9, 0xA6, 0x91, 0x06, 0xA8, 0xDD, 0xB2, 0x07, 0xF0, 0xA1, 0xA4, 0xE3, 
-0xDB, 0x8E, 0x18, 0x44, 0x4A, 0xDC, 0xB5, 0xF4, 0x15, 0xF5, 0x92, 0xE6, 0x49, 0xA9, 0x05, 0x30, 
-0x65, 0x80, 0x04, 0x60, 0xD6, 0xCC, 0x1E, 0xB1, 0xC1, 0x06, 0xC0, 0xF4, 0x7B, 0x36, 0xBB, 0x73, 
-0x63, 0x3D, 0x6F, 0xEB, 0x3D, 0x37, 0x9C, 0x90, 0x18, 0x79, 0xDE, 0xF4, 0x14, 0x56, 0x12, 0x63, 
-0x34, 0x45, 0x5C, 0x4C, 0x50, 0x21, 0xE5, 0xE8, 0x04, 0x34, 0xF6, 0x51, 0xE7, 0xA6, 0xDA, 0xC6, 
-0x00, 0x4C, 0x04, 0xBA, 0x08, 0xF4, 0x8E, 0x9A, 0x2B, 0xCD, 0xB8, 0x88, 0x79, 0xA0, 0x03, 0x5B, 
-0x2A, 0xA5, 0x86, 0xCF, 0xA3, 0x33, 0xE6, 0xB5, 0xD4, 0x53, 0x5D, 0xE3, 0x04, 0x41, 0xCC, 0xF8, 
-0xE6, 0x7A, 0x09, 0x44, 0xB0, 0x0D, 0x6A, 0xA3, 0x3A, 0x66, 0xA3, 0xDA, 0x7C, 0x97, 0xC4, 0x31, 
-0x78, 0x75, 0xAD, 0x0A, 0x23, 0xBE, 0xF4, 0x38, 0x98, 0xCF, 0x3D, 0xA6, 0xCF, 0xE2, 0xB2, 0xA6, 
-0x3E, 0x61, 0x1A, 0xD9, 0xD1, 0x74, 0x97, 0xF9, 0x51, 0x25, 0x2E, 0xC0, 0xDC, 0x00, 0x07, 0x33, 
-0xD9, 0x99, 0x63, 0xEC, 0x30, 0x5F, 0x39, 0xEE, 0x7C, 0x83, 0xC8, 0x8D, 0xE3, 0xE4, 0xC4, 0x39, 
-0x19, 0xC3, 0xC8, 0x15, 0xE3, 0xE4, 0x64, 0x38, 0x3C, 0xB3, 0xDA, 0x0C, 0x77, 0x0B, 0x17, 0x5E, 
-0x30, 0x0F, 0x92, 0x78, 0x57, 0x2E, 0x6C, 0xCB, 0x1C, 0x9B, 0x63, 0xC9, 0xC5, 0xEC, 0x7C, 0x60, 
-0x0D, 0xAC, 0xDD, 0xB8, 0x78, 0xE6, 0xEE, 0xCF, 0x77, 0x5E, 0x27, 0x5D, 0x6E, 0x61, 0xB8, 0x0F, 
-0xFF, 0xF4, 0x8A, 0x6A, 0x74, 0x9B, 0x7C, 0x8D, 0xD9, 0xF9, 0xD9, 0x40, 0x4D, 0x0E, 0xD2, 0xD0, 
-0xB7, 0xDB, 0x3A, 0xC5, 0xF3, 0xFD, 0x02, 0x7C, 0x9C, 0xCE, 0x33, 0x88, 0x9C, 0x75, 0x9E, 0x28, 
-0x1F, 0x98, 0xE4, 0x1D, 0x04, 0x64, 0xCE, 0x09, 0x7C, 0xA4, 0x80, 0x4A, 0x55, 0xF6, 0x2F, 0xA0, 
-0xD2, 0xBB, 0x8D, 0xC6, 0xE8, 0xBD, 0x1F, 0x26, 0x1B, 0x26, 0xAF, 0xD8, 0xC5, 0x81, 0x8E, 0xF5, 
-0x9E, 0xC5, 0x81, 0xCC, 0x49, 0xFC, 0x8D, 0x33, 0x70, 0x46, 0xCE, 0xF6, 0x13, 0xFD, 0xBD, 0x0B, 
-0xF1, 0x34, 0x7C, 0x7B, 0x6E, 0x9B, 0x07, 0xFE, 0x44, 0x93, 0xA8, 0x5A, 0x11, 0xC0, 0x4C, 0xAC, 
-0x05, 0xB3, 0xEE, 0xC0, 0xA3, 0xFD, 0x63, 0xF7, 0x56, 0xC7, 0x06, 0x1D, 0x39, 0x5B, 0x7B, 0xB8, 
-0x45, 0xD9, 0x26, 0x2A, 0xB9, 0xB9, 0xA9, 0xB1, 0x66, 0xD5, 0x29, 0x29, 0x03, 0xCC, 0x81, 0xD4, 
-0x8A, 0xDD, 0x15, 0x23, 0x96, 0x88, 0xE1, 0xDA, 0xF4, 0xC2, 0x5D, 0xD7, 0xD6, 0xB1, 0x76, 0x5F, 
-0xFD, 0x06, 0x27, 0x2B, 0x2C, 0x73, 0x54, 0xEC, 0x7D, 0x67, 0x74, 0xCE, 0x8C, 0x16, 0x93, 0xD5, 
-0xC9, 0xD4, 0x9B, 0xA6, 0x61, 0x28, 0x23, 0x3B, 0x04, 0x8F, 0xCD, 0x38, 0xDB, 0xCD, 0xC8, 0x36, 
-0x49, 0xB1, 0x48, 0x96, 0xAE, 0xED, 0xC6, 0x95, 0xE0, 0xB9, 0x14, 0x94, 0xCD, 0xCE, 0xCC, 0x96, 
-0xA0, 0xBF, 0x63, 0xB4, 0x31, 0x04, 0x4D, 0xC8, 0x82, 0x58, 0x76, 0xB2, 0xE3, 0xA4, 0xD5, 0x24, 
-0x49, 0x14, 0xB8, 0x95, 0x9C, 0x4C, 0x51, 0x0A, 0x65, 0x72, 0x9F, 0x24, 0x45, 0xC1, 0xA7, 0x1F, 
-0x0D, 0x6D, 0xD3, 0xE9, 0x1A, 0x7C, 0xBC, 0x93, 0x81, 0xF2, 0x4C, 0xB9, 0x45, 0x11, 0x03, 0x47, 
-0x13, 0x83, 0x90, 0x56, 0xE5, 0x93, 0xD1, 0xB5, 0x9E, 0x3E, 0x54, 0x2B, 0x9E, 0xC7, 0x9C, 0x78, 
-0xBB, 0x41, 0x0E, 0xDC, 0xBC, 0x61, 0x0E, 0x4D, 0xBC, 0x18, 0x04, 0x9D, 0x2F, 0x62, 0x95, 0x09, 
-0xCB, 0x31, 0xB2, 0x4D, 0x2E, 0x68, 0x1F, 0x59, 0xAD, 0x8B, 0xE3, 0x5C, 0x9E, 0xEE, 0x02, 0xD0, 
-0xBF, 0x23, 0x9C, 0x79, 0x53, 0x4D, 0x26, 0xE7, 0x16, 0x8C, 0xC5, 0x1A, 0x59, 0x70, 0xE6, 0xA8, 
-0x92, 0xBE, 0x15, 0x45, 0x5A, 0xF3, 0x1A, 0xC9, 0x47, 0x3A, 0x67, 0x39, 0x46, 0xB2, 0x1C, 0x6D, 
-0x56, 0x27, 0x2D, 0x20, 0x3E, 0x5D, 0xB9, 0x73, 0x1A, 0xB3, 0xFF, 0x74, 0xE3, 0xC5, 0x6D, 0xF6, 
-0x40, 0x2F, 0xE1, 0x5E, 0x39, 0x4B, 0xD9, 0x29, 0xCB, 0xDE, 0x9A, 0xE3, 0x0D, 0x81, 0x2B, 0x9D, 
-0x3D, 0x40, 0x0B, 0xFE, 0xBC, 0x2E, 0xC1, 0x1A, 0xB1, 0xF8, 0x16, 0xE6, 0x20, 0xF0, 0xC8, 0x9A, 
-0x57, 0x67, 0xD2, 0xCF, 0x3D, 0xC4, 0xB0, 0xC1, 0x7D, 0x1F, 0xD7, 0x60, 0xB0, 0x5E, 0x1F, 0xB1, 
-0x21, 0x53, 0x02, 0x7C, 0x57, 0xE9, 0x7E, 0x3A, 0x22, 0x60, 0x43, 0xCA, 0x99, 0xD3, 0xA6, 0x3C, 
-0x7A, 0x57, 0xCA, 0x9F, 0x6A, 0xF4, 0x2A, 0xDF, 0x07, 0x57, 0x38, 0x55, 0x10, 0x9A, 0x80, 0x6A, 
-0xF9, 0x98, 0x6E, 0x15, 0x70, 0xD7, 0xAD, 0xDC, 0x34, 0x0B, 0x2B, 0x17, 0x9D, 0xDC, 0xE8, 0xF5, 
-0x9A, 0x08, 0xCC, 0x3D, 0x4D, 0x2B, 0x4F, 0xA5, 0x7A, 0x65, 0x84, 0xB1, 0xFF, 0x5E, 0x94, 0x69, 
-0xFD, 0xE5, 0x2F, 0x15, 0xF2, 0x2F, 0x70, 0x61, 0x2A, 0xE6, 0x09, 0xAB, 0x5D, 0x98, 0x02, 0xC1, 
-0xDE, 0x04, 0xB8, 0xA6, 0x90, 0x44, 0x45, 0x0D, 0xC3, 0x74, 0x35, 0xD0, 0x01, 0xAD, 0xB5, 0x5D, 
-0xCE, 0xAC, 0x18, 0xF3, 0xC9, 0x74, 0x15, 0xB8, 0x36, 0xB1, 0x99, 0x47, 0xAB, 0xEB, 0x54, 0x0D, 
-0x30, 0x1F, 0x1C, 0x1F, 0x54, 0x3B, 0x90, 0xB3, 0x38, 0xE1, 0x7E, 0x13, 0xFC, 0x05, 0xE0, 0x15, 
-0x8F, 0x1F, 0x55, 0x26, 0x1B, 0x07, 0xA0, 0xB2, 0x38, 0xA9, 0xAA, 0x23, 0xB7, 0xC0, 0x1B, 0xB8, 
-0xFE, 0xAE, 0x5F, 0x78, 0x6C, 0x01, 0x8A, 0x1A, 0xF0, 0xC7, 0x3E, 0x67, 0xA1, 0x47, 0x2D, 0x86, 
-0xB9, 0x12, 0xD6, 0xF3, 0x13, 0xCF, 0x3B, 0x22, 0xF2, 0xFF, 0x3A, 0x96, 0x73, 0x20, 0xAF, 0x33, 
-0xF0, 0x65, 0x55, 0x78, 0xEB, 0x47, 0x09, 0xCC, 0xDE, 0xD2, 0xC8, 0xB8, 0x91, 0xC8, 0xEB, 0xBB, 
-0x00, 0x75, 0x2F, 0xA2, 0x0E, 0xCC, 0xC0, 0x42, 0x51, 0x10, 0xC0, 0xE2, 0xF0, 0xEA, 0xAC, 0x20, 
-0xBB, 0xAE, 0x4A, 0x6E, 0xB5, 0x22, 0xB9, 0x9F, 0x35, 0xC5, 0xCE, 0x4B, 0x75, 0x4F, 0x58, 0x2C, 
-0xFA, 0xD4, 0x34, 0x4C, 0x1B, 0xFB, 0xA7, 0x4E, 0x5B, 0x1C, 0x1E, 0x2C, 0xC9, 0x3C, 0x10, 0xAB, 
-0x2F, 0x65, 0x6D, 0x51, 0x8A, 0x50, 0x5D, 0x1E, 0x0B, 0x83, 0x10, 0xD3, 0x4E, 0x2C, 0xBF, 0x2C, 
-0x26, 0x48, 0xFF, 0x7F, 0x1A, 0xD9, 0x3B, 0x0F, 0xE5, 0x46, 0x93, 0x8B, 0x5D, 0x90, 0x44, 0x0B, 
-0x62, 0x25, 0x5C, 0xA4, 0x9E, 0x04, 0x86, 0x84, 0xCE, 0xA9, 0xEB, 0xE7, 0x97, 0xA5, 0xD6, 0x03, 
-0xB8, 0x42, 0x21, 0x1D, 0xBB, 0x21, 0x90, 0xD9, 0x7A, 0xE0, 0x96, 0xD5, 0xA4, 0xBC, 0x8C, 0x76, 
-0x71, 0x2C, 0xF7, 0x49, 0x5C, 0xA0, 0x2E, 0xAA, 0x49, 0xD7, 0x76, 0x57, 0x72, 0x5D, 0x7E, 0xAA, 
-0xA9, 0x9C, 0x49, 0x86, 0x98, 0x1E, 0xAC, 0x18, 0x07, 0x93, 0xA7, 0x11, 0xD7, 0x6E, 0xB9, 0x7B, 
-0x79, 0x71, 0x0C, 0x44, 0x24, 0xB9, 0x0A, 0x4D, 0xB0, 0x10, 0x7A, 0xB6, 0xA6, 0xA2, 0xAD, 0xE7, 
-0xF6, 0x8B, 0x17, 0xBA, 0x9E, 0x3A, 0x52, 0xBA, 0x9E, 0x2B, 0x97, 0x7E, 0xD2, 0x65, 0x41, 0xA6, 
-0x3C, 0x41, 0x91, 0x4B, 0xD3, 0x2E, 0x2B, 0xC0, 0x5D, 0x2C, 0x06, 0x95, 0xED, 0x18, 0x20, 0xEF, 
-0xA0, 0xA6, 0x26, 0x26, 0xE2, 0x2E, 0x6F, 0x50, 0xD7, 0x97, 0x14, 0x6B, 0x83, 0x72, 0x05, 0x4B, 
-0x00, 0xF4, 0x17, 0x6A, 0xB9, 0xBF, 0xFD, 0xC3, 0xC7, 0xA2, 0xC2, 0x3E, 0x0E, 0x51, 0xBF, 0xC8, 
-0xD0, 0x5A, 0xE2, 0x3A, 0x1E, 0x95, 0xAF, 0x47, 0xC5, 0xB8, 0x89, 0xEA, 0x98, 0xCD, 0x55, 0x2E, 
-0x64, 0x79, 0x25, 0xD4, 0x00, 0x98, 0xCF, 0xC4, 0xC3, 0x69, 0x71, 0x95, 0x44, 0x85, 0x8C, 0xA8, 
-0xA8, 0xDB, 0x41, 0x2C, 0x69, 0xE4, 0xAE, 0x2F, 0x6B, 0xD8, 0x2D, 0x80, 0x91, 0x7F, 0x00, 0x93, 
-0xA0, 0xDA, 0x25, 0x00, 0x08, 0x0C, 0x50, 0xBB, 0x56, 0xFA, 0x06, 0x04, 0x1A, 0x50, 0x50, 0x1E, 
-0x6F, 0x93, 0x08, 0xCA, 0x4A, 0x95, 0x9E, 0x89, 0x7D, 0xB2, 0x4E, 0xAC, 0x65, 0xA0, 0x64, 0xD7, 
-0x94, 0xBB, 0x54, 0x26, 0x4A, 0xA7, 0xDA, 0x95, 0x28, 0x4F, 0xB8, 0xEC, 0x3C, 0x8D, 0x04, 0xBE, 
-0xE5, 0xB9, 0xD6, 0xDD, 0x54, 0x0B, 0x42, 0xE6, 0xCB, 0x9B, 0xBD, 0x43, 0x8D, 0x88, 0x1C, 0x6D, 
-0xA5, 0x76, 0x3D, 0x53, 0x12, 0x98, 0xD5, 0xBC, 0xC4, 0x15, 0xE6, 0x0E, 0x35, 0x82, 0x3B, 0x87, 
-0xBE, 0x0B, 0x1E, 0xA6, 0x9A, 0x41, 0x0C, 0x62, 0x9E, 0xC0, 0x5F, 0x8D, 0x60, 0xEA, 0x79, 0xAA, 
-0xF9, 0x00, 0x9A, 0x06, 0x63, 0x9E, 0x07, 0x77, 0xD0, 0x92, 0xB2, 0x01, 0x57, 0xE8, 0x2E, 0xA7, 
-0xA5, 0x72, 0x5B, 0xD1, 0x54, 0x33, 0xB3, 0x02, 0x0C, 0x4F, 0x2C, 0x1A, 0x4E, 0x35, 0xE1, 0x5C, 
-0x17, 0x8A, 0x7F, 0x06, 0x9B, 0x9D, 0x96, 0x37, 0xF3, 0x29, 0x78, 0x0D, 0x29, 0x98, 0x35, 0xC0, 
-0xE8, 0xC3, 0xC0, 0x24, 0x83, 0x11, 0x1D, 0x92, 0x21, 0xF0, 0x36, 0x80, 0x7F, 0x86, 0x3E, 0x26, 
-0xF2, 0x4A, 0xFE, 0x19, 0xFF, 0x82, 0xDA, 0x80, 0xD5, 0x3B, 0x53, 0x3C, 0xEF, 0x9F, 0x20, 0xCD, 
-0x41, 0x7F, 0x3C, 0x22, 0xE2, 0x3F, 0x49, 0xA9, 0x3F, 0x1C, 0xC2, 0xE5, 0x99, 0xE9, 0xF5, 0x8D, 
-0x31, 0xFC, 0xA5, 0x26, 0x31, 0x45, 0x39, 0xB6, 0x6A, 0xF6, 0xCF, 0x86, 0x24, 0x2B, 0xD0, 0xC5, 
-0xA5, 0xE1, 0xE9, 0x50, 0x0D, 0xFF, 0x95, 0x49, 0xE9, 0x48, 0x46, 0x97, 0xF4, 0x4A, 0x37, 0xE0, 
-0x62, 0x34, 0xF8, 0xC9, 0x1C, 0xD0, 0x1C, 0x31, 0x62, 0xE6, 0x49, 0xEB, 0xE6, 0x0A, 0x68, 0x9E, 
-0xBF, 0x2E, 0xB3, 0x77, 0x4E, 0x90, 0xF1, 0xDA, 0xA6, 0xA0, 0x25, 0xC1, 0x4B, 0x81, 0x6B, 0xC5, 
-0x24, 0xC9, 0x89, 0x21, 0x8A, 0xBC, 0x06, 0xA6, 0x51, 0x7E, 0x41, 0xAD, 0xCA, 0x34, 0xB0, 0xAC, 
-0x0F, 0xDE, 0x0D, 0x69, 0x81, 0xCB, 0x1C, 0x61, 0xB8, 0x5A, 0xD4, 0xB1, 0x7C, 0xD2, 0x1F, 0x93, 
-0xF3, 0x0A, 0xC7, 0x69, 0x3B, 0x6B, 0xF8, 0xCA, 0x2C, 0xE6, 0x49, 0x4B, 0xA4, 0x95, 0x70, 0xE5, 
-0x06, 0x94, 0xF0, 0xEF, 0x2A, 0x8D, 0x00, 0x8B, 0x02, 0xE8, 0x1C, 0xCF, 0xA4, 0xC4, 0x33, 0x31, 
-0x57, 0xC0, 0x73, 0xF5, 0x41, 0xD1, 0x43, 0x65, 0x0C, 0x48, 0xDA, 0xA3, 0x5E, 0x95, 0xE7, 0x2A, 
-0xCE, 0xA2, 0x28, 0xEB, 0x91, 0x1A, 0xF9, 0x05, 0xB9, 0x9F, 0x6A, 0x1A, 0x17, 0x4D, 0xBF, 0xCB, 
-0xAB, 0x07, 0x29, 0xA9, 0x07, 0x31, 0x17, 0x7A, 0x0D, 0xDF, 0xBA, 0x7C, 0xB4, 0xC3, 0x60, 0x00, 
-0xFB, 0xB7, 0x9A, 0x37, 0x98, 0xAE, 0x63, 0x69, 0xBB, 0xB6, 0x35, 0x6C, 0xEB, 0x5C, 0xBD, 0x34, 
-0x6C, 0xF9, 0xEB, 0x82, 0x61, 0x63, 0x9C, 0x53, 0x0E, 0xC1, 0x64, 0x54, 0x32, 0x6C, 0xF2, 0x81, 
-0xBC, 0x51, 0x2B, 0xD6, 0xFC, 0x62, 0x46, 0xAD, 0xAB, 0x4D, 0x39, 0x27, 0xE6, 0xE0, 0xDD, 0xA8, 
-0x38, 0x40, 0x7E, 0x1A, 0x15, 0x95, 0x6F, 0x71, 0xD2, 0xD5, 0x52, 0x05, 0xDE, 0xA3, 0xD8, 0xD5, 
-0x13, 0x82, 0xBD, 0x8C, 0x41, 0xB0, 0xC1, 0x98, 0x0C, 0x4E, 0xA1, 0x05, 0x82, 0xC6, 0x70, 0x4C, 
-0x4E, 0x05, 0x1D, 0x55, 0x69, 0x03, 0x2D, 0x41, 0xE7, 0x61, 0x00, 0xB2, 0x0C, 0x34, 0xF2, 0x08, 
-0xDF, 0x03, 0xB0, 0xD4, 0x0F, 0xE6, 0x54, 0x3B, 0x87, 0x4B, 0x53, 0x5C, 0x02, 0xB1, 0x76, 0x42, 
-0xFB, 0xD2, 0x98, 0xF2, 0x0A, 0x56, 0xC1, 0x0B, 0xCB, 0x95, 0xE6, 0x55, 0xE6, 0x56, 0x94, 0xCB, 
-0xF8, 0xAC, 0xA3, 0x1A, 0xAC, 0x97, 0xC5, 0x9E, 0x49, 0x0B, 0x2C, 0x97, 0x5B, 0xC0, 0xA3, 0xF5, 
-0x20, 0xD1, 0xB5, 0x1E, 0xE5, 0x37, 0x9F, 0x6A, 0x23, 0x04, 0x57, 0xDE, 0xEE, 0xDA, 0x4F, 0xF8, 
-0xA4, 0xE8, 0x27, 0xD9, 0x4D, 0xE2, 0x12, 0xBE, 0x87, 0x9B, 0xBB, 0xA9, 0x9E, 0x8E, 0x59, 0x22, 
-0x64, 0x6E, 0x4D, 0xE9, 0xA4, 0x6F, 0x2A, 0x5A, 0xF2, 0x17, 0x52, 0x1B, 0xF5, 0xC7, 0x27, 0x92, 
-0x9E, 0xF8, 0xB5, 0x2D, 0x6F, 0x67, 0xFD, 0xE1, 0x58, 0x89, 0x29, 0x7F, 0x0A, 0x0E, 0xCF, 0xFB, 
-0xA7, 0x67, 0x4A, 0x2B, 0xC5, 0xCF, 0x6D, 0xA9, 0x16, 0x15, 0x7C, 0xD8, 0x5D, 0xC1, 0x8B, 0x74, 
-0xCA, 0x23, 0xC5, 0xDC, 0x99, 0xD2, 0x1A, 0x39, 0x25, 0x5B, 0x11, 0x3A, 0x29, 0xFB, 0xEE, 0xD8, 
-0x49, 0x4A, 0x25, 0xE8, 0x44, 0x9B, 0x9F, 0x67, 0x48, 0xD7, 0xC5, 0x08, 0xC5, 0x22, 0x19, 0x8E, 
-0x61, 0xB0, 0x53, 0x0C, 0x8B, 0x3E, 0x60, 0xB8, 0x78, 0x4D, 0x1F, 0xC1, 0xC8, 0x93, 0x3F, 0x71, 
-0xD7, 0x2E, 0x06, 0x48, 0x39, 0x0F, 0xDB, 0x13, 0x75, 0xF4, 0x39, 0xD4, 0x29, 0x8D, 0x3A, 0x41, 
-0xE7, 0x9A, 0x39, 0x31, 0x84, 0x42, 0x5E, 0xB2, 0xF4, 0x49, 0x0F, 0xDD, 0xF8, 0x08, 0x0C, 0x6C, 
-0xE0, 0x80, 0x3B, 0x68, 0x89, 0xC2, 0xE8, 0xB0, 0x40, 0xB9, 0x4C, 0x5D, 0x56, 0x22, 0x98, 0x94, 
-0xAE, 0x0B, 0x61, 0xB0, 0x85, 0xDB, 0x20, 0x24, 0x1F, 0xC4, 0x3E, 0x83, 0x88, 0xF4, 0x6E, 0xD9, 
-0x32, 0x3C, 0x22, 0xEF, 0xD4, 0x32, 0xC4, 0x11, 0xB9, 0x09, 0x5C, 0xAF, 0xDA, 0x42, 0xB9, 0x15, 
-0xB9, 0x4D, 0x21, 0xD2, 0x79, 0x70, 0xDF, 0x14, 0x22, 0x88, 0x96, 0x80, 0x38, 0xE3, 0x10, 0xA1, 
-0x70, 0x5A, 0x4B, 0xB2, 0xC2, 0x3C, 0x6E, 0xD0, 0x2B, 0x2F, 0x30, 0x10, 0xF5, 0x5B, 0xB6, 0x49, 
-0x72, 0xCB, 0x3F, 0xB9, 0xD9, 0x35, 0x5A, 0x04, 0xF7, 0x57, 0xB8, 0xB3, 0xA9, 0x77, 0x80, 0x77, 
-0x0E, 0x0E, 0x55, 0xF8, 0x21, 0x36, 0x7A, 0x60, 0xD5, 0x16, 0x3D, 0x29, 0x31, 0xA0, 0xCB, 0xFE, 
-0xDD, 0x64, 0x11, 0x45, 0x08, 0x96, 0x7F, 0x4C, 0x4C, 0xEB, 0xDA, 0x65, 0x4E, 0xE6, 0xA6, 0x30, 
-0xAC, 0xA9, 0x75, 0xB4, 0xE7, 0xFA, 0x2C, 0x78, 0x20, 0xB3, 0xB9, 0xFE, 0xC8, 0x3C, 0x0F, 0xC1, 
-0xBD, 0xFD, 0xE7, 0xAF, 0x2D, 0x81, 0xA0, 0xA0, 0xB0, 0xE1, 0x76, 0xEB, 0xDD, 0x8A, 0x28, 0xF9, 
-0x3D, 0x44, 0x6A, 0xF2, 0x12, 0xF0, 0xE9, 0xBA, 0x92, 0xA6, 0xAE, 0x36, 0x6E, 0x57, 0xD1, 0x2E, 
-0xFF, 0xF9, 0xEB, 0xD5, 0x26, 0x89, 0x3B, 0xF0, 0x5A, 0x22, 0x2D, 0x77, 0xCC, 0x68, 0x97, 0xAF, 
-0x5D, 0x0E, 0x31, 0xFF, 0x72, 0x86, 0xCB, 0x41, 0xAC, 0x2D, 0x34, 0x96, 0xB7, 0x9A, 0x75, 0x12, 
-0x54, 0x9D, 0xD9, 0xD4, 0xDE, 0x5D, 0x1F, 0xEB, 0xB5, 0x2E, 0x5D, 0xC8, 0x2B, 0x68, 0x5E, 0x5A, 
-0xF8, 0x7C, 0xDA, 0xA7, 0xA4, 0x7B, 0x8A, 0xE6, 0xCD, 0xB0, 0xE7, 0x2F, 0xDF, 0xBD, 0xFC, 0xC2, 
-0x6A, 0xB7, 0xC6, 0xAE, 0x83, 0xEA, 0xBD, 0xFC, 0x7C, 0x8A, 0x97, 0xEA, 0xCB, 0x8F, 0xCC, 0xA3, 
-0xA0, 0x03, 0xF4, 0x29, 0xBA, 0x77, 0x93, 0x30, 0x2F, 0xD8, 0xB7, 0xE6, 0xE1, 0xC2, 0x6B, 0x41, 
-0xEB, 0xB0, 0xE0, 0xF9, 0x34, 0x4E, 0xC8, 0xF4, 0x14, 0x7D, 0x9B, 0x73, 0xC6, 0x20, 0xFC, 0xB9, 
-0xF9, 0xD2, 0x0A, 0x27, 0x61, 0xFB, 0x3A, 0x94, 0xCD, 0x66, 0xE4, 0xD6, 0xC5, 0xF8, 0x70, 0xB3, 
-0xB6, 0x35, 0x14, 0x37, 0x4C, 0xFD, 0xD4, 0xBF, 0x4B, 0xB7, 0xE1, 0x6E, 0x9A, 0xE3, 0x85, 0xC6, 
-0x75, 0xD3, 0xD4, 0xCD, 0x2A, 0xD4, 0xA8, 0x3E, 0x6F, 0x23, 0x4C, 0x58, 0xE2, 0x2A, 0x1D, 0x32, 
-0xF7, 0x5F, 0x09, 0x6B, 0x03, 0xB7, 0x0D, 0x8D, 0x7C, 0x4A, 0x1C, 0xF7, 0x67, 0xD7, 0xE5, 0xAF, 
-0x37, 0x3E, 0x54, 0xDC, 0xD4, 0xBD, 0x69, 0x48, 0xE0, 0xD3, 0xA8, 0x39, 0xF7, 0x34, 0x16, 0xFB, 
-0x00, 0x56, 0xCC, 0xD3, 0x52, 0x72, 0xB2, 0x0C, 0xE3, 0x30, 0x4D, 0x1E, 0x71, 0xC1, 0xD8, 0x1D, 
-0x17, 0xFB, 0x27, 0xC4, 0x78, 0xF9, 0xAA, 0x35, 0xBB, 0xBB, 0x41, 0xD2, 0x5A, 0xC6, 0x5D, 0xDF, 
-0x09, 0xBA, 0xB0, 0x9B, 0x7F, 0x46, 0x30, 0xAC, 0xDB, 0x6E, 0x14, 0x8A, 0x05, 0x81, 0xD6, 0x87, 
-0xEB, 0xD1, 0xC2, 0xC1, 0xD3, 0x11, 0xAC, 0x8C, 0xC8, 0x06, 0x67, 0x03, 0xE8, 0xEE, 0x67, 0x10, 
-0x66, 0x0D, 0xB6, 0x23, 0x99, 0x55, 0x0B, 0x8B, 0xD8, 0xAC, 0xCF, 0x0F, 0xAC, 0x19, 0x2B, 0x94, 
-0x5E, 0xFE, 0xF6, 0x37, 0x2F, 0x76, 0x97, 0x01, 0x81, 0x2B, 0x1F, 0x54, 0x78, 0x42, 0x90, 0xEB, 
-0x70, 0xEB, 0x96, 0xC4, 0x91, 0x2B, 0x7D, 0x19, 0xCD, 0x73, 0xED, 0xDC, 0x53, 0xEE, 0xBB, 0xFE, 
-0x5C, 0xE4, 0x40, 0x36, 0x74, 0xEA, 0x66, 0xE9, 0xAA, 0x23, 0x43, 0x9C, 0x00, 0x88, 0xE4, 0x5A, 
-0xC5, 0x2E, 0xFD, 0x5E, 0x38, 0x42, 0xD0, 0xB5, 0xDF, 0x2D, 0xEA, 0xAF, 0x68, 0x94, 0xC9, 0x78, 
-0x13, 0x52, 0x7E, 0x87, 0x01, 0x9C, 0x48, 0x1F, 0x88, 0x7B, 0x7B, 0xE9, 0xCB, 0xDD, 0xC7, 0xD5, 
-0x2E, 0xF6, 0x54, 0x4C, 0xC1, 0x9F, 0xC3, 0x92, 0xA6, 0x36, 0x83, 0x7A, 0xEE, 0xDC, 0x17, 0xC7, 
-0x6A, 0xA2, 0x09, 0xB1, 0xD0, 0xF7, 0xE5, 0xAF, 0x76, 0x30, 0xB3, 0xD2, 0x39, 0x10, 0xDD, 0xA6, 
-0x0A, 0x14, 0xFD, 0xE2, 0x5E, 0x39, 0x20, 0xFD, 0x27, 0xFE, 0xDB, 0xFF, 0x3A, 0x30, 0x3D, 0x4F, 
-0x48, 0xC7, 0x40, 0xA6, 0xA3, 0x4D, 0xEE, 0xAA, 0x33, 0x79, 0x3D, 0x51, 0xCB, 0xAA, 0x02, 0xE4, 
-0x4D, 0x6A, 0xD2, 0xDE, 0x7B, 0x35, 0x45, 0xD5, 0xC8, 0xFB, 0x47, 0xB1, 0x17, 0xAB, 0x18, 0x7A, 
-0x0F, 0xB6, 0x0F, 0xBD, 0x39, 0x92, 0x69, 0x8A, 0xBD, 0xAF, 0xC1, 0xAB, 0xF5, 0x83, 0x08, 0x77, 
-0xFC, 0xE1, 0xF1, 0xB5, 0x6D, 0x02, 0x6D, 0x12, 0xDF, 0x07, 0xB8, 0x8F, 0xAB, 0xA3, 0x26, 0x3D, 
-0x9F, 0x07, 0x98, 0xCA, 0xF4, 0xC4, 0xB8, 0x23, 0xE0, 0xD4, 0x9F, 0x23, 0xB9, 0x2F, 0xED, 0x08, 
-0x7A, 0xB2, 0x03, 0xBF, 0xAC, 0x27, 0x88, 0x9B, 0x64, 0x7D, 0x81, 0x29, 0xEA, 0xCC, 0x6F, 0x7F, 
-0xF7, 0x5D, 0x6B, 0xDF, 0xCE, 0xE0, 0x8F, 0x2E, 0x9B, 0x07, 0xD9, 0x4B, 0x10, 0x7A, 0x3F, 0x82, 
-0x8A, 0x99, 0x9B, 0x53, 0x3F, 0xCF, 0xE3, 0x16, 0x0A, 0xDE, 0x36, 0xA2, 0x5B, 0x5D, 0x49, 0xCF, 
-0xCE, 0x96, 0x15, 0xD6, 0xD3, 0x5D, 0xCE, 0xD5, 0xD6, 0x8D, 0xF6, 0x65, 0xF5, 0x8E, 0xA6, 0x4C, 
-0x9D, 0xF9, 0xC1, 0xAD, 0x95, 0x9D, 0x13, 0x4B, 0xB9, 0x03, 0x92, 0x5B, 0x8D, 0xB3, 0xFC, 0xF9, 
-0x22, 0xED, 0x12, 0x37, 0x3D, 0x74, 0x1A, 0x63, 0xA2, 0x7E, 0x86, 0x8D, 0xD8, 0xCD, 0xDD, 0x65, 
-0xA6, 0x97, 0xFB, 0xEF, 0xE3, 0xC7, 0x10, 0xA7, 0x06, 0xDC, 0x18, 0x06, 0x63, 0x33, 0x9D, 0x3C, 
-0xEE, 0x72, 0x30, 0xEA, 0x14, 0x18, 0x11, 0xE1, 0xE8, 0x02, 0x07, 0x2D, 0x4C, 0xE9, 0x62, 0x0D, 
-0xE3, 0x7D, 0x56, 0x01, 0x19, 0xED, 0x1D, 0x76, 0x69, 0x32, 0x2F, 0xAD, 0xDA, 0xD4, 0xAE, 0x56, 
-0xCF, 0x3B, 0x09, 0x7A, 0x2C, 0x24, 0xDD, 0xCB, 0x08, 0xDC, 0x53, 0x1F, 0x7D, 0xA0, 0x3E, 0xC4, 
-0x10, 0x9D, 0x2D, 0xA1, 0x9A, 0x88, 0x95, 0x1B, 0x3E, 0x21, 0x8E, 0xC7, 0x1E, 0x5E, 0x91, 0xBA, 
-0x79, 0x9F, 0xCC, 0x69, 0x38, 0x21, 0x67, 0xE1, 0x43, 0x9B, 0x07, 0x90, 0xD1, 0xCE, 0x77, 0xA5, 
-0x9F, 0x2C, 0x67, 0x4C, 0x0D, 0x89, 0x5C, 0x27, 0xDA, 0x30, 0xB5, 0x8B, 0x41, 0x91, 0x79, 0x77, 
-0xD9, 0x19, 0x0C, 0x8D, 0x08, 0x83, 0x38, 0xD5, 0x06, 0x86, 0x46, 0x96, 0xB8, 0xA5, 0x61, 0x00, 
-0xDF, 0xF4, 0x61, 0xAA, 0x8D, 0x8D, 0xCC, 0x79, 0x10, 0x8B, 0x47, 0x13, 0x32, 0x32, 0x80, 0x25, 
-0xE2, 0x00, 0x0A, 0x7A, 0xE4, 0xFE, 0xC2, 0x26, 0x64, 0xC0, 0xD9, 0x52, 0x15, 0xDC, 0xAB, 0x98, 
-0x67, 0x6C, 0x18, 0x9D, 0xB8, 0x16, 0xB8, 0x2A, 0xF2, 0x39, 0x8A, 0x46, 0xFF, 0xBC, 0x9E, 0x66, 
-0x7A, 0x86, 0x63, 0x45, 0x79, 0x4F, 0x97, 0x27, 0x0A, 0xC1, 0xB1, 0x0D, 0x7C, 0x9B, 0xF2, 0xC7, 
-0xC3, 0x57, 0xE2, 0x70, 0xA0, 0xDC, 0xFD, 0xE4, 0x04, 0x7C, 0x39, 0x21, 0x09, 0x7A, 0x1F, 0x16, 
-0x6E, 0x80, 0xD6, 0x2E, 0x41, 0xAA, 0xCE, 0x31, 0x84, 0x5A, 0xE4, 0x43, 0xFC, 0xF0, 0x48, 0x4E, 
-0xCE, 0x9E, 0x64, 0xD0, 0xE5, 0x16, 0xF7, 0xB2, 0x2C, 0x4D, 0x79, 0x54, 0x48, 0xD5, 0xC0, 0x71, 
-0xF1, 0xC3, 0xF7, 0xDF, 0xB7, 0xAF, 0x2B, 0x66, 0x4D, 0x3F, 0xAB, 0x3F, 0x2B, 0x43, 0x70, 0xF2, 
-0x47, 0x72, 0xC3, 0xE6, 0x09, 0x17, 0xB3, 0xCF, 0x55, 0x1A, 0x47, 0xCB, 0x19, 0x62, 0xD8, 0x3C, 
-0x43, 0xB4, 0x2D, 0x04, 0x48, 0xBA, 0xE9, 0x5C, 0xD3, 0x35, 0x03, 0xF6, 0x8C, 0x59, 0xFB, 0x8D, 
-0xB9, 0x87, 0xBA, 0x86, 0x5B, 0x27, 0x1D, 0x19, 0xCA, 0xEE, 0x2F, 0xCE, 0xEF, 0x3A, 0xED, 0x34, 
-0x3D, 0xD7, 0xC1, 0xAC, 0x55, 0x21, 0xDA, 0x6D, 0xFA, 0x11, 0x74, 0x76, 0x9B, 0x82, 0xC4, 0xA3, 
-0xED, 0xD3, 0x90, 0x88, 0x41, 0xEB, 0x27, 0x20, 0xCC, 0x6F, 0xA9, 0xA9, 0x87, 0xA8, 0xC3, 0x52, 
-0x3B, 0xA4, 0x25, 0xB6, 0x9F, 0x86, 0x04, 0x89, 0x4D, 0x53, 0x91, 0xAC, 0xB4, 0x55, 0xBC, 0xBE, 
-0xC7, 0xBE, 0xEB, 0x3E, 0x2D, 0x09, 0x4A, 0x25, 0x8B, 0x27, 0x94, 0xB9, 0x83, 0xAD, 0xC3, 0x0E, 
-0xF8, 0x12, 0x56, 0xAE, 0x25, 0xE7, 0xCE, 0x2C, 0xB0, 0x64, 0x18, 0x6F, 0x7D, 0xB5, 0xC6, 0x27, 
-0x33, 0xB6, 0x7B, 0xB5, 0x3F, 0x91, 0x12, 0x3C, 0xD7, 0x47, 0xD4, 0xBA, 0xF3, 0x83, 0x7B, 0x8F, 
-0xD9, 0x73, 0xF6, 0xDA, 0xA3, 0x7C, 0x89, 0xC3, 0x24, 0x4D, 0x04, 0x24, 0x3C, 0xC2, 0x89, 0x54, 
-0xEC, 0xC7, 0x11, 0x49, 0x86, 0xDF, 0x2D, 0xD7, 0xDE, 0x2D, 0x57, 0xDA, 0x25, 0x0D, 0xD6, 0x2B, 
-0x55, 0xD5, 0xCE, 0xCE, 0x73, 0x45, 0xEA, 0xAF, 0xD3, 0x72, 0x91, 0x4C, 0xEE, 0x08, 0x30, 0xB1, 
-0x13, 0xB0, 0x1D, 0x56, 0xB0, 0x0C, 0xA9, 0x95, 0xEE, 0x7A, 0x2E, 0xDF, 0xDE, 0x32, 0x29, 0x99, 
-0x51, 0x15, 0xE8, 0x37, 0x6D, 0x5A, 0xEE, 0x4E, 0xA1, 0x93, 0xA2, 0x16, 0x48, 0x49, 0xFC, 0xDE, 
-0x43, 0x90, 0xEE, 0x06, 0x9D, 0xD0, 0x2C, 0x3C, 0x9D, 0x57, 0x1A, 0x74, 0xC1, 0x55, 0x26, 0x18, 
-0x9D, 0x71, 0x18, 0xCB, 0xE2, 0x75, 0x87, 0x65, 0xFF, 0x7C, 0x0D, 0xA0, 0xF2, 0xD3, 0x4D, 0x73, 
-0x62, 0x18, 0x5D, 0x25, 0xEF, 0x96, 0x12, 0x17, 0x55, 0xF7, 0x0E, 0xD2, 0xF7, 0xE8, 0x76, 0xEF, 
-0x11, 0x21, 0x86, 0x1B, 0xB0, 0x37, 0xE3, 0x63, 0x8C, 0x3F, 0x0F, 0x3E, 0xC5, 0xED, 0x7F, 0x38, 
-0x55, 0xE2, 0x99, 0xA6, 0x75, 0xF3, 0xEB, 0x15, 0x5B, 0x28, 0xBE, 0x51, 0x08, 0xE2, 0xE0, 0xFE, 
-0xD7, 0xFF, 0xFC, 0xB5, 0xDB, 0xDC, 0xD8, 0x91, 0xA3, 0xFF, 0xAB, 0x9E, 0xC5, 0x7A, 0x9A, 0xDA, 
-0xEC, 0x5D, 0xA4, 0x06, 0xF2, 0x6B, 0xF1, 0x2D, 0xAE, 0x13, 0x8B, 0x45, 0x5F, 0xB1, 0x63, 0x21, 
-0xF8, 0xDB, 0xAB, 0x53, 0xE1, 0x61, 0xAE, 0x17, 0x62, 0xEB, 0xDF, 0xDD, 0x83, 0xCF, 0xE0, 0x1E, 
-0xA4, 0xE0, 0x36, 0xB8, 0x07, 0xD7, 0xEA, 0xF6, 0xEF, 0x01, 0xCE, 0x67, 0x30, 0x43, 0x99, 0x62, 
-0x77, 0x30, 0x43, 0x69, 0x47, 0x7C, 0x45, 0xE9, 0x9C, 0x96, 0xA2, 0xDC, 0x65, 0xDE, 0xA0, 0x09, 
-0x03, 0xF6, 0x86, 0x39, 0xA0, 0x07, 0x62, 0x81, 0xAD, 0xFF, 0xB3, 0x78, 0x09, 0xA7, 0xBB, 0x0C, 
-0x79, 0xB0, 0x62, 0xE9, 0x3B, 0x94, 0x89, 0x17, 0xE4, 0xF6, 0xCA, 0xD5, 0x1D, 0xF6, 0xC7, 0x37, 
-0xB1, 0xAE, 0x29, 0xD0, 0xE8, 0x11, 0xB4, 0x96, 0x07, 0x7E, 0x90, 0x44, 0x5B, 0x1C, 0x32, 0x17, 
-0xAB, 0x83, 0x37, 0x82, 0x38, 0x99, 0xAE, 0x4F, 0xDF, 0x5A, 0x9C, 0xD1, 0x98, 0xA9, 0xA3, 0xBE, 
-0xBD, 0x03, 0xD9, 0x7A, 0xF9, 0xFC, 0x69, 0xEE, 0xD9, 0x7E, 0xC4, 0x2D, 0x3C, 0xFA, 0x69, 0x29, 
-0x76, 0x0E, 0x9A, 0x6B, 0xDA, 0x42, 0xF2, 0x29, 0xC1, 0x03, 0xA9, 0xC5, 0x5A, 0xC5, 0xB3, 0xBF, 
-0xB8, 0x5E, 0xE9, 0xDB, 0x57, 0x0B, 0xD7, 0xB3, 0x7B, 0xB9, 0xE7, 0x6B, 0x0F, 0x5E, 0x97, 0x5F, 
-0x7D, 0x2A, 0xE5, 0x01, 0x9E, 0xD0, 0x77, 0x12, 0xAD, 0xFE, 0x1C, 0x69, 0x44, 0xB4, 0x7C, 0xD9, 
-0xFD, 0x35, 0xA9, 0xDF, 0xE1, 0xD9, 0x49, 0x3C, 0x08, 0x7C, 0x23, 0xDF, 0x94, 0x8A, 0x27, 0x62, 
-0xAF, 0xAF, 0x3E, 0x92, 0x1F, 0x42, 0x70, 0x77, 0xDC, 0x5F, 0xE4, 0x91, 0xF2, 0xDC, 0xBB, 0x23, 
-0xD4, 0x8B, 0xCB, 0x8A, 0x30, 0x17, 0xD3, 0xCB, 0x85, 0x5B, 0x58, 0xA2, 0xCB, 0xB3, 0xB5, 0xE2, 
-0xAD, 0x11, 0x72, 0x19, 0xB3, 0xEE, 0xBD, 0x15, 0x8A, 0xF2, 0x62, 0x50, 0x22, 0x9E, 0x4B, 0xD4, 
-0x9A, 0x98, 0xA6, 0xAD, 0xDE, 0x4C, 0x53, 0xB6, 0x67, 0x86, 0xD1, 0xFD, 0x7D, 0xA5, 0x4B, 0xCA, 
-0xE7, 0x2E, 0x30, 0x54, 0x7A, 0xC4, 0x63, 0x31, 0x6E, 0xAD, 0x81, 0x61, 0x6E, 0x01, 0x2A, 0x13, 
-0xA2, 0x1B, 0x7D, 0xC3, 0x2C, 0xB7, 0x8A, 0x3B, 0x0B, 0xF4, 0x74, 0xC3, 0xCD, 0xA0, 0x6F, 0x76, 
-0x7A, 0xB5, 0x49, 0x83, 0x78, 0x1D, 0x5E, 0xBD, 0x5A, 0xC1, 0xA8, 0xE6, 0xBD, 0x7F, 0x85, 0x74, 
-0xF6, 0xD9, 0xA8, 0x02, 0x54, 0xF6, 0xC6, 0x9E, 0xD9, 0xA9, 0x79, 0x66, 0xB4, 0x80, 0x38, 0x2E, 
-0x83, 0xD8, 0x9C, 0xE5, 0x6E, 0x05, 0x0E, 0x70, 0x1B, 0x95, 0x99, 0x90, 0x98, 0xEB, 0x71, 0x10, 
-0x4E, 0xC8, 0x49, 0xF8, 0xB0, 0x05, 0x6C, 0x2D, 0x6F, 0x3A, 0xEC, 0xF4, 0x9A, 0xAF, 0xBC, 0xEE, 
-0xAB, 0x23, 0xC6, 0xAF, 0xE5, 0x51, 0xDC, 0x5C, 0x0A, 0x3A, 0xAF, 0xE6, 0xC5, 0xF3, 0xBA, 0xDD, 
-0xF5, 0xBD, 0x6E, 0x69, 0xA5, 0x50, 0x41, 0x2C, 0xB3, 0x0C, 0xCC, 0x7A, 0xE9, 0x2B, 0xED, 0xD7, 
-0xBF, 0x1B, 0xE6, 0xC9, 0xED, 0x9F, 0x85, 0xA5, 0xC7, 0x42, 0x6A, 0xA3, 0x15, 0x10, 0xAF, 0x9B, 
-0x29, 0xB3, 0x87, 0x9F, 0xDC, 0xDB, 0x68, 0xE0, 0x76, 0xF8, 0x40, 0xA2, 0x00, 0x66, 0x79, 0xF2, 
-0x0D, 0x1B, 0xB1, 0x53, 0x36, 0xAB, 0x55, 0x55, 0x09, 0x5D, 0xEB, 0x9B, 0xDF, 0x4A, 0xAF, 0x20, 
-0x6A, 0x7E, 0x63, 0x58, 0x1D, 0x33, 0x13, 0x82, 0x27, 0x90, 0x6A, 0xC5, 0x00, 0x2D, 0x06, 0x16, 
-0x1B, 0xA5, 0xC0, 0xF7, 0xFE, 0x24, 0x91, 0xA8, 0x54, 0x6A, 0xB2, 0x94, 0xA6, 0xDA, 0x6A, 0x84, 
-0x15, 0x46, 0xD1, 0xA8, 0x32, 0x8A, 0xDA, 0xDF, 0x9C, 0x63, 0x46, 0x1B, 0x30, 0x9C, 0x2C, 0xF0, 
-0x6C, 0xFD, 0x66, 0x24, 0xCD, 0xD1, 0x78, 0x58, 0xED, 0x90, 0xDD, 0xDE, 0xC0, 0xF3, 0x6F, 0x8A, 
-0xB0, 0x4C, 0x51, 0x64, 0x61, 0x00, 0x00, 0x00
-};
-
-#endif
+#ifndef INDEX_HTML_H_H
+#define INDEX_HTML_H_H
+
+#include <Arduino.h>
+
+// Generated by tools/build_assets.js from index.html - do not edit
+const char index_html[] PROGMEM = {
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD5, 0x5B, 0xEF, 0x6E, 0xE3, 0x36, 
+0x12, 0xFF, 0xEE, 0xA7, 0x60, 0x55, 0x2C, 0xEC, 0xE0, 0x22, 0x45, 0x92, 0xFF, 0x24, 0x71, 0x62, 
+0x03, 0x7B, 0xE9, 0xF6, 0x76, 0x81, 0x2D, 0x5A, 0x34, 0xB9, 0x1E, 0xEE, 0x23, 0x2D, 0x8D, 0x6C, 
+0x36, 0x34, 0xA5, 0xA3, 0x28, 0x27, 0xEE, 0x76, 0x9F, 0xE2, 0xBE, 0x1D, 0xEE, 0xCB, 0x3D, 0xC0, 
+0x01, 0x05, 0xEE, 0x0D, 0xDA, 0x37, 0xB9, 0x27, 0x39, 0x0C, 0x29, 0xC9, 0x92, 0x2C, 0xFF, 0x49, 
+0x76, 0xF7, 0xDA, 0x26, 0x48, 0x2C, 0xF1, 0xCF, 0xF0, 0x37, 0x33, 0xE4, 0x70, 0x66, 0x48, 0x5F, 
+0x7F, 0xF6, 0xC5, 0xD7, 0x37, 0x77, 0x7F, 0xFD, 0xE6, 0x15, 0x59, 0xA8, 0x25, 0x9F, 0x76, 0xAE, 
+0xF1, 0x83, 0x70, 0x2A, 0xE6, 0x13, 0x0B, 0x52, 0x0B, 0x0B, 0x80, 0x86, 0xD3, 0xCE, 0xF5, 0x12, 
+0x14, 0x25, 0xC1, 0x82, 0xCA, 0x14, 0xD4, 0xC4, 0xFA, 0xF3, 0xDD, 0x97, 0xF6, 0x85, 0x55, 0x14, 
+0x0B, 0xBA, 0x84, 0x89, 0xB5, 0x62, 0xF0, 0x90, 0xC4, 0x52, 0x59, 0x24, 0x88, 0x85, 0x02, 0xA1, 
+0x26, 0xD6, 0x03, 0x0B, 0xD5, 0x62, 0x12, 0xC2, 0x8A, 0x05, 0x60, 0xEB, 0x97, 0x53, 0xC2, 0x04, 
+0x53, 0x8C, 0x72, 0x3B, 0x0D, 0x28, 0x87, 0x89, 0xE7, 0xB8, 0x48, 0x46, 0x31, 0xC5, 0x61, 0xFA, 
+0x0D, 0x15, 0xC0, 0x49, 0x08, 0xE4, 0x26, 0x16, 0x4A, 0xC6, 0x9C, 0xBC, 0x11, 0x2B, 0x90, 0x82, 
+0x86, 0x20, 0xE3, 0xEB, 0x33, 0xD3, 0xA6, 0x73, 0x9D, 0x06, 0x92, 0x25, 0x6A, 0xDA, 0xE9, 0x45, 
+0x99, 0x08, 0x14, 0x8B, 0x45, 0xEF, 0x84, 0xBC, 0xEB, 0x28, 0xB9, 0x26, 0xEF, 0x3A, 0x41, 0x2C, 
+0x52, 0x45, 0x52, 0xBA, 0x82, 0xF0, 0x6E, 0x01, 0x4B, 0x20, 0x13, 0xC2, 0xE3, 0x80, 0xF2, 0x5B, 
+0x15, 0x4B, 0x3A, 0x07, 0x67, 0x0E, 0xEA, 0x8D, 0x82, 0x65, 0xAF, 0xAB, 0xB0, 0xB6, 0x7B, 0x72, 
+0xD5, 0x61, 0x11, 0xE9, 0x55, 0xDB, 0x4F, 0x26, 0xA4, 0x1B, 0x52, 0x79, 0xDF, 0x45, 0xA2, 0x61, 
+0x1C, 0x64, 0x4B, 0x10, 0xCA, 0x29, 0x1E, 0x5E, 0x71, 0xD0, 0xEF, 0x01, 0xA7, 0x69, 0xFA, 0x96, 
+0xA5, 0xCA, 0xA1, 0x61, 0xD8, 0xD3, 0x1D, 0xEC, 0x92, 0xE4, 0xCE, 0x5E, 0x29, 0xA8, 0x97, 0x4A, 
+0x49, 0x36, 0xCB, 0x14, 0xF4, 0xBA, 0xA9, 0x5A, 0x73, 0xE8, 0x9E, 0x92, 0xEE, 0x8C, 0x06, 0xF7, 
+0x73, 0x19, 0x67, 0x22, 0xB4, 0x83, 0x98, 0xC7, 0x72, 0x4C, 0x3E, 0x77, 0xA9, 0x1B, 0x79, 0x40, 
+0x3E, 0x63, 0x4B, 0x94, 0x28, 0x15, 0xEA, 0xAA, 0xC0, 0x5A, 0x12, 0x9F, 0xC5, 0xE1, 0xBA, 0x86, 
+0x11, 0x0B, 0x8E, 0x04, 0xA6, 0x9B, 0x7E, 0x08, 0x1A, 0x52, 0x54, 0x45, 0xFA, 0xA7, 0x09, 0xF4, 
+0x3D, 0x01, 0x9E, 0x42, 0x15, 0x1C, 0x0D, 0xC3, 0x57, 0x2B, 0x10, 0x0A, 0xA1, 0x81, 0x00, 0xD9, 
+0xEB, 0x7E, 0xF1, 0xF5, 0x57, 0x37, 0x66, 0x9E, 0xBC, 0x8D, 0x69, 0x08, 0x61, 0xF7, 0x94, 0xD4, 
+0x14, 0xFA, 0x9B, 0xE4, 0x0B, 0xFF, 0xF0, 0x97, 0x04, 0x54, 0x05, 0x8B, 0x1E, 0x9C, 0xE4, 0x73, 
+0x2E, 0xE6, 0xE0, 0x80, 0x94, 0xB1, 0xEC, 0x75, 0x5F, 0xE1, 0x07, 0xA1, 0x49, 0xC2, 0xD7, 0x4C, 
+0xCC, 0x89, 0x06, 0x39, 0xEE, 0x9E, 0x12, 0x30, 0x7D, 0x4F, 0x7A, 0x27, 0x57, 0x9D, 0xEB, 0xB3, 
+0x62, 0x12, 0x5F, 0x6B, 0x7C, 0xD3, 0x8E, 0x5E, 0x76, 0xEF, 0x3A, 0x2D, 0x20, 0xA3, 0x7E, 0x34, 
+0x88, 0x46, 0x55, 0x24, 0x1D, 0x25, 0xA9, 0x48, 0x19, 0x4A, 0x6A, 0x4C, 0x9A, 0x3D, 0x88, 0xEB, 
+0x0C, 0x53, 0x02, 0x34, 0x05, 0x1C, 0x0E, 0xC9, 0x3A, 0x1B, 0x61, 0xB5, 0x8F, 0xB0, 0x2D, 0x86, 
+0xCE, 0xFB, 0x0E, 0x8A, 0xF2, 0x68, 0x40, 0x45, 0x95, 0x17, 0xF9, 0x97, 0xFD, 0xF3, 0x63, 0x01, 
+0x9E, 0x92, 0x23, 0x10, 0xEF, 0xC6, 0xD1, 0x02, 0x7B, 0xB7, 0xF6, 0x5A, 0x28, 0x3B, 0x01, 0x95, 
+0x61, 0x8D, 0xF4, 0x98, 0x70, 0x26, 0x80, 0x4A, 0x7B, 0x2E, 0x69, 0xC8, 0x40, 0xA8, 0x9E, 0xD7, 
+0x1F, 0x86, 0x30, 0x3F, 0x25, 0x9F, 0x7B, 0xE0, 0x5F, 0xF6, 0x67, 0xC4, 0x7D, 0x81, 0xCF, 0xD4, 
+0xEF, 0xF7, 0x7D, 0xE2, 0xB9, 0xEE, 0x8B, 0x93, 0xDA, 0x18, 0xB3, 0x58, 0x86, 0x20, 0x4B, 0x80, 
+0xFD, 0xFE, 0xC0, 0x1B, 0x0E, 0x9F, 0x0F, 0x10, 0x2D, 0x2F, 0xC8, 0x06, 0xC2, 0x02, 0xC9, 0xD3, 
+0xC6, 0x6D, 0xE3, 0xDE, 0xD8, 0x58, 0x9B, 0x29, 0x58, 0x36, 0xC7, 0x70, 0x23, 0xEF, 0xDC, 0xA7, 
+0xFB, 0xC6, 0x18, 0x9C, 0x0F, 0x87, 0xA3, 0xCB, 0x43, 0x63, 0x28, 0x2A, 0xEE, 0x6D, 0x4E, 0x53, 
+0x65, 0x47, 0x8C, 0x73, 0x08, 0x8F, 0x18, 0x67, 0x17, 0x95, 0x15, 0x4B, 0x33, 0xCA, 0xED, 0x07, 
+0x49, 0x93, 0x64, 0x4B, 0x28, 0x47, 0xA9, 0x2D, 0x1F, 0xEC, 0xA0, 0xDA, 0x8E, 0x63, 0x0D, 0xB7, 
+0x42, 0xF5, 0x54, 0x38, 0x39, 0x04, 0x33, 0x8B, 0x0C, 0xB4, 0x6D, 0x38, 0x2D, 0x83, 0xA5, 0xEB, 
+0x54, 0xC1, 0xD2, 0x4E, 0x15, 0x55, 0x59, 0x7A, 0xF4, 0x60, 0xA3, 0x01, 0x94, 0xBC, 0x0F, 0xCE, 
+0x2F, 0x86, 0xE7, 0x87, 0x79, 0x77, 0x87, 0x97, 0xA3, 0xC3, 0xBC, 0xD7, 0xE1, 0xA4, 0x09, 0x15, 
+0xDA, 0x0C, 0x1A, 0x12, 0xA1, 0x17, 0x51, 0x38, 0x38, 0xFB, 0x96, 0xA0, 0x24, 0x0B, 0xEC, 0x15, 
+0xE5, 0x19, 0x1C, 0xCB, 0x50, 0xBE, 0x68, 0x34, 0x43, 0xC1, 0x2C, 0x1C, 0x82, 0xD7, 0xC2, 0x90, 
+0xFD, 0x00, 0xB3, 0x7B, 0xA6, 0xEC, 0xAA, 0xC1, 0xE0, 0x2C, 0x19, 0x13, 0x05, 0x8F, 0xAA, 0xB5, 
+0x25, 0x56, 0xE8, 0xF9, 0x59, 0x48, 0x41, 0x5B, 0xAF, 0x84, 0x4A, 0x10, 0xF5, 0x0E, 0x87, 0x49, 
+0xEE, 0x30, 0x32, 0xB6, 0x76, 0x5D, 0x4E, 0xB7, 0x2B, 0x67, 0x92, 0x8A, 0x50, 0x0B, 0xF0, 0x74, 
+0xF7, 0x02, 0xE5, 0x74, 0x06, 0xFC, 0x74, 0xA7, 0x08, 0xA3, 0x38, 0x56, 0x20, 0x77, 0xD7, 0x67, 
+0x82, 0xA9, 0x8A, 0x7A, 0x72, 0xC1, 0x1D, 0x5A, 0x72, 0xF8, 0x61, 0xAB, 0x78, 0x3E, 0xE7, 0x60, 
+0xCF, 0x94, 0x78, 0xBA, 0x11, 0x3A, 0xD2, 0x40, 0x34, 0xC7, 0xC9, 0x4B, 0x58, 0x10, 0x57, 0xE7, 
+0x14, 0xF8, 0x70, 0x11, 0xB9, 0x47, 0x58, 0xB4, 0x88, 0xCD, 0x5B, 0xE0, 0xEE, 0x9C, 0x51, 0x83, 
+0x68, 0x30, 0x82, 0xA1, 0x99, 0x51, 0x83, 0x7E, 0xFF, 0x22, 0xA0, 0xC7, 0xAD, 0x47, 0x1E, 0xCF, 
+0xE3, 0x4C, 0x3D, 0x65, 0xA4, 0x30, 0xF0, 0x47, 0xFE, 0xC8, 0x8C, 0x34, 0xBB, 0xF4, 0x02, 0x2F, 
+0x38, 0x6E, 0xA4, 0x8F, 0xAC, 0x82, 0x27, 0xCE, 0x82, 0x72, 0x70, 0x67, 0xA6, 0x84, 0x1D, 0x1F, 
+0xCD, 0xAD, 0xE7, 0xCE, 0x2E, 0x2F, 0xBC, 0xDC, 0xF4, 0x18, 0x93, 0xB2, 0xCD, 0x6D, 0x8E, 0xE5, 
+0x61, 0xC1, 0x14, 0xEC, 0xB5, 0x49, 0xC6, 0x76, 0x3D, 0x11, 0x6B, 0x14, 0x1D, 0x0B, 0x16, 0xA2, 
+0xC1, 0x60, 0x30, 0x30, 0x60, 0x73, 0x35, 0x3D, 0x1F, 0x6C, 0xAE, 0xDB, 0x43, 0x60, 0x19, 0xCE, 
+0x71, 0x91, 0x64, 0xEA, 0xA3, 0xEC, 0xBC, 0xA5, 0x57, 0xE1, 0x45, 0xC3, 0xE8, 0xB0, 0xF5, 0x7E, 
+0x60, 0x2A, 0x58, 0x10, 0x27, 0xE5, 0xAC, 0xE9, 0x5E, 0x3C, 0x71, 0xF5, 0xE6, 0x94, 0x34, 0x23, 
+0xE3, 0x60, 0x01, 0xC1, 0x3D, 0x84, 0xE4, 0x0F, 0xFB, 0x29, 0x8F, 0x5C, 0x3A, 0x8C, 0xE8, 0xD3, 
+0x30, 0x8E, 0x67, 0x10, 0xC5, 0xB2, 0xDD, 0x7B, 0xDD, 0xD6, 0x48, 0x0B, 0x39, 0x26, 0x14, 0x48, 
+0x1A, 0x28, 0xB6, 0x02, 0x1B, 0x0D, 0xB2, 0x93, 0x3F, 0x2B, 0x58, 0x26, 0x48, 0xB5, 0x2E, 0xE1, 
+0x68, 0x78, 0x09, 0xEE, 0x6C, 0x87, 0xE9, 0xDF, 0x67, 0x4D, 0x7C, 0xDF, 0x75, 0xF3, 0x35, 0xDE, 
+0x0F, 0xBD, 0xC8, 0xBD, 0x38, 0x6E, 0x8D, 0xEF, 0x42, 0xB7, 0xC8, 0x96, 0x2C, 0x64, 0x6A, 0xBD, 
+0x8D, 0xB0, 0x3F, 0xBB, 0xF0, 0x1B, 0x2E, 0xF8, 0x91, 0xEE, 0x50, 0x9F, 0x0E, 0xA3, 0xD2, 0x8B, 
+0x85, 0x01, 0xFD, 0x30, 0x84, 0x69, 0xCC, 0xF8, 0x36, 0xBA, 0x7C, 0xF5, 0x3F, 0x19, 0x5D, 0xCD, 
+0x61, 0x19, 0xF6, 0x43, 0x3F, 0x3A, 0x0E, 0x9D, 0xF1, 0x93, 0xED, 0x59, 0xA6, 0x54, 0x2C, 0xD2, 
+0x0D, 0x1E, 0x0E, 0x91, 0xDA, 0x3F, 0xA3, 0x0F, 0x05, 0x39, 0x4F, 0x09, 0xB5, 0xAE, 0xCF, 0xF2, 
+0x50, 0xEE, 0x9A, 0x33, 0x71, 0x4F, 0x24, 0xF0, 0x89, 0xA5, 0x4B, 0xD2, 0x05, 0x80, 0xB2, 0xC8, 
+0x42, 0x42, 0x34, 0xB1, 0x4C, 0x23, 0xC7, 0x1F, 0x79, 0xB3, 0xBE, 0x17, 0x86, 0x4E, 0x90, 0xEA, 
+0x24, 0x4B, 0x11, 0x0E, 0x16, 0x11, 0x30, 0x11, 0x74, 0xC5, 0xE6, 0x54, 0xC1, 0x5F, 0x98, 0x5A, 
+0xDC, 0x95, 0x18, 0x7A, 0x99, 0xE4, 0x18, 0x72, 0x3E, 0x3D, 0x11, 0x90, 0xD0, 0x39, 0xD8, 0xF0, 
+0xC8, 0x14, 0x13, 0x73, 0x8C, 0x64, 0x53, 0x50, 0x77, 0x6C, 0x09, 0x71, 0xA6, 0xEA, 0x69, 0x94, 
+0x07, 0x26, 0xC2, 0xF8, 0xC1, 0xC1, 0xA4, 0x09, 0x96, 0x39, 0x88, 0x9A, 0x4C, 0x48, 0x26, 0xF9, 
+0x55, 0xE7, 0xFD, 0x29, 0xF1, 0x5D, 0xB7, 0x1A, 0xDE, 0xEF, 0x6D, 0xDD, 0x79, 0xDF, 0x48, 0xD1, 
+0x98, 0xE4, 0x0C, 0x4B, 0x5F, 0x66, 0x6A, 0x01, 0x42, 0xB1, 0x80, 0x2A, 0x08, 0x77, 0x66, 0x68, 
+0x1A, 0xED, 0x8A, 0xFC, 0xC7, 0x67, 0xCD, 0xFE, 0x3F, 0xFE, 0xB8, 0x45, 0xF2, 0x33, 0x4C, 0xE2, 
+0x28, 0x99, 0x41, 0x77, 0x0F, 0x4B, 0xDD, 0xB3, 0xEE, 0x55, 0x47, 0x82, 0xCA, 0xA4, 0xD0, 0xB3, 
+0x8A, 0xA5, 0x2A, 0x96, 0x6B, 0x47, 0x42, 0xC2, 0x69, 0x00, 0xB7, 0x8A, 0x2A, 0xE8, 0x89, 0x8C, 
+0xF3, 0x53, 0x62, 0xFE, 0xB7, 0x91, 0xD1, 0x29, 0x01, 0x0C, 0xE8, 0xDB, 0x18, 0xFD, 0x95, 0xB3, 
+0x50, 0x1F, 0x9A, 0x2C, 0x7A, 0x5F, 0x66, 0x2B, 0x72, 0xCE, 0xB7, 0x53, 0x38, 0x49, 0x9C, 0x60, 
+0x0C, 0x00, 0xD5, 0xD4, 0x0D, 0x60, 0x93, 0xDF, 0xA8, 0xB6, 0xCB, 0x79, 0x5B, 0x28, 0x3B, 0xC9, 
+0xD2, 0xC5, 0xF1, 0x9A, 0xD6, 0xE9, 0x9F, 0x4A, 0xEA, 0xE6, 0x2C, 0x4F, 0x8D, 0xA2, 0x2C, 0xA7, 
+0x9D, 0xEB, 0x90, 0xAD, 0x88, 0x96, 0xE8, 0xC4, 0xCA, 0xDD, 0xDA, 0x72, 0xDD, 0xDA, 0xF1, 0x0A, 
+0x24, 0xA7, 0x6B, 0x8B, 0xB0, 0x70, 0x4F, 0xED, 0xF4, 0xFA, 0x2C, 0x64, 0xAB, 0x3A, 0x29, 0x9A, 
+0x24, 0x36, 0x46, 0x02, 0x94, 0x09, 0x90, 0x45, 0x3E, 0x16, 0x64, 0xBD, 0x91, 0x8E, 0x23, 0x74, 
+0xA5, 0xB7, 0x95, 0x44, 0xBD, 0x3E, 0x5B, 0x78, 0x68, 0x61, 0x12, 0x2A, 0xA6, 0xB7, 0xA8, 0xBA, 
+0x25, 0xC5, 0xDA, 0x97, 0x99, 0x8A, 0x97, 0x54, 0xB1, 0x1F, 0x68, 0xC0, 0x7E, 0xF9, 0x8F, 0xC0, 
+0xA2, 0x5A, 0xB6, 0x55, 0xB7, 0xEF, 0xB4, 0x00, 0xCA, 0xAD, 0x2D, 0xD5, 0xEA, 0xD6, 0xC6, 0xAB, 
+0x52, 0x59, 0x8B, 0x0C, 0x0D, 0xB7, 0x41, 0x2C, 0x04, 0xE8, 0xC6, 0x45, 0x71, 0xA3, 0x8B, 0x2E, 
+0xB4, 0xC3, 0x58, 0x99, 0xF6, 0x95, 0xF7, 0x52, 0x1E, 0x3A, 0xC4, 0xAC, 0x54, 0x62, 0xE0, 0x65, 
+0x4D, 0x6F, 0x62, 0x24, 0x4C, 0xC3, 0x23, 0xD0, 0xE6, 0x7B, 0x03, 0x0E, 0x6D, 0x1E, 0x9B, 0xF5, 
+0x4A, 0x90, 0x4D, 0xF8, 0x50, 0x02, 0x2F, 0xDF, 0xA9, 0x64, 0xD4, 0x04, 0x62, 0x13, 0xEB, 0x46, 
+0x97, 0x67, 0xD2, 0x08, 0xCE, 0x22, 0xB1, 0x08, 0x38, 0x0B, 0xEE, 0x27, 0x56, 0x9C, 0x80, 0x30, 
+0x95, 0xBD, 0x13, 0x8B, 0xE8, 0x98, 0x6F, 0xAB, 0x35, 0x32, 0xB3, 0x9A, 0x37, 0x46, 0xC7, 0x68, 
+0xC7, 0x22, 0x98, 0x3F, 0xFF, 0x63, 0xFC, 0x38, 0xB1, 0x5C, 0xE2, 0x12, 0x7F, 0x40, 0xFC, 0x81, 
+0x45, 0x30, 0x2C, 0x9D, 0x58, 0x22, 0x16, 0x60, 0x91, 0x54, 0xC9, 0xF8, 0x1E, 0x26, 0x56, 0x90, 
+0x49, 0x0C, 0x4D, 0x6F, 0x70, 0x0B, 0x2A, 0x4A, 0x4D, 0x72, 0x7D, 0x62, 0xF9, 0x65, 0x01, 0xEE, 
+0xB2, 0x01, 0x4D, 0x26, 0x96, 0xDE, 0xB0, 0x6A, 0xC5, 0xDF, 0xC7, 0x4C, 0x14, 0xE5, 0xD3, 0xCE, 
+0x75, 0x42, 0xD5, 0x82, 0x84, 0x13, 0xEB, 0x2B, 0xCF, 0x27, 0xDE, 0x90, 0xF6, 0x49, 0x9F, 0xB8, 
+0xC4, 0x23, 0x2E, 0x71, 0xED, 0x11, 0x31, 0x6F, 0xE6, 0x77, 0xF4, 0x03, 0x6A, 0x04, 0x9B, 0xD7, 
+0x7A, 0x5D, 0x3A, 0x03, 0xEC, 0xE7, 0x39, 0xA3, 0x21, 0xD1, 0xFF, 0x4C, 0x6B, 0xA7, 0xDF, 0x27, 
+0x9E, 0x73, 0xE1, 0x73, 0xC7, 0x1D, 0x39, 0xEE, 0x88, 0xFA, 0xC4, 0xD7, 0xE5, 0x48, 0xD9, 0x77, 
+0x2E, 0xFA, 0xA4, 0x2C, 0xB0, 0xF5, 0xAB, 0xCB, 0x6D, 0xC7, 0x1D, 0xE1, 0x5F, 0x93, 0x94, 0x8D, 
+0x64, 0x6C, 0x43, 0xAF, 0x51, 0x41, 0x3C, 0x67, 0xE8, 0x7D, 0xE7, 0x7B, 0xB4, 0x42, 0x8C, 0xF8, 
+0x55, 0xD2, 0xB6, 0xBF, 0xB2, 0x1D, 0xF7, 0xF2, 0x65, 0x13, 0xDE, 0x25, 0x41, 0xE0, 0xAD, 0x43, 
+0x39, 0xFD, 0xBE, 0xC6, 0x52, 0x43, 0x9D, 0x83, 0x24, 0x15, 0x36, 0x74, 0x11, 0xDF, 0x01, 0x1A, 
+0xF9, 0xD7, 0xD4, 0xB6, 0x41, 0x3B, 0x43, 0xCF, 0xF6, 0x5E, 0xF7, 0x69, 0x0D, 0x65, 0x85, 0xB0, 
+0x6F, 0xFB, 0x8B, 0x36, 0xC8, 0x03, 0x67, 0x44, 0x2E, 0xB7, 0x10, 0x17, 0xE3, 0x6C, 0xC4, 0xD7, 
+0x84, 0x58, 0x25, 0x6D, 0x24, 0x9D, 0x33, 0xD7, 0x1C, 0x20, 0x67, 0xFE, 0xF5, 0xE5, 0x76, 0x8D, 
+0x46, 0xFD, 0x5D, 0x05, 0x33, 0x69, 0x60, 0x26, 0xFE, 0xCA, 0x71, 0x5B, 0x3A, 0x6A, 0x0D, 0x91, 
+0xB6, 0x91, 0x10, 0x39, 0xDF, 0xC6, 0xBC, 0x2D, 0x67, 0x5D, 0x54, 0x6A, 0xA4, 0x85, 0x7F, 0x4D, 
+0xEE, 0xBB, 0x96, 0xC1, 0xF5, 0xD0, 0xAF, 0xAB, 0xD3, 0x83, 0x34, 0xA6, 0x07, 0xF1, 0x17, 0x76, 
+0x0B, 0x6E, 0xDB, 0x74, 0xAD, 0x4E, 0xF8, 0xB3, 0x74, 0x35, 0xC7, 0x0F, 0x63, 0x3F, 0xF6, 0x19, 
+0x92, 0x4D, 0x76, 0xC0, 0x18, 0x92, 0xEA, 0x7B, 0xCD, 0x90, 0x80, 0x94, 0x54, 0x92, 0x14, 0xD2, 
+0x86, 0x21, 0x31, 0x1D, 0xAA, 0x46, 0xA4, 0xDE, 0xF2, 0x93, 0x1B, 0x91, 0xEA, 0xFA, 0xBE, 0x24, 
+0xBE, 0xF7, 0x7A, 0x58, 0x9F, 0xAC, 0xDF, 0x0D, 0xEB, 0x13, 0x61, 0x31, 0xA8, 0x5A, 0x86, 0x98, 
+0xAF, 0xD1, 0xCC, 0x90, 0x24, 0x66, 0x42, 0xA5, 0x13, 0xCB, 0x1B, 0x11, 0xEF, 0x9C, 0xF8, 0x1E, 
+0x41, 0x03, 0x33, 0x22, 0xE7, 0xBA, 0x6D, 0xDE, 0xC8, 0xB8, 0xCB, 0x40, 0x1E, 0xBD, 0x89, 0xE5, 
+0x7B, 0x16, 0x59, 0x7B, 0x13, 0xCB, 0xF3, 0x2D, 0xF2, 0xE8, 0x4F, 0xAC, 0x4B, 0x8B, 0xAC, 0x7D, 
+0xFD, 0x3A, 0xBD, 0x3E, 0xCB, 0x1B, 0x1F, 0xD0, 0x42, 0x33, 0x9F, 0x54, 0xDB, 0x70, 0x2B, 0xA5, 
+0x55, 0x35, 0xDC, 0xE9, 0x72, 0x73, 0x50, 0xD3, 0x10, 0xED, 0x26, 0x19, 0xF5, 0x11, 0x25, 0x1B, 
+0x30, 0x19, 0x70, 0x20, 0xC1, 0xA3, 0xE1, 0x34, 0x58, 0x9B, 0x4F, 0x39, 0xB1, 0x86, 0xC8, 0xA8, 
+0xA9, 0xAE, 0xCA, 0x05, 0x6B, 0xB5, 0x5C, 0x8C, 0x58, 0xF4, 0xAB, 0x3F, 0xB1, 0xFA, 0x15, 0xB1, 
+0x6C, 0xB5, 0xF5, 0x1B, 0x8D, 0xFD, 0xD6, 0xD6, 0x03, 0xC7, 0xCF, 0xDB, 0x9B, 0x27, 0xEC, 0x31, 
+0x74, 0x46, 0x03, 0xD3, 0x47, 0x3F, 0xB5, 0x8D, 0x71, 0xE1, 0xF4, 0x47, 0x39, 0x24, 0xF3, 0xA8, 
+0x47, 0xBA, 0x74, 0xCE, 0x2F, 0x72, 0x8D, 0xE9, 0xC7, 0xB6, 0x9E, 0x75, 0x05, 0xF7, 0x5B, 0x14, 
+0xBC, 0x73, 0x36, 0xF8, 0x7B, 0x5B, 0x6F, 0x38, 0xC9, 0x71, 0xD4, 0x59, 0x31, 0x38, 0xF7, 0xF3, 
+0x62, 0x5A, 0x37, 0x58, 0xD1, 0x74, 0xF7, 0x4C, 0xBF, 0xDC, 0xE3, 0x28, 0x3E, 0xDA, 0x9C, 0x33, 
+0x4E, 0xD7, 0xB8, 0xFC, 0xE7, 0x92, 0x85, 0x0D, 0xD7, 0x27, 0x88, 0x79, 0xB6, 0x14, 0x04, 0xE3, 
+0xD4, 0x46, 0x8D, 0xC9, 0xDD, 0xA6, 0xB6, 0x8C, 0x1F, 0x9A, 0x7D, 0xF0, 0xD0, 0xAA, 0x19, 0x8F, 
+0x93, 0xFC, 0xD9, 0x74, 0x23, 0x95, 0xEC, 0x46, 0xC5, 0xAA, 0xA4, 0x8B, 0xF8, 0xE1, 0x06, 0x4F, 
+0x2D, 0x7A, 0x5D, 0xAC, 0xE9, 0x9E, 0xE4, 0x6E, 0x8E, 0x4E, 0x50, 0x63, 0xD3, 0xED, 0x81, 0x6C, 
+0xC3, 0x8F, 0x55, 0xB8, 0x60, 0xD5, 0x2A, 0x6D, 0x9A, 0xAC, 0xE9, 0x1D, 0x2C, 0x13, 0x90, 0x54, 
+0x65, 0x92, 0x96, 0x6E, 0x58, 0x85, 0x0A, 0xAE, 0x1D, 0x7B, 0x16, 0x3F, 0x92, 0xD9, 0xDC, 0x5E, 
+0x03, 0xE7, 0xC8, 0xCF, 0xDD, 0xCF, 0x3F, 0x35, 0xE4, 0x56, 0xF1, 0xF2, 0x6A, 0x02, 0x30, 0xE7, 
+0x03, 0xF9, 0x22, 0xD6, 0x10, 0x6D, 0x3B, 0x1F, 0xA5, 0xAD, 0x35, 0xA6, 0xBA, 0xAD, 0xE9, 0xCF, 
+0x3F, 0xDD, 0xEC, 0x71, 0x08, 0x6B, 0x59, 0x73, 0x6B, 0xFA, 0x92, 0x49, 0x20, 0x2F, 0x97, 0x33, 
+0xCC, 0x44, 0xC0, 0x36, 0xAA, 0xBD, 0x52, 0x6F, 0x97, 0x6D, 0x91, 0xB5, 0xA9, 0xC9, 0xB7, 0x28, 
+0x7C, 0x9E, 0x8C, 0x5F, 0x67, 0x4B, 0x08, 0x69, 0x78, 0x48, 0xBE, 0x33, 0x94, 0xD5, 0xF4, 0xF5, 
+0x8B, 0x67, 0x08, 0x77, 0x83, 0xEF, 0x08, 0x01, 0xBF, 0x38, 0x5E, 0xBC, 0x39, 0x72, 0xF2, 0x2D, 
+0x70, 0xAA, 0xD8, 0x8A, 0x7E, 0x14, 0x09, 0x63, 0xD6, 0xA9, 0x26, 0x5D, 0x2C, 0x78, 0x9E, 0x64, 
+0x6F, 0x33, 0xE0, 0xF1, 0x21, 0xB9, 0xCE, 0x25, 0x80, 0xB0, 0xA6, 0xB7, 0xCF, 0x11, 0xAC, 0x81, 
+0xF6, 0x69, 0x84, 0x1A, 0x02, 0xB9, 0x63, 0xE8, 0x19, 0x34, 0xAD, 0x50, 0xAB, 0x70, 0x9F, 0x27, 
+0xA0, 0x57, 0x29, 0x06, 0x58, 0x24, 0x04, 0x4E, 0xEE, 0xA8, 0xF8, 0x5B, 0x06, 0x7B, 0x60, 0xEA, 
+0x73, 0xDA, 0x5A, 0xAC, 0xDA, 0xAC, 0xAC, 0x1F, 0xE2, 0x16, 0x2D, 0x50, 0x4E, 0x0F, 0x54, 0xE9, 
+0x8C, 0xDD, 0x0A, 0xB8, 0x55, 0x74, 0x31, 0x65, 0xB8, 0xC7, 0xE2, 0x3E, 0xBA, 0x46, 0x47, 0x68, 
+0x01, 0x6C, 0xBE, 0x50, 0x63, 0xE2, 0xBE, 0xB8, 0xDA, 0x44, 0x87, 0x3B, 0x90, 0x30, 0x11, 0xC5, 
+0x6D, 0x20, 0xF4, 0x20, 0x76, 0xC8, 0xD2, 0x44, 0xC7, 0xDC, 0x2D, 0x28, 0x51, 0x7D, 0x55, 0x90, 
+0x07, 0x0C, 0x13, 0x15, 0xF7, 0xCF, 0x53, 0x71, 0x52, 0xC7, 0xB5, 0x39, 0x27, 0xDF, 0x10, 0xAE, 
+0x95, 0x4E, 0x7F, 0xF9, 0x07, 0x57, 0x6C, 0x19, 0x13, 0xCE, 0x41, 0xD0, 0x30, 0x1E, 0x13, 0x1C, 
+0x35, 0xD9, 0xA2, 0xA4, 0x6F, 0xA2, 0xD8, 0xCB, 0x74, 0x5E, 0xA1, 0xF3, 0x40, 0xA5, 0x60, 0x62, 
+0xAE, 0x7D, 0xAF, 0x3D, 0xDA, 0xD3, 0xA7, 0xDA, 0xA9, 0x89, 0xD7, 0xAD, 0x9D, 0x0D, 0x2A, 0xB2, 
+0x09, 0xA8, 0x58, 0xD1, 0xB4, 0x1C, 0xE7, 0x36, 0xA1, 0xF2, 0x1E, 0x37, 0x4B, 0xED, 0xCA, 0xE8, 
+0xBA, 0xED, 0x5D, 0xF2, 0xC3, 0x66, 0x6B, 0x31, 0x17, 0x28, 0x67, 0x73, 0xA1, 0xAF, 0x2F, 0xA4, 
+0x63, 0x12, 0xA0, 0xFD, 0x96, 0x57, 0x7B, 0xA6, 0xB2, 0x31, 0x17, 0x1A, 0x7E, 0x5E, 0x90, 0xD3, 
+0xA9, 0xA7, 0xFD, 0xAF, 0xAC, 0xE9, 0x9F, 0xE4, 0x2F, 0xFF, 0x8A, 0x58, 0x10, 0x8F, 0x49, 0xDB, 
+0xE6, 0xD6, 0x82, 0x77, 0x8F, 0x4C, 0xF2, 0x4C, 0x93, 0xB6, 0x5C, 0x87, 0x45, 0xB2, 0xED, 0x1B, 
+0x48, 0x9C, 0xEF, 0xBB, 0x9D, 0x03, 0xA2, 0x1E, 0x62, 0x4C, 0x46, 0x5B, 0x1F, 0x6B, 0xBD, 0xBF, 
+0xCD, 0x96, 0x4C, 0xC4, 0x29, 0x3B, 0x62, 0xBB, 0x89, 0x25, 0x15, 0x73, 0xEC, 0xF2, 0x1C, 0xBB, 
+0xC8, 0x0D, 0x5F, 0x1F, 0xD7, 0x30, 0xBE, 0xC1, 0xEB, 0x64, 0x1A, 0x3B, 0x79, 0x9B, 0x2D, 0x7F, 
+0xF9, 0xB7, 0x60, 0xC1, 0xA7, 0xB4, 0x8D, 0xDF, 0x32, 0x98, 0xB7, 0x6E, 0x1E, 0x79, 0x96, 0x8A, 
+0x89, 0x10, 0x53, 0x94, 0x18, 0x06, 0x54, 0x72, 0x57, 0x4C, 0x4A, 0xCC, 0xEC, 0xEB, 0xF5, 0xB5, 
+0x4F, 0xFD, 0xE6, 0xF0, 0x1F, 0xCF, 0x1B, 0xB6, 0x3C, 0xB3, 0xCA, 0xCD, 0x9D, 0x2D, 0x7C, 0xD5, 
+0x4B, 0x03, 0xD6, 0x14, 0xB3, 0x7C, 0x25, 0x42, 0x5D, 0x56, 0x62, 0xD4, 0x27, 0x6C, 0xD8, 0xDD, 
+0x9C, 0x43, 0xAA, 0x75, 0x82, 0x6B, 0x01, 0x0F, 0xF1, 0x66, 0xF1, 0x63, 0xB1, 0x5A, 0xEE, 0x2B, 
+0x70, 0x6D, 0x9A, 0xA9, 0x58, 0xEF, 0xC8, 0x0B, 0x54, 0xFC, 0xC4, 0x32, 0x01, 0xD5, 0x9B, 0xB2, 
+0x01, 0x0E, 0xD6, 0x3B, 0x69, 0x22, 0xCA, 0x0F, 0x03, 0xF3, 0x74, 0xD3, 0x46, 0x99, 0x1A, 0xCD, 
+0x5E, 0xDE, 0x8F, 0xE0, 0xEF, 0x2B, 0x2A, 0x32, 0xCA, 0x6B, 0x3A, 0xC8, 0x57, 0x75, 0x6E, 0xDF, 
+0xC7, 0x24, 0xE2, 0xF0, 0x78, 0x45, 0xDA, 0x8C, 0x05, 0x99, 0xD3, 0x64, 0x4C, 0x2E, 0x92, 0xC7, 
+0xAB, 0xA6, 0x18, 0x44, 0xB6, 0x9C, 0x41, 0xAE, 0xB6, 0x8A, 0x00, 0xC2, 0x4C, 0x1A, 0xC5, 0x95, 
+0x26, 0xB1, 0x3C, 0xC7, 0xB5, 0x88, 0x9E, 0xDC, 0x13, 0xCB, 0x73, 0x2D, 0xB2, 0xC4, 0xFC, 0x9A, 
+0x67, 0x91, 0x25, 0x7D, 0x9C, 0x58, 0x23, 0xB7, 0xB4, 0x34, 0x3A, 0x0A, 0x1C, 0x93, 0xA1, 0x9B, 
+0x3C, 0x5E, 0x91, 0x28, 0x16, 0xCA, 0x4E, 0xD9, 0x0F, 0x30, 0x26, 0x9E, 0x84, 0x65, 0x5E, 0xF0, 
+0x90, 0x6F, 0x70, 0x23, 0xD7, 0xDD, 0x18, 0xB3, 0xBC, 0x7B, 0xA5, 0x87, 0xEB, 0x5C, 0xB6, 0xF7, 
+0x29, 0x2E, 0x30, 0xAE, 0xA8, 0xEC, 0xD9, 0xE6, 0x6A, 0x4B, 0x0A, 0x41, 0x2C, 0x42, 0x2A, 0xD7, 
+0x27, 0x57, 0xFA, 0xC6, 0x8A, 0xC9, 0x3C, 0x47, 0xB1, 0x5C, 0x8E, 0x49, 0x86, 0x26, 0x2B, 0xC0, 
+0x13, 0x2C, 0x6B, 0xBA, 0x64, 0xA2, 0x14, 0x64, 0x1E, 0x55, 0x23, 0xFF, 0x78, 0x9A, 0x5E, 0x99, 
+0xB3, 0x25, 0xEB, 0x95, 0x68, 0xBA, 0x74, 0xD2, 0x9A, 0x33, 0xC2, 0xA8, 0x07, 0xE7, 0xC4, 0xD7, 
+0x5F, 0x7E, 0xB9, 0x3B, 0x6A, 0x6A, 0xB1, 0x1E, 0x1F, 0x65, 0x81, 0x36, 0x3C, 0x96, 0x63, 0x57, 
+0xA8, 0xD9, 0xD0, 0x7F, 0x07, 0x6B, 0x53, 0xEF, 0xC8, 0xED, 0xAB, 0xF2, 0x8E, 0x8A, 0xFB, 0x7C, 
+0x3D, 0x92, 0xFC, 0x64, 0xFE, 0x57, 0x5C, 0x97, 0x8D, 0xE9, 0xA4, 0x05, 0x7C, 0xC4, 0x44, 0x42, 
+0x26, 0x9E, 0x34, 0x85, 0x3E, 0xCA, 0xAC, 0xB9, 0x85, 0x79, 0x26, 0x77, 0x6D, 0x80, 0x7B, 0x27, 
+0x4E, 0x0A, 0x41, 0x26, 0x31, 0x8A, 0xDA, 0x30, 0x42, 0x83, 0x7B, 0x11, 0x3F, 0x70, 0x08, 0xE7, 
+0xF0, 0x92, 0x53, 0xB9, 0x44, 0x7D, 0x14, 0x7E, 0x47, 0x26, 0x53, 0x5C, 0xAA, 0x3A, 0x4D, 0xA6, 
+0x7D, 0x97, 0xDF, 0xC1, 0x94, 0x2B, 0x58, 0xDC, 0x31, 0xED, 0x6E, 0xF3, 0xEA, 0x4F, 0xB1, 0x15, 
+0x90, 0x72, 0xEC, 0x34, 0x58, 0x40, 0x98, 0x71, 0xB0, 0x83, 0x78, 0x99, 0xD0, 0xA0, 0x38, 0x38, 
+0x6A, 0x56, 0x37, 0x0F, 0x9A, 0x8A, 0x5E, 0x9A, 0xC3, 0x74, 0x6F, 0xED, 0x46, 0xD0, 0x06, 0xDB, 
+0x1B, 0xC1, 0x02, 0x16, 0x6F, 0x90, 0x56, 0x85, 0x84, 0x9B, 0x40, 0xEE, 0x68, 0xE3, 0x76, 0x90, 
+0x2A, 0xAA, 0xBF, 0x03, 0xD1, 0xDC, 0x21, 0x36, 0x60, 0xF3, 0x9D, 0xC2, 0xF7, 0xC7, 0xAE, 0xFE, 
+0xF2, 0xC3, 0x36, 0xDB, 0xFB, 0xC1, 0x7C, 0x89, 0x86, 0xFA, 0x08, 0x24, 0x80, 0xE7, 0x3E, 0x87, 
+0x71, 0xB8, 0xA3, 0x3A, 0x8E, 0x7A, 0x46, 0x15, 0xD7, 0x2B, 0x9E, 0x4C, 0x6F, 0xBA, 0x6D, 0x42, 
+0x72, 0xBA, 0x82, 0xDB, 0x1C, 0x29, 0x2A, 0xFB, 0xBF, 0xFF, 0xFC, 0xFB, 0xCE, 0x05, 0xFA, 0x29, 
+0xCC, 0xC8, 0x66, 0xB9, 0x1D, 0x36, 0x25, 0xC5, 0xC4, 0xFC, 0x7F, 0x1A, 0x92, 0xB7, 0x59, 0x00, 
+0xE9, 0x93, 0x8D, 0x08, 0x47, 0x0F, 0x9C, 0xCA, 0xF5, 0xEF, 0xC2, 0x1C, 0x14, 0x60, 0x77, 0x98, 
+0x83, 0xB7, 0x79, 0xF5, 0x6F, 0x76, 0x27, 0x2A, 0x85, 0x7D, 0xC4, 0x14, 0x2A, 0x98, 0x79, 0x8E, 
+0x53, 0xD3, 0xFA, 0xD1, 0xFE, 0x45, 0x26, 0x73, 0x6F, 0x42, 0xC7, 0x94, 0xB7, 0xBA, 0x01, 0x99, 
+0x90, 0xF2, 0xDA, 0x46, 0x20, 0x81, 0x2A, 0xC8, 0xEF, 0x7F, 0xF4, 0xBA, 0x86, 0x02, 0x5E, 0x96, 
+0xA8, 0xB4, 0x77, 0x52, 0x19, 0xE8, 0x1B, 0x0F, 0xBA, 0xCC, 0x71, 0x69, 0xE0, 0x7B, 0x03, 0x18, 
+0x39, 0xDF, 0xA7, 0xDD, 0x7A, 0xBB, 0x10, 0x22, 0x90, 0x64, 0x42, 0xF0, 0xEE, 0x44, 0xF3, 0x4B, 
+0x34, 0x18, 0xCB, 0x8A, 0xF0, 0x66, 0xC1, 0x78, 0xD8, 0xAB, 0xF4, 0x29, 0x2F, 0xBC, 0x54, 0xBF, 
+0xC1, 0x62, 0x50, 0xA6, 0x32, 0xC0, 0xEB, 0x4D, 0x86, 0xF4, 0x2C, 0x18, 0x41, 0x34, 0x18, 0xFA, 
+0xCE, 0xF7, 0xA9, 0x45, 0xF4, 0x38, 0xD3, 0x4E, 0xCB, 0xB7, 0x5E, 0xF2, 0x0B, 0xD0, 0xEF, 0x3A, 
+0x75, 0x6F, 0xBD, 0x83, 0xFF, 0xED, 0x90, 0x49, 0x93, 0x87, 0x18, 0x13, 0x13, 0x0C, 0xE3, 0x15, 
+0x8C, 0xBC, 0xC7, 0xC2, 0x23, 0xEF, 0x3A, 0x15, 0x7F, 0xD8, 0x47, 0x6F, 0xB8, 0x53, 0xF3, 0x86, 
+0x2F, 0x5C, 0x77, 0xFB, 0x8B, 0x29, 0x4B, 0x2A, 0xE7, 0x4C, 0x8C, 0x89, 0x7B, 0xD5, 0xE1, 0xA0, 
+0x30, 0xBD, 0x94, 0x26, 0x34, 0x60, 0x62, 0x3E, 0x26, 0xB6, 0xEB, 0xB8, 0x3E, 0x52, 0xC1, 0xEC, 
+0x85, 0x5D, 0x24, 0x9A, 0x3C, 0xC7, 0x6F, 0xBD, 0x73, 0x56, 0x81, 0xB1, 0xE7, 0x7B, 0x31, 0x25, 
+0xDE, 0xFC, 0x8E, 0x7C, 0xCD, 0x83, 0xBF, 0x18, 0x6A, 0xD0, 0xE5, 0xC5, 0xC8, 0xD9, 0xB9, 0x7F, 
+0xE1, 0x36, 0x98, 0x40, 0x97, 0xBE, 0xB3, 0xDB, 0x69, 0xDF, 0x62, 0xC2, 0x75, 0xDC, 0x21, 0x12, 
+0x35, 0x7C, 0xDA, 0x2A, 0x4E, 0xC6, 0x64, 0x90, 0x3C, 0xEE, 0x61, 0xA1, 0x71, 0x7B, 0xBF, 0xF5, 
+0x62, 0xB0, 0x53, 0xBF, 0xF3, 0xB1, 0xAD, 0xAF, 0xB6, 0xE8, 0xAA, 0xA3, 0xA3, 0x2B, 0xCF, 0x37, 
+0xA3, 0x6F, 0x5F, 0xD2, 0x3B, 0x9A, 0x04, 0x06, 0x68, 0x9D, 0x84, 0x86, 0x21, 0x13, 0x73, 0x7D, 
+0xA7, 0xAF, 0xA0, 0x5A, 0xB9, 0xE6, 0x37, 0x26, 0x5E, 0xF2, 0x48, 0xD2, 0x98, 0xB3, 0x90, 0x7C, 
+0x0E, 0x43, 0x38, 0x87, 0x99, 0x1E, 0xD5, 0x20, 0xDE, 0xBA, 0x3E, 0xDD, 0xB8, 0x48, 0x59, 0xBF, 
+0xDE, 0x5B, 0x10, 0x1E, 0x13, 0x3C, 0xD8, 0x2B, 0x87, 0x1E, 0x93, 0x51, 0xF2, 0x58, 0x1F, 0x19, 
+0x6F, 0x30, 0x66, 0xA9, 0xAE, 0xB8, 0xEA, 0x34, 0xDD, 0xB9, 0x56, 0x65, 0xD7, 0x94, 0x3B, 0xD4, 
+0xCA, 0xDD, 0x7F, 0xC1, 0xD0, 0x4F, 0x1B, 0x7C, 0x8C, 0x17, 0x78, 0x5B, 0xA8, 0x9D, 0x1B, 0x7F, 
+0x38, 0xEA, 0x1B, 0xC6, 0x3F, 0xE0, 0x32, 0xE2, 0xFF, 0x00, 0x8A, 0x97, 0x97, 0x1C, 0x12, 0x3A, 
+0x00, 0x00, 0x00
+};
+
+const char index_html_br[] PROGMEM = {
+0x1B, 0x11, 0x3A, 0x00, 0x2C, 0x0A, 0x32, 0x37, 0xE5, 0xB3, 0x4A, 0xE9, 0x05, 0xC4, 0xDB, 0xD5, 
+0x2C, 0x8B, 0xFC, 0xAC, 0x17, 0x8A, 0xA2, 0xE8, 0x52, 0x55, 0x77, 0x2D, 0x13, 0x6C, 0x27, 0x21, 
+0x79, 0xD1, 0xAB, 0x15, 0xF0, 0xA8, 0xF4, 0x3A, 0x2C, 0x10, 0xF0, 0x84, 0xFE, 0x04, 0xE2, 0x19, 
+0x14, 0xBB, 0xEF, 0x8B, 0x35, 0x6D, 0x81, 0x8D, 0xB1, 0x73, 0x46, 0x2F, 0x3A, 0xF1, 0x03, 0x21, 
+0x7F, 0xAF, 0x8A, 0x4D, 0x2B, 0xB9, 0xD2, 0xA5, 0x07, 0x1F, 0x81, 0xA5, 0xEB, 0x65, 0xCD, 0x2E, 
+0xDB, 0x28, 0xBD, 0xEE, 0xDB, 0x35, 0x88, 0x82, 0xC8, 0xC9, 0x10, 0xF1, 0xFB, 0xF6, 0xEB, 0x33, 
+0x00, 0xAC, 0x62, 0xD7, 0x05, 0x46, 0xE8, 0x90, 0x8B, 0x8C, 0x11, 0x04, 0x76, 0xA7, 0xEA, 0x56, 
+0xF5, 0xD9, 0x9E, 0x7D, 0xCB, 0x34, 0x01, 0x82, 0x57, 0x5D, 0xDD, 0xEF, 0xCD, 0x9F, 0x09, 0xCE, 
+0x0F, 0x11, 0x2A, 0x62, 0x15, 0x27, 0x73, 0x22, 0x63, 0xC5, 0xFC, 0x6F, 0xD5, 0x6E, 0x43, 0xCD, 
+0x23, 0x73, 0x3D, 0x53, 0x88, 0x2D, 0x04, 0x4E, 0xDC, 0x66, 0xBC, 0xD7, 0x26, 0x30, 0x1F, 0x8C, 
+0x1E, 0x74, 0xBB, 0x1D, 0x11, 0xB4, 0x89, 0xB0, 0xD4, 0x59, 0xE2, 0x6A, 0x70, 0x20, 0x92, 0x99, 
+0x31, 0x87, 0xE2, 0x53, 0x84, 0x6C, 0x6C, 0x90, 0x1B, 0xBC, 0xCE, 0x84, 0x9B, 0xCA, 0x7C, 0xD5, 
+0xA2, 0xEF, 0xFA, 0xE4, 0x2F, 0x31, 0x78, 0x65, 0x30, 0x30, 0xCE, 0x34, 0x96, 0x24, 0x78, 0x9C, 
+0x79, 0xC6, 0x69, 0x9D, 0x68, 0x9D, 0x7B, 0xB4, 0x98, 0x6A, 0xD3, 0x6B, 0x7A, 0x43, 0x64, 0x12, 
+0xA6, 0x2D, 0xA3, 0x2D, 0x4C, 0xAB, 0x71, 0xAE, 0x57, 0x84, 0x29, 0xE5, 0x0C, 0x14, 0x93, 0x8C, 
+0x99, 0x2D, 0x4D, 0x23, 0x9E, 0x06, 0x65, 0x2C, 0x2C, 0x0E, 0xD1, 0x45, 0xFF, 0x90, 0x6F, 0x03, 
+0xC9, 0x01, 0x49, 0xEB, 0x66, 0xAF, 0xDF, 0x8D, 0x29, 0x0D, 0x2D, 0x00, 0x6B, 0xF3, 0x4C, 0x26, 
+0x66, 0x61, 0xE2, 0xB0, 0xA1, 0xA4, 0xED, 0x85, 0xC8, 0xBB, 0x70, 0xE7, 0x21, 0x11, 0x66, 0x0A, 
+0x6F, 0xA2, 0x8F, 0x47, 0xE1, 0x0C, 0x92, 0xE5, 0xC0, 0x41, 0x7B, 0x7B, 0x10, 0x55, 0x94, 0x25, 
+0x2F, 0x4C, 0x02, 0x1B, 0x22, 0xA2, 0xBA, 0x9A, 0xEE, 0x25, 0x3F, 0xBF, 0xF8, 0xFA, 0xE3, 0x5F, 
+0xF4, 0xC6, 0xD4, 0x5C, 0x26, 0x62, 0xCF, 0x4E, 0x7E, 0xA3, 0x77, 0x3A, 0x68, 0x1B, 0x03, 0xF1, 
+0x6E, 0x2D, 0x3B, 0x5C, 0xDF, 0x1E, 0xBD, 0x82, 0xEE, 0xC6, 0x89, 0xBE, 0x4F, 0xDE, 0x0A, 0x40, 
+0x2F, 0x95, 0x7F, 0x25, 0xCC, 0x27, 0xD3, 0x9F, 0x7C, 0xB5, 0x6C, 0x4E, 0x7A, 0xD3, 0xDD, 0x0D, 
+0x36, 0xA7, 0x33, 0xE6, 0xA3, 0x0C, 0x1F, 0x28, 0x41, 0x8F, 0x95, 0x4C, 0x5D, 0x22, 0x26, 0xD9, 
+0xCE, 0x7A, 0x5F, 0xC9, 0x49, 0xB2, 0x7A, 0x60, 0x84, 0x30, 0xB8, 0x52, 0x86, 0x0A, 0x32, 0x4D, 
+0xE8, 0x6C, 0x06, 0x28, 0x55, 0xFE, 0x88, 0xC8, 0x40, 0xD3, 0x09, 0xC8, 0x07, 0x3B, 0x04, 0xB5, 
+0xC2, 0x52, 0x0E, 0x7A, 0x5E, 0x08, 0xBA, 0xB6, 0xC7, 0x51, 0x96, 0x6D, 0xF7, 0xCB, 0xA5, 0xC5, 
+0x32, 0xFD, 0x23, 0xB0, 0x41, 0x19, 0x42, 0x9F, 0xCA, 0xA9, 0xDA, 0x1A, 0x76, 0xE8, 0xA1, 0x04, 
+0x9A, 0xCE, 0x34, 0x79, 0xFC, 0xF7, 0x25, 0x1D, 0xAA, 0xE8, 0xCD, 0x9D, 0x5A, 0xB9, 0x83, 0x0C, 
+0x37, 0x00, 0x79, 0xAE, 0x51, 0x2D, 0x62, 0x06, 0x92, 0xBA, 0xDD, 0x2B, 0x34, 0x85, 0x6E, 0x97, 
+0x61, 0x00, 0xF9, 0x6C, 0x84, 0x62, 0x2D, 0xE9, 0xCE, 0x59, 0xCC, 0x43, 0x26, 0xF4, 0xB3, 0xA9, 
+0x4C, 0x66, 0xDE, 0xA8, 0x72, 0x13, 0xA1, 0x34, 0x9B, 0x0F, 0xE4, 0x05, 0xDF, 0xAD, 0x72, 0x9B, 
+0x50, 0x7C, 0x86, 0x31, 0x7D, 0x8D, 0x07, 0x1D, 0x1C, 0x84, 0x68, 0xD9, 0x7B, 0x5C, 0x1B, 0x6A, 
+0x14, 0x24, 0x80, 0x01, 0x01, 0xF0, 0x20, 0x8A, 0x1C, 0x44, 0x81, 0x5D, 0x41, 0x3B, 0xF2, 0x18, 
+0xD9, 0xE8, 0x25, 0xFC, 0x7F, 0x32, 0xCB, 0x54, 0x6D, 0x3A, 0x9C, 0xAD, 0x79, 0x73, 0x1B, 0xA2, 
+0xB4, 0x2C, 0xBC, 0x8B, 0xDE, 0x67, 0xCB, 0x3A, 0x1D, 0x1D, 0x97, 0xB7, 0x1A, 0x75, 0x98, 0x02, 
+0x69, 0x68, 0x93, 0x94, 0x7B, 0x4A, 0x13, 0x0E, 0xC4, 0x99, 0x5A, 0xF6, 0x66, 0x19, 0x22, 0xF5, 
+0xCE, 0x01, 0xB8, 0x44, 0xF8, 0xF9, 0x5E, 0x44, 0xFD, 0x70, 0x75, 0x93, 0x22, 0xC7, 0x51, 0xC1, 
+0x44, 0x9D, 0x36, 0x62, 0x0C, 0xF9, 0xD6, 0x16, 0x67, 0x34, 0x3D, 0x58, 0x1F, 0x73, 0xCE, 0x96, 
+0xAB, 0x8C, 0x8C, 0xC4, 0xBB, 0x38, 0x4C, 0xA4, 0xBC, 0xDA, 0xE7, 0xF2, 0xEE, 0xA8, 0xA1, 0x67, 
+0xEA, 0xA1, 0x46, 0x6F, 0x08, 0x22, 0x41, 0x5E, 0x91, 0xE0, 0x8F, 0xF3, 0xA1, 0x56, 0xFA, 0x12, 
+0xC3, 0x3E, 0xF9, 0x8C, 0x08, 0x29, 0xA9, 0x59, 0xB7, 0x44, 0x96, 0x6A, 0xC6, 0x75, 0xC0, 0xCF, 
+0xA6, 0x98, 0x45, 0x1D, 0x8C, 0x2A, 0xBC, 0x80, 0x5C, 0x1E, 0xAB, 0x3A, 0xCA, 0x28, 0x1E, 0xD6, 
+0x51, 0x54, 0xEB, 0xD2, 0x4B, 0x5C, 0x3B, 0xA7, 0x8D, 0x1C, 0x5B, 0xCE, 0xA9, 0x63, 0xD5, 0x33, 
+0x87, 0x9F, 0x03, 0xE6, 0xAD, 0x2C, 0xB2, 0x4C, 0x50, 0x30, 0x34, 0x1A, 0x13, 0x02, 0x00, 0xF3, 
+0x46, 0xB7, 0x87, 0x06, 0xD8, 0xC7, 0x1D, 0xC2, 0x73, 0xAB, 0x82, 0x6C, 0x05, 0xC2, 0x83, 0x87, 
+0x49, 0x91, 0xB9, 0x5E, 0x41, 0xFE, 0xD5, 0x28, 0xBC, 0x0F, 0x49, 0xDB, 0xEE, 0x57, 0x47, 0xBB, 
+0x78, 0x81, 0x40, 0x50, 0xB5, 0x25, 0x10, 0xBE, 0x65, 0xA2, 0x4F, 0x1D, 0x02, 0x85, 0xA6, 0xF5, 
+0xD2, 0x57, 0x95, 0xE7, 0x8C, 0xE9, 0xB0, 0x51, 0x00, 0x00, 0x88, 0xC2, 0x58, 0x39, 0x1F, 0x16, 
+0x08, 0xC7, 0xA1, 0x62, 0xDB, 0xD8, 0x33, 0x95, 0xEC, 0xE7, 0xB9, 0x1B, 0xCF, 0x6D, 0xFF, 0x08, 
+0x3A, 0x77, 0x1B, 0x1D, 0xCE, 0x4A, 0x12, 0xBF, 0x3C, 0x4B, 0x11, 0x2A, 0x45, 0xB7, 0x7A, 0xFB, 
+0x39, 0xC2, 0x44, 0xFD, 0xF2, 0x37, 0x91, 0x71, 0x87, 0xDE, 0x61, 0xF9, 0x74, 0xC6, 0xB2, 0x05, 
+0xCF, 0x4D, 0xE4, 0x28, 0x11, 0xB4, 0xE8, 0xED, 0x3B, 0x74, 0x95, 0xC1, 0xB5, 0x15, 0x08, 0x3F, 
+0xC7, 0x21, 0x77, 0x64, 0x28, 0xDD, 0x40, 0x79, 0x0E, 0xD6, 0xB9, 0x62, 0x78, 0x87, 0x84, 0x76, 
+0x1B, 0xE7, 0x42, 0xE9, 0x88, 0xD2, 0x89, 0x1A, 0xE5, 0x08, 0xE4, 0x00, 0x0D, 0x0B, 0x5B, 0x69, 
+0x79, 0x0B, 0x4C, 0x57, 0x0C, 0x21, 0x14, 0x69, 0xA1, 0xE1, 0x04, 0x98, 0x98, 0xD4, 0x95, 0x17, 
+0xAB, 0xCB, 0x1B, 0x3A, 0x8D, 0x35, 0xB7, 0x02, 0xE1, 0x26, 0x87, 0xD4, 0x22, 0xF4, 0x49, 0x96, 
+0xBE, 0xE5, 0x08, 0x2E, 0xB3, 0xCA, 0xBA, 0x2E, 0x0F, 0xA0, 0x4E, 0xD7, 0xD0, 0xDD, 0x80, 0x58, 
+0x6A, 0x5B, 0xC4, 0xD1, 0x5E, 0xB5, 0xF5, 0x37, 0xF9, 0x91, 0xCE, 0xC1, 0x55, 0xE2, 0x8E, 0x18, 
+0x40, 0xF4, 0xA0, 0x08, 0x14, 0xC9, 0x35, 0xE4, 0xED, 0xD1, 0xA7, 0x7E, 0x92, 0x45, 0x2E, 0x7D, 
+0xEA, 0xBB, 0x1B, 0x71, 0x11, 0x5C, 0xDD, 0xC3, 0x10, 0x98, 0x9B, 0xF8, 0x45, 0x26, 0xBA, 0xAF, 
+0xD6, 0x7E, 0x21, 0xD0, 0xFC, 0xDF, 0x28, 0xBE, 0xCA, 0xE7, 0x07, 0xF4, 0x89, 0xB4, 0x4A, 0x68, 
+0xA8, 0x34, 0x29, 0xBD, 0x4A, 0x03, 0x19, 0x7A, 0x66, 0xC7, 0xF8, 0xFB, 0x7B, 0x6B, 0xE3, 0x19, 
+0x21, 0x87, 0xBE, 0x09, 0x63, 0xAE, 0xB7, 0x0E, 0x79, 0x3A, 0x2E, 0x40, 0x17, 0x24, 0x80, 0x95, 
+0x6C, 0x29, 0xD4, 0x71, 0x5E, 0x69, 0x96, 0xDC, 0xCB, 0x81, 0x4F, 0xAE, 0x55, 0x55, 0x45, 0x9D, 
+0x36, 0x9E, 0x9D, 0xF1, 0x94, 0xA8, 0x96, 0x09, 0x46, 0x08, 0x43, 0x78, 0x10, 0xBE, 0xF7, 0xC8, 
+0x38, 0x6B, 0x8F, 0xB9, 0x27, 0x2E, 0x1A, 0xF2, 0x0D, 0x13, 0x1F, 0x67, 0xA3, 0x10, 0xD7, 0xB8, 
+0x1B, 0x2E, 0x44, 0xBC, 0x6E, 0xE8, 0x34, 0x64, 0x40, 0x45, 0x4D, 0x90, 0x53, 0x2D, 0xB9, 0x5A, 
+0xAA, 0xB6, 0x21, 0xED, 0x56, 0x40, 0xFC, 0x05, 0x35, 0x38, 0x4F, 0xC7, 0xA8, 0x1D, 0xAD, 0xF6, 
+0x59, 0xBD, 0xEF, 0x81, 0xBE, 0x2C, 0x1D, 0x7C, 0x09, 0x8D, 0xDC, 0x96, 0x60, 0x0D, 0xC3, 0xA7, 
+0x84, 0x54, 0x10, 0xD2, 0xED, 0xE2, 0x6E, 0x65, 0x54, 0x76, 0xF7, 0x2A, 0x84, 0xEA, 0x5B, 0xD0, 
+0xAD, 0xD2, 0x74, 0xBA, 0x97, 0xB6, 0x14, 0x57, 0x36, 0xE3, 0x52, 0x9C, 0x25, 0xC7, 0x95, 0x2F, 
+0xB4, 0x6F, 0x35, 0xD8, 0xD6, 0x21, 0x7C, 0x5C, 0x23, 0x3F, 0x43, 0x29, 0x69, 0x0C, 0xB7, 0x3E, 
+0x18, 0x4E, 0x0F, 0x23, 0x07, 0x9C, 0x88, 0x07, 0x8C, 0x06, 0x74, 0x16, 0x2C, 0x79, 0xC3, 0x96, 
+0x3F, 0x48, 0x65, 0x20, 0x46, 0xF9, 0x00, 0x81, 0x3F, 0x93, 0x7A, 0x1E, 0x91, 0xBC, 0x68, 0x42, 
+0x28, 0xF0, 0x41, 0xAE, 0xB6, 0xB2, 0x77, 0xB1, 0xA4, 0x80, 0x65, 0x39, 0x20, 0xAF, 0x4E, 0x4C, 
+0x27, 0xDA, 0x3A, 0x34, 0xAC, 0x2C, 0x2B, 0xEA, 0x7B, 0xCA, 0x04, 0x79, 0x68, 0xDC, 0xA5, 0x85, 
+0x80, 0x96, 0x03, 0x42, 0xFC, 0xFA, 0xDF, 0xF6, 0x9A, 0xAF, 0x1B, 0x26, 0x26, 0x94, 0xB7, 0xF8, 
+0x60, 0xD5, 0xE7, 0xFE, 0xC2, 0x21, 0x7B, 0x3C, 0x17, 0x67, 0x29, 0xF0, 0x11, 0x1B, 0x82, 0x3F, 
+0x0F, 0xFE, 0x55, 0x95, 0x05, 0xD0, 0xA9, 0x14, 0x24, 0xA9, 0xA4, 0xBD, 0x54, 0xAB, 0xBE, 0x29, 
+0xB4, 0xAC, 0x12, 0xF5, 0x28, 0xC8, 0x9E, 0x60, 0xA2, 0xAE, 0xC5, 0xBF, 0x6D, 0x9A, 0x7F, 0x53, 
+0x90, 0x58, 0x57, 0x52, 0x62, 0x12, 0x62, 0xE2, 0xE4, 0x24, 0x83, 0xD7, 0x25, 0x7E, 0x1B, 0x2A, 
+0x64, 0xC4, 0x9A, 0x5C, 0xD3, 0x72, 0x39, 0x5E, 0x2A, 0xD9, 0x8D, 0x3E, 0xC0, 0xC4, 0xB7, 0xE6, 
+0xB9, 0x92, 0xE4, 0x8A, 0xFD, 0xCC, 0x7E, 0xBB, 0x5E, 0x07, 0x81, 0xD8, 0xF6, 0x2B, 0x91, 0xAB, 
+0x92, 0x64, 0x2F, 0x1D, 0x56, 0xF3, 0x7E, 0xD2, 0x4A, 0xEF, 0x49, 0xEB, 0x62, 0xB2, 0x2A, 0x26, 
+0x3B, 0xD3, 0x8A, 0x9F, 0x4C, 0x92, 0x4D, 0x36, 0x21, 0xFD, 0xC1, 0x96, 0x87, 0xE3, 0xEA, 0x84, 
+0xCB, 0xD3, 0xD8, 0xF6, 0x09, 0xC4, 0x25, 0x8D, 0x80, 0xF7, 0x9D, 0xEB, 0xEE, 0x18, 0x1E, 0xDA, 
+0x25, 0x01, 0x1D, 0x24, 0xAF, 0xEC, 0x96, 0x46, 0xEF, 0x03, 0x0E, 0x1C, 0xEC, 0x96, 0xD2, 0x82, 
+0x0E, 0xCF, 0x4A, 0xF2, 0x53, 0xF7, 0xC7, 0x4D, 0xBB, 0xD2, 0xC8, 0x6D, 0xF1, 0xDA, 0x25, 0x3B, 
+0xB5, 0x9D, 0xBA, 0xA5, 0x28, 0xB4, 0xD8, 0x3E, 0x81, 0xB4, 0x27, 0x75, 0x77, 0x2E, 0xD8, 0x82, 
+0x80, 0x69, 0x7E, 0x36, 0xD5, 0x5E, 0xDA, 0xD6, 0xE1, 0x3E, 0x21, 0x3A, 0x84, 0x70, 0xE9, 0x19, 
+0xDE, 0x8D, 0x46, 0x92, 0x6B, 0x31, 0xE1, 0xDA, 0xD9, 0x3A, 0x62, 0x37, 0xD2, 0x50, 0x71, 0x71, 
+0xB0, 0x1B, 0x8D, 0xD8, 0x04, 0x00, 0x87, 0x29, 0x3F, 0xA3, 0xC8, 0x09, 0xD1, 0x61, 0x84, 0xED, 
+0xB4, 0xCD, 0x30, 0x6E, 0x22, 0xFD, 0x96, 0x71, 0xBC, 0xB4, 0x1F, 0x91, 0x87, 0x64, 0x67, 0x26, 
+0x81, 0x42, 0x20, 0x02, 0x72, 0x8E, 0xC0, 0xD4, 0x11, 0x27, 0x8D, 0x18, 0xD5, 0x50, 0xC8, 0x48, 
+0xAC, 0xEE, 0xC9, 0x17, 0x26, 0x8D, 0xBF, 0x87, 0x2D, 0x41, 0x7E, 0x5A, 0x84, 0xAD, 0x36, 0xE5, 
+0xC2, 0x7D, 0x4A, 0xC9, 0x1D, 0xD6, 0xB0, 0xBB, 0x61, 0x3A, 0xC0, 0x7F, 0x4C, 0xA6, 0x9F, 0x14, 
+0x27, 0x99, 0x08, 0x42, 0x02, 0x12, 0xA7, 0x49, 0xBF, 0x68, 0xEC, 0x9A, 0xE1, 0xCD, 0xCD, 0xAF, 
+0xA7, 0xEF, 0x20, 0x0F, 0xDC, 0x7C, 0xDE, 0x47, 0xB0, 0xCF, 0xF5, 0x6C, 0x5E, 0x93, 0xDA, 0x6D, 
+0x46, 0x86, 0x60, 0xA0, 0x28, 0x24, 0x2C, 0x4D, 0x49, 0x02, 0xC1, 0x53, 0xB1, 0x41, 0x81, 0xB1, 
+0xD7, 0xAC, 0xD1, 0xA2, 0x57, 0x0C, 0x4F, 0xD4, 0x45, 0x96, 0xD0, 0xBF, 0x56, 0xE8, 0x6B, 0xEF, 
+0xCD, 0xFD, 0xBC, 0xC7, 0xCD, 0x96, 0xD3, 0xC6, 0x3C, 0x0B, 0x2D, 0x06, 0x37, 0x07, 0x0A, 0xB0, 
+0x5B, 0x26, 0x10, 0x95, 0x0A, 0x5F, 0xFF, 0x30, 0xEC, 0x47, 0x63, 0xBF, 0xB6, 0x64, 0x1C, 0xF1, 
+0x17, 0xEE, 0x7D, 0xCB, 0x5E, 0x8E, 0xD8, 0xB8, 0xEE, 0xF4, 0x6B, 0x56, 0x3F, 0xCB, 0x9F, 0x78, 
+0xF6, 0x5B, 0x9E, 0xEA, 0x19, 0x1B, 0xF7, 0x99, 0x0A, 0xE4, 0xE3, 0x69, 0x51, 0x8C, 0x18, 0x01, 
+0x13, 0xBE, 0x6F, 0x04, 0x16, 0x7B, 0x05, 0xAC, 0x25, 0x57, 0x98, 0xB0, 0x5B, 0xD8, 0x9D, 0x1B, 
+0x05, 0x7D, 0xD6, 0x78, 0xB7, 0x82, 0x86, 0x3E, 0xF9, 0x08, 0xCB, 0x45, 0xB5, 0xAA, 0xE0, 0xD2, 
+0xA3, 0xB6, 0x6A, 0x4A, 0x80, 0x7E, 0xFB, 0x5A, 0x11, 0x02, 0x5F, 0x09, 0xEE, 0xB8, 0x4A, 0xB6, 
+0xC9, 0xF7, 0x14, 0x30, 0x3A, 0x28, 0x28, 0x1C, 0xF5, 0x9C, 0x85, 0xBA, 0xFD, 0x79, 0x1D, 0xCE, 
+0xC6, 0x42, 0x75, 0x49, 0x51, 0x25, 0x10, 0x58, 0x0A, 0xED, 0x8E, 0x63, 0x81, 0x33, 0x02, 0xD5, 
+0x30, 0xAB, 0x2C, 0x9C, 0x2D, 0x34, 0x13, 0xCE, 0xF5, 0x31, 0xA8, 0x94, 0x83, 0xAA, 0x8A, 0x59, 
+0x9B, 0x28, 0xFD, 0xF0, 0x3C, 0x99, 0xE7, 0x89, 0xBD, 0x85, 0x9F, 0x3A, 0xF2, 0xB8, 0x7F, 0x1F, 
+0xE1, 0x1E, 0x4F, 0x39, 0x63, 0xFA, 0x08, 0x00, 0x2B, 0xC0, 0x5C, 0x0E, 0xE0, 0x92, 0x6B, 0x82, 
+0x96, 0xEF, 0xFA, 0x44, 0x1F, 0x79, 0x53, 0x29, 0xB4, 0x94, 0xF3, 0x1B, 0x9C, 0xEF, 0x5E, 0xD1, 
+0x29, 0x7E, 0xE9, 0x37, 0x03, 0x59, 0x29, 0xE6, 0x33, 0xF0, 0xAB, 0x94, 0x1B, 0x8B, 0x63, 0x55, 
+0x68, 0x01, 0xCF, 0x1F, 0xD6, 0xC7, 0x7C, 0x80, 0x46, 0x99, 0x0D, 0x2D, 0x64, 0xF6, 0xA1, 0xFE, 
+0xF8, 0xF4, 0xA4, 0x30, 0x96, 0x23, 0xF9, 0x1E, 0x7A, 0x7A, 0x10, 0xE8, 0x2B, 0xF1, 0x23, 0xEF, 
+0x9F, 0x7E, 0xBA, 0x54, 0x4F, 0xA2, 0x3C, 0x59, 0x0C, 0x93, 0x64, 0x0B, 0xD8, 0xE5, 0x79, 0xAC, 
+0x8A, 0x0E, 0xBC, 0x9C, 0xDD, 0x7B, 0xFC, 0xCF, 0x1E, 0xE0, 0x4D, 0x20, 0x62, 0x97, 0x19, 0x5C, 
+0x07, 0x35, 0xB2, 0x2F, 0x40, 0x70, 0x0B, 0x48, 0xC2, 0x1C, 0x54, 0xFF, 0x51, 0x83, 0x4E, 0xFC, 
+0x55, 0x87, 0xFF, 0x32, 0x82, 0xCA, 0x7D, 0xB5, 0xA6, 0xBD, 0x6A, 0x35, 0x38, 0x1D, 0xB9, 0xA2, 
+0x8B, 0x71, 0xC5, 0x6C, 0x4A, 0x3D, 0x58, 0x46, 0x21, 0x8C, 0xA9, 0x3C, 0x95, 0xB3, 0x49, 0x8E, 
+0xAA, 0xF5, 0xFC, 0xB8, 0x6E, 0x21, 0x66, 0x42, 0x03, 0xF6, 0xAA, 0xB4, 0x1A, 0x1C, 0xAA, 0x80, 
+0x3D, 0xCA, 0xD3, 0x84, 0x20, 0x0C, 0x80, 0x96, 0x04, 0x33, 0xCC, 0xB5, 0x20, 0x16, 0xF4, 0x87, 
+0x64, 0x5F, 0x39, 0x2C, 0x4F, 0xAB, 0xFC, 0x89, 0xDD, 0xC9, 0x2E, 0x51, 0xC7, 0xC2, 0x39, 0xF4, 
+0xCA, 0xB0, 0xE4, 0xF2, 0xF0, 0xDE, 0x36, 0xE6, 0x46, 0x79, 0x26, 0x74, 0xD1, 0xDE, 0xE4, 0xD7, 
+0xEA, 0xC0, 0x50, 0x0E, 0xDE, 0xD0, 0xB3, 0x1D, 0x78, 0x03, 0x73, 0x34, 0x19, 0xFC, 0x6C, 0xD2, 
+0xCA, 0x5F, 0x9E, 0x82, 0x5B, 0xFB, 0xFC, 0xE9, 0x17, 0x1D, 0xDD, 0x7E, 0x37, 0x84, 0x7A, 0x32, 
+0x72, 0xB6, 0x1A, 0x63, 0x35, 0x3E, 0x30, 0x47, 0x62, 0x0F, 0x7E, 0x2F, 0xB3, 0x4C, 0x6B, 0x9E, 
+0x1B, 0x9D, 0x19, 0x4C, 0x78, 0x01, 0x92, 0x6A, 0x57, 0x82, 0xF4, 0xFF, 0xEF, 0xBF, 0xD9, 0xFB, 
+0x0F, 0xE1, 0x7F, 0x5B, 0xD2, 0x2C, 0x15, 0x70, 0x3E, 0xCC, 0xD9, 0x78, 0x11, 0x6A, 0x13, 0xE7, 
+0x5E, 0x25, 0x68, 0x71, 0xEB, 0x07, 0x60, 0x01, 0xCD, 0xDC, 0x6F, 0x2D, 0x44, 0xBA, 0x62, 0xD0, 
+0xEC, 0xCE, 0xD3, 0xFC, 0x97, 0xFA, 0x35, 0x1F, 0x90, 0xE7, 0x48, 0x45, 0x0E, 0x7E, 0x3E, 0xD1, 
+0x3D, 0xFE, 0xF5, 0xC8, 0xEC, 0x87, 0x13, 0x75, 0x8A, 0x9F, 0x58, 0xCA, 0x18, 0xFE, 0xAD, 0xAD, 
+0xF8, 0x9A, 0x0F, 0x4E, 0xF3, 0xA4, 0xF3, 0xC7, 0xE7, 0xFF, 0x4D, 0x61, 0x0B, 0x10, 0xA1, 0x54, 
+0xE9, 0x8C, 0xD9, 0xF7, 0xE7, 0x40, 0xDC, 0xBA, 0x94, 0x42, 0x20, 0xBB, 0xC0, 0xFB, 0x5C, 0xC8, 
+0x84, 0x01, 0x40, 0xF8, 0xDB, 0x5D, 0x75, 0x8E, 0xFE, 0x06, 0x46, 0xB3, 0x11, 0xFE, 0x6E, 0xA2, 
+0xF4, 0x05, 0x28, 0x59, 0x5E, 0xEF, 0xF8, 0x69, 0x48, 0x19, 0xE3, 0x1B, 0x95, 0x13, 0x59, 0x53, 
+0xCC, 0xE0, 0x11, 0xE4, 0x08, 0x4B, 0xBA, 0xAD, 0x33, 0xB9, 0xA2, 0x51, 0xB5, 0xF0, 0x93, 0x26, 
+0x72, 0x70, 0x6C, 0x59, 0x41, 0x25, 0x1D, 0x82, 0x42, 0x72, 0xAA, 0x05, 0x28, 0x43, 0x24, 0xFE, 
+0x6F, 0xC7, 0x8F, 0x58, 0xF6, 0xA7, 0x1E, 0x5D, 0x86, 0xDB, 0xF7, 0x39, 0x1C, 0x5E, 0xD7, 0x32, 
+0x8C, 0x4B, 0x6C, 0xA9, 0x5E, 0x4E, 0x56, 0x92, 0x44, 0x05, 0x38, 0x65, 0x71, 0xA8, 0x23, 0x61, 
+0xAD, 0xC9, 0xE1, 0x8F, 0x50, 0x4A, 0xD5, 0xFA, 0x72, 0x03, 0x73, 0xED, 0xD5, 0x85, 0x1F, 0x38, 
+0x20, 0xBF, 0xE9, 0xEE, 0xF6, 0x51, 0xD7, 0x63, 0x9D, 0xC7, 0x61, 0xF0, 0x60, 0x2A, 0xC3, 0xCD, 
+0xFB, 0xAC, 0xD3, 0xE8, 0xEA, 0xE1, 0x5A, 0x1B, 0x9D, 0x39, 0x43, 0x4B, 0xB3, 0x31, 0x3F, 0x01, 
+0xCE, 0xCD, 0x5C, 0x45, 0xD7, 0xCB, 0x2E, 0x55, 0x28, 0x81, 0xBD, 0x25, 0x30, 0x03, 0xEF, 0x53, 
+0xD5, 0x24, 0x19, 0x7E, 0x35, 0x38, 0xCF, 0x4E, 0xF2, 0x1D, 0x5A, 0x45, 0xAC, 0xF7, 0xBE, 0x23, 
+0x8F, 0x4C, 0xB4, 0x71, 0x18, 0x07, 0xD4, 0xA3, 0x2E, 0x78, 0xB0, 0xDE, 0x0F, 0x2D, 0xEA, 0x50, 
+0x51, 0x73, 0x62, 0x05, 0x82, 0x88, 0xEE, 0x4F, 0xF0, 0xC7, 0xFB, 0xEF, 0x2D, 0x27, 0xFB, 0x71, 
+0x52, 0x12, 0x29, 0x6A, 0x2D, 0xCD, 0x5E, 0x51, 0xA8, 0xCF, 0x72, 0xE9, 0x93, 0x81, 0xCD, 0x49, 
+0x99, 0x34, 0xAD, 0xA8, 0xA4, 0x49, 0xE5, 0xFA, 0x9F, 0x71, 0x77, 0x3F, 0x4A, 0x31, 0xEC, 0x85, 
+0x91, 0x09, 0x1E, 0x69, 0x2E, 0x1A, 0xB5, 0x1F, 0x73, 0xC2, 0x5C, 0xB3, 0xCD, 0x9E, 0x95, 0xA9, 
+0xBE, 0xEE, 0x99, 0xF4, 0x8C, 0x5E, 0x73, 0x5E, 0xB9, 0x1E, 0x3A, 0x4D, 0xD2, 0xA9, 0xE5, 0x4F, 
+0xE9, 0xD4, 0x4B, 0xB3, 0x5F, 0xB4, 0x53, 0x6F, 0xE6, 0x44, 0x3D, 0x9D, 0x56, 0x74, 0xE2, 0x8A, 
+0x83, 0x85, 0xC2, 0x7D, 0x1D, 0xCC, 0x51, 0xC1, 0x08, 0x28, 0x80, 0x98, 0xD6, 0x92, 0xC2, 0x55, 
+0x30, 0xC9, 0xBE, 0xBC, 0xEB, 0x51, 0x47, 0x0D, 0xD9, 0x80, 0x0F, 0x8B, 0xE1, 0x17, 0x68, 0x2D, 
+0xA2, 0x50, 0x10, 0x30, 0x14, 0x28, 0x12, 0x78, 0xC4, 0x85, 0x57, 0x4A, 0x28, 0xC0, 0xA1, 0xB4, 
+0xD8, 0x04, 0xBC, 0xE6, 0xB3, 0x78, 0xBD, 0x31, 0x80, 0x9E, 0xFC, 0x7B, 0x3A, 0x3C, 0x3D, 0x69, 
+0xF4, 0xE6, 0x70, 0x62, 0x76, 0x4B, 0x55, 0x45, 0x9A, 0xA5, 0xDE, 0x69, 0x35, 0x5A, 0x8F, 0xDF, 
+0xA4, 0xA4, 0xF3, 0xEA, 0x52, 0x80, 0x3F, 0xD6, 0xFF, 0x28, 0x91, 0x4E, 0x70, 0x56, 0xA2, 0x81, 
+0x5E, 0x9C, 0x9D, 0x68, 0xE4, 0x9C, 0x31, 0xB7, 0xB7, 0xF6, 0x6B, 0x5E, 0x30, 0x66, 0x24, 0x47, 
+0x74, 0xB9, 0x23, 0xAF, 0xC2, 0xAC, 0x97, 0x25, 0x08, 0xC0, 0x59, 0xA2, 0xFA, 0xAA, 0x65, 0x76, 
+0x2A, 0x8D, 0xC4, 0x0F, 0xE5, 0xD1, 0x48, 0x3D, 0x54, 0x5C, 0x2A, 0x95, 0x7F, 0x14, 0x66, 0x02, 
+0x9F, 0x81, 0x84, 0xDB, 0x95, 0x18, 0x8A, 0x9E, 0x33, 0x7A, 0xD9, 0x1B, 0xF6, 0x3B, 0x98, 0x19, 
+0x59, 0xD3, 0x77, 0xBD, 0xB1, 0xFC, 0xAD, 0x47, 0xDC, 0x97, 0x99, 0x94, 0xF0, 0x71, 0x8D, 0x56, 
+0xEF, 0xE5, 0x2B, 0xB6, 0x18, 0x16, 0xC4, 0x95, 0x60, 0x0F, 0xB1, 0xC3, 0xC4, 0xEA, 0xE6, 0xE8, 
+0x91, 0x1A, 0xC5, 0x92, 0x18, 0x95, 0x06, 0x89, 0x9F, 0x18, 0xCD, 0x7A, 0x15, 0x63, 0x61, 0xC8, 
+0xBB, 0xF1, 0x5C, 0xB8, 0x35, 0xDD, 0x6E, 0x30, 0xF2, 0x05, 0x4C, 0xD0, 0xDD, 0x7B, 0xA2, 0xC6, 
+0x1E, 0xFB, 0x34, 0x00, 0xA3, 0xA2, 0xB9, 0x41, 0xCC, 0xAC, 0x3A, 0x62, 0x6A, 0xF1, 0x61, 0x7A, 
+0xAE, 0xD7, 0x89, 0x23, 0x0E, 0xC7, 0x6F, 0x97, 0xEA, 0x0C, 0x4E, 0x09, 0xA3, 0xF8, 0xE6, 0xFE, 
+0x89, 0x71, 0x74, 0x15, 0x8C, 0x58, 0xBE, 0xA6, 0x94, 0x38, 0x33, 0x6C, 0x32, 0xE3, 0x62, 0x1F, 
+0x57, 0x32, 0xF8, 0xCE, 0x0C, 0x28, 0xB9, 0x63, 0x63, 0x02, 0xCC, 0x1C, 0x49, 0xED, 0xBD, 0xCF, 
+0xB9, 0xDA, 0x39, 0x30, 0x47, 0xBE, 0xD6, 0x3C, 0xA1, 0xB2, 0x47, 0x76, 0xF3, 0xBC, 0x8A, 0xBB, 
+0x23, 0xBA, 0xBB, 0xDD, 0xAC, 0x3E, 0xFE, 0x97, 0x06, 0x43, 0xFA, 0xBB, 0x00, 0x5D, 0x11, 0x8B, 
+0xF8, 0x90, 0x11, 0xDF, 0x87, 0x13, 0x66, 0x6E, 0x0B, 0x6B, 0xF7, 0x96, 0x09, 0x20, 0x30, 0x8C, 
+0x7A, 0x4D, 0x5A, 0x13, 0xEB, 0xCE, 0x8E, 0x64, 0x84, 0xCD, 0x86, 0xD5, 0x6F, 0x50, 0x4E, 0x67, 
+0x78, 0xAD, 0x58, 0xC6, 0x14, 0xB3, 0xCB, 0x80, 0x3A, 0xCD, 0x42, 0x9D, 0x62, 0xA6, 0x4C, 0xB0, 
+0xF8, 0xAA, 0xE5, 0x51, 0xCE, 0x33, 0x19, 0x9C, 0x7F, 0x0D, 0xC9, 0x8F, 0xAF, 0x77, 0xC4, 0xC5, 
+0xB8, 0x24, 0x47, 0xC5, 0xAE, 0x7C, 0xB2, 0x4A, 0xE7, 0x07, 0xB8, 0x0D, 0xE0, 0xDD, 0xAC, 0x84, 
+0xC9, 0x70, 0x1C, 0xCE, 0xFC, 0x82, 0x81, 0xC1, 0x19, 0x3E, 0xFA, 0x58, 0xC2, 0x5C, 0x63, 0x66, 
+0x48, 0x04, 0x00
+};
+
+const size_t index_html_len = 3554;
+const size_t index_html_br_len = 2882;
+const size_t index_html_size = 14866; // Uncompressed
+const char index_html_hash[] = "5558da24";
+
+#endif
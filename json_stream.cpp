@@ -0,0 +1,141 @@
+#include "json_stream.h"
+
+JsonStreamWriter::JsonStreamWriter(Print& out) : out(out), used(0), total(0), needComma(false) {}
+
+JsonStreamWriter::~JsonStreamWriter() {
+    flush();
+}
+
+void JsonStreamWriter::beginObject(const char* name) {
+    key(name);
+    writeChar('{');
+    needComma = false;
+}
+
+void JsonStreamWriter::endObject() {
+    writeChar('}');
+    needComma = true;
+}
+
+void JsonStreamWriter::beginArray(const char* name) {
+    key(name);
+    writeChar('[');
+    needComma = false;
+}
+
+void JsonStreamWriter::endArray() {
+    writeChar(']');
+    needComma = true;
+}
+
+void JsonStreamWriter::field(const char* name, int value) {
+    key(name);
+    char text[12];
+    snprintf(text, sizeof(text), "%d", value);
+    writeRaw(text);
+    needComma = true;
+}
+
+void JsonStreamWriter::field(const char* name, unsigned long value) {
+    key(name);
+    char text[12];
+    snprintf(text, sizeof(text), "%lu", value);
+    writeRaw(text);
+    needComma = true;
+}
+
+void JsonStreamWriter::field(const char* name, float value) {
+    key(name);
+    writeFloat(value);
+    needComma = true;
+}
+
+void JsonStreamWriter::field(const char* name, bool value) {
+    key(name);
+    writeRaw(value ? "true" : "false");
+    needComma = true;
+}
+
+void JsonStreamWriter::field(const char* name, const char* value) {
+    key(name);
+    writeString(value);
+    needComma = true;
+}
+
+void JsonStreamWriter::flush() {
+    if (used > 0) {
+        out.write((const uint8_t*)buffer, used);
+        used = 0;
+    }
+}
+
+// Writes the separator and, inside objects, the quoted key
+void JsonStreamWriter::key(const char* name) {
+    separator();
+    if (name) {
+        writeString(name);
+        writeChar(':');
+    }
+}
+
+void JsonStreamWriter::separator() {
+    if (needComma) writeChar(',');
+    needComma = false;
+}
+
+void JsonStreamWriter::writeChar(char c) {
+    if (used == BUFFER_SIZE) flush();
+    buffer[used++] = c;
+    total++;
+}
+
+void JsonStreamWriter::writeRaw(const char* text) {
+    while (*text) writeChar(*text++);
+}
+
+void JsonStreamWriter::writeString(const char* text) {
+    writeChar('"');
+    for (; *text; text++) {
+        char c = *text;
+        if (c == '"' || c == '\\') {
+            writeChar('\\');
+            writeChar(c);
+        } else if ((unsigned char)c < 0x20) {
+            char escaped[7];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            writeRaw(escaped);
+        } else {
+            writeChar(c);
+        }
+    }
+    writeChar('"');
+}
+
+// Fixed decimals with trailing zeros trimmed: 23.50 -> 23.5, -999.00 -> -999
+void JsonStreamWriter::writeFloat(float value) {
+    if (isnan(value) || isinf(value)) {
+        writeRaw("null");
+        return;
+    }
+    char text[24];
+    int length = snprintf(text, sizeof(text), "%.*f", FLOAT_DECIMALS, value);
+    if (length <= 0 || length >= (int)sizeof(text)) {
+        writeRaw("null");
+        return;
+    }
+    while (length > 0 && text[length - 1] == '0') length--;
+    if (length > 0 && text[length - 1] == '.') length--;
+    text[length] = '\0';
+    if (strcmp(text, "-0") == 0) strcpy(text, "0");
+    writeRaw(text);
+}
+
+size_t BufferPrint::write(const uint8_t* data, size_t size) {
+    if (overflow || length + size > capacity) {
+        overflow = true;
+        return 0;
+    }
+    memcpy(buffer + length, data, size);
+    length += size;
+    return size;
+}
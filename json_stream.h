@@ -0,0 +1,68 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <Arduino.h>
+
+// ==========================================
+// Streaming JSON Writer
+// ==========================================
+// Emits JSON token by token through a small fixed buffer into any Print
+// sink (a socket, a cache buffer...). Peak memory is the buffer, whatever
+// the size of the document.
+class JsonStreamWriter {
+public:
+    explicit JsonStreamWriter(Print& out);
+    ~JsonStreamWriter();
+
+    void beginObject(const char* key = nullptr);
+    void endObject();
+    void beginArray(const char* key = nullptr);
+    void endArray();
+
+    void field(const char* key, int value);
+    void field(const char* key, unsigned long value);
+    void field(const char* key, float value);
+    void field(const char* key, bool value);
+    void field(const char* key, const char* value);
+
+    void flush();
+    size_t bytesWritten() const { return total; }
+
+private:
+    static const size_t BUFFER_SIZE = 128;
+    static const int FLOAT_DECIMALS = 2; // Sensors resolve to 0.1 at best
+
+    void key(const char* name);
+    void separator();
+    void writeChar(char c);
+    void writeRaw(const char* text);
+    void writeString(const char* text);
+    void writeFloat(float value);
+
+    Print& out;
+    char buffer[BUFFER_SIZE];
+    size_t used;
+    size_t total;
+    bool needComma;
+};
+
+// Print sink over a fixed caller-owned buffer. Output past the end is
+// dropped and reported by overflowed(), so callers can fall back.
+class BufferPrint : public Print {
+public:
+    BufferPrint(char* buffer, size_t capacity) : buffer(buffer), capacity(capacity), length(0), overflow(false) {}
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t size) override;
+
+    size_t size() const { return length; }
+    bool overflowed() const { return overflow; }
+
+private:
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    bool overflow;
+};
+
+#endif // JSON_STREAM_H
@@ -0,0 +1,92 @@
+#include "logger.h"
+#include "hal.h"
+#include <freertos/semphr.h>
+#include <stdarg.h>
+
+static const char LEVEL_LETTERS[] = "-EWID";
+static const uint32_t LOG_TASK_STACK = 3072;
+static const unsigned long LOG_DRAIN_INTERVAL_MS = 20;
+
+static LogEntry ring[LOG_CAPACITY];
+static uint32_t nextSeq = 1;       // Seq of the next entry written
+static SemaphoreHandle_t logMutex = NULL;
+
+// Entry seq lives in ring[seq % LOG_CAPACITY] until LOG_CAPACITY newer
+// ones have been written
+static uint32_t oldestSeq() {
+    return nextSeq > LOG_CAPACITY ? nextSeq - LOG_CAPACITY : 1;
+}
+
+void logWrite(uint8_t level, const char* tag, const char* format, ...) {
+    // Formatted on the caller's stack, outside the lock
+    char text[LOG_TEXT_SIZE];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    if (!logMutex) return; // Before initLogging()
+    xSemaphoreTake(logMutex, portMAX_DELAY);
+    LogEntry& entry = ring[nextSeq % LOG_CAPACITY];
+    entry.seq = nextSeq++;
+    entry.ms = halMillis();
+    entry.level = level;
+    strncpy(entry.tag, tag, LOG_TAG_SIZE - 1);
+    entry.tag[LOG_TAG_SIZE - 1] = '\0';
+    memcpy(entry.text, text, sizeof(text));
+    xSemaphoreGive(logMutex);
+}
+
+bool logRead(uint32_t from, LogEntry& out) {
+    if (!logMutex) return false;
+    bool found = false;
+    xSemaphoreTake(logMutex, portMAX_DELAY);
+    if (from < oldestSeq()) from = oldestSeq();
+    if (from < nextSeq) {
+        out = ring[from % LOG_CAPACITY];
+        found = true;
+    }
+    xSemaphoreGive(logMutex);
+    return found;
+}
+
+uint32_t logNextSeq() {
+    if (!logMutex) return 1;
+    xSemaphoreTake(logMutex, portMAX_DELAY);
+    uint32_t seq = nextSeq;
+    xSemaphoreGive(logMutex);
+    return seq;
+}
+
+size_t formatLogEntry(const LogEntry& entry, char* line, size_t size) {
+    char letter = entry.level < sizeof(LEVEL_LETTERS) - 1 ? LEVEL_LETTERS[entry.level] : '?';
+    int n = snprintf(line, size, "[%6lu.%03lu] %c %s: %s\n", (unsigned long)(entry.ms / 1000),
+                     (unsigned long)(entry.ms % 1000), letter, entry.tag, entry.text);
+    if (n < 0) return 0;
+    return (size_t)n < size ? n : size - 1;
+}
+
+// Idle priority: only runs when control and HTTP have nothing to do, so
+// the UART's pace never reaches the callers
+static void logTask(void* parameter) {
+    uint32_t printed = 1; // Next seq to print
+    char line[LOG_TAG_SIZE + LOG_TEXT_SIZE + 24];
+    LogEntry entry;
+
+    while (true) {
+        while (logRead(printed, entry)) {
+            if (entry.seq > printed) {
+                Serial.printf("[LOG] %lu lines dropped\n", (unsigned long)(entry.seq - printed));
+            }
+            size_t length = formatLogEntry(entry, line, sizeof(line));
+            Serial.write((const uint8_t*)line, length);
+            printed = entry.seq + 1;
+        }
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_INTERVAL_MS));
+    }
+}
+
+void initLogging() {
+    logMutex = xSemaphoreCreateMutex();
+    xTaskCreatePinnedToCore(logTask, "log", LOG_TASK_STACK, nullptr, tskIDLE_PRIORITY, nullptr, 0);
+}
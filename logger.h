@@ -0,0 +1,72 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+
+// ==========================================
+// Logging
+// ==========================================
+// LOG_ERROR/WARN/INFO/DEBUG(tag, format, ...) format into a RAM ring of
+// LOG_CAPACITY lines and return; a low-priority task drains the ring to
+// Serial, and /logs serves what is still in it. Callers never wait on the
+// UART. When the drain falls behind the oldest lines are overwritten and
+// the drain reports how many it missed.
+//
+// Calls above LOG_COMPILE_LEVEL compile to nothing, arguments included.
+// Set it per build, e.g. -DLOG_COMPILE_LEVEL=LOG_LEVEL_WARN.
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL LOG_LEVEL_INFO
+#endif
+
+const size_t LOG_CAPACITY = 48;    // Lines kept
+const size_t LOG_TAG_SIZE = 12;
+const size_t LOG_TEXT_SIZE = 96;   // Longer messages are truncated
+
+struct LogEntry {
+    uint32_t seq;      // 1, 2, 3... never reused
+    uint32_t ms;       // millis() when logged
+    uint8_t level;
+    char tag[LOG_TAG_SIZE];
+    char text[LOG_TEXT_SIZE];
+};
+
+void initLogging(); // First thing in setup(): creates the ring lock and drain task
+void logWrite(uint8_t level, const char* tag, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+// Oldest retained entry with seq >= from; false if there is none yet
+bool logRead(uint32_t from, LogEntry& out);
+uint32_t logNextSeq(); // Seq the next line will get
+// "[   12.345] I TANK: text"
+size_t formatLogEntry(const LogEntry& entry, char* line, size_t size);
+
+#if LOG_COMPILE_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(tag, ...) logWrite(LOG_LEVEL_ERROR, tag, __VA_ARGS__)
+#else
+#define LOG_ERROR(tag, ...) do {} while (0)
+#endif
+
+#if LOG_COMPILE_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(tag, ...) logWrite(LOG_LEVEL_WARN, tag, __VA_ARGS__)
+#else
+#define LOG_WARN(tag, ...) do {} while (0)
+#endif
+
+#if LOG_COMPILE_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(tag, ...) logWrite(LOG_LEVEL_INFO, tag, __VA_ARGS__)
+#else
+#define LOG_INFO(tag, ...) do {} while (0)
+#endif
+
+#if LOG_COMPILE_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(tag, ...) logWrite(LOG_LEVEL_DEBUG, tag, __VA_ARGS__)
+#else
+#define LOG_DEBUG(tag, ...) do {} while (0)
+#endif
+
+#endif // LOGGER_H
@@ -1,70 +1,103 @@
-#ifndef LOGIC_H
-#define LOGIC_H
-
-#include <Arduino.h>
-#include "time.h"
-#include "config.h"
-#include "sensors.h"
-#include "actuators.h"
-
-enum SystemStatus {
-    STATUS_NORMAL = 0,
-    STATUS_WARNING = 1,
-    STATUS_ALARM = 2,
-    STATUS_SENSOR_ERROR = 3
-};
-
-struct SystemData {
-    float ambientTemp;
-    float ambientHumidity;
-    float soilTemp;
-    int soilMoisture;
-    int soilRaw;       // New: Raw ADC value
-    int tankLevel;
-    float tankDistance; // New: Raw distance in cm
-    int lightLevel;
-    int lightRaw;      // New: Raw ADC value
-    bool motionDetected;
-    bool pumpActive;
-    bool tankPumpActive;
-    bool luminaryActive; // New field
-    SystemStatus status;
-    unsigned long lastMeasurementTime; // Global last update time
-    unsigned long timestamp;           // Time of this specific record
-};
-
-void initLogic();
-void updateSensors();
-void addToHistory();
-bool checkAndMeasure();
-void runAutomation();
-SystemData getSystemData();
-void setSecurityMode(bool enabled);
-bool getSecurityMode();
-void setSecurityAuto(bool enabled);
-bool getSecurityAuto();
-void setIrrigationAuto(bool enabled);
-bool getIrrigationAuto();
-void setIrrigationManual(bool enable, int durationMinutes = 0);
-void setTankAuto(bool enabled);
-bool getTankAuto();
-void setTankManual(bool enable);
-void setLuminaryAuto(bool enabled); // New
-bool getLuminaryAuto();             // New
-bool getLuminaryMode();             // Get current luminary state
-void setLuminaryManual(bool enable);
-void setSecurityManual(bool enable);
-void forcePump(bool enable, int durationMinutes = 0);
-void forceTank(bool enable);
-void forceLuminary(bool enable);    // New
-void setSecuritySchedule(String start, String end);
-String getSecurityStartTime();
-String getSecurityEndTime();
-void checkSecuritySchedule();
-void checkSecurityOnly(); // New function for non-blocking checks
-void clearAlarm();
-
-#include <vector>
-extern std::vector<SystemData> history;
-
-#endif // LOGIC_H
+#ifndef LOGIC_H
+#define LOGIC_H
+
+#include <Arduino.h>
+#include <time.h>
+#include "config.h"
+#include "sensors.h"
+#include "actuators.h"
+
+enum SystemStatus {
+    STATUS_NORMAL = 0,
+    STATUS_WARNING = 1,
+    STATUS_ALARM = 2,
+    STATUS_SENSOR_ERROR = 3
+};
+
+struct SystemData {
+    float ambientTemp;
+    float ambientHumidity;
+    float soilTemp;
+    int soilMoisture;
+    int soilRaw;       // New: Raw ADC value
+    int tankLevel;
+    float tankDistance; // New: Raw distance in cm
+    int lightLevel;
+    int lightRaw;      // New: Raw ADC value
+    bool motionDetected;
+    bool pumpActive;
+    bool tankPumpActive;
+    bool luminaryActive; // New field
+    SystemStatus status;
+    unsigned long lastMeasurementTime; // Global last update time
+    unsigned long timestamp;           // Time of this specific record
+    uint32_t freeHeap;                 // At measurement, see heap_monitor.h
+    uint32_t largestBlock;
+};
+
+void initLogic();
+void updateSensors();
+void addToHistory();
+bool checkAndMeasure();
+void runAutomation();
+SystemData getSystemData();
+void setSecurityMode(bool enabled);
+bool getSecurityMode();
+void setSecurityAuto(bool enabled);
+bool getSecurityAuto();
+void setIrrigationAuto(bool enabled);
+bool getIrrigationAuto();
+void setIrrigationManual(bool enable, int durationMinutes = 0);
+void setTankAuto(bool enabled);
+bool getTankAuto();
+void setTankManual(bool enable);
+void setLuminaryAuto(bool enabled); // New
+bool getLuminaryAuto();             // New
+bool getLuminaryMode();             // Get current luminary state
+void setLuminaryManual(bool enable);
+void setSecurityManual(bool enable);
+void forcePump(bool enable, int durationMinutes = 0);
+void forceTank(bool enable);
+void forceLuminary(bool enable);    // New
+void setSecuritySchedule(const char* start, const char* end); // "HH:MM"
+const char* getSecurityStartTime(); // "HH:MM", valid until the next call; under the state lock
+const char* getSecurityEndTime();
+void checkSecuritySchedule();
+void checkSecurityOnly(); // New function for non-blocking checks
+void clearAlarm();
+unsigned long getStateVersion();  // Bumps whenever anything served by /data or /status changes
+unsigned long getConfigVersion(); // Bumps whenever anything served by /config changes
+void lockState();   // Shared with the web server task; recursive
+void unlockState();
+
+// ==========================================
+// History Ring
+// ==========================================
+// The last MAX_HISTORY measurements in a fixed array: no allocation after
+// boot however long it runs. Indexed oldest first, like the vector it
+// replaced; push() overwrites the oldest record once full.
+const size_t MAX_HISTORY = 24; // Store 24 data points (24 hours at 1 hour intervals)
+
+class HistoryRing {
+public:
+    HistoryRing() : start(0), count(0) {}
+
+    size_t size() const { return count; }
+    bool full() const { return count == MAX_HISTORY; }
+    const SystemData& operator[](size_t i) const { return records[(start + i) % MAX_HISTORY]; }
+
+    void push(const SystemData& record) {
+        records[(start + count) % MAX_HISTORY] = record;
+        if (count < MAX_HISTORY) count++;
+        else start = (start + 1) % MAX_HISTORY;
+    }
+
+private:
+    SystemData records[MAX_HISTORY];
+    size_t start; // Oldest record
+    size_t count;
+};
+
+extern HistoryRing history;
+
+#endif // LOGIC_H
@@ -1,438 +1,611 @@
-#ifndef LOGIN_HTML_H_H
-#define LOGIN_HTML_H_H
-
-#include <Arduino.h>
-
-const char login_html[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xED, 0x3D, 0xD9, 0x92, 0xE3, 0x36, 
-0x92, 0xEF, 0xFE, 0x0A, 0x58, 0x1D, 0x1E, 0xA9, 0xBC, 0xA2, 0x8A, 0xA4, 0xA4, 0x2A, 0x55, 0xB9, 
-0x54, 0x31, 0x7D, 0xD9, 0xAE, 0x8D, 0x6E, 0xBB, 0xC3, 0xD5, 0x33, 0x13, 0xF3, 0x48, 0x91, 0x90, 
-0x44, 0x37, 0x45, 0x6A, 0x78, 0xD4, 0xD1, 0x9E, 0xFE, 0xA8, 0x8D, 0xFD, 0x84, 0xF9, 0xB1, 0xCD, 
-0x04, 0xC0, 0x0B, 0x04, 0x48, 0xAA, 0x8E, 0xDE, 0x88, 0x89, 0x61, 0x1F, 0x92, 0x48, 0x1C, 0x89, 
-0xBC, 0x33, 0x01, 0x02, 0x17, 0xDF, 0xBE, 0xF9, 0xF5, 0xF5, 0xC7, 0xBF, 0x7F, 0x78, 0x4B, 0xB6, 
-0xE9, 0x2E, 0xB8, 0xFC, 0xE6, 0x02, 0x3F, 0x48, 0xE0, 0x84, 0x9B, 0xE5, 0x80, 0x26, 0x03, 0xBC, 
-0x41, 0x1D, 0xEF, 0xF2, 0x1B, 0x02, 0xD7, 0xC5, 0x8E, 0xA6, 0x0E, 0x71, 0xB7, 0x4E, 0x9C, 0xD0, 
-0x74, 0x39, 0xF8, 0xCB, 0xC7, 0x1F, 0x8D, 0xC5, 0xA0, 0xFA, 0x28, 0x74, 0x76, 0x74, 0x39, 0xB8, 
-0xF1, 0xE9, 0xED, 0x3E, 0x8A, 0xD3, 0x01, 0x71, 0xA3, 0x30, 0xA5, 0x21, 0x14, 0xBD, 0xF5, 0xBD, 
-0x74, 0xBB, 0xF4, 0xE8, 0x8D, 0xEF, 0x52, 0x83, 0xFD, 0x18, 0x13, 0x3F, 0xF4, 0x53, 0xDF, 0x09, 
-0x8C, 0xC4, 0x75, 0x02, 0xBA, 0xB4, 0x26, 0x66, 0xDE, 0x54, 0xEA, 0xA7, 0x01, 0xBD, 0xBC, 0x0A, 
-0x6F, 0x68, 0x1C, 0x3A, 0x1E, 0x8D, 0x23, 0x72, 0x05, 0xCD, 0x04, 0xFE, 0x06, 0x9A, 0xA2, 0xC4, 
-0x80, 0x5F, 0xBE, 0xEB, 0x3B, 0x31, 0xB9, 0xA6, 0x89, 0xFF, 0xAF, 0xFF, 0x0D, 0x2F, 0x8E, 0x79, 
-0x05, 0x5E, 0x39, 0x71, 0x63, 0x7F, 0x9F, 0xF2, 0x1F, 0x78, 0x1D, 0x1F, 0x93, 0x97, 0xFB, 0x7D, 
-0x70, 0x4F, 0xD2, 0x2D, 0xDD, 0x51, 0x72, 0xF5, 0xFE, 0xFD, 0xDB, 0x37, 0x57, 0x2F, 0x3F, 0xBE, 
-0x7D, 0xF7, 0x77, 0xB2, 0xA2, 0xEB, 0x28, 0xA6, 0xC4, 0x09, 0xEF, 0xD3, 0xAD, 0x1F, 0x6E, 0x08, 
-0x0D, 0x12, 0x4A, 0xD2, 0x88, 0xEC, 0x63, 0x7A, 0x03, 0x5D, 0x91, 0x75, 0xE0, 0x24, 0xDB, 0xA7, 
-0x6F, 0x68, 0xB4, 0xCE, 0x42, 0x37, 0xF5, 0xA3, 0x70, 0x74, 0x44, 0xFE, 0x28, 0xEE, 0xE6, 0x5D, 
-0x78, 0x1E, 0x56, 0x0B, 0x22, 0xC7, 0x23, 0x2E, 0x54, 0x4B, 0xB0, 0x1D, 0xCF, 0x4F, 0x9C, 0x55, 
-0x00, 0x4D, 0xC6, 0x4E, 0x98, 0xF8, 0x58, 0x35, 0xA9, 0xD5, 0xF3, 0x22, 0x37, 0xDB, 0x41, 0x47, 
-0x93, 0xFC, 0xCB, 0xDB, 0x80, 0xB2, 0xDF, 0xAC, 0x85, 0x77, 0x7E, 0x92, 0x4E, 0x1C, 0xCF, 0x1B, 
-0x0D, 0x45, 0xC3, 0xC3, 0xA3, 0x1F, 0x6A, 0xD5, 0x65, 0x18, 0x7E, 0xA6, 0xC1, 0x9E, 0xC6, 0xD0, 
-0xF3, 0xD6, 0x49, 0x49, 0xE2, 0xAC, 0x29, 0x0C, 0x3A, 0x82, 0x3B, 0x0E, 0x60, 0x3F, 0x0A, 0xCB, 
-0xDE, 0x56, 0x91, 0x77, 0x4F, 0x70, 0x84, 0xC4, 0x5F, 0x93, 0x38, 0x83, 0x8F, 0x90, 0x54, 0xB8, 
-0x25, 0xBF, 0xF2, 0xE1, 0x12, 0x80, 0xE1, 0x15, 0x54, 0x79, 0x8D, 0x40, 0xFD, 0x6D, 0x4B, 0xC3, 
-0xDF, 0xA0, 0xE8, 0xFD, 0xC8, 0x0D, 0x12, 0x19, 0x0F, 0x78, 0x41, 0x93, 0xA3, 0x5A, 0x4F, 0x47, 
-0x24, 0xA6, 0x69, 0x16, 0x4B, 0xFD, 0x4B, 0x43, 0xC4, 0xC6, 0x7E, 0x68, 0xB4, 0x55, 0xD4, 0x80, 
-0x22, 0x6F, 0x91, 0x22, 0x58, 0x9E, 0x86, 0x34, 0x1E, 0x0D, 0xDF, 0xFC, 0xFA, 0xFE, 0x35, 0x67, 
-0xD2, 0x77, 0x80, 0x19, 0xEA, 0x0D, 0xC7, 0xA4, 0x4A, 0x1E, 0x15, 0x18, 0x9D, 0xFD, 0x93, 0x2F, 
-0x12, 0x0C, 0x5F, 0xD4, 0xF8, 0x00, 0x21, 0x42, 0x7C, 0x94, 0xA8, 0x58, 0x87, 0x87, 0x61, 0x62, 
-0x1D, 0x4A, 0x0F, 0x9E, 0x7B, 0xE8, 0xCD, 0x0E, 0x15, 0x63, 0xAD, 0xFD, 0x4C, 0xE3, 0x7B, 0xC5, 
-0x90, 0x40, 0x2F, 0x24, 0xC8, 0x5A, 0x37, 0xD4, 0xFB, 0xC8, 0xA4, 0x69, 0x49, 0x82, 0x08, 0xD4, 
-0xC0, 0x75, 0x1A, 0xC5, 0xCE, 0x86, 0x4E, 0x36, 0x34, 0xBD, 0x4A, 0xE9, 0x6E, 0x34, 0x64, 0xB2, 
-0x26, 0xF3, 0x2B, 0x5E, 0x4A, 0x2C, 0x55, 0x1B, 0x5C, 0x2E, 0xC9, 0xD0, 0x73, 0xE2, 0x4F, 0x43, 
-0x15, 0x4A, 0xF1, 0x2A, 0xE4, 0x99, 0x8B, 0x99, 0x13, 0x7A, 0x24, 0x49, 0xEF, 0x03, 0x9A, 0x10, 
-0x7F, 0xB7, 0xA3, 0x9E, 0x0F, 0xDC, 0x0E, 0x0F, 0x41, 0xB0, 0x89, 0x24, 0x55, 0xCA, 0xD6, 0xFA, 
-0x8A, 0x20, 0x82, 0x64, 0x68, 0x47, 0xD5, 0xDA, 0x12, 0x83, 0x6E, 0x02, 0x4C, 0xF3, 0x21, 0x46, 
-0x69, 0x4C, 0xEF, 0x47, 0xC3, 0x95, 0xE3, 0x7E, 0xDA, 0xC4, 0x51, 0x16, 0x7A, 0x86, 0x1B, 0x05, 
-0x51, 0x0C, 0x24, 0x1C, 0xBE, 0x30, 0x1D, 0x73, 0x6D, 0x51, 0xFC, 0xEA, 0xEF, 0x50, 0x0D, 0x3B, 
-0x61, 0xAA, 0xEB, 0x4B, 0x87, 0x98, 0x8F, 0x40, 0x35, 0xD0, 0x3B, 0x0E, 0xD7, 0x77, 0x11, 0x61, 
-0x92, 0x7E, 0x0B, 0x7C, 0x0A, 0x9C, 0x07, 0x8C, 0xAA, 0xAC, 0xD6, 0xE4, 0xE6, 0x9C, 0x99, 0x56, 
-0x3A, 0x12, 0xE0, 0xB5, 0x3A, 0x1C, 0x43, 0xBC, 0xDA, 0x33, 0xA0, 0x43, 0xDB, 0x70, 0xD9, 0xDA, 
-0x9A, 0x5D, 0xBD, 0x5A, 0x93, 0x25, 0x83, 0xDD, 0xE3, 0xB6, 0x41, 0xCB, 0x91, 0x3F, 0x46, 0xB1, 
-0x4B, 0x09, 0x98, 0xBA, 0x6D, 0x2A, 0xEC, 0x8C, 0xE0, 0x49, 0x7A, 0xB7, 0x0F, 0xC0, 0xEA, 0xA5, 
-0x9C, 0x1E, 0xB9, 0x61, 0xF1, 0xC3, 0x2D, 0x8D, 0x7D, 0x00, 0x02, 0x2A, 0xF9, 0x49, 0x92, 0xD1, 
-0x44, 0x3D, 0xAE, 0x47, 0xF3, 0xD4, 0x7A, 0xBA, 0x9E, 0xAD, 0x4F, 0x54, 0x23, 0xFD, 0xD2, 0x2D, 
-0x9A, 0x30, 0xAE, 0xDF, 0xE8, 0x2E, 0xBA, 0xA1, 0x92, 0x65, 0x73, 0xD6, 0x29, 0x8D, 0x89, 0x43, 
-0x92, 0x2D, 0x20, 0x92, 0x78, 0x34, 0x70, 0xD8, 0xE0, 0x68, 0xD8, 0x6A, 0xEC, 0xF0, 0xBA, 0xF5, 
-0x43, 0x2F, 0xBA, 0x55, 0xE8, 0x34, 0x66, 0xDE, 0xEA, 0x7A, 0x4C, 0xC7, 0xAC, 0x1F, 0xFD, 0x1D, 
-0x8D, 0xB2, 0x54, 0x6F, 0x8D, 0x7B, 0x21, 0xB0, 0x64, 0xDE, 0x98, 0x0D, 0x51, 0x6B, 0x64, 0xAB, 
-0xD7, 0x01, 0x46, 0xE5, 0x80, 0x56, 0xB5, 0x0F, 0x00, 0xFF, 0x57, 0xDC, 0xD7, 0xF2, 0x3F, 0x03, 
-0x9F, 0xB8, 0x68, 0x7A, 0x52, 0x34, 0xE6, 0x6E, 0x14, 0xC7, 0xD4, 0x05, 0x9E, 0xD2, 0x56, 0xE5, 
-0x8A, 0x9A, 0x55, 0x59, 0x96, 0x30, 0xFE, 0x23, 0xA3, 0xF1, 0xFD, 0x35, 0x0D, 0xA0, 0x6E, 0x04, 
-0x48, 0x9F, 0x30, 0x4E, 0x35, 0xB0, 0x54, 0xD7, 0xA8, 0xB1, 0x4C, 0x1B, 0x9E, 0xF3, 0x72, 0x07, 
-0x69, 0xF2, 0x5A, 0x65, 0xE8, 0x60, 0xE2, 0x87, 0xC0, 0x0C, 0x3F, 0x7F, 0x7C, 0xFF, 0x0E, 0x80, 
-0x1E, 0x5E, 0xEC, 0x9D, 0x74, 0x4B, 0xBC, 0xE5, 0xE0, 0xBD, 0x6D, 0x11, 0xCB, 0x9E, 0x9C, 0x9E, 
-0xBD, 0x3C, 0x23, 0x67, 0xC4, 0x24, 0x16, 0xFE, 0xB1, 0x26, 0x70, 0x77, 0x4A, 0x4E, 0xE1, 0x8F, 
-0xC9, 0xFE, 0xE4, 0x85, 0x3E, 0x0F, 0x2E, 0x2F, 0x8E, 0xB1, 0xEA, 0xE5, 0x50, 0x3F, 0x24, 0xBC, 
-0x5A, 0x45, 0xBA, 0x03, 0x34, 0xD7, 0x8F, 0x5D, 0x60, 0x75, 0xF7, 0x6E, 0x39, 0xB0, 0x6C, 0x70, 
-0x97, 0xEF, 0xF9, 0x67, 0xBC, 0x1C, 0xCC, 0xB1, 0x7B, 0xFE, 0xF8, 0xF2, 0x22, 0xF0, 0x43, 0x4A, 
-0xEE, 0x2C, 0xFE, 0xF0, 0x1E, 0x3F, 0x07, 0xE4, 0xCE, 0x16, 0x3F, 0xE1, 0x73, 0x8A, 0x85, 0xB1, 
-0x90, 0xA2, 0xA8, 0x2D, 0x95, 0xB5, 0x55, 0x85, 0x67, 0x13, 0x5B, 0x14, 0xE7, 0xDF, 0xB0, 0xC2, 
-0x7C, 0x72, 0x32, 0xE3, 0x55, 0xD8, 0x37, 0x45, 0x0F, 0x8B, 0xC9, 0xF4, 0x44, 0xC0, 0xC3, 0xBF, 
-0xB2, 0x7E, 0xCE, 0x26, 0xA7, 0x0B, 0x5E, 0x8F, 0x7F, 0x55, 0x54, 0x14, 0x95, 0x44, 0x47, 0x53, 
-0x51, 0xDA, 0x56, 0x14, 0xB5, 0xA5, 0xB2, 0x76, 0x5B, 0xE1, 0x72, 0x14, 0x02, 0x88, 0xFA, 0x30, 
-0x38, 0x90, 0xAD, 0xE3, 0xE0, 0x85, 0xA5, 0x61, 0xB0, 0x66, 0xF3, 0x6A, 0x5D, 0xCC, 0xA0, 0x7D, 
-0xAA, 0x7E, 0xF2, 0x65, 0x4C, 0xE6, 0xA6, 0x4A, 0xAB, 0x76, 0xB9, 0x3C, 0x5F, 0x88, 0xEB, 0xA4, 
-0xEE, 0x76, 0x44, 0x55, 0x42, 0x81, 0x52, 0x1B, 0x81, 0x5E, 0xA7, 0x71, 0x8C, 0xF2, 0xF9, 0x16, 
-0x3F, 0xB8, 0x31, 0xC7, 0xE8, 0x84, 0x49, 0xEB, 0x39, 0x68, 0x49, 0xAA, 0x75, 0x53, 0xBF, 0x1C, 
-0x8D, 0xC4, 0xB3, 0x8B, 0xE3, 0x6A, 0x40, 0x75, 0xC1, 0xEC, 0x45, 0x25, 0xB8, 0xFA, 0x9E, 0xBC, 
-0x06, 0xFB, 0xE3, 0x83, 0xEB, 0x56, 0x37, 0x57, 0x72, 0xF0, 0x03, 0x51, 0xDB, 0x2E, 0x03, 0x4D, 
-0xB2, 0x02, 0xFD, 0x13, 0x32, 0xCC, 0x7F, 0x7F, 0x5C, 0xB4, 0xC2, 0x22, 0xCE, 0xFA, 0x28, 0x64, 
-0x23, 0x74, 0x4E, 0x84, 0x09, 0x2A, 0x21, 0xFE, 0x52, 0xAB, 0x3F, 0x29, 0xDD, 0x86, 0xEE, 0xA6, 
-0xB8, 0x4B, 0x40, 0xBE, 0x2D, 0x4C, 0xB8, 0xAA, 0x55, 0xE6, 0xF3, 0x1C, 0x0C, 0x15, 0x47, 0x3F, 
-0x7F, 0x66, 0xAD, 0xED, 0xB3, 0xE9, 0x69, 0xFD, 0x59, 0x69, 0xD5, 0xCE, 0x1B, 0xCD, 0x11, 0x73, 
-0x32, 0x07, 0x4B, 0xEF, 0x24, 0x74, 0x4C, 0xA4, 0x1B, 0xF5, 0x46, 0xA2, 0xBD, 0x03, 0xAE, 0xC0, 
-0xFD, 0x39, 0xB1, 0xFA, 0xA0, 0xA3, 0xDF, 0x40, 0x5A, 0x70, 0x52, 0x1D, 0x13, 0xF7, 0x7F, 0x3A, 
-0x50, 0x07, 0x6C, 0xF1, 0x41, 0x50, 0xBF, 0x62, 0xC5, 0x31, 0x76, 0x64, 0xD6, 0xBF, 0x42, 0xFA, 
-0x49, 0xEE, 0x11, 0x7C, 0x2F, 0x41, 0x58, 0xC5, 0x53, 0x18, 0x85, 0x5D, 0xC4, 0xAA, 0x76, 0xFD, 
-0x32, 0x03, 0x7D, 0xEF, 0x3A, 0xB1, 0x47, 0x46, 0x19, 0x28, 0xE6, 0x4D, 0x10, 0xAD, 0x80, 0x3D, 
-0x6F, 0x9C, 0xD8, 0x47, 0xBF, 0x22, 0x61, 0x2E, 0x3D, 0x4A, 0x08, 0x73, 0x1A, 0x5C, 0xB0, 0xBD, 
-0x55, 0x78, 0x1C, 0xA8, 0x6C, 0xB0, 0xCA, 0x3A, 0x8C, 0x9D, 0x63, 0x53, 0x23, 0x83, 0x15, 0x32, 
-0x56, 0x1B, 0x49, 0x86, 0x56, 0x51, 0xEC, 0x51, 0x40, 0x94, 0xB5, 0xBF, 0x23, 0x20, 0x83, 0xBE, 
-0x27, 0x4A, 0xF3, 0xFB, 0x1C, 0xDB, 0x47, 0x4A, 0xD4, 0xF2, 0x72, 0x29, 0xBD, 0x4B, 0x8D, 0x7D, 
-0xEC, 0xEF, 0x9C, 0xB8, 0x1A, 0xCE, 0xE9, 0xA9, 0xDB, 0x0B, 0x62, 0x94, 0x38, 0x27, 0x36, 0x36, 
-0xB1, 0xE3, 0xF9, 0x40, 0x95, 0x91, 0x35, 0x9D, 0x7B, 0x74, 0x33, 0x96, 0x46, 0x42, 0xCC, 0xEF, 
-0xC6, 0xC0, 0xB5, 0x96, 0xB5, 0xB0, 0x4F, 0x89, 0x65, 0x9A, 0xDF, 0x1D, 0x69, 0xD9, 0xA1, 0x3A, 
-0x9C, 0x73, 0xD5, 0x10, 0xBB, 0x39, 0xE4, 0x23, 0x8C, 0x14, 0x4C, 0x27, 0x73, 0xA3, 0x12, 0x59, 
-0x1D, 0x34, 0x47, 0xC8, 0x72, 0x3C, 0x0F, 0x18, 0x62, 0xCE, 0xB1, 0x6C, 0x6C, 0xEE, 0xCA, 0x9B, 
-0x53, 0xAB, 0x63, 0x6C, 0xC6, 0x2D, 0x5D, 0x7D, 0xF2, 0x53, 0xA3, 0x2A, 0x24, 0x81, 0xBF, 0x3F, 
-0x27, 0x48, 0x9B, 0xCE, 0x5A, 0x8C, 0x80, 0x6B, 0x3F, 0x08, 0x72, 0xE4, 0x30, 0x4E, 0xDE, 0x3B, 
-0x31, 0x4A, 0x83, 0x16, 0x9D, 0xBD, 0xBB, 0xEA, 0x62, 0x84, 0x24, 0x5B, 0x31, 0x4C, 0x8D, 0xF5, 
-0xE5, 0x80, 0xFF, 0x77, 0x46, 0xE0, 0xAC, 0x68, 0xD0, 0x52, 0x08, 0xFC, 0x4E, 0xBA, 0x5B, 0x01, 
-0x39, 0xE1, 0x47, 0x57, 0x59, 0xD6, 0xF1, 0x3A, 0x8A, 0xC0, 0x9B, 0x67, 0xC3, 0x97, 0xA8, 0x94, 
-0xAB, 0x0E, 0x81, 0xFC, 0x4E, 0xC6, 0x80, 0x18, 0x68, 0x07, 0x56, 0x62, 0x9F, 0x75, 0xB0, 0x05, 
-0x1B, 0x07, 0x2B, 0xD7, 0xC2, 0x16, 0x2F, 0x40, 0xAB, 0x9D, 0xDA, 0x4E, 0x4F, 0x46, 0x7E, 0x31, 
-0x3B, 0x9D, 0xCF, 0x4F, 0xCE, 0xBA, 0xB5, 0xA0, 0xB5, 0x9E, 0xAF, 0xD5, 0xC5, 0x5A, 0x08, 0x54, 
-0x02, 0x7C, 0x7E, 0xBE, 0x0F, 0x1C, 0x97, 0x6E, 0xA3, 0x00, 0x3A, 0xD7, 0xA0, 0xEB, 0x64, 0x76, 
-0x3A, 0x5B, 0xAC, 0xB4, 0xA0, 0x14, 0x36, 0x00, 0x6C, 0x44, 0x37, 0x4E, 0x5F, 0x65, 0x69, 0x8A, 
-0x2A, 0xB8, 0x53, 0xCC, 0x56, 0x69, 0xF8, 0x10, 0x21, 0x33, 0xE7, 0x67, 0x27, 0x80, 0x37, 0x26, 
-0x64, 0xE6, 0xEC, 0x74, 0x31, 0x6F, 0x53, 0x20, 0x5D, 0x3C, 0x0C, 0x30, 0x18, 0x09, 0x05, 0x15, 
-0x0D, 0x4F, 0x1A, 0x96, 0xEB, 0x41, 0xF4, 0xA2, 0x36, 0x5D, 0xAC, 0xCD, 0xC7, 0x03, 0x73, 0xBE, 
-0x85, 0x60, 0x4C, 0x26, 0xD8, 0x23, 0xD8, 0xAD, 0x85, 0xC6, 0x35, 0xF2, 0x31, 0x93, 0x16, 0x44, 
-0x9B, 0xA8, 0x9B, 0x80, 0xAC, 0xD4, 0xD7, 0xA3, 0x20, 0x2A, 0x72, 0xD6, 0x7B, 0x1A, 0x6D, 0x36, 
-0x41, 0xC3, 0xAD, 0xAB, 0xC1, 0xC7, 0xC3, 0x44, 0x5E, 0xB0, 0x83, 0xD1, 0x5E, 0x58, 0x14, 0x7C, 
-0x27, 0x3D, 0xF7, 0xF7, 0x67, 0x83, 0x16, 0xFA, 0x36, 0xE0, 0xA9, 0x04, 0xB2, 0x1A, 0xA1, 0xEC, 
-0xC5, 0x48, 0x80, 0x93, 0x77, 0x7E, 0xF8, 0xA9, 0x87, 0xB4, 0x01, 0x35, 0x3E, 0xB5, 0x6B, 0xEA, 
-0x4D, 0x94, 0xB2, 0x52, 0x3A, 0x25, 0x61, 0x3A, 0xF3, 0xB5, 0x9A, 0xDD, 0x6A, 0xF0, 0xF0, 0x10, 
-0x60, 0x47, 0x93, 0xC4, 0xD9, 0xB4, 0x13, 0x89, 0xC5, 0x0C, 0x46, 0x5E, 0x52, 0x4F, 0xA1, 0x78, 
-0xB3, 0x72, 0x46, 0xB6, 0x6D, 0x8E, 0xC9, 0x74, 0xC1, 0xFF, 0x99, 0x13, 0xAB, 0xAF, 0xC3, 0xA0, 
-0xAA, 0x6C, 0xEB, 0x2B, 0x17, 0x6A, 0xD7, 0x75, 0xE6, 0x4E, 0x97, 0xB6, 0xAB, 0x0E, 0xFB, 0x17, 
-0x27, 0xCD, 0x62, 0x70, 0xFE, 0x3E, 0x38, 0x01, 0x4D, 0x53, 0x4A, 0x7E, 0x05, 0xE9, 0x8D, 0x7D, 
-0x4F, 0x38, 0x81, 0x6F, 0x60, 0xD8, 0xE4, 0x7D, 0xE4, 0xB5, 0x23, 0xE4, 0x31, 0xFE, 0x55, 0xEE, 
-0x4C, 0x71, 0xA9, 0xE2, 0xAA, 0xA1, 0xCB, 0xB1, 0xBA, 0x33, 0x92, 0xAD, 0xE3, 0x45, 0xB7, 0xE7, 
-0x98, 0x8C, 0x98, 0x83, 0x1B, 0x39, 0x37, 0xE1, 0x3F, 0xC3, 0xB2, 0xE1, 0x7F, 0x86, 0x37, 0xC0, 
-0x9A, 0xF8, 0x3B, 0x99, 0x77, 0x89, 0xE7, 0xB3, 0x39, 0x55, 0x2C, 0xEC, 0xE1, 0xE3, 0xF2, 0x2C, 
-0x6F, 0xEE, 0xAD, 0x9E, 0xC5, 0xA9, 0xFA, 0x4A, 0x2E, 0x58, 0x1F, 0x7C, 0xF5, 0xF0, 0x36, 0x6A, 
-0xDC, 0x6D, 0x9D, 0x8E, 0x89, 0x3D, 0x03, 0xE6, 0x3E, 0x43, 0x42, 0x2D, 0x0E, 0x92, 0x8C, 0xD3, 
-0xF9, 0x98, 0x2C, 0xE0, 0xDF, 0x19, 0xAB, 0x3B, 0xEB, 0x16, 0x0C, 0x3A, 0xA7, 0xA7, 0xB4, 0xCB, 
-0x8E, 0xF4, 0x72, 0x4C, 0xD6, 0x91, 0x9B, 0x25, 0xED, 0x36, 0x57, 0x58, 0x8A, 0x4A, 0x67, 0x4C, 
-0xC3, 0xEC, 0x28, 0x48, 0x9A, 0x47, 0x4E, 0x4C, 0xB3, 0x2A, 0x4E, 0xBC, 0x7E, 0x95, 0xA7, 0xF1, 
-0xCF, 0x2C, 0xE7, 0x65, 0x18, 0xA4, 0x35, 0x07, 0x56, 0xB6, 0xCC, 0x79, 0x8B, 0x02, 0x51, 0x0B, 
-0x77, 0x91, 0x79, 0x40, 0x56, 0xCE, 0x13, 0x0F, 0x28, 0xD7, 0x7E, 0x98, 0x60, 0x7D, 0x02, 0xF4, 
-0x06, 0xB8, 0x31, 0xE5, 0xD1, 0x88, 0xF0, 0x54, 0x8C, 0xBF, 0x8E, 0xC2, 0xD4, 0x48, 0xFC, 0xCF, 
-0xF4, 0x9C, 0xD8, 0x93, 0x39, 0x38, 0xC0, 0x3F, 0x34, 0x1F, 0xDF, 0x52, 0x4C, 0xCD, 0x9F, 0x93, 
-0x53, 0xD3, 0xEC, 0x1F, 0xF3, 0x43, 0x2C, 0xB7, 0xF1, 0x43, 0x88, 0x8F, 0xC0, 0x07, 0xDB, 0x41, 
-0x68, 0x08, 0x92, 0x5C, 0x2F, 0x80, 0x62, 0x66, 0x6C, 0x45, 0xD3, 0xD6, 0xC4, 0x92, 0x9E, 0xA2, 
-0xEA, 0x8A, 0x8D, 0x04, 0x1D, 0xBE, 0x70, 0x73, 0x4E, 0x0C, 0x73, 0x62, 0x4E, 0xAB, 0xD0, 0x75, 
-0xB9, 0x30, 0xAA, 0xC1, 0xD6, 0xF3, 0x17, 0x1D, 0x58, 0xAF, 0x87, 0x16, 0x7A, 0xB4, 0x01, 0xE8, 
-0x4D, 0xBC, 0x15, 0xA6, 0x6A, 0x75, 0x6A, 0x2F, 0xCC, 0x16, 0x9C, 0xCE, 0x64, 0x9C, 0x4A, 0x68, 
-0x39, 0x91, 0xB1, 0x7A, 0xC7, 0x57, 0x12, 0x9C, 0x93, 0x33, 0xF3, 0x3B, 0x15, 0xC6, 0x91, 0xDB, 
-0x00, 0xF2, 0xE8, 0xF0, 0xE8, 0xE9, 0xA1, 0x11, 0xCC, 0xC5, 0x71, 0x25, 0x41, 0xA6, 0x48, 0x96, 
-0x7D, 0x2C, 0xB2, 0x1A, 0x04, 0x1D, 0x49, 0x9C, 0xF0, 0xC0, 0x79, 0x47, 0xCC, 0x80, 0x80, 0x5B, 
-0x59, 0xE5, 0x52, 0xE1, 0x9B, 0x14, 0xE5, 0x8D, 0xBC, 0x7C, 0x1D, 0xB2, 0x7D, 0x94, 0x27, 0x49, 
-0xD6, 0xFE, 0x1D, 0xF5, 0xEA, 0x58, 0x00, 0x39, 0xA0, 0x80, 0x39, 0x09, 0xAB, 0xFB, 0xC8, 0x0F, 
-0x91, 0x9F, 0x58, 0x7E, 0x26, 0xE1, 0xD9, 0x95, 0x7A, 0x89, 0xCF, 0xA0, 0x0B, 0x3C, 0x7A, 0x77, 
-0x8E, 0x2A, 0x5D, 0xA6, 0x89, 0xE7, 0x27, 0x10, 0xBA, 0x40, 0xD8, 0xB1, 0x0E, 0xA8, 0xC4, 0xC5, 
-0x4E, 0xE0, 0x6F, 0x42, 0xC3, 0x4F, 0xE9, 0x0E, 0x5A, 0x75, 0x71, 0xAD, 0x46, 0x5C, 0x2F, 0xF0, 
-0x7B, 0x96, 0xA4, 0xFE, 0xFA, 0xDE, 0x10, 0xAB, 0x42, 0xD4, 0x85, 0x3A, 0x12, 0x64, 0xD6, 0x22, 
-0xCF, 0x90, 0x89, 0x00, 0xA8, 0x72, 0x4F, 0x17, 0x20, 0x29, 0x59, 0x5A, 0x87, 0xE0, 0x89, 0xE3, 
-0xA6, 0xFE, 0x8D, 0xCC, 0x01, 0x32, 0xD2, 0xEA, 0x6C, 0x85, 0x97, 0xCE, 0x0C, 0x98, 0x63, 0x6B, 
-0x3E, 0x9E, 0x9A, 0x63, 0x73, 0x72, 0x72, 0xA4, 0x01, 0xB0, 0x96, 0xC5, 0x2B, 0x21, 0xDC, 0x83, 
-0x03, 0x66, 0x08, 0xD6, 0xF8, 0x43, 0x4D, 0x84, 0x26, 0xED, 0x3A, 0x89, 0xB0, 0x71, 0xF6, 0x2A, 
-0x15, 0xD4, 0x74, 0xED, 0xE6, 0xF3, 0x71, 0xFE, 0x0F, 0x14, 0xCE, 0x4C, 0x99, 0xE7, 0x32, 0xD0, 
-0x31, 0xC8, 0x12, 0x55, 0x83, 0x7B, 0xC7, 0xF3, 0x98, 0xBA, 0x62, 0x8E, 0x8B, 0x75, 0xA2, 0xEA, 
-0xD0, 0x8B, 0xA3, 0x3D, 0x1A, 0xEA, 0x14, 0x33, 0x66, 0xAB, 0x20, 0x8B, 0x47, 0x50, 0xAC, 0x33, 
-0xA1, 0xA6, 0x02, 0x4F, 0xC6, 0x6D, 0x9F, 0x9C, 0x1A, 0x5E, 0x35, 0x05, 0x74, 0x22, 0x33, 0x3B, 
-0x7B, 0xBA, 0x76, 0x76, 0x7E, 0x00, 0xB8, 0x16, 0x73, 0xAD, 0xBA, 0x54, 0x71, 0x4D, 0x99, 0xE8, 
-0x49, 0xD7, 0xC0, 0xB3, 0x65, 0x8F, 0xC1, 0x55, 0xB0, 0x17, 0x0A, 0x06, 0xE9, 0x3B, 0x08, 0x95, 
-0x6F, 0xAD, 0xA7, 0x5E, 0x95, 0xC5, 0x92, 0x3D, 0x9B, 0x8F, 0x92, 0x60, 0x14, 0x5A, 0xD5, 0x5A, 
-0xC8, 0x34, 0x2B, 0x74, 0x71, 0xE3, 0x89, 0xC4, 0x0E, 0x73, 0x59, 0x21, 0xE7, 0x54, 0x9C, 0xB6, 
-0x51, 0xD1, 0xB2, 0xD5, 0x03, 0x4B, 0x81, 0x4B, 0x0A, 0xFB, 0x6A, 0xAE, 0xCE, 0x16, 0x92, 0x81, 
-0x74, 0x42, 0xC0, 0x0A, 0xD7, 0x18, 0x38, 0x20, 0x74, 0xB7, 0xE6, 0x89, 0xF0, 0x5D, 0x81, 0x6C, 
-0x6B, 0x5C, 0x68, 0x46, 0x95, 0x08, 0xF8, 0xF3, 0x27, 0x7A, 0xBF, 0x8E, 0x1D, 0x88, 0x76, 0x78, 
-0x4D, 0x29, 0x07, 0x0D, 0x81, 0x34, 0xD7, 0x47, 0xE8, 0x20, 0x01, 0x66, 0x23, 0x9C, 0x35, 0x1D, 
-0x4D, 0x4F, 0x4C, 0x70, 0x82, 0x71, 0xE9, 0x8B, 0x12, 0xA7, 0x9C, 0xEC, 0xAA, 0x44, 0x58, 0xC5, 
-0x52, 0x9A, 0x93, 0xB3, 0xA6, 0xA5, 0x94, 0x0D, 0x3D, 0x10, 0xCE, 0xAE, 0xDB, 0xF9, 0xAA, 0x2D, 
-0xF9, 0x75, 0x8F, 0x43, 0x06, 0xF7, 0x07, 0x99, 0x8D, 0xD0, 0x3B, 0x3F, 0x2D, 0x11, 0xC1, 0xDC, 
-0xA0, 0x64, 0xE7, 0x04, 0xF0, 0x14, 0xB0, 0x9D, 0x6C, 0x65, 0x27, 0x88, 0x31, 0x28, 0xD6, 0xC1, 
-0x07, 0xDA, 0x10, 0xA7, 0x32, 0x76, 0xF6, 0x35, 0x80, 0xE1, 0xFF, 0x7D, 0x64, 0xA0, 0x90, 0x12, 
-0xB6, 0x6A, 0x6F, 0x04, 0xE3, 0x38, 0x5B, 0xE8, 0xF4, 0x1A, 0x3C, 0x5C, 0xE8, 0x95, 0x7B, 0xD1, 
-0x38, 0x6A, 0x70, 0x5B, 0xA1, 0xD5, 0x6D, 0x59, 0xAB, 0xAB, 0x6C, 0x2C, 0x8B, 0x8D, 0x63, 0x1A, 
-0x2C, 0x07, 0xDC, 0x01, 0xDC, 0x52, 0x9A, 0x0E, 0xC8, 0x36, 0xA6, 0x6B, 0x71, 0x67, 0xE2, 0x26, 
-0xC9, 0x40, 0xBF, 0x36, 0xF0, 0x6D, 0x98, 0x64, 0x31, 0x15, 0x93, 0x57, 0x7E, 0xC2, 0x66, 0xC9, 
-0x7C, 0xEA, 0xE1, 0x0C, 0xF4, 0x9A, 0x12, 0x77, 0x4B, 0xDD, 0x4F, 0xB5, 0x35, 0x40, 0x7C, 0xBA, 
-0xBE, 0x68, 0x41, 0xBF, 0x7A, 0xE0, 0x71, 0x4B, 0x9C, 0x0E, 0x9A, 0x03, 0x7F, 0x9A, 0xB5, 0x47, 
-0x8A, 0x45, 0x09, 0xCD, 0xAE, 0x6A, 0xDD, 0x29, 0xD6, 0xBF, 0x75, 0xF4, 0x51, 0x9F, 0x04, 0x7D, 
-0xD0, 0x7C, 0x23, 0xA6, 0xC2, 0xA0, 0x73, 0x70, 0xFC, 0x19, 0xA3, 0x7F, 0x40, 0xE6, 0xBF, 0xDE, 
-0x53, 0xD7, 0x5F, 0xFB, 0x2E, 0xB9, 0xE6, 0x41, 0x40, 0x73, 0x42, 0x07, 0x24, 0xCF, 0xF1, 0x9B, 
-0x9A, 0x6E, 0x07, 0x6E, 0x79, 0xA1, 0xD4, 0x4C, 0xF3, 0x66, 0xFB, 0x95, 0x9D, 0x9D, 0xC2, 0x48, 
-0xDA, 0xA6, 0xDE, 0x20, 0x4B, 0xB3, 0x2C, 0x1B, 0xE5, 0x24, 0x52, 0xE9, 0x08, 0x82, 0x30, 0x38, 
-0xE8, 0xC1, 0x48, 0x42, 0x09, 0xDE, 0xCD, 0x3A, 0xC0, 0x08, 0x6C, 0xEB, 0x7B, 0x1E, 0x0D, 0x75, 
-0x5A, 0xE5, 0x0D, 0x75, 0x81, 0x3F, 0x99, 0x07, 0x74, 0xFD, 0xD7, 0x9F, 0x58, 0x54, 0x25, 0xEB, 
-0x0E, 0xAF, 0x28, 0x62, 0x04, 0xD4, 0x59, 0x6B, 0x3D, 0x52, 0x67, 0x05, 0x9A, 0x3E, 0x4B, 0x25, 
-0x40, 0x62, 0x8E, 0x6D, 0x63, 0x21, 0x59, 0x08, 0x50, 0xF2, 0x70, 0xF7, 0x44, 0xBA, 0x2B, 0x4C, 
-0xD1, 0x5C, 0x2E, 0x9D, 0x13, 0xAD, 0xE9, 0x87, 0x55, 0xB4, 0xCF, 0x54, 0x8A, 0x18, 0x1A, 0x9E, 
-0x06, 0x88, 0x27, 0xE6, 0x87, 0x40, 0xA7, 0x5B, 0x13, 0x73, 0x7E, 0xA4, 0xD0, 0x55, 0x35, 0xC5, 
-0x6F, 0x58, 0x36, 0x2A, 0x7E, 0xA1, 0xFA, 0xAC, 0xA6, 0xD7, 0x71, 0x80, 0x6B, 0x6D, 0xEA, 0x08, 
-0x70, 0x0D, 0x21, 0x08, 0x04, 0x20, 0x25, 0xF9, 0x81, 0x49, 0xD0, 0x2C, 0x84, 0x2D, 0x5C, 0x7D, 
-0x7E, 0x2E, 0x56, 0x20, 0x37, 0x54, 0x10, 0x67, 0xBD, 0xE1, 0x50, 0xC7, 0x2C, 0x6A, 0x1A, 0x31, 
-0x5A, 0xC8, 0xC1, 0x18, 0x5D, 0x37, 0x63, 0x09, 0x41, 0x4C, 0xE9, 0x6E, 0x1E, 0xE8, 0xCA, 0xB7, 
-0x4B, 0x8E, 0x06, 0x33, 0xB5, 0x01, 0x2B, 0xD8, 0xD0, 0x0F, 0xE8, 0x3F, 0x38, 0x41, 0x99, 0x6F, 
-0x12, 0xEB, 0x63, 0x9C, 0x14, 0x04, 0xE4, 0x3B, 0xF4, 0x2A, 0xC6, 0xC2, 0x69, 0x3A, 0x19, 0x83, 
-0x13, 0x82, 0xC9, 0x03, 0x9B, 0xA5, 0x48, 0xCC, 0x29, 0x9F, 0xBC, 0xAC, 0x26, 0x7A, 0xA0, 0xF4, 
-0xD1, 0xF8, 0x80, 0x1E, 0x16, 0xD0, 0xC3, 0xA2, 0xE8, 0x61, 0x0E, 0xED, 0x5A, 0xE0, 0xB6, 0x13, 
-0x7B, 0x76, 0xF2, 0x54, 0x3D, 0xCC, 0xA0, 0x07, 0xBB, 0xE8, 0xC1, 0x9E, 0xB1, 0xE4, 0xC7, 0x02, 
-0xFE, 0xB3, 0x58, 0x0F, 0xB6, 0xBA, 0x87, 0x27, 0x66, 0xB1, 0x86, 0xAF, 0xDA, 0x8B, 0x95, 0x9E, 
-0x93, 0x76, 0x8B, 0xA7, 0xA6, 0xDD, 0x29, 0xB4, 0x7B, 0x8A, 0xA4, 0x13, 0x1D, 0x9C, 0x3C, 0x3B, 
-0xE9, 0x66, 0x5D, 0xA4, 0x03, 0x02, 0xC8, 0xC2, 0xDB, 0x74, 0xB7, 0x72, 0xBF, 0xDB, 0x6C, 0xA6, 
-0x33, 0x8A, 0x54, 0xC7, 0x6C, 0xD1, 0x62, 0x29, 0x0E, 0x9A, 0xE8, 0x97, 0x6E, 0xB1, 0xF4, 0x6D, 
-0xAB, 0x53, 0x6F, 0xCF, 0xB4, 0x31, 0xDE, 0x4C, 0x11, 0x10, 0xD4, 0xF2, 0xD8, 0x98, 0xC2, 0x9E, 
-0xF1, 0x3C, 0xB6, 0x59, 0xE6, 0xB1, 0xD9, 0x9F, 0x89, 0x75, 0x34, 0xC6, 0xD5, 0x78, 0x78, 0x9F, 
-0x95, 0x33, 0xE6, 0x72, 0x09, 0x4D, 0xF4, 0xD9, 0x5C, 0x65, 0xA1, 0x5E, 0x93, 0xA1, 0x4E, 0x29, 
-0xF0, 0xC5, 0x35, 0x6E, 0xB6, 0xF2, 0x5D, 0x63, 0x45, 0x3F, 0xFB, 0x34, 0x06, 0x6F, 0x76, 0x26, 
-0x12, 0xEB, 0x36, 0x90, 0x16, 0xC0, 0x2A, 0x47, 0xD1, 0x5D, 0xFA, 0x30, 0x7B, 0x5C, 0xE6, 0x58, 
-0x0E, 0x91, 0xD2, 0x87, 0xCE, 0x42, 0xF0, 0xC9, 0xB4, 0xC6, 0xF2, 0x8E, 0x7E, 0x24, 0xAB, 0x91, 
-0x62, 0x26, 0x11, 0xAB, 0xF6, 0x70, 0xDA, 0x1A, 0x98, 0x0A, 0x30, 0xD4, 0x91, 0x28, 0x1B, 0x1F, 
-0xBE, 0x3B, 0xD2, 0xF0, 0xD1, 0x58, 0xE0, 0xCB, 0xDC, 0x2D, 0xB5, 0x0F, 0x25, 0x65, 0x57, 0x67, 
-0x35, 0xF9, 0x68, 0x74, 0xA1, 0x98, 0x1E, 0x15, 0x92, 0xB5, 0xD0, 0x86, 0xBB, 0xCD, 0x27, 0xF5, 
-0xFC, 0x62, 0xAB, 0xF7, 0xD6, 0x46, 0x16, 0x16, 0xCB, 0x8A, 0xC9, 0x21, 0x9E, 0x54, 0xEF, 0x96, 
-0xC2, 0x66, 0xEC, 0xFD, 0xEC, 0x5E, 0x6A, 0x2D, 0x31, 0x6E, 0x6B, 0x33, 0xBC, 0xB7, 0x5B, 0x5F, 
-0x76, 0x24, 0xEA, 0x2C, 0xC5, 0x32, 0x41, 0xF6, 0x22, 0xE7, 0x1A, 0xD9, 0x10, 0x34, 0xC2, 0xFF, 
-0x27, 0xF1, 0x69, 0x4B, 0xB2, 0x3F, 0x8B, 0x97, 0x64, 0x34, 0x52, 0x1D, 0xDC, 0x51, 0x6A, 0xDE, 
-0x17, 0x6C, 0x66, 0x37, 0xB4, 0x7B, 0xCE, 0x66, 0xCD, 0x27, 0xB5, 0x64, 0x91, 0xD2, 0x36, 0x8D, 
-0x95, 0x79, 0x94, 0xA6, 0x35, 0x3A, 0x6D, 0xB0, 0x55, 0x35, 0x69, 0xB2, 0xC5, 0x37, 0x5E, 0x62, 
-0x32, 0xE5, 0x01, 0x37, 0x68, 0x26, 0x23, 0xCA, 0xD2, 0xFE, 0x99, 0x13, 0x51, 0xBD, 0x8E, 0x56, 
-0x84, 0x00, 0xB9, 0xB9, 0x9E, 0x42, 0x29, 0xD2, 0x08, 0x23, 0xC3, 0x9E, 0x43, 0x09, 0xFC, 0xBF, 
-0x70, 0xA8, 0x8F, 0x7E, 0xA8, 0x26, 0x6D, 0xA5, 0x60, 0x71, 0xAE, 0x6F, 0x0A, 0xBB, 0x32, 0xCB, 
-0x66, 0x26, 0x76, 0xB5, 0x21, 0x4B, 0x93, 0xA7, 0x51, 0x6B, 0xD8, 0xA7, 0x5E, 0x3D, 0x71, 0x80, 
-0x38, 0xC8, 0x53, 0x61, 0x0B, 0x4D, 0xCE, 0xEE, 0x59, 0xE7, 0xAF, 0x3A, 0x73, 0x8D, 0xCF, 0x3F, 
-0x97, 0xD5, 0x41, 0xA1, 0xEE, 0xC9, 0xAC, 0x16, 0xB4, 0x3D, 0x6E, 0x0A, 0xAB, 0x82, 0x9C, 0x62, 
-0x45, 0x50, 0x5B, 0x3E, 0xF9, 0xAB, 0x4C, 0x68, 0x49, 0x23, 0x64, 0x09, 0xB5, 0xFA, 0xE8, 0x5A, 
-0xEC, 0x03, 0xDE, 0x31, 0x3C, 0x1F, 0x5F, 0x02, 0x61, 0x9A, 0x00, 0x06, 0x9A, 0xED, 0xC2, 0x7A, 
-0x19, 0x36, 0x61, 0x60, 0x6B, 0xAD, 0x2A, 0x9B, 0x3B, 0x46, 0xF9, 0xD8, 0x3F, 0x43, 0xB7, 0x8B, 
-0xD6, 0x5E, 0xD9, 0xBA, 0xC4, 0x03, 0x73, 0xAC, 0xED, 0x09, 0xFF, 0xFE, 0x84, 0x66, 0x0F, 0x2B, 
-0xDA, 0x28, 0xDB, 0xEF, 0x69, 0xEC, 0x36, 0x26, 0xA1, 0x14, 0x29, 0xDD, 0x85, 0x0C, 0x92, 0x10, 
-0x29, 0x6E, 0x37, 0x66, 0xAD, 0x23, 0x56, 0xAD, 0x3F, 0xD0, 0x46, 0x0D, 0xE5, 0x0C, 0xCC, 0x89, 
-0xF0, 0xD6, 0xD4, 0x4E, 0xB4, 0xDD, 0x7F, 0xA9, 0xB2, 0xEC, 0x8B, 0x28, 0x67, 0x75, 0x54, 0x59, 
-0x2B, 0xB5, 0x63, 0x7E, 0xD0, 0x2C, 0x4D, 0x8B, 0x7C, 0xD6, 0x88, 0x3A, 0x3F, 0x6C, 0x16, 0x07, 
-0xAF, 0x6A, 0x80, 0x80, 0x39, 0x73, 0xF0, 0x64, 0x0F, 0xF1, 0xF5, 0xAB, 0x6A, 0x9D, 0xCD, 0xB9, 
-0xA2, 0xFB, 0x8C, 0xDE, 0x73, 0x23, 0x8E, 0xB1, 0x35, 0x3A, 0xBD, 0x63, 0x01, 0x06, 0x58, 0x63, 
-0x54, 0x1D, 0xAA, 0x68, 0x5F, 0x76, 0xB1, 0x15, 0xD3, 0x23, 0x2D, 0xCB, 0x2F, 0xC0, 0x05, 0x43, 
-0x0F, 0x0C, 0x1D, 0x30, 0x16, 0x27, 0x8F, 0xC5, 0x43, 0xC6, 0x31, 0x75, 0xD0, 0x4F, 0xD4, 0xA0, 
-0x37, 0x94, 0xF4, 0x21, 0xAB, 0x72, 0x5B, 0x87, 0xC2, 0xD7, 0xF4, 0x1D, 0xDA, 0x69, 0x9F, 0x05, 
-0x2C, 0x8F, 0x42, 0xD2, 0xA2, 0x05, 0x49, 0x56, 0x0F, 0xFA, 0x76, 0xAF, 0xFC, 0xED, 0xA1, 0x7D, 
-0xAA, 0x8B, 0x7F, 0x5B, 0x8C, 0x41, 0x73, 0x8D, 0x65, 0x0F, 0x65, 0x81, 0x0E, 0xC9, 0xB4, 0x75, 
-0x7E, 0xF8, 0x49, 0x02, 0x9A, 0x16, 0x66, 0xD6, 0xAB, 0x17, 0x7D, 0xA4, 0x71, 0x90, 0x8A, 0x68, 
-0x78, 0x3F, 0x0A, 0x35, 0x3D, 0x6F, 0x38, 0x01, 0x59, 0x9C, 0x60, 0xE7, 0x22, 0x03, 0xF7, 0x6C, 
-0x1A, 0x24, 0x8F, 0xAE, 0xE7, 0xB5, 0x54, 0x88, 0x1C, 0x2C, 0xC9, 0x19, 0x11, 0x61, 0x44, 0x58, 
-0x4C, 0x52, 0xC7, 0x9B, 0x8A, 0x2B, 0x94, 0xEB, 0x98, 0x35, 0xB3, 0x7D, 0x76, 0x39, 0xDB, 0x67, 
-0x4D, 0xCC, 0x0E, 0xC8, 0x11, 0xDE, 0xA9, 0xD9, 0x0A, 0xF9, 0xBC, 0xCD, 0xAF, 0x45, 0xD8, 0x94, 
-0x0B, 0x30, 0xD4, 0xC0, 0x99, 0xD5, 0x79, 0xC8, 0x9E, 0x0A, 0xEA, 0x31, 0xCB, 0xDC, 0xFB, 0x32, 
-0xF8, 0xA1, 0xD4, 0x9C, 0x1E, 0x08, 0xBB, 0x7A, 0x1D, 0xFA, 0xC1, 0xA4, 0x98, 0xE9, 0x32, 0x94, 
-0x7D, 0x17, 0x01, 0xBF, 0x58, 0xD3, 0xB5, 0xBD, 0xB6, 0xBB, 0x92, 0x73, 0x50, 0xCC, 0x75, 0x5C, 
-0x47, 0x29, 0xCB, 0x2F, 0x3C, 0xD7, 0x3E, 0xB1, 0x4F, 0x74, 0xDA, 0x88, 0x29, 0xDA, 0xAE, 0xE5, 
-0x06, 0x8D, 0xE7, 0x07, 0x79, 0x81, 0x0D, 0x87, 0xA1, 0x65, 0x79, 0x8D, 0x1C, 0xFE, 0xE8, 0x24, 
-0xAD, 0x41, 0xB9, 0xDE, 0x18, 0x3D, 0x5D, 0x5B, 0x9E, 0xE5, 0x29, 0x87, 0x9B, 0x63, 0xEC, 0xEC, 
-0xCC, 0x5A, 0x59, 0x2B, 0x35, 0x36, 0xF9, 0x12, 0x69, 0xB5, 0x84, 0xD5, 0x60, 0x98, 0x24, 0xDB, 
-0xE8, 0x56, 0xE7, 0xB2, 0xAF, 0x82, 0xC8, 0xFD, 0xA4, 0xCF, 0x17, 0x00, 0x4D, 0xE9, 0x9B, 0xE8, 
-0x36, 0xE4, 0x6A, 0x4E, 0x9E, 0xA4, 0x57, 0xE6, 0x08, 0x8A, 0x2A, 0x92, 0xBB, 0x1E, 0x47, 0x72, 
-0xB8, 0x82, 0x97, 0x6A, 0xED, 0x56, 0x7E, 0x69, 0xD4, 0x14, 0x8A, 0x59, 0xEB, 0xB6, 0x2B, 0xA9, 
-0x1C, 0xD8, 0xD7, 0x3A, 0xB2, 0xFA, 0x76, 0x24, 0xBF, 0xAD, 0xAB, 0x5E, 0x04, 0xC2, 0x43, 0xD5, 
-0xCA, 0xFB, 0x05, 0x07, 0xCE, 0x92, 0x32, 0x3D, 0xDE, 0x74, 0xD9, 0xE3, 0x3C, 0x53, 0xD4, 0xA5, 
-0xE0, 0xB5, 0xEF, 0xCF, 0xF4, 0x70, 0x00, 0x50, 0xE4, 0x9A, 0xB9, 0xFE, 0x2A, 0x93, 0x56, 0x32, 
-0x4B, 0x1A, 0xD1, 0x9F, 0xCC, 0x1F, 0x1E, 0x54, 0x34, 0x7C, 0x8F, 0x07, 0x84, 0x09, 0x0F, 0x88, 
-0xFD, 0x14, 0x3E, 0xC0, 0xEC, 0xE1, 0x4E, 0x40, 0x6D, 0x75, 0x4B, 0xB1, 0x66, 0xB1, 0x36, 0xFB, 
-0xA0, 0x5E, 0xB6, 0x78, 0x98, 0x21, 0x3F, 0xE0, 0xD5, 0xA4, 0xD6, 0xE5, 0x03, 0xAA, 0xF7, 0x39, 
-0xDB, 0xE3, 0x5F, 0xBD, 0xB3, 0xD0, 0x1B, 0xE2, 0x83, 0x0C, 0xFD, 0x61, 0x06, 0xF2, 0xB0, 0xF7, 
-0xC7, 0x0E, 0x67, 0xB7, 0xC3, 0x60, 0xE8, 0xFB, 0xDA, 0x58, 0xAB, 0xD6, 0xE7, 0xEF, 0x8A, 0xA9, 
-0x15, 0x2D, 0xDB, 0xAF, 0x88, 0x8C, 0xE4, 0x79, 0x42, 0x79, 0x05, 0x8F, 0x76, 0x16, 0x09, 0xAF, 
-0x42, 0x01, 0x4C, 0x6D, 0xA5, 0x02, 0x90, 0x36, 0x76, 0xD2, 0x67, 0xE3, 0xF0, 0xAA, 0xB9, 0xE3, 
-0x27, 0x4D, 0x51, 0x94, 0x1B, 0xD3, 0x46, 0x8D, 0x72, 0x63, 0x8A, 0x96, 0xEA, 0xDF, 0x8A, 0xE5, 
-0x61, 0x17, 0xC7, 0x7C, 0x2B, 0xB2, 0x0B, 0x24, 0x90, 0x58, 0x4E, 0xE4, 0xF9, 0x37, 0x7C, 0xEF, 
-0x99, 0xE5, 0x40, 0xB7, 0xFE, 0x77, 0x40, 0x7C, 0xAF, 0xE5, 0x69, 0xB9, 0x16, 0x89, 0x35, 0x86, 
-0x65, 0x2B, 0x8B, 0x3D, 0x07, 0x79, 0xEB, 0xB5, 0x7B, 0xF8, 0xE6, 0xB9, 0xC1, 0xA7, 0x28, 0xA0, 
-0xE5, 0x38, 0xA3, 0x03, 0xFE, 0xB6, 0xC2, 0x72, 0x90, 0x1B, 0x5C, 0xE6, 0x68, 0x0C, 0xEA, 0xDB, 
-0xA6, 0x55, 0x81, 0x15, 0xEB, 0x34, 0x55, 0x4D, 0x5D, 0x5E, 0x1C, 0x43, 0x41, 0x7D, 0xD5, 0xCA, 
-0x72, 0xC4, 0xC1, 0xE5, 0x6B, 0x50, 0x2E, 0x4E, 0xE8, 0x45, 0x93, 0xC9, 0x44, 0xAA, 0x56, 0xF9, 
-0x59, 0xF9, 0xDA, 0xC0, 0x5A, 0x7D, 0xB1, 0x40, 0x15, 0x1B, 0xDF, 0x1A, 0x46, 0x75, 0xF1, 0x50, 
-0x12, 0xAD, 0x53, 0x50, 0xA9, 0xCE, 0x0D, 0xEE, 0xA7, 0x15, 0x04, 0x59, 0x92, 0xC6, 0x7C, 0xC1, 
-0xD6, 0x28, 0xA6, 0x6B, 0xA8, 0xEB, 0x71, 0x31, 0x4B, 0x48, 0x96, 0xE0, 0xFA, 0xA2, 0xD7, 0xD7, 
-0xD7, 0xE5, 0x1B, 0xFA, 0x47, 0xC4, 0x30, 0x2A, 0x2D, 0x27, 0x37, 0x9B, 0xBC, 0x7B, 0x69, 0xE9, 
-0xD1, 0x80, 0xE0, 0x56, 0x83, 0xAF, 0xA2, 0xBB, 0xE5, 0x00, 0x23, 0x76, 0x7C, 0xF5, 0x04, 0xFE, 
-0x29, 0x11, 0xCE, 0xD2, 0x02, 0xD8, 0xFA, 0x72, 0xB0, 0x76, 0x82, 0x84, 0x36, 0x90, 0x4D, 0xD7, 
-0xC9, 0x65, 0x83, 0xF3, 0x2E, 0x78, 0x24, 0xF0, 0x93, 0x08, 0x04, 0x18, 0xB9, 0xB1, 0x63, 0xBC, 
-0x81, 0x3B, 0x92, 0x58, 0xD0, 0xB1, 0xD8, 0x2F, 0x64, 0xD0, 0xAC, 0xCD, 0xA1, 0x07, 0x4D, 0x4E, 
-0xA2, 0xF5, 0x9A, 0xED, 0x98, 0x68, 0x7E, 0x87, 0xA4, 0xCF, 0x97, 0xB3, 0x2E, 0x07, 0x5C, 0xC7, 
-0x24, 0x99, 0xEB, 0x82, 0x53, 0x26, 0x14, 0xB3, 0x28, 0x21, 0x3C, 0x13, 0xA8, 0x33, 0xB1, 0x66, 
-0x83, 0xE3, 0x3E, 0xAD, 0xA3, 0x51, 0x57, 0xB5, 0x2F, 0xD4, 0x97, 0xB6, 0x7D, 0x73, 0xA1, 0x6A, 
-0x9F, 0x6F, 0x78, 0x52, 0x0E, 0x5E, 0x42, 0xD8, 0x71, 0x13, 0x63, 0x17, 0x1B, 0x5C, 0x62, 0x15, 
-0x2C, 0x07, 0x59, 0x1C, 0x8C, 0x5E, 0x14, 0x78, 0x82, 0x1E, 0x0B, 0xA5, 0x8E, 0xE4, 0x28, 0xA6, 
-0x6D, 0xC6, 0x33, 0xF3, 0x48, 0x81, 0xB6, 0x72, 0xC3, 0x1E, 0xCB, 0x32, 0x51, 0x91, 0xB9, 0xA7, 
-0xA6, 0x61, 0x2D, 0x4C, 0x62, 0x4F, 0x4D, 0xC3, 0xB6, 0x4D, 0x32, 0x3D, 0x81, 0xCF, 0x13, 0x96, 
-0xA5, 0x31, 0x66, 0x10, 0xE9, 0x9C, 0xC1, 0x63, 0xF8, 0xB4, 0x4F, 0xCD, 0x6B, 0x51, 0x83, 0x88, 
-0xCF, 0xCF, 0x03, 0xA2, 0x1A, 0x59, 0xD1, 0xC1, 0x1C, 0x4A, 0xD9, 0xA6, 0x3B, 0x83, 0x06, 0x6C, 
-0x0C, 0x99, 0xE0, 0x13, 0x6E, 0xD9, 0x33, 0xDE, 0x1F, 0xB6, 0x3F, 0xC5, 0x79, 0x1A, 0xF8, 0x09, 
-0xAC, 0x65, 0x41, 0xFB, 0xBC, 0x02, 0xE1, 0x1F, 0xD0, 0x7A, 0x05, 0x8B, 0x67, 0x32, 0x12, 0x2F, 
-0x8E, 0x37, 0x55, 0xF9, 0x02, 0x36, 0x96, 0x94, 0x47, 0x55, 0xA6, 0xAA, 0xBE, 0xA2, 0xCC, 0x9B, 
-0x2B, 0xF6, 0xF2, 0xB6, 0xA4, 0xB8, 0x8A, 0xB7, 0x56, 0x6B, 0x0A, 0xAB, 0x72, 0x97, 0x09, 0x01, 
-0x4B, 0x91, 0x2F, 0x07, 0x1F, 0xB9, 0x0F, 0xCA, 0x0A, 0xA9, 0x30, 0x5E, 0x11, 0xB1, 0xF2, 0x15, 
-0x58, 0x49, 0xBA, 0xEC, 0x19, 0xFC, 0x1D, 0x08, 0x0A, 0xA3, 0xC2, 0x42, 0x46, 0x8A, 0xA3, 0x4F, 
-0x20, 0x51, 0xE0, 0x15, 0xA1, 0x2F, 0xF8, 0x1A, 0xF9, 0x2B, 0xBF, 0xCB, 0x0D, 0xD1, 0x72, 0x60, 
-0xEB, 0x04, 0x03, 0x15, 0x86, 0xD8, 0x7F, 0x90, 0xF8, 0xE1, 0xEF, 0xD4, 0x4D, 0x41, 0x29, 0xAC, 
-0xEE, 0xC9, 0x7F, 0x5F, 0xD7, 0xC4, 0x5F, 0x83, 0x40, 0x7E, 0x8B, 0x63, 0xA6, 0xA1, 0xC5, 0xF4, 
-0x68, 0x46, 0xDB, 0x37, 0x20, 0x71, 0x84, 0x7A, 0x20, 0xA6, 0x1B, 0x3F, 0xAA, 0x21, 0x2A, 0xA0, 
-0xDE, 0xEA, 0x1E, 0x55, 0xE6, 0x86, 0xAD, 0x0B, 0x75, 0xD0, 0x1E, 0xB6, 0x68, 0xE5, 0xCA, 0x9A, 
-0x05, 0x15, 0x52, 0xE5, 0x92, 0x38, 0xB7, 0x28, 0xE9, 0x26, 0x95, 0x2A, 0xAA, 0x21, 0xE8, 0x65, 
-0x0A, 0xF2, 0xC2, 0xDD, 0x24, 0x94, 0xA7, 0x63, 0xB0, 0x16, 0x80, 0x2E, 0x5C, 0x99, 0xA9, 0xC2, 
-0x51, 0x51, 0xED, 0x6A, 0xB7, 0x8F, 0xC1, 0x62, 0x79, 0xE5, 0x0B, 0xB0, 0xDD, 0xF5, 0x90, 0x07, 
-0x04, 0xCD, 0xE6, 0xA0, 0xDB, 0xF8, 0x34, 0x15, 0xFF, 0xAE, 0xE2, 0x83, 0xBB, 0x5D, 0x10, 0xC2, 
-0xC8, 0xB6, 0x69, 0xBA, 0x3F, 0x3F, 0x3E, 0xBE, 0xBD, 0xBD, 0x9D, 0xDC, 0x4E, 0x27, 0x51, 0xBC, 
-0x39, 0xB6, 0x4D, 0xD3, 0x44, 0x5A, 0x3D, 0x44, 0x0D, 0xD7, 0x00, 0x2A, 0xD5, 0x80, 0x4D, 0x6C, 
-0xDB, 0x9D, 0x4D, 0xCE, 0x70, 0x8F, 0xAE, 0x33, 0x63, 0x36, 0x31, 0xA7, 0xF0, 0x71, 0xE6, 0x82, 
-0xF4, 0xC3, 0x3D, 0xE3, 0xCC, 0xB0, 0xA6, 0xEC, 0xBF, 0xEB, 0x29, 0x59, 0xE0, 0xB3, 0x29, 0xB1, 
-0xA6, 0x2E, 0x48, 0x28, 0x56, 0xE0, 0x85, 0xF1, 0xCF, 0x67, 0x35, 0xEF, 0x2A, 0xE6, 0xCF, 0xCF, 
-0x8E, 0x64, 0x26, 0x86, 0x78, 0xA6, 0xB8, 0x85, 0x5A, 0xD1, 0x75, 0xF6, 0x50, 0x13, 0x7D, 0xB7, 
-0xDA, 0xED, 0xDF, 0x21, 0x2A, 0xC8, 0xEF, 0x6B, 0x34, 0x76, 0x63, 0x64, 0xD6, 0xD4, 0x99, 0x93, 
-0x79, 0x9E, 0x73, 0x26, 0xF6, 0x13, 0x42, 0x56, 0x19, 0xEE, 0x03, 0xA0, 0xB1, 0x8C, 0xFF, 0x77, 
-0x68, 0x6C, 0xFB, 0xAF, 0x67, 0x4F, 0x07, 0x41, 0xDF, 0x5E, 0x81, 0xB1, 0x90, 0xCD, 0x27, 0x73, 
-0x63, 0x4A, 0xE0, 0x5F, 0x2B, 0x00, 0x8B, 0x83, 0x50, 0x50, 0xB1, 0x16, 0x4A, 0x93, 0xAB, 0x07, 
-0xC7, 0x60, 0xE0, 0x18, 0x5F, 0x1F, 0x1C, 0x85, 0xDA, 0xE5, 0xB7, 0x1B, 0x4E, 0x27, 0xBB, 0xBD, 
-0xB5, 0xB8, 0x8F, 0x54, 0xD3, 0xA0, 0x75, 0x43, 0x87, 0x11, 0xC3, 0xA0, 0xBA, 0xBB, 0x33, 0x38, 
-0xEA, 0x96, 0xCA, 0x48, 0xD7, 0xAA, 0xE5, 0x33, 0xF7, 0x83, 0xCB, 0xF7, 0x51, 0xE8, 0xA7, 0x51, 
-0x4C, 0x23, 0x72, 0xCF, 0xD6, 0xEE, 0x80, 0x32, 0x87, 0xD8, 0x25, 0x76, 0x48, 0x06, 0x26, 0x32, 
-0xA6, 0xAE, 0xBF, 0x43, 0x6F, 0x25, 0x22, 0x89, 0x13, 0x64, 0x1E, 0xAA, 0x9A, 0x8B, 0xE3, 0x7D, 
-0xC3, 0x77, 0xA9, 0x59, 0x09, 0x76, 0xAF, 0xA2, 0xAD, 0x6B, 0x79, 0x32, 0x6E, 0x5E, 0xEB, 0xB7, 
-0x54, 0x16, 0x14, 0xE0, 0x08, 0x37, 0x97, 0x6C, 0x9F, 0x85, 0x73, 0x8C, 0x41, 0xD8, 0x4F, 0xB8, 
-0xBF, 0x77, 0xC2, 0x4A, 0x0B, 0xDC, 0x0D, 0x87, 0xE7, 0x70, 0xBB, 0x07, 0x50, 0x2C, 0x81, 0x50, 
-0x45, 0x03, 0xDE, 0x18, 0x54, 0x50, 0xCC, 0x7F, 0x47, 0x21, 0xA0, 0x67, 0xE7, 0x83, 0xB6, 0xDE, 
-0x82, 0x77, 0x1F, 0xD0, 0x77, 0xF8, 0x6C, 0xC4, 0x96, 0x08, 0x03, 0x43, 0xE0, 0x8A, 0x01, 0x37, 
-0xDA, 0xED, 0x03, 0x9A, 0x02, 0xD7, 0x80, 0xB3, 0xD8, 0x61, 0xAC, 0xCA, 0x19, 0x7D, 0x9D, 0x65, 
-0xE2, 0x13, 0xEF, 0x6B, 0xF4, 0x30, 0xB3, 0x04, 0xC9, 0x08, 0x5E, 0x45, 0xAD, 0x36, 0x2B, 0x30, 
-0xB8, 0xFC, 0x4B, 0x92, 0x81, 0x0D, 0x00, 0x02, 0xB3, 0xDF, 0x9A, 0xC6, 0x78, 0xD4, 0xA7, 0x95, 
-0x85, 0xF4, 0x7E, 0x0F, 0x50, 0x33, 0xBC, 0xE9, 0x0B, 0x21, 0x42, 0x4A, 0x48, 0xB4, 0xC5, 0xF8, 
-0xF6, 0xE4, 0x3D, 0x0A, 0x56, 0xC7, 0xC2, 0xE0, 0x6B, 0x29, 0x5B, 0x99, 0xCF, 0x5B, 0x0E, 0xAE, 
-0xC2, 0x4D, 0x4C, 0x13, 0x87, 0xA4, 0x19, 0x04, 0x36, 0x6C, 0xF0, 0x03, 0x6D, 0xC5, 0x98, 0xFE, 
-0x23, 0xF3, 0x63, 0xEA, 0x69, 0x0B, 0x34, 0x09, 0xA7, 0x2C, 0xAA, 0x95, 0xCE, 0xA7, 0xA3, 0xF2, 
-0x1E, 0xAA, 0xDC, 0x46, 0xE8, 0x3A, 0x29, 0xA8, 0x8C, 0x4E, 0x5C, 0xEC, 0x24, 0xF4, 0x5F, 0xFF, 
-0xE3, 0x3C, 0x01, 0xA5, 0xCB, 0xAE, 0x5A, 0xA9, 0xDD, 0xA3, 0x18, 0xA7, 0x76, 0x8F, 0x82, 0x4F, 
-0x41, 0x6D, 0xB7, 0x44, 0xC2, 0x93, 0x51, 0x3C, 0xA4, 0xB7, 0x46, 0x01, 0xFE, 0x63, 0x49, 0x2F, 
-0x82, 0x08, 0x8E, 0x64, 0xAE, 0x2E, 0xEA, 0x8A, 0x19, 0x83, 0x86, 0xCB, 0xC6, 0xD6, 0xFA, 0xB2, 
-0x87, 0xCD, 0xFB, 0x40, 0x54, 0xC9, 0xBA, 0xAA, 0xD6, 0x01, 0xFF, 0xD1, 0xE8, 0xA0, 0x4C, 0x89, 
-0xA1, 0xD2, 0x72, 0x03, 0xDF, 0xFD, 0x94, 0xEB, 0xAC, 0x9F, 0x32, 0x9A, 0xA4, 0x5C, 0x71, 0x41, 
-0x50, 0xF8, 0x16, 0xB1, 0x89, 0xDB, 0xF4, 0xED, 0x22, 0x08, 0x0E, 0x6E, 0xFC, 0xD4, 0xF1, 0x22, 
-0xAD, 0xBB, 0x2F, 0x8F, 0x5B, 0xF5, 0x9E, 0x1F, 0x7F, 0x8F, 0xEE, 0xBD, 0x13, 0x82, 0xFE, 0xC6, 
-0x97, 0xD7, 0xF0, 0xF5, 0x3A, 0xB8, 0xE1, 0x24, 0x64, 0xE7, 0xF8, 0x21, 0x7B, 0x87, 0xB2, 0x7C, 
-0xAB, 0xAF, 0xD8, 0xA1, 0x1D, 0xD7, 0x3F, 0xB2, 0x9A, 0x9A, 0xD7, 0xFB, 0x58, 0xB0, 0xC4, 0x83, 
-0xAB, 0x57, 0x69, 0x6D, 0x8B, 0xDC, 0x0D, 0xCD, 0xDF, 0xC2, 0x7B, 0x75, 0x7F, 0xE5, 0x89, 0xB7, 
-0xFC, 0x2A, 0xF1, 0x99, 0xFC, 0x76, 0xDC, 0xE3, 0x5E, 0x17, 0xAC, 0xFD, 0x78, 0xD8, 0xBB, 0x83, 
-0x87, 0xBF, 0xCC, 0x97, 0xED, 0x3D, 0x08, 0xE3, 0x59, 0x27, 0x57, 0x00, 0xFE, 0x08, 0x3D, 0xFC, 
-0x31, 0x61, 0x6E, 0x7D, 0xEB, 0x44, 0x4C, 0x3D, 0xDD, 0x5B, 0xC3, 0xA0, 0x62, 0x47, 0x67, 0xC6, 
-0x24, 0xC3, 0xB1, 0xD8, 0x5F, 0x8A, 0xF5, 0xA6, 0xCE, 0xC3, 0x16, 0x44, 0xAB, 0x94, 0xD4, 0x90, 
-0xCD, 0x4F, 0xD8, 0xD6, 0x3F, 0x4B, 0xED, 0xE8, 0x45, 0x86, 0x2B, 0x69, 0x43, 0x01, 0x6F, 0x2A, 
-0xDF, 0x96, 0xA1, 0x9B, 0xF4, 0x8D, 0x5C, 0x62, 0xD7, 0x31, 0x0C, 0x1F, 0x63, 0x7F, 0xB3, 0xA1, 
-0x71, 0x65, 0xA7, 0x08, 0x31, 0x03, 0x57, 0x2B, 0x98, 0x6F, 0x5B, 0x20, 0x91, 0x8E, 0x07, 0x8D, 
-0x72, 0x17, 0x95, 0x6D, 0xAF, 0x01, 0x35, 0xCB, 0x4B, 0x45, 0xED, 0x7C, 0xC3, 0xE9, 0xBC, 0x81, 
-0x31, 0x2E, 0x63, 0xEC, 0x82, 0xB4, 0x92, 0x5E, 0x68, 0xB0, 0x22, 0x47, 0xF6, 0x21, 0xBC, 0x97, 
-0x83, 0xD0, 0xCE, 0x7E, 0x07, 0x6C, 0xC9, 0xDD, 0xDE, 0x50, 0x4D, 0xCE, 0x92, 0xBA, 0x9C, 0x8D, 
-0xC9, 0x90, 0x6D, 0xC6, 0xDE, 0x87, 0xFF, 0x19, 0xE7, 0xE3, 0xB2, 0xEB, 0x4C, 0xE6, 0x7F, 0x81, 
-0x26, 0xB1, 0x09, 0xBA, 0xD8, 0x00, 0xB7, 0xDC, 0x29, 0x17, 0xB4, 0x3D, 0x4B, 0x80, 0xA6, 0xCE, 
-0x27, 0xCA, 0x28, 0xC2, 0xDE, 0x38, 0xE6, 0x9B, 0xC0, 0xEF, 0x22, 0x8F, 0xF6, 0x1F, 0x3A, 0x1F, 
-0x30, 0x26, 0x0D, 0x7C, 0xD0, 0x95, 0x30, 0x72, 0xD6, 0x49, 0x2B, 0xF6, 0x18, 0xEE, 0xFB, 0xD5, 
-0xD3, 0xEE, 0x74, 0xFD, 0x08, 0x25, 0xF2, 0x34, 0xEF, 0x2E, 0x77, 0x90, 0x90, 0x6B, 0xBF, 0xC7, 
-0x68, 0x30, 0x41, 0x41, 0x7E, 0x60, 0x04, 0x36, 0x97, 0xBF, 0x31, 0x5E, 0xA5, 0x65, 0xFF, 0xC1, 
-0x01, 0x88, 0x0D, 0x64, 0x03, 0x9C, 0xBD, 0xB6, 0xE5, 0xED, 0xA6, 0xE6, 0x63, 0x5A, 0x6F, 0xD9, 
-0xE8, 0xB7, 0xC1, 0x0E, 0xAD, 0x5A, 0x58, 0xC6, 0x2D, 0x57, 0x03, 0x63, 0xA1, 0xC5, 0x1A, 0xDB, 
-0x56, 0x3F, 0x8F, 0x3D, 0x15, 0x89, 0xC9, 0x2B, 0xBE, 0x7F, 0xBD, 0x64, 0x6B, 0xFA, 0xEF, 0x62, 
-0xDF, 0xD0, 0x69, 0x9A, 0x41, 0x08, 0x2E, 0x79, 0x1D, 0x53, 0xDC, 0x5D, 0x1F, 0xDC, 0x37, 0xBE, 
-0x73, 0x3E, 0x4A, 0xB3, 0x5A, 0x79, 0x97, 0x90, 0x42, 0xE1, 0x2B, 0x69, 0x97, 0x7D, 0x97, 0x35, 
-0x23, 0x46, 0xFD, 0xCB, 0xF5, 0x68, 0xA8, 0xCF, 0xB5, 0x21, 0x79, 0xF1, 0x43, 0xC1, 0x1A, 0xA2, 
-0x61, 0x89, 0x29, 0x98, 0x74, 0x61, 0xAD, 0xCA, 0x8E, 0x87, 0xE5, 0x57, 0x03, 0x2A, 0xF5, 0x6F, 
-0x4B, 0x64, 0x07, 0xB1, 0xB5, 0x22, 0x3F, 0xD8, 0xBF, 0x36, 0xA6, 0x85, 0xB0, 0x2A, 0x26, 0x86, 
-0xFA, 0xD7, 0xE2, 0x19, 0x0D, 0xAC, 0x57, 0xCD, 0x3D, 0x1F, 0x5A, 0x9F, 0x27, 0x49, 0xB0, 0x15, 
-0x1B, 0xAB, 0x36, 0xEA, 0xB6, 0x9B, 0x2F, 0x41, 0xED, 0xEB, 0x5B, 0x3F, 0x75, 0xD9, 0x06, 0x1B, 
-0xA0, 0xCA, 0x99, 0x5F, 0x61, 0x5C, 0x92, 0x6B, 0x5C, 0x5C, 0xF3, 0x3E, 0x52, 0x90, 0xBB, 0x0A, 
-0xD3, 0x57, 0x39, 0xA7, 0xA0, 0x22, 0x03, 0xB2, 0x52, 0x4D, 0x32, 0xF4, 0xC8, 0x53, 0xDC, 0x04, 
-0x44, 0x77, 0x70, 0x43, 0x0E, 0xAA, 0x54, 0x73, 0x07, 0x43, 0x33, 0x62, 0x3F, 0xD1, 0xD4, 0xEC, 
-0x3A, 0xE6, 0xA4, 0x86, 0xB3, 0x77, 0xCC, 0xD0, 0xE5, 0x48, 0xBB, 0xCE, 0x0E, 0xC1, 0xD9, 0x7F, 
-0x0E, 0x50, 0xF8, 0x37, 0x39, 0x40, 0xA1, 0x85, 0x4B, 0x19, 0xAF, 0x3D, 0x8C, 0x4D, 0x91, 0xC1, 
-0x5B, 0xB8, 0xB4, 0x71, 0xA7, 0x71, 0x43, 0x0E, 0x4F, 0xF6, 0x7B, 0x1A, 0x7A, 0xAF, 0xB7, 0x7E, 
-0xE0, 0x8D, 0x44, 0x97, 0x7D, 0xCE, 0xA6, 0x42, 0x9B, 0x10, 0x50, 0x27, 0xCC, 0xF6, 0xF9, 0x99, 
-0x37, 0x5A, 0x6B, 0xD0, 0xF0, 0xD0, 0xD5, 0x32, 0x84, 0x9A, 0xA9, 0x6A, 0xDC, 0xFE, 0xF4, 0xA7, 
-0x1A, 0x06, 0xF9, 0xDA, 0xAC, 0x5F, 0xC0, 0x77, 0x3C, 0xAA, 0xDD, 0x17, 0x0E, 0x71, 0x6F, 0x24, 
-0xE6, 0x0E, 0xB4, 0x64, 0x1A, 0x40, 0x61, 0x56, 0x15, 0x00, 0x1A, 0x9F, 0x76, 0x44, 0xE3, 0xB2, 
-0xD3, 0x46, 0x14, 0xD1, 0x40, 0x95, 0x56, 0x6B, 0xE0, 0x01, 0x36, 0xF9, 0x99, 0x5C, 0xC2, 0xB1, 
-0x20, 0xA3, 0x30, 0x2A, 0xD1, 0x78, 0xF4, 0x00, 0xD5, 0x5D, 0xC5, 0xCB, 0xB3, 0x2B, 0xE2, 0x56, 
-0x85, 0xA8, 0x87, 0xE4, 0x3F, 0xEA, 0xED, 0xDF, 0x40, 0xBD, 0x69, 0x37, 0x3D, 0xAA, 0xEC, 0xFB, 
-0x72, 0xCC, 0x37, 0x32, 0x2A, 0x93, 0x04, 0x85, 0x23, 0x8D, 0xAF, 0xE7, 0x82, 0x59, 0x14, 0x81, 
-0xFA, 0x7F, 0x89, 0x4D, 0xE5, 0x70, 0xD7, 0xC8, 0xD0, 0xB9, 0xF1, 0x37, 0x28, 0x0A, 0x6B, 0x27, 
-0x01, 0xA5, 0xD2, 0x74, 0xC1, 0xF3, 0x02, 0x7F, 0xF3, 0xD3, 0x6D, 0xB9, 0xF3, 0xE4, 0x28, 0x8B, 
-0x03, 0x59, 0x26, 0xD4, 0xA7, 0xF4, 0xA1, 0xA1, 0xC6, 0xBE, 0x1D, 0xE5, 0x6E, 0x95, 0x49, 0x44, 
-0x30, 0x93, 0x9E, 0x90, 0x4F, 0x21, 0x94, 0x49, 0xA2, 0x1D, 0xE5, 0x87, 0x5F, 0xFA, 0x09, 0xD9, 
-0x32, 0x3D, 0x09, 0x3F, 0x34, 0xCE, 0xEE, 0x13, 0x26, 0x4D, 0xCA, 0x46, 0x05, 0x58, 0x2D, 0x6D, 
-0x56, 0x16, 0x65, 0xE9, 0x36, 0xC0, 0x12, 0xBD, 0x1C, 0x1D, 0x96, 0x56, 0xC9, 0x6B, 0xF3, 0xB6, 
-0x8F, 0x04, 0x28, 0xE2, 0x70, 0x35, 0xB1, 0xC6, 0x0B, 0xE5, 0x19, 0xDF, 0x7B, 0x1C, 0x2A, 0xFC, 
-0x4C, 0x71, 0xEE, 0xA7, 0xC3, 0x8F, 0x6A, 0xE1, 0x87, 0xA3, 0x61, 0xD0, 0x20, 0x6D, 0xEA, 0x36, 
-0x82, 0x3E, 0xF8, 0x99, 0x9B, 0x77, 0x00, 0x50, 0xA2, 0x56, 0x7A, 0x07, 0x1C, 0x56, 0x39, 0xAC, 
-0xEE, 0x02, 0xA7, 0x74, 0x80, 0x39, 0x07, 0xC4, 0x68, 0xB2, 0xF8, 0xF1, 0x6C, 0x40, 0xF4, 0x2A, 
-0x8F, 0x52, 0xD0, 0x6A, 0x24, 0x09, 0x81, 0xDC, 0x7E, 0x85, 0x01, 0xF3, 0xEB, 0x90, 0x43, 0xD6, 
-0xC4, 0x89, 0x6E, 0x18, 0xC8, 0x63, 0xB9, 0x09, 0xEE, 0xE0, 0x06, 0x28, 0x03, 0x5E, 0x55, 0x9B, 
-0x13, 0xBB, 0xB1, 0x0E, 0xBB, 0xED, 0x40, 0x24, 0x3C, 0x59, 0xCF, 0x09, 0x02, 0x8C, 0x80, 0xF9, 
-0x79, 0xAA, 0xF8, 0xEA, 0x69, 0x2E, 0x1F, 0x6C, 0x37, 0xD6, 0x10, 0x4F, 0x6F, 0x25, 0x6C, 0x92, 
-0x4E, 0xC9, 0x5F, 0x95, 0xE3, 0x94, 0x2A, 0x9B, 0xB8, 0xB2, 0x3B, 0xAA, 0xA3, 0x94, 0x0E, 0x19, 
-0x92, 0x4E, 0x23, 0x48, 0x3B, 0x9D, 0xF1, 0x34, 0x79, 0x9C, 0x34, 0xE5, 0xBC, 0x39, 0xE9, 0x27, 
-0xA1, 0x80, 0xDD, 0x9C, 0x88, 0x03, 0x99, 0xDE, 0xD0, 0xB5, 0x93, 0x05, 0xA9, 0xEC, 0x04, 0x28, 
-0xA2, 0xE7, 0x7C, 0xA2, 0xAC, 0x4D, 0xA6, 0xF2, 0x32, 0xC3, 0xA3, 0xC9, 0x8D, 0x13, 0x64, 0xD2, 
-0x62, 0x66, 0xDE, 0x4E, 0x3E, 0x87, 0xD1, 0x2E, 0x9B, 0xBC, 0x8C, 0xBA, 0x1D, 0x39, 0xE1, 0xF8, 
-0xB3, 0xEF, 0xB1, 0xE3, 0x76, 0xD9, 0x21, 0x53, 0x7E, 0x94, 0x25, 0x9C, 0x12, 0xF5, 0x0C, 0xCC, 
-0x16, 0x0A, 0xB1, 0xF9, 0xD8, 0xD6, 0xA1, 0x42, 0x6B, 0xAF, 0x9C, 0xC4, 0x77, 0x09, 0x74, 0xEB, 
-0x7B, 0x4D, 0xA7, 0x0C, 0x65, 0xEA, 0xDB, 0x02, 0x13, 0xFF, 0xFC, 0x27, 0xF9, 0x36, 0x07, 0x55, 
-0xC5, 0x68, 0xA8, 0xAB, 0x79, 0x9F, 0xC3, 0x0F, 0x20, 0xC0, 0x6B, 0xE7, 0x86, 0x1D, 0x36, 0xC4, 
-0x66, 0x74, 0x1C, 0x60, 0x3D, 0x2F, 0x4A, 0x40, 0x3B, 0x24, 0xC0, 0xAB, 0xBB, 0x7D, 0x94, 0xA8, 
-0xF4, 0x08, 0x3F, 0xDA, 0xB5, 0x77, 0xFE, 0x9C, 0x1D, 0xD7, 0x1B, 0x53, 0x72, 0x1F, 0x65, 0xE4, 
-0x36, 0xCA, 0x02, 0x0F, 0x27, 0x60, 0x70, 0x57, 0xEC, 0x00, 0x84, 0x15, 0x7C, 0x55, 0xF4, 0x60, 
-0x71, 0x5A, 0xDC, 0x43, 0x4E, 0x72, 0x02, 0x96, 0x6F, 0x84, 0xB2, 0x31, 0x5B, 0x7E, 0x0C, 0xCF, 
-0xE5, 0xC6, 0x7E, 0x04, 0x78, 0x41, 0x9F, 0x8F, 0xA1, 0x1E, 0x28, 0x72, 0xDC, 0x10, 0x11, 0x24, 
-0x1F, 0x27, 0x61, 0x70, 0x08, 0x48, 0xAE, 0x26, 0x86, 0x72, 0xF1, 0x08, 0xA2, 0xCD, 0x68, 0xC8, 
-0xB8, 0x90, 0xE0, 0x8E, 0x65, 0xBB, 0x7D, 0x8A, 0x92, 0xF1, 0x47, 0xC9, 0x46, 0xF2, 0xA1, 0x66, 
-0x72, 0xDF, 0xD7, 0xFE, 0x2E, 0xC3, 0x95, 0x81, 0xE4, 0xE5, 0x87, 0x2B, 0x82, 0x43, 0x90, 0x0B, 
-0xFC, 0x46, 0xD9, 0xF4, 0x1B, 0x87, 0x0D, 0x42, 0xC8, 0x2D, 0x01, 0x7D, 0x9C, 0x89, 0x1D, 0xC0, 
-0x2B, 0xA2, 0x82, 0x73, 0xE3, 0x6E, 0x83, 0x8A, 0x25, 0x3B, 0xE3, 0x8C, 0xC8, 0x4B, 0x6F, 0xE7, 
-0x87, 0x43, 0x74, 0x9C, 0x4B, 0xF6, 0x2C, 0xEE, 0x5B, 0xF6, 0x74, 0xA6, 0x9C, 0x2E, 0x41, 0x28, 
-0x71, 0xF1, 0x01, 0xE0, 0x36, 0x49, 0xF8, 0x0C, 0xD1, 0x3A, 0xEA, 0x99, 0x8E, 0xF4, 0x93, 0x8A, 
-0x44, 0xB3, 0xE3, 0x76, 0x87, 0x98, 0x70, 0xEC, 0x9F, 0xCF, 0x2C, 0x64, 0x6D, 0x5C, 0xE0, 0xB4, 
-0x67, 0xF4, 0xF1, 0x1B, 0x15, 0x2A, 0x0F, 0xA8, 0x5F, 0xCC, 0x77, 0x71, 0x0C, 0x96, 0xEA, 0xBC, 
-0x99, 0x3A, 0x51, 0xFB, 0x0F, 0x43, 0xB6, 0x73, 0xD1, 0x04, 0x77, 0xD0, 0xEE, 0x9D, 0x21, 0xAE, 
-0xC8, 0x85, 0x58, 0x14, 0x40, 0xA2, 0xEA, 0x9C, 0x29, 0xE0, 0x51, 0x1C, 0x46, 0xD9, 0x94, 0x8A, 
-0xF6, 0x3C, 0x63, 0x73, 0xF6, 0xB0, 0x79, 0xA8, 0xF6, 0xD3, 0xAA, 0x0B, 0xCE, 0x00, 0x1B, 0xEC, 
-0x31, 0x67, 0x83, 0x5A, 0x91, 0x47, 0x51, 0xBF, 0x93, 0xF2, 0xC3, 0x7C, 0x3A, 0xB4, 0x5F, 0x4D, 
-0x3F, 0x61, 0xA8, 0xD1, 0x75, 0xD7, 0x94, 0xB0, 0x92, 0x51, 0x30, 0xAF, 0xC7, 0x19, 0x65, 0x84, 
-0xA7, 0xFE, 0x1A, 0x51, 0x18, 0x80, 0x43, 0xD1, 0xC6, 0x34, 0x3A, 0x86, 0xC1, 0x96, 0x1A, 0xFC, 
-0xA2, 0x22, 0x66, 0xC9, 0x26, 0x62, 0xA9, 0x8D, 0x3A, 0x4D, 0xCC, 0xA8, 0xF7, 0xC6, 0xBF, 0x69, 
-0x33, 0x28, 0xB5, 0x15, 0x3B, 0xEA, 0xEC, 0x30, 0x2B, 0xC2, 0x8E, 0x21, 0xEB, 0x6C, 0x07, 0xD7, 
-0x9F, 0xC8, 0x8D, 0x14, 0xD5, 0x27, 0xF8, 0x34, 0x5F, 0xCA, 0xBA, 0xCC, 0x4F, 0x59, 0x51, 0x14, 
-0x06, 0x90, 0x1B, 0x19, 0x0A, 0x18, 0x71, 0x17, 0x56, 0x2A, 0x9C, 0xF9, 0x3C, 0xE8, 0x50, 0x00, 
-0x97, 0x47, 0xFE, 0x2D, 0xF0, 0xD5, 0x8F, 0x95, 0x15, 0x87, 0xFB, 0x15, 0x4F, 0x85, 0xF7, 0x03, 
-0x4C, 0x83, 0xC7, 0xFB, 0x2D, 0xF5, 0x47, 0xF2, 0x62, 0x72, 0x84, 0x6D, 0xB3, 0x0B, 0x3A, 0x1A, 
-0xF9, 0x9C, 0x19, 0x9D, 0x80, 0x9D, 0x33, 0x5D, 0xD5, 0xEB, 0xD2, 0xAA, 0x89, 0x7C, 0x22, 0xB7, 
-0x26, 0x54, 0xDA, 0x49, 0x73, 0x59, 0xF8, 0x14, 0xBB, 0xED, 0x36, 0x9A, 0x42, 0x63, 0xC0, 0x45, 
-0x46, 0x6D, 0x07, 0xA0, 0x78, 0x64, 0xC4, 0xB9, 0xBC, 0x80, 0x97, 0x8F, 0x6B, 0xCD, 0x3C, 0x76, 
-0x6C, 0x76, 0x10, 0x40, 0x44, 0xC4, 0xC6, 0x82, 0xEB, 0xD0, 0x28, 0x65, 0x06, 0x89, 0x2B, 0x5D, 
-0x55, 0x4B, 0x87, 0xEB, 0x59, 0x51, 0xF1, 0x40, 0x5F, 0xA1, 0xB2, 0x9A, 0xA1, 0x5D, 0x0B, 0x60, 
-0xB2, 0x0A, 0x9C, 0x17, 0x9F, 0x06, 0x1E, 0x0F, 0x44, 0x12, 0xEA, 0x66, 0xB1, 0x9F, 0xD6, 0xCF, 
-0x09, 0xEE, 0x91, 0xAA, 0x2A, 0xFD, 0xC8, 0x1F, 0xB1, 0xB1, 0x7E, 0x8E, 0xA4, 0x2E, 0xC0, 0x43, 
-0x3B, 0xDD, 0xD9, 0x4C, 0xE9, 0x47, 0xAA, 0x43, 0xB4, 0x02, 0x96, 0xA3, 0x12, 0x2C, 0xEE, 0x71, 
-0x62, 0x80, 0xA6, 0x88, 0xDE, 0xB1, 0x52, 0xD1, 0xF3, 0x51, 0x09, 0x84, 0xB6, 0xD2, 0x17, 0xB6, 
-0xEF, 0x55, 0x55, 0x64, 0xF8, 0xD7, 0x72, 0x67, 0xE3, 0x8B, 0x63, 0xFE, 0x4A, 0xD2, 0xC5, 0x31, 
-0xD2, 0xF6, 0xF2, 0x9B, 0x6F, 0xFE, 0x0F, 0xF6, 0x9B, 0x68, 0xE7, 0x84, 0x83, 0x00, 0x00, 0x00
-};
-
-#endif
+#ifndef LOGIN_HTML_H_H
+#define LOGIN_HTML_H_H
+
+#include <Arduino.h>
+
+// Generated by tools/build_assets.js from login.html - do not edit
+const char login_html[] PROGMEM = {
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xED, 0x3C, 0xDB, 0x72, 0xE3, 0xB8, 
+0x95, 0xEF, 0xFC, 0x0A, 0x0C, 0xBB, 0x1C, 0x49, 0x5B, 0x22, 0x0D, 0x52, 0xA2, 0xAE, 0x96, 0x6B, 
+0x67, 0xBA, 0x27, 0xD9, 0xAE, 0x9A, 0x49, 0xA6, 0xB6, 0x3B, 0x9B, 0xCA, 0x23, 0x44, 0x82, 0x12, 
+0xD2, 0x14, 0xC1, 0x80, 0x90, 0x2F, 0xED, 0xF4, 0x47, 0x6D, 0xED, 0x27, 0xE4, 0xC7, 0xB6, 0x0E, 
+0x00, 0x5E, 0x45, 0x4A, 0x76, 0xEC, 0xD9, 0xDA, 0x54, 0xA5, 0xDD, 0xB6, 0x44, 0x12, 0x38, 0x38, 
+0xE7, 0xE0, 0xDC, 0x01, 0xF0, 0xE6, 0xBB, 0x0F, 0x7F, 0x78, 0xFF, 0xF9, 0xCF, 0xBF, 0xFC, 0x88, 
+0xF6, 0xF2, 0x90, 0xDC, 0x5A, 0x37, 0xF0, 0x81, 0x12, 0x92, 0xEE, 0x36, 0x36, 0xCD, 0x6D, 0xB8, 
+0x41, 0x49, 0x74, 0x6B, 0xDD, 0x1C, 0xA8, 0x24, 0x28, 0xDC, 0x13, 0x91, 0x53, 0xB9, 0xB1, 0xFF, 
+0xF8, 0xF9, 0xB7, 0xCE, 0xC2, 0x2E, 0x6E, 0xA7, 0xE4, 0x40, 0x37, 0xF6, 0x1D, 0xA3, 0xF7, 0x19, 
+0x17, 0xD2, 0x46, 0x21, 0x4F, 0x25, 0x4D, 0xE5, 0xC6, 0xBE, 0x67, 0x91, 0xDC, 0x6F, 0x22, 0x7A, 
+0xC7, 0x42, 0xEA, 0xA8, 0x8B, 0x31, 0x62, 0x29, 0x93, 0x8C, 0x24, 0x4E, 0x1E, 0x92, 0x84, 0x6E, 
+0x3C, 0x17, 0x03, 0x18, 0xC9, 0x64, 0x42, 0x6F, 0x3F, 0xA6, 0x77, 0x54, 0xA4, 0x24, 0xA2, 0x82, 
+0xA3, 0x8F, 0xA9, 0xA4, 0x09, 0xDB, 0xD1, 0x54, 0x52, 0xE4, 0xA0, 0x8F, 0x29, 0x0B, 0x19, 0x11, 
+0xE8, 0x13, 0xCD, 0xD9, 0xDF, 0xFF, 0x27, 0xBD, 0xB9, 0xD6, 0x1D, 0xAC, 0x9B, 0x3C, 0x14, 0x2C, 
+0x93, 0xB7, 0xD6, 0x30, 0x3E, 0xA6, 0xA1, 0x64, 0x3C, 0x1D, 0x8E, 0xD0, 0x93, 0x15, 0xF1, 0xF0, 
+0x78, 0xA0, 0xA9, 0x74, 0x8B, 0x2F, 0x3F, 0x26, 0x54, 0x5D, 0x87, 0x09, 0xC9, 0xF3, 0x9F, 0x58, 
+0x2E, 0x5D, 0x12, 0x45, 0xC3, 0x41, 0x26, 0x68, 0xC2, 0x49, 0x34, 0x18, 0xAD, 0xAD, 0xA2, 0x3F, 
+0x22, 0x51, 0xF4, 0x03, 0x8F, 0x1E, 0xDF, 0x43, 0xCB, 0x3F, 0xED, 0x69, 0xFA, 0x9F, 0x94, 0x44, 
+0x8F, 0xC3, 0x30, 0xC9, 0x01, 0x30, 0x8B, 0xD1, 0xB0, 0x04, 0xBE, 0xE5, 0xD1, 0xE3, 0x08, 0x09, 
+0x2A, 0x8F, 0x22, 0x45, 0x8D, 0xBB, 0xAD, 0x71, 0xA0, 0xF3, 0xBA, 0x42, 0x8A, 0x44, 0xD1, 0x8F, 
+0x77, 0x34, 0x95, 0xF0, 0x9C, 0xA6, 0x54, 0x0C, 0x07, 0x1F, 0xFE, 0xF0, 0xF3, 0x7B, 0xCD, 0xB3, 
+0x9F, 0x38, 0x89, 0x68, 0x34, 0x18, 0xA3, 0x3A, 0x3D, 0xA8, 0x63, 0xD8, 0x8B, 0xE3, 0xA1, 0x6F, 
+0xA3, 0xB5, 0xF5, 0xAD, 0xA2, 0x2B, 0xA7, 0x12, 0xE8, 0xAA, 0x48, 0x8A, 0xD3, 0xF3, 0x14, 0xC5, 
+0x69, 0xEB, 0xC1, 0x5B, 0x93, 0x70, 0x3A, 0x80, 0xC1, 0x59, 0x8A, 0x47, 0xF4, 0x64, 0x85, 0x3C, 
+0xCD, 0x25, 0xCA, 0xC9, 0x1D, 0x8D, 0x3E, 0xEF, 0xE9, 0x81, 0xA2, 0x0D, 0x4A, 0x78, 0x48, 0x92, 
+0x4F, 0x92, 0x0B, 0xB2, 0xA3, 0xEE, 0x8E, 0xCA, 0x8F, 0x92, 0x1E, 0x86, 0x03, 0x09, 0x4F, 0x61, 
+0x0E, 0x61, 0x8C, 0x7A, 0xFB, 0xCD, 0x06, 0x0D, 0x22, 0x22, 0xBE, 0x0C, 0x5E, 0x22, 0x13, 0xD0, 
+0xC1, 0x29, 0x41, 0xF6, 0xF6, 0xCA, 0xE5, 0x63, 0x42, 0xDD, 0x9C, 0xCA, 0x5F, 0x04, 0xCF, 0xA8, 
+0x90, 0x8F, 0xC3, 0xC1, 0x96, 0x84, 0x5F, 0x76, 0x82, 0x1F, 0xD3, 0xC8, 0x09, 0x79, 0xC2, 0xC5, 
+0x60, 0x8C, 0x06, 0xEF, 0x30, 0xC1, 0xB1, 0x47, 0xE1, 0x2B, 0x3B, 0x80, 0x76, 0x90, 0x54, 0x02, 
+0xDC, 0xD3, 0xD9, 0x28, 0x98, 0xB5, 0x05, 0x64, 0xB7, 0xE7, 0xB1, 0xDA, 0xBE, 0x76, 0xF8, 0x4E, 
+0x00, 0x55, 0xAF, 0x58, 0xFD, 0x3B, 0xE9, 0xA5, 0x66, 0x07, 0xD1, 0x24, 0xA7, 0xE7, 0xF8, 0xF9, 
+0x5C, 0xD4, 0xE2, 0x49, 0x3C, 0x8D, 0x67, 0x0A, 0xAE, 0x75, 0xCF, 0xD2, 0x88, 0xDF, 0x77, 0x88, 
+0x95, 0x52, 0xCF, 0xA6, 0x28, 0x01, 0xEF, 0x3E, 0xB3, 0x03, 0xE5, 0x47, 0xF9, 0x62, 0xAD, 0x17, 
+0xF4, 0xC0, 0xEF, 0x68, 0x43, 0xF1, 0x5F, 0xA0, 0x5B, 0x1D, 0xBD, 0xB5, 0x90, 0xB2, 0x90, 0xA7, 
+0x68, 0x53, 0xF5, 0xFB, 0xEB, 0x91, 0x8A, 0xC7, 0x4F, 0x34, 0xA1, 0xA1, 0xE4, 0x62, 0x38, 0x70, 
+0xD5, 0xC4, 0x39, 0xD0, 0xAA, 0x18, 0x11, 0xBE, 0x17, 0xEA, 0xD7, 0x2B, 0xB2, 0xD0, 0xC8, 0x65, 
+0x69, 0x4A, 0xC5, 0x7F, 0x7C, 0xFE, 0xF9, 0x27, 0xB4, 0x41, 0x83, 0x9B, 0x8C, 0xC8, 0x3D, 0x8A, 
+0x36, 0xF6, 0xCF, 0xBE, 0x87, 0x3C, 0xDF, 0x9D, 0x2F, 0xBF, 0x5F, 0xA2, 0x25, 0xC2, 0xC8, 0x83, 
+0x1F, 0xCF, 0xF5, 0x3D, 0x34, 0x41, 0x73, 0x34, 0x47, 0x58, 0xFD, 0x14, 0x8D, 0xBE, 0xDA, 0xB7, 
+0x37, 0xD7, 0xD0, 0xF5, 0x76, 0x50, 0x9B, 0xC1, 0x0E, 0xF0, 0x21, 0x13, 0x61, 0x42, 0x51, 0xF8, 
+0xB0, 0xB1, 0x3D, 0xDF, 0x46, 0xE1, 0xA3, 0xFE, 0x14, 0x1B, 0x3B, 0x00, 0x10, 0xFA, 0xF1, 0xED, 
+0x4D, 0xC2, 0x52, 0x8A, 0x1E, 0x3C, 0xFD, 0xF0, 0x11, 0x3E, 0x6D, 0xF4, 0xE0, 0x9B, 0x4B, 0x7F, 
+0x63, 0x4F, 0xA0, 0x31, 0x34, 0xEA, 0x68, 0xEA, 0xB7, 0xDA, 0xFA, 0x5D, 0x8D, 0xA7, 0xAE, 0x6F, 
+0x9A, 0xEB, 0x6F, 0xD0, 0x21, 0x70, 0x67, 0x53, 0xDD, 0x45, 0x7D, 0xEB, 0x18, 0x61, 0xE1, 0x4E, 
+0x66, 0x06, 0x1F, 0xFD, 0x55, 0x8D, 0xB3, 0x74, 0xE7, 0x0B, 0xDD, 0x4F, 0x7F, 0xED, 0xE8, 0x68, 
+0x3A, 0x99, 0x81, 0x26, 0xA6, 0xB5, 0xDF, 0xD1, 0xD4, 0x6F, 0xB5, 0xF5, 0xCF, 0x35, 0xAE, 0xA8, 
+0x30, 0x48, 0x34, 0xC9, 0xD0, 0x48, 0x9E, 0xA5, 0x43, 0x37, 0x6E, 0x91, 0xA1, 0xC0, 0x16, 0xDD, 
+0x60, 0x42, 0xE1, 0x67, 0x8C, 0x02, 0x5C, 0xAA, 0x68, 0x48, 0x64, 0xB8, 0x1F, 0xD2, 0x91, 0xB1, 
+0xA2, 0x3C, 0xA1, 0x2E, 0x15, 0x02, 0x44, 0xF1, 0x47, 0xF8, 0x40, 0x24, 0xCB, 0x92, 0x47, 0x96, 
+0xEE, 0x90, 0x12, 0xCC, 0xD5, 0x60, 0x8C, 0xA8, 0x52, 0xC3, 0x6F, 0xA3, 0xE1, 0x68, 0x6D, 0xDD, 
+0x5C, 0x17, 0x5E, 0xF5, 0x46, 0xE9, 0xF2, 0xAD, 0xA5, 0x82, 0x82, 0x27, 0xAB, 0xAD, 0xC6, 0x2B, 
+0x64, 0x94, 0x18, 0xFA, 0x42, 0x1B, 0xB7, 0x32, 0x53, 0xDD, 0xCD, 0xB5, 0x39, 0x42, 0xDF, 0x95, 
+0x66, 0x05, 0x7A, 0x82, 0x96, 0x9D, 0x87, 0x5E, 0x5C, 0x7B, 0xB1, 0xBF, 0x9C, 0xCC, 0xD7, 0x96, 
+0x14, 0x24, 0xCD, 0x19, 0x28, 0xFE, 0x0A, 0xB5, 0xBB, 0x21, 0xEC, 0x06, 0x39, 0xA2, 0x24, 0xA7, 
+0x63, 0xD4, 0xBA, 0xB1, 0xB6, 0x78, 0x46, 0x42, 0x26, 0x1F, 0x57, 0xC8, 0xEB, 0x42, 0xB9, 0x1F, 
+0x91, 0x0E, 0xBC, 0x4B, 0x1C, 0xD5, 0xBF, 0x16, 0x49, 0xAE, 0x31, 0x11, 0xE8, 0xDF, 0xD0, 0x53, 
+0x03, 0xDB, 0x94, 0xA7, 0x6D, 0xF2, 0x5D, 0x72, 0x94, 0x7B, 0x27, 0x24, 0x22, 0x6A, 0x8C, 0xBD, 
+0x42, 0x77, 0x44, 0x0C, 0x1D, 0xF5, 0xC0, 0xD9, 0xEE, 0xC0, 0x68, 0x73, 0x11, 0x51, 0xB1, 0x42, 
+0x5E, 0xF6, 0x80, 0x72, 0x9E, 0xB0, 0xC8, 0xB4, 0xD0, 0xF7, 0x35, 0xAE, 0xA3, 0x12, 0x31, 0xFD, 
+0x4C, 0xD2, 0x07, 0xE9, 0x64, 0x82, 0x1D, 0x88, 0x78, 0x1C, 0x75, 0xD1, 0xDC, 0x3B, 0x3A, 0x48, 
+0x17, 0x11, 0xCE, 0x4E, 0x90, 0x88, 0xD1, 0x54, 0x0E, 0xBD, 0x49, 0x10, 0xD1, 0xDD, 0xB8, 0x85, 
+0x15, 0xC2, 0x57, 0x63, 0xF4, 0xCE, 0xF3, 0xBC, 0x85, 0x3F, 0x47, 0x1E, 0xC6, 0x57, 0xA3, 0x06, 
+0x75, 0x75, 0xD4, 0x56, 0x5D, 0xE8, 0xB6, 0x78, 0xD1, 0x8D, 0x9D, 0x0A, 0xF6, 0x9E, 0x89, 0x5E, 
+0x31, 0x1F, 0x0A, 0xAF, 0x70, 0x1B, 0x05, 0xD4, 0xEB, 0xC0, 0xCB, 0xB9, 0xA7, 0xDB, 0x2F, 0x4C, 
+0x3A, 0xF5, 0xA9, 0x4E, 0x58, 0xB6, 0x42, 0xC0, 0xAF, 0xCE, 0x96, 0x8A, 0x91, 0x31, 0x4B, 0x92, 
+0x82, 0x18, 0x35, 0xAB, 0x19, 0x11, 0x34, 0x6D, 0x76, 0xB8, 0x0C, 0xB2, 0x8F, 0xCC, 0xFC, 0xB8, 
+0x55, 0x94, 0x8E, 0x4F, 0x9F, 0xC7, 0x5C, 0x1C, 0x9C, 0x84, 0x6C, 0x69, 0xD2, 0xF1, 0x50, 0xD0, 
+0x03, 0x3D, 0x6C, 0xA9, 0x70, 0x0E, 0x14, 0xF5, 0xB5, 0x51, 0x03, 0xC4, 0x9C, 0x4B, 0x2A, 0x14, 
+0x29, 0xCA, 0x32, 0x68, 0x01, 0x36, 0x4C, 0xBA, 0x80, 0xA1, 0xC2, 0x80, 0xA5, 0xD9, 0x51, 0xB6, 
+0x26, 0xE2, 0x1D, 0x8E, 0xBD, 0xB9, 0x4F, 0xCE, 0x4C, 0xFB, 0xBB, 0xE9, 0x3C, 0x08, 0x66, 0xCB, 
+0x6E, 0xED, 0xF1, 0xE2, 0x20, 0x5E, 0x3E, 0x7F, 0xF0, 0xD5, 0x2A, 0x4B, 0x48, 0x48, 0xF7, 0x3C, 
+0x89, 0xA8, 0xA8, 0x11, 0x31, 0x9B, 0xCE, 0xA7, 0x8B, 0x6D, 0x03, 0x4E, 0xA9, 0xEB, 0xD8, 0x0D, 
+0x9E, 0xC5, 0xFF, 0xAD, 0x4C, 0x9F, 0x2B, 0x64, 0x38, 0x58, 0xCE, 0x66, 0x4B, 0x2D, 0x64, 0x78, 
+0x3A, 0x5F, 0x04, 0x5D, 0xC2, 0x7F, 0x66, 0x1C, 0x27, 0xA7, 0x21, 0x4F, 0x23, 0xA2, 0x02, 0xDD, 
+0xE7, 0x73, 0x8B, 0xFA, 0x74, 0x11, 0xE3, 0x97, 0x0F, 0xB2, 0xDA, 0xF3, 0x3B, 0xC5, 0xAE, 0x17, 
+0x4E, 0x5C, 0x07, 0x57, 0xFB, 0xC6, 0x4B, 0xF8, 0x8E, 0xFF, 0xDA, 0xDC, 0xD3, 0x61, 0x94, 0xE4, 
+0xBB, 0x5D, 0x42, 0x3B, 0x66, 0xEB, 0x9D, 0x47, 0xFD, 0xE5, 0x64, 0xFB, 0x42, 0x49, 0x7C, 0xCE, 
+0x38, 0xB5, 0x00, 0xAE, 0x26, 0x73, 0x2F, 0x98, 0x8D, 0x84, 0xA5, 0x5F, 0xBA, 0xD5, 0x7A, 0xC7, 
+0xA5, 0x7A, 0x5A, 0x97, 0x65, 0x4C, 0x82, 0x98, 0x5C, 0x82, 0xAB, 0x1C, 0xBA, 0x73, 0xA0, 0x79, 
+0x4E, 0x76, 0x6D, 0xE3, 0x28, 0x76, 0x5B, 0x32, 0xF4, 0x7D, 0x3C, 0x46, 0x93, 0x85, 0xFE, 0xC5, 
+0xAE, 0x77, 0xCE, 0x32, 0x77, 0x75, 0xF0, 0x47, 0xDD, 0x1A, 0x1B, 0x92, 0x80, 0x3C, 0x4F, 0xA1, 
+0x5E, 0xE0, 0x55, 0x0A, 0x17, 0xA2, 0x65, 0x42, 0x0B, 0x66, 0x97, 0x3B, 0x79, 0x70, 0xF2, 0x3D, 
+0x89, 0xF8, 0xFD, 0x0A, 0xA2, 0xDB, 0x20, 0x7B, 0x40, 0x01, 0xCE, 0x1E, 0x90, 0xE3, 0xF9, 0xD9, 
+0x83, 0x26, 0x02, 0x8F, 0x91, 0xF9, 0xEF, 0x06, 0xBF, 0x86, 0x77, 0x51, 0x11, 0x89, 0x46, 0x33, 
+0xF2, 0xA2, 0x20, 0xDA, 0xBE, 0xCA, 0xBB, 0xFC, 0x0A, 0xFE, 0xE7, 0xF9, 0xB6, 0xBB, 0x31, 0xF9, 
+0xDE, 0x7C, 0x8C, 0xFC, 0xE9, 0x18, 0x4D, 0x96, 0xC0, 0xBA, 0xC5, 0x45, 0x61, 0x99, 0x07, 0x63, 
+0xB4, 0x08, 0xC6, 0x68, 0xA9, 0xDA, 0x4F, 0xBB, 0x65, 0x85, 0x06, 0x74, 0x4E, 0xB7, 0x2F, 0xB0, 
+0xEE, 0x31, 0x0F, 0x8F, 0xF9, 0xA9, 0x49, 0x34, 0x06, 0xA3, 0x5F, 0x14, 0xE0, 0x67, 0x5A, 0x88, 
+0x40, 0x30, 0x46, 0x5E, 0x80, 0xC7, 0xC8, 0xC3, 0x41, 0x87, 0xE0, 0x17, 0x01, 0x57, 0x31, 0xED, 
+0x31, 0x4F, 0xA5, 0x93, 0xB3, 0xAF, 0x74, 0x85, 0x7C, 0x37, 0x10, 0xF4, 0xB0, 0xD6, 0xB7, 0xEE, 
+0x29, 0xDB, 0xED, 0xE5, 0x0A, 0xCD, 0x31, 0x3E, 0x0D, 0x40, 0x0F, 0x44, 0xEC, 0x58, 0xEA, 0x6C, 
+0xB9, 0x94, 0xFC, 0xB0, 0x42, 0x20, 0x7E, 0x6B, 0x0B, 0x84, 0xC6, 0xD9, 0x9B, 0x6E, 0x9E, 0xEB, 
+0xAD, 0xAD, 0x84, 0x4A, 0x70, 0xB8, 0x39, 0x78, 0xA2, 0x74, 0xB7, 0x42, 0x0E, 0x76, 0xF1, 0x04, 
+0x46, 0xB8, 0x24, 0x8B, 0xCD, 0x00, 0xB8, 0x13, 0xFF, 0x22, 0x5A, 0x68, 0x92, 0xE0, 0xB9, 0x9E, 
+0xA6, 0xA1, 0x34, 0x26, 0xDB, 0xB9, 0xBF, 0xC0, 0x2D, 0x9A, 0xA6, 0x40, 0x53, 0x0B, 0xDD, 0x19, 
+0x50, 0xF5, 0xA0, 0xAB, 0x74, 0x2B, 0xB4, 0xC4, 0x57, 0x05, 0x95, 0xC0, 0x5F, 0x72, 0x94, 0xFC, 
+0x72, 0xE0, 0x72, 0x29, 0xA8, 0xB8, 0xB9, 0x36, 0xF9, 0x44, 0x91, 0x57, 0x14, 0x96, 0xB6, 0x0C, 
+0x90, 0x1D, 0xF0, 0x53, 0x09, 0x01, 0xAF, 0x98, 0xF1, 0x22, 0x66, 0x8E, 0xD9, 0x03, 0x8D, 0xD6, 
+0x16, 0x4B, 0x73, 0x2A, 0x57, 0x08, 0xAF, 0xAD, 0x8C, 0xB3, 0x14, 0xF8, 0x4A, 0xA1, 0x56, 0x90, 
+0xEB, 0xA0, 0x7A, 0x6D, 0x7D, 0x75, 0x58, 0x1A, 0xD1, 0x87, 0x15, 0x28, 0x24, 0xD0, 0x17, 0xB1, 
+0x3C, 0x4B, 0xC8, 0xE3, 0x0A, 0xC5, 0x09, 0x7D, 0x58, 0x5B, 0x24, 0x61, 0xBB, 0xD4, 0x61, 0x92, 
+0x1E, 0xF2, 0x15, 0x0A, 0xA1, 0xAE, 0x28, 0xD6, 0xD6, 0x5F, 0x8E, 0xB9, 0x64, 0xF1, 0xA3, 0x63, 
+0x2A, 0x96, 0xD5, 0x83, 0x0B, 0x19, 0x86, 0xB7, 0x28, 0x52, 0x0C, 0x13, 0x65, 0xD4, 0xEE, 0xD5, 
+0x23, 0x0F, 0x35, 0x5D, 0x7D, 0x44, 0xBA, 0x24, 0x94, 0xEC, 0x8E, 0x2A, 0x5A, 0x9B, 0x04, 0x69, 
+0x76, 0xF7, 0x69, 0x2A, 0x1E, 0x7B, 0xC1, 0x78, 0x82, 0xC7, 0xD8, 0x9D, 0x8D, 0xDA, 0x29, 0x8D, 
+0x9B, 0x91, 0x1D, 0x75, 0x20, 0xF5, 0x50, 0xFE, 0xBE, 0xE4, 0x81, 0x66, 0x51, 0x27, 0x0F, 0x76, 
+0x24, 0x2B, 0x24, 0xF8, 0xD4, 0x87, 0x04, 0xC1, 0xB8, 0xF8, 0xC5, 0x2E, 0x9E, 0x96, 0x59, 0x88, 
+0x03, 0x96, 0xF1, 0x98, 0x17, 0x1D, 0x33, 0x12, 0x45, 0x4A, 0xC2, 0x95, 0x21, 0xF6, 0x66, 0x05, 
+0xB0, 0x48, 0xF0, 0x0C, 0xAC, 0x96, 0x84, 0xBC, 0x65, 0x9B, 0x1C, 0xC5, 0x70, 0x96, 0x3D, 0x74, 
+0xA6, 0x32, 0x5D, 0xC3, 0xCD, 0x2E, 0x64, 0x33, 0x0D, 0x99, 0x9E, 0xE1, 0x42, 0xCA, 0x63, 0x72, 
+0x60, 0xC9, 0xE3, 0x0A, 0xB1, 0x74, 0x4F, 0x05, 0x2B, 0x53, 0xCC, 0x86, 0xDC, 0x36, 0xD9, 0x74, 
+0x42, 0xB7, 0xE7, 0x8F, 0xBD, 0xF9, 0xD8, 0x5F, 0x18, 0x1E, 0x9F, 0x43, 0xA2, 0xCB, 0x91, 0x9E, 
+0x72, 0xED, 0x9B, 0xE5, 0xE6, 0x99, 0xAA, 0xB5, 0xA0, 0x27, 0xCB, 0xE8, 0x98, 0xB7, 0x00, 0x36, 
+0x95, 0x1A, 0xA8, 0xAE, 0x5A, 0xDC, 0x0D, 0x40, 0x0D, 0x0B, 0x66, 0x4D, 0xCE, 0x31, 0xCB, 0xF3, 
+0x2B, 0x5C, 0x24, 0xCF, 0x4A, 0xD3, 0xE9, 0xE1, 0xED, 0x72, 0xE1, 0xAD, 0x2D, 0x92, 0xB2, 0x03, 
+0xD1, 0xF2, 0x0C, 0x88, 0x80, 0x8D, 0x0F, 0x72, 0xE3, 0xE7, 0x10, 0x4B, 0x63, 0x28, 0xCB, 0x53, 
+0xC0, 0xF3, 0xDF, 0xBF, 0xD0, 0xC7, 0x58, 0x90, 0x03, 0xCD, 0x75, 0xC3, 0x27, 0x4B, 0x72, 0xF4, 
+0xA4, 0xDD, 0x0D, 0x58, 0xEA, 0x15, 0x12, 0x5C, 0x12, 0x49, 0x87, 0x93, 0x19, 0x8E, 0xE8, 0x0E, 
+0x8A, 0xB6, 0x40, 0x9D, 0xE6, 0x65, 0x91, 0x5B, 0xD4, 0x2C, 0x12, 0x76, 0x97, 0xDA, 0x22, 0xB5, 
+0x8D, 0x21, 0x76, 0xB1, 0xAF, 0x6D, 0xA1, 0x9E, 0x0D, 0xFA, 0xC0, 0x24, 0xD4, 0x24, 0x1A, 0xB1, 
+0x43, 0x6D, 0x58, 0xF5, 0x35, 0x21, 0x92, 0xFE, 0x79, 0xE8, 0x80, 0x14, 0x21, 0xB5, 0x82, 0x30, 
+0xC4, 0xEE, 0x72, 0xB9, 0x18, 0x35, 0xC2, 0xFD, 0xE5, 0xA2, 0xA9, 0xC0, 0x25, 0x10, 0xD0, 0x52, 
+0xBF, 0x43, 0x73, 0xFD, 0x42, 0x73, 0xEB, 0x36, 0x4A, 0x45, 0x65, 0x82, 0x26, 0x1B, 0x5B, 0xDD, 
+0xC9, 0xF7, 0x94, 0x4A, 0x1B, 0xED, 0x05, 0x8D, 0x37, 0xB6, 0x6E, 0xE4, 0xFA, 0x33, 0x6F, 0x3B, 
+0xF1, 0xA2, 0xC8, 0x0D, 0x73, 0xB5, 0x56, 0xD2, 0xBD, 0x1A, 0xF1, 0xFF, 0xA2, 0x90, 0xDD, 0x51, 
+0xE6, 0xAC, 0x81, 0xEA, 0x58, 0x44, 0x68, 0xF5, 0xFF, 0x76, 0xA6, 0x3C, 0x64, 0x66, 0x8C, 0xA7, 
+0x92, 0x30, 0x2D, 0xE1, 0x07, 0x96, 0x56, 0xAE, 0x05, 0xE3, 0xBB, 0xFD, 0x2B, 0xCD, 0x71, 0x69, 
+0x5F, 0x7C, 0xDC, 0xB4, 0x53, 0xAD, 0xD2, 0xC2, 0xAE, 0xAC, 0x82, 0x54, 0xEE, 0x43, 0xD0, 0x84, 
+0x80, 0x9D, 0x5D, 0x5B, 0x60, 0x77, 0xE3, 0x04, 0x22, 0x86, 0x3D, 0x8B, 0x22, 0x9A, 0x2A, 0xD9, 
+0x8B, 0x68, 0xC8, 0x85, 0x6A, 0xE0, 0x24, 0x94, 0xC4, 0x0D, 0xCF, 0x43, 0xB6, 0x39, 0x4F, 0x8E, 
+0xA0, 0x17, 0x42, 0xD3, 0xE2, 0x2C, 0xAE, 0xD6, 0x96, 0xE4, 0xD9, 0x0A, 0x39, 0xB3, 0xAB, 0x75, 
+0xA1, 0xC8, 0x01, 0xDC, 0x2D, 0xC8, 0xD5, 0xB6, 0xBB, 0x26, 0x8D, 0x93, 0xD9, 0xDA, 0x3A, 0x31, 
+0x81, 0x28, 0x27, 0xF2, 0x28, 0x40, 0x8D, 0x3C, 0x17, 0x07, 0xA3, 0xB5, 0x75, 0xAA, 0x5F, 0x8E, 
+0xE7, 0x83, 0x7E, 0x19, 0x31, 0xF7, 0xB4, 0x39, 0xBC, 0xE0, 0xFA, 0x70, 0xAD, 0xA0, 0x54, 0x4C, 
+0xC7, 0x6A, 0xB5, 0xA5, 0x31, 0x17, 0xDA, 0x3B, 0x1B, 0xBE, 0x0E, 0x06, 0xEB, 0x4E, 0x32, 0x15, 
+0x69, 0x10, 0x1B, 0xD0, 0x58, 0xBB, 0x5A, 0x43, 0x37, 0x06, 0xDB, 0xA2, 0x63, 0x1D, 0xDC, 0x60, 
+0x3F, 0x3B, 0x90, 0x1D, 0x5D, 0x59, 0x60, 0xAF, 0x48, 0x52, 0xC5, 0xCB, 0xA6, 0x8E, 0x4C, 0x24, 
+0xF2, 0xF1, 0x15, 0x58, 0xB1, 0xB1, 0xB1, 0xAB, 0xB3, 0x31, 0xF2, 0x20, 0x6C, 0xF4, 0x7C, 0x15, 
+0x37, 0xE2, 0x89, 0xAE, 0x20, 0xD5, 0x83, 0xD9, 0x00, 0x5F, 0x8D, 0xC6, 0x67, 0x20, 0x2E, 0xF0, 
+0x15, 0xFC, 0x1A, 0x88, 0xC1, 0x72, 0x8C, 0xBC, 0x09, 0x86, 0xE0, 0x75, 0xF6, 0x8F, 0x42, 0x9C, 
+0xE2, 0x2B, 0xC0, 0xD3, 0x40, 0xF4, 0xA7, 0x2A, 0x80, 0x5C, 0x8C, 0x91, 0xE7, 0x29, 0x88, 0x7E, 
+0x37, 0xC4, 0xE7, 0x4D, 0xC6, 0x89, 0xE7, 0xE9, 0x9D, 0x9C, 0x37, 0xE4, 0xEA, 0xE2, 0xB5, 0x5C, 
+0x9D, 0x2F, 0xC7, 0x68, 0x0E, 0x4C, 0x35, 0x00, 0x67, 0x6F, 0xCE, 0xD4, 0x69, 0x1F, 0x53, 0x5B, 
+0x05, 0xD1, 0xC2, 0x57, 0x62, 0x1D, 0x90, 0x96, 0x01, 0xEA, 0x74, 0x81, 0xDB, 0x11, 0xCB, 0x0B, 
+0x2A, 0x96, 0xAD, 0x5B, 0x2A, 0x85, 0x3B, 0x71, 0xBE, 0xFE, 0xB4, 0x11, 0xDA, 0x4C, 0x8D, 0x83, 
+0x6E, 0xA4, 0xA0, 0x90, 0x7D, 0x4E, 0x75, 0x0A, 0x8A, 0xAB, 0x14, 0x54, 0xFD, 0xB8, 0xDE, 0x68, 
+0x0C, 0x2B, 0x33, 0x70, 0x5F, 0xB5, 0x73, 0x82, 0x76, 0x8B, 0x5A, 0x40, 0x75, 0x5A, 0xD6, 0xAD, 
+0x0A, 0xBF, 0xDD, 0xC1, 0xA8, 0xAE, 0x6B, 0x87, 0xC7, 0x2D, 0x0B, 0x9D, 0x2D, 0xFD, 0xCA, 0xA8, 
+0x18, 0x62, 0x77, 0x6A, 0x72, 0x5F, 0x7F, 0x8C, 0x60, 0xF8, 0x0A, 0xDB, 0xCB, 0xAD, 0xBB, 0x6D, 
+0x66, 0x15, 0x55, 0x9F, 0x91, 0xE6, 0x97, 0xE4, 0xF9, 0xBA, 0x46, 0x73, 0x52, 0x36, 0xEE, 0xE7, 
+0x6C, 0x83, 0x63, 0xD3, 0x16, 0x4F, 0x1B, 0x0F, 0x27, 0x27, 0xE1, 0x98, 0x19, 0xAE, 0x92, 0x2A, 
+0xD8, 0xCD, 0xA0, 0x3C, 0x94, 0x8A, 0xE2, 0x94, 0x13, 0xAA, 0xBC, 0x4C, 0x2B, 0xAB, 0x9B, 0x2A, 
+0x09, 0x2B, 0x7A, 0x9A, 0x02, 0x97, 0x11, 0xBF, 0x45, 0x23, 0x76, 0xD3, 0x57, 0xCD, 0x74, 0xE9, 
+0xC4, 0x55, 0x9D, 0x63, 0x8A, 0x0A, 0xD2, 0x4C, 0xF1, 0x43, 0xE7, 0xBA, 0xDD, 0x22, 0xA9, 0x83, 
+0xC4, 0x57, 0xB9, 0xD2, 0x46, 0xBE, 0xEB, 0x37, 0x92, 0xC5, 0xFB, 0xBD, 0x8A, 0x01, 0x9B, 0x13, 
+0xA1, 0x22, 0x7A, 0x7F, 0x51, 0xF0, 0xBA, 0x6D, 0x6B, 0x54, 0xDC, 0xF9, 0x6C, 0x67, 0x5B, 0x72, 
+0xF2, 0xC5, 0x4E, 0xC9, 0x51, 0xA1, 0xB0, 0xF6, 0x4B, 0xFA, 0xBB, 0x99, 0x09, 0x5F, 0x59, 0x86, 
+0x62, 0x26, 0xF4, 0x55, 0x23, 0x9E, 0xEF, 0xB4, 0x50, 0xE3, 0xCE, 0x18, 0xFA, 0xD4, 0x26, 0xCD, 
+0xD5, 0x2C, 0xD4, 0x83, 0xE7, 0x3D, 0x3B, 0x1C, 0xA8, 0x40, 0x13, 0x1D, 0x32, 0x3A, 0x2C, 0x75, 
+0xF8, 0x51, 0xF6, 0x46, 0xD0, 0xA6, 0xF5, 0x93, 0x05, 0x80, 0x61, 0x4E, 0x9B, 0xA1, 0x74, 0x19, 
+0xD3, 0x0E, 0x1D, 0x3F, 0xB8, 0x1A, 0x23, 0xF8, 0x5B, 0x7A, 0xFC, 0xD1, 0x1A, 0xD5, 0x32, 0x49, 
+0xF4, 0xCD, 0x0A, 0xFA, 0xBB, 0x03, 0x78, 0x5C, 0x75, 0x75, 0xFD, 0x7A, 0x67, 0x4F, 0xC7, 0xE8, 
+0xDD, 0xCA, 0xFB, 0x16, 0x85, 0xDB, 0x0B, 0x32, 0xD3, 0x2E, 0xC8, 0x2C, 0x46, 0xAF, 0x2B, 0xC3, 
+0x74, 0xE6, 0x61, 0xAF, 0x2F, 0xC9, 0x74, 0xF3, 0xA7, 0xBB, 0x24, 0xF3, 0xD2, 0x3A, 0x4C, 0x0D, 
+0xE5, 0xB2, 0x2A, 0x3F, 0x7A, 0xAB, 0xAA, 0x4C, 0xB1, 0xBA, 0x23, 0x0E, 0xF5, 0x94, 0x5F, 0x1B, 
+0x07, 0xF8, 0xEB, 0x44, 0x4C, 0xD0, 0x50, 0xCB, 0x6F, 0xC8, 0x93, 0xE3, 0x21, 0x35, 0x59, 0xBF, 
+0x5F, 0x58, 0x38, 0x55, 0x82, 0x83, 0xE9, 0xCF, 0x5E, 0x08, 0x61, 0x51, 0x07, 0xA0, 0x16, 0x9F, 
+0x7A, 0xB2, 0xBF, 0xD3, 0x5C, 0xFD, 0x3C, 0x67, 0xD4, 0x8D, 0x9A, 0xA8, 0x1F, 0xB3, 0x8C, 0x8A, 
+0x50, 0x25, 0x69, 0x1D, 0x89, 0xE4, 0x02, 0x86, 0x30, 0x12, 0xA0, 0x6D, 0xC4, 0xB4, 0x8E, 0x58, 
+0x51, 0xFB, 0x6C, 0x04, 0x13, 0x55, 0xCD, 0x62, 0x66, 0xBC, 0x49, 0xE5, 0x8B, 0xFD, 0xF3, 0x4B, 
+0xAC, 0x6D, 0xAB, 0x3C, 0x3B, 0x97, 0x94, 0x54, 0x7E, 0xFC, 0x62, 0x2D, 0xA3, 0x25, 0x3B, 0x0D, 
+0x9E, 0x05, 0xFD, 0xF5, 0x8D, 0x7A, 0x7C, 0x40, 0x92, 0x04, 0x72, 0x8E, 0x4B, 0xAE, 0xBE, 0xAE, 
+0xAF, 0xAA, 0xB0, 0x06, 0x2E, 0x17, 0x3C, 0xEE, 0x49, 0x88, 0xE2, 0x8F, 0x5A, 0x7C, 0x2C, 0x8B, 
+0xB4, 0xFC, 0x28, 0x41, 0x5A, 0x8B, 0xB8, 0xB7, 0xED, 0x79, 0x4D, 0xE1, 0xE1, 0x4C, 0xA1, 0xD6, 
+0x9B, 0x8D, 0xC1, 0x95, 0x80, 0x27, 0x51, 0x31, 0xE6, 0xD8, 0x3C, 0x54, 0x13, 0xD2, 0xC4, 0x62, 
+0x36, 0xEA, 0xD4, 0xD0, 0x4B, 0xAB, 0x92, 0x3D, 0x0B, 0x40, 0x17, 0x60, 0xF5, 0x95, 0xA1, 0x5F, 
+0x4C, 0xD2, 0xE2, 0x0C, 0x49, 0xDE, 0x29, 0x63, 0xBB, 0xD7, 0x36, 0x7B, 0x14, 0xA4, 0xBE, 0xBC, 
+0x59, 0x19, 0x01, 0xBD, 0x2A, 0xD6, 0x23, 0xE7, 0x60, 0x90, 0x27, 0xFE, 0x9B, 0x45, 0x25, 0xAD, 
+0x89, 0x6F, 0x6A, 0x43, 0x33, 0xA4, 0xB8, 0x28, 0xDD, 0xCA, 0xBC, 0x77, 0x28, 0x76, 0xA0, 0x6C, 
+0xE8, 0x51, 0xE4, 0x00, 0xCC, 0xE4, 0x5B, 0xAF, 0x16, 0xF8, 0x22, 0x80, 0x0C, 0x1A, 0x41, 0x79, 
+0x3B, 0xB2, 0x99, 0x56, 0x4E, 0x45, 0x45, 0x20, 0x9A, 0xAE, 0x1A, 0xA3, 0xCB, 0x55, 0xD5, 0x9E, 
+0x22, 0x95, 0x5F, 0x15, 0xA9, 0x3C, 0x17, 0x77, 0x20, 0x01, 0x43, 0x4F, 0xF0, 0x59, 0x24, 0x82, 
+0x51, 0x73, 0xC8, 0xB2, 0x64, 0xDC, 0x3D, 0x26, 0xAE, 0x57, 0xC5, 0x46, 0xFD, 0x4E, 0xED, 0x05, 
+0x4B, 0xDD, 0xE7, 0xA4, 0xE0, 0xA5, 0x2C, 0x9D, 0x9C, 0x47, 0xA9, 0x5A, 0xA6, 0x7E, 0x31, 0x9F, 
+0x4C, 0x8D, 0xF5, 0xDC, 0xA2, 0xE8, 0xBB, 0x98, 0xC6, 0x7E, 0xEC, 0x77, 0x25, 0x5C, 0xEF, 0x62, 
+0x1A, 0x92, 0x90, 0x54, 0xAB, 0x26, 0x51, 0xE8, 0xCF, 0xFC, 0x59, 0x5D, 0x77, 0x94, 0x12, 0x77, 
+0x95, 0x68, 0xD5, 0xBD, 0x8B, 0x1E, 0x2F, 0x68, 0xAC, 0x48, 0x68, 0xBD, 0x69, 0x47, 0x2C, 0x46, 
+0xBE, 0x4E, 0xD8, 0x73, 0x96, 0xA8, 0x79, 0xEC, 0x45, 0x5E, 0x74, 0x62, 0xE7, 0x96, 0x4B, 0x6F, 
+0xEB, 0x6D, 0xDB, 0xAB, 0xB6, 0xA7, 0x3C, 0x72, 0xF3, 0x3D, 0xBF, 0xAF, 0xFB, 0xFC, 0x6D, 0xC2, 
+0xC3, 0x2F, 0xCD, 0x88, 0x37, 0x61, 0x11, 0xFD, 0xC0, 0xEF, 0x53, 0xAD, 0x66, 0x45, 0xA1, 0xB4, 
+0x1E, 0xE5, 0x96, 0x2D, 0x9E, 0xAC, 0x58, 0x70, 0x88, 0x42, 0xEA, 0x4B, 0x20, 0x3D, 0xEA, 0x01, 
+0x02, 0xA3, 0xB7, 0xFB, 0xF2, 0x7A, 0x07, 0x6F, 0xDD, 0x2B, 0xDB, 0xBA, 0x0A, 0x69, 0xC2, 0xB2, 
+0xDA, 0x1A, 0x7D, 0x4F, 0xCD, 0x4E, 0x69, 0xAD, 0xF6, 0xEB, 0xA2, 0xC8, 0x0E, 0x5A, 0x2A, 0xDC, 
+0xD8, 0x87, 0xD1, 0x63, 0x35, 0x61, 0xE6, 0x75, 0x29, 0xA0, 0xCE, 0xF8, 0x5A, 0x92, 0x50, 0x93, 
+0x28, 0x37, 0x78, 0x59, 0xE0, 0xE0, 0xD7, 0x4C, 0xE5, 0xA5, 0xB0, 0xE0, 0x4C, 0x28, 0xD5, 0x61, 
+0x38, 0xA7, 0x97, 0x2D, 0x67, 0xA3, 0x2C, 0x5E, 0x2E, 0x68, 0x35, 0x0A, 0x0C, 0xD5, 0x9A, 0xD6, 
+0x59, 0x4B, 0x78, 0x61, 0xA7, 0xC9, 0x49, 0x71, 0xB6, 0x6B, 0x5B, 0xD8, 0x69, 0x04, 0xD8, 0x6F, 
+0x55, 0xFB, 0x06, 0xBF, 0x68, 0x1D, 0xCF, 0x9A, 0x9F, 0xCB, 0x9B, 0x72, 0x2E, 0x6D, 0xAE, 0x7B, 
+0x06, 0xE8, 0x73, 0x5B, 0x71, 0x7A, 0xF6, 0xDF, 0x28, 0x6D, 0x3B, 0xD0, 0x88, 0x11, 0x34, 0x6C, 
+0x57, 0xC0, 0xA0, 0x8A, 0xDF, 0x28, 0xC2, 0x94, 0x72, 0x3B, 0xF1, 0x4B, 0xB9, 0x3D, 0x93, 0x6B, 
+0x79, 0xEE, 0x4C, 0x0B, 0x55, 0x3B, 0x54, 0xAE, 0xB7, 0x31, 0x0D, 0xEA, 0x8B, 0x23, 0xD7, 0xE6, 
+0x58, 0x08, 0x50, 0x7C, 0x6B, 0xDD, 0x44, 0xEC, 0x0E, 0xA9, 0xE5, 0x83, 0x8D, 0xDD, 0xB7, 0xDA, 
+0x69, 0x23, 0x16, 0x9D, 0x79, 0x6A, 0x80, 0x40, 0x9B, 0xDA, 0xDA, 0x9C, 0x5D, 0x40, 0x6D, 0xDC, 
+0x23, 0x82, 0x11, 0x47, 0x57, 0x15, 0x36, 0xB6, 0x14, 0x47, 0x6A, 0x23, 0x85, 0xD7, 0xC6, 0x2E, 
+0xCC, 0x98, 0x32, 0xB0, 0x76, 0x13, 0x31, 0xB3, 0xFE, 0xD6, 0xD5, 0xFD, 0xF6, 0xE6, 0x3A, 0x62, 
+0x77, 0xCD, 0xE6, 0xB5, 0x05, 0x2D, 0xFB, 0xF6, 0x3D, 0x11, 0x3B, 0x92, 0x46, 0xDC, 0x75, 0xDD, 
+0xA2, 0x69, 0xF3, 0xA3, 0xD6, 0xB1, 0x59, 0xE0, 0x55, 0xCB, 0x42, 0x77, 0xBB, 0xE2, 0x61, 0x6B, 
+0xB5, 0xC1, 0x46, 0x70, 0x6A, 0xE6, 0x07, 0xFE, 0xB0, 0xB1, 0x21, 0x8C, 0x9C, 0x61, 0xF5, 0xDB, 
+0x49, 0xA1, 0x8A, 0x49, 0xC9, 0x16, 0xA8, 0x8C, 0x49, 0x92, 0x53, 0x45, 0x1D, 0x8D, 0x73, 0xBD, 
+0x52, 0x45, 0x89, 0xF8, 0x9D, 0x71, 0xDD, 0x8A, 0x87, 0x00, 0x1C, 0x6E, 0xC0, 0x36, 0x65, 0x6F, 
+0x63, 0x63, 0xB3, 0x89, 0x58, 0x61, 0x23, 0x79, 0x86, 0x78, 0x1C, 0xAB, 0x83, 0x3C, 0xF8, 0x0A, 
+0x78, 0x57, 0xAC, 0x17, 0x6E, 0x6C, 0x2D, 0xD8, 0xF9, 0x31, 0x0C, 0x69, 0x9E, 0x1B, 0x7D, 0x35, 
+0x2D, 0x8C, 0x85, 0xDE, 0xD8, 0xD8, 0xF5, 0xA6, 0xF6, 0x75, 0x1B, 0x12, 0x98, 0xCD, 0x2E, 0x58, 
+0x46, 0x3F, 0x7A, 0x61, 0xE1, 0x85, 0x82, 0x75, 0xDD, 0x24, 0x42, 0x71, 0x56, 0x53, 0xB7, 0x43, 
+0xB0, 0xED, 0x65, 0x63, 0x1F, 0x45, 0x32, 0x7C, 0x57, 0xD2, 0x35, 0xB2, 0x2B, 0xFB, 0x05, 0x2C, 
+0x2A, 0x0B, 0x21, 0xE3, 0x29, 0x1E, 0x01, 0x99, 0xE5, 0x4E, 0x79, 0xCF, 0xC3, 0xA0, 0x2B, 0xE1, 
+0x1C, 0x3B, 0xDE, 0x02, 0x23, 0x7F, 0x82, 0x1D, 0xDF, 0xC7, 0x68, 0x32, 0xC3, 0x8E, 0x3F, 0x53, 
+0xE1, 0xBB, 0x33, 0xC5, 0xC8, 0x5B, 0x62, 0xC7, 0x9B, 0x62, 0xE4, 0xCF, 0xF1, 0x27, 0xD3, 0x03, 
+0x99, 0xCF, 0xAF, 0x36, 0xBA, 0xAE, 0x03, 0x0C, 0x30, 0x9A, 0xFA, 0x38, 0x9C, 0x62, 0xC7, 0xF3, 
+0x21, 0x3A, 0xC1, 0x8E, 0x17, 0x60, 0xE4, 0x4F, 0x35, 0x7C, 0x80, 0x37, 0x81, 0x12, 0x08, 0x76, 
+0x3C, 0x8C, 0x91, 0x37, 0xC7, 0x9F, 0x74, 0x07, 0xA4, 0x3F, 0xBE, 0xDA, 0xA8, 0x46, 0xFD, 0x52, 
+0x13, 0xBF, 0x83, 0x3F, 0xF9, 0xDD, 0xAE, 0x43, 0x92, 0xEA, 0x8E, 0x0E, 0xE8, 0xDA, 0x1E, 0xA5, 
+0xE4, 0x69, 0x4B, 0xDB, 0xCA, 0xAD, 0x6A, 0x0D, 0x2D, 0xAB, 0xDD, 0x55, 0x02, 0xA5, 0xF2, 0xF3, 
+0x8D, 0xFD, 0x59, 0x3B, 0x4D, 0xD5, 0xA8, 0x25, 0x9E, 0xD5, 0x3E, 0xB7, 0x96, 0x64, 0xFA, 0x53, 
+0xE4, 0x4F, 0x6D, 0x33, 0x13, 0xA0, 0x5D, 0x30, 0x91, 0x82, 0x7F, 0xA1, 0x1B, 0x3B, 0x3C, 0x0A, 
+0xF0, 0x82, 0xEF, 0x61, 0x7E, 0x8B, 0xBB, 0xDA, 0x46, 0x6D, 0x6C, 0xDF, 0xAE, 0x08, 0xBB, 0xD6, 
+0x98, 0x9F, 0xD1, 0x19, 0x22, 0x22, 0x1B, 0x09, 0x0E, 0x22, 0x2E, 0xE8, 0x8E, 0xF1, 0x06, 0xDE, 
+0x09, 0x8D, 0xB6, 0x8F, 0xA0, 0x96, 0x3B, 0xB5, 0xB6, 0x48, 0xC0, 0xCA, 0xD9, 0x1D, 0x50, 0x74, 
+0x85, 0xB7, 0xEB, 0x09, 0x54, 0xBA, 0x5A, 0xAA, 0x55, 0x6A, 0x12, 0xF0, 0xC0, 0xE0, 0x1C, 0xF8, 
+0x36, 0xD2, 0x05, 0x18, 0xFD, 0xBD, 0x8B, 0x0F, 0x0F, 0x87, 0x24, 0xCD, 0x37, 0xF6, 0x5E, 0xCA, 
+0x6C, 0x75, 0x7D, 0x7D, 0x7F, 0x7F, 0xEF, 0xDE, 0x4F, 0x5C, 0x2E, 0x76, 0xD7, 0x3E, 0xC6, 0x18, 
+0xE8, 0x7D, 0xB6, 0x0A, 0x57, 0x62, 0xEA, 0x23, 0xDF, 0x0F, 0xA7, 0xEE, 0x12, 0x0E, 0x6F, 0x2C, 
+0x9D, 0xA9, 0x8B, 0x27, 0x68, 0xE9, 0x2C, 0x43, 0xEC, 0xC0, 0x3D, 0x67, 0xE9, 0x78, 0x13, 0xF5, 
+0xE7, 0xD3, 0x04, 0x2D, 0xE0, 0xD9, 0x04, 0x79, 0x93, 0x10, 0x23, 0xD5, 0x41, 0x37, 0x86, 0x9F, 
+0xAF, 0xDD, 0x73, 0xD4, 0x51, 0xEC, 0x5C, 0x8E, 0xDA, 0x93, 0xE5, 0xB9, 0x41, 0x79, 0x0B, 0xB4, 
+0x31, 0x24, 0xD9, 0xC6, 0x56, 0x1E, 0xAA, 0x71, 0xFB, 0x2F, 0x9C, 0xA5, 0xC5, 0xFD, 0xEB, 0x16, 
+0x05, 0xDE, 0x84, 0x04, 0x28, 0x28, 0x92, 0x62, 0xE4, 0xBF, 0x21, 0x06, 0x35, 0xB2, 0xCE, 0x8C, 
+0xEA, 0x39, 0xFF, 0x67, 0xA3, 0xFA, 0xFE, 0x7F, 0x2D, 0xDF, 0x6E, 0xA4, 0x36, 0xF4, 0x65, 0xA8, 
+0xC4, 0xCD, 0x0D, 0x9C, 0x09, 0x0A, 0x9C, 0xC9, 0xD9, 0x81, 0x16, 0x2F, 0x22, 0xA9, 0x66, 0x7D, 
+0x16, 0xDD, 0xC3, 0x3A, 0x6A, 0x58, 0xE7, 0x57, 0x1E, 0xB6, 0x30, 0x0B, 0xDA, 0x18, 0xEC, 0x3D, 
+0xED, 0xB7, 0x1A, 0xEA, 0xDD, 0x34, 0x84, 0x10, 0xBD, 0xD8, 0xF5, 0x43, 0xA2, 0x37, 0xD7, 0x7B, 
+0x0F, 0xF0, 0x6F, 0x34, 0x2B, 0xEA, 0xB1, 0xF6, 0xED, 0xCF, 0x3C, 0x65, 0x92, 0x0B, 0xCA, 0xD1, 
+0xA3, 0x3A, 0x92, 0x2A, 0x78, 0x82, 0x32, 0x22, 0x08, 0x3A, 0xA6, 0x28, 0x14, 0x34, 0x64, 0x07, 
+0xF0, 0x34, 0x1C, 0xE5, 0x24, 0x39, 0x46, 0xA0, 0x96, 0x37, 0xD7, 0x59, 0xA7, 0x75, 0x6A, 0x64, 
+0x4C, 0xDA, 0xC2, 0x36, 0x6F, 0x29, 0x5F, 0x28, 0x78, 0xBA, 0xBB, 0x55, 0xE7, 0x6B, 0x56, 0x10, 
+0x27, 0xA9, 0x4B, 0x74, 0x93, 0x67, 0x24, 0xAD, 0xF5, 0xD0, 0xE1, 0xC4, 0xCD, 0x35, 0xDC, 0xAE, 
+0xC6, 0x52, 0x41, 0x78, 0x9D, 0x08, 0xB8, 0x61, 0xD7, 0x18, 0xA2, 0xAF, 0x79, 0x9A, 0x1F, 0xB7, 
+0x07, 0x26, 0x37, 0xF6, 0x9E, 0xA4, 0x51, 0x42, 0x7F, 0x82, 0x67, 0x43, 0xB5, 0xFA, 0x3C, 0xB2, 
+0x55, 0x35, 0x38, 0xE4, 0x87, 0x2C, 0xA1, 0x92, 0x6E, 0x6C, 0x1E, 0xC7, 0x2D, 0x1B, 0x58, 0xD5, 
+0x78, 0xE1, 0x81, 0xAE, 0xD5, 0xC6, 0xE0, 0xA7, 0x8F, 0x39, 0x30, 0xF4, 0x40, 0xED, 0x46, 0x4B, 
+0xD5, 0xC0, 0xBE, 0xFD, 0x63, 0x7E, 0x24, 0x82, 0xF1, 0x9B, 0x6B, 0x75, 0x7D, 0x6B, 0xDD, 0xA8, 
+0x00, 0xD1, 0x92, 0x8F, 0x19, 0xDD, 0xD8, 0x8A, 0x1A, 0x0B, 0xD0, 0x2C, 0x61, 0x58, 0xFA, 0x30, 
+0x70, 0x75, 0x5D, 0x87, 0xA9, 0xFA, 0xDA, 0x56, 0xAD, 0xCC, 0xB5, 0xB1, 0x3F, 0xA6, 0x3B, 0x41, 
+0x73, 0x82, 0xE4, 0x11, 0x1D, 0xF5, 0x58, 0xB6, 0x25, 0xE8, 0x5F, 0x8F, 0x4C, 0xD0, 0xC8, 0x3A, 
+0xA5, 0xC9, 0xEA, 0x9C, 0xA1, 0x5E, 0xDA, 0x32, 0x92, 0xE7, 0xF7, 0x1C, 0xFC, 0x4A, 0x07, 0x6D, 
+0x70, 0x60, 0x55, 0x90, 0x9C, 0xFE, 0xFD, 0xBF, 0x49, 0x37, 0x7D, 0x65, 0x6F, 0x4B, 0xC7, 0xA5, 
+0xC5, 0x95, 0xA6, 0xB1, 0xBA, 0x7E, 0x01, 0x8D, 0x61, 0x35, 0x66, 0x2F, 0x9D, 0x29, 0xBD, 0x77, 
+0x2A, 0xE0, 0x15, 0xC1, 0xC6, 0xF5, 0x6B, 0xDC, 0xB4, 0x28, 0x34, 0x55, 0x04, 0x5C, 0xFD, 0xED, 
+0xC9, 0x59, 0xE9, 0xCA, 0xEF, 0x02, 0x82, 0x6D, 0x38, 0xFA, 0xE2, 0x04, 0x4E, 0x95, 0xB1, 0x80, 
+0xDC, 0x85, 0x09, 0x0B, 0xBF, 0x14, 0x62, 0xF7, 0xBB, 0x23, 0xCD, 0xA5, 0x96, 0xBD, 0x91, 0x7D, 
+0xFB, 0x23, 0xD0, 0x23, 0x50, 0xC8, 0x0F, 0x1C, 0xB1, 0xF4, 0x8E, 0x49, 0x12, 0xF1, 0x53, 0x5F, 
+0x6F, 0x3E, 0x8A, 0x9D, 0x43, 0xE5, 0xA9, 0x64, 0x58, 0x34, 0x53, 0x9B, 0x9C, 0x6A, 0x3B, 0xA5, 
+0x54, 0x10, 0xA2, 0x83, 0x94, 0x1F, 0x64, 0xE3, 0x5C, 0xE5, 0x8E, 0x16, 0x9B, 0x9D, 0x7E, 0x78, 
+0xFC, 0x18, 0x99, 0x0D, 0x53, 0xB5, 0x38, 0xA7, 0x3A, 0x91, 0xF9, 0xF6, 0xBB, 0xAD, 0x2E, 0x6F, 
+0x91, 0x3A, 0x66, 0x11, 0x91, 0x54, 0x01, 0xF9, 0x18, 0xF2, 0x74, 0x08, 0x4E, 0x7F, 0x8C, 0x94, 
+0xA7, 0xD7, 0x75, 0x8E, 0x06, 0x5D, 0x1D, 0x87, 0x5D, 0x15, 0x97, 0x07, 0x63, 0xA4, 0x09, 0x52, 
+0x80, 0x9A, 0x67, 0xB8, 0x6B, 0x0F, 0x6A, 0xFC, 0x62, 0xF9, 0x07, 0x22, 0xBE, 0xD4, 0xF9, 0xD4, 
+0xC2, 0xD5, 0x24, 0x23, 0x79, 0x1B, 0x61, 0xDD, 0xBD, 0xD8, 0x72, 0x7B, 0x99, 0xCF, 0x27, 0x59, 
+0x1B, 0x00, 0x29, 0x36, 0xB3, 0xB6, 0x58, 0xA3, 0x53, 0x71, 0x73, 0xD4, 0xB9, 0x38, 0xAE, 0x3B, 
+0x1C, 0xA1, 0xCD, 0x2D, 0x3A, 0xED, 0x51, 0x1C, 0xAC, 0x2D, 0x3A, 0x8D, 0x61, 0x2D, 0xAC, 0x38, 
+0x29, 0xAB, 0xA8, 0x3B, 0x37, 0x15, 0x45, 0xEF, 0x67, 0x9E, 0xDC, 0xBE, 0xD4, 0xB1, 0x21, 0x2D, 
+0x79, 0x53, 0x5A, 0xC6, 0x68, 0x90, 0x40, 0x64, 0xD8, 0x35, 0xDD, 0x6A, 0xA2, 0x61, 0xF5, 0xF8, 
+0x48, 0xCF, 0x0D, 0xAF, 0x07, 0xFD, 0x5E, 0x4A, 0xC1, 0xB6, 0x47, 0x49, 0x87, 0x03, 0x95, 0xBA, 
+0x36, 0x30, 0x56, 0xF4, 0xF5, 0xB7, 0x3B, 0x3D, 0x82, 0x7D, 0x59, 0x36, 0xFF, 0xB1, 0x4D, 0x83, 
+0x17, 0x58, 0xA1, 0x95, 0xE4, 0x92, 0xE0, 0xF7, 0x1F, 0x14, 0xA7, 0xF2, 0x84, 0xBC, 0x31, 0x1A, 
+0x3C, 0xEB, 0xF8, 0xE5, 0x29, 0xBF, 0x5E, 0x03, 0x0D, 0xF5, 0x1F, 0xE6, 0x2C, 0xF6, 0x3E, 0x96, 
+0x3A, 0xD8, 0x26, 0x56, 0xCB, 0xE7, 0x18, 0xE9, 0x8A, 0x29, 0x7D, 0x5B, 0x33, 0x66, 0x72, 0xAB, 
+0x8F, 0xFA, 0x7C, 0x79, 0xCB, 0x80, 0x5C, 0x3E, 0x65, 0x7E, 0x82, 0x53, 0x4A, 0xEF, 0x3F, 0xB6, 
+0xCE, 0xAA, 0x87, 0x82, 0x12, 0x49, 0x0D, 0x3E, 0xBF, 0xFF, 0x34, 0x1C, 0xF4, 0x27, 0x35, 0xC0, 
+0x4F, 0xF8, 0x18, 0xAD, 0x2D, 0x03, 0xA8, 0xC5, 0x75, 0x25, 0x4C, 0xD0, 0xAA, 0x76, 0x5E, 0xAA, 
+0xFA, 0xEA, 0xA4, 0xF4, 0xBE, 0xBF, 0xAF, 0x49, 0xB3, 0xA0, 0x77, 0x99, 0x68, 0xF5, 0xB7, 0x86, 
+0xB8, 0x1C, 0x9A, 0x42, 0x64, 0xDE, 0xDF, 0x4A, 0x87, 0xA2, 0xD0, 0xAE, 0x9E, 0xA4, 0x5E, 0x6A, 
+0xAF, 0xA3, 0x59, 0xE8, 0xE5, 0x0F, 0x4E, 0x8C, 0x50, 0xD1, 0xF1, 0xCD, 0x8F, 0xE5, 0xD7, 0xA6, 
+0xBA, 0xAD, 0x94, 0xF9, 0x11, 0xDC, 0xB1, 0x84, 0xDD, 0xD1, 0x75, 0xDC, 0x5B, 0xAD, 0x0E, 0x9C, 
+0xA7, 0x8E, 0x60, 0xB9, 0x69, 0x55, 0x5A, 0x89, 0x6E, 0x8C, 0xFF, 0x75, 0xD2, 0xFF, 0x9F, 0xF0, 
+0xA4, 0xFF, 0x19, 0x19, 0x51, 0xB3, 0x7F, 0x59, 0x48, 0x40, 0x94, 0x6A, 0x32, 0x72, 0x12, 0x93, 
+0x64, 0x19, 0x4D, 0xA3, 0xF7, 0x7B, 0x96, 0x44, 0x43, 0x03, 0xA1, 0xCB, 0x83, 0xEB, 0xF7, 0x56, 
+0xD4, 0x8D, 0xD3, 0x6F, 0x7E, 0x53, 0xB7, 0x55, 0xAE, 0x5E, 0x18, 0xF9, 0x3D, 0x8F, 0xE8, 0xA8, 
+0x71, 0xDF, 0x78, 0xDC, 0x4E, 0xFC, 0x0A, 0x6F, 0xDC, 0x32, 0x18, 0x63, 0xD4, 0x90, 0x6C, 0x30, 
+0x41, 0x4D, 0x1A, 0x60, 0x21, 0x50, 0x45, 0x0B, 0xD5, 0x8B, 0x2D, 0x1A, 0x1A, 0x5B, 0x1F, 0xFF, 
+0xD7, 0x7B, 0x99, 0x46, 0xFF, 0x28, 0xFF, 0xD2, 0xB4, 0x7F, 0xD6, 0x77, 0x6A, 0x54, 0x4E, 0x3F, 
+0x25, 0x77, 0x6C, 0x47, 0x24, 0xFD, 0x13, 0x93, 0xFB, 0xCF, 0x65, 0x18, 0x3C, 0x3C, 0x8A, 0x64, 
+0xA4, 0x56, 0x9B, 0xAA, 0xF7, 0x15, 0xBD, 0x32, 0x9A, 0xD6, 0x40, 0xCC, 0xC1, 0xA4, 0x33, 0x30, 
+0x6A, 0xEB, 0x21, 0x85, 0x8F, 0x32, 0x50, 0x46, 0xE8, 0x62, 0x44, 0x0E, 0xAD, 0x75, 0xDF, 0x91, 
+0x19, 0xCA, 0xBC, 0xB4, 0xC7, 0x2C, 0x9F, 0x80, 0xD8, 0xC2, 0xAE, 0xAF, 0xC1, 0x8B, 0xDE, 0x8E, 
+0xA3, 0xDF, 0xA8, 0x55, 0x3B, 0xC9, 0xD3, 0x0A, 0xFE, 0x1B, 0x67, 0x62, 0xCC, 0x0B, 0x7F, 0x20, 
+0xC0, 0x84, 0x7B, 0x2E, 0x1C, 0xAB, 0x41, 0x1B, 0x74, 0x14, 0x89, 0xD6, 0x68, 0x1F, 0x5F, 0x78, 
+0x91, 0x49, 0x35, 0x0B, 0x48, 0xDD, 0x29, 0x5E, 0x62, 0x72, 0x16, 0x70, 0x7D, 0x4A, 0x4F, 0x4B, 
+0x28, 0xE8, 0xC9, 0x52, 0x5F, 0xE0, 0xE5, 0x1D, 0xF0, 0xF9, 0x81, 0xC6, 0xE4, 0x98, 0xC8, 0x61, 
+0x39, 0x2D, 0x45, 0x51, 0xE3, 0xDC, 0xC4, 0x14, 0x6D, 0x06, 0x23, 0xF7, 0x8E, 0x24, 0x47, 0x5A, 
+0xF4, 0x2D, 0xF2, 0xF9, 0xF3, 0x93, 0xAA, 0xDB, 0x54, 0x7D, 0xF7, 0x2C, 0xA2, 0xAA, 0xA4, 0x34, 
+0x34, 0xD3, 0xF6, 0x5D, 0x89, 0xC3, 0xDF, 0xFE, 0x86, 0xBE, 0x2B, 0x3A, 0xA8, 0xB7, 0x22, 0xED, 
+0xF9, 0xBD, 0x6E, 0x3A, 0xF8, 0x85, 0x0B, 0x14, 0x93, 0x3B, 0xAE, 0xB2, 0x72, 0xA8, 0x29, 0x10, 
+0x24, 0x79, 0xC4, 0x73, 0x94, 0xF0, 0x1C, 0x85, 0xE4, 0x90, 0xF1, 0x1C, 0xE6, 0x46, 0xBF, 0xE7, 
+0x0B, 0xD8, 0x52, 0xF0, 0x36, 0xE1, 0xBB, 0xE1, 0x40, 0xB1, 0x04, 0x11, 0x29, 0xE9, 0x21, 0x93, 
+0xC0, 0xD6, 0xA7, 0x8A, 0xF0, 0x6F, 0x06, 0x8D, 0x8A, 0x13, 0x90, 0x2C, 0x7F, 0x1F, 0x1D, 0x58, 
+0x3A, 0x00, 0x1F, 0x50, 0x51, 0x59, 0xDE, 0xF7, 0xFC, 0xC9, 0x54, 0x65, 0xD2, 0xDD, 0xC9, 0x04, 
+0xCB, 0xBF, 0x3F, 0xCA, 0x3D, 0x4D, 0x25, 0x0B, 0x89, 0x54, 0xAF, 0x0D, 0x1B, 0x40, 0xFA, 0xD0, 
+0x9F, 0x7D, 0x94, 0x0C, 0x1E, 0x97, 0x68, 0x81, 0x3B, 0xE9, 0x56, 0xD0, 0x81, 0xDA, 0xBC, 0xEE, 
+0xC2, 0xB1, 0xD5, 0x46, 0x4C, 0x54, 0x63, 0x96, 0x29, 0x70, 0x21, 0x5E, 0x2F, 0xCD, 0x20, 0x96, 
+0x86, 0x5C, 0xC0, 0x96, 0x47, 0xCD, 0xAA, 0x0E, 0xC9, 0xA9, 0x57, 0x41, 0xD0, 0x53, 0x73, 0xA6, 
+0xDE, 0x9E, 0xD4, 0x41, 0x51, 0x5A, 0x19, 0x9C, 0x01, 0xAF, 0x50, 0xAA, 0x83, 0xED, 0xE3, 0x0A, 
+0xC4, 0xDA, 0x15, 0x53, 0x6A, 0xEF, 0x88, 0x2B, 0xD9, 0x62, 0x2A, 0x9B, 0x55, 0xE6, 0xA0, 0x94, 
+0xEC, 0x03, 0xBB, 0x3B, 0x27, 0xBF, 0x8D, 0xA2, 0x68, 0x65, 0xCD, 0xD4, 0xED, 0xCF, 0x70, 0x30, 
+0xF0, 0x62, 0x5F, 0x28, 0x28, 0x42, 0xC7, 0xB2, 0x8B, 0x0B, 0x77, 0xCC, 0x8B, 0xE5, 0xD0, 0x06, 
+0x19, 0xD8, 0xA6, 0xC1, 0x07, 0x76, 0x77, 0x12, 0xDF, 0xEC, 0xF9, 0x7D, 0x8B, 0xA8, 0xDA, 0xCC, 
+0xBC, 0x8E, 0x9A, 0x8E, 0x31, 0x8B, 0x98, 0xA5, 0x1A, 0xD6, 0xD8, 0x1F, 0x9E, 0xAA, 0xD7, 0xFF, 
+0x6C, 0x50, 0xC7, 0x49, 0xC0, 0x96, 0x1C, 0xF4, 0x16, 0xA8, 0xDA, 0xF2, 0x52, 0xE6, 0x22, 0xAD, 
+0xEE, 0xA0, 0x6A, 0x7A, 0xC6, 0xD1, 0x93, 0xF5, 0xCD, 0xAA, 0x95, 0xD4, 0x3A, 0x43, 0xB7, 0xCA, 
+0x96, 0xFD, 0x96, 0xD1, 0x24, 0x7A, 0x9E, 0x31, 0xAB, 0x9B, 0xB1, 0x8B, 0xDD, 0x2A, 0x3B, 0x56, 
+0x59, 0x0B, 0xD5, 0x69, 0x54, 0x0D, 0xAB, 0x2D, 0x1C, 0x78, 0x1A, 0xE3, 0x65, 0x4A, 0xC8, 0xA3, 
+0x6A, 0x90, 0x46, 0xA3, 0x6F, 0x6A, 0x03, 0x3D, 0x30, 0xB9, 0x71, 0x06, 0xF1, 0xDA, 0x6C, 0x41, 
+0xB8, 0x56, 0x2F, 0xB0, 0xFC, 0x5F, 0xB8, 0x67, 0x53, 0x65, 0xD0, 0x52, 0x00, 0x00, 0x00
+};
+
+const char login_html_br[] PROGMEM = {
+0x1B, 0xCF, 0x52, 0x00, 0xAC, 0x0A, 0x78, 0x32, 0xDE, 0xC8, 0x0B, 0xA1, 0x2D, 0xE5, 0x3B, 0x82, 
+0x28, 0x71, 0x0C, 0x95, 0xD8, 0x76, 0xF4, 0x18, 0x16, 0x0C, 0x46, 0x48, 0x32, 0x7B, 0x4E, 0xAD, 
+0xFA, 0x6B, 0xAA, 0xB9, 0x6C, 0x24, 0x06, 0x19, 0xF6, 0xFD, 0xC1, 0xFE, 0x10, 0x42, 0xF5, 0x25, 
+0x36, 0x63, 0x8E, 0x0D, 0x83, 0x05, 0x6C, 0x48, 0xEA, 0xE7, 0x4F, 0xA7, 0x39, 0xA8, 0x14, 0xFC, 
+0x6A, 0xF9, 0xCE, 0x61, 0x6F, 0x43, 0x01, 0x50, 0xFD, 0xD0, 0x46, 0x33, 0x56, 0x0E, 0xD4, 0x3D, 
+0x31, 0xCE, 0x57, 0xFD, 0xBD, 0x3F, 0xAD, 0x2E, 0x44, 0xD5, 0x83, 0x58, 0x27, 0xA6, 0x38, 0xEA, 
+0xD4, 0x61, 0xFE, 0xB0, 0xE7, 0xD2, 0x67, 0xE4, 0x1F, 0xE6, 0x62, 0xFD, 0x95, 0xF4, 0x2F, 0x1D, 
+0xC2, 0x60, 0xA7, 0x9A, 0x0E, 0xB6, 0x56, 0xB5, 0x1B, 0x22, 0xC7, 0xEF, 0x57, 0xA5, 0xED, 0x3F, 
+0x0B, 0xE4, 0x8E, 0x1C, 0x49, 0x60, 0xCB, 0x2C, 0x4F, 0x9F, 0x44, 0x7F, 0x5D, 0xF5, 0xAA, 0xDE, 
+0xCD, 0xEF, 0xF9, 0xD3, 0x77, 0xDB, 0x03, 0x0B, 0xD8, 0x7B, 0x40, 0xF0, 0x0A, 0x5E, 0xF3, 0x52, 
+0xCF, 0xEE, 0x1C, 0x05, 0x1D, 0x11, 0x1A, 0x1B, 0x63, 0x12, 0x17, 0x17, 0xE9, 0x3A, 0x61, 0xB9, 
+0x11, 0x2E, 0x6E, 0xCE, 0x87, 0xEC, 0x28, 0x87, 0xA9, 0x8E, 0xB7, 0xC7, 0xD0, 0xEC, 0x73, 0xA3, 
+0xFB, 0x76, 0xE2, 0x40, 0x45, 0x44, 0x14, 0x93, 0xE6, 0xEB, 0x78, 0x4C, 0x06, 0x30, 0xEF, 0xCD, 
+0x01, 0x34, 0x9B, 0x1D, 0x43, 0xD2, 0x2A, 0x69, 0xC9, 0xA3, 0xC4, 0x25, 0x70, 0x04, 0x24, 0x13, 
+0x3A, 0x87, 0x14, 0xD2, 0x90, 0xB2, 0xE5, 0x8B, 0xC8, 0x8D, 0x41, 0xFF, 0x8E, 0x5F, 0xF8, 0x27, 
+0x25, 0xB6, 0x8E, 0x52, 0x84, 0xB3, 0xE7, 0x3B, 0x2D, 0x43, 0xF9, 0x3E, 0x6D, 0xFB, 0xF1, 0x37, 
+0x43, 0xB0, 0xE9, 0x57, 0x13, 0x8F, 0x11, 0xC8, 0x28, 0xA3, 0x04, 0x58, 0x6D, 0xFC, 0xE4, 0x2B, 
+0xE5, 0xE2, 0x86, 0x4A, 0x00, 0xD8, 0xA7, 0x7A, 0xCF, 0xB1, 0xCE, 0x55, 0x98, 0x30, 0x03, 0x28, 
+0x44, 0x8C, 0xA9, 0xFA, 0x10, 0x3A, 0x4B, 0x61, 0xC6, 0x83, 0xEE, 0x5B, 0xB8, 0x6B, 0xE7, 0xB6, 
+0x9C, 0x2F, 0xB3, 0xE3, 0x80, 0x77, 0x4A, 0x2B, 0x4B, 0x25, 0x2A, 0x32, 0xF2, 0xAA, 0xF8, 0x85, 
+0x0E, 0x34, 0x3B, 0xC0, 0xF4, 0x16, 0xE3, 0xFB, 0xF1, 0xFE, 0xD7, 0x8F, 0xA4, 0x0E, 0x7F, 0xA6, 
+0x52, 0xA2, 0xA8, 0x59, 0x42, 0x79, 0x9D, 0xE9, 0x67, 0xAB, 0x81, 0xCE, 0xC4, 0xB0, 0x1D, 0xF5, 
+0x4E, 0x25, 0x09, 0xD6, 0x61, 0x5C, 0xF1, 0x69, 0xCC, 0x15, 0x2F, 0x9C, 0xA8, 0x60, 0x58, 0x9E, 
+0x10, 0xDC, 0x38, 0x7A, 0x38, 0x0F, 0x9A, 0x8F, 0xAD, 0x93, 0x28, 0x81, 0x6B, 0x54, 0xCB, 0x16, 
+0x0D, 0xA8, 0xD5, 0x56, 0x9E, 0xCA, 0x2E, 0xB9, 0x6B, 0x20, 0x7F, 0x42, 0x3A, 0x82, 0x3F, 0xC2, 
+0x4E, 0x7B, 0xAD, 0xB0, 0x59, 0x4E, 0x9D, 0xC2, 0x0B, 0xFC, 0x6E, 0xA2, 0xB3, 0x3E, 0x9B, 0x98, 
+0xB3, 0x1E, 0x50, 0x99, 0xCA, 0xEE, 0xB7, 0x1B, 0x86, 0x9A, 0x2D, 0x90, 0xED, 0x67, 0x4E, 0xEA, 
+0x89, 0xA3, 0xED, 0x2F, 0x63, 0x36, 0x05, 0xB7, 0x8D, 0x14, 0xE1, 0x08, 0x2B, 0xCF, 0x00, 0xDE, 
+0x8B, 0x1E, 0xB2, 0xFD, 0xDA, 0x83, 0x60, 0x3B, 0x12, 0x6D, 0x52, 0x09, 0x77, 0xEE, 0x90, 0x42, 
+0x91, 0xC6, 0x74, 0x37, 0x76, 0x9E, 0x35, 0xCE, 0x0E, 0x3B, 0xC2, 0xED, 0x0A, 0xDD, 0x32, 0x50, 
+0x0B, 0xB3, 0xA8, 0x82, 0x4E, 0xC3, 0x51, 0xBE, 0xFC, 0x54, 0x0E, 0xC4, 0x4F, 0x66, 0xFE, 0xAC, 
+0xFC, 0xE5, 0x77, 0x81, 0x10, 0x15, 0x18, 0xB9, 0x9E, 0xB2, 0x8B, 0x65, 0x4F, 0x28, 0x98, 0x1E, 
+0x8D, 0xA9, 0x82, 0xBA, 0x96, 0x68, 0x92, 0x7D, 0x85, 0xD7, 0x00, 0xB7, 0x1F, 0x6D, 0xC1, 0xA0, 
+0xD8, 0xA8, 0x8B, 0x8D, 0xD8, 0xF3, 0x81, 0x3F, 0xE9, 0xE2, 0xC5, 0x0F, 0xD3, 0x08, 0xE1, 0x6F, 
+0x3C, 0x3D, 0xA3, 0x78, 0x94, 0x88, 0x73, 0x34, 0x76, 0xA3, 0xD0, 0xB7, 0x42, 0x3C, 0xF5, 0xFE, 
+0xFD, 0x8D, 0x39, 0xC0, 0xFA, 0xE2, 0xCB, 0xFB, 0x54, 0xB4, 0xBD, 0xA0, 0xB5, 0x07, 0xBD, 0x04, 
+0xCE, 0x77, 0x2F, 0xB4, 0xDC, 0xE6, 0x2B, 0xF7, 0xED, 0xB7, 0x17, 0x8D, 0x33, 0xC1, 0xC8, 0x5D, 
+0x05, 0xF0, 0x94, 0x73, 0x3F, 0xFA, 0xA7, 0xFC, 0xFD, 0xBA, 0xFB, 0xB6, 0xB5, 0xCA, 0xD4, 0x4C, 
+0x39, 0xB3, 0x00, 0x06, 0xAD, 0x9F, 0x41, 0xE6, 0x3C, 0xD4, 0x1C, 0xB7, 0x3C, 0x62, 0xBF, 0xF3, 
+0x2B, 0xBC, 0xB4, 0x1B, 0x3E, 0x7B, 0xA7, 0x57, 0x96, 0x2F, 0xED, 0xE4, 0xC4, 0x27, 0xBD, 0xA4, 
+0x5B, 0x7B, 0xF0, 0x97, 0x9F, 0xF4, 0xD2, 0xB4, 0x4C, 0x16, 0xC9, 0xB3, 0x6A, 0x66, 0x63, 0x98, 
+0x7C, 0x0C, 0x32, 0xE7, 0xA6, 0x39, 0xBB, 0x43, 0x42, 0xBE, 0xCB, 0x6F, 0x02, 0xD4, 0xFF, 0x4D, 
+0x16, 0xE4, 0x91, 0x9C, 0xA6, 0x2F, 0x4C, 0x54, 0xB8, 0x7F, 0x60, 0x94, 0xC8, 0xA6, 0x2C, 0x01, 
+0x99, 0x17, 0xCE, 0x0B, 0xF7, 0x06, 0x4A, 0x03, 0xAD, 0x02, 0xC8, 0x92, 0xEC, 0x09, 0xEC, 0x01, 
+0x39, 0x1F, 0x6D, 0x4F, 0xD9, 0x65, 0x56, 0x54, 0xB9, 0x03, 0xDA, 0xF0, 0x75, 0x64, 0x0C, 0x96, 
+0x12, 0xD6, 0x21, 0x64, 0x64, 0x78, 0x03, 0x73, 0x3D, 0x8A, 0x54, 0xD9, 0x56, 0x88, 0x24, 0x09, 
+0x5E, 0xA4, 0xAE, 0x86, 0x9C, 0x96, 0xE1, 0x03, 0xCF, 0x3B, 0x59, 0x3B, 0x64, 0x68, 0x4F, 0x7E, 
+0xA3, 0xA9, 0x81, 0x59, 0x7D, 0x04, 0x9C, 0xF7, 0xDB, 0xE6, 0xE7, 0x68, 0xDF, 0xDB, 0x3A, 0x91, 
+0x63, 0x7D, 0xCF, 0x36, 0x82, 0xCD, 0xC0, 0xE4, 0xC3, 0x1E, 0xE1, 0xC4, 0x3B, 0x2D, 0x58, 0x95, 
+0x22, 0x13, 0x1F, 0x0E, 0x87, 0x24, 0x88, 0x81, 0x77, 0x55, 0xCD, 0xCB, 0xED, 0x49, 0x29, 0x91, 
+0x7F, 0x94, 0xFE, 0x3F, 0xBB, 0xED, 0xCB, 0xA6, 0xCA, 0x16, 0x6E, 0xC6, 0xDE, 0x7F, 0xDC, 0x82, 
+0xAF, 0x44, 0x1E, 0x98, 0x4C, 0x29, 0x03, 0x0A, 0x34, 0x05, 0x70, 0x61, 0x39, 0x30, 0x7D, 0x15, 
+0x32, 0x93, 0x43, 0x45, 0xB8, 0x7D, 0x10, 0xD0, 0x1A, 0xEA, 0xFE, 0x72, 0xE8, 0x93, 0x75, 0x81, 
+0xB8, 0x54, 0x54, 0xDF, 0x76, 0x2F, 0x21, 0xFB, 0x2B, 0x82, 0x17, 0xD9, 0xA4, 0xB5, 0x96, 0xD2, 
+0x09, 0xA0, 0x88, 0x10, 0x2A, 0x7D, 0x5D, 0x2C, 0x90, 0x85, 0x0D, 0x27, 0x84, 0x58, 0x9D, 0xCD, 
+0x3F, 0x73, 0x9A, 0x04, 0xD8, 0x6E, 0xD7, 0xDA, 0xBB, 0x66, 0x6F, 0x54, 0x3B, 0xE9, 0xC5, 0xE4, 
+0x86, 0x5F, 0xF2, 0x0C, 0x64, 0x64, 0xA6, 0x69, 0x8C, 0x4C, 0xA8, 0x8A, 0x70, 0x80, 0x52, 0x16, 
+0x5A, 0x5A, 0xB2, 0x9D, 0xCD, 0x0F, 0xEA, 0xD6, 0xBC, 0xEE, 0x3F, 0x87, 0x48, 0x33, 0xC0, 0xC0, 
+0x37, 0x90, 0xFF, 0xB7, 0x3E, 0xB8, 0x2E, 0x30, 0x8D, 0x0D, 0x36, 0x67, 0x7B, 0x42, 0x32, 0x17, 
+0x04, 0xAA, 0x12, 0xAE, 0x70, 0x44, 0xF9, 0xA1, 0x64, 0x28, 0xB0, 0x52, 0xA1, 0x1D, 0xBF, 0xB0, 
+0x13, 0x1C, 0xAD, 0xCB, 0x4C, 0xFA, 0x2F, 0xC4, 0xC4, 0xBA, 0x7B, 0x8C, 0x1C, 0xF4, 0x29, 0xD2, 
+0x87, 0x1F, 0x03, 0x80, 0x03, 0xDB, 0xBB, 0x2E, 0x93, 0x06, 0xE4, 0x56, 0xC3, 0xBA, 0xE5, 0xC2, 
+0xF9, 0x1D, 0x68, 0x40, 0x7E, 0x1A, 0x7C, 0x40, 0xFA, 0xC2, 0x88, 0x76, 0x3A, 0xF8, 0x88, 0x18, 
+0x67, 0x81, 0xF5, 0xF4, 0x9E, 0xEF, 0x57, 0x13, 0x25, 0x34, 0xFB, 0x4A, 0x31, 0xF6, 0x25, 0xBC, 
+0x9B, 0x3D, 0x0F, 0x5C, 0x83, 0x34, 0xA1, 0xB3, 0x89, 0x47, 0x31, 0x9B, 0xEF, 0x27, 0x54, 0x58, 
+0x27, 0x3A, 0x06, 0x71, 0x9A, 0xC1, 0xBA, 0xB2, 0x9E, 0x62, 0x50, 0x44, 0x14, 0xFB, 0x3E, 0x5C, 
+0xB0, 0x31, 0xDF, 0xAF, 0x94, 0x89, 0x5B, 0x6E, 0x50, 0x8A, 0xA0, 0xF4, 0xC6, 0xCA, 0x99, 0x41, 
+0x20, 0x81, 0x26, 0x52, 0xB7, 0xEF, 0xA4, 0xC0, 0xF4, 0x63, 0x62, 0xA1, 0x5E, 0x61, 0x65, 0x5E, 
+0x8B, 0x8D, 0x1F, 0xF8, 0xE6, 0x7B, 0x5B, 0x85, 0xE0, 0x5A, 0xCB, 0xC7, 0xF7, 0xD5, 0x19, 0xEA, 
+0x6C, 0x5B, 0x2A, 0x6C, 0xE6, 0xDA, 0x5B, 0x0C, 0xB6, 0x99, 0xDE, 0xF5, 0x92, 0x85, 0x8A, 0x11, 
+0xC4, 0x0B, 0x42, 0x4E, 0xBB, 0x48, 0xA9, 0x76, 0x52, 0xC3, 0x2D, 0x6D, 0xDE, 0x6C, 0x04, 0xF2, 
+0xF8, 0xD2, 0xE4, 0xCC, 0x18, 0x90, 0xBA, 0xD1, 0xC3, 0x11, 0xC7, 0x5B, 0xC2, 0x20, 0x57, 0x12, 
+0xA6, 0xB5, 0x9B, 0xBE, 0xE9, 0xB6, 0x65, 0x22, 0xCA, 0xA0, 0xCE, 0xD3, 0x6F, 0x89, 0x00, 0xF7, 
+0xB0, 0x63, 0x5D, 0xD8, 0xD4, 0xD8, 0xBB, 0x87, 0x30, 0xF7, 0xAC, 0x1C, 0x6B, 0xD7, 0xBE, 0x7E, 
+0x33, 0x2E, 0xC7, 0x7C, 0x49, 0xED, 0xCD, 0xDE, 0xF7, 0x85, 0xC2, 0xA3, 0x08, 0xCB, 0x20, 0x8B, 
+0x44, 0x34, 0x7C, 0xE8, 0x80, 0xF7, 0xB3, 0x83, 0x06, 0xB5, 0xBC, 0x97, 0x8E, 0xF7, 0x22, 0x1C, 
+0xF9, 0xC7, 0x9C, 0x25, 0x7D, 0x2A, 0x80, 0xFD, 0x2A, 0xC1, 0xFB, 0x75, 0x5F, 0x75, 0x5A, 0x4E, 
+0xDE, 0x63, 0x05, 0x30, 0xA1, 0x8A, 0x08, 0x15, 0xD7, 0xC7, 0x26, 0x04, 0xEA, 0x8F, 0x91, 0x79, 
+0x24, 0xAB, 0xAB, 0xF0, 0x7F, 0x45, 0xEC, 0x9B, 0x98, 0x81, 0xA5, 0xFB, 0x07, 0x7C, 0x54, 0x98, 
+0x60, 0x3B, 0x0C, 0xC4, 0x31, 0xC8, 0x1B, 0x7A, 0x1D, 0xBE, 0x23, 0x41, 0xF9, 0x58, 0x4B, 0x97, 
+0x44, 0xB8, 0x8A, 0xAE, 0x82, 0x5C, 0xDE, 0xA5, 0xDA, 0x35, 0x57, 0xEF, 0xD8, 0xA0, 0x84, 0x14, 
+0xE2, 0x18, 0x85, 0xA5, 0x79, 0xCC, 0x4B, 0x16, 0x63, 0x91, 0x88, 0xDE, 0xE9, 0x39, 0x53, 0xDB, 
+0xC8, 0x24, 0x57, 0xD8, 0x4A, 0xBA, 0x28, 0xA2, 0x77, 0x6A, 0x4A, 0xFA, 0x61, 0x02, 0x67, 0x2A, 
+0x6D, 0xFE, 0xA8, 0x5D, 0x6E, 0x06, 0xA5, 0x98, 0x81, 0xB1, 0x5E, 0xE8, 0x34, 0x72, 0x6C, 0x21, 
+0x10, 0x46, 0xB5, 0x3B, 0x34, 0x6F, 0x54, 0x7E, 0xAB, 0x23, 0xC0, 0x6E, 0xE0, 0xAF, 0x57, 0x48, 
+0xA3, 0x60, 0x55, 0x1A, 0x0B, 0xD2, 0x95, 0x32, 0xF2, 0xC2, 0xBC, 0x5A, 0xC6, 0x02, 0x79, 0x26, 
+0x4E, 0x23, 0xCE, 0x97, 0x35, 0x8D, 0xC2, 0x9D, 0x01, 0xA5, 0xBD, 0x35, 0x33, 0x58, 0x81, 0xC2, 
+0x28, 0xF7, 0xE5, 0xD6, 0x3F, 0x29, 0xAE, 0x4F, 0xBF, 0xBE, 0x71, 0xBD, 0xF8, 0x4E, 0xD5, 0x1A, 
+0xD8, 0xEE, 0xAB, 0x19, 0x6C, 0x43, 0x6F, 0x2A, 0x1E, 0x28, 0x9A, 0xEC, 0x69, 0xBB, 0xB7, 0x13, 
+0x16, 0x5B, 0xE5, 0xC8, 0x0E, 0xF7, 0xEB, 0xE3, 0x93, 0x17, 0xCB, 0x4E, 0xF4, 0x00, 0xA8, 0xE3, 
+0xC2, 0x3A, 0x5B, 0x66, 0xC1, 0x3B, 0xCE, 0xDA, 0x01, 0x0C, 0x07, 0x6B, 0x6E, 0x6E, 0xC2, 0xFF, 
+0x76, 0x2E, 0xD8, 0xDB, 0xF8, 0xF5, 0xB1, 0x59, 0x9D, 0xB1, 0xBD, 0xDC, 0x9B, 0xB8, 0x49, 0xBC, 
+0x9E, 0x5A, 0x8A, 0x46, 0xAD, 0xB8, 0x0A, 0xCE, 0x58, 0xCD, 0x94, 0xB8, 0x2B, 0xA3, 0x4A, 0x84, 
+0x9D, 0xE2, 0xB9, 0x26, 0xC7, 0xF7, 0xEB, 0x2B, 0x9D, 0x80, 0x18, 0xF4, 0xD1, 0x8C, 0x39, 0x4C, 
+0x9D, 0x47, 0xF3, 0x14, 0x98, 0xBD, 0xA4, 0x7C, 0xB6, 0x91, 0x19, 0x55, 0x94, 0x0B, 0x71, 0x8E, 
+0x1E, 0xC3, 0x6F, 0x4B, 0x94, 0x08, 0xBB, 0xDC, 0x6D, 0x1D, 0x92, 0x8E, 0x03, 0xD4, 0x44, 0xAA, 
+0x75, 0x12, 0x96, 0x91, 0x8D, 0xD6, 0x75, 0x8C, 0x38, 0x0D, 0xC0, 0x00, 0x9D, 0x9F, 0xF7, 0x6F, 
+0xA3, 0x90, 0xBD, 0xE2, 0x96, 0xC7, 0xC0, 0xA1, 0x10, 0xAC, 0x7B, 0x5E, 0xBF, 0xA3, 0x7D, 0x4B, 
+0xC7, 0x4C, 0x36, 0xFC, 0x22, 0x29, 0x11, 0xA4, 0x69, 0xF0, 0x87, 0xB6, 0xBD, 0xC5, 0x62, 0x0B, 
+0x55, 0x2D, 0xB0, 0xED, 0x5E, 0x74, 0x0D, 0xCE, 0x54, 0x7C, 0x62, 0x04, 0x29, 0x54, 0xE9, 0x28, 
+0xE7, 0x1A, 0x04, 0xB1, 0x8E, 0x42, 0x22, 0xE2, 0x42, 0x7B, 0x59, 0x7D, 0xA8, 0xF0, 0x0F, 0xA9, 
+0xD7, 0xC9, 0xA0, 0x46, 0x5B, 0xFE, 0x57, 0x86, 0x49, 0xB8, 0x53, 0xF6, 0x3F, 0xC2, 0xB9, 0x23, 
+0xF3, 0x02, 0x7A, 0x3A, 0x20, 0x33, 0x71, 0x74, 0xA8, 0x84, 0xB8, 0xB2, 0x72, 0xEF, 0x4A, 0x91, 
+0x74, 0x2A, 0x6D, 0x1E, 0xB3, 0x9A, 0x5F, 0x70, 0xF6, 0x2B, 0x95, 0x89, 0xB6, 0x68, 0xDB, 0xB6, 
+0xD5, 0xFA, 0xD9, 0x2D, 0x12, 0x7F, 0x07, 0x84, 0xD9, 0xB6, 0xA8, 0x93, 0x9D, 0xE3, 0x8B, 0xDF, 
+0x8D, 0x51, 0xCF, 0x22, 0xA2, 0x90, 0x6A, 0xB1, 0x69, 0xF9, 0x71, 0x59, 0x05, 0x2E, 0x5E, 0x90, 
+0x24, 0xDF, 0x94, 0x3F, 0x5F, 0x47, 0x1A, 0x33, 0x26, 0x40, 0xAB, 0x34, 0xF1, 0x42, 0xD3, 0x4B, 
+0x42, 0x92, 0x22, 0x24, 0xAE, 0x98, 0x33, 0xB6, 0xF5, 0x87, 0x96, 0x37, 0xC4, 0xBF, 0x64, 0xCB, 
+0x43, 0xFE, 0x4C, 0x1B, 0xC2, 0x25, 0xD9, 0x11, 0xA4, 0xB7, 0x18, 0xF5, 0xC1, 0x78, 0x99, 0x65, 
+0xE9, 0x94, 0x38, 0x55, 0x45, 0x50, 0x66, 0x7E, 0x5B, 0x66, 0x39, 0x21, 0xFD, 0x16, 0x18, 0xB9, 
+0x36, 0xA1, 0x93, 0xC1, 0x59, 0x58, 0x27, 0x32, 0x64, 0xA5, 0x5D, 0x64, 0xB9, 0x0D, 0x91, 0xC7, 
+0x8E, 0x32, 0x2D, 0x84, 0xEA, 0x25, 0x49, 0x62, 0x56, 0xF1, 0x87, 0x85, 0x8E, 0x9A, 0x24, 0xF3, 
+0xED, 0xDD, 0x77, 0x60, 0x51, 0xE2, 0xF6, 0xBD, 0x80, 0x2E, 0xA8, 0x18, 0x3C, 0x74, 0x08, 0xBB, 
+0x44, 0x54, 0x1E, 0x76, 0x7C, 0x15, 0xF8, 0x1D, 0xFC, 0x76, 0x74, 0x14, 0x2E, 0xD1, 0xAC, 0x03, 
+0xEC, 0x92, 0x67, 0x26, 0x59, 0xF2, 0x2B, 0x4E, 0x0B, 0x04, 0x0A, 0xE4, 0x57, 0xA0, 0xAD, 0xED, 
+0xB8, 0x46, 0xD6, 0xB1, 0x45, 0x39, 0xB7, 0xA4, 0x52, 0x24, 0xC9, 0xD0, 0x4E, 0x27, 0x47, 0x95, 
+0xAE, 0x16, 0xEB, 0x35, 0xEB, 0x75, 0x39, 0xD6, 0x2A, 0x6E, 0x96, 0xB0, 0x28, 0xFA, 0x9A, 0x68, 
+0x85, 0x31, 0x91, 0x45, 0x36, 0xDA, 0x74, 0x39, 0x24, 0x33, 0x41, 0xCC, 0xD2, 0xC7, 0x97, 0x40, 
+0x13, 0x13, 0xB3, 0x57, 0x69, 0x16, 0xAB, 0x72, 0x75, 0x22, 0x47, 0xFF, 0xBB, 0x62, 0xBA, 0x1C, 
+0xA6, 0x0B, 0x45, 0x93, 0x5E, 0x15, 0xFD, 0x85, 0x49, 0x6D, 0xF4, 0xFE, 0x0E, 0x5D, 0x90, 0x5A, 
+0xAA, 0xB3, 0xD1, 0x07, 0x83, 0xBD, 0xB9, 0x66, 0xD8, 0xDA, 0x9E, 0x7A, 0x35, 0xB4, 0xC0, 0xCA, 
+0x7E, 0x31, 0xE0, 0xFD, 0x66, 0xE6, 0xC4, 0x06, 0x2D, 0x6B, 0x84, 0xB1, 0x81, 0x7E, 0x5A, 0x52, 
+0xC6, 0x0F, 0x69, 0x10, 0xBA, 0x18, 0xD2, 0x20, 0xDB, 0xFE, 0xA5, 0xE7, 0xEB, 0x3E, 0x0C, 0xD8, 
+0xD3, 0x21, 0x50, 0xAA, 0x9C, 0xA7, 0xFE, 0xBB, 0xC5, 0xD7, 0x40, 0x48, 0x20, 0xCE, 0xB3, 0x61, 
+0xD2, 0x4D, 0x81, 0xD1, 0xAB, 0xD9, 0xCD, 0xBA, 0x3E, 0xCA, 0x69, 0x0C, 0xD1, 0xB1, 0x33, 0x76, 
+0x65, 0xAC, 0x0D, 0x9A, 0x78, 0x95, 0x06, 0x06, 0x87, 0x25, 0x23, 0x2F, 0x13, 0xCC, 0x9A, 0x7F, 
+0x20, 0xB6, 0xCF, 0xEA, 0x04, 0xA7, 0xD6, 0xEC, 0x10, 0x02, 0xB6, 0xCD, 0x42, 0x2E, 0xC6, 0xC9, 
+0xFE, 0x35, 0xFF, 0x56, 0xAC, 0xD5, 0x2A, 0xD3, 0xF2, 0x40, 0x20, 0x29, 0x31, 0x6A, 0x18, 0x31, 
+0x54, 0xDF, 0xF5, 0xA0, 0xE5, 0x5A, 0x66, 0x37, 0x8B, 0x53, 0x59, 0xE7, 0xED, 0x73, 0x85, 0x11, 
+0xB5, 0x42, 0xD5, 0xC4, 0x58, 0x87, 0xAC, 0x8B, 0xB4, 0xE9, 0xCD, 0xB2, 0x21, 0x05, 0x6E, 0x8C, 
+0xCD, 0xCE, 0x16, 0x4C, 0x0F, 0x98, 0xA3, 0x7C, 0xE2, 0x6B, 0x4E, 0x8D, 0x13, 0x02, 0x28, 0x74, 
+0x91, 0x11, 0xEF, 0xA0, 0x52, 0xC3, 0x25, 0x1F, 0x6D, 0xD0, 0xA5, 0x62, 0xA5, 0x30, 0xD0, 0xAF, 
+0x79, 0x08, 0xAB, 0x15, 0x25, 0x68, 0x6C, 0xE3, 0x17, 0x0E, 0x03, 0x63, 0x5C, 0x17, 0x2E, 0x9A, 
+0x6C, 0xB4, 0xA5, 0x2E, 0xC3, 0xFF, 0x2E, 0xA9, 0xF8, 0xDA, 0xBB, 0xF0, 0x88, 0xF1, 0x22, 0x7B, 
+0x16, 0x4B, 0xFD, 0xB7, 0x9F, 0xBA, 0x6A, 0x93, 0xB5, 0x46, 0x6C, 0x9C, 0x00, 0x2F, 0x7A, 0xDC, 
+0xFA, 0x41, 0xEC, 0xF7, 0x82, 0x94, 0x81, 0x27, 0x50, 0x78, 0xEB, 0xC4, 0x1B, 0x5B, 0x28, 0xB3, 
+0xFC, 0x79, 0x12, 0xC5, 0xB8, 0xEB, 0x62, 0x5D, 0x17, 0xCB, 0x50, 0x1C, 0xE5, 0x4F, 0x1D, 0x94, 
+0xC5, 0x48, 0xB0, 0xA3, 0x64, 0xFE, 0xBF, 0x41, 0x48, 0x66, 0x08, 0x18, 0xAC, 0xE4, 0x0C, 0x14, 
+0x81, 0x80, 0x67, 0x3D, 0xD8, 0xC1, 0x38, 0xF4, 0x0C, 0xA3, 0x9A, 0x7F, 0x15, 0x54, 0x2E, 0x88, 
+0xE1, 0xB0, 0x97, 0x58, 0x27, 0x5D, 0x69, 0xAE, 0x4F, 0xDC, 0x48, 0x65, 0xD7, 0x00, 0x8D, 0xFA, 
+0x7A, 0x56, 0xEC, 0xE0, 0xCC, 0xE4, 0x88, 0x7A, 0xF4, 0xD0, 0xCF, 0xCD, 0xAE, 0x4C, 0x4E, 0xA5, 
+0xEC, 0x2D, 0x58, 0x75, 0xE0, 0x84, 0xFC, 0x53, 0x30, 0x14, 0x42, 0x6E, 0x51, 0x45, 0x89, 0x92, 
+0x94, 0xC7, 0x23, 0x47, 0x33, 0xAB, 0x41, 0x99, 0x47, 0x8E, 0x8A, 0x09, 0x97, 0xE5, 0x7E, 0x14, 
+0xB6, 0xF1, 0x47, 0xC6, 0xDB, 0x68, 0x29, 0xE3, 0x90, 0x3C, 0xC2, 0x96, 0xD3, 0xE5, 0xB2, 0xDE, 
+0x91, 0x53, 0xDC, 0xCB, 0x3C, 0x8B, 0xC2, 0x35, 0x28, 0x76, 0xE1, 0xA4, 0x9E, 0x5A, 0x92, 0x0C, 
+0x6B, 0x0A, 0x6A, 0xA9, 0x57, 0x24, 0xF3, 0xBE, 0x1C, 0x4F, 0x52, 0xF8, 0xE0, 0x15, 0xD6, 0x62, 
+0x79, 0x02, 0x27, 0x38, 0x21, 0x9F, 0x59, 0x49, 0x03, 0x07, 0x33, 0x20, 0x09, 0x93, 0x95, 0x4B, 
+0x33, 0x5B, 0x26, 0x3D, 0x8D, 0x40, 0x39, 0xEE, 0x71, 0x28, 0xBB, 0x1B, 0xAC, 0xCB, 0x9B, 0x1B, 
+0x10, 0x6F, 0xFB, 0xA6, 0x3F, 0x93, 0xC8, 0x1B, 0x3A, 0xC6, 0x4D, 0x7F, 0x4E, 0x5C, 0x2F, 0xF2, 
+0xC8, 0x68, 0xC2, 0x99, 0x50, 0xE2, 0xDB, 0x39, 0x42, 0xB2, 0x15, 0xB9, 0x18, 0x5E, 0xAC, 0xCC, 
+0xCC, 0x3D, 0xE5, 0xDA, 0x9A, 0x5A, 0x78, 0x90, 0x92, 0xAE, 0x22, 0x3D, 0x33, 0x91, 0x85, 0x1F, 
+0x92, 0x39, 0x77, 0x03, 0xFC, 0x79, 0xDA, 0x8F, 0x1E, 0xC3, 0x26, 0x22, 0x9B, 0x5A, 0x56, 0x7D, 
+0x82, 0xAA, 0xC2, 0x24, 0x35, 0x78, 0x0B, 0x90, 0xC2, 0xAF, 0x7F, 0x43, 0xB1, 0xC2, 0x5B, 0x12, 
+0x1B, 0xBB, 0xBE, 0xFB, 0x5C, 0x32, 0x66, 0x67, 0x1B, 0x81, 0x2A, 0x5D, 0xC3, 0x84, 0xCE, 0x47, 
+0xEB, 0xE8, 0x01, 0x2B, 0xFE, 0x74, 0x3A, 0xAE, 0x56, 0x8C, 0xBF, 0x61, 0xF4, 0xF3, 0x9B, 0x1C, 
+0x34, 0x9A, 0x43, 0x2A, 0x5D, 0xB0, 0xF8, 0x43, 0x06, 0x3B, 0xD8, 0x96, 0x93, 0xCF, 0xB2, 0x0D, 
+0x26, 0x24, 0xF2, 0x4F, 0x61, 0xB6, 0x98, 0x16, 0xE7, 0xE7, 0x95, 0x7A, 0x45, 0x2A, 0x12, 0x79, 
+0x83, 0x6B, 0x29, 0xC2, 0x8C, 0x22, 0x7F, 0xC0, 0x3E, 0xE7, 0x7E, 0xB4, 0xAD, 0x6D, 0xB4, 0x6E, 
+0xD7, 0x18, 0x6D, 0x89, 0x6A, 0xCB, 0xAD, 0x11, 0x4F, 0xB0, 0x2F, 0x88, 0xC7, 0x49, 0x07, 0x72, 
+0xC9, 0xF5, 0xD6, 0x6F, 0x49, 0xDA, 0xE2, 0xF3, 0xCE, 0x9C, 0xAF, 0xCA, 0xE9, 0xB2, 0xA9, 0xBA, 
+0x83, 0xFE, 0x49, 0x9F, 0x9A, 0x41, 0x5C, 0x59, 0x04, 0x90, 0x06, 0x53, 0xEE, 0xA0, 0x12, 0x2D, 
+0x5D, 0x2E, 0x96, 0x6E, 0x21, 0x66, 0x88, 0xB4, 0x9D, 0x1E, 0x2E, 0xAE, 0xBA, 0x03, 0x95, 0xED, 
+0x24, 0xCA, 0x62, 0x9E, 0xC7, 0xEA, 0x26, 0xE1, 0xA4, 0x9C, 0x85, 0x5D, 0x5B, 0x98, 0xA8, 0x28, 
+0xA4, 0x58, 0xB5, 0x8C, 0xBC, 0xCC, 0x43, 0x21, 0x6E, 0xD6, 0x20, 0x9F, 0x9D, 0xB2, 0x89, 0xE7, 
+0x5E, 0xDA, 0x59, 0x8A, 0xC6, 0x57, 0x67, 0x12, 0xD0, 0x74, 0x91, 0x87, 0x1A, 0xE6, 0xF7, 0x36, 
+0xB1, 0x04, 0xB4, 0x74, 0xF5, 0x17, 0x72, 0x6E, 0xCA, 0xEA, 0x01, 0x20, 0x93, 0x42, 0x72, 0x1E, 
+0xEB, 0x46, 0xC7, 0x1C, 0x7F, 0x7A, 0x91, 0xF3, 0xDD, 0xEA, 0x8E, 0xE3, 0xE9, 0x83, 0x83, 0x39, 
+0x0E, 0x35, 0xB6, 0x06, 0x2E, 0xA4, 0x60, 0x20, 0xC9, 0x97, 0x82, 0x98, 0x88, 0xBB, 0x1B, 0x9A, 
+0x88, 0xD4, 0xB2, 0xEB, 0x2A, 0x53, 0x67, 0xB0, 0xCB, 0xC2, 0x5C, 0xF8, 0x10, 0x0D, 0x24, 0x8A, 
+0x2A, 0x89, 0x54, 0xD5, 0x71, 0xB5, 0x78, 0x06, 0x4D, 0x18, 0x9F, 0x89, 0x54, 0xAF, 0x29, 0xB6, 
+0xCF, 0xA5, 0x1A, 0x51, 0x72, 0xBE, 0x43, 0xCB, 0xDA, 0xA5, 0x5A, 0x24, 0x81, 0xA3, 0x36, 0x38, 
+0xD3, 0x89, 0x61, 0x5B, 0x49, 0x26, 0x6D, 0xD4, 0x6A, 0x5D, 0xED, 0x71, 0xB0, 0x3F, 0x3E, 0xBB, 
+0xA8, 0x94, 0x32, 0xAD, 0xB0, 0xAC, 0x08, 0x79, 0x01, 0x90, 0xE3, 0xFE, 0x1B, 0xAF, 0xB5, 0x38, 
+0x94, 0x57, 0xA3, 0x74, 0x7D, 0xBF, 0xB7, 0xF1, 0xF7, 0x8B, 0x9A, 0x44, 0x87, 0x47, 0x3B, 0x94, 
+0xC8, 0x97, 0x82, 0x82, 0x0F, 0x2B, 0x55, 0x81, 0xCF, 0x9B, 0x69, 0xCC, 0x69, 0x28, 0xBF, 0xAB, 
+0x4F, 0x27, 0x8C, 0x47, 0xF0, 0x00, 0x66, 0x42, 0x57, 0xE5, 0x9A, 0xAE, 0xEA, 0x8E, 0xC4, 0x60, 
+0x11, 0x34, 0x9A, 0xC2, 0xDF, 0x10, 0x6F, 0xBB, 0x2E, 0x57, 0x70, 0x0C, 0x7F, 0x58, 0x66, 0x01, 
+0xB9, 0x49, 0x47, 0x88, 0xF2, 0x2C, 0x99, 0x22, 0x2A, 0x5D, 0xD7, 0x7D, 0x4C, 0xC6, 0x6E, 0xA7, 
+0x6B, 0x4B, 0x6B, 0xBC, 0x73, 0x1E, 0xF1, 0x4D, 0x1B, 0x94, 0x03, 0x66, 0x40, 0x60, 0x2E, 0x85, 
+0xB0, 0xFC, 0xEE, 0x00, 0x7A, 0x50, 0xBB, 0x6A, 0x4E, 0xC2, 0xB6, 0x78, 0xBA, 0xDA, 0xF9, 0xF1, 
+0xA9, 0x30, 0xA4, 0x7D, 0xFD, 0xE0, 0x14, 0xD4, 0xD8, 0x5B, 0xFE, 0x8F, 0xA0, 0x1B, 0x68, 0x12, 
+0x6B, 0x47, 0x25, 0x41, 0x56, 0x54, 0x0B, 0x28, 0x81, 0xEA, 0x00, 0x89, 0x54, 0x07, 0xC4, 0x40, 
+0xC5, 0x40, 0xEE, 0x78, 0x66, 0xAB, 0xA2, 0xE7, 0x1F, 0xF6, 0xF7, 0xB6, 0x13, 0x47, 0xA7, 0x1B, 
+0xD4, 0xA4, 0xB0, 0x9A, 0xAC, 0xC5, 0xD7, 0xE2, 0x2D, 0x9B, 0x1F, 0x38, 0x15, 0x29, 0xA4, 0x86, 
+0x82, 0x60, 0xA9, 0x41, 0x4F, 0xC1, 0xC5, 0x34, 0x06, 0x66, 0x7A, 0x2A, 0xFD, 0x93, 0xF7, 0xC8, 
+0x1B, 0x8F, 0x4D, 0xB2, 0xB0, 0x83, 0x1B, 0xA9, 0x0B, 0xD2, 0xA7, 0xDA, 0x5D, 0x4D, 0xE4, 0x34, 
+0xB1, 0x24, 0xD9, 0x5D, 0xA1, 0x61, 0xB0, 0x59, 0x34, 0xA8, 0xA1, 0x68, 0xD2, 0xD7, 0x4D, 0xC3, 
+0xCE, 0x7B, 0x6D, 0x4F, 0x75, 0x9B, 0x1A, 0x90, 0xC3, 0x20, 0x31, 0x9F, 0x97, 0xE2, 0x82, 0x5E, 
+0x28, 0xA0, 0xE1, 0x60, 0xD4, 0xBC, 0x64, 0x16, 0x37, 0x72, 0x86, 0x03, 0x17, 0xB5, 0x07, 0xED, 
+0x7C, 0xC3, 0x54, 0xAC, 0xBA, 0x52, 0xFD, 0x0B, 0xCA, 0x6B, 0x02, 0xF6, 0x47, 0x96, 0xE4, 0xFA, 
+0x7D, 0xD6, 0x84, 0xA2, 0x88, 0xD4, 0xFD, 0xB4, 0x5C, 0x9E, 0x4A, 0x79, 0xAD, 0xA5, 0x28, 0xED, 
+0x92, 0xD9, 0x8B, 0x72, 0x13, 0xC7, 0x03, 0xC1, 0x7D, 0x40, 0x23, 0xDA, 0x79, 0x4B, 0x37, 0x12, 
+0x17, 0xE9, 0x7E, 0x95, 0xA9, 0x93, 0x74, 0x99, 0x41, 0x75, 0xB1, 0xB5, 0x9D, 0x29, 0x24, 0xB6, 
+0x0D, 0x80, 0x30, 0xE7, 0x67, 0x63, 0x05, 0x55, 0x7F, 0x77, 0x21, 0xCB, 0x6A, 0xDC, 0x4E, 0xA2, 
+0xD6, 0x61, 0x29, 0xB5, 0x76, 0x45, 0x9D, 0xFF, 0x68, 0x6D, 0x45, 0x9F, 0xB4, 0x9F, 0x35, 0x7A, 
+0xCB, 0x77, 0x85, 0xD0, 0x35, 0x45, 0x33, 0x64, 0x01, 0xEE, 0x47, 0xF8, 0x9B, 0x4E, 0x96, 0xC0, 
+0x73, 0x6C, 0x4F, 0x09, 0xB6, 0x53, 0xF3, 0xCE, 0x86, 0x1C, 0xF9, 0xE8, 0x60, 0xA7, 0x17, 0xA5, 
+0x94, 0x5C, 0x04, 0x0A, 0x89, 0x7C, 0x1E, 0x34, 0x43, 0xF1, 0x02, 0x74, 0x3A, 0x6D, 0xC5, 0xF8, 
+0xC8, 0x20, 0x43, 0x21, 0x82, 0xE6, 0xF6, 0xF9, 0x7F, 0x83, 0xFA, 0xEF, 0xFF, 0xC3, 0xF2, 0x72, 
+0xE3, 0x9B, 0xEE, 0x43, 0xAB, 0x2B, 0xCA, 0x7D, 0xC3, 0x79, 0x6B, 0x68, 0x6B, 0x3C, 0xBB, 0xB2, 
+0x9E, 0xA4, 0x40, 0x23, 0x3C, 0xAF, 0x57, 0xD4, 0xFF, 0xE6, 0xFA, 0x8F, 0x48, 0x03, 0x11, 0x84, 
+0x8F, 0xF9, 0xD3, 0xF4, 0xBB, 0x2C, 0x2E, 0xB3, 0x30, 0xA9, 0x52, 0xA7, 0x8A, 0xA2, 0x41, 0x47, 
+0x38, 0x51, 0x67, 0x65, 0x99, 0x2C, 0x99, 0xA6, 0x4D, 0x8C, 0xB8, 0x9F, 0x22, 0xFC, 0x0E, 0x91, 
+0x05, 0xC3, 0x2C, 0x1C, 0xF8, 0xC9, 0x63, 0xDC, 0xA0, 0xC2, 0x38, 0x64, 0xCD, 0x54, 0xD7, 0x57, 
+0x52, 0x10, 0x59, 0x6B, 0x42, 0x2A, 0xAB, 0xCD, 0xAE, 0x4B, 0x48, 0x71, 0x1E, 0x75, 0x6C, 0x7A, 
+0x5A, 0x35, 0xE0, 0x44, 0x05, 0x18, 0x6F, 0xC4, 0x52, 0xB0, 0xCA, 0x36, 0x7F, 0x20, 0x23, 0x2E, 
+0x02, 0x02, 0x33, 0x7B, 0xAF, 0x22, 0x05, 0xBF, 0x52, 0xF5, 0xE8, 0xA0, 0xFA, 0x8C, 0x7B, 0x2D, 
+0x08, 0x5B, 0xA0, 0x87, 0x0B, 0xAD, 0x76, 0x25, 0x24, 0x89, 0x9C, 0x17, 0x16, 0xA6, 0x1A, 0xC3, 
+0xA0, 0x4D, 0x0C, 0x5B, 0x12, 0x22, 0x4D, 0xD3, 0x08, 0x01, 0xB4, 0x0D, 0x2F, 0x51, 0xF9, 0x59, 
+0x6E, 0xB0, 0xDC, 0xD0, 0x8B, 0xC1, 0xC5, 0xDF, 0x2E, 0x38, 0x77, 0x4A, 0xCF, 0xC4, 0x3C, 0xE1, 
+0x2E, 0xDA, 0x3F, 0xF8, 0x8A, 0x3E, 0xF3, 0x0F, 0xFB, 0xC2, 0xAF, 0x12, 0x65, 0x0B, 0x1F, 0x6B, 
+0xF8, 0x7D, 0xE1, 0x66, 0x6D, 0xB6, 0x94, 0x11, 0xAE, 0xA6, 0x98, 0xCB, 0x0F, 0x1F, 0x6B, 0x4A, 
+0x9F, 0x77, 0xBA, 0x72, 0x13, 0x3B, 0x8C, 0xD1, 0x85, 0x10, 0x4E, 0x9E, 0xC3, 0x13, 0x5F, 0x3A, 
+0x36, 0xA5, 0xE3, 0x29, 0xFB, 0xC2, 0xFA, 0x00, 0xD3, 0x16, 0x3D, 0x10, 0x81, 0x96, 0xBA, 0xDE, 
+0x9A, 0x5E, 0x37, 0xD7, 0x36, 0xC6, 0x5D, 0x6D, 0x7D, 0x69, 0x51, 0xF6, 0x02, 0x90, 0xAA, 0x5B, 
+0x61, 0x46, 0x9C, 0x8C, 0x5A, 0x4B, 0xAA, 0x2E, 0x1E, 0x50, 0x0F, 0xD7, 0xCC, 0x11, 0xF0, 0x6F, 
+0xDB, 0xC1, 0xD5, 0xCB, 0xD5, 0xA4, 0xC0, 0x20, 0x2E, 0xB4, 0x03, 0x66, 0xDE, 0xC3, 0xBA, 0x58, 
+0xDE, 0xD3, 0x53, 0xEE, 0x3D, 0x14, 0x35, 0x93, 0xA1, 0xE1, 0x0C, 0x3B, 0x3A, 0xA5, 0xBD, 0xA5, 
+0x90, 0x11, 0x09, 0x8C, 0xCA, 0x17, 0xE8, 0x6D, 0xF9, 0x08, 0xD5, 0x58, 0x19, 0x1A, 0xAF, 0x83, 
+0x1A, 0x96, 0x93, 0xD7, 0xE3, 0x2A, 0xBF, 0x9B, 0x54, 0xD0, 0xAD, 0x47, 0x87, 0x60, 0xCF, 0xBE, 
+0xE3, 0x28, 0x26, 0x58, 0xDA, 0x07, 0x59, 0x87, 0x0C, 0x9B, 0xA1, 0xF0, 0x4A, 0x5B, 0xC8, 0x8C, 
+0x81, 0x0A, 0x8E, 0x49, 0x3D, 0x6E, 0x5A, 0xA8, 0xC6, 0xD9, 0xC6, 0xDB, 0x3C, 0xF6, 0xE0, 0x21, 
+0x55, 0xF0, 0xF2, 0xC8, 0x09, 0x1A, 0xD0, 0xE4, 0x04, 0xD5, 0xC2, 0x72, 0xE2, 0xDA, 0xAE, 0xB9, 
+0x81, 0x43, 0xF4, 0x52, 0x8D, 0x9E, 0x50, 0x1D, 0x07, 0x43, 0xE9, 0x8E, 0x48, 0x7A, 0x40, 0x40, 
+0x6D, 0x4F, 0x2D, 0xE5, 0x5A, 0xB6, 0x58, 0xCA, 0xF6, 0x30, 0x4A, 0x9D, 0x10, 0x42, 0x3B, 0x39, 
+0xA4, 0x0B, 0x9D, 0xD1, 0xDE, 0xCE, 0xB2, 0x2C, 0x31, 0xE6, 0x52, 0xF2, 0xD6, 0x11, 0x06, 0x4E, 
+0x30, 0x93, 0x1C, 0x57, 0x01, 0x0D, 0x29, 0xEF, 0x05, 0x81, 0x3C, 0x9E, 0x7F, 0x53, 0xFE, 0x10, 
+0x15, 0x4A, 0x54, 0x5F, 0xD1, 0x73, 0x19, 0x46, 0xAF, 0x59, 0x43, 0x0D, 0x3B, 0x13, 0x3F, 0x3B, 
+0xD9, 0x71, 0x30, 0x3F, 0x3A, 0xD0, 0x42, 0x16, 0xF2, 0x3B, 0xBD, 0x07, 0x47, 0xB5, 0x20, 0xA2, 
+0xCB, 0xF9, 0x2A, 0x98, 0x46, 0x9C, 0x75, 0xCD, 0xC5, 0x11, 0x53, 0xE8, 0xC4, 0x48, 0x17, 0xF9, 
+0x50, 0x0B, 0x30, 0xE1, 0x68, 0x25, 0xD7, 0x25, 0x3A, 0x41, 0xA4, 0x8C, 0xEA, 0x57, 0xE0, 0xD9, 
+0x38, 0x28, 0x57, 0x73, 0x35, 0xCD, 0x75, 0xB8, 0xB6, 0x3C, 0xD1, 0xD6, 0x3D, 0xCF, 0x78, 0x26, 
+0x9F, 0x60, 0xF9, 0xF9, 0x6F, 0x81, 0x8A, 0x0D, 0xC4, 0x69, 0x3D, 0x05, 0x1F, 0xC8, 0x31, 0x2D, 
+0xE6, 0x11, 0xA1, 0x60, 0x4A, 0xC0, 0xE9, 0x81, 0x97, 0xD3, 0x28, 0x74, 0xDA, 0xA7, 0xAA, 0x16, 
+0x5C, 0xE2, 0xC5, 0x69, 0x03, 0x78, 0x73, 0xB8, 0xC2, 0xC5, 0x69, 0x32, 0xDC, 0xE0, 0x22, 0x2A, 
+0xAA, 0x7E, 0x3B, 0x91, 0xA3, 0x05, 0x9B, 0x63, 0xE3, 0x81, 0x10, 0xE1, 0x6D, 0xF2, 0x54, 0xF3, 
+0xD3, 0xE4, 0x56, 0x33, 0xE6, 0xFD, 0x79, 0xCD, 0x38, 0xF2, 0x0C, 0xC1, 0x6F, 0x9A, 0x84, 0xB1, 
+0x82, 0x8E, 0xC7, 0x14, 0x32, 0x53, 0x0A, 0xB4, 0xF2, 0xCF, 0x40, 0x6D, 0x7F, 0x1B, 0x4F, 0x22, 
+0x06, 0x64, 0x7F, 0x2F, 0xE6, 0xF5, 0xC1, 0xE2, 0x4B, 0xE4, 0xE8, 0x40, 0xE4, 0x8A, 0x55, 0x8A, 
+0xD3, 0xD8, 0x15, 0x29, 0x44, 0x30, 0x1C, 0x54, 0x3A, 0x2B, 0x1D, 0xFD, 0xA8, 0x5F, 0x2C, 0xA3, 
+0x52, 0xD7, 0x86, 0x91, 0x4B, 0x64, 0x8D, 0x68, 0x1C, 0x3C, 0xC2, 0xEE, 0xB1, 0xA3, 0x70, 0x40, 
+0x63, 0xE0, 0x41, 0x00, 0xD6, 0x2B, 0xB9, 0x96, 0x61, 0x98, 0xE0, 0x01, 0x35, 0xC8, 0xA7, 0x7F, 
+0x0A, 0xE6, 0xB6, 0x01, 0xE7, 0x82, 0x3F, 0xD9, 0x88, 0xCE, 0x92, 0x56, 0xBE, 0x97, 0xFC, 0x77, 
+0x1A, 0x6C, 0xF9, 0x4C, 0x4B, 0x2C, 0xC3, 0x31, 0x8B, 0xBA, 0xCF, 0x51, 0x93, 0x43, 0xA1, 0xFD, 
+0xC1, 0xFD, 0x95, 0xB6, 0x89, 0x70, 0x39, 0x45, 0x2E, 0x1D, 0x96, 0x00, 0xAE, 0x1C, 0x6D, 0x04, 
+0xFB, 0x95, 0xF0, 0x4E, 0x19, 0x35, 0x0C, 0x32, 0x08, 0xF4, 0xFC, 0x1A, 0x7E, 0xAF, 0x3A, 0xE2, 
+0x7F, 0x13, 0xDA, 0x3C, 0x70, 0x70, 0x8D, 0xD7, 0x63, 0x8E, 0x83, 0xF6, 0x58, 0xF5, 0x99, 0x96, 
+0xB9, 0xFA, 0x70, 0x04, 0x83, 0x99, 0x24, 0x83, 0x9A, 0xE3, 0x5C, 0x1A, 0xC8, 0xC4, 0xEF, 0xB8, 
+0x4C, 0x56, 0x5D, 0x8C, 0x02, 0x1E, 0xE1, 0x0B, 0x75, 0x2C, 0xB5, 0x98, 0x34, 0x2C, 0xD8, 0x70, 
+0x5F, 0xD8, 0x5C, 0xEB, 0xFE, 0xF1, 0xFB, 0xD6, 0xB0, 0x7D, 0xAE, 0xD3, 0xBB, 0x27, 0x3E, 0x26, 
+0x13, 0x0C, 0x12, 0x87, 0xFF, 0x91, 0x0B, 0x94, 0x74, 0xCD, 0x03, 0x8E, 0x07, 0xFE, 0xFF, 0xC3, 
+0xC8, 0x12, 0x80, 0x0F, 0x8D, 0xF9, 0xC1, 0xF8, 0x1E, 0xFC, 0x8E, 0x5F, 0x87, 0x47, 0xE6, 0xC1, 
+0x4B, 0x71, 0xB8, 0xD3, 0xAD, 0x0F, 0x31, 0xAF, 0x6C, 0xA9, 0xCC, 0xE9, 0x43, 0x3B, 0x67, 0xA0, 
+0x79, 0x8E, 0xDF, 0x47, 0x97, 0xD1, 0x57, 0x88, 0x16, 0xDA, 0x46, 0x06, 0x88, 0xDA, 0x1E, 0x05, 
+0xBE, 0x1A, 0x40, 0xA1, 0x13, 0x55, 0x98, 0x71, 0xE7, 0xBC, 0x43, 0x39, 0xC0, 0x40, 0xA5, 0xCB, 
+0xDA, 0x5A, 0xD4, 0x6A, 0xD3, 0x9E, 0x0A, 0x45, 0x3B, 0xE4, 0x37, 0xEB, 0xC1, 0xF5, 0x9E, 0x5D, 
+0xC2, 0x60, 0x0B, 0x39, 0x06, 0xF2, 0x50, 0xD3, 0xBA, 0x06, 0x12, 0xBC, 0xC7, 0x1B, 0xBF, 0xAC, 
+0xBB, 0x27, 0x93, 0xF6, 0x62, 0xD3, 0x08, 0x04, 0x5F, 0x24, 0x22, 0x8C, 0x56, 0x52, 0xDB, 0xFB, 
+0x3C, 0xD4, 0xF5, 0xFC, 0x2D, 0x0F, 0xA7, 0x87, 0x6F, 0x16, 0xF6, 0x08, 0x49, 0x08, 0x4C, 0x22, 
+0xB5, 0x26, 0x2D, 0xB8, 0xB3, 0x10, 0xAF, 0x8C, 0x7A, 0xEF, 0x05, 0x82, 0x15, 0x9D, 0x76, 0xC6, 
+0x0C, 0xF2, 0xDB, 0xFC, 0x25, 0x42, 0x97, 0x5C, 0x48, 0xBA, 0x19, 0x6B, 0x0F, 0x21, 0xA3, 0xBD, 
+0xCF, 0xEF, 0xC3, 0x4F, 0x1C, 0x96, 0x82, 0x51, 0x70, 0x3E, 0xB5, 0x0E, 0x6B, 0x1F, 0xF0, 0x9F, 
+0x59, 0x44, 0x0A, 0xD7, 0x68, 0xAD, 0x54, 0x73, 0x79, 0xD4, 0xC9, 0xF9, 0xCA, 0x7D, 0x34, 0x84, 
+0x20, 0xA9, 0x34, 0x08, 0x42, 0xA1, 0x05, 0x2C, 0x49, 0x9D, 0x6E, 0x86, 0x88, 0x2D, 0x5A, 0x7C, 
+0x4B, 0xF4, 0x9A, 0x69, 0x50, 0x18, 0xC4, 0x7A, 0xA9, 0x4A, 0x1B, 0x50, 0xC3, 0x05, 0x9F, 0x90, 
+0x4A, 0x33, 0xCB, 0xD4, 0x5B, 0x77, 0x62, 0x7E, 0xAD, 0x54, 0x07, 0x6F, 0x0E, 0x38, 0x13, 0xAB, 
+0xD9, 0xEC, 0x5B, 0x4A, 0xCF, 0x70, 0x75, 0x10, 0xF9, 0x67, 0x41, 0xCA, 0xD0, 0x6A, 0xFE, 0x37, 
+0x41, 0x1D, 0xFD, 0xEB, 0x11, 0x5E, 0xD3, 0x9F, 0x2B, 0x6F, 0x85, 0x92, 0x26, 0xBA, 0xDE, 0x14, 
+0x1E, 0x49, 0x83, 0x58, 0x34, 0xAC, 0x80, 0xD0, 0x43, 0xD4, 0xC6, 0xBB, 0x04, 0x00
+};
+
+const size_t login_html_len = 5182;
+const size_t login_html_br_len = 4301;
+const size_t login_html_size = 21200; // Uncompressed
+const char login_html_hash[] = "89413f2e";
+
+#endif
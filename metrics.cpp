@@ -0,0 +1,97 @@
+#include "metrics.h"
+
+MetricsWriter::MetricsWriter(Print& out) : out(out), used(0) {}
+
+MetricsWriter::~MetricsWriter() {
+    flush();
+}
+
+void MetricsWriter::family(const char* name, const char* type, const char* help) {
+    writeRaw("# HELP ");
+    writeRaw(name);
+    writeRaw(" ");
+    writeRaw(help);
+    writeRaw("\n# TYPE ");
+    writeRaw(name);
+    writeRaw(" ");
+    writeRaw(type);
+    writeRaw("\n");
+}
+
+void MetricsWriter::sample(const char* name, unsigned long value, const char* labels) {
+    writeName(name, labels);
+    char text[16];
+    snprintf(text, sizeof(text), " %lu\n", value);
+    writeRaw(text);
+}
+
+void MetricsWriter::sample(const char* name, float value, const char* labels) {
+    writeName(name, labels);
+    char text[24];
+    if (isnan(value)) strcpy(text, " NaN\n");
+    else snprintf(text, sizeof(text), " %.3f\n", value);
+    writeRaw(text);
+}
+
+void MetricsWriter::counter(const char* name, const char* help, unsigned long value) {
+    family(name, "counter", help);
+    sample(name, value);
+}
+
+void MetricsWriter::gauge(const char* name, const char* help, unsigned long value) {
+    family(name, "gauge", help);
+    sample(name, value);
+}
+
+void MetricsWriter::gauge(const char* name, const char* help, float value) {
+    family(name, "gauge", help);
+    sample(name, value);
+}
+
+void MetricsWriter::histogram(const char* name, const char* labels, const uint32_t* bounds, const unsigned long* counts,
+                              int buckets, double sum, double scale) {
+    char series[64];
+    char bucketLabels[128];
+    char text[32];
+    unsigned long cumulative = 0;
+
+    snprintf(series, sizeof(series), "%s_bucket", name);
+    for (int i = 0; i <= buckets; ++i) {
+        cumulative += counts[i];
+        if (i < buckets) snprintf(text, sizeof(text), "%g", bounds[i] / scale);
+        else strcpy(text, "+Inf");
+        snprintf(bucketLabels, sizeof(bucketLabels), "%s%sle=\"%s\"", labels ? labels : "", labels ? "," : "", text);
+        sample(series, cumulative, bucketLabels);
+    }
+
+    snprintf(series, sizeof(series), "%s_sum", name);
+    writeName(series, labels);
+    snprintf(text, sizeof(text), " %.6f\n", sum / scale);
+    writeRaw(text);
+
+    snprintf(series, sizeof(series), "%s_count", name);
+    sample(series, cumulative, labels);
+}
+
+void MetricsWriter::flush() {
+    if (used > 0) {
+        out.write((const uint8_t*)buffer, used);
+        used = 0;
+    }
+}
+
+void MetricsWriter::writeName(const char* name, const char* labels) {
+    writeRaw(name);
+    if (labels) {
+        writeRaw("{");
+        writeRaw(labels);
+        writeRaw("}");
+    }
+}
+
+void MetricsWriter::writeRaw(const char* text) {
+    while (*text) {
+        if (used == BUFFER_SIZE) flush();
+        buffer[used++] = *text++;
+    }
+}
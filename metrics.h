@@ -0,0 +1,47 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+// ==========================================
+// Metrics Writer
+// ==========================================
+// Prometheus text exposition format through a small fixed buffer into any
+// Print sink, same as JsonStreamWriter does for JSON.
+class MetricsWriter {
+public:
+    explicit MetricsWriter(Print& out);
+    ~MetricsWriter();
+
+    // "# HELP" and "# TYPE" lines, once per metric family
+    void family(const char* name, const char* type, const char* help);
+    // One series; labels is the inside of the braces, e.g. "route=\"/data\""
+    void sample(const char* name, unsigned long value, const char* labels = nullptr);
+    void sample(const char* name, float value, const char* labels = nullptr);
+
+    // Single-series families
+    void counter(const char* name, const char* help, unsigned long value);
+    void gauge(const char* name, const char* help, unsigned long value);
+    void gauge(const char* name, const char* help, float value);
+
+    // One histogram series (family() it as "histogram" first): cumulative
+    // name_bucket lines, then name_sum and name_count. counts holds one
+    // entry per bound plus the +Inf overflow; bounds and sum are divided by
+    // scale on output (1e6 turns microseconds into seconds).
+    void histogram(const char* name, const char* labels, const uint32_t* bounds, const unsigned long* counts,
+                   int buckets, double sum, double scale = 1);
+
+    void flush();
+
+private:
+    static const size_t BUFFER_SIZE = 256;
+
+    void writeRaw(const char* text);
+    void writeName(const char* name, const char* labels);
+
+    Print& out;
+    char buffer[BUFFER_SIZE];
+    size_t used;
+};
+
+#endif // METRICS_H
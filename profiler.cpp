@@ -0,0 +1,191 @@
+#include "profiler.h"
+#include "config.h"
+#include "logic.h"
+#include "json_stream.h"
+#include "logger.h"
+#include "hal.h"
+
+static const char* const PHASE_NAMES[PHASE_COUNT] = {"wifi", "measure", "wait", "automation", "yield"};
+static const unsigned long OVERRUN_REPORT_INTERVAL_MS = 10000; // Logged at most once per interval
+
+struct CycleStats {
+    unsigned long count;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint32_t lastCycles;
+    uint64_t totalCycles;
+};
+
+static void addSample(CycleStats& stats, uint32_t cycles) {
+    if (stats.count == 0 || cycles < stats.minCycles) stats.minCycles = cycles;
+    if (cycles > stats.maxCycles) stats.maxCycles = cycles;
+    stats.lastCycles = cycles;
+    stats.totalCycles += cycles;
+    stats.count++;
+}
+
+// Totals since the last reset; written by the loop task under the state lock
+static struct {
+    CycleStats phases[PHASE_COUNT];
+    CycleStats total;
+    CycleStats busy;
+    unsigned long histogram[PROFILE_HISTOGRAM_BUCKETS + 1]; // Total pass time; last = overflow
+    unsigned long overruns;
+    uint32_t worst[PHASE_COUNT];  // Breakdown of the pass with the most busy time
+    unsigned long worstAt;        // millis()
+    unsigned long since;          // millis() of the reset
+} profile;
+
+// Current pass; only the loop task touches these
+static uint32_t passStart = 0;
+static uint32_t phaseStart = 0;
+static uint32_t passCycles[PHASE_COUNT];
+static bool passRan[PHASE_COUNT];
+static unsigned long lastReport = 0;
+static unsigned long lastOverrunReport = 0;
+
+static uint32_t cpuMhz() {
+    uint32_t mhz = halCpuMhz();
+    return mhz > 0 ? mhz : 1;
+}
+
+static unsigned long toMicros(uint64_t cycles) {
+    return cycles / cpuMhz();
+}
+
+void profileLoopBegin() {
+    passStart = phaseStart = halCycleCount();
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        passCycles[i] = 0;
+        passRan[i] = false;
+    }
+}
+
+void profilePhase(LoopPhase phase) {
+    uint32_t now = halCycleCount();
+    passCycles[phase] += now - phaseStart; // Unsigned: correct across one wrap
+    passRan[phase] = true;
+    phaseStart = now;
+}
+
+void profileLoopEnd() {
+    uint32_t total = halCycleCount() - passStart;
+    uint32_t busy = total - passCycles[PHASE_WAIT] - passCycles[PHASE_YIELD];
+    unsigned long totalMs = toMicros(total) / 1000;
+    unsigned long busyMs = toMicros(busy) / 1000;
+    bool overrun = busyMs > LOOP_BUDGET_MS;
+
+    lockState();
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        if (passRan[i]) addSample(profile.phases[i], passCycles[i]);
+    }
+    addSample(profile.total, total);
+    if (profile.busy.count == 0 || busy > profile.busy.maxCycles) {
+        memcpy(profile.worst, passCycles, sizeof(profile.worst));
+        profile.worstAt = halMillis();
+    }
+    addSample(profile.busy, busy);
+
+    int bucket = 0;
+    while (bucket < PROFILE_HISTOGRAM_BUCKETS && totalMs > PROFILE_HISTOGRAM_BOUNDS_MS[bucket]) bucket++;
+    profile.histogram[bucket]++;
+    if (overrun) profile.overruns++;
+    unlockState();
+
+    unsigned long now = halMillis();
+    if (overrun && now - lastOverrunReport >= OVERRUN_REPORT_INTERVAL_MS) {
+        lastOverrunReport = now;
+        LOG_WARN("PROFILE", "Overrun: %lu ms busy, budget %lu ms (wifi %lu, measure %lu, automation %lu)",
+                 busyMs, LOOP_BUDGET_MS, toMicros(passCycles[PHASE_WIFI]) / 1000,
+                 toMicros(passCycles[PHASE_MEASURE]) / 1000, toMicros(passCycles[PHASE_AUTOMATION]) / 1000);
+    }
+    if (now - lastReport >= PROFILE_REPORT_INTERVAL_MS) {
+        lastReport = now;
+        logProfile();
+    }
+}
+
+void profileReset() {
+    lockState();
+    memset(&profile, 0, sizeof(profile));
+    profile.since = halMillis();
+    unlockState();
+}
+
+static void writeCycleStats(JsonStreamWriter& json, const CycleStats& stats) {
+    json.field("count", stats.count);
+    json.field("minUs", toMicros(stats.minCycles));
+    json.field("avgUs", stats.count > 0 ? toMicros(stats.totalCycles / stats.count) : 0UL);
+    json.field("maxUs", toMicros(stats.maxCycles));
+    json.field("lastUs", toMicros(stats.lastCycles));
+}
+
+// Renders from a copy, like logProfile(): the output may go straight to a
+// socket, which must not happen under the state lock
+void writeProfileJson(JsonStreamWriter& json) {
+    lockState();
+    auto snapshot = profile;
+    unlockState();
+
+    json.beginObject();
+    json.field("cpuMhz", (unsigned long)cpuMhz());
+    json.field("windowMs", halMillis() - snapshot.since);
+    json.field("budgetMs", LOOP_BUDGET_MS);
+    json.field("overruns", snapshot.overruns);
+
+    json.beginObject("total");
+    writeCycleStats(json, snapshot.total);
+    json.endObject();
+    json.beginObject("busy");
+    writeCycleStats(json, snapshot.busy);
+    json.endObject();
+
+    json.beginArray("phases");
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        json.beginObject();
+        json.field("name", PHASE_NAMES[i]);
+        writeCycleStats(json, snapshot.phases[i]);
+        json.endObject();
+    }
+    json.endArray();
+
+    json.beginObject("worst");
+    json.field("busyUs", toMicros(snapshot.busy.maxCycles));
+    json.field("atMs", snapshot.worstAt);
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        char key[24];
+        snprintf(key, sizeof(key), "%sUs", PHASE_NAMES[i]);
+        json.field(key, toMicros(snapshot.worst[i]));
+    }
+    json.endObject();
+
+    json.beginObject("histogram");
+    json.beginArray("boundsMs");
+    for (int i = 0; i < PROFILE_HISTOGRAM_BUCKETS; ++i) json.field(nullptr, (unsigned long)PROFILE_HISTOGRAM_BOUNDS_MS[i]);
+    json.endArray();
+    json.beginArray("counts");
+    for (int i = 0; i <= PROFILE_HISTOGRAM_BUCKETS; ++i) json.field(nullptr, snapshot.histogram[i]);
+    json.endArray();
+    json.endObject();
+
+    json.endObject();
+}
+
+static void printRow(const char* name, const CycleStats& stats) {
+    LOG_INFO("PROFILE", "  %-11s %8lu %9lu %9lu %9lu", name, stats.count, toMicros(stats.minCycles),
+             stats.count > 0 ? toMicros(stats.totalCycles / stats.count) : 0UL, toMicros(stats.maxCycles));
+}
+
+// Logs from a copy, so the server task is not held up while formatting
+void logProfile() {
+    lockState();
+    auto snapshot = profile;
+    unlockState();
+
+    LOG_INFO("PROFILE", "%lu passes in %lu s, %lu overruns (budget %lu ms)", snapshot.total.count,
+             (halMillis() - snapshot.since) / 1000, snapshot.overruns, LOOP_BUDGET_MS);
+    LOG_INFO("PROFILE", "  phase          count    min us    avg us    max us");
+    for (int i = 0; i < PHASE_COUNT; ++i) printRow(PHASE_NAMES[i], snapshot.phases[i]);
+    printRow("busy", snapshot.busy);
+    printRow("total", snapshot.total);
+}
@@ -0,0 +1,45 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+
+class JsonStreamWriter;
+
+// ==========================================
+// Loop Profiler
+// ==========================================
+// Times each phase of loop() with the CPU cycle counter. loop() calls
+// profileLoopBegin() first and profilePhase() as each phase ends; the time
+// since the previous mark goes to that phase. profileLoopEnd() folds the
+// pass into the totals under the state lock, so /debug/profile (copied
+// under the same lock) always sees a whole pass.
+//
+// The cycle counter wraps every 2^32 cycles (~17.9 s at 240 MHz); a single
+// phase longer than that, e.g. a WiFi reconnect stuck far past its timeout,
+// would read short.
+enum LoopPhase : uint8_t {
+    PHASE_WIFI,        // checkWiFiConnection()
+    PHASE_MEASURE,     // checkAndMeasure()
+    PHASE_WAIT,        // Post-measurement window, security checks only
+    PHASE_AUTOMATION,  // runAutomation()
+    PHASE_YIELD,       // Trailing delay()
+    PHASE_COUNT
+};
+
+// Busy time is the pass minus PHASE_WAIT and PHASE_YIELD, which only sleep
+// by design; a pass whose busy time exceeds LOOP_BUDGET_MS is an overrun.
+const int PROFILE_HISTOGRAM_BUCKETS = 10;
+const uint32_t PROFILE_HISTOGRAM_BOUNDS_MS[PROFILE_HISTOGRAM_BUCKETS] = {
+    1, 5, 10, 25, 50, 100, 250, 500, 1000, 5000
+};
+const unsigned long PROFILE_REPORT_INTERVAL_MS = 300000; // Summary table in the log
+
+void profileLoopBegin();
+void profilePhase(LoopPhase phase);
+void profileLoopEnd();
+
+void profileReset();
+void writeProfileJson(JsonStreamWriter& json);
+void logProfile(); // Table in the log (LOG_INFO)
+
+#endif // PROFILER_H
@@ -7,6 +7,18 @@ let sensorDataTimeout = null;
 let statusDataTimeout = null;
 let sensorDataInterval = 5000;  // Default 5s, updated from backend config
 let statusIdleInterval = 30000;     // Default 30s, updated from backend config
+let dataEtag = null;   // State version of the last /data response
+let statusEtag = null; // State version of the last /status response
+let configVersion = null; // Version of the /config copy in use
+let eventsConnected = false; // /events stream is up; polling stays paused
+let configEtag = null;
+let historyRecords = [];  // Local copy of the device history ring
+let historyCursor = null; // Timestamp of the newest record held locally
+let historyVersion = 0;   // Bumped whenever historyRecords changes
+let historyResetAt = 0;   // historyVersion of the last full replace
+let chartVersion = -1;    // historyVersion the charts currently show
+let chartCursor = null;   // Timestamp of the newest record on the charts
+let chartFrame = 0;       // Pending chart sync (requestAnimationFrame id)
 
 // Track pending toggle changes - UI won't update until backend confirms
 let pendingToggles = {
@@ -46,6 +58,7 @@ window.onload = function() {
     } else {
         fetchSensorData(); // Initial full data fetch
         fetchStatusData();  // Start status polling (only active during security schedule)
+        startEventStream(); // Push channel; polling continues only as fallback
     }
     
     // Initialize charts asynchronously
@@ -53,15 +66,17 @@ window.onload = function() {
 };
 
 function waitForChart() {
-    if (typeof Chart !== 'undefined') {
+    if (typeof LineChart !== 'undefined') {
+        const started = performance.now();
         initChart();
+        console.log('Charts initialized in ' + (performance.now() - started).toFixed(1) + ' ms');
         // If data has already arrived, update the chart immediately
         if (lastData) {
             console.log("Chart loaded, populating with cached data...");
             updateUI(lastData);
         }
     } else {
-        console.log('Esperando a Chart.js...');
+        console.log('Esperando a chart.js...');
         setTimeout(waitForChart, 100);
     }
 }
@@ -162,19 +177,9 @@ function triggerThemeTransition(toDark) {
     // Save theme preference
     localStorage.setItem('theme', toDark ? 'dark' : 'light');
     
-    // Change chart animation at midpoint (200ms for 0.4s animation)
+    // Redraw the chart at the midpoint (200ms for 0.4s animation), without animation
     setTimeout(() => {
-        // Disable chart animation during theme transition
-        const originalAnimationDuration = chart.options.animation.y.duration;
-        chart.options.animation.y.duration = 0;
-        
-        // Force chart redraw without animation
-        chart.update('none');
-        
-        // Restore animation after a brief delay
-        setTimeout(() => {
-            chart.options.animation.y.duration = originalAnimationDuration;
-        }, 100);
+        if (typeof chart !== 'undefined') chart.update('none');
     }, 200);
     
     // Clean up after animation completes (0.4s)
@@ -263,8 +268,8 @@ function getStatusInterval() {
 }
 function initChart() {
     const ctx = document.getElementById('historyChart').getContext('2d');
-    Chart.defaults.font.family = "'Inter', sans-serif";
-    Chart.defaults.color = '#9ca3af';
+    LineChart.defaults.font.family = "'Inter', sans-serif";
+    LineChart.defaults.color = '#9ca3af';
     
     // Gradients - Fill to X axis with gradient
     const gradientTemp = ctx.createLinearGradient(0, 0, 0, 400);
@@ -276,7 +281,7 @@ function initChart() {
     const gradientSoil = ctx.createLinearGradient(0, 0, 0, 400);
     gradientSoil.addColorStop(0, 'rgba(16, 185, 129, 0.5)');
     gradientSoil.addColorStop(1, 'rgba(16, 185, 129, 0.1)');
-    chart = new Chart(ctx, {
+    chart = new LineChart(ctx, {
         type: 'line',
         data: {
             labels: [],
@@ -378,7 +383,7 @@ function initChart() {
     tankGradient.addColorStop(0, 'rgba(59, 130, 246, 0.6)');   // Blue-500
     tankGradient.addColorStop(1, 'rgba(59, 130, 246, 0.0)');   // Transparent
 
-    window.tankSparklineChart = new Chart(tankCtx, {
+    window.tankSparklineChart = new LineChart(tankCtx, {
         type: 'line',
         data: {
             labels: [],
@@ -498,8 +503,81 @@ function showChart(type) {
     chart.update();
 }
 
-// Helper for color interpolation
+// ------------------------------------------
+// DOM Updates
+// ------------------------------------------
+// updateUI() runs on every poll and pushed event, usually with the same
+// values. Writes go through these helpers, which remember the last value
+// given to each element property and skip the DOM when it is unchanged:
+// a quiet poll then causes no style recalculation, layout or repaint.
+// Anything else writing to these elements must use them as well, or the
+// remembered value goes stale.
+
+const renderedValues = new WeakMap(); // element -> { property: last value }
+
+function changed(el, key, value) {
+    let last = renderedValues.get(el);
+    if (!last) {
+        last = {};
+        renderedValues.set(el, last);
+    }
+    if (last[key] === value) return false;
+    last[key] = value;
+    return true;
+}
+
+function setText(el, text) {
+    if (el && changed(el, 'content', text)) el.innerText = text;
+}
+
+function setHtml(el, html) {
+    if (el && changed(el, 'content', html)) el.innerHTML = html;
+}
+
+function setStyle(el, name, value) {
+    if (el && changed(el, 'style.' + name, value)) el.style[name] = value;
+}
+
+function setClassName(el, className) {
+    if (el && changed(el, 'className', className)) el.className = className;
+}
+
+function toggleClass(el, name, on) {
+    if (el && changed(el, 'class.' + name, on)) el.classList.toggle(name, on);
+}
+
+function setProperty(el, name, value) {
+    if (el && changed(el, name, value)) el[name] = value;
+}
+
+// Inputs the user edits are compared with their live value instead.
+// Returns true if the input was changed.
+function setChecked(el, checked) {
+    if (!el || el.checked === checked) return false;
+    el.checked = checked;
+    return true;
+}
+
+function setValue(el, value) {
+    if (el && el.value !== value) el.value = value;
+}
+
+// Gauge colours are recomputed from the same few readings on every poll;
+// the cache is cleared when it fills so slow drift cannot grow it forever
+const colorCache = new Map();
+
 function interpolateColor(value, min, max, startColor, endColor) {
+    const key = value + '|' + min + '|' + max + '|' + startColor + '|' + endColor;
+    let color = colorCache.get(key);
+    if (color === undefined) {
+        if (colorCache.size >= 256) colorCache.clear();
+        color = mixColor(value, min, max, startColor, endColor);
+        colorCache.set(key, color);
+    }
+    return color;
+}
+
+function mixColor(value, min, max, startColor, endColor) {
     // Clamp value
     value = Math.max(min, Math.min(max, value));
     const ratio = (value - min) / (max - min);
@@ -537,118 +615,108 @@ function updateUI(data) {
     // Detect transition from startup to normal (first measurement arrived)
     if (window.wasStartup && !isStartup) {
         console.log("✅ First measurement received, refreshing UI...");
-        // Force a full UI update by clearing any cached state
-        window.lastHistoryLength = null;
-        window.lastHistoryTimestamp = null;
+        // Rebuild the charts: their labels were computed before the first timestamp
+        chartVersion = -1;
     }
     window.wasStartup = isStartup;
 
     // Metrics
-    const updateMetric = (id, value, unit = "") => {
+    const updateMetric = (id, value) => {
         const el = document.getElementById(id);
         const unitEl = el.nextElementSibling; // Get the unit span element
+        const hasUnit = unitEl && unitEl.classList.contains('metric-unit');
         
         if (isStartup) {
-             el.innerHTML = '<span class="status-initializing">Iniciando...</span>';
-             if (unitEl && unitEl.classList.contains('metric-unit')) {
-                unitEl.style.display = 'none';
-             }
+            setHtml(el, '<span class="status-initializing">Iniciando...</span>');
+            if (hasUnit) setStyle(unitEl, 'display', 'none');
         } else if (value === -999 || value === -999.0) {
-            el.innerHTML = '<span class="error-word">ERROR</span>';
+            setHtml(el, '<span class="error-word">ERROR</span>');
             // Hide the unit when there's an error
-            if (unitEl && unitEl.classList.contains('metric-unit')) {
-                unitEl.style.display = 'none';
-            }
+            if (hasUnit) setStyle(unitEl, 'display', 'none');
         } else {
-            el.innerText = value.toFixed(id === 'temp' ? 1 : 0);
+            setText(el, value.toFixed(id === 'temp' ? 1 : 0));
             
             // Dynamic Colors
             if (id === 'temp') {
                 // Blue (Cold) -> Orange/Red (Hot)
                 // Range: 15°C (#3b82f6) -> 35°C (#ef4444)
-                el.style.color = interpolateColor(value, 15, 35, "#3b82f6", "#ef4444");
+                setStyle(el, 'color', interpolateColor(value, 15, 35, "#3b82f6", "#ef4444"));
             } else if (id === 'humidity') {
                 // Gray/Blue (Dry) -> Deep Blue (Wet)
                 // Range: 30% (#9ca3af) -> 90% (#2563eb)
-                el.style.color = interpolateColor(value, 30, 90, "#9ca3af", "#2563eb");
+                setStyle(el, 'color', interpolateColor(value, 30, 90, "#9ca3af", "#2563eb"));
             } else if (id === 'soil') {
                 // Brown/Orange (Dry) -> Green (Wet)
                 // Range: 0% (#d97706) -> 100% (#10b981)
-                el.style.color = interpolateColor(value, 0, 100, "#d97706", "#10b981");
+                setStyle(el, 'color', interpolateColor(value, 0, 100, "#d97706", "#10b981"));
             } else if (id === 'light') {
                 // Dark (Dark Blue) -> Bright (Yellow)
                 // Range: 0% (#1e3a8a) -> 100% (#facc15)
-                el.style.color = interpolateColor(value, 0, 100, "#1e3a8a", "#facc15");
+                setStyle(el, 'color', interpolateColor(value, 0, 100, "#1e3a8a", "#facc15"));
             } else {
-                el.style.color = ""; // Reset
+                setStyle(el, 'color', ""); // Reset
             }
             
-            // Show the unit for normal values
-            if (unitEl && unitEl.classList.contains('metric-unit')) {
-                unitEl.style.display = '';
-                // Also color the unit to match? Maybe subtle.
-                // unitEl.style.color = el.style.color; 
-                // Let's keep unit neutral for readability or match? 
-                // User asked for "numbers" to have color. Let's stick to numbers.
-            }
+            // Show the unit for normal values (numbers are coloured, units stay neutral)
+            if (hasUnit) setStyle(unitEl, 'display', '');
         }
     };
-    updateMetric('temp', data.temp, '°C');
-    updateMetric('humidity', data.humidity, '%');
-    updateMetric('soil', data.soilMoisture, '%');
-    updateMetric('light', data.light, '%');
+    updateMetric('temp', data.temp);
+    updateMetric('humidity', data.humidity);
+    updateMetric('soil', data.soilMoisture);
+    updateMetric('light', data.light);
     
     // Tank
     const tankEl = document.getElementById('tank');
     const tankUnitEl = tankEl.nextElementSibling;
     const tankWarn = document.getElementById('tank-warning');
     const tankVisualWrapper = document.querySelector('.tank-visual-wrapper');
+    const waterLevel = document.getElementById('water-level');
 
     if (isStartup) {
-        tankEl.innerHTML = '<span class="status-initializing">Iniciando...</span>';
-        if (tankUnitEl) tankUnitEl.style.display = 'none';
-        document.getElementById('water-level').style.height = '0%';
-        tankWarn.innerText = "Iniciando sistema...";
-        tankWarn.style.color = "var(--text-secondary)";
-        tankVisualWrapper.style.borderColor = ""; // Neutral border
+        setHtml(tankEl, '<span class="status-initializing">Iniciando...</span>');
+        if (tankUnitEl) setStyle(tankUnitEl, 'display', 'none');
+        setStyle(waterLevel, 'height', '0%');
+        setText(tankWarn, "Iniciando sistema...");
+        setStyle(tankWarn, 'color', "var(--text-secondary)");
+        setStyle(tankVisualWrapper, 'borderColor', ""); // Neutral border
     } else if (data.tankLevel === -999) {
-        tankEl.innerHTML = '<span class="error-word">ERROR</span>';
+        setHtml(tankEl, '<span class="error-word">ERROR</span>');
         // Hide the unit when there's an error
         if (tankUnitEl && tankUnitEl.classList.contains('metric-unit')) {
-            tankUnitEl.style.display = 'none';
+            setStyle(tankUnitEl, 'display', 'none');
         }
-        document.getElementById('water-level').style.height = '0%';
-        tankWarn.innerText = "⚠️ Error Sensor";
-        tankVisualWrapper.style.borderColor = "#ef4444"; // Red border on error
+        setStyle(waterLevel, 'height', '0%');
+        setText(tankWarn, "⚠️ Error Sensor");
+        setStyle(tankVisualWrapper, 'borderColor', "#ef4444"); // Red border on error
     } else {
-        tankEl.innerText = data.tankLevel;
-        tankEl.style.color = "";
+        setText(tankEl, String(data.tankLevel));
+        setStyle(tankEl, 'color', "");
         // Show the unit for normal values
         if (tankUnitEl && tankUnitEl.classList.contains('metric-unit')) {
-            tankUnitEl.style.display = '';
+            setStyle(tankUnitEl, 'display', '');
         }
-        document.getElementById('water-level').style.height = data.tankLevel + '%';
-        
-        // Reset visual wrapper border
-        tankVisualWrapper.style.borderColor = "";
+        setStyle(waterLevel, 'height', data.tankLevel + '%');
 
         if (data.tankPump) {
             // Filling: Green border, "Llenando"
-            tankVisualWrapper.style.borderColor = "#10b981"; // Green
-            tankWarn.innerText = "Llenando...";
-            tankWarn.style.color = "#10b981";
+            setStyle(tankVisualWrapper, 'borderColor', "#10b981"); // Green
+            setText(tankWarn, "Llenando...");
+            setStyle(tankWarn, 'color', "#10b981");
         } else if (data.tankLevel >= 95) {
             // Full: Gray border (default), "Lleno"
-            tankWarn.innerText = "Lleno";
-            tankWarn.style.color = "#6b7280"; // Gray
+            setStyle(tankVisualWrapper, 'borderColor', "");
+            setText(tankWarn, "Lleno");
+            setStyle(tankWarn, 'color', "#6b7280"); // Gray
         } else if (data.tankLevel < 20) {
             // Low: Red border, "Nivel Crítico"
-            tankVisualWrapper.style.borderColor = "#ef4444"; // Red
-            tankWarn.innerText = "⚠️ Nivel Crítico";
-            tankWarn.style.color = "#ef4444";
+            setStyle(tankVisualWrapper, 'borderColor', "#ef4444"); // Red
+            setText(tankWarn, "⚠️ Nivel Crítico");
+            setStyle(tankWarn, 'color', "#ef4444");
         } else {
             // Normal
-            tankWarn.innerText = "";
+            setStyle(tankVisualWrapper, 'borderColor', "");
+            setText(tankWarn, "");
         }
     }
     // --- Controls ---
@@ -657,7 +725,7 @@ function updateUI(data) {
     const chkIrrigation = document.getElementById('chk-irrigation-auto');
     // Always update toggles, even during startup, to show correct default state
     if (document.activeElement !== chkIrrigation && pendingToggles.irrigationAuto === null) {
-        chkIrrigation.checked = data.irrigationAuto || false;
+        setChecked(chkIrrigation, data.irrigationAuto || false);
     } 
     
     const btnIrrigation = document.getElementById('btn-irrigation');
@@ -665,32 +733,26 @@ function updateUI(data) {
     
     // Logic: If tank is low OR error, disable irrigation button
     if (isStartup) {
-        btnIrrigation.disabled = true;
-        btnIrrigation.style.opacity = '0.5';
-        btnIrrigation.innerText = "ESPERANDO...";
-        btnIrrigation.classList.remove('btn-on', 'btn-off');
-        statusIrrigation.className = 'status-indicator';
+        setDisabled(btnIrrigation, true);
+        setButtonLabel(btnIrrigation, "ESPERANDO...");
+        setClassName(statusIrrigation, 'status-indicator');
     } else if (data.tankLevel < 20 || data.tankLevel === -999) {
-        btnIrrigation.disabled = true;
-        btnIrrigation.style.opacity = '0.5';
-        btnIrrigation.innerText = data.tankLevel === -999 ? "ERROR" : "BAJO";
-        btnIrrigation.classList.remove('btn-on', 'btn-off');
-        statusIrrigation.className = 'status-indicator error';
+        setDisabled(btnIrrigation, true);
+        setButtonLabel(btnIrrigation, data.tankLevel === -999 ? "ERROR" : "BAJO");
+        setClassName(statusIrrigation, 'status-indicator error');
     } else {
-        btnIrrigation.disabled = false;
-        btnIrrigation.style.opacity = '1';
+        setDisabled(btnIrrigation, false);
         updateButton('btn-irrigation', data.pump);
-        statusIrrigation.className = data.pump ? 'status-indicator active' : 'status-indicator';
+        setClassName(statusIrrigation, data.pump ? 'status-indicator active' : 'status-indicator');
     }
     // 2. Tank
-    const btnTank = document.getElementById('btn-tank');
     const statusTank = document.getElementById('status-tank');
     updateButton('btn-tank', data.tankPump);
-    statusTank.className = data.tankPump ? 'status-indicator active' : 'status-indicator';
+    setClassName(statusTank, data.tankPump ? 'status-indicator active' : 'status-indicator');
     
     const chkTank = document.getElementById('chk-tank-auto');
     if (document.activeElement !== chkTank && pendingToggles.tankAuto === null) {
-        chkTank.checked = data.tankAuto || false;
+        setChecked(chkTank, data.tankAuto || false);
     }
     
     // 3. Security
@@ -699,22 +761,16 @@ function updateUI(data) {
     
     // Determine security status class
     if (data.status === 2) { // Alarm
-        statusSecurity.className = 'status-indicator alarm';
+        setClassName(statusSecurity, 'status-indicator alarm');
     } else {
-        statusSecurity.className = data.security ? 'status-indicator active' : 'status-indicator';
+        setClassName(statusSecurity, data.security ? 'status-indicator active' : 'status-indicator');
     }
     
     const chkSecAuto = document.getElementById('chk-security-auto');
     if (document.activeElement !== chkSecAuto && document.activeElement.type !== 'time' && pendingToggles.securityAuto === null) {
-        if (chkSecAuto.checked !== (data.securityAuto || false)) {
-            chkSecAuto.checked = data.securityAuto || false;
+        if (setChecked(chkSecAuto, data.securityAuto || false)) {
             // Update schedule visibility
-            const scheduleDiv = document.getElementById('security-schedule');
-            if (data.securityAuto) {
-                scheduleDiv.classList.add('show');
-            } else {
-                scheduleDiv.classList.remove('show');
-            }
+            toggleClass(document.getElementById('security-schedule'), 'show', !!data.securityAuto);
         }
     }
     
@@ -722,39 +778,31 @@ function updateUI(data) {
     // AND not pending update (prevents resetting while waiting for backend)
     if (!pendingToggles.securitySchedule) {
         if (data.securityStart && document.activeElement.id !== 'time-start') {
-            document.getElementById('time-start').value = data.securityStart;
+            setValue(document.getElementById('time-start'), data.securityStart);
         }
         if (data.securityEnd && document.activeElement.id !== 'time-end') {
-            document.getElementById('time-end').value = data.securityEnd;
+            setValue(document.getElementById('time-end'), data.securityEnd);
         }
     }
 
     // 4. Luminary
     const statusLuminary = document.getElementById('status-luminary');
     updateButton('btn-luminary', data.luminary);
-    statusLuminary.className = data.luminary ? 'status-indicator active' : 'status-indicator';
+    setClassName(statusLuminary, data.luminary ? 'status-indicator active' : 'status-indicator');
 
     const chkLumAuto = document.getElementById('chk-luminary-auto');
     if (document.activeElement !== chkLumAuto && pendingToggles.luminaryAuto === null) {
-        chkLumAuto.checked = data.luminaryAuto || false;
+        setChecked(chkLumAuto, data.luminaryAuto || false);
     }
-    // System Status & Power Calculation
-    const statusDot = document.getElementById('status-dot');
-    const statusText = document.getElementById('status-text');
-    
-    // Update status indicator
+    // System Status
     if (data.status === 0) {
-        statusDot.style.backgroundColor = "#166534"; // Green
-        statusText.innerText = "Conectado";
+        setConnectionStatus("#166534", "Conectado"); // Green
     } else if (data.status === 1) {
-        statusDot.style.backgroundColor = "#ca8a04"; // Yellow
-        statusText.innerText = "Alerta";
+        setConnectionStatus("#ca8a04", "Alerta"); // Yellow
     } else if (data.status === 3) { // Sensor Error
-        statusDot.style.backgroundColor = "#ef4444"; // Red
-        statusText.innerText = "Error Sensor";
+        setConnectionStatus("#ef4444", "Error Sensor"); // Red
     } else {
-        statusDot.style.backgroundColor = "#ef4444"; // Red
-        statusText.innerText = "Alarma";
+        setConnectionStatus("#ef4444", "Alarma"); // Red
     }
     // Power Calculation - Commented out (diagnostics card removed)
     // let power = 25; // Base
@@ -770,131 +818,115 @@ function updateUI(data) {
     //     sysText.innerText = "BAJO CONSUMO";
     //     sysText.style.color = "#166534";
     // }
-    // Chart Update from History (OPTIMIZED: only update if history changed)
-    if (data.history && Array.isArray(data.history)) {
-        console.log("\n=== DATOS RECIBIDOS ===");
-        console.log("Puntos en historial:", data.history.length);
-        console.log("lastMeasurementTime:", data.lastMeasurementTime);
-        
-        // Check if history has changed
-        const historyChanged = !window.lastHistoryLength || 
-                               window.lastHistoryLength !== data.history.length ||
-                               (data.history.length > 0 && 
-                                (!window.lastHistoryTimestamp || 
-                                 window.lastHistoryTimestamp !== data.history[data.history.length - 1].timestamp));
-        
-        if (historyChanged) {
-            console.log("*** HISTORIA CAMBIO - Actualizando grafica ***");
-            if (data.history.length > 0) {
-                console.log("Primer punto:", data.history[0]);
-                console.log("Ultimo punto:", data.history[data.history.length - 1]);
-            }
-            
-            // Update tracking variables
-            window.lastHistoryLength = data.history.length;
-            if (data.history.length > 0) {
-                window.lastHistoryTimestamp = data.history[data.history.length - 1].timestamp;
-            }
-            
-            updateChartWithHistory(data.history);
-            updateTankSparkline(data.history);
-        } else {
-            console.log("Historia sin cambios - Omitiendo actualizacion de grafica");
-        }
-    } else {
-        console.warn("No se recibio historial o formato incorrecto");
-    }
+    // Charts follow historyRecords: redraw only when it changed, batched
+    // into the next animation frame
+    if (historyVersion !== chartVersion) scheduleChartSync();
 }
-function updateChartWithHistory(history) {
-    console.log("\n=== ACTUALIZANDO GRAFICA ===");
-    console.log("Procesando", history.length, "puntos");
-    
-    if (typeof chart === 'undefined') return;
-    
-    // Clear current data
-    chart.data.labels = [];
-    chart.data.datasets[0].data = [];
-    chart.data.datasets[1].data = [];
-    chart.data.datasets[2].data = [];
+function updateButton(btnId, isActive) {
+    const btn = document.getElementById(btnId);
+    toggleClass(btn, 'btn-on', isActive);
+    toggleClass(btn, 'btn-off', !isActive);
+    setText(btn, isActive ? "ON" : "OFF");
+}
+
+// Disabled irrigation button: a label instead of ON/OFF
+function setButtonLabel(btn, label) {
+    toggleClass(btn, 'btn-on', false);
+    toggleClass(btn, 'btn-off', false);
+    setText(btn, label);
+}
+
+function setDisabled(btn, disabled) {
+    setProperty(btn, 'disabled', disabled);
+    setStyle(btn, 'opacity', disabled ? '0.5' : '1');
+}
+
+function setConnectionStatus(color, text) {
+    setStyle(document.getElementById('status-dot'), 'backgroundColor', color);
+    setText(document.getElementById('status-text'), text);
+}
+
+// ------------------------------------------
+// Charts from History
+// ------------------------------------------
+// After a full replace the charts are rebuilt; otherwise only the records
+// past chartCursor are appended and the oldest dropped, so a poll costs one
+// point instead of the whole history.
+
+const CHART_FIELDS = ['temp', 'humidity', 'soil']; // Dataset order
+
+function scheduleChartSync() {
+    if (chartFrame) return;
+    chartFrame = requestAnimationFrame(() => {
+        chartFrame = 0;
+        syncCharts();
+    });
+}
+
+function chartValue(value) {
+    return value === -999 || value === undefined ? 0 : value;
+}
+
+// Label maker for the current poll: "HH:MM" of each record
+function historyLabeler() {
     const now = Date.now();
-    // Use lastData.lastMeasurementTime if available, else assume 0
     const systemNow = lastData ? lastData.lastMeasurementTime : 0;
-    
-    // Heuristic: If systemNow is huge (> 1e10), it's Epoch (Demo Mode or RTC).
-    // If small, it's millis() (ESP32 uptime).
+    // Epoch timestamps (Demo Mode or RTC) are dates already; millis() ones
+    // (ESP32 uptime) are aged relative to the client clock
     const isEpoch = systemNow > 10000000000;
-    history.forEach((record) => {
-        let label = "";
-        if (record.timestamp !== undefined) {
-            if (isEpoch) {
-                // Demo Mode: Timestamp is already a valid Date
-                label = new Date(record.timestamp).toLocaleTimeString([], { hour: '2-digit', minute: '2-digit' });
-            } else if (systemNow >= 0) {
-                // Real Mode: Timestamp is millis(). Calculate age relative to client now.
-                const age = systemNow - record.timestamp;
-                // If age is negative (shouldn't happen), treat as 0
-                const pointTime = new Date(now - (age < 0 ? 0 : age));
-                label = pointTime.toLocaleTimeString([], { hour: '2-digit', minute: '2-digit' });
+    const format = { hour: '2-digit', minute: '2-digit' };
+    return (record, index) => {
+        if (record.timestamp === undefined) return "T-" + (historyRecords.length - index);
+        if (isEpoch) return new Date(record.timestamp).toLocaleTimeString([], format);
+        const age = systemNow - record.timestamp;
+        return new Date(now - (age < 0 ? 0 : age)).toLocaleTimeString([], format);
+    };
+}
+
+function syncCharts() {
+    const tank = window.tankSparklineChart;
+    if (typeof chart === 'undefined' || typeof tank === 'undefined' || chartVersion === historyVersion) return;
+    const labelOf = historyLabeler();
+    const count = historyRecords.length;
+
+    // Records after the chart's newest one, if the charts are still a prefix
+    let start = -1;
+    if (chartVersion >= historyResetAt && chartCursor !== null) {
+        for (let i = count - 1; i >= 0; i--) {
+            if (historyRecords[i].timestamp === chartCursor) {
+                start = i + 1;
+                break;
             }
-        } else {
-            // Fallback if no timestamp
-            label = "T-" + (history.length - chart.data.labels.length);
         }
-        chart.data.labels.push(label);
-        chart.data.datasets[0].data.push(record.temp === -999 ? 0 : record.temp);
-        chart.data.datasets[1].data.push(record.humidity === -999 ? 0 : record.humidity);
-        chart.data.datasets[2].data.push(record.soil === -999 ? 0 : record.soil);
-    });
-    
-    
-    delete chart.options.animation.y;
-    chart.update(); // Animación estándar suave, igual que el tanque
-    console.log("Grafica actualizada con", chart.data.labels.length, "puntos");
-    console.log("Labels:", chart.data.labels);
-}
-function updateButton(btnId, isActive) {
-    const btn = document.getElementById(btnId);
-    // Security Auto check handled in updateUI
-    // if (btnId === 'btn-security' && document.getElementById('chk-security-auto').checked) return; // Removed to allow status update
-    btn.classList.remove('btn-on', 'btn-off');
-    if (isActive) {
-        btn.classList.add('btn-on');
-        btn.innerText = "ON";
+        if (start > chart.data.labels.length) start = -1;
+    }
+
+    if (start < 0) {
+        chart.data.labels = historyRecords.map(labelOf);
+        CHART_FIELDS.forEach((field, i) => {
+            chart.data.datasets[i].data = historyRecords.map(record => chartValue(record[field]));
+        });
+        tank.data.labels = chart.data.labels.slice();
+        tank.data.datasets[0].data = historyRecords.map(record => chartValue(record.tank));
     } else {
-        btn.classList.add('btn-off');
-        btn.innerText = "OFF";
+        for (let i = start; i < count; i++) {
+            const record = historyRecords[i];
+            const label = labelOf(record, i);
+            chart.append(label, CHART_FIELDS.map(field => chartValue(record[field])), count);
+            tank.append(label, [chartValue(record.tank)], count);
+        }
     }
+    console.log("Graficas:", start < 0 ? "reconstruidas" : (count - start) + " puntos nuevos", "-", count, "puntos");
+
+    chartVersion = historyVersion;
+    chartCursor = count > 0 ? historyRecords[count - 1].timestamp : null;
+    delete chart.options.animation.y;
+    chart.update(); // Only new points animate in, the rest slide over
+    tank.update();
+    updateTankLastFilled(historyRecords);
 }
 
-function updateTankSparkline(history) {
-    if (typeof window.tankSparklineChart === 'undefined' || !history || history.length === 0) return;
-    
-    // Extract tank data and generate time labels
-    const tankData = history.map(record => (record.tank === -999 ? 0 : (record.tank || 0)));
-    const now = Date.now();
-    const systemNow = lastData ? lastData.lastMeasurementTime : 0;
-    
-    const labels = history.map(record => {
-        if (!record.timestamp) return '';
-        
-        // Check if timestamp is in epoch format (>1e10) or millis since boot
-        if (record.timestamp > 1e10) {
-            // Demo Mode or RTC: timestamp is epoch
-            const pointTime = new Date(record.timestamp);
-            return pointTime.toLocaleTimeString([], { hour: '2-digit', minute: '2-digit' });
-        } else {
-            // Real Mode: timestamp is millis since boot
-            const age = systemNow - record.timestamp;
-            const pointTime = new Date(now - (age < 0 ? 0 : age));
-            return pointTime.toLocaleTimeString([], { hour: '2-digit', minute: '2-digit' });
-        }
-    });
-    
-    // Update chart with animation
-    window.tankSparklineChart.data.labels = labels;
-    window.tankSparklineChart.data.datasets[0].data = tankData;
-    window.tankSparklineChart.update(); // Enable animation
-    
+function updateTankLastFilled(history) {
     // Calculate last filled time
     let lastFilledIndex = -1;
     for (let i = 1; i < history.length; i++) {
@@ -914,43 +946,236 @@ function updateTankSparkline(history) {
         const minutesAgo = Math.floor((now - fillTime) / (1000 * 60));
         
         if (hoursAgo > 0) {
-            lastFilledEl.innerText = `Último llenado: hace ${hoursAgo}h`;
+            setText(lastFilledEl, `Último llenado: hace ${hoursAgo}h`);
         } else if (minutesAgo > 0) {
-            lastFilledEl.innerText = `Último llenado: hace ${minutesAgo}min`;
+            setText(lastFilledEl, `Último llenado: hace ${minutesAgo}min`);
         } else {
-            lastFilledEl.innerText = 'Último llenado: reciente';
+            setText(lastFilledEl, 'Último llenado: reciente');
         }
     } else {
-        lastFilledEl.innerText = 'Último llenado: --';
+        setText(lastFilledEl, 'Último llenado: --');
+    }
+}
+
+// Conditional GET: the server answers 304 while its state version matches.
+// 'no-store' keeps the browser cache from revalidating on its own, so the
+// 304 reaches this code and the UI update can be skipped.
+function conditionalRequest(etag) {
+    return {
+        cache: 'no-store',
+        headers: etag ? { 'If-None-Match': etag } : {}
+    };
+}
+
+// Merges a /data response into the local history copy. Delta responses only
+// carry the records newer than historyCursor; a full one replaces the copy.
+// A delta built against another cursor (a poll crossing a pushed event) is
+// dropped and the full history refetched, instead of appending records
+// twice. historyVersion only moves when the records actually changed.
+function mergeHistory(data) {
+    if (!Array.isArray(data.history)) return;
+    if (data.historyDelta) {
+        if (data.since !== historyCursor) {
+            fetchHistory().catch(e => console.warn('History refetch failed:', e.message));
+        } else if (data.history.length > 0) {
+            historyRecords.push(...data.history);
+            historyVersion++;
+        }
+    } else if (!sameHistory(historyRecords, data.history)) {
+        historyRecords = data.history;
+        historyVersion++;
+        historyResetAt = historyVersion;
+    }
+    if (data.historySize !== undefined && historyRecords.length > data.historySize) {
+        historyRecords.splice(0, historyRecords.length - data.historySize);
+    }
+    historyCursor = historyRecords.length > 0 ? historyRecords[historyRecords.length - 1].timestamp : null;
+    data.history = historyRecords;
+}
+
+// Full responses repeat the whole ring; same ends and length means no change
+function sameHistory(a, b) {
+    if (a.length !== b.length) return false;
+    return a.length === 0 || (a[0].timestamp === b[0].timestamp && a[a.length - 1].timestamp === b[b.length - 1].timestamp);
+}
+
+// Packed history from /history (layout in history_binary.h): a 12-byte
+// header, then one little-endian column per field. Returns the same shape
+// as the JSON history fields of /data, so mergeHistory() takes either.
+function decodeHistory(buffer) {
+    const view = new DataView(buffer);
+    if (view.getUint8(0) !== 1) throw new Error('Unsupported history format ' + view.getUint8(0));
+    const delta = (view.getUint8(1) & 0x01) !== 0;
+    const count = view.getUint16(2, true);
+    let offset = 12;
+    const column = (bytes, read) => {
+        const values = new Array(count);
+        for (let i = 0; i < count; i++) values[i] = read(offset + i * bytes);
+        offset += count * bytes;
+        return values;
+    };
+    // Floats travel as float32; round like the JSON writer does
+    const float = (o) => Math.round(view.getFloat32(o, true) * 100) / 100;
+    const timestamps = column(4, (o) => view.getUint32(o, true));
+    const temp = column(4, float);
+    const humidity = column(4, float);
+    const soil = column(2, (o) => view.getInt16(o, true));
+    const tank = column(2, (o) => view.getInt16(o, true));
+    const light = column(2, (o) => view.getInt16(o, true));
+    const data = {
+        historyDelta: delta,
+        historySize: view.getUint16(4, true),
+        history: timestamps.map((timestamp, i) => ({
+            temp: temp[i], humidity: humidity[i], soil: soil[i], tank: tank[i], light: light[i], timestamp
+        }))
+    };
+    if (delta) data.since = view.getUint32(8, true);
+    return data;
+}
+
+// Full history in the packed format, once per page load; /data polls then
+// only carry deltas. Concurrent callers share one request.
+let historyRequest = null;
+let historyLoaded = false;
+function fetchHistory() {
+    if (!historyRequest) {
+        historyRequest = fetch('/history', { cache: 'no-store', headers: { 'Accept': 'application/octet-stream' } })
+            .then(res => {
+                if (!res.ok) throw new Error('HTTP ' + res.status);
+                return res.arrayBuffer();
+            })
+            .then(buffer => {
+                mergeHistory(decodeHistory(buffer));
+                historyLoaded = true;
+            })
+            .finally(() => { historyRequest = null; });
+    }
+    return historyRequest;
+}
+
+function dataUrl() {
+    return historyCursor !== null ? '/data?since=' + historyCursor : '/data';
+}
+
+// Fetch backend config (polling intervals)
+function fetchConfig() {
+    fetch('/config', conditionalRequest(configEtag))
+        .then(res => {
+            if (res.status === 304) return null;
+            configEtag = res.headers.get('ETag');
+            return res.json();
+        })
+        .then(config => {
+            if (!config) return;
+            configVersion = config.version;
+            if (config.serverPollingInterval) {
+                sensorDataInterval = config.serverPollingInterval * 1000;
+            }
+            if (config.statusPollingInterval) {
+                statusIdleInterval = config.statusPollingInterval * 1000;
+            }
+        })
+        .catch(e => console.error("Config fetch error:", e));
+}
+
+// Applies a /data payload (poll response or pushed "data" event)
+function applySensorData(data) {
+    console.log("📊 Sensor data received:", data.history ? data.history.length + " history points" + (data.historyDelta ? " (delta)" : "") : "no history");
+    mergeHistory(data);
+    
+    // Backend config is served by /config; refetch only when it changed
+    if (data.configVersion !== undefined && data.configVersion !== configVersion) {
+        fetchConfig();
+    }
+    
+    updateUI(data);
+}
+
+// Applies a /status payload (poll response or pushed "state" event)
+function applyStatus(data) {
+    // Merge status into lastData to preserve sensor readings
+    if (!lastData) return;
+    lastData.pump = data.pump;
+    lastData.tankPump = data.tankPump;
+    lastData.status = data.status;
+    lastData.security = data.security;
+    lastData.luminary = data.luminary;
+    lastData.irrigationAuto = data.irrigationAuto;
+    lastData.tankAuto = data.tankAuto;
+    lastData.securityAuto = data.securityAuto;
+    lastData.luminaryAuto = data.luminaryAuto;
+    
+    // Clear pending toggles if confirmed by backend
+    if (pendingToggles.irrigationAuto === data.irrigationAuto) pendingToggles.irrigationAuto = null;
+    if (pendingToggles.tankAuto === data.tankAuto) pendingToggles.tankAuto = null;
+    if (pendingToggles.securityAuto === data.securityAuto) pendingToggles.securityAuto = null;
+    if (pendingToggles.luminaryAuto === data.luminaryAuto) pendingToggles.luminaryAuto = null;
+    
+    if (data.configVersion !== undefined && data.configVersion !== configVersion) {
+        fetchConfig();
     }
+    
+    updateUI(lastData);
+}
+
+// Polling is the fallback: while the event stream is up, nothing is scheduled
+function scheduleSensorPoll() {
+    if (sensorDataTimeout) clearTimeout(sensorDataTimeout);
+    sensorDataTimeout = eventsConnected ? null : setTimeout(fetchSensorData, sensorDataInterval);
+}
+
+function scheduleStatusPoll(delay) {
+    if (statusDataTimeout) clearTimeout(statusDataTimeout);
+    statusDataTimeout = eventsConnected ? null : setTimeout(fetchStatusData, delay);
 }
 
-// Fetch full sensor data + history
+// Server-Sent Events: state changes, measurements and alarms are pushed
+function startEventStream() {
+    if (typeof EventSource === 'undefined') return; // Polling only
+    
+    const events = new EventSource('/events');
+    events.addEventListener('open', () => {
+        console.log('⚡ Event stream connected - polling paused');
+        eventsConnected = true;
+        scheduleSensorPoll();
+        scheduleStatusPoll(statusIdleInterval);
+        fetchSensorData(); // Catch up on anything missed while disconnected
+    });
+    events.addEventListener('state', e => applyStatus(JSON.parse(e.data)));
+    events.addEventListener('data', e => applySensorData(JSON.parse(e.data)));
+    events.addEventListener('resync', () => fetchSensorData());
+    events.addEventListener('error', () => {
+        // EventSource reconnects by itself; poll until it does
+        if (!eventsConnected) return;
+        console.warn('⚡ Event stream lost - polling resumed');
+        eventsConnected = false;
+        fetchSensorData();
+        fetchStatusData();
+    });
+}
+
+// Fetch sensor data + new history records
 function fetchSensorData() {
     if (sensorDataTimeout) clearTimeout(sensorDataTimeout);
-    fetch('/data')
-        .then(res => res.json())
+    // The first poll loads the history packed, so /data only adds a delta.
+    // Firmware without /history just gets the JSON history from /data.
+    const ready = historyLoaded ? Promise.resolve() : fetchHistory().catch(e => console.warn('Packed history unavailable:', e.message));
+    ready
+        .then(() => fetch(dataUrl(), conditionalRequest(dataEtag)))
+        .then(res => {
+            if (res.status === 304) return null; // Nothing changed since last poll
+            dataEtag = res.headers.get('ETag');
+            return res.json();
+        })
         .then(data => {
-            console.log("📊 Sensor data received:", data.history ? data.history.length + " history points" : "no history");
-            
-            // Update intervals from backend config
-            if (data.config) {
-                if (data.config.serverPollingInterval) {
-                    sensorDataInterval = data.config.serverPollingInterval * 1000;
-                }
-                if (data.config.statusPollingInterval) {
-                    statusIdleInterval = data.config.statusPollingInterval * 1000;
-                }
-            }
-            
-            updateUI(data);
-            sensorDataTimeout = setTimeout(fetchSensorData, sensorDataInterval);
+            if (data) applySensorData(data);
+            scheduleSensorPoll();
         })
         .catch(e => {
             console.error("Sensor fetch error:", e);
-            document.getElementById('status-text').innerText = "Desconectado";
-            document.getElementById('status-dot').style.backgroundColor = "#9ca3af";
-            sensorDataTimeout = setTimeout(fetchSensorData, sensorDataInterval);
+            dataEtag = null; // Force a full refresh once reconnected
+            setConnectionStatus("#9ca3af", "Desconectado");
+            scheduleSensorPoll();
         });
 }
 // Fetch lightweight status (only during security schedule)
@@ -961,42 +1186,28 @@ function fetchStatusData() {
     if (!shouldPollStatus()) {
         console.log('⏸️ Status polling paused (outside security schedule or auto disabled)');
         // Check again in 60 seconds to see if we should resume
-        statusDataTimeout = setTimeout(fetchStatusData, 60000);
+        scheduleStatusPoll(60000);
         return;
     }
     
-    fetch('/status')
-        .then(res => res.json())
+    fetch('/status', conditionalRequest(statusEtag))
+        .then(res => {
+            if (res.status === 304) return null; // Nothing changed since last poll
+            statusEtag = res.headers.get('ETag');
+            return res.json();
+        })
         .then(data => {
-            // Merge status into lastData to preserve sensor readings
-            if (lastData) {
-                lastData.pump = data.pump;
-                lastData.tankPump = data.tankPump;
-                lastData.status = data.status;
-                lastData.security = data.security;
-                lastData.luminary = data.luminary;
-                lastData.irrigationAuto = data.irrigationAuto;
-                lastData.tankAuto = data.tankAuto;
-                lastData.securityAuto = data.securityAuto;
-                lastData.luminaryAuto = data.luminaryAuto;
-                
-                // Clear pending toggles if confirmed by backend
-                if (pendingToggles.irrigationAuto === data.irrigationAuto) pendingToggles.irrigationAuto = null;
-                if (pendingToggles.tankAuto === data.tankAuto) pendingToggles.tankAuto = null;
-                if (pendingToggles.securityAuto === data.securityAuto) pendingToggles.securityAuto = null;
-                if (pendingToggles.luminaryAuto === data.luminaryAuto) pendingToggles.luminaryAuto = null;
-                
-                updateUI(lastData);
-            }
+            if (data) applyStatus(data);
             
             // Schedule next status poll
-            statusDataTimeout = setTimeout(fetchStatusData, statusIdleInterval);
+            scheduleStatusPoll(statusIdleInterval);
             console.log('🔐 Security monitoring active - next poll in ' + (statusIdleInterval/1000) + 's');
         })
         .catch(e => {
             console.error("Status fetch error:", e);
+            statusEtag = null;
             // Retry with same interval
-            statusDataTimeout = setTimeout(fetchStatusData, statusIdleInterval);
+            scheduleStatusPoll(statusIdleInterval);
         });
 }
 // --- Actions ---
@@ -1022,8 +1233,7 @@ function toggleIrrigationManual() {
     
     // 🚀 OPTIMISTIC UI: Update button immediately
     updateButton('btn-irrigation', !current);
-    const statusIrrigation = document.getElementById('status-irrigation');
-    statusIrrigation.className = !current ? 'status-indicator active' : 'status-indicator';
+    setClassName(document.getElementById('status-irrigation'), !current ? 'status-indicator active' : 'status-indicator');
     
     // Toggle: If ON -> Turn OFF (force=false). If OFF -> Turn ON (force=true)
     // Send duration only if turning ON
@@ -1054,33 +1264,34 @@ function toggleTankManual() {
     
     // 🚀 OPTIMISTIC UI: Update button immediately
     updateButton('btn-tank', !current);
-    const statusTank = document.getElementById('status-tank');
-    statusTank.className = !current ? 'status-indicator active' : 'status-indicator';
+    setClassName(document.getElementById('status-tank'), !current ? 'status-indicator active' : 'status-indicator');
     
     sendAction({ forceTank: !current });
 }
 function toggleSecurity() {
+    const commands = [];
+
     // Automatically disable Auto if it's on
     const autoCheckbox = document.getElementById('chk-security-auto');
     if (autoCheckbox.checked) {
         autoCheckbox.checked = false;
-        const scheduleDiv = document.getElementById('security-schedule');
-        scheduleDiv.classList.remove('show');
+        toggleClass(document.getElementById('security-schedule'), 'show', false);
         
-        sendAction({ securityAuto: false });
+        commands.push({ securityAuto: false });
     }
     
     const current = lastData ? lastData.security : false;
     
     // 🚀 OPTIMISTIC UI: Update button immediately
     updateButton('btn-security', !current);
-    const statusSecurity = document.getElementById('status-security');
     // Don't override alarm state
     if (lastData && lastData.status !== 2) {
-        statusSecurity.className = !current ? 'status-indicator active' : 'status-indicator';
+        setClassName(document.getElementById('status-security'), !current ? 'status-indicator active' : 'status-indicator');
     }
     
-    sendAction({ security: !current });
+    // One request: auto off, then the manual state
+    commands.push({ security: !current });
+    sendAction(commands);
 }
 function toggleSecurityAuto() {
     if (window.location.protocol === 'file:' || window.location.hostname === 'localhost' || window.location.hostname === '127.0.0.1') return;
@@ -1091,15 +1302,7 @@ function toggleSecurityAuto() {
     console.log("🔐 Security Auto toggled:", isChecked);
     console.log("📅 Schedule div found:", scheduleDiv);
     
-    if (isChecked) {
-        scheduleDiv.classList.add('show');
-        // scheduleDiv.style.display = 'block'; // Removed to allow CSS transition
-        console.log("✅ Added 'show' class, classes:", scheduleDiv.className);
-    } else {
-        scheduleDiv.classList.remove('show');
-        // scheduleDiv.style.display = 'none'; // Removed to allow CSS transition
-        console.log("❌ Removed 'show' class");
-    }
+    toggleClass(scheduleDiv, 'show', isChecked); // Class, not display, so the CSS transition runs
     
     // Mark as pending until backend confirms
     pendingToggles.securityAuto = isChecked;
@@ -1152,21 +1355,23 @@ function toggleLuminaryAuto() {
 function toggleLuminaryManual() {
     if (window.location.protocol === 'file:' || window.location.hostname === 'localhost' || window.location.hostname === '127.0.0.1') return;
     
+    const commands = [];
+
     // Disable Auto when Manual is used
     const autoCheckbox = document.getElementById('chk-luminary-auto');
     if (autoCheckbox.checked) {
         autoCheckbox.checked = false;
-        sendAction({ luminaryAuto: false });
+        commands.push({ luminaryAuto: false });
     }
     
     const current = lastData ? lastData.luminary : false;
     
     // 🚀 OPTIMISTIC UI: Update button immediately
     updateButton('btn-luminary', !current);
-    const statusLuminary = document.getElementById('status-luminary');
-    statusLuminary.className = !current ? 'status-indicator active' : 'status-indicator';
+    setClassName(document.getElementById('status-luminary'), !current ? 'status-indicator active' : 'status-indicator');
     
-    sendAction({ forceLuminary: !current });
+    commands.push({ forceLuminary: !current });
+    sendAction(commands);
 }
 
 function acknowledgeAlarm() {
@@ -1203,7 +1408,8 @@ function setDemoMode() {
         luminaryAuto: true,
         status: 0,
         lastMeasurementTime: now,
-        history: []
+        history: [],
+        historySize: maxDataPoints
     };
 
     // Populate initial history (last 12 points for better visualization)
@@ -1237,6 +1443,7 @@ function setDemoMode() {
     demoData.soilMoisture = lastPoint.soil;
     demoData.tankLevel = lastPoint.tank;
     
+    mergeHistory(demoData);
     updateUI(demoData);
     
     // Update demo data periodically to simulate 10-minute intervals
@@ -1281,24 +1488,22 @@ function setDemoMode() {
         demoData.tankLevel = Math.max(0, Math.min(100, demoData.tankLevel));
         demoData.tankLevel = Math.floor(demoData.tankLevel);
         
-        // Add to history
-        demoData.history.push({
+        // Add to history as a delta, the way the device sends it
+        demoData.history = [{
             temp: demoData.temp,
             humidity: demoData.humidity,
             soil: demoData.soilMoisture,
             tank: demoData.tankLevel,
             timestamp: demoData.lastMeasurementTime
-        });
-        
-        // Keep history size limited
-        if (demoData.history.length > 24) {
-            demoData.history.shift();
-        }
+        }];
+        demoData.historyDelta = true;
+        mergeHistory(demoData); // Keeps the last maxDataPoints
         updateUI(demoData);
     }, 3000); // 3 seconds real time = 10 minutes simulated time
 }
 
-// Send action to backend
+// Send action to backend. payload is one command object or an array of
+// them, applied in order in a single request
 function sendAction(payload) {
     if (window.location.protocol === 'file:' || window.location.hostname === 'localhost' || window.location.hostname === '127.0.0.1') {
         console.log("Demo mode - Action not sent:", payload);
@@ -1312,7 +1517,9 @@ function sendAction(payload) {
     })
     .then(res => res.json())
     .then(data => {
-        console.log("✅ Action sent successfully:", payload);
+        const failed = (data.results || []).filter(r => !r.ok);
+        if (failed.length) console.warn("⚠️ Action partly rejected:", failed);
+        else console.log("✅ Action sent successfully:", payload);
         // Force immediate status update to sync UI
         fetch('/status')
             .then(res => res.json())
@@ -1,807 +1,1282 @@
-#ifndef SCRIPT_JS_H_H
-#define SCRIPT_JS_H_H
-
-#include <Arduino.h>
-
-const char script_js[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xED, 0x7D, 0x5D, 0x73, 0x1B, 0x39, 
-0x92, 0xE0, 0xBB, 0x7F, 0x05, 0xAC, 0x99, 0x6E, 0x52, 0x6D, 0x91, 0x22, 0x29, 0xCB, 0x1F, 0x94, 
-0xED, 0x0E, 0x59, 0x92, 0xDB, 0x9A, 0xB3, 0x2D, 0x9F, 0x25, 0x4F, 0xEF, 0x8E, 0xAF, 0x63, 0xBB, 
-0xC8, 0x02, 0xA9, 0x1A, 0x17, 0xAB, 0x38, 0x55, 0x45, 0xC9, 0x1C, 0xB7, 0x22, 0x6E, 0x1F, 0xF6, 
-0x65, 0xE3, 0x22, 0xF6, 0x22, 0xF6, 0x9E, 0x26, 0xEE, 0x62, 0x6E, 0x7F, 0xC0, 0x45, 0x6C, 0xC4, 
-0xBD, 0xEC, 0xF3, 0xF6, 0x3F, 0x99, 0x3F, 0x70, 0xF3, 0x13, 0x2E, 0x33, 0xF1, 0x51, 0x00, 0x0A, 
-0x55, 0xA4, 0xFC, 0x31, 0xD3, 0x33, 0xB1, 0x74, 0xB7, 0x4D, 0x56, 0x01, 0x89, 0x44, 0x22, 0x91, 
-0xC8, 0x04, 0x32, 0x13, 0xDB, 0xDB, 0xEC, 0x20, 0x4D, 0x26, 0xD1, 0x74, 0x91, 0x05, 0xE3, 0xE8, 
-0xC7, 0xFF, 0x9B, 0xDC, 0x88, 0x79, 0xC1, 0xC6, 0xE7, 0x41, 0x56, 0xEC, 0xD1, 0xD7, 0x38, 0xC8, 
-0x8B, 0xC3, 0xA0, 0x08, 0xD8, 0x43, 0x96, 0x2C, 0xE2, 0x78, 0x8F, 0x6D, 0x6F, 0xB3, 0xD3, 0x22, 
-0xCD, 0x38, 0xBD, 0x61, 0x19, 0x1F, 0xF3, 0xE8, 0x82, 0x87, 0x2C, 0x84, 0x32, 0x37, 0xC6, 0x69, 
-0x02, 0xCF, 0x66, 0xC1, 0x3B, 0xAC, 0xF1, 0x32, 0x8D, 0x92, 0x22, 0x87, 0x7A, 0x83, 0xDB, 0x54, 
-0xEB, 0x36, 0x3B, 0x4F, 0x17, 0x59, 0xCE, 0x82, 0x82, 0xF5, 0x7B, 0x6C, 0x16, 0x25, 0x0C, 0xDE, 
-0xF3, 0xEC, 0x22, 0x88, 0xF3, 0x1B, 0xF0, 0xFA, 0x65, 0x1A, 0xC7, 0x51, 0x32, 0x45, 0x74, 0x8A, 
-0x2C, 0x8D, 0xA9, 0xF1, 0x9C, 0x27, 0x79, 0x9A, 0x21, 0xB0, 0xB3, 0x68, 0xC6, 0xD3, 0x45, 0xA1, 
-0xB0, 0x10, 0x6F, 0x8B, 0xA0, 0x58, 0xE4, 0xB5, 0x6F, 0x75, 0xDD, 0x63, 0xD9, 0x0C, 0xBC, 0xDE, 
-0xED, 0xF5, 0x7A, 0x7B, 0x0C, 0xB1, 0x39, 0xE4, 0x93, 0x60, 0x11, 0x17, 0x6C, 0x37, 0xDF, 0x62, 
-0x8B, 0x39, 0x60, 0x0F, 0x7D, 0x98, 0x64, 0xE9, 0x8C, 0x8D, 0x82, 0xF1, 0x5B, 0x9E, 0x84, 0x6C, 
-0x4C, 0x64, 0x31, 0x1A, 0x3A, 0x0E, 0x63, 0x6E, 0x80, 0xDA, 0xE9, 0x09, 0x58, 0xCC, 0x02, 0xB7, 
-0xD3, 0x5B, 0x01, 0x0F, 0xBB, 0x7A, 0x06, 0xB4, 0x7E, 0xCB, 0xE6, 0xF0, 0x14, 0x3B, 0x5C, 0xA4, 
-0xD3, 0x69, 0xCC, 0x91, 0xE6, 0xC9, 0x94, 0xE7, 0xAC, 0xC3, 0x5E, 0x1F, 0xB3, 0xCB, 0x34, 0x69, 
-0x15, 0x12, 0x0E, 0x5B, 0x24, 0x45, 0x14, 0xDB, 0x70, 0xB2, 0x59, 0x4E, 0x98, 0x49, 0x18, 0x67, 
-0x04, 0x02, 0x69, 0xFD, 0xFE, 0x06, 0x22, 0x14, 0x65, 0x59, 0x34, 0x0D, 0x8A, 0x28, 0x4D, 0xF6, 
-0x17, 0x45, 0x3A, 0x24, 0xAA, 0x6C, 0xD1, 0x9B, 0x22, 0x48, 0xDE, 0xBA, 0xCF, 0x72, 0x3E, 0x5E, 
-0x64, 0x51, 0xB1, 0x74, 0x9F, 0xC7, 0x0B, 0x18, 0xA4, 0x20, 0xAB, 0x3C, 0x57, 0xE5, 0x4F, 0xC7, 
-0xE7, 0x3C, 0x5C, 0xC4, 0x7C, 0xC8, 0x26, 0x30, 0x86, 0x1C, 0xC9, 0xF0, 0x82, 0x5F, 0xB2, 0x49, 
-0x1C, 0x4C, 0xD9, 0x24, 0xCD, 0x58, 0x2E, 0xDF, 0xCB, 0x7E, 0xE4, 0x37, 0xAE, 0xF6, 0x6E, 0xDC, 
-0xB8, 0x8C, 0x92, 0x30, 0xBD, 0xEC, 0xA6, 0x49, 0x9C, 0x06, 0x21, 0x20, 0x3C, 0x59, 0x24, 0x63, 
-0x44, 0xB4, 0xBD, 0x29, 0x71, 0x07, 0x28, 0x07, 0xE7, 0x1C, 0xE8, 0x13, 0x2C, 0x8A, 0x73, 0x0E, 
-0x5D, 0x1F, 0x53, 0x47, 0xE8, 0x9D, 0xE0, 0xAF, 0x28, 0xDF, 0x2F, 0x5F, 0x71, 0x04, 0x12, 0xA7, 
-0xE3, 0x20, 0x46, 0xAE, 0x0C, 0xA6, 0xBC, 0x3B, 0xE5, 0xC5, 0x71, 0xC1, 0x67, 0xED, 0x96, 0x53, 
-0xAE, 0xB5, 0xB9, 0x27, 0x88, 0x33, 0x61, 0xED, 0x9B, 0x2E, 0x8C, 0x1F, 0x7E, 0xA8, 0x80, 0xBD, 
-0xF9, 0xF0, 0x21, 0x6B, 0x15, 0xD9, 0x82, 0xB7, 0x14, 0x6A, 0x12, 0xBD, 0x57, 0x3C, 0x8C, 0x80, 
-0xEF, 0x0B, 0x18, 0x39, 0x68, 0x79, 0x8A, 0x8C, 0x3C, 0x61, 0x49, 0x5A, 0x98, 0x18, 0xF3, 0x50, 
-0xD7, 0x90, 0x3D, 0x46, 0x1C, 0xB1, 0x23, 0xDD, 0xF3, 0x8C, 0x4F, 0x00, 0xE7, 0xD6, 0x76, 0x6B, 
-0x4F, 0x97, 0xC9, 0x78, 0xB1, 0xC8, 0x12, 0xF1, 0xFB, 0x8A, 0xFE, 0x56, 0xB4, 0x78, 0x99, 0xF1, 
-0x0B, 0x80, 0x49, 0xC3, 0xCF, 0x46, 0x8B, 0xA2, 0x48, 0x13, 0xC1, 0x57, 0xD3, 0x54, 0x30, 0x8F, 
-0x40, 0x81, 0x8A, 0x9F, 0x47, 0x39, 0xD0, 0x60, 0xD9, 0xCD, 0xF8, 0x3C, 0x0E, 0xC6, 0xFC, 0x14, 
-0xD8, 0x96, 0xB7, 0x69, 0xDC, 0xC4, 0xE8, 0x79, 0x51, 0x91, 0x54, 0x91, 0xAF, 0x82, 0x30, 0x3C, 
-0xC2, 0xF6, 0x9E, 0x01, 0x28, 0x9E, 0xF0, 0xAC, 0xDD, 0x9A, 0xA7, 0x73, 0xE4, 0x7F, 0xDE, 0xDA, 
-0x2A, 0xC7, 0x8A, 0x50, 0x32, 0xA9, 0xA2, 0x5A, 0x9E, 0x2F, 0xF2, 0xF3, 0x6B, 0x35, 0xDB, 0x30, 
-0xE2, 0x2C, 0x98, 0x06, 0x40, 0xDB, 0x4B, 0x78, 0x64, 0xF5, 0x3E, 0xCA, 0xD9, 0x3C, 0xE3, 0x79, 
-0x6E, 0x90, 0xD8, 0xE4, 0x8B, 0xEB, 0xB2, 0x83, 0xC3, 0x12, 0x25, 0x27, 0xD4, 0x30, 0xC0, 0xBA, 
-0x43, 0x2A, 0x86, 0xF1, 0x4A, 0xB6, 0xA2, 0x86, 0xF3, 0x38, 0x89, 0x8A, 0x28, 0x88, 0xA3, 0xDF, 
-0x72, 0x06, 0xB8, 0xCC, 0xB8, 0x18, 0x4B, 0x13, 0x61, 0xC1, 0xA3, 0x50, 0xEC, 0x0C, 0xDF, 0xB7, 
-0x9D, 0xFA, 0x40, 0xDC, 0xAC, 0x60, 0x13, 0x5E, 0x8C, 0xCF, 0x71, 0xF8, 0x51, 0xEA, 0xB2, 0xE3, 
-0xE7, 0xCF, 0x8F, 0x0E, 0x8F, 0xF7, 0xCF, 0x8E, 0x9E, 0xFD, 0xAD, 0x66, 0x70, 0x17, 0xC3, 0x79, 
-0x96, 0x16, 0xE9, 0x38, 0x05, 0xC1, 0x85, 0x9D, 0x9A, 0x44, 0x30, 0x6B, 0x5B, 0xD8, 0xD5, 0x4A, 
-0x4F, 0xD2, 0xBC, 0x48, 0x02, 0xC0, 0x8B, 0xCA, 0x11, 0x5E, 0xF8, 0x68, 0x8D, 0xB2, 0xFD, 0xC1, 
-0xDD, 0x6E, 0x0F, 0xFE, 0xF4, 0x2D, 0x6A, 0xE5, 0xBC, 0x38, 0xE4, 0xB3, 0xF4, 0x79, 0x1A, 0xEA, 
-0xAE, 0x5C, 0x31, 0x8E, 0xD2, 0xA2, 0x2C, 0x43, 0xBD, 0x39, 0xD5, 0xE2, 0x1A, 0xCA, 0x19, 0x94, 
-0x02, 0xA6, 0x8B, 0x63, 0xD1, 0x4F, 0x2A, 0xE7, 0xD4, 0xD2, 0x4B, 0x00, 0xD6, 0x2A, 0x09, 0x24, 
-0x24, 0x36, 0x9B, 0xCB, 0x35, 0xA5, 0x0D, 0xE2, 0x66, 0xC9, 0x02, 0x60, 0xDE, 0x0B, 0xCE, 0x42, 
-0x10, 0x5E, 0xF0, 0x4C, 0x49, 0x31, 0x2D, 0xA6, 0x36, 0x3D, 0xB3, 0xCF, 0x18, 0x2E, 0x5A, 0x13, 
-0x61, 0xF5, 0xCA, 0x97, 0xC9, 0xF8, 0x3C, 0x4B, 0x93, 0x74, 0x91, 0xC7, 0x4B, 0x31, 0x75, 0x82, 
-0xA8, 0x78, 0x92, 0x66, 0x07, 0x58, 0x00, 0x3B, 0x89, 0x62, 0x4E, 0x4D, 0x15, 0xE7, 0xA5, 0x92, 
-0xCF, 0x30, 0x42, 0xC5, 0x72, 0xCE, 0xD3, 0x09, 0xA3, 0x17, 0x82, 0xD5, 0x16, 0x49, 0xC8, 0x27, 
-0x51, 0x82, 0xAC, 0x69, 0x50, 0x07, 0x59, 0x41, 0x83, 0x36, 0xA6, 0xCC, 0xF1, 0x44, 0x50, 0xE5, 
-0x3C, 0x00, 0xA4, 0xE2, 0x8C, 0x07, 0x21, 0xF4, 0x10, 0xE4, 0x3E, 0x2C, 0xC6, 0x6A, 0x05, 0x42, 
-0x16, 0x13, 0x78, 0xB3, 0x68, 0x36, 0x03, 0xA9, 0x05, 0xCF, 0x24, 0xCE, 0x0A, 0x0B, 0xB5, 0xBC, 
-0xBB, 0x1C, 0x8E, 0x33, 0x2A, 0x8D, 0x39, 0x0C, 0xF6, 0xB4, 0xBD, 0x21, 0x70, 0x44, 0x81, 0x8D, 
-0xB0, 0x41, 0x20, 0x2C, 0x62, 0xE0, 0x00, 0xA0, 0xE1, 0x65, 0x04, 0xD3, 0x64, 0x1C, 0x20, 0x01, 
-0x09, 0x99, 0x6E, 0xB7, 0xBB, 0x61, 0x60, 0x89, 0x1F, 0x81, 0xC9, 0xEB, 0xE3, 0xB2, 0xA5, 0xCA, 
-0x14, 0x71, 0xF9, 0xC1, 0x6C, 0xBB, 0x75, 0x94, 0xCF, 0x79, 0x16, 0x00, 0xE3, 0xB1, 0x40, 0xD0, 
-0xAA, 0xFB, 0xEB, 0x1C, 0x9A, 0x31, 0x67, 0x2F, 0xF0, 0x98, 0x54, 0x00, 0xDA, 0x26, 0xB5, 0xB7, 
-0x40, 0xCD, 0xE8, 0x29, 0x9E, 0xBB, 0x71, 0x45, 0x2B, 0xEF, 0xB3, 0x74, 0x8A, 0x7A, 0x82, 0x1A, 
-0x1D, 0xD2, 0x3B, 0x60, 0xCE, 0xB1, 0x02, 0x9A, 0xC8, 0x23, 0x1A, 0x30, 0xFD, 0x4E, 0x0F, 0x61, 
-0x12, 0x5C, 0xE0, 0x6A, 0xCA, 0xBF, 0x85, 0xDE, 0x9E, 0xE9, 0x82, 0xED, 0x45, 0x16, 0x2B, 0xAA, 
-0x85, 0xE9, 0x78, 0x31, 0x03, 0xC9, 0xD2, 0x1D, 0xA5, 0xE1, 0xB2, 0x3B, 0x86, 0xAE, 0xE6, 0x28, 
-0x40, 0x51, 0x9A, 0x82, 0x00, 0x85, 0x06, 0x3A, 0xFC, 0x5D, 0x84, 0x14, 0x53, 0x68, 0x1B, 0x28, 
-0x57, 0x16, 0xC0, 0x06, 0x01, 0x03, 0x4D, 0xCA, 0xFE, 0x6C, 0xB1, 0x01, 0x75, 0xEE, 0xCA, 0x60, 
-0xB5, 0x98, 0x3A, 0x67, 0x2D, 0xA4, 0x31, 0x0F, 0x32, 0x57, 0xAC, 0x92, 0xA6, 0x86, 0x05, 0x2C, 
-0x31, 0x99, 0xC1, 0x2C, 0xBD, 0xE0, 0x8D, 0x92, 0xB2, 0xB6, 0xFC, 0x22, 0xE7, 0x19, 0x0A, 0x82, 
-0x95, 0x05, 0xA3, 0xFC, 0x9B, 0x05, 0x07, 0x69, 0xE2, 0x08, 0xB5, 0xEA, 0x82, 0x4A, 0x8C, 0x55, 
-0x0E, 0x0A, 0x15, 0xAC, 0x19, 0x86, 0x16, 0xD5, 0xE8, 0x9E, 0x17, 0xB3, 0xB8, 0x45, 0x04, 0x41, 
-0x05, 0x8B, 0x44, 0xEB, 0xF3, 0x20, 0x01, 0x04, 0x70, 0x5C, 0x4A, 0x1A, 0x19, 0x82, 0x55, 0x92, 
-0x49, 0xAC, 0x1D, 0x24, 0x8C, 0x85, 0x1A, 0xF5, 0xB8, 0x48, 0x80, 0xD4, 0x7A, 0x48, 0x61, 0xFD, 
-0x38, 0x8A, 0x09, 0xCA, 0xE3, 0xE5, 0x31, 0x0C, 0x27, 0x95, 0xEC, 0x08, 0xA5, 0xAD, 0x33, 0x2A, 
-0x12, 0xD5, 0x19, 0x01, 0x27, 0x0F, 0x60, 0xFE, 0x89, 0xE6, 0xEB, 0xD6, 0x21, 0x02, 0xE0, 0x92, 
-0x60, 0x7F, 0x3E, 0x07, 0x09, 0x45, 0xB5, 0xE5, 0xC2, 0x40, 0x03, 0x1A, 0x84, 0x5A, 0x5E, 0x98, 
-0x90, 0x51, 0x5A, 0x84, 0x41, 0xF6, 0xD6, 0x12, 0x14, 0x8D, 0x4C, 0x88, 0xA5, 0x3B, 0x56, 0xCB, 
-0xE5, 0xE4, 0x24, 0xA0, 0xC7, 0x80, 0x7F, 0x1B, 0x17, 0xBB, 0x2D, 0xA1, 0xCD, 0xE9, 0x89, 0x63, 
-0x62, 0x29, 0x08, 0x54, 0x22, 0x38, 0x8E, 0xA3, 0xF1, 0x5B, 0xA1, 0x57, 0x5A, 0xF4, 0xF3, 0xA8, 
-0x11, 0x54, 0xD4, 0xD4, 0x21, 0x36, 0x9D, 0x19, 0x5F, 0xC0, 0xA0, 0xC7, 0xF1, 0x63, 0x7E, 0x08, 
-0x98, 0x02, 0xED, 0x6E, 0xD6, 0x75, 0x07, 0xCA, 0x16, 0xA0, 0x17, 0xE4, 0x75, 0x7D, 0x2A, 0x40, 
-0xF5, 0x9D, 0xF2, 0x8C, 0x3A, 0x65, 0xB0, 0x49, 0x09, 0x5C, 0xF5, 0xCC, 0x99, 0x3D, 0x35, 0xF5, 
-0x8A, 0x94, 0xEA, 0x58, 0xCC, 0x02, 0xFC, 0x9C, 0xC5, 0xC1, 0x72, 0x0D, 0x2E, 0xD1, 0x70, 0x3A, 
-0xB2, 0x8E, 0xCD, 0x2D, 0x1F, 0xCF, 0x75, 0x6A, 0x64, 0x0E, 0xC9, 0x60, 0x00, 0xB1, 0xA2, 0x91, 
-0x43, 0x95, 0x69, 0x9A, 0xA5, 0xB0, 0xA8, 0x80, 0x49, 0x81, 0xB6, 0xC2, 0xC1, 0xE9, 0x29, 0x2C, 
-0x16, 0x09, 0x58, 0x31, 0x2C, 0x2A, 0xAC, 0xCA, 0x07, 0xB0, 0x7A, 0xC0, 0x6A, 0x01, 0x2B, 0x62, 
-0x0A, 0xA5, 0xA3, 0x31, 0x4A, 0x41, 0xD4, 0xDF, 0x67, 0x69, 0x5A, 0x9D, 0x86, 0x02, 0x73, 0x58, 
-0x3B, 0x33, 0x40, 0x0E, 0xB9, 0x06, 0xD0, 0x76, 0x46, 0xFF, 0x37, 0x0B, 0x9E, 0x2D, 0x4F, 0x79, 
-0x0C, 0x53, 0x3A, 0x85, 0xA1, 0xEF, 0x0A, 0xE4, 0x11, 0xAE, 0xDD, 0xFD, 0x84, 0x5F, 0x4A, 0x00, 
-0xBA, 0xDF, 0x63, 0x42, 0x45, 0x76, 0xFD, 0xC5, 0x69, 0xBB, 0x75, 0x5E, 0x14, 0xF3, 0xE1, 0xF6, 
-0xF6, 0xE5, 0xE5, 0x65, 0xF7, 0x72, 0xA7, 0x9B, 0x66, 0xD3, 0x6D, 0x10, 0x7C, 0xBD, 0xED, 0xFC, 
-0x62, 0x0A, 0xCC, 0xD4, 0xC2, 0x7F, 0x24, 0x48, 0x09, 0xAC, 0x0B, 0x34, 0xD8, 0x2F, 0x60, 0x30, 
-0x41, 0x5B, 0xE4, 0xC8, 0x76, 0xC0, 0x37, 0x58, 0xB2, 0xC4, 0x81, 0x95, 0x5F, 0x3B, 0x50, 0xA9, 
-0xB9, 0xFE, 0x45, 0xC4, 0x2F, 0x1F, 0xA7, 0xEF, 0x10, 0x42, 0x8F, 0xF5, 0xC0, 0x94, 0x85, 0xFF, 
-0x9A, 0x6B, 0x80, 0x6E, 0x15, 0x63, 0xF1, 0x24, 0x4D, 0x78, 0x73, 0xC9, 0x1C, 0xEC, 0xDC, 0xB7, 
-0xA8, 0x57, 0xB7, 0x24, 0x35, 0x0F, 0xD2, 0x38, 0xCD, 0xD6, 0xA9, 0xD3, 0xB9, 0x8C, 0xC2, 0xE2, 
-0x1C, 0x6B, 0x0E, 0x5C, 0x46, 0x38, 0x45, 0xF3, 0x1D, 0xA6, 0x08, 0xDA, 0x0C, 0x38, 0x88, 0x00, 
-0x86, 0x46, 0xB4, 0xD4, 0x3B, 0x2C, 0x86, 0x36, 0x5B, 0x8A, 0x12, 0x98, 0xA9, 0x4F, 0xCF, 0x9E, 
-0x3F, 0x83, 0x01, 0xF9, 0xFE, 0xC1, 0x3C, 0x80, 0xB1, 0x0F, 0x1F, 0x6E, 0x3C, 0x1F, 0xF4, 0x59, 
-0x7F, 0xD0, 0xBD, 0x7B, 0x7F, 0xFF, 0x3E, 0xBB, 0x0F, 0x24, 0xE8, 0xE3, 0x9F, 0x7E, 0x17, 0x9E, 
-0xEE, 0xB0, 0xBB, 0xF0, 0xA7, 0x47, 0x7F, 0x54, 0xA1, 0xDF, 0x6E, 0x3C, 0x7A, 0xB0, 0x8D, 0x55, 
-0x1F, 0x7D, 0x5F, 0x4E, 0x49, 0x83, 0x59, 0x5C, 0xB9, 0x94, 0x2F, 0x92, 0x0E, 0xF4, 0xD0, 0x5C, 
-0x1B, 0x4D, 0x94, 0x9C, 0xD2, 0xC0, 0x90, 0x49, 0x27, 0x8B, 0x72, 0xA3, 0x74, 0x45, 0x7B, 0xF0, 
-0xF6, 0xC6, 0x52, 0x49, 0x1E, 0x8C, 0xA3, 0x6C, 0x8C, 0x16, 0xF7, 0xBB, 0x87, 0x1B, 0xFD, 0xC1, 
-0x06, 0x1B, 0x2F, 0xC5, 0xBF, 0xD9, 0xC3, 0x8D, 0x5D, 0x44, 0x5F, 0xBC, 0x7E, 0x64, 0xD7, 0x01, 
-0x3D, 0x92, 0xB3, 0x77, 0x7D, 0x51, 0x72, 0x89, 0xFF, 0x6E, 0xB0, 0x77, 0x03, 0xF9, 0x13, 0xFE, 
-0xDD, 0xC1, 0x9A, 0x58, 0x68, 0x55, 0xBD, 0x81, 0x53, 0x71, 0xB0, 0xB2, 0xE6, 0xED, 0xEE, 0x40, 
-0xD6, 0x15, 0xDF, 0xB0, 0xF6, 0x6E, 0xF7, 0xCE, 0x6D, 0x51, 0x9F, 0xBE, 0xAD, 0x6A, 0xFB, 0x5E, 
-0x77, 0xE7, 0x8E, 0x44, 0x5B, 0x7C, 0x25, 0x0C, 0xEE, 0x77, 0xEF, 0xDE, 0x13, 0x40, 0xC4, 0xD7, 
-0x55, 0x50, 0x24, 0x04, 0x89, 0xC2, 0x8E, 0xAC, 0x3A, 0x58, 0x55, 0x6F, 0xE0, 0x54, 0x1C, 0xAC, 
-0x5D, 0xB3, 0xEC, 0xB9, 0xC4, 0xD5, 0xEE, 0xBA, 0xE8, 0xCB, 0xFA, 0x7D, 0x17, 0x35, 0x9D, 0xAE, 
-0x53, 0x1B, 0x15, 0x18, 0xEB, 0x71, 0x2F, 0xF1, 0xE3, 0xFA, 0xEC, 0x8B, 0xCC, 0xEE, 0x70, 0xAF, 
-0xAD, 0x04, 0x84, 0xA1, 0x9E, 0xAF, 0xA8, 0x0B, 0x09, 0x83, 0xD7, 0xBB, 0xBE, 0xCE, 0x71, 0xE7, 
-0xE7, 0xE0, 0x3C, 0x8A, 0xC3, 0xB6, 0x6C, 0xCC, 0x6B, 0x28, 0xAA, 0xC5, 0x20, 0x48, 0xA2, 0x59, 
-0xB9, 0x8D, 0x22, 0x9F, 0xBA, 0xE8, 0x09, 0xFB, 0xC8, 0xAF, 0x99, 0x88, 0x25, 0xDF, 0xB0, 0x22, 
-0x58, 0x3B, 0xA4, 0x25, 0x27, 0xE4, 0x00, 0x69, 0xB3, 0x41, 0xBA, 0x7C, 0x80, 0x5A, 0xA2, 0xAB, 
-0xA8, 0x2F, 0x72, 0x3D, 0x58, 0xAF, 0xB6, 0xC6, 0x19, 0x5F, 0x2B, 0xC4, 0x13, 0xE2, 0x87, 0xBC, 
-0x58, 0xC6, 0x3C, 0x5F, 0xDD, 0x8E, 0x2B, 0x73, 0xA1, 0x16, 0x0A, 0xDB, 0x72, 0x49, 0xED, 0x8C, 
-0x51, 0x54, 0x0F, 0xD9, 0xCF, 0x7A, 0x41, 0x6F, 0xD2, 0xE7, 0xEC, 0x66, 0x34, 0x9B, 0xA7, 0x59, 
-0x11, 0x24, 0xC5, 0x9E, 0xB7, 0x23, 0xD4, 0xF7, 0x8F, 0x81, 0xCA, 0xD4, 0xAB, 0x09, 0x7D, 0x7C, 
-0x0D, 0x56, 0x24, 0x61, 0x1D, 0xE5, 0x85, 0x46, 0xFE, 0x11, 0xC4, 0x6F, 0x06, 0x40, 0x0A, 0x3D, 
-0x16, 0xB0, 0xA9, 0x4E, 0xCA, 0xBD, 0x54, 0x43, 0x8A, 0xE0, 0x2D, 0x27, 0x2E, 0xA4, 0x25, 0x2A, 
-0x8E, 0xA6, 0xE7, 0x05, 0x9B, 0xA5, 0x21, 0x5F, 0x8D, 0x84, 0x68, 0xBA, 0x42, 0xC6, 0x5A, 0x9A, 
-0x37, 0x97, 0xB7, 0xA7, 0xDF, 0x29, 0x68, 0xD8, 0x92, 0x5F, 0xE6, 0x60, 0x6F, 0x71, 0x98, 0xF5, 
-0x63, 0x5E, 0x35, 0x68, 0x72, 0x5B, 0x91, 0xDF, 0x62, 0x82, 0xE7, 0xD9, 0xD7, 0x52, 0x27, 0x67, 
-0x43, 0xD6, 0xA2, 0x2E, 0xB9, 0x33, 0xE9, 0x80, 0x76, 0x78, 0xA5, 0x41, 0xAE, 0x67, 0x24, 0xEE, 
-0x87, 0xCF, 0xA2, 0x70, 0x8E, 0xBB, 0xE5, 0xAC, 0x0D, 0xCA, 0xCD, 0x2C, 0x27, 0xAA, 0xF4, 0xBA, 
-0xB7, 0xF3, 0xB2, 0xD4, 0xA6, 0x6B, 0x36, 0x82, 0xFE, 0xFC, 0xF0, 0x91, 0xBD, 0x2F, 0x79, 0x18, 
-0xE5, 0xC1, 0x28, 0xAE, 0x36, 0x20, 0x37, 0x3C, 0x44, 0xCF, 0x1C, 0x6D, 0x8E, 0x04, 0x9C, 0x50, 
-0x6A, 0x41, 0xFF, 0x8D, 0x92, 0x20, 0xDE, 0x57, 0xF5, 0x0E, 0x17, 0x99, 0xA8, 0xFF, 0x50, 0x40, 
-0xEC, 0xA6, 0x73, 0xFC, 0x99, 0x77, 0x35, 0xE4, 0xEE, 0xB2, 0x1B, 0xCA, 0x42, 0x86, 0xB8, 0x5C, 
-0x59, 0x16, 0x00, 0xF6, 0xCA, 0xF2, 0x66, 0x0F, 0xC0, 0x74, 0x1F, 0x2B, 0xFC, 0x33, 0x1E, 0x66, 
-0xC1, 0x25, 0x59, 0x82, 0x68, 0xB2, 0xDB, 0x12, 0xAC, 0x6C, 0x48, 0x98, 0x30, 0x6D, 0x4B, 0xDD, 
-0x72, 0xC1, 0xBE, 0xE2, 0x39, 0x9D, 0x58, 0x18, 0x34, 0x9F, 0x14, 0xC0, 0x7C, 0x01, 0x1B, 0x65, 
-0x11, 0x18, 0xD6, 0x24, 0xC3, 0x7C, 0xDB, 0x09, 0x2E, 0x91, 0xD7, 0xEE, 0x5F, 0x2D, 0x31, 0x8D, 
-0xCD, 0x0F, 0x6B, 0x7F, 0x42, 0xD9, 0xF3, 0x16, 0xBF, 0x80, 0xF5, 0x9E, 0x80, 0x8D, 0xA6, 0xB0, 
-0xD5, 0xD8, 0x8F, 0xD3, 0xD9, 0x1C, 0xA6, 0x12, 0xCC, 0xA9, 0x36, 0x72, 0xC9, 0x4A, 0xDE, 0xA8, 
-0xCA, 0x7B, 0x35, 0x83, 0x6D, 0x91, 0x5F, 0xA5, 0x1B, 0x4D, 0xE3, 0x34, 0x96, 0x46, 0x41, 0x80, 
-0xC7, 0x0F, 0x0A, 0x29, 0x4B, 0xB1, 0x24, 0xC2, 0x18, 0xEB, 0xA4, 0x84, 0xDF, 0xB8, 0x24, 0x2A, 
-0x1C, 0x4C, 0xA5, 0x0E, 0x55, 0xFA, 0x85, 0xFB, 0x4B, 0x2D, 0xB0, 0xF0, 0x73, 0xFD, 0x05, 0x57, 
-0x41, 0xF7, 0x2B, 0xFB, 0x40, 0xEF, 0xDB, 0x95, 0xFD, 0x13, 0xD7, 0x1A, 0x8E, 0x72, 0x9C, 0xD7, 
-0x5B, 0x92, 0xF0, 0x68, 0xD0, 0x0B, 0xCB, 0xB8, 0xBA, 0x71, 0xE0, 0x5A, 0x31, 0xAB, 0x0D, 0x20, 
-0xBD, 0x60, 0x4A, 0xE0, 0xCE, 0x11, 0xC3, 0xD9, 0x79, 0x94, 0xB3, 0x72, 0xD3, 0x22, 0x67, 0x49, 
-0x7A, 0x29, 0x8D, 0xB7, 0x90, 0x8D, 0x96, 0x35, 0xC6, 0xAA, 0x86, 0x50, 0x7F, 0x9C, 0xF0, 0x22, 
-0x2D, 0xF9, 0x68, 0x8B, 0xFD, 0x7A, 0x91, 0x0B, 0xA3, 0x11, 0x37, 0x0A, 0x69, 0x88, 0xDB, 0x28, 
-0x7A, 0x70, 0xC7, 0x8A, 0x36, 0x1F, 0xCA, 0x75, 0x5D, 0xD0, 0xC2, 0xC4, 0x52, 0x77, 0xBC, 0x49, 
-0xD3, 0xFE, 0x58, 0x23, 0xC2, 0xD5, 0xC7, 0x2A, 0x6B, 0xDC, 0x5A, 0x58, 0xFC, 0x87, 0xBE, 0xFF, 
-0x1F, 0xFA, 0xFE, 0x7A, 0xFA, 0xFE, 0x95, 0xD8, 0x3F, 0x14, 0xC7, 0x51, 0xC0, 0xF7, 0x97, 0xA0, 
-0xBD, 0xC0, 0xF2, 0x03, 0x02, 0x10, 0x8F, 0x12, 0xD4, 0xB1, 0x82, 0x38, 0x4E, 0xA8, 0x3F, 0x47, 
-0xD0, 0x13, 0x57, 0xD4, 0xC5, 0x93, 0x6D, 0x71, 0x50, 0x61, 0xEE, 0xCD, 0xE2, 0x53, 0x6C, 0xE2, 
-0x99, 0x3C, 0x65, 0x65, 0x78, 0xCC, 0x8A, 0x53, 0x9D, 0x27, 0xB8, 0x8A, 0x87, 0xA8, 0x4B, 0xC3, 
-0xCA, 0x54, 0xE0, 0xBE, 0xA8, 0xD0, 0x90, 0xE4, 0x09, 0x71, 0x39, 0x29, 0xF5, 0xD9, 0xFC, 0x97, 
-0x5F, 0xEA, 0x73, 0xFA, 0xAE, 0x79, 0x6A, 0x6B, 0xCE, 0x57, 0x21, 0x13, 0x18, 0x6E, 0xF1, 0xA9, 
-0xBE, 0x6A, 0x40, 0x37, 0x35, 0xA4, 0x1F, 0x7E, 0x60, 0xFA, 0x47, 0xD7, 0x3C, 0x18, 0xF6, 0x80, 
-0x22, 0x69, 0x28, 0x1C, 0x02, 0x14, 0x0D, 0x02, 0xD9, 0x87, 0x50, 0xA8, 0x22, 0xA1, 0x47, 0x02, 
-0x7D, 0x83, 0x07, 0xEA, 0xEA, 0x64, 0xB8, 0x80, 0x15, 0x2B, 0x17, 0x67, 0x60, 0x28, 0x82, 0x5E, 
-0x1F, 0x83, 0xCE, 0x38, 0x5F, 0x14, 0xB9, 0x21, 0x60, 0x73, 0x34, 0x64, 0x70, 0x65, 0x6B, 0xDC, 
-0x1E, 0x83, 0xF7, 0x1D, 0x2A, 0xD9, 0xDA, 0xEC, 0x5E, 0x04, 0xB1, 0xEA, 0xA3, 0x00, 0x01, 0xA6, 
-0xD2, 0x5A, 0x00, 0xA0, 0x9C, 0x5D, 0xBD, 0x24, 0x50, 0x89, 0x05, 0x52, 0x48, 0x02, 0x6C, 0xA4, 
-0x09, 0x48, 0x5A, 0xDD, 0xCD, 0xB1, 0x74, 0xB1, 0xF0, 0x12, 0xE4, 0x65, 0x90, 0xE5, 0x92, 0x12, 
-0x06, 0xCE, 0x6F, 0xA8, 0xC5, 0xA7, 0xE9, 0x22, 0xDB, 0x12, 0x24, 0x78, 0x1E, 0x25, 0xDF, 0x41, 
-0x0F, 0x34, 0x22, 0xDD, 0x7C, 0x1E, 0x47, 0x45, 0xBB, 0x35, 0x04, 0x94, 0x67, 0xC1, 0xBC, 0xFD, 
-0x62, 0x31, 0x1B, 0xF1, 0xCC, 0xDA, 0x5F, 0x7B, 0x03, 0x78, 0x0A, 0x08, 0xF0, 0x45, 0xD6, 0x97, 
-0xA8, 0x37, 0xD6, 0x36, 0x87, 0x4A, 0xAE, 0xEA, 0x84, 0x9F, 0xB9, 0x75, 0x07, 0xEB, 0xD1, 0x43, 
-0xD2, 0x01, 0x0E, 0x51, 0xFD, 0xB2, 0x9A, 0x95, 0x55, 0xA0, 0xC1, 0x45, 0x41, 0x4E, 0x09, 0x50, 
-0x18, 0x09, 0x8E, 0xA8, 0xE0, 0x14, 0xF8, 0x8A, 0xDD, 0xE9, 0xB1, 0x5B, 0xEA, 0xA9, 0x2C, 0x66, 
-0x83, 0x50, 0x3D, 0x96, 0x00, 0x34, 0x2D, 0x54, 0x5D, 0xF5, 0xDE, 0x19, 0xE5, 0xB2, 0x86, 0xEC, 
-0xB9, 0x2A, 0x2F, 0xDE, 0xB9, 0xEA, 0xB8, 0x9E, 0xE4, 0xAD, 0x0C, 0x8D, 0x95, 0x3C, 0x0A, 0xC5, 
-0x91, 0x99, 0x38, 0x7D, 0x11, 0x9A, 0x3F, 0x90, 0x40, 0xBC, 0xF9, 0x96, 0x1E, 0x2A, 0x25, 0xA0, 
-0x74, 0x25, 0xB0, 0x50, 0x7D, 0x60, 0x60, 0xE1, 0x2C, 0xE9, 0x2F, 0xD2, 0x6C, 0x16, 0xE0, 0x49, 
-0x66, 0x29, 0x29, 0x58, 0x9B, 0x77, 0xA7, 0xDD, 0x2D, 0xD6, 0xBB, 0x37, 0xEC, 0xF5, 0xD0, 0x3E, 
-0x1A, 0xF4, 0xE0, 0xCB, 0xA6, 0xAE, 0xE5, 0x34, 0xEC, 0xD0, 0xF5, 0xD1, 0x43, 0x9B, 0x4C, 0x20, 
-0x04, 0x9C, 0x12, 0x26, 0x36, 0x35, 0xEB, 0x27, 0x20, 0x76, 0x02, 0xDA, 0x61, 0x42, 0x02, 0xC6, 
-0xC5, 0x6B, 0x30, 0x90, 0x78, 0xF5, 0xEE, 0x7C, 0x04, 0x5E, 0x30, 0x61, 0x56, 0xE3, 0x55, 0x8E, 
-0x8C, 0x9C, 0x48, 0x66, 0x1B, 0xB6, 0x9A, 0x06, 0x3C, 0x23, 0xA4, 0xA9, 0x72, 0xC6, 0x31, 0xA5, 
-0xEA, 0x69, 0x84, 0xAA, 0x31, 0xDB, 0xE9, 0x75, 0xD4, 0x6E, 0xB6, 0xF2, 0xD8, 0x21, 0x3F, 0x82, 
-0x84, 0xF3, 0x50, 0x4E, 0x42, 0xD9, 0xCE, 0xE9, 0xD9, 0xFE, 0xD9, 0xEB, 0xD3, 0xBF, 0x3B, 0x3E, 
-0x7C, 0x76, 0xF4, 0x77, 0xC7, 0x2F, 0xCE, 0x8E, 0x5E, 0xFD, 0x72, 0xFF, 0x19, 0xCD, 0xDF, 0x9D, 
-0x9E, 0xDC, 0x10, 0xCF, 0xA1, 0x75, 0xEB, 0xFC, 0xC8, 0x3E, 0xCB, 0x95, 0x3C, 0x5F, 0xBC, 0x6B, 
-0x12, 0x2F, 0xD2, 0x3F, 0x82, 0x6A, 0xC2, 0x8C, 0x83, 0xD7, 0xE8, 0xE6, 0xC4, 0xDF, 0xC1, 0x0C, 
-0x1C, 0xE8, 0xF3, 0x35, 0x71, 0xBC, 0x19, 0x0A, 0x4F, 0xA2, 0xBC, 0x3B, 0x81, 0x12, 0xDD, 0x49, 
-0x30, 0x8B, 0x62, 0x3C, 0x69, 0xD8, 0x68, 0x51, 0x77, 0x41, 0x09, 0xCE, 0x41, 0xDD, 0x83, 0xDE, 
-0x65, 0xD1, 0x64, 0xC3, 0x5B, 0x8F, 0x76, 0x0A, 0xD0, 0x1B, 0xE1, 0x67, 0xF7, 0xC7, 0xC1, 0x4E, 
-0x30, 0x69, 0x39, 0x93, 0x3A, 0x0B, 0xC2, 0x88, 0xA3, 0x67, 0x56, 0x87, 0x3D, 0x89, 0x60, 0x0D, 
-0x82, 0xF1, 0xFD, 0x1B, 0x16, 0xBC, 0x03, 0xA9, 0x4D, 0xA7, 0x6E, 0x53, 0xF9, 0xDE, 0xE8, 0x9C, 
-0x7A, 0x74, 0xC6, 0x67, 0x73, 0x1C, 0xEF, 0xE2, 0x9D, 0xDC, 0xA7, 0x7F, 0x06, 0x6B, 0x68, 0x90, 
-0x29, 0x88, 0xED, 0x1E, 0xB0, 0x32, 0xFD, 0x77, 0x5B, 0xDB, 0x32, 0x66, 0x55, 0xDC, 0xB4, 0xA1, 
-0x2D, 0x6E, 0xB0, 0xA4, 0xE7, 0x58, 0xB8, 0x95, 0x4D, 0x47, 0x41, 0x7B, 0x70, 0x7B, 0x17, 0x4C, 
-0xA1, 0xDD, 0x7B, 0xF0, 0x57, 0x1F, 0x6A, 0x77, 0x77, 0x37, 0x5B, 0x2B, 0x2B, 0xF7, 0xEB, 0x2A, 
-0xF7, 0x37, 0xED, 0x23, 0x06, 0x05, 0xE2, 0xE9, 0x62, 0xF6, 0x81, 0x98, 0x43, 0xCD, 0x1A, 0xC4, 
-0x77, 0xEF, 0x43, 0xAB, 0x3B, 0xF0, 0x73, 0x70, 0xFB, 0x8E, 0x1F, 0xF1, 0x4A, 0xDD, 0x7E, 0x5D, 
-0xDD, 0x3A, 0xBC, 0x4F, 0xD3, 0x28, 0xFE, 0x40, 0xC4, 0xB1, 0x6A, 0x0D, 0xE6, 0x7D, 0x68, 0xB3, 
-0x7F, 0x0F, 0x29, 0x37, 0xB8, 0xEF, 0xC7, 0xBC, 0x5A, 0xB9, 0x5F, 0x57, 0xD9, 0x40, 0x9D, 0x0C, 
-0x77, 0xB1, 0x2C, 0x88, 0x49, 0x02, 0x78, 0x6F, 0x99, 0xDA, 0xFA, 0x72, 0xCE, 0x69, 0x77, 0x04, 
-0x6C, 0xF5, 0xAD, 0x72, 0xC7, 0x06, 0x74, 0x8D, 0xA1, 0x63, 0x65, 0xC7, 0xC1, 0x08, 0x24, 0xD5, 
-0x90, 0xBD, 0xF9, 0x6E, 0xCB, 0x7A, 0x8E, 0x65, 0xC1, 0x60, 0xC1, 0x37, 0xD6, 0x73, 0xFC, 0xBC, 
-0x67, 0x95, 0x47, 0x1A, 0x14, 0xB4, 0x8A, 0x5C, 0x04, 0xD3, 0xC7, 0x5B, 0x66, 0x94, 0x66, 0x21, 
-0xCF, 0x0E, 0xC4, 0x1E, 0x5B, 0xEB, 0x67, 0x93, 0xDD, 0xFB, 0xBC, 0x37, 0xAA, 0x2D, 0xAC, 0x37, 
-0xEC, 0x64, 0x05, 0x93, 0x4F, 0x6B, 0xEA, 0x88, 0x3E, 0x42, 0x6F, 0xFC, 0xAF, 0x0B, 0x0E, 0xE2, 
-0x2E, 0x4D, 0x86, 0xB8, 0xEB, 0x53, 0x53, 0x04, 0xCF, 0x95, 0x86, 0xA4, 0xBE, 0x6D, 0x79, 0xDF, 
-0xD3, 0x06, 0xD2, 0x2B, 0x40, 0x64, 0x01, 0xC4, 0xB9, 0xDD, 0x50, 0xE6, 0x29, 0x6E, 0x07, 0xA8, 
-0x82, 0x77, 0x1A, 0x0A, 0x3E, 0x76, 0xFB, 0x59, 0x12, 0xA6, 0xA1, 0x92, 0x43, 0xC9, 0xC9, 0x64, 
-0x75, 0xE9, 0x6F, 0xF1, 0x34, 0x6B, 0xC8, 0x06, 0xFE, 0x82, 0x23, 0xB3, 0xCC, 0x8E, 0xBF, 0xCC, 
-0x79, 0x14, 0x86, 0x3C, 0x51, 0x8E, 0x88, 0x95, 0x22, 0x57, 0xD5, 0x5A, 0x2B, 0x98, 0x05, 0x66, 
-0x2E, 0x0F, 0x83, 0x70, 0x4D, 0x7E, 0xD9, 0x19, 0xDD, 0x1B, 0x4C, 0xEE, 0x5C, 0x9B, 0x5F, 0xA0, 
-0x91, 0xBF, 0x6E, 0x76, 0x51, 0x74, 0xF9, 0xA9, 0xB2, 0x0B, 0x92, 0xE7, 0x53, 0x70, 0xCB, 0xE9, 
-0x82, 0xC7, 0xE9, 0x9A, 0xBC, 0xD2, 0xEF, 0x8D, 0xEE, 0xDF, 0xEB, 0x5F, 0x9B, 0x57, 0x50, 0x20, 
-0xFF, 0x75, 0x33, 0x8B, 0x22, 0xCC, 0x5F, 0x18, 0xB3, 0x58, 0x4F, 0xBE, 0xD3, 0xBF, 0x0C, 0x26, 
-0x92, 0x7B, 0xC5, 0xEE, 0x12, 0x97, 0xF1, 0x7C, 0x0E, 0x8F, 0xA3, 0x0B, 0xEE, 0x23, 0xFD, 0x2C, 
-0x88, 0xC8, 0xCF, 0x65, 0x3F, 0x9F, 0xF3, 0x31, 0xD0, 0x1E, 0x40, 0x48, 0xF1, 0x66, 0x97, 0x9B, 
-0xC7, 0x8B, 0x69, 0x44, 0xC0, 0xAB, 0xB8, 0xC5, 0x7C, 0x0A, 0x8A, 0x36, 0xBE, 0x02, 0x7B, 0x7C, 
-0x1E, 0x07, 0x4B, 0x25, 0x20, 0x3D, 0x1C, 0x5E, 0xA4, 0x69, 0x5C, 0x44, 0x73, 0x17, 0x49, 0x8D, 
-0x4E, 0x1A, 0xE2, 0xCA, 0x0D, 0xEA, 0x38, 0x7F, 0x57, 0x43, 0x74, 0xD2, 0xB4, 0x41, 0x65, 0x2E, 
-0xBC, 0x78, 0xAA, 0x4F, 0x85, 0xC1, 0xA5, 0x1E, 0xB7, 0x0B, 0x0A, 0x45, 0xF9, 0x57, 0xAF, 0x7B, 
-0x7F, 0xB3, 0xA6, 0x99, 0x22, 0x2A, 0x62, 0x5E, 0x32, 0xCD, 0x64, 0x70, 0x7F, 0xE7, 0x6E, 0x4D, 
-0x51, 0x3C, 0x01, 0xD2, 0x25, 0x6F, 0x8F, 0x76, 0x77, 0xEF, 0xEC, 0xD4, 0x96, 0xB4, 0x38, 0x8B, 
-0xEF, 0xF2, 0xBB, 0xBC, 0x6E, 0x99, 0xB3, 0x78, 0xA6, 0x5F, 0xC3, 0x80, 0xA0, 0x3A, 0x45, 0xC9, 
-0x14, 0xDE, 0xD7, 0x30, 0xDE, 0x38, 0xCD, 0x92, 0x72, 0xA6, 0xDC, 0xF3, 0x17, 0x92, 0xA3, 0x46, 
-0x68, 0xE5, 0x4D, 0xF3, 0x73, 0x94, 0xBE, 0x7B, 0xA9, 0x5A, 0xBC, 0xBD, 0x82, 0x45, 0x9D, 0xB1, 
-0xCF, 0xC7, 0x41, 0xCC, 0xFD, 0xEC, 0xB3, 0xF4, 0x3E, 0xC5, 0xCF, 0x34, 0x8B, 0xC2, 0xDA, 0x97, 
-0x06, 0xE6, 0x4D, 0x38, 0xE3, 0x67, 0xAC, 0xA7, 0xF2, 0xCE, 0xE4, 0x76, 0xED, 0x42, 0x41, 0x00, 
-0xB3, 0xE0, 0x52, 0x4C, 0x68, 0xC9, 0x5D, 0xDE, 0x92, 0x57, 0x75, 0x52, 0x95, 0xC3, 0x1C, 0xD9, 
-0x2F, 0x7E, 0xC5, 0xB3, 0xB4, 0x09, 0xA5, 0x22, 0x1A, 0xBF, 0x25, 0x52, 0x94, 0xC3, 0x07, 0x2A, 
-0x33, 0xDA, 0x61, 0xF8, 0x30, 0x8F, 0x7E, 0x0B, 0x53, 0xA0, 0xDF, 0x07, 0x23, 0xFA, 0xAA, 0x4A, 
-0xE3, 0x2A, 0xC4, 0x77, 0x2B, 0xC9, 0xB7, 0x7A, 0x56, 0x5E, 0x07, 0xAB, 0x2D, 0x0C, 0xBC, 0x79, 
-0x95, 0x16, 0xB4, 0xB7, 0x3F, 0x44, 0x9B, 0x00, 0x77, 0xE3, 0x4E, 0xDF, 0x46, 0x73, 0xCD, 0x1B, 
-0x83, 0x9E, 0x0F, 0xF5, 0x26, 0xF6, 0xA0, 0x49, 0x1D, 0x8C, 0x05, 0xC8, 0xF7, 0x4A, 0x0C, 0xA0, 
-0x09, 0x82, 0x7E, 0x9C, 0x5B, 0x64, 0x37, 0xC2, 0x03, 0x74, 0x90, 0x72, 0xE7, 0xBF, 0x0B, 0x0A, 
-0x7A, 0x9A, 0x2E, 0x0A, 0xAB, 0x23, 0xEF, 0x41, 0xEC, 0xCC, 0x45, 0x7F, 0x32, 0xDC, 0x81, 0x10, 
-0x5F, 0x47, 0x69, 0x51, 0xA4, 0xB3, 0x21, 0x03, 0x39, 0x10, 0xF3, 0x09, 0x3C, 0xDC, 0x45, 0x92, 
-0xDB, 0xC0, 0xF4, 0x21, 0x86, 0x4F, 0x60, 0xA9, 0x83, 0x38, 0xEC, 0x70, 0x0F, 0x00, 0xE2, 0xD9, 
-0xA8, 0x8A, 0x6F, 0x62, 0x80, 0xF7, 0x8F, 0xFF, 0x92, 0x84, 0x01, 0x1E, 0x73, 0x64, 0x01, 0x3A, 
-0x85, 0x2F, 0xD0, 0xC1, 0x1B, 0xDE, 0xA6, 0x09, 0xCF, 0x59, 0xBE, 0x08, 0x2E, 0x0C, 0x17, 0x01, 
-0xF5, 0xE1, 0x41, 0x4E, 0x18, 0xB7, 0xE0, 0x0B, 0x3F, 0x59, 0x14, 0xFF, 0x79, 0x81, 0x96, 0xBC, 
-0x4D, 0xB9, 0x1B, 0xF6, 0x37, 0xD7, 0xF5, 0xFF, 0x2C, 0x48, 0xDE, 0xB2, 0x53, 0x68, 0xF4, 0x2D, 
-0xED, 0x55, 0x93, 0x81, 0x64, 0x58, 0x7C, 0x18, 0x99, 0x73, 0xD0, 0xBC, 0x8B, 0x80, 0x45, 0x34, 
-0x80, 0xDA, 0x6D, 0x84, 0x12, 0x9C, 0xB2, 0x12, 0xD1, 0x43, 0x4F, 0x40, 0x5F, 0x61, 0x44, 0xF6, 
-0xEF, 0x28, 0x23, 0x12, 0xF0, 0xFD, 0x65, 0x34, 0xCA, 0x02, 0xA8, 0xFC, 0x38, 0x86, 0x75, 0xEF, 
-0x1B, 0x73, 0x57, 0xC0, 0x84, 0xBD, 0xA6, 0x6D, 0x7C, 0x07, 0x8D, 0x44, 0x01, 0x17, 0xE1, 0x75, 
-0x76, 0x7B, 0xBD, 0x15, 0xA0, 0x6A, 0x4D, 0xE5, 0x5E, 0x09, 0x8A, 0x8E, 0xBE, 0x80, 0x20, 0x88, 
-0x18, 0x81, 0x93, 0x7E, 0xD3, 0x16, 0xA1, 0x0E, 0x2A, 0x56, 0xA9, 0x24, 0xC6, 0x67, 0xB3, 0x4C, 
-0x3D, 0x1C, 0xA9, 0x54, 0xB4, 0xCA, 0x1B, 0x67, 0xE5, 0x19, 0xC0, 0x1A, 0x85, 0x2B, 0x8F, 0x26, 
-0xD4, 0x9D, 0x5E, 0x8F, 0xB5, 0xF1, 0xEC, 0x8D, 0x67, 0xB2, 0xEC, 0x66, 0x15, 0x86, 0xBB, 0xA6, 
-0x9A, 0x54, 0xAD, 0x6B, 0xB2, 0x5E, 0x31, 0x32, 0x14, 0xC6, 0x5D, 0x42, 0xE4, 0x94, 0x1C, 0x41, 
-0x01, 0x81, 0xF1, 0x22, 0xBB, 0xA8, 0x4A, 0xDE, 0x26, 0xED, 0xD1, 0xD1, 0x1C, 0x05, 0x5F, 0xE5, 
-0x11, 0xBA, 0x29, 0xD0, 0xAB, 0xEA, 0x4C, 0xF3, 0xE9, 0x91, 0x58, 0xED, 0x59, 0x90, 0x4D, 0x39, 
-0x3B, 0x27, 0xAF, 0x91, 0x8C, 0xDE, 0xF8, 0xAB, 0x7A, 0x34, 0x4B, 0x45, 0xD4, 0x9A, 0x0A, 0xEB, 
-0x68, 0x95, 0x6B, 0x69, 0x94, 0x02, 0xF5, 0x48, 0xF7, 0x77, 0x20, 0x64, 0xCF, 0x11, 0xC8, 0x0E, 
-0x40, 0xBA, 0x48, 0x05, 0xF6, 0xB6, 0xD0, 0xF8, 0x73, 0x6A, 0x8C, 0x9F, 0x53, 0x61, 0x94, 0xA7, 
-0x58, 0x4D, 0xCB, 0xED, 0x9F, 0x5E, 0xA7, 0xDC, 0xFD, 0x2B, 0x51, 0x2A, 0x7B, 0x9F, 0x4E, 0xA9, 
-0x6C, 0x20, 0x2B, 0x11, 0xE5, 0x89, 0xAD, 0x67, 0x0C, 0xB6, 0xD8, 0x25, 0x17, 0x4B, 0x75, 0x6B, 
-0x94, 0xC6, 0x61, 0xAB, 0x4E, 0x6B, 0x41, 0x32, 0x39, 0x75, 0x77, 0x8C, 0xBA, 0x20, 0xD6, 0x6A, 
-0xAB, 0x82, 0x46, 0x1A, 0xE3, 0x90, 0x7A, 0x59, 0xD4, 0x42, 0x6E, 0xC8, 0xDA, 0x63, 0xB1, 0x00, 
-0x92, 0xC7, 0x8B, 0xFC, 0xFE, 0xA6, 0xF7, 0x5D, 0x97, 0xA4, 0x34, 0x1E, 0x3D, 0xB4, 0x5E, 0xC0, 
-0x74, 0x89, 0x1B, 0x34, 0x4B, 0x69, 0xC3, 0x5B, 0x80, 0xBE, 0xFF, 0xF9, 0x7B, 0xF9, 0xB3, 0x3B, 
-0xC7, 0xD3, 0xB9, 0xB0, 0xBB, 0xBC, 0xFA, 0xE2, 0x7B, 0x2F, 0x88, 0x6B, 0xEA, 0x53, 0x5A, 0xDD, 
-0xF6, 0x6A, 0xDB, 0x4D, 0x03, 0xD6, 0x6C, 0x9F, 0x0B, 0x07, 0x10, 0xE4, 0x7C, 0xF2, 0x3C, 0xAB, 
-0x19, 0x93, 0xF5, 0xD4, 0x60, 0x50, 0x23, 0x91, 0xC7, 0x6A, 0x98, 0x4C, 0x2A, 0xAF, 0x7F, 0x46, 
-0xD5, 0xBF, 0xBE, 0x28, 0xAA, 0xCA, 0xCF, 0x78, 0x32, 0xC5, 0x49, 0xD4, 0x93, 0x87, 0xB0, 0xF8, 
-0x0C, 0xBA, 0x94, 0xBD, 0x05, 0xDD, 0x0E, 0xBF, 0xE3, 0x99, 0x3D, 0xE8, 0xA1, 0x35, 0xF6, 0x43, 
-0xA3, 0x06, 0xFE, 0xB1, 0x7D, 0x76, 0x74, 0xF6, 0x9E, 0x31, 0x1F, 0x76, 0x1B, 0xE6, 0x03, 0x7E, 
-0x34, 0xB9, 0xE4, 0x99, 0x4E, 0x7D, 0x49, 0x2D, 0x25, 0x6A, 0xE6, 0x3F, 0x7E, 0x60, 0x84, 0xCF, 
-0xB0, 0x4F, 0xCF, 0xA2, 0x59, 0x54, 0xD4, 0x6E, 0x7C, 0x50, 0xBB, 0x72, 0x2E, 0xC2, 0x04, 0xA1, 
-0x73, 0x71, 0x9A, 0x1E, 0xF4, 0x8D, 0xDD, 0x62, 0xAD, 0x2F, 0x5A, 0xEB, 0xCE, 0x89, 0x1A, 0xF3, 
-0xC8, 0x5D, 0x66, 0xFE, 0x44, 0xA6, 0xC8, 0x75, 0xAC, 0x87, 0x4F, 0x65, 0x0A, 0x5C, 0xDD, 0xB8, 
-0x71, 0xC3, 0xF2, 0x0C, 0xB9, 0x94, 0xCA, 0x28, 0x68, 0x9E, 0xC6, 0x01, 0xE6, 0x2B, 0x8E, 0xFE, 
-0x58, 0x32, 0x54, 0x95, 0xDC, 0xD9, 0xA4, 0x35, 0xE2, 0x77, 0x2E, 0xDB, 0x8F, 0xE3, 0x76, 0xAB, 
-0xAB, 0x49, 0x73, 0xC1, 0x3B, 0xE3, 0x20, 0x43, 0x2F, 0x86, 0x49, 0x9A, 0x1D, 0x05, 0xE3, 0xF3, 
-0x36, 0x48, 0x41, 0xCB, 0x17, 0x90, 0xC7, 0xB5, 0x6E, 0x80, 0x9D, 0x19, 0x2F, 0xB2, 0x68, 0x8C, 
-0x7E, 0x76, 0xF2, 0x41, 0x21, 0x8E, 0x4C, 0xD4, 0xCF, 0xF3, 0xC5, 0x2C, 0x0A, 0xA3, 0x62, 0x69, 
-0x3C, 0xCA, 0xD3, 0x28, 0xD6, 0x4E, 0x75, 0xAE, 0x6F, 0x9B, 0x0C, 0x71, 0x95, 0xC7, 0x42, 0x6E, 
-0x88, 0xAB, 0xE9, 0xA4, 0xA6, 0x7A, 0xFF, 0x14, 0x8F, 0xE0, 0x03, 0x19, 0xF0, 0x8B, 0xDA, 0x34, 
-0xFB, 0xF6, 0xF8, 0xEC, 0xE9, 0xC9, 0xEB, 0x33, 0xC3, 0xFB, 0x71, 0x12, 0x65, 0xB9, 0x34, 0x9C, 
-0xC4, 0xC1, 0x27, 0xBA, 0xAA, 0xA8, 0xF2, 0xBA, 0xDF, 0x61, 0x8E, 0xFD, 0x0E, 0xF3, 0xAE, 0xD8, 
-0xBE, 0x43, 0x13, 0x08, 0xE6, 0xA6, 0x79, 0x50, 0xE5, 0xBA, 0x8E, 0x62, 0xFB, 0xAF, 0x45, 0xDC, 
-0x2C, 0xA8, 0x47, 0xE8, 0x5A, 0x1D, 0x2F, 0x6B, 0xDC, 0x4F, 0xE9, 0x2F, 0x74, 0x0D, 0xA0, 0x55, 
-0x08, 0x4F, 0x67, 0xE5, 0x51, 0x2C, 0x25, 0xCF, 0x90, 0xE7, 0xAF, 0xEA, 0x99, 0x45, 0x0E, 0x41, 
-0x06, 0xA2, 0xAB, 0x15, 0x00, 0x57, 0xED, 0x09, 0xAE, 0x62, 0x1A, 0x77, 0xC3, 0xE7, 0x00, 0x3F, 
-0xBA, 0xD9, 0x6F, 0xB2, 0x1F, 0xFF, 0x65, 0x12, 0x8D, 0x41, 0x9C, 0xE3, 0xD9, 0x13, 0xF0, 0x00, 
-0x90, 0x34, 0xD8, 0xF0, 0x38, 0x43, 0xBB, 0xA6, 0x24, 0x72, 0x89, 0x18, 0xDE, 0x4D, 0x7F, 0x18, 
-0x40, 0x0D, 0x33, 0x18, 0x3E, 0x97, 0xBA, 0x9F, 0xF2, 0x54, 0x68, 0xC3, 0x72, 0x31, 0xB0, 0x3B, 
-0xAC, 0x39, 0x67, 0x55, 0xA7, 0xFB, 0xD7, 0xEA, 0xB4, 0x3C, 0xA5, 0x59, 0xBB, 0xC3, 0x25, 0x1A, 
-0xEB, 0x76, 0xBA, 0xAC, 0xE1, 0xEB, 0xB8, 0x38, 0xDF, 0x68, 0xEA, 0xB8, 0x98, 0x1F, 0x2B, 0x3A, 
-0x3D, 0xB8, 0x56, 0xA7, 0xE9, 0xB0, 0x61, 0xED, 0x2E, 0x0B, 0x04, 0xD6, 0xED, 0xAE, 0x39, 0x9D, 
-0xED, 0xAE, 0x8A, 0xDD, 0x79, 0xD5, 0xD5, 0x92, 0xB1, 0xEB, 0x5B, 0xC7, 0x8E, 0x76, 0x08, 0x7F, 
-0x68, 0x9F, 0xBC, 0x33, 0xCF, 0x40, 0xA1, 0xC2, 0x89, 0x88, 0xCF, 0xF6, 0xAE, 0x53, 0x9B, 0x9C, 
-0xF6, 0xB5, 0x63, 0x03, 0xFD, 0x6B, 0xCB, 0x8D, 0x17, 0xE9, 0xA5, 0x76, 0xD3, 0x45, 0x0F, 0x9E, 
-0x9C, 0xC4, 0xA3, 0x8C, 0x4A, 0x27, 0x81, 0x3A, 0x9F, 0xC3, 0x42, 0x81, 0x6B, 0xBF, 0x48, 0xCA, 
-0x42, 0x5B, 0x4C, 0x86, 0x2C, 0xF0, 0xF8, 0x73, 0x63, 0x36, 0x15, 0x2A, 0x8D, 0xBA, 0xC4, 0x95, 
-0x47, 0x70, 0x58, 0xC2, 0xE4, 0x03, 0x01, 0x88, 0xB0, 0xF4, 0xA7, 0x3C, 0x9E, 0xCB, 0x60, 0x08, 
-0xD1, 0x49, 0x12, 0xE8, 0xF3, 0x34, 0x0E, 0xEC, 0x48, 0xF4, 0xF2, 0xB1, 0x30, 0x56, 0xC4, 0x9A, 
-0xBC, 0x85, 0xC9, 0x74, 0x68, 0xF7, 0x4F, 0xBA, 0x8A, 0xD1, 0x3B, 0x72, 0xFA, 0xA2, 0x6F, 0x56, 
-0x40, 0x78, 0x30, 0x9B, 0x8B, 0xF5, 0x9B, 0x1E, 0x89, 0x95, 0xFC, 0x21, 0x7B, 0x1E, 0x14, 0xE7, 
-0x5D, 0x00, 0xD0, 0x26, 0x48, 0xE2, 0x57, 0x94, 0xB4, 0x09, 0xA4, 0x58, 0xF7, 0xAD, 0xCD, 0x25, 
-0x5A, 0x20, 0xA1, 0x9A, 0x68, 0x9F, 0x75, 0x10, 0x81, 0x4D, 0xB6, 0xCD, 0xB0, 0x82, 0xFC, 0x65, 
-0x8F, 0x8F, 0xF0, 0x71, 0x3B, 0xE7, 0xEF, 0x0C, 0x20, 0xA4, 0x59, 0x3F, 0xE5, 0xB8, 0xE3, 0xD5, 
-0x86, 0x37, 0x8E, 0xCF, 0xBA, 0x6C, 0x08, 0x5E, 0x52, 0xB9, 0xE3, 0xA4, 0xC0, 0x42, 0xDD, 0x3C, 
-0x8E, 0xC6, 0x1C, 0xF7, 0x86, 0x76, 0x36, 0x71, 0xBB, 0xCA, 0x62, 0x55, 0xF2, 0x9B, 0xF0, 0x57, 
-0x00, 0xD3, 0x63, 0xD7, 0x5F, 0x61, 0xE4, 0xAF, 0x00, 0xF6, 0xE2, 0x5D, 0xB7, 0x82, 0xF4, 0x18, 
-0x7A, 0x03, 0xA4, 0x9D, 0x6E, 0xB1, 0xD1, 0x77, 0x72, 0x2E, 0x18, 0x3D, 0x95, 0x6E, 0x77, 0x19, 
-0xE0, 0x37, 0x85, 0xFF, 0x47, 0xFD, 0xEF, 0x14, 0x74, 0xE8, 0x67, 0xBB, 0x1C, 0x1B, 0xDB, 0x4B, 
-0x2F, 0x03, 0xA3, 0x6A, 0x0A, 0xFF, 0x8F, 0x06, 0x56, 0x71, 0x3D, 0x7C, 0x95, 0x06, 0x32, 0x35, 
-0x62, 0x64, 0xF3, 0xB6, 0xB3, 0x3E, 0xE8, 0x62, 0xED, 0x6C, 0x00, 0x94, 0xCF, 0xFA, 0xE8, 0x5E, 
-0x47, 0xC3, 0x63, 0xBB, 0x93, 0xD8, 0x35, 0xA6, 0x54, 0x63, 0x8A, 0x35, 0xA6, 0x35, 0x35, 0x46, 
-0x76, 0x8D, 0x11, 0xD5, 0x18, 0x61, 0x8D, 0x51, 0xA5, 0xC6, 0x0D, 0x83, 0x3A, 0xDF, 0x83, 0xE9, 
-0xDD, 0xFE, 0xF9, 0xFB, 0xEC, 0x6A, 0x8B, 0xFD, 0xFC, 0xFD, 0x94, 0xFE, 0x1E, 0x5D, 0x6D, 0x7E, 
-0xEF, 0xF3, 0xB4, 0x7F, 0x7D, 0xDC, 0x0E, 0x8D, 0xD4, 0x13, 0x46, 0xA6, 0x29, 0x7C, 0x6C, 0xAE, 
-0xC7, 0xD3, 0x38, 0x1D, 0x05, 0x71, 0x99, 0xB9, 0x40, 0xB1, 0xD5, 0xF1, 0x44, 0xA7, 0xE5, 0xC8, 
-0x38, 0x46, 0xA3, 0x89, 0x34, 0x18, 0x4B, 0x5E, 0x6C, 0x51, 0xE2, 0x0D, 0x9A, 0x51, 0xE8, 0x22, 
-0xBE, 0x96, 0x4A, 0x82, 0xE6, 0xA2, 0x7C, 0xDF, 0xB0, 0x8F, 0x58, 0x9F, 0xA9, 0xA3, 0x9A, 0x33, 
-0x23, 0xA7, 0xB4, 0x40, 0x84, 0xD4, 0x16, 0x0B, 0x31, 0xA4, 0x88, 0x44, 0xD0, 0xEB, 0x63, 0x49, 
-0x01, 0x27, 0x5F, 0x46, 0xBD, 0xDB, 0xBE, 0xF0, 0x55, 0xA4, 0xA0, 0x6C, 0x64, 0xA2, 0xC5, 0x9C, 
-0x5C, 0x91, 0x39, 0x6B, 0x27, 0x29, 0x9B, 0x81, 0x1E, 0xBA, 0xC8, 0x48, 0x76, 0xE6, 0xD8, 0xF5, 
-0x4D, 0x63, 0x14, 0xA3, 0xFC, 0x54, 0x96, 0x17, 0x44, 0xED, 0x22, 0x91, 0x9F, 0x97, 0x15, 0x84, 
-0x5B, 0xEC, 0x43, 0x1D, 0x90, 0xA3, 0xDA, 0x3B, 0x14, 0x7E, 0xC7, 0x66, 0x5A, 0x0C, 0x14, 0x9B, 
-0xAA, 0xF1, 0x22, 0x85, 0x8E, 0x91, 0x3B, 0x63, 0x9B, 0xB4, 0x31, 0x13, 0x07, 0x95, 0x84, 0xA4, 
-0x74, 0x53, 0x96, 0xC4, 0xBC, 0x0C, 0x34, 0x32, 0x5F, 0x7E, 0xC9, 0x6E, 0x6A, 0xD4, 0x6A, 0x49, 
-0xF8, 0x87, 0xFF, 0xF9, 0x0F, 0xEC, 0x49, 0x05, 0xBC, 0xCA, 0x38, 0xB6, 0x05, 0xDF, 0x26, 0xA0, 
-0xFA, 0x9F, 0x0B, 0x8A, 0x3A, 0xA4, 0xD4, 0xC1, 0x44, 0x81, 0x48, 0x20, 0xA3, 0x49, 0x8E, 0xD1, 
-0x13, 0x18, 0xC3, 0x42, 0x03, 0x11, 0x24, 0x4B, 0x95, 0xBE, 0x84, 0xE8, 0xA9, 0xAB, 0xAB, 0xFC, 
-0x1B, 0x40, 0xAD, 0xA7, 0xC2, 0x75, 0x4F, 0x98, 0x95, 0x3A, 0xC3, 0x58, 0x7D, 0x41, 0x24, 0x29, 
-0x00, 0x23, 0x4F, 0xB9, 0xB2, 0xAC, 0x18, 0xCE, 0x2A, 0x25, 0x1E, 0x96, 0x43, 0xB4, 0x77, 0x43, 
-0x51, 0xFF, 0x39, 0x2D, 0xCB, 0xA6, 0x37, 0xB0, 0xC0, 0x5D, 0x3C, 0x47, 0x79, 0x19, 0x85, 0x52, 
-0x2E, 0x6F, 0xB1, 0x45, 0x12, 0x15, 0xA4, 0x6D, 0x7A, 0x05, 0x28, 0xAA, 0xFF, 0xB5, 0xAB, 0x6C, 
-0x14, 0x56, 0xC4, 0x21, 0x42, 0x3B, 0xC2, 0x3A, 0x60, 0x27, 0x24, 0xB0, 0x5C, 0xCB, 0xE2, 0xA7, 
-0xD1, 0x08, 0x13, 0xE9, 0xEC, 0x29, 0xAF, 0x60, 0x5C, 0x63, 0xA9, 0xE1, 0x7C, 0x1E, 0x24, 0x50, 
-0x56, 0x64, 0xD9, 0x50, 0xA0, 0xF4, 0x17, 0x11, 0x39, 0xE2, 0x19, 0x67, 0xFA, 0x40, 0x13, 0x66, 
-0xD0, 0x46, 0xEB, 0x01, 0x01, 0x23, 0x4D, 0xE5, 0xE1, 0x86, 0x70, 0xB5, 0xEF, 0x44, 0x2A, 0x01, 
-0x0F, 0xB4, 0xBE, 0xF1, 0xE8, 0x38, 0x89, 0xC6, 0x11, 0x26, 0x83, 0x81, 0xD1, 0x7E, 0xB0, 0x8D, 
-0xC5, 0x1F, 0x19, 0x19, 0x97, 0x74, 0x93, 0xB2, 0x13, 0xC0, 0x65, 0xE2, 0x9B, 0x37, 0x7B, 0x84, 
-0xD0, 0x7D, 0x3A, 0x58, 0xA2, 0xB5, 0x59, 0xC1, 0x0D, 0x3E, 0xB2, 0xAE, 0xD0, 0x3D, 0xA4, 0xA1, 
-0x8A, 0x68, 0x92, 0xB9, 0xE0, 0xB4, 0x6A, 0x18, 0x7C, 0xA5, 0x16, 0x28, 0x17, 0x57, 0x98, 0x5D, 
-0x9D, 0xFB, 0xF7, 0xEF, 0xA3, 0x74, 0xB1, 0x9F, 0x74, 0x7B, 0x6E, 0xB3, 0x8D, 0x14, 0x01, 0xE1, 
-0x91, 0x66, 0x9D, 0xCB, 0x34, 0x0B, 0x37, 0x1E, 0x1D, 0xBD, 0x7A, 0x75, 0xF2, 0xCA, 0x4F, 0x01, 
-0x65, 0x45, 0xE9, 0x21, 0x22, 0xC7, 0x57, 0xDC, 0xBE, 0xE7, 0x2D, 0x0C, 0x28, 0x64, 0x04, 0xC7, 
-0xB6, 0xAC, 0xFF, 0x1C, 0x34, 0xAB, 0x90, 0xCC, 0x4F, 0x0A, 0xA9, 0x33, 0x12, 0xE5, 0xBA, 0x45, 
-0xFA, 0x24, 0x7A, 0xC7, 0x91, 0x71, 0x0D, 0x3B, 0x8A, 0x7D, 0xCD, 0xFA, 0x0C, 0x54, 0x2C, 0x27, 
-0xF1, 0x90, 0x4B, 0x94, 0xC3, 0x65, 0x12, 0xCC, 0x60, 0xF6, 0x88, 0x8D, 0xCF, 0x4A, 0xFF, 0x2D, 
-0x90, 0xBE, 0xAE, 0xC9, 0x03, 0x19, 0xD6, 0x06, 0x00, 0xE1, 0x26, 0xEB, 0x3C, 0x62, 0x27, 0x19, 
-0xC6, 0x63, 0x6C, 0xBF, 0xC2, 0x58, 0x8D, 0xA7, 0x69, 0x51, 0x3D, 0x97, 0x41, 0x73, 0x1E, 0x8B, 
-0x0C, 0x59, 0x7F, 0xF7, 0xDF, 0xFF, 0xF5, 0x80, 0xB5, 0xA5, 0xC1, 0x40, 0xB5, 0x77, 0xE4, 0x23, 
-0x3E, 0xB9, 0x0D, 0x9F, 0x6A, 0x65, 0x1E, 0x3B, 0x6A, 0x6F, 0x9D, 0xF2, 0xD7, 0x07, 0x5D, 0x65, 
-0x07, 0xFE, 0xD7, 0xE6, 0x08, 0x7E, 0x15, 0x50, 0xDD, 0x64, 0x4C, 0x06, 0x73, 0xAA, 0xFE, 0x7A, 
-0x2D, 0x33, 0xA3, 0x03, 0xDF, 0x64, 0xC1, 0x72, 0x5B, 0x74, 0xFC, 0x30, 0x5B, 0x12, 0xE6, 0x87, 
-0x9C, 0xCF, 0x25, 0x2D, 0xBE, 0xE5, 0x8D, 0xDD, 0xDE, 0xE9, 0x7D, 0x01, 0x3D, 0x14, 0x5B, 0x56, 
-0x54, 0xF5, 0x3E, 0x3D, 0x10, 0xE7, 0x31, 0x1F, 0xD1, 0x65, 0x3C, 0x0D, 0xBC, 0xDF, 0xC3, 0x7E, 
-0x0A, 0xD8, 0xD4, 0x65, 0x01, 0x75, 0x8D, 0x2E, 0x57, 0x6C, 0x32, 0x73, 0x88, 0xB3, 0xF4, 0x32, 
-0xD9, 0x16, 0x23, 0x5B, 0xF6, 0xF8, 0x9B, 0x8C, 0xC3, 0x1C, 0x5A, 0xD5, 0x5B, 0xEA, 0x5B, 0x78, 
-0xFF, 0xEE, 0xDD, 0x9E, 0x18, 0xE1, 0x7E, 0x8F, 0x9E, 0x08, 0xCB, 0xE9, 0x23, 0x7A, 0xDB, 0xA3, 
-0x48, 0x51, 0xEC, 0xA2, 0x00, 0x4E, 0xBD, 0x95, 0xF6, 0xD8, 0xEA, 0xDE, 0xCA, 0x50, 0x64, 0x7F, 
-0x77, 0x29, 0x70, 0x99, 0x8E, 0x17, 0x69, 0x40, 0x09, 0xED, 0xC7, 0xB4, 0x85, 0xCC, 0xDA, 0x7F, 
-0xCB, 0xE3, 0x38, 0xBD, 0x5C, 0xD9, 0xE1, 0x3E, 0xDF, 0x09, 0xEE, 0x05, 0x66, 0x87, 0x27, 0xC1, 
-0x78, 0xDC, 0xDF, 0xFD, 0x24, 0x1D, 0x16, 0xC0, 0xA9, 0xC3, 0x02, 0x6A, 0x4D, 0x87, 0xAB, 0x9D, 
-0xAB, 0x34, 0xB6, 0xB1, 0xB1, 0xA7, 0xF7, 0xD7, 0x6A, 0x04, 0x11, 0x7E, 0x5C, 0xB1, 0x71, 0x7A, 
-0x0E, 0xA6, 0xA5, 0x96, 0xA5, 0x94, 0x51, 0x45, 0x68, 0x3E, 0x84, 0x6B, 0x55, 0x8E, 0x7C, 0x5E, 
-0x39, 0xEA, 0xAE, 0x3B, 0x02, 0xC7, 0xFD, 0x38, 0x4F, 0xA5, 0xE1, 0xA8, 0x31, 0x05, 0x15, 0x0D, 
-0xEC, 0xD0, 0xF1, 0xF9, 0xD7, 0xA0, 0xC5, 0x2F, 0x47, 0x60, 0x11, 0x2F, 0x46, 0x60, 0x4B, 0x77, 
-0x7D, 0xD5, 0xAD, 0xC6, 0x14, 0xB9, 0x6C, 0xFA, 0xED, 0x55, 0x1D, 0x59, 0xF0, 0x48, 0x96, 0x17, 
-0xB0, 0xA4, 0xBC, 0x45, 0x71, 0x40, 0x6D, 0x26, 0x7C, 0x01, 0x1A, 0x63, 0x4C, 0x54, 0x42, 0xA5, 
-0x37, 0x18, 0x45, 0x31, 0x46, 0x85, 0xC1, 0x4F, 0x89, 0x8B, 0x0F, 0xCA, 0xEB, 0x1C, 0x83, 0x9B, 
-0xF3, 0xB7, 0x98, 0x30, 0x15, 0x4A, 0x6E, 0x24, 0x14, 0x8A, 0x94, 0x6F, 0xD0, 0x81, 0x29, 0x86, 
-0xE4, 0x13, 0x06, 0x5D, 0xD9, 0x1A, 0xED, 0xE1, 0x93, 0x02, 0x2A, 0x8A, 0x75, 0xEB, 0x16, 0x15, 
-0xD3, 0x38, 0x33, 0xD5, 0xA7, 0x76, 0x4B, 0xEE, 0x6A, 0x92, 0x3E, 0x5C, 0x90, 0xCB, 0x76, 0x0B, 
-0x44, 0xB1, 0xDA, 0xF6, 0xB0, 0xCB, 0x1A, 0x5B, 0x9E, 0x54, 0x5E, 0xFD, 0xDE, 0xC2, 0xCD, 0x6F, 
-0x6F, 0x0D, 0x92, 0x2E, 0xB2, 0x34, 0x7E, 0x7F, 0x9E, 0xC2, 0xD8, 0x83, 0xF2, 0x5A, 0x5F, 0x43, 
-0xCC, 0x50, 0x59, 0x85, 0x7E, 0x98, 0x65, 0x95, 0x52, 0x88, 0xEE, 0x23, 0x86, 0x46, 0x88, 0xA6, 
-0xC9, 0x51, 0x93, 0x72, 0x47, 0xDE, 0x22, 0x55, 0x9F, 0x90, 0xD7, 0x4A, 0xC1, 0x13, 0x00, 0x7C, 
-0x4A, 0x9E, 0x53, 0xE3, 0xDB, 0x20, 0x6B, 0x4E, 0x4D, 0x05, 0x65, 0x3A, 0x97, 0x50, 0xC8, 0x88, 
-0xC9, 0x2E, 0x6B, 0xFF, 0x32, 0xCA, 0x17, 0x41, 0xFC, 0x6D, 0x86, 0x1B, 0x30, 0x59, 0x63, 0x8C, 
-0x34, 0x82, 0xB9, 0xA0, 0xD2, 0x9D, 0x4B, 0x51, 0x1C, 0xA1, 0x69, 0x2B, 0xC2, 0xAB, 0x47, 0xCA, 
-0x4E, 0x7C, 0x52, 0x35, 0x92, 0xCC, 0x44, 0x4D, 0xA9, 0x4D, 0x83, 0x6A, 0x2B, 0xF5, 0x9A, 0x5A, 
-0x1A, 0x5D, 0xC2, 0x70, 0x67, 0x9D, 0x98, 0xE3, 0x51, 0xA4, 0xDA, 0xCE, 0x3A, 0xA7, 0xB3, 0x1F, 
-0x84, 0xD2, 0xFB, 0xC2, 0x80, 0xA1, 0x48, 0x6E, 0xA9, 0x3F, 0x1B, 0x1A, 0x65, 0x96, 0x63, 0x4A, 
-0xB5, 0x19, 0xA5, 0x5A, 0xF4, 0x54, 0x72, 0x64, 0xDE, 0x45, 0x90, 0xB5, 0x3B, 0x1D, 0x3C, 0xC8, 
-0x94, 0xF1, 0x50, 0x01, 0xAC, 0x68, 0x4E, 0x3D, 0x6B, 0x84, 0x24, 0x00, 0xE3, 0xE8, 0xBA, 0x14, 
-0x9D, 0x2F, 0xE4, 0xF4, 0x16, 0x2F, 0xDD, 0x3D, 0x4F, 0x31, 0x9D, 0x00, 0xDE, 0x33, 0xEC, 0xA5, 
-0x56, 0x72, 0xAF, 0x35, 0x5A, 0x6B, 0xA8, 0xB8, 0xD7, 0x54, 0x6F, 0xED, 0xC1, 0x44, 0xB1, 0x6C, 
-0x0C, 0xE7, 0xB5, 0x45, 0xF3, 0x35, 0x58, 0xE1, 0xEA, 0x4F, 0xC0, 0x14, 0x7F, 0xF8, 0xDD, 0xFF, 
-0xFE, 0x7F, 0xFF, 0xF6, 0x4F, 0xEC, 0x08, 0x7B, 0xCC, 0x44, 0x02, 0xD5, 0xEB, 0x8F, 0xAD, 0x52, 
-0x15, 0xE5, 0xEA, 0x18, 0xCA, 0xE1, 0xC5, 0xF4, 0x7E, 0x25, 0x29, 0xAB, 0x71, 0xF7, 0xC6, 0x50, 
-0x4A, 0x74, 0x6C, 0x06, 0xD8, 0x73, 0x8B, 0x56, 0x56, 0x63, 0x73, 0x48, 0xD7, 0x5D, 0x65, 0xFF, 
-0x74, 0xC3, 0xF9, 0x09, 0x87, 0xD2, 0x99, 0x19, 0x74, 0x6E, 0x5A, 0x42, 0x37, 0xC9, 0x20, 0x0E, 
-0xFF, 0x84, 0x10, 0x64, 0x52, 0x08, 0x9A, 0xD3, 0xED, 0x5A, 0x53, 0xF6, 0x86, 0x45, 0x35, 0x8D, 
-0xC4, 0xCB, 0xC5, 0xAC, 0x62, 0x8A, 0xE3, 0x6E, 0x49, 0x44, 0xA9, 0x72, 0x87, 0x52, 0xD7, 0x15, 
-0xD0, 0x40, 0xEF, 0x7A, 0x16, 0xF3, 0x04, 0xE5, 0xCE, 0x46, 0x85, 0x72, 0xEB, 0xF0, 0x96, 0x3A, 
-0x35, 0x10, 0x96, 0x04, 0x00, 0xAE, 0x40, 0xA9, 0x72, 0xB5, 0x6A, 0xD1, 0x96, 0x70, 0x56, 0x79, 
-0x87, 0x97, 0xEC, 0xC3, 0x09, 0x83, 0x5F, 0x3D, 0x72, 0xE9, 0xD1, 0x43, 0x76, 0x7F, 0xD7, 0xD7, 
-0xFF, 0x05, 0x3A, 0xB1, 0xA1, 0xB5, 0xA3, 0x26, 0x40, 0x5B, 0x46, 0x54, 0x6E, 0x4A, 0x2A, 0x78, 
-0x48, 0xE0, 0x47, 0x3E, 0x5D, 0x17, 0xED, 0x3B, 0xA3, 0xBB, 0x83, 0x7B, 0x3D, 0x45, 0x1D, 0x23, 
-0x05, 0x4D, 0x3D, 0xFA, 0x0F, 0xD8, 0xA0, 0xB2, 0x6B, 0x40, 0x79, 0x6D, 0x2F, 0x87, 0xC6, 0xE4, 
-0x05, 0x8C, 0xC9, 0xED, 0x85, 0x1D, 0x64, 0x3F, 0xFE, 0x1F, 0x50, 0x98, 0x3E, 0x70, 0xF4, 0x1C, 
-0xC9, 0xB0, 0x46, 0xF7, 0xA5, 0x44, 0x72, 0x1A, 0x5F, 0x93, 0x1C, 0xAA, 0xB9, 0xE6, 0x8D, 0x01, 
-0x1D, 0x4A, 0xBD, 0x06, 0x3A, 0x1B, 0xEE, 0x24, 0xBE, 0x52, 0xDA, 0x54, 0xA7, 0xD3, 0x51, 0x37, 
-0x0D, 0xE4, 0xF8, 0xC3, 0x52, 0xB5, 0xFA, 0x5D, 0x76, 0xAC, 0x33, 0xE8, 0x1B, 0xFA, 0xCC, 0xF8, 
-0xFC, 0x6D, 0xF9, 0xBC, 0x49, 0x25, 0x82, 0x82, 0x9D, 0x32, 0x07, 0x7F, 0x07, 0xFD, 0xB0, 0x95, 
-0x66, 0x44, 0xEA, 0xFA, 0x65, 0xB0, 0xCC, 0x75, 0x8E, 0x66, 0x91, 0xBB, 0x7F, 0x8B, 0x61, 0x52, 
-0x75, 0x9D, 0x54, 0x42, 0xA8, 0x3A, 0x98, 0x5B, 0x8A, 0x5C, 0x05, 0xD0, 0xB5, 0x8B, 0x32, 0xE4, 
-0x4A, 0x9E, 0x34, 0xB6, 0x2B, 0x89, 0x49, 0x14, 0x22, 0xE2, 0x18, 0x4F, 0xE2, 0x42, 0x59, 0xA5, 
-0x6D, 0x9C, 0x41, 0x60, 0xDA, 0x57, 0x06, 0x74, 0xED, 0xAB, 0x02, 0x68, 0xD9, 0xC6, 0x5D, 0x4B, 
-0xFB, 0xC8, 0xD2, 0x00, 0xD1, 0x1D, 0xE3, 0x56, 0x34, 0x65, 0xDD, 0x27, 0xD6, 0x74, 0xEA, 0xFF, 
-0xF0, 0x83, 0x79, 0x82, 0x79, 0xC5, 0x4A, 0xBA, 0xCA, 0x63, 0x85, 0x22, 0x59, 0x8F, 0x84, 0x50, 
-0xD0, 0x20, 0xA1, 0x93, 0x64, 0x57, 0x84, 0x7F, 0xAF, 0x05, 0x47, 0x29, 0x80, 0x15, 0x50, 0x6A, 
-0x34, 0x9E, 0xA5, 0xD3, 0x68, 0x3C, 0xC4, 0xA3, 0x04, 0xE4, 0x21, 0x4C, 0x5E, 0x01, 0x56, 0x2F, 
-0x3B, 0x79, 0x25, 0x56, 0xBF, 0x2D, 0x95, 0xCA, 0xC2, 0xB8, 0x53, 0xC1, 0xCC, 0xCB, 0x57, 0xAB, 
-0x99, 0x5A, 0x1D, 0xED, 0xAA, 0x7C, 0x18, 0xD2, 0x0D, 0x61, 0xAF, 0xA6, 0x98, 0x98, 0x11, 0xE9, 
-0x3C, 0x18, 0xA3, 0xD9, 0x84, 0x4A, 0x40, 0x77, 0xB7, 0x55, 0x57, 0xD8, 0xE2, 0xF4, 0xA3, 0xD3, 
-0x97, 0x47, 0xAF, 0xF6, 0x5F, 0x1C, 0x9E, 0xD8, 0x52, 0xD3, 0xAE, 0x51, 0x75, 0xFC, 0x40, 0x2A, 
-0x03, 0x49, 0x30, 0x0B, 0x1D, 0x7E, 0x9B, 0x4C, 0xAC, 0xBC, 0xDA, 0x0E, 0x99, 0x45, 0xFD, 0x17, 
-0x94, 0xF1, 0x9D, 0x69, 0xC2, 0x02, 0x37, 0x8D, 0x03, 0x50, 0xE1, 0x5B, 0x95, 0x53, 0x70, 0x8F, 
-0xE8, 0x42, 0xFE, 0x58, 0x43, 0x51, 0xFC, 0xD3, 0x12, 0xAF, 0x06, 0x21, 0xF6, 0x35, 0x90, 0x15, 
-0x95, 0xD0, 0x0D, 0x36, 0x64, 0x1B, 0x8F, 0xF7, 0x7F, 0x71, 0xF2, 0xE7, 0x21, 0xAC, 0x60, 0x44, 
-0x9B, 0xBC, 0x6B, 0x90, 0xCA, 0x71, 0x24, 0x58, 0x41, 0xAB, 0xBE, 0x41, 0x29, 0x21, 0x98, 0x1E, 
-0x13, 0x93, 0x57, 0x26, 0xA2, 0x34, 0x53, 0xE7, 0xA8, 0x45, 0xAC, 0xD9, 0x23, 0x5D, 0x01, 0x53, 
-0xE4, 0x55, 0x7A, 0x27, 0x53, 0x90, 0x61, 0xD6, 0xBC, 0x3A, 0x96, 0x52, 0x53, 0x75, 0xD0, 0x75, 
-0xAD, 0x60, 0x40, 0x8E, 0xC2, 0x2A, 0x56, 0x08, 0x92, 0xAA, 0x29, 0x2C, 0x9A, 0x5A, 0x55, 0x57, 
-0x22, 0x64, 0x56, 0xAF, 0x12, 0x87, 0xDE, 0x6E, 0x31, 0x5B, 0xC1, 0x12, 0x85, 0xCB, 0x56, 0xAA, 
-0x04, 0x51, 0x45, 0x3F, 0x90, 0x28, 0xF6, 0xB2, 0xB4, 0xAA, 0x23, 0xB8, 0x20, 0x91, 0x81, 0x6D, 
-0x2E, 0x45, 0xAB, 0x57, 0x0E, 0x02, 0x5B, 0x5D, 0x33, 0xD4, 0x25, 0x32, 0x75, 0xAB, 0x85, 0xE8, 
-0xB0, 0xBD, 0x4E, 0xE8, 0x3A, 0xCE, 0x0A, 0x61, 0xC9, 0xE2, 0x9D, 0xAE, 0x4E, 0x25, 0x54, 0x19, 
-0x2B, 0x9D, 0x63, 0x68, 0xF5, 0x78, 0xA9, 0xBC, 0x45, 0xF5, 0x63, 0xA6, 0x4B, 0xA8, 0x8D, 0x1A, 
-0xF9, 0xDB, 0xCD, 0xAA, 0xCD, 0x41, 0xAD, 0x9F, 0x51, 0x0E, 0x4B, 0x9D, 0xE5, 0x49, 0xA4, 0x80, 
-0xA2, 0xE1, 0x2C, 0xA9, 0x48, 0x30, 0xC4, 0x1B, 0xA4, 0xC9, 0x00, 0x08, 0x22, 0x56, 0xFA, 0x20, 
-0x9B, 0x39, 0x93, 0x44, 0xF5, 0x63, 0xC5, 0xA4, 0x0F, 0xB0, 0x6A, 0xDD, 0xA4, 0x6F, 0x80, 0x64, 
-0x75, 0xE7, 0xA3, 0x26, 0x9C, 0xCD, 0x61, 0xD0, 0x98, 0x18, 0xF2, 0x66, 0x26, 0x53, 0x2D, 0x5F, 
-0x93, 0xD1, 0x14, 0x74, 0xE0, 0x35, 0x7F, 0xC1, 0x2E, 0xB9, 0x54, 0x89, 0x1B, 0x59, 0xA2, 0x19, 
-0x60, 0x5F, 0xE5, 0x4A, 0x33, 0x5B, 0x95, 0x97, 0x33, 0x11, 0x8D, 0xB2, 0x2D, 0xCD, 0xA0, 0x08, 
-0xB4, 0x6D, 0x91, 0xCD, 0xE2, 0xD3, 0x8A, 0xD5, 0xE8, 0x01, 0xE1, 0x90, 0xDD, 0xC3, 0xE7, 0xEA, 
-0x53, 0xFA, 0x34, 0xE8, 0x64, 0x3B, 0x17, 0x18, 0x0F, 0x43, 0x1B, 0xA5, 0x76, 0x33, 0x82, 0xF7, 
-0x65, 0xA9, 0xC3, 0xE8, 0xA2, 0x91, 0xF1, 0x15, 0xD9, 0x55, 0xF9, 0x96, 0xB3, 0x4F, 0x5E, 0x72, 
-0x69, 0x4D, 0x4E, 0x2F, 0xCD, 0x5A, 0x65, 0x83, 0x95, 0xF4, 0xC5, 0xA0, 0x88, 0xBA, 0x70, 0x6B, 
-0xF7, 0xDF, 0xFD, 0x70, 0xD4, 0xF2, 0xE8, 0x05, 0xE5, 0xD5, 0xD5, 0xD5, 0x54, 0x74, 0xA9, 0x26, 
-0xF2, 0x84, 0x61, 0xBF, 0xE8, 0x16, 0x14, 0x50, 0xDB, 0x82, 0x8B, 0x20, 0x8A, 0x49, 0x55, 0x6B, 
-0x63, 0xA2, 0x4A, 0xF4, 0xBC, 0x90, 0x79, 0x87, 0x62, 0xB0, 0xE9, 0x38, 0xAA, 0xD5, 0x3C, 0x8C, 
-0x0A, 0xE5, 0x99, 0x80, 0xD3, 0xF3, 0xC5, 0x21, 0x15, 0x53, 0x37, 0x71, 0x49, 0x8D, 0xBC, 0x3D, 
-0x17, 0x77, 0x2E, 0xE5, 0x18, 0x70, 0x23, 0x72, 0x4D, 0xB2, 0xCB, 0xF3, 0x08, 0x00, 0xA3, 0x4F, 
-0x09, 0xF9, 0x90, 0xC1, 0x34, 0x92, 0xF7, 0x71, 0x95, 0x6E, 0x0E, 0x37, 0x6B, 0xF8, 0x51, 0x5D, 
-0x93, 0xE5, 0xB2, 0xA2, 0x35, 0x1C, 0x22, 0x5D, 0x73, 0x3D, 0xFB, 0x47, 0x61, 0xC9, 0xFC, 0x2A, 
-0xD1, 0x99, 0x43, 0xF5, 0x6B, 0x24, 0x47, 0x73, 0x19, 0x96, 0x5A, 0xF7, 0x6D, 0x78, 0x54, 0xF0, 
-0x3C, 0x02, 0xCA, 0xAE, 0x89, 0x25, 0x65, 0x53, 0xBB, 0x16, 0x8E, 0x46, 0xFE, 0x35, 0x17, 0x43, 
-0x68, 0xB7, 0x6A, 0xCB, 0xA9, 0x71, 0xBC, 0xDD, 0xD5, 0x59, 0xF4, 0x2A, 0xCB, 0x86, 0x4E, 0xAF, 
-0xB7, 0x7A, 0xD9, 0x50, 0x99, 0xF3, 0xEA, 0x97, 0x0D, 0x5D, 0x42, 0x6D, 0xD6, 0xCB, 0xDF, 0xD6, 
-0x72, 0xAF, 0x5A, 0xAC, 0x8A, 0x65, 0x55, 0xFC, 0x03, 0xC4, 0xB2, 0x2D, 0x8C, 0xA1, 0x89, 0x75, 
-0x84, 0xB1, 0x6A, 0xEF, 0x9A, 0xC2, 0x58, 0x41, 0xAF, 0x8A, 0x58, 0x33, 0xB7, 0x60, 0xDD, 0xE2, 
-0x2F, 0x6B, 0xBB, 0xB2, 0xD1, 0xAA, 0xEA, 0xD3, 0x01, 0x70, 0x17, 0x70, 0x89, 0x5B, 0xDB, 0x4C, 
-0x64, 0xF7, 0x62, 0x5F, 0xB2, 0x97, 0xE9, 0x25, 0xCF, 0xD8, 0x41, 0x10, 0x8F, 0x17, 0xB1, 0x6B, 
-0x8B, 0xCB, 0xCB, 0xFF, 0xD2, 0x62, 0x8D, 0x81, 0x0D, 0xD3, 0xC2, 0xAB, 0xFD, 0x49, 0xF5, 0x7F, 
-0x95, 0xF6, 0x07, 0xC5, 0x5C, 0xA3, 0x51, 0x49, 0x23, 0x81, 0xA9, 0x1E, 0xA8, 0x5A, 0x85, 0xC0, 
-0xDA, 0xB3, 0xD1, 0xA8, 0xAB, 0x6D, 0x17, 0x3B, 0x7C, 0x4D, 0xEC, 0x68, 0xDD, 0xB9, 0xB3, 0xBB, 
-0x73, 0xDB, 0xB7, 0x71, 0x56, 0xE2, 0x6E, 0x5B, 0x80, 0x07, 0x69, 0xC2, 0xC7, 0x45, 0x10, 0xAA, 
-0xED, 0x16, 0xD7, 0x10, 0x33, 0xB0, 0xE9, 0x5F, 0x17, 0x9B, 0x71, 0x70, 0x2F, 0xE8, 0x49, 0x6C, 
-0xC4, 0xB1, 0xF0, 0x4A, 0x74, 0xF6, 0x63, 0x9E, 0x15, 0xC1, 0x6A, 0x5C, 0x76, 0xA4, 0xAA, 0x24, 
-0xB6, 0xAF, 0xC5, 0x5E, 0xF6, 0xB5, 0x70, 0xAB, 0xDB, 0xA4, 0xAA, 0x43, 0xCC, 0xB3, 0x5B, 0x5E, 
-0xA3, 0x5F, 0x7D, 0xDA, 0x76, 0x49, 0x17, 0xD4, 0x04, 0x51, 0x8C, 0x54, 0x61, 0x71, 0x86, 0xFB, 
-0x52, 0x33, 0x64, 0x42, 0x98, 0x3B, 0x18, 0x79, 0xD0, 0x0E, 0xA3, 0x60, 0x9A, 0xA4, 0x78, 0xEE, 
-0x09, 0x6A, 0x67, 0x90, 0x85, 0x4C, 0x2C, 0xA2, 0xE5, 0x32, 0x46, 0x17, 0x41, 0x12, 0x1C, 0xD0, 
-0x3C, 0x77, 0x09, 0xA1, 0xC7, 0x81, 0xCC, 0x90, 0x20, 0x5F, 0x47, 0xF9, 0xD3, 0x68, 0x7A, 0x0E, 
-0x2C, 0x92, 0x83, 0xC5, 0x21, 0xB7, 0x4C, 0x8C, 0x19, 0x08, 0xA5, 0xF4, 0xD8, 0xCC, 0xC5, 0xFE, 
-0xB0, 0x84, 0x78, 0x0B, 0xB8, 0xA5, 0xB7, 0xE7, 0xAD, 0x4F, 0xB6, 0x78, 0xD9, 0x13, 0xDF, 0x26, 
-0xF3, 0x87, 0x03, 0x91, 0x1C, 0xF2, 0x88, 0x66, 0x8E, 0x01, 0x66, 0x77, 0x2D, 0x30, 0xB5, 0x53, 
-0x9A, 0x00, 0x75, 0xE8, 0x0A, 0x2A, 0x6B, 0x74, 0xE8, 0xB9, 0x45, 0x8B, 0x4A, 0x2B, 0x86, 0x17, 
-0x35, 0x0D, 0xF3, 0xD2, 0x33, 0xC6, 0xCF, 0x7F, 0xFC, 0xFB, 0xBF, 0x39, 0x7E, 0x7E, 0xC2, 0x0E, 
-0x4E, 0x5E, 0x9C, 0xBE, 0x7E, 0xAE, 0xF6, 0x0B, 0x9C, 0x1A, 0xEE, 0xB6, 0xA7, 0x9A, 0x5C, 0xAA, 
-0xAC, 0xC5, 0x8D, 0x4D, 0xAD, 0xE1, 0x96, 0xC4, 0xF5, 0x9A, 0x52, 0x52, 0x45, 0x37, 0xA5, 0xBE, 
-0x08, 0xDF, 0x56, 0x29, 0xD5, 0xC8, 0xD5, 0x53, 0x7A, 0x33, 0xB2, 0xF6, 0xC9, 0xCB, 0xB3, 0xE3, 
-0xE7, 0xC7, 0xBF, 0x3A, 0x3A, 0x1C, 0x32, 0x4A, 0x7B, 0x2B, 0x95, 0x24, 0xA0, 0x91, 0x4C, 0x6A, 
-0x28, 0xF3, 0xD2, 0x1A, 0x9A, 0x90, 0x38, 0x29, 0x97, 0x6F, 0x61, 0x15, 0xD9, 0xCF, 0xB2, 0x60, 
-0xD9, 0x8D, 0x72, 0xFA, 0xD7, 0x7A, 0x6B, 0x29, 0xD7, 0x96, 0xF3, 0xE7, 0x7F, 0x49, 0x50, 0x3A, 
-0x1C, 0xEE, 0x9F, 0x9D, 0x9C, 0xB2, 0x57, 0x47, 0x07, 0xC7, 0x8F, 0x8F, 0x0F, 0xE1, 0x1B, 0x3C, 
-0x33, 0x3D, 0x40, 0xAC, 0x1A, 0x2F, 0x17, 0x49, 0x91, 0x62, 0xFA, 0x5C, 0x89, 0x58, 0x14, 0xC4, 
-0xC3, 0x0D, 0x75, 0x6C, 0x2F, 0xEF, 0xA7, 0x8C, 0xC9, 0x8B, 0xB3, 0x0E, 0x82, 0xC7, 0x39, 0x56, 
-0x43, 0xF0, 0xBC, 0xAB, 0xC9, 0x9A, 0xAE, 0xF3, 0x8A, 0x2A, 0x0A, 0xE0, 0x0D, 0x7D, 0x92, 0x46, 
-0x56, 0xBB, 0x05, 0x2B, 0xD3, 0x42, 0xE2, 0x4B, 0x18, 0xA2, 0x9B, 0xB5, 0x8E, 0xA7, 0xB0, 0x64, 
-0x56, 0x74, 0x6C, 0xE7, 0x53, 0x5B, 0x17, 0xD7, 0x75, 0x0F, 0x19, 0x00, 0xE6, 0x2A, 0x90, 0x6D, 
-0x5F, 0x35, 0x98, 0x94, 0x38, 0xAA, 0xAB, 0xEA, 0x82, 0x46, 0xDC, 0xE4, 0x1D, 0xBB, 0x46, 0x87, 
-0x9A, 0xDD, 0x6B, 0xDD, 0x5E, 0xBD, 0xF1, 0xE1, 0xDA, 0x61, 0xFD, 0xEF, 0xBA, 0x85, 0xAA, 0xB3, 
-0xE9, 0x1B, 0x32, 0xE4, 0x58, 0x7B, 0x20, 0x1A, 0x2F, 0x43, 0xFC, 0xEA, 0xAB, 0xAF, 0xD8, 0xD3, 
-0xE3, 0xD3, 0xB3, 0x93, 0x57, 0xC7, 0xFB, 0xEC, 0x60, 0xFF, 0xF9, 0xE3, 0xE3, 0x13, 0x68, 0x65, 
-0x5F, 0xA5, 0x11, 0xC1, 0x23, 0xFA, 0x69, 0x16, 0x4C, 0x40, 0x21, 0x60, 0x50, 0xD4, 0xF5, 0x57, 
-0x72, 0xA7, 0x87, 0x41, 0x53, 0x9F, 0x35, 0x66, 0x33, 0x78, 0x06, 0xFD, 0xC8, 0xD8, 0x1C, 0xF9, 
-0xDC, 0xE5, 0xEC, 0x37, 0xBD, 0xEF, 0x9C, 0x96, 0x2A, 0xD5, 0x5F, 0xC7, 0x40, 0x87, 0xB4, 0xA6, 
-0x7A, 0x1D, 0xED, 0x6A, 0x6D, 0x34, 0x8B, 0x84, 0xF8, 0x29, 0xB5, 0xA2, 0x02, 0xAF, 0x37, 0x46, 
-0x33, 0xE9, 0x22, 0x80, 0x49, 0x38, 0x8A, 0x1D, 0x2F, 0xA9, 0x06, 0xDF, 0x6A, 0x0F, 0x16, 0x1F, 
-0x45, 0xBE, 0x66, 0xEF, 0xEC, 0x6B, 0x32, 0xCF, 0xDA, 0x94, 0x10, 0x12, 0x92, 0x44, 0x2A, 0xDE, 
-0x55, 0x28, 0x5B, 0xB6, 0xE5, 0xDE, 0x9E, 0xA7, 0xC6, 0x99, 0x19, 0x6D, 0x50, 0x57, 0xDC, 0x6B, 
-0x70, 0x5B, 0xE3, 0xFC, 0x54, 0x4A, 0x3F, 0x96, 0x47, 0x09, 0x28, 0x0C, 0xB3, 0x51, 0x94, 0x62, 
-0xAE, 0xD7, 0x93, 0x19, 0xD8, 0xAE, 0x9C, 0x2E, 0xD2, 0x34, 0x53, 0xDE, 0xB0, 0x90, 0x2B, 0x7E, 
-0x35, 0x79, 0x75, 0xC5, 0xD5, 0x9C, 0xE8, 0xEE, 0xD3, 0xDE, 0xC0, 0x14, 0xD7, 0x1C, 0x1D, 0xF2, 
-0x23, 0x68, 0xA3, 0x94, 0xBA, 0x2C, 0x45, 0x03, 0x79, 0x16, 0x60, 0x2A, 0xF0, 0x44, 0x1E, 0x5C, 
-0xA5, 0x0A, 0xF8, 0x95, 0x99, 0x4D, 0xB7, 0x86, 0x52, 0xAA, 0xD7, 0x46, 0x86, 0x5D, 0x67, 0x5D, 
-0xD8, 0x3F, 0x38, 0x7B, 0xBD, 0xFF, 0xEC, 0xF8, 0x57, 0x78, 0xE2, 0xC1, 0xBE, 0x79, 0xB5, 0xFF, 
-0xE4, 0xF8, 0x60, 0xDF, 0x5C, 0x1C, 0x9C, 0x79, 0x93, 0x8E, 0x79, 0x4E, 0x87, 0xD8, 0x5B, 0xCC, 
-0x1E, 0xE2, 0x2D, 0xB6, 0x41, 0xF3, 0x21, 0xDF, 0x30, 0x15, 0xFC, 0x0F, 0x8B, 0x5D, 0x15, 0x97, 
-0x6D, 0xAA, 0x7C, 0xD9, 0x3A, 0x56, 0xC5, 0x08, 0xF8, 0x13, 0xA9, 0x63, 0x80, 0xF3, 0xDE, 0xC8, 
-0xD8, 0xA1, 0x9A, 0xB0, 0xCF, 0x50, 0x44, 0xC1, 0x34, 0x95, 0xEA, 0xAF, 0x55, 0x6A, 0x50, 0x2D, 
-0x65, 0x64, 0xEF, 0xC6, 0xCC, 0xDD, 0x5D, 0xF8, 0xAA, 0x02, 0xD9, 0x84, 0x2F, 0x9E, 0x91, 0x49, 
-0xDE, 0x13, 0x2B, 0x02, 0xA4, 0xD1, 0xFB, 0x2C, 0x5B, 0x82, 0x3B, 0xC0, 0xC8, 0x05, 0x65, 0x8B, 
-0xF5, 0x4C, 0xFB, 0x8A, 0x0C, 0xB9, 0x17, 0xD4, 0x8A, 0x0E, 0xEB, 0xF9, 0xBA, 0x19, 0xF2, 0xD0, 
-0x8D, 0x41, 0x79, 0xCA, 0xC1, 0xF2, 0x47, 0xB5, 0x97, 0x0E, 0xE7, 0x4A, 0x90, 0x51, 0xCE, 0xCE, 
-0x17, 0xE8, 0x9D, 0xFB, 0x88, 0xF5, 0x79, 0xBF, 0xB7, 0xB9, 0xC5, 0x22, 0x74, 0x0C, 0x3C, 0x9A, 
-0xA7, 0xE3, 0x73, 0xD6, 0xC6, 0xDB, 0x86, 0x19, 0x5E, 0x37, 0x8C, 0x5E, 0x87, 0xAF, 0xCE, 0x0E, 
-0x36, 0xBB, 0x0A, 0x1E, 0x02, 0x99, 0x05, 0x78, 0x1F, 0x35, 0x95, 0x9F, 0xA1, 0xC3, 0x03, 0xA6, 
-0x23, 0x6F, 0x1F, 0x9D, 0xBE, 0xDC, 0x19, 0x00, 0x2F, 0xE2, 0x4C, 0x97, 0xC5, 0x55, 0xF4, 0x8C, 
-0x00, 0xFA, 0xD0, 0x68, 0x9D, 0xBC, 0x5C, 0xD5, 0x47, 0x20, 0xAC, 0x58, 0x4A, 0x85, 0x1E, 0xB7, 
-0x81, 0xE1, 0xD3, 0x2C, 0x74, 0xE2, 0x31, 0x50, 0x0D, 0x17, 0x59, 0x29, 0xEC, 0x83, 0x69, 0x64, 
-0x36, 0x51, 0xA1, 0x14, 0x35, 0xB4, 0xB6, 0x69, 0x7E, 0x73, 0x25, 0x9B, 0x50, 0x4F, 0x09, 0xB5, 
-0x3A, 0xB7, 0x5E, 0x45, 0x84, 0x21, 0x2B, 0x05, 0x5E, 0x64, 0xDC, 0x13, 0x8C, 0x7E, 0x35, 0x51, 
-0x48, 0x1C, 0x50, 0xA9, 0xAF, 0x90, 0xD4, 0xC9, 0xDD, 0x5D, 0xEC, 0x36, 0xBB, 0x45, 0xFA, 0x0C, 
-0x6F, 0x44, 0xE2, 0x08, 0xFC, 0xB4, 0xC0, 0x13, 0xEB, 0x36, 0xA6, 0x9F, 0x7C, 0xCF, 0xCE, 0xD3, 
-0x05, 0x66, 0x29, 0x18, 0x74, 0xC2, 0x68, 0x1A, 0xA1, 0x4F, 0xE3, 0x8C, 0xB2, 0x7C, 0x1B, 0x8F, 
-0x74, 0x94, 0xB8, 0x23, 0xD0, 0x28, 0x95, 0x7A, 0x49, 0xE5, 0x87, 0x7E, 0x81, 0x4E, 0xB6, 0x16, 
-0x48, 0x18, 0x4F, 0xDF, 0xD4, 0x78, 0x76, 0xB5, 0x35, 0x05, 0xAC, 0x39, 0x45, 0xF1, 0x84, 0x86, 
-0x15, 0xDE, 0xEC, 0x94, 0xE2, 0x7D, 0xA5, 0x38, 0x37, 0x31, 0xF3, 0xBC, 0x77, 0xAD, 0x2C, 0xA8, 
-0x86, 0x39, 0xDC, 0x1D, 0xE6, 0xF6, 0xBE, 0xBA, 0xCA, 0x0A, 0xDE, 0xC2, 0x9A, 0x78, 0x51, 0x0B, 
-0x9F, 0x8A, 0xE6, 0xDA, 0xE2, 0xF2, 0x07, 0x8C, 0x4A, 0x3B, 0xA7, 0xEB, 0xDA, 0x80, 0x51, 0x0B, 
-0xCC, 0xBE, 0x05, 0x13, 0x46, 0x4E, 0x96, 0x6A, 0xF3, 0x94, 0x41, 0x48, 0xDE, 0x55, 0xA0, 0xE9, 
-0x9F, 0x10, 0x1E, 0x6D, 0x6C, 0xE0, 0x01, 0xA8, 0x5E, 0x5F, 0xC3, 0xFF, 0x43, 0x6C, 0x6E, 0xD3, 
-0xB3, 0xE2, 0xAB, 0xC1, 0xD3, 0x80, 0x3E, 0xED, 0x58, 0x35, 0x2F, 0x43, 0xE8, 0x46, 0x23, 0xF3, 
-0x45, 0xE0, 0x78, 0x26, 0x29, 0xD3, 0x54, 0xB3, 0xCA, 0xE9, 0x69, 0x70, 0xD6, 0xD9, 0xC0, 0xB0, 
-0xC2, 0xCA, 0xB2, 0x5B, 0x91, 0x99, 0x55, 0xC5, 0xBD, 0x44, 0xA5, 0x5A, 0x18, 0x6F, 0xA1, 0x6F, 
-0xD3, 0x77, 0x53, 0xD3, 0xAF, 0x97, 0xB5, 0xA2, 0x82, 0x1A, 0x68, 0x4A, 0x72, 0x5E, 0x9E, 0x01, 
-0x23, 0xB1, 0x8D, 0x57, 0x2B, 0x20, 0xF6, 0x3D, 0x10, 0x95, 0xCF, 0x70, 0x0D, 0x54, 0xF5, 0x7A, 
-0x05, 0xE4, 0x81, 0x07, 0x72, 0x4E, 0xD9, 0xC1, 0xBD, 0x50, 0xF1, 0x95, 0x2F, 0x2F, 0x03, 0xFD, 
-0x15, 0x72, 0xBC, 0x3E, 0xAA, 0x3E, 0x72, 0xD9, 0x5C, 0x51, 0x74, 0xAC, 0x32, 0xED, 0x98, 0x63, 
-0x19, 0x37, 0x8F, 0x1E, 0xA5, 0xCC, 0x03, 0xA9, 0x3A, 0x45, 0xAF, 0xB5, 0xDF, 0x2C, 0x38, 0x06, 
-0x9D, 0x15, 0x41, 0xF2, 0x9B, 0x45, 0x79, 0x61, 0x84, 0x5E, 0x8B, 0xBF, 0x91, 0xAA, 0xB1, 0xD6, 
-0x41, 0xC2, 0x00, 0x0B, 0xC0, 0xC2, 0x5C, 0x37, 0xE6, 0x95, 0x25, 0xDA, 0x82, 0xF7, 0x4C, 0x64, 
-0x63, 0xF3, 0xD5, 0xA7, 0xE8, 0x6A, 0x47, 0xD5, 0x90, 0x9B, 0xB9, 0x78, 0x18, 0x1E, 0x02, 0xC6, 
-0xF9, 0x3E, 0xED, 0x7F, 0xDA, 0xA9, 0xFC, 0x47, 0x8D, 0x37, 0xF1, 0x52, 0xD5, 0x72, 0xC1, 0xD4, 
-0xA7, 0x92, 0xB4, 0xAF, 0x49, 0x7B, 0x9E, 0xFA, 0x9E, 0xA6, 0xA8, 0x0C, 0x74, 0x35, 0x77, 0x16, 
-0x08, 0x82, 0x50, 0x29, 0xAC, 0xA3, 0x48, 0x6B, 0x5F, 0x7D, 0x8D, 0xB3, 0x35, 0xB5, 0xC3, 0xAA, 
-0xB5, 0x91, 0xF2, 0xCA, 0xAE, 0x10, 0x85, 0x5D, 0x80, 0xFB, 0x74, 0x6A, 0x8B, 0x52, 0x20, 0x42, 
-0x68, 0x40, 0xA3, 0xD7, 0x71, 0x58, 0x10, 0xAB, 0x8D, 0x4D, 0xA8, 0x2A, 0x18, 0x3A, 0x20, 0x92, 
-0x30, 0x0C, 0x46, 0xC6, 0x42, 0xD6, 0x9E, 0xC5, 0xC9, 0x8B, 0xBA, 0x3D, 0xB7, 0x3A, 0x78, 0xB6, 
-0xEB, 0x44, 0x15, 0xE0, 0x93, 0x27, 0x7A, 0x4F, 0xCD, 0x73, 0x99, 0x97, 0xA5, 0x52, 0x3B, 0x7A, 
-0xA5, 0xA1, 0xE6, 0xAD, 0x1D, 0xEF, 0x4B, 0xD7, 0xBF, 0x28, 0xC3, 0x1E, 0xBE, 0x3B, 0xA2, 0x4B, 
-0xEE, 0xF5, 0xFA, 0xD4, 0xC3, 0xA3, 0x77, 0x68, 0x17, 0x09, 0xA7, 0x78, 0x71, 0x66, 0x85, 0xA7, 
-0x54, 0x53, 0xBC, 0x1D, 0x9B, 0x8C, 0x26, 0x14, 0xFA, 0x82, 0x71, 0x0D, 0x5E, 0xC4, 0xC2, 0x32, 
-0x26, 0x5A, 0xB5, 0x84, 0xB7, 0xB5, 0x88, 0x39, 0x8E, 0xFA, 0x85, 0x96, 0x5A, 0xE4, 0x00, 0x60, 
-0x4B, 0x02, 0xEB, 0x1D, 0xE0, 0xDA, 0xDB, 0xB4, 0xA3, 0xF8, 0xFD, 0x5A, 0xE0, 0xA7, 0xD2, 0xE0, 
-0x04, 0x1C, 0xAD, 0xF2, 0xFA, 0xD1, 0xB7, 0x4F, 0xC4, 0x6E, 0x56, 0x34, 0x0D, 0x15, 0x55, 0xDE, 
-0xAA, 0x71, 0x98, 0xD5, 0x7B, 0x2D, 0x85, 0xA9, 0x0A, 0xC0, 0xC4, 0xE3, 0xA4, 0xB8, 0x09, 0x33, 
-0x04, 0x34, 0x45, 0x52, 0x14, 0x29, 0x0E, 0x85, 0xB4, 0x04, 0x34, 0x8D, 0xC6, 0x9C, 0x8D, 0xD2, 
-0xB4, 0xB0, 0x10, 0xA8, 0xE8, 0x61, 0x52, 0xC5, 0xAC, 0xAE, 0x73, 0xAE, 0x9A, 0x39, 0xB4, 0x31, 
-0xA0, 0xE6, 0x2B, 0x26, 0x5A, 0xCD, 0xFA, 0x5E, 0xE9, 0xB5, 0xBD, 0xE8, 0x4A, 0x12, 0x7C, 0xFA, 
-0x15, 0xBD, 0x6E, 0x0D, 0x37, 0x34, 0xAC, 0xA2, 0xAA, 0x61, 0xF9, 0x68, 0x57, 0x76, 0xF0, 0xBA, 
-0xFA, 0xD3, 0x27, 0x50, 0x7B, 0x3E, 0x1F, 0x7D, 0xAA, 0xAB, 0x67, 0xB9, 0xC9, 0x21, 0x0C, 0x43, 
-0xBA, 0x31, 0xC5, 0xCE, 0x0D, 0x54, 0x2B, 0x4A, 0x1C, 0x1B, 0x50, 0x7C, 0xD9, 0x5B, 0xA7, 0x8E, 
-0xC7, 0x36, 0x54, 0x82, 0x61, 0x55, 0x7D, 0x6B, 0xF5, 0x3E, 0xA2, 0x9C, 0x8C, 0xBE, 0x5C, 0x46, 
-0x38, 0x95, 0xB4, 0xD6, 0x8C, 0x73, 0x9B, 0x92, 0x7A, 0xE2, 0x3A, 0xA2, 0xAE, 0x7D, 0x12, 0xE6, 
-0x4B, 0x5E, 0x3C, 0xA1, 0xE7, 0xC7, 0x98, 0xB3, 0x11, 0xD0, 0xE8, 0xF4, 0x05, 0x02, 0x78, 0x20, 
-0xDE, 0xA6, 0x83, 0x06, 0x78, 0xD8, 0xDF, 0x83, 0x7F, 0x1E, 0x38, 0xA2, 0x11, 0x9E, 0xDD, 0xBA, 
-0xE5, 0xEE, 0xF6, 0x16, 0x78, 0xD1, 0xEA, 0x45, 0x29, 0x1D, 0xDE, 0x44, 0x72, 0xCF, 0x45, 0x49, 
-0xAC, 0x3D, 0xA7, 0x38, 0x5A, 0xD7, 0x66, 0x71, 0x6F, 0xD1, 0x32, 0x7F, 0x41, 0x1E, 0x4D, 0x93, 
-0x08, 0xF5, 0x8D, 0x04, 0x6F, 0x71, 0xC2, 0xDC, 0xB7, 0x39, 0xDA, 0x8D, 0xFD, 0xDE, 0x17, 0x9B, 
-0xEA, 0xD0, 0x8E, 0xD2, 0x00, 0x50, 0x6F, 0x2D, 0x49, 0x40, 0x0D, 0x75, 0x04, 0x7A, 0x68, 0xF2, 
-0xB9, 0x22, 0xA0, 0x4A, 0x8A, 0xA8, 0x7A, 0x3E, 0xAD, 0xC9, 0xAB, 0x64, 0xA1, 0xAA, 0xB3, 0x3A, 
-0x70, 0xAB, 0x83, 0x85, 0x3B, 0x62, 0x10, 0xCC, 0x95, 0xD8, 0x6D, 0x17, 0x0D, 0x25, 0x54, 0x1C, 
-0x14, 0x45, 0x9C, 0xF7, 0xE6, 0xDE, 0x67, 0x85, 0xF6, 0x08, 0x5D, 0x4E, 0xBA, 0xD5, 0xD5, 0xDD, 
-0x91, 0x48, 0xAE, 0xB9, 0x34, 0xB8, 0xCB, 0x4C, 0x09, 0x09, 0x67, 0x65, 0xBE, 0x3F, 0xC5, 0xD3, 
-0x6C, 0x4A, 0x38, 0x32, 0x89, 0xD3, 0x34, 0x6B, 0xCB, 0xE9, 0xAF, 0x70, 0xA4, 0xEC, 0x32, 0x68, 
-0x79, 0x8B, 0x1B, 0xBD, 0xF0, 0xAF, 0xCD, 0x0A, 0x24, 0x31, 0x9D, 0xAF, 0x09, 0xAB, 0x7E, 0x4F, 
-0x58, 0xE1, 0xE5, 0xD9, 0x5C, 0x34, 0x87, 0xD2, 0xD2, 0x47, 0xBE, 0xFF, 0xF1, 0x77, 0x62, 0x9B, 
-0x35, 0xC6, 0x28, 0x86, 0x30, 0x1D, 0x82, 0x36, 0x08, 0xD2, 0xF2, 0xE7, 0xEF, 0x15, 0xB4, 0xAB, 
-0xF3, 0xEF, 0x2B, 0x12, 0x18, 0x5B, 0x33, 0x70, 0xFF, 0x24, 0xED, 0x95, 0xF0, 0xAE, 0xE0, 0x6B, 
-0xB5, 0xCD, 0x35, 0xE1, 0xB7, 0x2A, 0xF0, 0x71, 0xBB, 0x0F, 0x4F, 0x27, 0x2B, 0x01, 0x32, 0x15, 
-0xC0, 0xD7, 0x00, 0xDA, 0xE9, 0x68, 0xD7, 0x33, 0x91, 0x11, 0xE9, 0x09, 0x2F, 0x70, 0xFD, 0xC6, 
-0xD4, 0x1D, 0xB9, 0x38, 0x19, 0x26, 0xC1, 0x77, 0x4B, 0x71, 0x6A, 0xA9, 0xE8, 0x4D, 0xB0, 0xA4, 
-0x38, 0xCE, 0x45, 0xF6, 0x6B, 0x9B, 0xDA, 0x5D, 0xAE, 0x1F, 0xCB, 0xAB, 0x71, 0x37, 0x45, 0xEE, 
-0x0F, 0x75, 0x51, 0x6E, 0xF5, 0xBD, 0x14, 0x67, 0x08, 0xB3, 0xDD, 0xDA, 0xC6, 0x36, 0x5B, 0x65, 
-0x20, 0x33, 0xDE, 0xE3, 0x9A, 0xC0, 0x72, 0x4D, 0xA9, 0xE5, 0xE0, 0x9F, 0xEE, 0xAF, 0x73, 0x30, 
-0x26, 0x36, 0xDD, 0x02, 0x42, 0x44, 0x57, 0xEE, 0x0D, 0x36, 0xCD, 0x96, 0x3F, 0xFE, 0xFE, 0x9F, 
-0xFF, 0x51, 0x1D, 0x79, 0x53, 0x71, 0x95, 0xD5, 0xC4, 0xDD, 0x98, 0x87, 0x89, 0xE5, 0xDB, 0x99, 
-0xBE, 0xC5, 0x36, 0xF4, 0xF1, 0x92, 0xC8, 0xA3, 0x4C, 0x4E, 0xCA, 0x89, 0xDA, 0x85, 0x5D, 0xBA, 
-0xE7, 0x0E, 0xEE, 0x1A, 0xAF, 0x13, 0xDD, 0x89, 0xDB, 0xD1, 0xE4, 0x1D, 0x8C, 0xD2, 0xA7, 0x49, 
-0xDE, 0x57, 0x58, 0xD9, 0x74, 0x22, 0x4C, 0xC4, 0x3B, 0xDF, 0xE6, 0x8C, 0x53, 0xA4, 0x9B, 0x03, 
-0x68, 0x9E, 0xE1, 0x3D, 0x97, 0x20, 0x64, 0xD5, 0x65, 0x6D, 0xBE, 0x8A, 0xF8, 0x29, 0x87, 0x42, 
-0x95, 0x54, 0x3B, 0xF4, 0x4D, 0xD0, 0x60, 0x06, 0xF7, 0xF5, 0x3E, 0x9C, 0xF9, 0xA9, 0xA6, 0xA0, 
-0xAC, 0x60, 0x47, 0x86, 0xD1, 0xBA, 0xD8, 0x09, 0xFF, 0x66, 0x30, 0xEB, 0xEA, 0xB0, 0xF3, 0x41, 
-0x5B, 0x13, 0xBB, 0x95, 0x47, 0x09, 0x2A, 0x51, 0x92, 0x0D, 0xA8, 0xC2, 0xBC, 0xA8, 0x78, 0x95, 
-0x97, 0x40, 0x3B, 0xF3, 0x62, 0xCB, 0x43, 0x61, 0x53, 0xD7, 0x31, 0x98, 0x78, 0x8C, 0xB1, 0xDA, 
-0x6D, 0x5E, 0xCF, 0xC2, 0xE4, 0x90, 0xDE, 0xDE, 0x90, 0xFC, 0x4B, 0x0D, 0x09, 0x27, 0x75, 0xE4, 
-0x5E, 0xEE, 0xA0, 0xB9, 0x9E, 0x7B, 0x8D, 0x6D, 0xD4, 0x1D, 0xF2, 0x7C, 0xEC, 0xB8, 0xB3, 0xAC, 
-0x0B, 0x8E, 0x7C, 0x7D, 0x1A, 0xDC, 0x36, 0x64, 0xC2, 0x88, 0xCF, 0x4A, 0xCA, 0x3D, 0x71, 0x8B, 
-0xAC, 0x90, 0x61, 0x14, 0xD0, 0x2D, 0xF2, 0xBC, 0x5E, 0xFB, 0xFE, 0x58, 0xD1, 0xB0, 0x70, 0x46, 
-0xA9, 0xC8, 0x36, 0xFD, 0xB8, 0x46, 0xB6, 0x55, 0xDE, 0xDB, 0x7A, 0xEC, 0x09, 0xE2, 0x20, 0xC6, 
-0xCE, 0xBA, 0xE8, 0x76, 0xC4, 0xE9, 0xAE, 0x5B, 0x40, 0x4D, 0x37, 0x75, 0xB3, 0x7A, 0x8F, 0x6D, 
-0xDD, 0xB9, 0x7D, 0xEB, 0x0F, 0xFF, 0xF4, 0x6F, 0x18, 0x01, 0x26, 0x7D, 0xB8, 0x24, 0x24, 0x36, 
-0x0F, 0x16, 0x39, 0xA6, 0x49, 0x01, 0x34, 0xE8, 0x96, 0xCD, 0x4A, 0xA7, 0xD1, 0x8C, 0xA2, 0xCB, 
-0x63, 0x55, 0x04, 0xC3, 0xA6, 0x69, 0xF5, 0x6B, 0x4B, 0x2F, 0x98, 0x06, 0x11, 0xA6, 0xC1, 0x43, 
-0x1D, 0x40, 0xDE, 0xCE, 0x48, 0x21, 0x52, 0x9C, 0xDB, 0x9D, 0x00, 0xE1, 0xBC, 0x98, 0x95, 0x5B, 
-0xDB, 0x15, 0x5A, 0xF8, 0xC6, 0x57, 0x97, 0xD9, 0x02, 0xE8, 0xBD, 0x9E, 0x99, 0x4F, 0xA6, 0x26, 
-0x31, 0x97, 0x5A, 0x26, 0x04, 0xF8, 0x4F, 0xB5, 0x50, 0x50, 0x02, 0x28, 0xCC, 0x75, 0xAF, 0xBD, 
-0xCB, 0xA0, 0x87, 0x5A, 0xD1, 0x82, 0xEF, 0x73, 0x74, 0x4B, 0x05, 0x61, 0xA8, 0x56, 0x46, 0xDC, 
-0xD3, 0x07, 0x22, 0x57, 0x73, 0x51, 0xA8, 0x4A, 0x3E, 0xA9, 0xA6, 0xD5, 0x35, 0x0A, 0xCC, 0x30, 
-0x82, 0x34, 0x7C, 0x7B, 0xCA, 0xB2, 0xA8, 0x0E, 0x59, 0x70, 0x42, 0x18, 0x1A, 0xAA, 0x28, 0x4F, 
-0x2F, 0x66, 0x78, 0xF5, 0x34, 0x15, 0x37, 0x9C, 0xFC, 0xCD, 0xDF, 0x0D, 0x55, 0x62, 0xC3, 0xC1, 
-0xD3, 0xFC, 0xDD, 0x50, 0xC5, 0x8D, 0x79, 0xF3, 0x45, 0xB2, 0xAD, 0x20, 0x83, 0x59, 0x51, 0xFD, 
-0x5E, 0xA3, 0x5F, 0x66, 0x35, 0xF3, 0xD9, 0x1A, 0xFD, 0x33, 0xAB, 0x9A, 0xCF, 0xAA, 0x55, 0x2B, 
-0x0F, 0xF4, 0xE1, 0xA4, 0x72, 0x74, 0x96, 0x31, 0x87, 0xC8, 0x24, 0xB4, 0x7E, 0x65, 0x33, 0x71, 
-0xAD, 0xBC, 0x5C, 0xFF, 0xBD, 0x6B, 0xE7, 0xEA, 0xB8, 0x41, 0x0F, 0x15, 0x37, 0x57, 0x85, 0x1B, 
-0x3A, 0xE9, 0xD4, 0x1A, 0x1A, 0xB4, 0x82, 0x4E, 0x2C, 0xBA, 0x57, 0x1A, 0x31, 0x06, 0x68, 0x6D, 
-0xF0, 0x95, 0xE8, 0x81, 0xCA, 0x18, 0x55, 0x9A, 0x71, 0x06, 0x75, 0xED, 0xA6, 0x2A, 0x5E, 0xB4, 
-0x95, 0x31, 0xAD, 0x34, 0xE5, 0x30, 0x81, 0xBF, 0xA9, 0xCA, 0x03, 0xAD, 0x3D, 0x68, 0x41, 0x70, 
-0x1D, 0x6F, 0x0E, 0xE5, 0xB7, 0xCE, 0x30, 0x45, 0x88, 0x12, 0x46, 0x28, 0xD0, 0xED, 0xA5, 0xF3, 
-0x9A, 0xA2, 0xB5, 0xAA, 0x49, 0x39, 0x48, 0x59, 0xAB, 0xC9, 0x1F, 0x7F, 0xFF, 0x3F, 0xFE, 0x7B, 
-0xB9, 0xC7, 0x3E, 0x4B, 0x93, 0x08, 0x5D, 0x0C, 0xD0, 0x64, 0x17, 0x09, 0xB2, 0x3B, 0x02, 0x39, 
-0xBA, 0x9C, 0x1D, 0x56, 0x85, 0x16, 0x9E, 0x26, 0x55, 0x5B, 0xD8, 0x46, 0x2D, 0x6C, 0x13, 0x03, 
-0xEF, 0xF3, 0xD6, 0xC7, 0xEA, 0x3C, 0x82, 0x0C, 0x2B, 0x74, 0x1E, 0xDA, 0x44, 0x2B, 0x32, 0x91, 
-0x3E, 0x9A, 0xE5, 0xE8, 0x02, 0xAE, 0x34, 0xED, 0xCF, 0x47, 0x3C, 0xAD, 0x77, 0x60, 0x6C, 0xF3, 
-0x3E, 0x29, 0x10, 0x22, 0xB4, 0x59, 0xAB, 0x13, 0x62, 0xDA, 0x1F, 0x5B, 0x53, 0xD0, 0xD2, 0x29, 
-0x94, 0xBF, 0x4C, 0x3A, 0x16, 0x07, 0x41, 0xF3, 0x2C, 0x2D, 0xD2, 0x71, 0x2A, 0xCE, 0x98, 0x5A, 
-0x60, 0x3F, 0xF3, 0x21, 0xED, 0x80, 0xBB, 0xE5, 0xCE, 0xD3, 0xBC, 0x48, 0x02, 0x99, 0x4A, 0xB2, 
-0x85, 0x8F, 0x63, 0x7C, 0xB4, 0x46, 0xD9, 0xFE, 0xE0, 0x6E, 0xB7, 0x07, 0x7F, 0xFA, 0x8E, 0x53, 
-0x85, 0x3A, 0x80, 0x3F, 0x28, 0xBD, 0xC8, 0xAF, 0x15, 0x6C, 0xAD, 0x0E, 0x47, 0x04, 0xB4, 0x55, 
-0x42, 0x48, 0xB7, 0x23, 0x8A, 0xC3, 0xBA, 0x1A, 0x0A, 0x02, 0xB6, 0xDF, 0x33, 0xBB, 0xF0, 0xD0, 
-0xC0, 0xE9, 0xCA, 0xD8, 0x31, 0xD7, 0x96, 0x9D, 0x68, 0x43, 0x1C, 0x07, 0x95, 0x94, 0x06, 0xDB, 
-0x0C, 0xD8, 0x4F, 0x57, 0xB5, 0x8F, 0xA6, 0xDC, 0x61, 0x79, 0x1E, 0x24, 0x0B, 0xE3, 0x56, 0xEB, 
-0x9F, 0xD6, 0xC0, 0xE8, 0xED, 0x42, 0xD2, 0xC7, 0x68, 0xF7, 0x8D, 0xD2, 0x5E, 0x80, 0xDE, 0x38, 
-0x49, 0x33, 0x2E, 0x4E, 0x9D, 0x70, 0x86, 0xCE, 0xA8, 0x17, 0xCC, 0x88, 0x93, 0xD6, 0x3A, 0xCC, 
-0x97, 0x5F, 0xDA, 0x8B, 0xA9, 0x3F, 0xB5, 0x41, 0x80, 0x1E, 0xE4, 0x6D, 0x99, 0xC8, 0x00, 0x33, 
-0xBE, 0xD0, 0x91, 0x22, 0xAC, 0x51, 0xBF, 0x4E, 0x59, 0xFB, 0xC1, 0xA0, 0xF7, 0xC5, 0x66, 0x97, 
-0x09, 0x0F, 0xA4, 0xF9, 0x82, 0x87, 0x78, 0xD0, 0x3F, 0x0D, 0xB2, 0x75, 0xF2, 0xA9, 0x5A, 0xB7, 
-0xD4, 0xD7, 0x6C, 0x62, 0x91, 0x56, 0x34, 0x34, 0x7D, 0xA4, 0x45, 0x2D, 0x75, 0x39, 0xC0, 0x31, 
-0x86, 0x1F, 0x35, 0x71, 0xA5, 0xC1, 0x91, 0xAA, 0x8E, 0x1D, 0x83, 0xA0, 0x9E, 0x22, 0x10, 0x0B, 
-0xE8, 0xD7, 0x65, 0x3E, 0x62, 0xEB, 0x45, 0x57, 0x5E, 0xC0, 0x50, 0x71, 0x94, 0xF9, 0xE3, 0xEF, 
-0x7F, 0xF7, 0x5F, 0x99, 0x70, 0xD3, 0x3D, 0x3D, 0x3B, 0x3E, 0x60, 0xAF, 0x8F, 0x87, 0xCA, 0xBE, 
-0x17, 0x91, 0xEA, 0x2C, 0x9A, 0xC1, 0x02, 0x1F, 0xC1, 0x83, 0x58, 0x04, 0xC8, 0xAC, 0x88, 0xF0, 
-0xBD, 0x29, 0x69, 0xF3, 0xE9, 0x83, 0xEE, 0x1B, 0xE3, 0x84, 0x55, 0xB3, 0x1F, 0x13, 0x11, 0x8B, 
-0x89, 0xB2, 0x68, 0x3A, 0x91, 0xD3, 0xD0, 0xC9, 0x0B, 0x4C, 0x4B, 0x77, 0x86, 0xC7, 0x03, 0x27, 
-0x4F, 0x9E, 0xB0, 0xF6, 0x04, 0x53, 0xC2, 0x3E, 0x14, 0x61, 0x7D, 0x5D, 0x2A, 0x00, 0x4F, 0x75, 
-0x89, 0x17, 0xAA, 0x00, 0xDD, 0x14, 0xA0, 0xC0, 0x9D, 0xE2, 0x86, 0x88, 0x1E, 0x2C, 0xB2, 0xDC, 
-0xF0, 0xBC, 0x69, 0x41, 0xF9, 0xAE, 0xA0, 0x92, 0x41, 0xA2, 0x79, 0xB0, 0x8C, 0xD3, 0x00, 0x85, 
-0x95, 0x71, 0xF1, 0x1F, 0x81, 0x34, 0x25, 0x81, 0xEA, 0xA6, 0x71, 0xCD, 0x98, 0xBE, 0x71, 0xC2, 
-0x20, 0x81, 0x6E, 0x72, 0x28, 0xBD, 0x45, 0xCC, 0x44, 0xD3, 0x86, 0x84, 0x92, 0x8D, 0xFA, 0x44, 
-0xCA, 0x99, 0xD4, 0x83, 0x7E, 0xA2, 0xA2, 0xE4, 0x9A, 0x32, 0xDE, 0x88, 0x5F, 0x6E, 0x94, 0xEE, 
-0x86, 0xF6, 0xD7, 0x24, 0xD7, 0x55, 0xB1, 0x6B, 0x49, 0x74, 0xA4, 0xE8, 0x1A, 0xB2, 0x1C, 0x8B, 
-0xFD, 0x05, 0x49, 0x71, 0xCA, 0x2B, 0x2D, 0x6C, 0xC9, 0x32, 0xE5, 0xD3, 0x1A, 0x12, 0xDB, 0x97, 
-0xBA, 0x41, 0x4A, 0x6D, 0x11, 0x65, 0xC3, 0x13, 0xBD, 0x7B, 0xAB, 0xE4, 0xB7, 0x2D, 0xB3, 0x69, 
-0x56, 0x83, 0x61, 0x22, 0x37, 0x82, 0xE5, 0xA2, 0xD1, 0x20, 0xC4, 0xD7, 0x16, 0xE0, 0xDA, 0x56, 
-0xB5, 0x84, 0xF8, 0xA7, 0x14, 0x99, 0x32, 0xEE, 0xBF, 0x41, 0x58, 0x7E, 0x40, 0x7A, 0x81, 0x9A, 
-0x8C, 0x01, 0x9F, 0x42, 0x34, 0x5A, 0xDC, 0x4F, 0x52, 0x49, 0x70, 0xB3, 0x86, 0x7D, 0xE5, 0x63, 
-0x65, 0xA5, 0x7C, 0xB7, 0x8D, 0xF8, 0x17, 0x9C, 0x0A, 0x78, 0x82, 0x88, 0x97, 0x03, 0x2D, 0x75, 
-0x82, 0x14, 0x9A, 0x20, 0xC0, 0x35, 0xE4, 0x5D, 0x69, 0xC5, 0xEA, 0xE1, 0xA4, 0x25, 0x4E, 0x1B, 
-0xA5, 0x8D, 0xF7, 0x5B, 0x36, 0x06, 0x90, 0x9B, 0x40, 0x4A, 0xD7, 0x17, 0x83, 0xF1, 0x3C, 0xEF, 
-0xAB, 0x69, 0x30, 0x3E, 0x5D, 0x54, 0xF5, 0xF5, 0x02, 0x9C, 0xCB, 0x6A, 0xE6, 0x28, 0x98, 0x16, 
-0xA4, 0xBE, 0xAA, 0x68, 0xF3, 0x83, 0x14, 0x16, 0xBD, 0x73, 0xF2, 0xD9, 0xF8, 0xDD, 0xC8, 0x99, 
-0xD0, 0xC0, 0xF3, 0x1F, 0x91, 0xA6, 0x01, 0xCF, 0x6D, 0x53, 0xF4, 0x97, 0xC4, 0x5B, 0x12, 0x33, 
-0x71, 0x13, 0x50, 0x90, 0xCD, 0x9C, 0x5C, 0x47, 0x5E, 0x99, 0x24, 0xAD, 0xD3, 0x9B, 0x32, 0xF7, 
-0x82, 0xB3, 0xF1, 0xE7, 0x4D, 0x94, 0xF0, 0x91, 0x53, 0xEA, 0xAA, 0x66, 0x62, 0xA9, 0x4E, 0xAD, 
-0x3B, 0xAF, 0x7E, 0xC2, 0xEB, 0xF3, 0x87, 0x2C, 0xD2, 0x35, 0x3E, 0x6A, 0x16, 0x9F, 0x7C, 0xE4, 
-0xE4, 0xAB, 0xAE, 0xD0, 0xF6, 0x2E, 0x01, 0xC9, 0x21, 0x41, 0x64, 0x3A, 0x4E, 0x33, 0x57, 0x6A, 
-0x4F, 0xD5, 0x7F, 0xFE, 0x87, 0x72, 0xA7, 0x23, 0x04, 0x94, 0x26, 0x78, 0x5E, 0x80, 0xF5, 0x0C, 
-0x3C, 0xDD, 0xE0, 0x80, 0x12, 0xA4, 0xC9, 0x6B, 0xEB, 0x67, 0x4E, 0x00, 0x4E, 0x37, 0x4B, 0x57, 
-0x92, 0x0F, 0x8E, 0x60, 0xA4, 0xDE, 0xB6, 0xFC, 0x0E, 0x7D, 0x07, 0xA7, 0xA7, 0xC6, 0xBD, 0x0C, 
-0xDE, 0x4D, 0x78, 0xBA, 0x39, 0x61, 0x3F, 0x0C, 0xA1, 0x9A, 0x68, 0x5A, 0xA4, 0x2B, 0xD9, 0x52, 
-0xF7, 0x89, 0x39, 0xBD, 0x2B, 0xA7, 0x85, 0x12, 0x3D, 0x95, 0x78, 0xD8, 0x6B, 0xC9, 0xBA, 0x55, 
-0xBD, 0x13, 0x99, 0x32, 0x3F, 0xBC, 0x73, 0xFF, 0xEB, 0xBF, 0xE9, 0x8A, 0x66, 0xF7, 0x36, 0xAA, 
-0x82, 0x13, 0xB7, 0xD2, 0x31, 0xB7, 0x75, 0x90, 0x97, 0x39, 0x1E, 0x92, 0x22, 0x8A, 0xED, 0x83, 
-0xCE, 0x6C, 0x96, 0xFB, 0xF4, 0x48, 0x67, 0x7B, 0xCF, 0xD1, 0x25, 0x2D, 0xF3, 0x00, 0x0A, 0x98, 
-0x5B, 0xA7, 0x0D, 0x32, 0xBE, 0xAA, 0x6B, 0x36, 0x2B, 0x9C, 0xA7, 0x5A, 0x9C, 0x54, 0x95, 0x4E, 
-0xE3, 0x36, 0xB9, 0xE0, 0x82, 0x2B, 0x26, 0xFE, 0x09, 0x09, 0x13, 0xFF, 0x11, 0xD1, 0x06, 0xF9, 
-0xCE, 0xE1, 0xF5, 0x7D, 0xAC, 0x53, 0x4E, 0x3D, 0xEC, 0x42, 0xB8, 0x96, 0xDE, 0x47, 0x99, 0x2C, 
-0xA4, 0xDF, 0xCA, 0x35, 0x72, 0x5E, 0x98, 0x22, 0x08, 0xC6, 0x67, 0x2D, 0x00, 0x46, 0x42, 0x0A, 
-0x23, 0x13, 0xF1, 0xCD, 0x12, 0x03, 0xF4, 0x06, 0x95, 0xC0, 0x3C, 0x4A, 0xF0, 0x4B, 0x3C, 0x1D, 
-0x0D, 0x2E, 0xE8, 0x56, 0x27, 0x3C, 0x25, 0x5E, 0xE0, 0xFE, 0xC8, 0x6C, 0x04, 0xDC, 0x78, 0x9E, 
-0x66, 0x41, 0x0E, 0x26, 0x2A, 0x66, 0xF5, 0x4D, 0xD9, 0x92, 0x3D, 0x89, 0x92, 0xF5, 0x94, 0x5E, 
-0xC3, 0xC4, 0x34, 0x54, 0x0A, 0x23, 0x8B, 0xC7, 0xB0, 0xA4, 0xCF, 0x56, 0xA5, 0xC4, 0x11, 0x5E, 
-0xEE, 0x2B, 0xF1, 0x55, 0x36, 0x65, 0xBD, 0x3D, 0x59, 0x19, 0xB8, 0x72, 0xB0, 0x80, 0x4C, 0x28, 
-0x44, 0xEC, 0xB2, 0x6A, 0x4A, 0xBC, 0x14, 0xE9, 0x53, 0xF0, 0xCE, 0x15, 0x4A, 0xA0, 0x42, 0xF6, 
-0xC5, 0xAE, 0x79, 0x5E, 0x27, 0x26, 0xBB, 0x9A, 0x84, 0x74, 0xA4, 0x85, 0x21, 0x5A, 0x8D, 0xD3, 
-0x50, 0x37, 0x6E, 0x66, 0x81, 0x33, 0x36, 0x4B, 0xDB, 0x4E, 0xBC, 0xCD, 0x6A, 0x30, 0x66, 0x0A, 
-0x8A, 0x2D, 0xB6, 0x2B, 0x8E, 0xFC, 0xCC, 0x69, 0x25, 0x16, 0x91, 0x67, 0xC6, 0xDE, 0xFB, 0x4F, 
-0x68, 0x72, 0x7D, 0x84, 0x25, 0xED, 0xE4, 0x05, 0xB1, 0x17, 0x69, 0x35, 0x8A, 0xBF, 0x58, 0xA0, 
-0xFF, 0xB1, 0x10, 0x45, 0x74, 0x32, 0x4B, 0x33, 0x56, 0xDF, 0x87, 0x38, 0x99, 0xF0, 0x71, 0x61, 
-0xEC, 0xF3, 0x95, 0x4A, 0x5A, 0xF3, 0xD1, 0x45, 0x93, 0x49, 0x6E, 0x16, 0xBD, 0x96, 0x59, 0xAE, 
-0x86, 0xA8, 0x59, 0x4A, 0xDA, 0xC3, 0xF9, 0x17, 0x61, 0x9F, 0x1F, 0x9A, 0xB6, 0x15, 0x65, 0xBA, 
-0x16, 0x68, 0xA3, 0x3B, 0x2E, 0x9E, 0xA8, 0x7F, 0xA0, 0x91, 0x55, 0x9B, 0x18, 0xE6, 0xD3, 0x18, 
-0x59, 0x0D, 0x83, 0xFA, 0x51, 0x36, 0x8E, 0x3E, 0xEA, 0xFD, 0x6C, 0x36, 0x8E, 0x91, 0xE0, 0xA7, 
-0xC1, 0xC6, 0xF9, 0x88, 0x9C, 0x42, 0x0D, 0x29, 0x82, 0x3E, 0x8F, 0x8D, 0x5F, 0x4E, 0x0D, 0xC7, 
-0x1E, 0x29, 0xE7, 0x05, 0x88, 0xE1, 0x24, 0xBD, 0x04, 0x6D, 0x79, 0xCA, 0x29, 0x49, 0xC9, 0x4F, 
-0x68, 0x4E, 0xAC, 0xA1, 0x41, 0x10, 0xCA, 0x66, 0x1F, 0x1A, 0xB4, 0x08, 0x93, 0x5D, 0x48, 0x71, 
-0x23, 0x8F, 0x19, 0x26, 0x2E, 0x15, 0xAE, 0x12, 0x90, 0xDE, 0x12, 0x7C, 0x71, 0xB3, 0xB3, 0x5F, 
-0x10, 0x55, 0x11, 0x40, 0xBD, 0x46, 0xAA, 0x9B, 0xA2, 0x81, 0x71, 0x3A, 0x03, 0x31, 0x49, 0x88, 
-0x19, 0x86, 0x20, 0x2C, 0x5E, 0xD8, 0x11, 0xF4, 0xB4, 0x37, 0x77, 0x57, 0xCA, 0xCE, 0xD1, 0xED, 
-0x75, 0x3C, 0x17, 0x09, 0xC8, 0xA4, 0xE0, 0xA5, 0x60, 0xD5, 0x0A, 0x12, 0xAD, 0x57, 0x8B, 0x84, 
-0xF6, 0xA3, 0x23, 0x0C, 0xE8, 0x56, 0xF5, 0xDB, 0x34, 0x3C, 0x00, 0x12, 0xE0, 0xE8, 0x11, 0xD8, 
-0xAC, 0xD8, 0x51, 0xCD, 0x91, 0x20, 0x05, 0x4F, 0x9E, 0x47, 0x09, 0xBA, 0x70, 0xF4, 0xB5, 0xF3, 
-0x6D, 0xE9, 0xD5, 0x56, 0x52, 0x13, 0x3D, 0xAC, 0xE9, 0x92, 0x05, 0x81, 0x00, 0xF9, 0xB6, 0xD0, 
-0xF1, 0xA7, 0xF2, 0xD8, 0x2C, 0x41, 0x62, 0x01, 0x19, 0xD5, 0x52, 0x0E, 0x30, 0x06, 0xD7, 0x0D, 
-0xD9, 0x60, 0xD0, 0xDD, 0x2D, 0xF5, 0x16, 0x15, 0x1A, 0x37, 0x64, 0x77, 0x06, 0x86, 0x36, 0x63, 
-0xDC, 0xAA, 0x31, 0x64, 0xB7, 0x8D, 0x7B, 0xAE, 0x63, 0x71, 0x9B, 0xF6, 0x1D, 0x03, 0x84, 0xDE, 
-0xAD, 0x1C, 0xB2, 0xBB, 0xC6, 0x63, 0x3C, 0xDF, 0xA9, 0x5C, 0x27, 0xAE, 0xF6, 0x0C, 0x2B, 0x2F, 
-0x4A, 0xA3, 0xDE, 0x79, 0x11, 0xEB, 0xD9, 0xE5, 0xBC, 0x70, 0x4F, 0x0D, 0xED, 0x8B, 0xC1, 0xCB, 
-0xBD, 0x67, 0xFB, 0xB9, 0x6D, 0x2B, 0xD8, 0xEF, 0x6C, 0x39, 0xEA, 0xD4, 0x23, 0x91, 0x30, 0x64, 
-0xC6, 0x6D, 0xD5, 0xBE, 0x5C, 0x26, 0x38, 0xCE, 0x06, 0x71, 0xC5, 0xB8, 0x0C, 0xD9, 0x9B, 0xEF, 
-0x2C, 0x5D, 0x90, 0xB2, 0x12, 0xCD, 0x45, 0x28, 0x80, 0x1A, 0x52, 0xE5, 0x6B, 0x4A, 0xBB, 0x2F, 
-0xAC, 0x3F, 0x90, 0x4E, 0xA7, 0x22, 0x11, 0x1E, 0x2F, 0x0A, 0x9E, 0xC9, 0xAC, 0xF5, 0xD1, 0x6F, 
-0xA9, 0xD3, 0xE2, 0xF4, 0x04, 0x03, 0x02, 0x40, 0xDB, 0xE5, 0x67, 0x14, 0x52, 0xC9, 0x06, 0x92, 
-0x67, 0xD4, 0xE3, 0xA7, 0x3A, 0x2E, 0x12, 0xB8, 0xCA, 0x7E, 0x75, 0x4A, 0x81, 0x8D, 0xA0, 0x93, 
-0xD9, 0x8F, 0xE5, 0x86, 0xEA, 0xBD, 0x5D, 0x83, 0xF9, 0xEC, 0xD0, 0x03, 0x8A, 0x3D, 0x40, 0xA7, 
-0x78, 0xF8, 0xB7, 0xD3, 0x31, 0x05, 0x08, 0xE6, 0x0D, 0xA7, 0xEB, 0x91, 0x63, 0x91, 0x97, 0x82, 
-0xCE, 0xC7, 0x87, 0xC4, 0x76, 0xE2, 0xDE, 0x64, 0xCE, 0xB2, 0x08, 0x8C, 0x63, 0xE5, 0x97, 0x17, 
-0x06, 0xCB, 0x2D, 0xCD, 0x80, 0x40, 0x88, 0x0B, 0xBC, 0x51, 0x3C, 0x5E, 0x8A, 0x78, 0xE2, 0x4A, 
-0x26, 0x17, 0x34, 0x17, 0x4E, 0x26, 0x87, 0x64, 0xE0, 0x2A, 0x7F, 0xF3, 0x76, 0x04, 0x53, 0x45, 
-0x4E, 0x9F, 0x4D, 0xAF, 0x03, 0x3B, 0xFB, 0x82, 0x0D, 0x6E, 0xBB, 0x9B, 0x93, 0x88, 0xD1, 0x2F, 
-0x15, 0x86, 0xCA, 0x91, 0x3D, 0x8F, 0x92, 0x76, 0xBB, 0x6C, 0xA4, 0xC3, 0xEE, 0xE0, 0x25, 0x9C, 
-0xF4, 0xEA, 0xE5, 0x31, 0x80, 0xEE, 0x0F, 0xF0, 0xF7, 0x6D, 0xB2, 0xAA, 0x5F, 0xF2, 0x00, 0x4C, 
-0xDE, 0x82, 0x0D, 0xE6, 0x33, 0x07, 0xB4, 0xEA, 0x8E, 0x09, 0xBE, 0x63, 0xB7, 0xF7, 0x15, 0xEB, 
-0x75, 0xEF, 0x11, 0x98, 0x63, 0xD1, 0x65, 0x19, 0x40, 0x0D, 0xF5, 0xCF, 0xA3, 0x32, 0x8C, 0x57, 
-0x7F, 0x51, 0x73, 0x59, 0x7B, 0x28, 0x53, 0x7C, 0xAA, 0xED, 0x43, 0x21, 0xA6, 0x36, 0x9D, 0x6A, 
-0x3E, 0x01, 0x7B, 0x01, 0x74, 0x75, 0xCD, 0x15, 0xB7, 0x9C, 0xEE, 0xDE, 0x62, 0x6D, 0x71, 0xEB, 
-0x28, 0xA6, 0x6B, 0xC0, 0x95, 0xA8, 0x03, 0xF8, 0xEC, 0x62, 0xDF, 0xFA, 0xF0, 0x8F, 0xBE, 0x00, 
-0xAE, 0xBF, 0xB9, 0x69, 0x5F, 0xCC, 0x5E, 0x4A, 0x0A, 0xC3, 0xEF, 0xDF, 0x62, 0xB2, 0x5B, 0x9E, 
-0xDE, 0xD7, 0xB7, 0xB6, 0xEB, 0xC0, 0x47, 0x99, 0x53, 0x81, 0x4D, 0x5C, 0x5A, 0x0F, 0xE3, 0x9E, 
-0x03, 0xA3, 0xA0, 0xED, 0x76, 0x07, 0x06, 0xB1, 0xB4, 0x17, 0xC6, 0x0E, 0xC2, 0xC0, 0x6B, 0x6E, 
-0x51, 0xBC, 0x92, 0x64, 0x03, 0x6D, 0xE3, 0x32, 0xB9, 0xC4, 0x14, 0x60, 0x45, 0xE6, 0xBA, 0x69, 
-0xE9, 0x40, 0x0D, 0x9A, 0xE5, 0x2E, 0xF7, 0xE9, 0xA2, 0x57, 0xBE, 0x3D, 0x69, 0xDD, 0x97, 0xCE, 
-0x43, 0xC4, 0x9D, 0x46, 0x9F, 0x7E, 0xCF, 0xA4, 0x94, 0xC5, 0x0C, 0x21, 0xE1, 0x42, 0xEC, 0xF6, 
-0x73, 0x11, 0x46, 0x93, 0x5B, 0xB5, 0xA9, 0x17, 0x54, 0x5B, 0xF0, 0xCE, 0x59, 0xE9, 0x17, 0x50, 
-0x57, 0xD5, 0x5D, 0x8D, 0x4B, 0xE5, 0x4F, 0xDC, 0xF9, 0x21, 0x3C, 0xD2, 0x49, 0xDE, 0x58, 0x9E, 
-0xEE, 0xC6, 0x3A, 0x82, 0x2F, 0x5F, 0xE2, 0x33, 0x54, 0xC4, 0x1C, 0x3E, 0x7C, 0x53, 0x61, 0x4C, 
-0x23, 0xA9, 0x8B, 0xA0, 0x81, 0x2E, 0x21, 0x42, 0xBE, 0x4B, 0x70, 0xF4, 0xC0, 0x29, 0x53, 0x06, 
-0x71, 0x1B, 0xE5, 0xD4, 0x43, 0xA7, 0xAC, 0xB9, 0x40, 0x59, 0xE5, 0xF1, 0x85, 0xDB, 0x76, 0x79, 
-0x9A, 0x66, 0x22, 0x00, 0x4F, 0x0D, 0x19, 0x57, 0xBA, 0x81, 0xCB, 0x6A, 0xFE, 0x98, 0xB4, 0x72, 
-0xE1, 0x05, 0x91, 0x16, 0xA5, 0xA1, 0x3C, 0xA0, 0x41, 0x07, 0xD9, 0x68, 0x26, 0x04, 0x7A, 0xBF, 
-0xD7, 0x11, 0x91, 0x21, 0xA5, 0xEB, 0xBF, 0x02, 0xF2, 0x2D, 0x6F, 0xC5, 0x31, 0xCB, 0x16, 0x78, 
-0x9B, 0x0E, 0x86, 0x30, 0xC2, 0xEC, 0x5F, 0xB2, 0x1D, 0xCB, 0xCD, 0x56, 0x41, 0xD9, 0x98, 0x50, 
-0x88, 0x58, 0x9A, 0x21, 0x33, 0x6E, 0x94, 0x41, 0x62, 0xA0, 0xD1, 0x28, 0xC7, 0xA4, 0x8A, 0x3D, 
-0x8E, 0xE7, 0x46, 0xE1, 0x45, 0x80, 0xB1, 0x83, 0x14, 0xEB, 0x3A, 0x5A, 0xA2, 0x42, 0x21, 0xC3, 
-0x54, 0xAA, 0xE2, 0xC4, 0x17, 0x45, 0x74, 0xEB, 0xA1, 0x62, 0x68, 0x0F, 0x13, 0xCB, 0xC0, 0x45, 
-0xCA, 0x18, 0x62, 0x48, 0x78, 0x62, 0xCF, 0x10, 0x6F, 0xB3, 0xA1, 0x56, 0x53, 0xCC, 0x17, 0xBB, 
-0x6C, 0x12, 0xDE, 0x8D, 0x18, 0xAC, 0x2B, 0xC3, 0xA3, 0x1C, 0xA0, 0x15, 0x62, 0x8B, 0xA9, 0x84, 
-0x0E, 0xEB, 0xD2, 0x1D, 0xBA, 0xB3, 0x46, 0x3F, 0x79, 0x00, 0x4B, 0xD6, 0x3D, 0x7F, 0x67, 0xCE, 
-0xCA, 0x85, 0x69, 0xC8, 0x80, 0xCE, 0x98, 0xFA, 0xA9, 0x5C, 0x9A, 0x58, 0x7B, 0xD0, 0xEB, 0x0C, 
-0xEE, 0xFD, 0xFB, 0xBF, 0x1E, 0x80, 0x80, 0x18, 0xA7, 0xA0, 0x07, 0x66, 0x28, 0xF2, 0x13, 0x71, 
-0x75, 0x5F, 0xFF, 0x5E, 0x67, 0x30, 0xC0, 0x77, 0x9E, 0xA5, 0xE5, 0x0C, 0x45, 0x07, 0x19, 0xE2, 
-0x0A, 0xC5, 0xAF, 0xA1, 0x03, 0x20, 0x82, 0xAE, 0xB3, 0xCE, 0x80, 0x1D, 0x32, 0x30, 0xE2, 0x1A, 
-0xDC, 0x99, 0x64, 0x8A, 0xFA, 0xB2, 0xCD, 0x26, 0xD9, 0x3E, 0xB0, 0x64, 0xBB, 0x9F, 0x22, 0x4F, 
-0xB5, 0x8C, 0xAF, 0xAC, 0xC6, 0xC8, 0x9D, 0xE6, 0x4A, 0xDE, 0xDE, 0xED, 0x75, 0xEE, 0xF5, 0xBE, 
-0x70, 0xFB, 0xAF, 0xE6, 0xAB, 0x8F, 0x06, 0xBB, 0xBB, 0xD0, 0xA9, 0xBB, 0xBE, 0x4E, 0x19, 0x53, 
-0xDF, 0x10, 0xDE, 0x36, 0xAC, 0xA6, 0x55, 0xC0, 0xDF, 0x1B, 0x4B, 0xC0, 0x0E, 0x7D, 0x62, 0x72, 
-0x4B, 0xC7, 0x2C, 0xE6, 0xC2, 0xF6, 0x27, 0xA7, 0xA4, 0x48, 0x1F, 0xAE, 0xE2, 0x87, 0xA2, 0x5A, 
-0x14, 0xA2, 0x73, 0xCF, 0xD5, 0x3E, 0x75, 0x42, 0x49, 0xDF, 0xF1, 0x4E, 0x37, 0x2D, 0xFA, 0x4B, 
-0xDD, 0xB2, 0x90, 0xF7, 0x06, 0x8E, 0x35, 0x83, 0x0F, 0xDE, 0x01, 0x9B, 0xD6, 0x41, 0xEF, 0xB8, 
-0x24, 0xFB, 0x8A, 0x0D, 0xCC, 0xA1, 0xBF, 0xAA, 0x8E, 0x84, 0xAF, 0x11, 0x31, 0x1A, 0xDE, 0x22, 
-0x35, 0x94, 0x7F, 0x26, 0xAC, 0x84, 0x4C, 0x4B, 0x0B, 0x98, 0x4F, 0xDB, 0x62, 0xE6, 0x8C, 0x97, 
-0x63, 0xCC, 0x1F, 0xDD, 0xEB, 0xE0, 0x55, 0x96, 0x9B, 0x16, 0x95, 0x35, 0xAF, 0xF8, 0xB2, 0xC3, 
-0x15, 0xC2, 0xF4, 0x20, 0xCD, 0x6B, 0x7D, 0x8D, 0x6D, 0xCF, 0x4F, 0xCA, 0x58, 0xDE, 0x1B, 0x65, 
-0x74, 0x0F, 0xA4, 0xCD, 0x2D, 0xA3, 0x09, 0xD0, 0x0B, 0x76, 0x9B, 0xA6, 0x53, 0x6F, 0xED, 0x61, 
-0xF3, 0xB4, 0xE5, 0x0E, 0x4A, 0x7F, 0x57, 0x44, 0x0F, 0x3F, 0x03, 0xB5, 0x42, 0x14, 0x57, 0x82, 
-0xC6, 0x33, 0x54, 0x96, 0x04, 0xD3, 0x4A, 0xC0, 0xB0, 0x64, 0x6A, 0x97, 0x93, 0x2B, 0x4C, 0x4E, 
-0x2E, 0x85, 0xEB, 0x71, 0xBA, 0x67, 0x11, 0x05, 0x1D, 0x64, 0x67, 0xCF, 0x5F, 0xA7, 0xCC, 0x4B, 
-0xEA, 0xA9, 0x07, 0x4B, 0xCB, 0x3D, 0xBB, 0xDE, 0x4D, 0xAB, 0x31, 0xBA, 0xB2, 0x7C, 0x3D, 0x50, 
-0xA4, 0x06, 0xED, 0x08, 0x25, 0x0A, 0xB7, 0xB9, 0x13, 0x69, 0x75, 0x28, 0x12, 0x34, 0xE8, 0xD0, 
-0xA6, 0x32, 0xA0, 0x67, 0x10, 0x4C, 0xA0, 0x9A, 0xC9, 0xAA, 0x8B, 0x9B, 0xD3, 0xA6, 0x1E, 0x98, 
-0x33, 0x53, 0xCA, 0xDA, 0xFE, 0x69, 0xB2, 0x1F, 0x92, 0x58, 0x35, 0xCD, 0x77, 0x0B, 0xFE, 0x4A, 
-0x85, 0xDF, 0x5A, 0x15, 0xEA, 0xD4, 0xF5, 0x8A, 0x94, 0xF5, 0xE9, 0xDD, 0xDE, 0xD9, 0xED, 0x53, 
-0xAE, 0xAB, 0x9D, 0x73, 0x4A, 0x95, 0x5A, 0x72, 0xD3, 0x3A, 0xDF, 0xAC, 0x2E, 0x03, 0x6D, 0xFE, 
-0x13, 0xDE, 0x79, 0xAA, 0xD4, 0xD2, 0x3C, 0xFA, 0x2D, 0x87, 0x99, 0x31, 0x8B, 0x4C, 0xB3, 0xD0, 
-0x62, 0xBD, 0x4A, 0xB6, 0xC2, 0xC1, 0xED, 0x5A, 0x39, 0xAD, 0xCA, 0x82, 0xB9, 0x35, 0x29, 0xDA, 
-0x5E, 0x79, 0x58, 0xA7, 0x0E, 0x5E, 0xE1, 0xCD, 0xC8, 0x78, 0x8A, 0x41, 0x77, 0x69, 0x68, 0xCD, 
-0x0D, 0x05, 0x1D, 0x93, 0xCA, 0x48, 0xA9, 0x72, 0x69, 0x6D, 0x4E, 0x06, 0xF9, 0x8B, 0xB8, 0x5B, 
-0xDA, 0x15, 0x0B, 0xD4, 0x7E, 0xB9, 0x3E, 0xD5, 0x34, 0xF6, 0xAC, 0x2A, 0x07, 0x45, 0x7F, 0x51, 
-0x9B, 0x85, 0xA2, 0x17, 0x98, 0xF4, 0xDF, 0x7F, 0x86, 0x85, 0x9F, 0x15, 0xD1, 0x5E, 0x82, 0x3A, 
-0xAD, 0x2D, 0xA3, 0xBD, 0x19, 0x2F, 0xCE, 0xD3, 0x70, 0xC8, 0x5A, 0x2F, 0x4F, 0x4E, 0xCF, 0x5A, 
-0xC6, 0x16, 0x0B, 0x0F, 0x42, 0x50, 0x54, 0x86, 0xEC, 0x3D, 0x6B, 0xE1, 0x6D, 0x63, 0xD0, 0x64, 
-0xE7, 0x6C, 0x39, 0xE7, 0x2D, 0x28, 0x1A, 0xCC, 0xE7, 0x71, 0x24, 0xFA, 0xB4, 0x8D, 0xE1, 0x61, 
-0x2D, 0x18, 0xBE, 0xD2, 0xA6, 0x4A, 0x43, 0x98, 0x1B, 0xBF, 0x38, 0x3D, 0x79, 0xD1, 0xCD, 0x29, 
-0x83, 0x45, 0x34, 0x59, 0x6A, 0x82, 0x0B, 0xC4, 0xC4, 0x3F, 0x8D, 0x91, 0x66, 0x75, 0x51, 0x66, 
-0x55, 0x5F, 0x01, 0x3D, 0xB8, 0x40, 0x97, 0xC5, 0x18, 0x8F, 0xE2, 0x30, 0xF4, 0x7A, 0xE9, 0xA7, 
-0x0F, 0x86, 0x36, 0xE2, 0xD6, 0x72, 0xB9, 0x9F, 0x6E, 0x67, 0x19, 0x22, 0x53, 0x61, 0x99, 0x8C, 
-0x99, 0xCC, 0x7B, 0x64, 0x12, 0xAF, 0x12, 0x2A, 0xB7, 0xB2, 0x13, 0x76, 0xA1, 0x32, 0x62, 0xA2, 
-0x1A, 0xAA, 0x21, 0x71, 0xAB, 0x0F, 0x9E, 0xAB, 0x94, 0x5E, 0x15, 0x24, 0x87, 0x1F, 0x37, 0x50, 
-0xAE, 0xC4, 0xA0, 0x26, 0x5C, 0xCE, 0xAA, 0x64, 0x84, 0xCC, 0x19, 0x15, 0xEB, 0x03, 0xE7, 0xAC, 
-0xCA, 0x46, 0x34, 0x9C, 0x51, 0xB9, 0x3E, 0x26, 0xCE, 0xAA, 0x6C, 0xC4, 0xC5, 0x19, 0x95, 0xEB, 
-0xA3, 0xE3, 0xEC, 0x96, 0x55, 0xD8, 0x9E, 0xD9, 0x6E, 0x4D, 0xF0, 0x1E, 0x7E, 0x56, 0x45, 0x1A, 
-0xE1, 0xC7, 0x09, 0x7A, 0x76, 0x46, 0xD7, 0x08, 0xC0, 0xF1, 0x87, 0xDC, 0x48, 0xDE, 0x32, 0x62, 
-0x6E, 0x74, 0x7A, 0xB3, 0x1B, 0x2E, 0x84, 0x2A, 0xAB, 0x4B, 0x58, 0xE8, 0x3B, 0x22, 0x99, 0xBD, 
-0x12, 0xBC, 0x23, 0x8F, 0x45, 0x50, 0x0A, 0x1E, 0xC8, 0xE3, 0x7A, 0xF3, 0xBA, 0x37, 0x99, 0xD6, 
-0x2B, 0x2B, 0x65, 0x61, 0x3A, 0xE7, 0x89, 0x28, 0xA9, 0xB7, 0xEF, 0xAD, 0x3D, 0xF9, 0xF2, 0x3D, 
-0x43, 0x43, 0x9C, 0x87, 0x5B, 0x4C, 0x09, 0xC4, 0x21, 0x88, 0x8F, 0x3A, 0x61, 0xE9, 0x39, 0x63, 
-0x68, 0x1D, 0xC8, 0xAD, 0x11, 0x55, 0xD8, 0x57, 0xFF, 0x3C, 0xE3, 0x13, 0x67, 0x5F, 0x40, 0xA7, 
-0x47, 0xCA, 0xE4, 0xF1, 0x00, 0x60, 0x4D, 0xD2, 0x15, 0x96, 0x9B, 0x0B, 0x26, 0x22, 0xEA, 0x61, 
-0x06, 0x28, 0x79, 0xBB, 0xAD, 0xA5, 0x29, 0xE5, 0x4A, 0x2A, 0x8F, 0x1A, 0x70, 0x7B, 0xB5, 0x08, 
-0x60, 0x5A, 0x15, 0xAF, 0xB3, 0xB8, 0x3C, 0x2D, 0xFC, 0xDC, 0x62, 0x9C, 0x94, 0x4E, 0x89, 0x2D, 
-0x8F, 0xD3, 0x39, 0x5D, 0x52, 0x21, 0xB1, 0xEE, 0x48, 0x9F, 0x8A, 0xEE, 0x79, 0x31, 0x8B, 0x65, 
-0xD2, 0x27, 0x0A, 0xB4, 0x9A, 0xA4, 0xB1, 0x7D, 0x5D, 0xAA, 0x44, 0x1B, 0x3D, 0x8F, 0x8C, 0x2A, 
-0x46, 0xFA, 0x0A, 0x8B, 0xD2, 0x2F, 0x82, 0x0B, 0xDA, 0xB8, 0xA7, 0x28, 0x49, 0x49, 0x1B, 0x6C, 
-0x7F, 0x13, 0x49, 0xAE, 0x81, 0xD9, 0x8E, 0x52, 0xEB, 0x2E, 0x7D, 0x4E, 0xDF, 0x9E, 0xE0, 0x95, 
-0x32, 0xBA, 0x5C, 0xE7, 0x73, 0xA0, 0x8F, 0xED, 0x36, 0x61, 0x6E, 0xE1, 0x23, 0xF2, 0xA0, 0x6A, 
-0xFA, 0x66, 0x29, 0x5E, 0x8D, 0x03, 0x8A, 0xA3, 0x1F, 0x99, 0xED, 0xEB, 0x63, 0x43, 0x0D, 0xF8, 
-0xD1, 0xB1, 0xD8, 0x56, 0x56, 0x13, 0xDE, 0x06, 0xAE, 0x3F, 0x58, 0x22, 0x5F, 0x62, 0xC2, 0xE0, 
-0x33, 0xFD, 0xAA, 0x6D, 0x42, 0xBC, 0xBA, 0xF1, 0xFF, 0x01, 0x4E, 0xC0, 0xC6, 0x05, 0xD7, 0xD4, 
-0x00, 0x00, 0x00
-};
-
-#endif
+#ifndef SCRIPT_JS_H_H
+#define SCRIPT_JS_H_H
+
+#include <Arduino.h>
+
+// Generated by tools/build_assets.js from script.js - do not edit
+const char script_js[] PROGMEM = {
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xED, 0x7D, 0xDB, 0x92, 0xDC, 0x38, 
+0xB2, 0xD8, 0x7B, 0x7D, 0x05, 0xD4, 0xBB, 0x23, 0xB2, 0x46, 0xAC, 0xEA, 0xAA, 0xEA, 0x8B, 0xA4, 
+0x6A, 0x95, 0x14, 0x9A, 0x96, 0x34, 0xEA, 0x63, 0xDD, 0xAC, 0x6E, 0xCD, 0x84, 0xAD, 0x50, 0xEC, 
+0xA0, 0x48, 0x54, 0x15, 0xB7, 0x59, 0x64, 0x2D, 0x08, 0x76, 0x77, 0x6D, 0xAB, 0x1F, 0xCF, 0x8B, 
+0xC3, 0x11, 0xC7, 0x11, 0xF6, 0xD3, 0x86, 0x1D, 0xC7, 0xFB, 0x01, 0x7E, 0xF2, 0xCB, 0x79, 0x9F, 
+0x3F, 0xD9, 0x1F, 0xF0, 0xF9, 0x04, 0x47, 0x26, 0x2E, 0x04, 0x48, 0xD6, 0xA5, 0xA5, 0xF1, 0x78, 
+0x36, 0xE2, 0xCC, 0x6E, 0xA8, 0x8B, 0x64, 0x22, 0x91, 0x48, 0x24, 0x12, 0x89, 0x44, 0x26, 0x90, 
+0x30, 0x41, 0xC2, 0x19, 0xE5, 0xE2, 0xA8, 0x95, 0x30, 0x41, 0x12, 0x9A, 0x8B, 0x67, 0x54, 0x50, 
+0x32, 0x22, 0x69, 0x91, 0x24, 0x47, 0x64, 0x77, 0x97, 0x9C, 0x8A, 0x8C, 0x33, 0xFC, 0x42, 0x38, 
+0x0B, 0x59, 0x7C, 0xC1, 0x22, 0x12, 0x51, 0x41, 0x5B, 0x61, 0x96, 0xE6, 0x82, 0xCC, 0xE9, 0x15, 
+0x94, 0x78, 0x97, 0xC5, 0xA9, 0xC8, 0xC9, 0x88, 0x0C, 0xF6, 0xB1, 0xD4, 0x3E, 0x99, 0x65, 0x05, 
+0xCF, 0x09, 0x15, 0xA4, 0xDF, 0x23, 0xF3, 0x38, 0x25, 0x71, 0x2A, 0x18, 0xBF, 0xA0, 0x49, 0x8E, 
+0x35, 0xE5, 0x2C, 0xCD, 0x33, 0x0E, 0x25, 0xCF, 0xE2, 0x39, 0xCB, 0x0A, 0xA1, 0xAB, 0x94, 0x5F, 
+0x05, 0x15, 0x45, 0xBE, 0xF2, 0xAB, 0x29, 0x7B, 0xA2, 0x70, 0x92, 0x11, 0x39, 0xE8, 0xF5, 0x7A, 
+0x47, 0x04, 0xAA, 0x7E, 0xC6, 0x26, 0xB4, 0x48, 0x04, 0x39, 0xC8, 0x03, 0x52, 0x2C, 0x22, 0x2A, 
+0x58, 0x44, 0x26, 0x3C, 0x9B, 0x93, 0x31, 0x0D, 0xCF, 0x59, 0x1A, 0x91, 0x30, 0x4B, 0x27, 0xF1, 
+0xD4, 0xAA, 0xE8, 0x24, 0x4A, 0x98, 0x85, 0x6A, 0xAF, 0x27, 0x71, 0x11, 0x07, 0xDD, 0x5E, 0x6F, 
+0x0B, 0x7C, 0xC0, 0x98, 0xE7, 0x82, 0x4E, 0x0D, 0x03, 0x89, 0x64, 0x21, 0x15, 0x8C, 0x5C, 0x30, 
+0x9E, 0xC7, 0x59, 0x4A, 0xB2, 0x09, 0x11, 0x33, 0xC5, 0xD1, 0x5D, 0x28, 0x40, 0x38, 0xCB, 0x17, 
+0x59, 0x9A, 0x33, 0x8B, 0x24, 0x07, 0xC9, 0x7A, 0x14, 0xB2, 0x80, 0x8B, 0x44, 0x92, 0xF4, 0x83, 
+0x02, 0xB7, 0xF0, 0xFC, 0xE0, 0x62, 0xD8, 0x95, 0x80, 0x24, 0xCC, 0x16, 0x4B, 0x12, 0xA7, 0xA4, 
+0x50, 0xE5, 0xD9, 0x05, 0x4B, 0x45, 0x7E, 0x9C, 0xA5, 0x29, 0x0B, 0xA1, 0xBD, 0x23, 0x32, 0xA1, 
+0x49, 0xCE, 0x10, 0xC5, 0xAE, 0xFC, 0x48, 0x72, 0xC1, 0x19, 0x9D, 0x93, 0x38, 0x27, 0xC5, 0xE2, 
+0x88, 0x2C, 0xB2, 0x24, 0x89, 0xD3, 0x29, 0x90, 0xBF, 0xCC, 0xC9, 0x82, 0x16, 0x39, 0x8B, 0x2C, 
+0x52, 0xEC, 0xF6, 0xE0, 0xEB, 0x59, 0x9C, 0x8B, 0x8C, 0x2F, 0xDF, 0xB3, 0x30, 0xE3, 0x11, 0x08, 
+0xCE, 0xC7, 0x4F, 0xB2, 0xFB, 0x5E, 0x65, 0x21, 0x4D, 0x24, 0x41, 0x8A, 0xC8, 0x88, 0x5D, 0xC4, 
+0x21, 0xD3, 0x25, 0x08, 0x8F, 0xD3, 0xA9, 0x8D, 0xE2, 0xB8, 0xE0, 0x79, 0xC6, 0xED, 0x46, 0x82, 
+0xD0, 0xE4, 0x82, 0xCE, 0x17, 0x1A, 0x43, 0xCA, 0x2E, 0x99, 0x94, 0xDF, 0x8C, 0x47, 0x64, 0xC6, 
+0x92, 0x88, 0x24, 0x50, 0x4D, 0xB2, 0xB4, 0x11, 0x95, 0xEC, 0xEA, 0xA9, 0x8E, 0xFB, 0xAE, 0x98, 
+0x2F, 0x58, 0x44, 0x2E, 0x67, 0x2C, 0x65, 0x17, 0x8C, 0x57, 0x89, 0x0E, 0x67, 0x34, 0x9D, 0xB2, 
+0xDC, 0x6D, 0x4F, 0xCE, 0xC4, 0x53, 0x61, 0xE1, 0xA8, 0x20, 0xB7, 0xBB, 0x6E, 0x52, 0x24, 0x09, 
+0xE1, 0x6C, 0x91, 0xD0, 0x50, 0x75, 0x1B, 0x0C, 0xC5, 0x92, 0x8C, 0x4E, 0xFF, 0x88, 0x34, 0x22, 
+0x01, 0x0C, 0x08, 0x9B, 0x93, 0xB0, 0xE0, 0x9C, 0xA5, 0x22, 0x59, 0x92, 0x7C, 0x96, 0x5D, 0x96, 
+0x58, 0x2A, 0x5C, 0x21, 0x5B, 0xF0, 0xC5, 0x41, 0x5C, 0x62, 0x7A, 0xC1, 0xE9, 0x9C, 0xE9, 0x06, 
+0x29, 0x7A, 0xDE, 0xB1, 0x34, 0x82, 0xDE, 0x46, 0x00, 0x92, 0x2F, 0xD3, 0x90, 0xF8, 0x9C, 0xFD, 
+0xA9, 0x60, 0xB9, 0x78, 0x9A, 0xC6, 0x73, 0x2A, 0xE2, 0x2C, 0x95, 0xE5, 0xE2, 0xA8, 0x8D, 0xA8, 
+0x16, 0xB2, 0xC4, 0x59, 0x36, 0x9D, 0x26, 0x0C, 0xFA, 0xFB, 0xBA, 0x15, 0x73, 0x1E, 0x4F, 0x11, 
+0xF4, 0x69, 0x21, 0xB2, 0x21, 0x52, 0x1A, 0xB4, 0x04, 0x4D, 0xCF, 0xED, 0xE7, 0x9C, 0x85, 0x05, 
+0x8F, 0xC5, 0xD2, 0x7E, 0x97, 0x14, 0xF3, 0x38, 0xA5, 0x7C, 0xD9, 0x04, 0x77, 0x1A, 0xCE, 0x58, 
+0x54, 0x24, 0x6C, 0x28, 0x45, 0x16, 0xA8, 0x7D, 0xC3, 0x2E, 0xC9, 0x24, 0xA1, 0x53, 0x32, 0xC9, 
+0x38, 0xC9, 0xD5, 0x77, 0x35, 0x96, 0xF3, 0xD6, 0xCD, 0x51, 0xEB, 0x32, 0x4E, 0xA3, 0xEC, 0xB2, 
+0x9B, 0xA5, 0x49, 0x46, 0x51, 0xD8, 0x8B, 0x34, 0x04, 0xBA, 0xFC, 0x36, 0xB9, 0x56, 0x7A, 0x2E, 
+0xCE, 0x9F, 0x16, 0x62, 0xC6, 0x52, 0x11, 0x87, 0x54, 0x8E, 0x08, 0x94, 0x20, 0xD0, 0x8E, 0x74, 
+0xCA, 0xBA, 0x53, 0x26, 0x4E, 0x04, 0x9B, 0xFB, 0x5E, 0x05, 0xCE, 0x6B, 0x1F, 0xB5, 0xE2, 0x09, 
+0xF1, 0xEF, 0x54, 0xCB, 0x7F, 0xFE, 0x5C, 0x43, 0x79, 0x67, 0x34, 0x22, 0x9E, 0xE0, 0x05, 0xF3, 
+0xA0, 0x5A, 0x45, 0x13, 0xD4, 0x02, 0xA4, 0x74, 0x67, 0x9C, 0x4D, 0xC8, 0x88, 0x78, 0xBB, 0xDE, 
+0x51, 0x8B, 0x33, 0x51, 0xF0, 0xF4, 0xA8, 0x75, 0xD3, 0x52, 0x82, 0xD1, 0x55, 0x52, 0x84, 0x6A, 
+0xC2, 0x47, 0x86, 0x48, 0xB6, 0x90, 0x26, 0x34, 0x6D, 0xD3, 0x62, 0x1A, 0x45, 0xCF, 0x61, 0x34, 
+0xBF, 0x8A, 0x73, 0xC1, 0x52, 0xC6, 0x7D, 0x6F, 0x91, 0x2D, 0x40, 0xA1, 0x30, 0x2F, 0x28, 0xB9, 
+0x80, 0x03, 0x1E, 0x68, 0xD2, 0xB5, 0x2D, 0x8A, 0x7C, 0xB6, 0x75, 0x55, 0x36, 0xFF, 0xBE, 0x90, 
+0x6D, 0x25, 0xB7, 0x6E, 0xC1, 0xA4, 0x9B, 0xD6, 0x0D, 0x60, 0x49, 0x63, 0x71, 0x36, 0x63, 0x73, 
+0xE6, 0x2B, 0x94, 0xD5, 0x22, 0x0B, 0x9E, 0x89, 0x2C, 0xCC, 0x12, 0x32, 0x02, 0xCC, 0x93, 0x38, 
+0x61, 0x43, 0x0F, 0xEA, 0xAB, 0xA1, 0xCE, 0x72, 0x91, 0xE2, 0x48, 0x00, 0x38, 0x6C, 0x05, 0xBC, 
+0xDA, 0x02, 0xB6, 0x3F, 0xB8, 0xDF, 0xED, 0x75, 0x7B, 0xDD, 0x3E, 0x92, 0x9C, 0x33, 0xF1, 0x8C, 
+0xCD, 0xB3, 0xD7, 0x59, 0x84, 0x24, 0xDD, 0x10, 0x06, 0x52, 0x7A, 0xDD, 0x9A, 0x30, 0x11, 0xCE, 
+0x4E, 0xCD, 0xD4, 0xE6, 0xB7, 0x51, 0x95, 0x9D, 0xA4, 0xB1, 0x88, 0x69, 0x22, 0x55, 0x05, 0x4E, 
+0x16, 0x08, 0xA7, 0xA0, 0xCD, 0x34, 0x09, 0xD0, 0x6A, 0x9A, 0xE0, 0x7A, 0x0A, 0x31, 0x2A, 0xD9, 
+0xCF, 0xD2, 0x64, 0x49, 0x68, 0x28, 0xE2, 0x0B, 0x46, 0xA2, 0x82, 0xA3, 0x9A, 0x56, 0xA3, 0xC5, 
+0x0C, 0x87, 0x76, 0x2B, 0x87, 0xB2, 0x28, 0x0D, 0xA7, 0xA8, 0xD9, 0x15, 0x05, 0xEF, 0x8A, 0x7C, 
+0x86, 0x9A, 0x2E, 0x65, 0x49, 0xA9, 0xE6, 0xC3, 0x2C, 0x15, 0x71, 0x5A, 0xB0, 0x9C, 0x48, 0xE4, 
+0x39, 0x8C, 0xB6, 0x04, 0x66, 0xC4, 0xD6, 0x4D, 0xEB, 0x92, 0xC6, 0xE2, 0x45, 0xC6, 0x8F, 0x41, 
+0x39, 0x60, 0x1B, 0x8F, 0x5A, 0x5A, 0x96, 0x88, 0xFB, 0x0D, 0xB4, 0xC0, 0x84, 0xF8, 0x62, 0xB9, 
+0x60, 0xD9, 0x84, 0xBC, 0x8A, 0x53, 0x86, 0x1F, 0x64, 0x2F, 0x17, 0x69, 0xC4, 0x26, 0x71, 0x0A, 
+0xD2, 0x60, 0x86, 0x21, 0x12, 0x89, 0xC3, 0x6F, 0xC1, 0xF8, 0x24, 0xE3, 0x73, 0x9A, 0x86, 0xAC, 
+0x9B, 0x66, 0x97, 0xBE, 0xEA, 0x6B, 0x53, 0x29, 0xC0, 0x67, 0x09, 0xEB, 0x26, 0xD9, 0xD4, 0xF7, 
+0x8E, 0xA5, 0xB2, 0x8C, 0x25, 0x37, 0xE3, 0x3F, 0xB3, 0x08, 0x66, 0x3B, 0x8F, 0xDC, 0x23, 0x7E, 
+0x0D, 0x0F, 0xE9, 0xE8, 0x5A, 0xDA, 0x5D, 0x91, 0xBD, 0x88, 0xAF, 0x58, 0xE4, 0xF7, 0xDB, 0xE4, 
+0x1E, 0xF1, 0xC8, 0x3C, 0xD7, 0x82, 0xA9, 0x2D, 0x25, 0x4D, 0x99, 0xAE, 0x69, 0x47, 0xD2, 0x0F, 
+0x7A, 0x84, 0x45, 0x01, 0x59, 0x64, 0x8B, 0x22, 0xA1, 0x02, 0x38, 0x76, 0x19, 0x8B, 0x19, 0x09, 
+0x29, 0xB0, 0x1B, 0x3B, 0xB2, 0xDB, 0xED, 0xEE, 0xB4, 0x8F, 0x5A, 0x52, 0x0B, 0x7D, 0x38, 0x29, 
+0x31, 0xA2, 0xE4, 0x6A, 0xA9, 0x70, 0x5A, 0xF1, 0x3C, 0x5F, 0x30, 0x4E, 0xD3, 0x28, 0x23, 0x54, 
+0x6A, 0xDE, 0xEE, 0x1F, 0xF3, 0x6E, 0xB7, 0x0B, 0x34, 0xE5, 0x4C, 0x28, 0x53, 0xC9, 0xB7, 0x39, 
+0x1C, 0x90, 0x7E, 0xAF, 0x27, 0x31, 0x96, 0x5D, 0x90, 0xD2, 0x0B, 0xD0, 0xBB, 0xEC, 0xC7, 0x58, 
+0xCC, 0xCE, 0x38, 0x4D, 0xF3, 0x18, 0x47, 0x79, 0xC1, 0x13, 0x68, 0x4D, 0x94, 0x85, 0xC5, 0x9C, 
+0xA5, 0xA2, 0x3B, 0xCE, 0xA2, 0x65, 0x37, 0x4C, 0x68, 0x9E, 0x83, 0x76, 0x00, 0x55, 0xE1, 0x7B, 
+0x0B, 0x3A, 0x65, 0x1D, 0x76, 0x15, 0x43, 0x8B, 0x2A, 0xD5, 0x3A, 0x3A, 0x73, 0xC5, 0xB8, 0x2C, 
+0x78, 0x72, 0xD4, 0xBA, 0x09, 0xC8, 0x40, 0x11, 0x65, 0x48, 0x4A, 0xB2, 0x29, 0xE0, 0x80, 0xA2, 
+0x8E, 0x7E, 0xE0, 0x6C, 0x9E, 0x5D, 0xB0, 0x95, 0x2A, 0x62, 0x25, 0x6C, 0x91, 0x33, 0x0E, 0x03, 
+0x70, 0x2D, 0x50, 0x9C, 0x7F, 0x0F, 0x13, 0x16, 0xC0, 0xAC, 0x60, 0x89, 0x97, 0x64, 0xD3, 0x38, 
+0xED, 0xCE, 0xC4, 0x3C, 0xF1, 0x5C, 0x82, 0x2D, 0xB5, 0x62, 0x64, 0x53, 0xC0, 0xB3, 0x9C, 0xE0, 
+0xBE, 0x13, 0x30, 0x7F, 0x1B, 0x56, 0x4E, 0x99, 0x78, 0x9E, 0x30, 0xF8, 0xF9, 0xDD, 0xF2, 0x24, 
+0xF2, 0x3D, 0x84, 0xEC, 0x08, 0x04, 0xED, 0x8C, 0x45, 0xEA, 0x19, 0x35, 0x99, 0xD3, 0x0B, 0x16, 
+0x21, 0xE2, 0x95, 0xAA, 0x12, 0x0B, 0x6B, 0x39, 0xB4, 0xE1, 0x61, 0xCC, 0x44, 0x94, 0x9F, 0x7B, 
+0x1B, 0xBB, 0x11, 0xA0, 0x3A, 0x06, 0x8F, 0x14, 0x41, 0x44, 0x72, 0x12, 0x66, 0xA9, 0x0F, 0xDA, 
+0x35, 0x90, 0xB3, 0x27, 0x36, 0xDA, 0x6D, 0x57, 0xC3, 0x9C, 0x11, 0x26, 0x71, 0x78, 0x6E, 0x4F, 
+0x18, 0x25, 0x4F, 0x2E, 0xE3, 0x24, 0xF9, 0x8E, 0x3D, 0xA3, 0xFC, 0x9C, 0x8C, 0xC8, 0x9D, 0x55, 
+0x44, 0x81, 0x36, 0xA1, 0x71, 0x9A, 0x57, 0x29, 0x13, 0x3C, 0x9E, 0x4E, 0x19, 0x47, 0xD2, 0xAC, 
+0x6E, 0x29, 0x91, 0x02, 0x7D, 0x6E, 0xC7, 0xAC, 0x28, 0x22, 0x32, 0x04, 0x37, 0x74, 0x65, 0x17, 
+0x8C, 0x27, 0x74, 0xB9, 0x45, 0x27, 0x19, 0x1C, 0x1D, 0x55, 0xA6, 0xEC, 0xAC, 0x5F, 0xA2, 0xC3, 
+0x95, 0xFD, 0x06, 0x8C, 0x27, 0xA3, 0x0A, 0xC6, 0xEE, 0x9F, 0x0A, 0xC6, 0x97, 0xA7, 0x2C, 0x61, 
+0xA1, 0xC8, 0xB8, 0xEF, 0x75, 0x25, 0x9A, 0x38, 0xCC, 0x2C, 0x04, 0x29, 0xBB, 0x54, 0x85, 0x4D, 
+0xED, 0x21, 0x67, 0x54, 0x30, 0x45, 0xC0, 0x9B, 0x53, 0xDF, 0x9B, 0x09, 0xB1, 0x18, 0xEE, 0xEE, 
+0x5E, 0x5E, 0x5E, 0x76, 0x2F, 0xF7, 0xBA, 0x19, 0x9F, 0xEE, 0x0E, 0x7A, 0xBD, 0xDE, 0x6E, 0x7E, 
+0x31, 0xF5, 0x02, 0xE2, 0xC1, 0x1F, 0x18, 0x03, 0x12, 0x51, 0x17, 0x0D, 0x58, 0xC1, 0xE3, 0x71, 
+0x21, 0x18, 0xF4, 0x2D, 0xCD, 0x73, 0x80, 0x2A, 0xEB, 0x26, 0xE5, 0xCF, 0x4E, 0xCA, 0x2E, 0x57, 
+0x97, 0xBD, 0x88, 0xD9, 0xE5, 0x77, 0xD9, 0x15, 0x94, 0xEE, 0x91, 0x1E, 0x19, 0xEC, 0x93, 0xC1, 
+0xFE, 0x6A, 0xE8, 0x49, 0x9C, 0x24, 0x00, 0x9A, 0x66, 0x29, 0x5B, 0x0D, 0x95, 0x0B, 0x9E, 0x9D, 
+0x83, 0x75, 0xE2, 0x29, 0xCE, 0x1D, 0x67, 0x49, 0xC6, 0x37, 0xC1, 0x77, 0x2E, 0xE3, 0x48, 0xCC, 
+0xA0, 0xD4, 0x40, 0x8F, 0x9C, 0x52, 0x22, 0x74, 0xC1, 0x38, 0x4D, 0x19, 0x7F, 0x79, 0xF6, 0xFA, 
+0x15, 0x19, 0x91, 0x9F, 0x1E, 0x2D, 0xA8, 0x98, 0x91, 0x68, 0xB4, 0xF3, 0x7A, 0xD0, 0x27, 0xFD, 
+0x41, 0xF7, 0xFE, 0xC3, 0xA7, 0x0F, 0xC9, 0x43, 0xD2, 0x23, 0x7D, 0xF8, 0x5F, 0xBF, 0x3B, 0xE8, 
+0x93, 0x3D, 0x72, 0x9F, 0xDC, 0x27, 0x3D, 0xFC, 0x9F, 0x06, 0xFA, 0xF3, 0xCE, 0xE3, 0x47, 0xBB, 
+0x50, 0xF4, 0xF1, 0x4F, 0x47, 0x2D, 0xAB, 0x6F, 0xAB, 0x23, 0x30, 0x2F, 0xD2, 0x4E, 0xCE, 0x84, 
+0xD6, 0xA3, 0x9A, 0x84, 0x0A, 0xD4, 0x3C, 0xCB, 0xD2, 0x0E, 0x8F, 0x73, 0x05, 0x65, 0x66, 0x85, 
+0x46, 0x8A, 0x5B, 0xC4, 0xFA, 0xEF, 0x51, 0x18, 0xF3, 0x30, 0x61, 0x24, 0xBC, 0x1A, 0xED, 0xF4, 
+0x07, 0x3B, 0x24, 0x5C, 0xCA, 0xBF, 0x7C, 0xB4, 0x73, 0x00, 0x24, 0xCA, 0xCF, 0x8F, 0xDD, 0x32, 
+0x49, 0x9C, 0x32, 0x72, 0xD5, 0x97, 0x90, 0x4B, 0xF8, 0xBB, 0x43, 0xAE, 0x06, 0xEA, 0x71, 0x30, 
+0xDA, 0xD9, 0x83, 0x92, 0x00, 0xB4, 0xA9, 0xDC, 0xA0, 0x52, 0x70, 0xB0, 0xB1, 0xE4, 0x7E, 0x77, 
+0xA0, 0xCA, 0xCA, 0x5F, 0x50, 0xFA, 0xA0, 0x7B, 0xB8, 0x2F, 0xCB, 0xE3, 0xAF, 0x4D, 0x75, 0x3F, 
+0xE8, 0xEE, 0x1D, 0x2A, 0xB2, 0xE5, 0x4F, 0xA4, 0xE0, 0x61, 0xF7, 0xFE, 0x03, 0x89, 0x44, 0xFE, 
+0xDC, 0x84, 0x45, 0x61, 0x50, 0x24, 0xEC, 0xA9, 0xA2, 0x83, 0x4D, 0xE5, 0x06, 0x95, 0x82, 0x83, 
+0xAD, 0x4B, 0x96, 0x2D, 0x57, 0xB4, 0xBA, 0x4D, 0x97, 0x6D, 0xD9, 0xBE, 0xED, 0xB2, 0x64, 0xA5, 
+0xE9, 0x58, 0x47, 0x0D, 0xC7, 0x7A, 0x09, 0x45, 0xD9, 0xDB, 0x2C, 0xA2, 0x20, 0xC8, 0x96, 0x84, 
+0xD6, 0x26, 0x8B, 0x05, 0x2C, 0xFC, 0x8E, 0x67, 0x71, 0x12, 0xF9, 0x0A, 0x43, 0xFB, 0xA8, 0xA5, 
+0x34, 0x69, 0x15, 0x97, 0x34, 0x51, 0xEB, 0x03, 0xF4, 0x16, 0x73, 0x99, 0x01, 0xD5, 0x3F, 0x94, 
+0x16, 0xFC, 0xC2, 0x52, 0x55, 0x5D, 0xB2, 0x4C, 0x50, 0xF5, 0x80, 0x9D, 0x3B, 0xE5, 0x59, 0x91, 
+0x46, 0x9D, 0x10, 0xD4, 0xCF, 0x90, 0xFC, 0xAE, 0x47, 0x7B, 0x93, 0x3E, 0x23, 0x77, 0xE2, 0xF9, 
+0x22, 0xE3, 0x82, 0xA6, 0xE2, 0xC8, 0x41, 0x8C, 0x94, 0x7F, 0x0D, 0x36, 0xA2, 0x3F, 0x4D, 0xF0, 
+0xBF, 0x6A, 0x45, 0x46, 0x35, 0xAC, 0xE2, 0x95, 0x34, 0x7C, 0xBE, 0x80, 0x5D, 0xB7, 0x2C, 0x28, 
+0xC1, 0x6B, 0xCD, 0xAC, 0xF1, 0x62, 0x35, 0xDC, 0x8D, 0x6B, 0xB1, 0xE5, 0xAE, 0xDD, 0x13, 0x10, 
+0x29, 0x17, 0xE4, 0x89, 0x32, 0x76, 0xC8, 0x90, 0x78, 0x49, 0x3C, 0x9D, 0x89, 0x8A, 0x3D, 0xEA, 
+0xB7, 0xC9, 0xE8, 0xB1, 0xBB, 0xBE, 0x08, 0x9B, 0xD7, 0x16, 0xD2, 0x94, 0x96, 0x56, 0x90, 0x6F, 
+0xA6, 0x1F, 0x63, 0xA6, 0x36, 0xE0, 0xAC, 0xCB, 0xAF, 0xE6, 0x52, 0x29, 0xC2, 0xF6, 0xD0, 0x52, 
+0x5F, 0x1B, 0x47, 0x91, 0x2E, 0x69, 0xEB, 0x7A, 0x98, 0x94, 0x8B, 0xEA, 0x93, 0x1E, 0x8B, 0x01, 
+0xD9, 0x62, 0x6C, 0x6A, 0xAC, 0xF5, 0xA9, 0xFA, 0x26, 0x20, 0xFB, 0x55, 0xF3, 0xBB, 0x6A, 0x01, 
+0xC6, 0x39, 0xB0, 0x38, 0x20, 0x14, 0x7D, 0x39, 0x4C, 0xBB, 0xFF, 0x2A, 0xA6, 0x6E, 0xD5, 0xEC, 
+0x58, 0x6F, 0xAD, 0x40, 0x3F, 0x28, 0x7C, 0x80, 0xA7, 0x74, 0x61, 0xC0, 0x07, 0x59, 0x21, 0xBC, 
+0x37, 0x98, 0xD7, 0x4D, 0x6E, 0x5F, 0x3B, 0x37, 0xDB, 0x2A, 0xD0, 0x8C, 0x9C, 0xAD, 0x6A, 0xFE, 
+0xB7, 0x69, 0xF5, 0xDF, 0xA6, 0xD5, 0xCD, 0xD3, 0xAA, 0xB3, 0xDC, 0xCE, 0x67, 0x59, 0x91, 0x44, 
+0xEF, 0xB2, 0x24, 0x91, 0xFE, 0x1A, 0xE3, 0xF5, 0x30, 0xBB, 0x2D, 0x77, 0xEF, 0x9A, 0x9D, 0x97, 
+0xAE, 0xED, 0xDA, 0x2C, 0xC7, 0x09, 0x81, 0x35, 0x99, 0x1E, 0x2C, 0x77, 0x4C, 0xC1, 0xCF, 0x9F, 
+0x89, 0x79, 0xE8, 0xDA, 0x8E, 0x52, 0xAB, 0x64, 0xE9, 0xB8, 0x3F, 0xD5, 0x3E, 0x1F, 0x5A, 0x88, 
+0x0C, 0xFC, 0xF6, 0x51, 0x9C, 0xD3, 0x71, 0xC2, 0xA2, 0xD6, 0x8D, 0xED, 0x5D, 0x01, 0x65, 0xB7, 
+0x76, 0x2D, 0x13, 0xCF, 0x59, 0x07, 0x21, 0xBD, 0x76, 0xF7, 0x82, 0x26, 0x40, 0x98, 0x2C, 0xCE, 
+0xD2, 0x68, 0xAB, 0xC2, 0x2C, 0x8D, 0xCA, 0xA2, 0xD8, 0xA2, 0xB2, 0x62, 0x68, 0x92, 0xC2, 0xD3, 
+0xD8, 0x88, 0x37, 0x59, 0xE9, 0xC1, 0x95, 0x5B, 0x0B, 0x05, 0xB7, 0x5A, 0xF0, 0x11, 0x31, 0xBD, 
+0xCC, 0x0A, 0x1E, 0xC8, 0xD6, 0xBC, 0x8E, 0xD3, 0x4F, 0x64, 0x54, 0xB6, 0xAC, 0x9B, 0x2F, 0x92, 
+0x58, 0xF8, 0xDE, 0xD0, 0x6B, 0x77, 0xE7, 0x74, 0xE1, 0xBF, 0x29, 0xE6, 0x63, 0xC6, 0xCD, 0x6A, 
+0xEA, 0x23, 0x4B, 0x23, 0x59, 0x9A, 0xA5, 0x91, 0x2A, 0xAB, 0xC8, 0xD9, 0x50, 0x32, 0xCD, 0x2E, 
+0xC1, 0xDB, 0xCE, 0x2E, 0xC9, 0x33, 0x98, 0x47, 0xAA, 0x0B, 0xBC, 0xD7, 0x71, 0x5A, 0x08, 0x74, 
+0x7C, 0xA7, 0xD9, 0x25, 0xB0, 0x05, 0x6A, 0x01, 0x59, 0xF8, 0x96, 0x1C, 0xF6, 0xC8, 0x3D, 0xFD, 
+0x56, 0x81, 0x95, 0xC5, 0x75, 0x23, 0x54, 0x61, 0xD3, 0x3C, 0x5D, 0x4E, 0x7F, 0xB7, 0xFA, 0xA0, 
+0x84, 0x56, 0x8D, 0xD1, 0xB0, 0xF2, 0x9B, 0xDC, 0x7F, 0x89, 0xD3, 0x3C, 0x8E, 0xD8, 0x8F, 0xE8, 
+0xA7, 0x31, 0xDB, 0x3B, 0xD2, 0xA5, 0x60, 0xD7, 0xF8, 0xC8, 0x42, 0x88, 0x72, 0xEB, 0x16, 0xAB, 
+0x34, 0xEE, 0xF1, 0xC8, 0xA5, 0xF7, 0xEE, 0xDD, 0x2A, 0x84, 0x8D, 0xCF, 0xD2, 0xBD, 0xB7, 0x43, 
+0xFB, 0xF9, 0xF3, 0x06, 0xB4, 0x5A, 0x6C, 0x6C, 0xB4, 0xCE, 0x84, 0x37, 0x65, 0x42, 0x0E, 0x46, 
+0xBD, 0xED, 0xE7, 0x5B, 0xC2, 0x76, 0x7A, 0xF6, 0xF4, 0xEC, 0xC3, 0xE9, 0x1F, 0x4E, 0x9E, 0xBD, 
+0x7A, 0xFE, 0x87, 0x93, 0x37, 0x67, 0xCF, 0xDF, 0xFF, 0xF0, 0xF4, 0x15, 0xCA, 0xDE, 0x5E, 0x0F, 
+0xFC, 0xA6, 0x59, 0x1A, 0xE5, 0x55, 0x57, 0x50, 0xE9, 0xCE, 0x54, 0x9D, 0x2E, 0xAE, 0xD6, 0x8D, 
+0x02, 0xBD, 0x73, 0x35, 0x93, 0x83, 0x68, 0xCA, 0xC4, 0x71, 0x96, 0x0A, 0x76, 0x25, 0x7C, 0x6F, 
+0x80, 0x8E, 0x2D, 0xE3, 0x09, 0xED, 0x46, 0x72, 0xFB, 0x31, 0xEF, 0x4E, 0xB2, 0x54, 0x74, 0x27, 
+0x74, 0x1E, 0x27, 0xE0, 0xB5, 0xD8, 0xF1, 0x90, 0x72, 0x2F, 0x20, 0x39, 0x4D, 0xF3, 0x4E, 0xCE, 
+0x78, 0x3C, 0xD9, 0x69, 0x2C, 0x87, 0x76, 0x23, 0xF8, 0xC4, 0x7F, 0xF7, 0x30, 0xA4, 0x7B, 0x74, 
+0xE2, 0x69, 0x49, 0x99, 0x72, 0x1A, 0xC5, 0x2C, 0x15, 0x67, 0x6C, 0xBE, 0x00, 0x9E, 0x8B, 0x2B, 
+0xE5, 0x38, 0x00, 0x24, 0x94, 0x7F, 0xAF, 0x3E, 0xFB, 0xBD, 0x80, 0xC8, 0xFF, 0x4B, 0xB3, 0xC1, 
+0x2E, 0x06, 0xB6, 0x34, 0xAE, 0xBF, 0x4F, 0x45, 0xB6, 0x00, 0x40, 0x8F, 0x4F, 0xC7, 0xD4, 0x1F, 
+0xEC, 0x1F, 0x04, 0xA4, 0x7F, 0xF0, 0x20, 0x20, 0xFD, 0x7E, 0x40, 0x7A, 0xDD, 0x83, 0xB6, 0xB7, 
+0xB6, 0x60, 0x7F, 0x55, 0xC1, 0x7E, 0xBB, 0xF4, 0x73, 0xE8, 0xE2, 0x2F, 0x8B, 0xF9, 0x17, 0x50, 
+0xFB, 0xB2, 0x98, 0xAF, 0x20, 0xF6, 0xE0, 0x61, 0x40, 0xFA, 0x7B, 0xBD, 0x80, 0x0C, 0xF6, 0x0F, 
+0xEB, 0xC4, 0xD6, 0xCA, 0xF5, 0x57, 0x95, 0x6B, 0xA2, 0xF5, 0x34, 0x8B, 0x93, 0x2F, 0x20, 0x16, 
+0x8A, 0xAD, 0xA0, 0xB6, 0x7F, 0x18, 0x90, 0xFE, 0x03, 0xE0, 0xD2, 0xE0, 0x61, 0x9D, 0xDA, 0x7A, 
+0xC1, 0xFE, 0xAA, 0x82, 0x8A, 0x5C, 0xB4, 0x88, 0xA5, 0xDA, 0x32, 0xB2, 0xE3, 0x87, 0xE2, 0x2A, 
+0x00, 0x83, 0x68, 0xB9, 0x60, 0x68, 0x5C, 0xA7, 0xCC, 0x0B, 0x5A, 0xE0, 0xB3, 0x1E, 0x82, 0x7F, 
+0x96, 0x8E, 0x59, 0x92, 0x0F, 0xC9, 0xC7, 0x4F, 0xF2, 0x5D, 0xCE, 0x04, 0x3C, 0xB5, 0xD4, 0x97, 
+0x21, 0xF1, 0xA0, 0x83, 0xBD, 0xA0, 0x35, 0xCE, 0x78, 0xC4, 0xF8, 0xB1, 0x5C, 0xB6, 0x78, 0xBF, 
+0x9B, 0x1C, 0x3C, 0x64, 0xBD, 0x31, 0xBC, 0x37, 0xCB, 0x1D, 0xF5, 0xCD, 0x16, 0x0C, 0x5D, 0x0F, 
+0x60, 0x17, 0x2C, 0x85, 0xDD, 0xCE, 0x21, 0xE9, 0x75, 0xF7, 0x83, 0x16, 0xB8, 0x87, 0x86, 0x38, 
+0x0F, 0x06, 0xAD, 0x05, 0x44, 0x1B, 0xBC, 0xA7, 0x51, 0x5C, 0xE4, 0x43, 0xB2, 0xAF, 0x9E, 0x5F, 
+0x82, 0x55, 0xAE, 0x5F, 0x1E, 0xAA, 0x97, 0xDF, 0x55, 0x2B, 0xB3, 0x08, 0x91, 0x00, 0x15, 0x2A, 
+0x27, 0x13, 0xF7, 0xCB, 0x8F, 0xE0, 0x38, 0x1A, 0x92, 0x81, 0x6E, 0x8F, 0x7A, 0xDE, 0x0B, 0x5A, 
+0xB3, 0x38, 0x8A, 0x58, 0xAA, 0xB6, 0x19, 0x5B, 0x37, 0x81, 0xC5, 0x81, 0x97, 0xC5, 0x9C, 0x45, 
+0x34, 0xAA, 0x33, 0x61, 0x6F, 0xFC, 0x60, 0x30, 0x39, 0x5C, 0xC7, 0x84, 0x97, 0xC5, 0xFC, 0x57, 
+0xE0, 0x81, 0xA1, 0xE3, 0x17, 0xE2, 0x01, 0x90, 0xE4, 0xB2, 0xE0, 0xB4, 0x60, 0x49, 0x56, 0x67, 
+0x40, 0xBF, 0x37, 0x7E, 0xF8, 0xA0, 0xBF, 0x8E, 0x01, 0x20, 0xC3, 0xBF, 0x02, 0x07, 0x0C, 0x21, 
+0xBF, 0x28, 0x07, 0x5A, 0x9F, 0x80, 0x0B, 0xD9, 0x02, 0x26, 0x86, 0x7C, 0x88, 0x53, 0x0A, 0x46, 
+0x65, 0xC4, 0x17, 0x4C, 0x53, 0x3D, 0xA7, 0x31, 0x3A, 0xBB, 0x9F, 0xE6, 0x0B, 0x16, 0x8A, 0xF7, 
+0xB0, 0x3F, 0xA2, 0x64, 0x28, 0x68, 0x2D, 0x92, 0x62, 0x1A, 0xCB, 0x82, 0x09, 0x9B, 0xB2, 0x34, 
+0x1A, 0x92, 0x6B, 0xB0, 0xD2, 0x16, 0x09, 0x5D, 0xEA, 0xFD, 0xEC, 0x9B, 0xA0, 0x25, 0xB2, 0x2C, 
+0x11, 0xF1, 0x02, 0xC0, 0xE6, 0x59, 0x04, 0x63, 0x34, 0x4E, 0x23, 0x76, 0xE5, 0x05, 0x2D, 0x0C, 
+0xB2, 0xC9, 0x59, 0x28, 0x0C, 0xCA, 0x1A, 0x9F, 0x95, 0xA6, 0x3D, 0x38, 0x08, 0x48, 0xF9, 0x4F, 
+0xAF, 0xFB, 0xB0, 0xED, 0x05, 0x2D, 0x11, 0x8B, 0x84, 0x95, 0x2C, 0x9A, 0x0C, 0x1E, 0xEE, 0xDD, 
+0xC7, 0x3E, 0x8C, 0x96, 0xE6, 0xED, 0xFE, 0xF8, 0xE0, 0xE0, 0x70, 0xAF, 0xDE, 0xB3, 0xEC, 0x80, 
+0xDD, 0x67, 0x63, 0xAF, 0xC2, 0xA1, 0x7E, 0xD0, 0x5A, 0xD0, 0x08, 0x76, 0xFE, 0x87, 0xA4, 0x3F, 
+0x08, 0x5A, 0x61, 0xC6, 0xD3, 0xB2, 0x7F, 0x1E, 0x04, 0x2D, 0xD5, 0x3A, 0x44, 0x93, 0x6B, 0x1E, 
+0x8D, 0xB3, 0xAB, 0x77, 0xBA, 0xD4, 0x3E, 0x58, 0xD3, 0x41, 0x2B, 0x0F, 0x69, 0xC2, 0x90, 0x33, 
+0x4B, 0xF8, 0x67, 0xCA, 0x63, 0x60, 0x4E, 0xCB, 0x30, 0x47, 0x16, 0x0C, 0x4D, 0x0F, 0xEE, 0x4D, 
+0xF6, 0x51, 0xC0, 0x23, 0x4E, 0x2F, 0x65, 0x1F, 0x5A, 0x23, 0x75, 0xCC, 0xA6, 0x71, 0xFA, 0x54, 
+0xFC, 0x47, 0xC6, 0x33, 0x5D, 0x52, 0xC4, 0xE1, 0x39, 0xA0, 0x27, 0x25, 0xB9, 0xBD, 0x80, 0xC0, 
+0xA4, 0x0B, 0x2F, 0xF3, 0xF8, 0xCF, 0x6C, 0x48, 0xFA, 0x7D, 0x72, 0x43, 0x90, 0x9A, 0x2B, 0x8B, 
+0x86, 0xA6, 0x0E, 0xDA, 0x12, 0x59, 0x00, 0xE1, 0x53, 0xEF, 0x33, 0x81, 0x9B, 0x64, 0x43, 0x98, 
+0x08, 0xC0, 0x34, 0x3F, 0x3D, 0x8F, 0x17, 0xA6, 0xF9, 0x83, 0x1E, 0xD4, 0x08, 0x75, 0x62, 0xDF, 
+0xD2, 0x50, 0x82, 0x5E, 0x13, 0xD5, 0xF3, 0x30, 0x9F, 0xC0, 0x26, 0x56, 0x40, 0xE8, 0x55, 0x9C, 
+0x0F, 0x89, 0x07, 0xEE, 0xF6, 0xAA, 0x18, 0x00, 0x4D, 0x09, 0x5D, 0x66, 0x85, 0x70, 0x88, 0xBA, 
+0x26, 0x22, 0x5B, 0x48, 0xDA, 0x38, 0x78, 0x50, 0xE4, 0xCF, 0x71, 0x26, 0x44, 0x36, 0x1F, 0x92, 
+0x83, 0x80, 0x24, 0x6C, 0x22, 0x86, 0xE4, 0x00, 0x5A, 0x1D, 0xB4, 0xA8, 0x0E, 0xEC, 0x40, 0xBE, 
+0x17, 0x5C, 0xFD, 0x86, 0x9D, 0x84, 0x00, 0x03, 0xA5, 0x0A, 0x4E, 0xC3, 0xF8, 0xE7, 0xFF, 0x9D, 
+0x12, 0x96, 0x8B, 0x9F, 0xFF, 0x9A, 0x46, 0x94, 0x93, 0x05, 0xE5, 0x14, 0x76, 0x9E, 0x0B, 0xD8, 
+0x74, 0xA5, 0x61, 0x9C, 0xA5, 0x2C, 0x27, 0x79, 0x41, 0x2F, 0x58, 0xDE, 0x62, 0x34, 0x47, 0x2A, 
+0x3C, 0x46, 0x73, 0xF6, 0xB6, 0x10, 0xFF, 0xBE, 0x00, 0x6B, 0x08, 0xD7, 0x4E, 0x37, 0xE5, 0x16, 
+0x0B, 0x4D, 0xCF, 0x8F, 0xD7, 0x1B, 0x53, 0x00, 0x72, 0xBA, 0xA0, 0xFC, 0x1C, 0x27, 0xAA, 0x26, 
+0x6B, 0xAA, 0x44, 0xA5, 0x67, 0x5E, 0xD8, 0x6A, 0x91, 0x98, 0x37, 0x4C, 0xCC, 0xFD, 0x43, 0x98, 
+0x98, 0xED, 0xA2, 0x5B, 0x9A, 0x11, 0x87, 0x30, 0xBF, 0xAA, 0x28, 0xA2, 0xA4, 0x60, 0x9D, 0x83, 
+0x5E, 0x6F, 0x0D, 0x9A, 0x95, 0x56, 0x45, 0xAF, 0x44, 0x83, 0xBB, 0x59, 0x0B, 0x0A, 0x66, 0xAF, 
+0xDE, 0x5F, 0x75, 0x9A, 0x7E, 0xDC, 0x38, 0x97, 0xAB, 0x66, 0xDE, 0x7A, 0x3E, 0xBF, 0xB6, 0x54, 
+0x70, 0x65, 0xA4, 0x0F, 0x0E, 0x0E, 0xF7, 0x60, 0xA4, 0x9B, 0xB6, 0x1D, 0xF6, 0x7A, 0xC4, 0x07, 
+0x07, 0x0E, 0xE3, 0x44, 0xC2, 0xB6, 0xEB, 0x7A, 0xC7, 0x6E, 0x7C, 0x45, 0x49, 0x0C, 0x1C, 0x2D, 
+0x7F, 0x80, 0x88, 0x4F, 0xE7, 0x59, 0x26, 0x66, 0x8C, 0x83, 0xA5, 0x7F, 0xC1, 0xD6, 0xE9, 0x7D, 
+0x0C, 0x6B, 0x8B, 0xF3, 0x78, 0x9C, 0x30, 0x82, 0x9F, 0xF2, 0xC6, 0x99, 0x00, 0x63, 0xCB, 0x28, 
+0x9F, 0x32, 0x32, 0x83, 0x0F, 0x84, 0xE3, 0x97, 0x95, 0xF3, 0x83, 0x6E, 0xE4, 0x6D, 0xE7, 0x07, 
+0x59, 0x75, 0x6C, 0xE8, 0x1B, 0xC8, 0xC1, 0xF1, 0x9C, 0xE6, 0x31, 0xE3, 0x44, 0x64, 0xB2, 0xF6, 
+0xD6, 0xCD, 0xAF, 0x3D, 0x51, 0xB0, 0x14, 0x97, 0xFA, 0x06, 0xF9, 0x2F, 0x36, 0x6F, 0x1C, 0xFC, 
+0x0A, 0x13, 0x47, 0x6F, 0xF3, 0xC4, 0xA1, 0xC8, 0x46, 0x42, 0x5E, 0xB8, 0x8A, 0x76, 0x10, 0x90, 
+0x4B, 0x26, 0xF5, 0x9B, 0x37, 0xCE, 0x92, 0xC8, 0x03, 0xD6, 0x00, 0x69, 0x15, 0xB8, 0x3D, 0x0B, 
+0xEE, 0xB0, 0xD7, 0x43, 0xB0, 0x50, 0x45, 0xB5, 0x20, 0xAB, 0x11, 0xF9, 0x90, 0xF8, 0xA1, 0x54, 
+0x2F, 0xE8, 0x0C, 0x56, 0xBF, 0x3F, 0xF6, 0x3E, 0x75, 0x71, 0x24, 0xC1, 0xE2, 0xD4, 0x7B, 0x13, 
+0x5F, 0xB0, 0xC4, 0x0B, 0xB4, 0x31, 0xE4, 0x14, 0xF8, 0xE9, 0xF7, 0xD7, 0xEA, 0xB1, 0xBB, 0xA0, 
+0x3C, 0x67, 0x51, 0x77, 0x79, 0xF3, 0xCD, 0x4F, 0xAD, 0x9B, 0xC6, 0x69, 0xAE, 0x32, 0xBD, 0x2D, 
+0x32, 0xB9, 0x15, 0x0D, 0xBD, 0x81, 0x2E, 0xEF, 0xC6, 0xA9, 0x6C, 0x4E, 0xAF, 0x80, 0x67, 0xBD, 
+0xE0, 0x2B, 0x66, 0x49, 0x39, 0x87, 0xBD, 0x62, 0xE9, 0x14, 0x3A, 0xA3, 0xA7, 0x3C, 0x2F, 0xF0, 
+0x8E, 0xCC, 0x29, 0x3F, 0x87, 0xE8, 0xCF, 0x38, 0x3C, 0x87, 0xB8, 0x96, 0xAC, 0x10, 0x2D, 0x6B, 
+0xCA, 0xAB, 0xD6, 0x55, 0x99, 0xF4, 0x7A, 0x16, 0x8F, 0x0F, 0x34, 0x8F, 0x35, 0x39, 0x6A, 0x81, 
+0x6A, 0xF5, 0xFC, 0x03, 0x6C, 0xCD, 0x19, 0xE0, 0x7E, 0x15, 0xCF, 0x63, 0x81, 0x26, 0x97, 0xEE, 
+0x93, 0x21, 0xF1, 0xD1, 0x87, 0x84, 0x6C, 0xC5, 0x5F, 0x10, 0xA4, 0xF3, 0x8D, 0xD7, 0x32, 0x53, 
+0x74, 0x6D, 0x48, 0xFC, 0x02, 0xF3, 0xE8, 0xBA, 0x69, 0x70, 0xD3, 0x9C, 0xE6, 0x7A, 0x05, 0x2F, 
+0x95, 0x86, 0x5E, 0x2E, 0x98, 0xB3, 0xCB, 0xE5, 0xF8, 0xD1, 0x9F, 0x26, 0x89, 0xEF, 0x75, 0x0D, 
+0xCD, 0x17, 0xAC, 0x13, 0x52, 0x0E, 0xEE, 0xB3, 0x49, 0xC6, 0x9F, 0xD3, 0x70, 0xE6, 0xB3, 0x44, 
+0xEE, 0x49, 0xB0, 0x64, 0xE5, 0x76, 0x44, 0x67, 0xCE, 0x04, 0x8F, 0x43, 0xD8, 0x39, 0x50, 0x2F, 
+0x04, 0x2E, 0xD1, 0xCC, 0xE3, 0xAC, 0x98, 0xC7, 0x51, 0x2C, 0x96, 0xD6, 0xAB, 0x3C, 0x8B, 0x65, 
+0xCC, 0x8B, 0xDE, 0x8D, 0xB3, 0xB7, 0x50, 0x46, 0xD5, 0x2D, 0x14, 0xED, 0xCD, 0x97, 0x5B, 0x29, 
+0x18, 0xDE, 0xA4, 0xE7, 0x12, 0x43, 0x28, 0x44, 0xF9, 0x3E, 0x26, 0x51, 0xDE, 0x95, 0x26, 0x33, 
+0x4C, 0xC1, 0xBC, 0x60, 0x7A, 0x11, 0x5A, 0xDD, 0x7F, 0x01, 0x89, 0xFB, 0x80, 0xAF, 0xC0, 0x8B, 
+0x03, 0xFB, 0x5C, 0xC9, 0x12, 0x63, 0xA8, 0x20, 0x1A, 0xDC, 0xF4, 0x01, 0xBA, 0xB2, 0x70, 0x58, 
+0x82, 0x4F, 0x64, 0xE7, 0x48, 0x45, 0x1C, 0x4B, 0x8F, 0x07, 0x3C, 0x6B, 0xD2, 0x25, 0xC9, 0xD8, 
+0x6C, 0xF4, 0xD2, 0xD4, 0xE9, 0x84, 0x11, 0x6C, 0x28, 0x53, 0xEE, 0x30, 0x83, 0xF9, 0x7B, 0xFE, 
+0xF3, 0x5F, 0x27, 0x71, 0x98, 0x0D, 0x09, 0x2C, 0x52, 0x19, 0xA7, 0xA2, 0xE0, 0x74, 0xC7, 0xDA, 
+0xD3, 0xAA, 0x1A, 0x25, 0xD0, 0x49, 0x92, 0xCB, 0xED, 0xE6, 0x5D, 0xCE, 0x15, 0x7D, 0x82, 0xD6, 
+0x8A, 0x22, 0x5F, 0xAD, 0x54, 0x77, 0x8C, 0x9F, 0xCC, 0x6D, 0x8C, 0xE9, 0xB4, 0x55, 0x0D, 0xEA, 
+0x6F, 0xD5, 0x20, 0xB5, 0x56, 0xDD, 0xD8, 0x98, 0xB2, 0xBA, 0x6D, 0x1B, 0x54, 0x96, 0xB0, 0x1B, 
+0x25, 0x97, 0x9E, 0xAB, 0x1A, 0x25, 0xC5, 0x6E, 0x45, 0x83, 0x06, 0x5B, 0x35, 0x08, 0x57, 0x9E, 
+0x1B, 0x9B, 0x23, 0x2B, 0xDA, 0xB6, 0x29, 0x7A, 0x34, 0x94, 0xCD, 0x90, 0xEB, 0x47, 0x68, 0xC6, 
+0x9A, 0x8A, 0xA0, 0x0D, 0x1D, 0x24, 0xD1, 0x6B, 0xCB, 0x5D, 0xA5, 0x33, 0x76, 0x85, 0xC6, 0x27, 
+0xBC, 0x3B, 0xDA, 0xB6, 0x24, 0x6E, 0x8D, 0x1A, 0x47, 0x1E, 0xFE, 0xD5, 0xA3, 0x46, 0x59, 0x10, 
+0x5D, 0x33, 0x22, 0xBA, 0xE0, 0x1D, 0xBC, 0xC6, 0x04, 0x05, 0xD0, 0xDB, 0x37, 0x95, 0xE1, 0xD5, 
+0xFE, 0x8A, 0x82, 0xDA, 0xC7, 0xCE, 0x59, 0x1A, 0x31, 0xCE, 0xA2, 0x1F, 0x40, 0xE5, 0xE6, 0xCA, 
+0xE2, 0xFC, 0x91, 0xD1, 0xF3, 0xD7, 0x74, 0xA1, 0x82, 0x46, 0x99, 0x6C, 0x0C, 0xE9, 0x3C, 0x86, 
+0xF5, 0x06, 0xCF, 0x16, 0x8C, 0x8B, 0xE5, 0x50, 0x46, 0xBD, 0x4B, 0x4D, 0x6D, 0xA9, 0x42, 0x19, 
+0x46, 0x1F, 0xF9, 0x2C, 0x09, 0xC8, 0x39, 0x5B, 0x06, 0x44, 0x69, 0xF5, 0x6B, 0x93, 0x93, 0x42, 
+0x46, 0x95, 0x4A, 0x81, 0x61, 0x3E, 0x4B, 0x74, 0x94, 0x30, 0xC0, 0x20, 0xBC, 0x84, 0xBD, 0xBE, 
+0x81, 0x10, 0x69, 0x07, 0x3E, 0x47, 0xF8, 0x00, 0xB1, 0xB5, 0xF5, 0x46, 0x0A, 0x3C, 0x7C, 0x3C, 
+0x67, 0xCB, 0x4F, 0x28, 0x7B, 0xAA, 0x56, 0x67, 0xC7, 0xA1, 0x65, 0x81, 0x10, 0xB5, 0x61, 0x51, 
+0xD9, 0x91, 0x29, 0x35, 0x3A, 0x13, 0xD0, 0xBB, 0x58, 0x8D, 0x9C, 0xED, 0xE5, 0x36, 0x0F, 0x4B, 
+0xD0, 0x0F, 0x6E, 0x35, 0xD2, 0x43, 0x03, 0x20, 0x85, 0xC9, 0x06, 0x01, 0xDB, 0x84, 0x25, 0xAE, 
+0x78, 0xB0, 0x2B, 0x51, 0xC5, 0xFD, 0x52, 0xCC, 0x13, 0x2C, 0x0D, 0xD1, 0x88, 0x5B, 0xE1, 0x46, 
+0xC0, 0x12, 0xB7, 0xDA, 0xD0, 0x84, 0xB7, 0x55, 0xDC, 0xA7, 0x20, 0x60, 0x58, 0x1C, 0x82, 0x26, 
+0xAD, 0x0E, 0x58, 0x51, 0x87, 0x14, 0x48, 0x08, 0x9F, 0xB5, 0xE1, 0xB1, 0x2A, 0xFC, 0xF4, 0x11, 
+0x5E, 0x5B, 0x2C, 0x73, 0x6B, 0x3B, 0x86, 0x31, 0xF7, 0x86, 0xCE, 0x65, 0x8D, 0xA1, 0x7E, 0x5A, 
+0xD7, 0x26, 0x0D, 0xE3, 0xD9, 0xF0, 0x58, 0x9F, 0x79, 0x84, 0x91, 0xA1, 0x7F, 0xBB, 0x11, 0x81, 
+0x18, 0x8C, 0x82, 0x95, 0x5A, 0x4D, 0xCC, 0xD2, 0x4D, 0xF5, 0x59, 0xED, 0xCB, 0x52, 0xAB, 0x32, 
+0xD4, 0x16, 0x12, 0xA9, 0x6F, 0x3E, 0x57, 0xDB, 0xF8, 0x4E, 0xC9, 0xFC, 0xF6, 0x4C, 0xAD, 0x72, 
+0x72, 0x03, 0x0F, 0x67, 0x2C, 0x3C, 0x57, 0x25, 0x43, 0xF9, 0x5B, 0xA3, 0xBE, 0x23, 0x8D, 0x50, 
+0x20, 0x57, 0x7E, 0x40, 0xE9, 0x36, 0x40, 0xAE, 0x7C, 0xDB, 0x50, 0x1A, 0x66, 0xAD, 0x88, 0xE3, 
+0x78, 0xC2, 0x6A, 0x1B, 0xDA, 0xC3, 0x12, 0xB9, 0xAB, 0x87, 0x31, 0x16, 0xEA, 0xBB, 0x79, 0x67, 
+0xB5, 0x44, 0x6D, 0x92, 0x80, 0x22, 0x3B, 0x86, 0x88, 0x68, 0xA5, 0x43, 0xA4, 0xFE, 0xB0, 0x77, 
+0x56, 0x04, 0xE3, 0x8B, 0x2C, 0xA1, 0x42, 0xAE, 0x2D, 0xA4, 0xB9, 0x17, 0x40, 0x3A, 0x19, 0x7A, 
+0x4E, 0xD4, 0x16, 0x1F, 0x7E, 0xC3, 0x0D, 0x3B, 0xFC, 0x55, 0xEE, 0xC2, 0x9C, 0xB3, 0xA5, 0xAE, 
+0x15, 0x2C, 0xC3, 0xCF, 0xD0, 0xA1, 0x90, 0x8A, 0x66, 0x7E, 0xD3, 0x2B, 0xF3, 0xBB, 0xC4, 0x64, 
+0x5E, 0x69, 0x84, 0xAE, 0x55, 0x51, 0x52, 0x8D, 0x4A, 0xE8, 0x9C, 0x2D, 0x95, 0x16, 0x52, 0x00, 
+0xA3, 0x11, 0x31, 0x96, 0x91, 0xE6, 0x8E, 0x55, 0x06, 0xEC, 0x60, 0xD8, 0xD0, 0x1A, 0x1C, 0x1C, 
+0xB6, 0x6D, 0x5C, 0x61, 0xC2, 0x28, 0xF7, 0xAD, 0x29, 0x66, 0x1E, 0x5F, 0xDD, 0xA6, 0xD1, 0xAA, 
+0xA0, 0xAA, 0x44, 0x12, 0x16, 0xC8, 0x0A, 0xDA, 0xD6, 0x8E, 0x98, 0x9A, 0x3C, 0xAC, 0x3E, 0xBD, 
+0x65, 0x3D, 0xE4, 0xBA, 0xA5, 0xBB, 0xF3, 0x35, 0x15, 0xB3, 0xEE, 0x9C, 0x5E, 0xF9, 0x58, 0x44, 
+0x3E, 0xC5, 0xA9, 0x8F, 0x65, 0x95, 0x1C, 0x6B, 0xDF, 0x0B, 0x5A, 0xC9, 0x64, 0xA4, 0x0C, 0x76, 
+0xD2, 0x81, 0x5A, 0xDA, 0x64, 0x97, 0x00, 0xB0, 0x7A, 0xD2, 0xA0, 0xB8, 0x28, 0x7A, 0xC9, 0xC0, 
+0xE5, 0xE3, 0xCF, 0xD8, 0x95, 0x8A, 0xB8, 0x51, 0x68, 0x20, 0xEE, 0x1F, 0xBE, 0x9F, 0xA4, 0x02, 
+0x3E, 0x76, 0xF3, 0x24, 0x0E, 0x19, 0x78, 0x4F, 0xF6, 0xDA, 0xE0, 0xAB, 0x29, 0x37, 0x60, 0x9A, 
+0x01, 0xF7, 0x02, 0x72, 0xE0, 0x02, 0x8E, 0x9B, 0x01, 0x0F, 0x02, 0x72, 0x5F, 0x03, 0x2A, 0xCE, 
+0x7D, 0xE4, 0x01, 0x99, 0x06, 0x64, 0xFC, 0x09, 0xF3, 0x19, 0xD4, 0x6E, 0x31, 0xEF, 0x07, 0x64, 
+0xDA, 0x0F, 0xC8, 0xB8, 0xFF, 0x49, 0x23, 0x7A, 0xC9, 0xAE, 0xFC, 0x92, 0x73, 0xE5, 0xC6, 0x32, 
+0x1F, 0x04, 0x64, 0x3A, 0x08, 0xC8, 0x78, 0xE0, 0x80, 0x3A, 0x1D, 0xA8, 0xDB, 0x88, 0xBC, 0xC4, 
+0xC5, 0xB7, 0xCF, 0xFB, 0x90, 0xA4, 0xC0, 0x07, 0xA4, 0x43, 0x78, 0x1F, 0x76, 0x8B, 0x91, 0x95, 
+0x4E, 0x43, 0x2D, 0xE8, 0x29, 0x42, 0x4F, 0x01, 0x7A, 0xDA, 0x00, 0x3D, 0x76, 0xA1, 0xC7, 0x08, 
+0x3D, 0x06, 0xE8, 0xB1, 0x03, 0xAD, 0x9A, 0xFC, 0x13, 0x9F, 0x8E, 0xFD, 0xDF, 0x5F, 0xF3, 0x9B, 
+0x80, 0xFC, 0xFE, 0x7A, 0x8A, 0xFF, 0x8E, 0x6F, 0xDA, 0x3F, 0x35, 0x84, 0x0E, 0x7D, 0x38, 0xF1, 
+0x23, 0x95, 0x0D, 0x61, 0xE5, 0x90, 0xC2, 0x2B, 0xDB, 0x90, 0x9F, 0x26, 0xD9, 0x98, 0xCA, 0x34, 
+0x96, 0x8D, 0x6B, 0x0A, 0x50, 0x61, 0xEA, 0xFB, 0x1A, 0x67, 0x57, 0x73, 0x9A, 0x88, 0x9B, 0x8C, 
+0x91, 0x93, 0x34, 0x03, 0xA3, 0x85, 0x46, 0xCB, 0x80, 0x44, 0x6C, 0xC2, 0x38, 0x66, 0xC0, 0x7C, 
+0x38, 0x51, 0xB4, 0xAB, 0x44, 0x8C, 0x32, 0x20, 0x49, 0x27, 0x2C, 0x61, 0x32, 0x4D, 0xB1, 0x50, 
+0x0D, 0xE9, 0x42, 0xC3, 0x5E, 0x33, 0x9A, 0x17, 0x1C, 0x6D, 0x1B, 0x19, 0xE9, 0x30, 0x82, 0xBC, 
+0x38, 0x3B, 0xAF, 0xE8, 0x92, 0x9A, 0x72, 0x77, 0xEF, 0x92, 0x3B, 0x06, 0x4B, 0x8D, 0xB6, 0xBF, 
+0xFD, 0xF7, 0x7F, 0x24, 0x2F, 0x62, 0x0E, 0x29, 0xB4, 0x25, 0x52, 0x93, 0x62, 0x1B, 0x10, 0xCE, 
+0x26, 0x9C, 0xE5, 0x33, 0x49, 0xAA, 0xA2, 0xB1, 0x9E, 0x1F, 0x08, 0xD9, 0x36, 0xB5, 0x8A, 0x47, 
+0x25, 0xF1, 0xBA, 0xE7, 0x65, 0x53, 0x5F, 0xA3, 0x5D, 0x0B, 0x23, 0x2B, 0x8E, 0x8C, 0x02, 0xB7, 
+0xC6, 0x17, 0xAC, 0x25, 0x57, 0x3A, 0x5A, 0xE3, 0xC8, 0xC8, 0x51, 0x91, 0xC6, 0xE2, 0x39, 0xC0, 
+0xB2, 0xA4, 0x9B, 0xB2, 0x2B, 0x0D, 0x76, 0x1A, 0x8F, 0x21, 0x39, 0x08, 0xBB, 0xFC, 0x7B, 0x86, 
+0x51, 0x62, 0x08, 0x4A, 0xF2, 0x05, 0x4D, 0xB5, 0x4D, 0xA8, 0x50, 0xCC, 0x68, 0xFE, 0x01, 0x3E, 
+0x8D, 0x34, 0xB2, 0xBB, 0x77, 0xD5, 0xAF, 0xC6, 0xBC, 0x00, 0x69, 0x91, 0x77, 0x00, 0x42, 0x07, 
+0x93, 0x39, 0xAC, 0xB5, 0x0D, 0x24, 0xEF, 0x11, 0xD6, 0x87, 0x68, 0x46, 0x3B, 0x32, 0x19, 0xAA, 
+0x63, 0x52, 0x7F, 0xE2, 0x74, 0xBA, 0xF3, 0xF8, 0x24, 0x8D, 0xC3, 0x18, 0x32, 0x69, 0xBA, 0xDD, 
+0xEE, 0xA3, 0x5D, 0x00, 0x7F, 0xAC, 0xD1, 0x2A, 0xC2, 0xDA, 0xA5, 0x5D, 0x24, 0xC9, 0x0A, 0x88, 
+0xA7, 0xBC, 0x09, 0x76, 0x90, 0xBA, 0xB5, 0x88, 0x51, 0x6A, 0x71, 0x34, 0x22, 0x9D, 0x87, 0x0F, 
+0x1F, 0x82, 0xFC, 0xBA, 0x6F, 0xBA, 0xBD, 0xF5, 0x84, 0x32, 0xCE, 0x33, 0xDE, 0xB9, 0xCC, 0x78, 
+0xB4, 0xF3, 0xF8, 0xF9, 0xFB, 0xF7, 0x6F, 0xDF, 0xFF, 0x12, 0x84, 0x61, 0x85, 0xC6, 0x2C, 0x45, 
+0x82, 0x4C, 0x52, 0x53, 0x1C, 0x59, 0xAB, 0x62, 0xF2, 0x84, 0xF4, 0xC9, 0x90, 0xF4, 0xDA, 0x9A, 
+0xBB, 0x51, 0x65, 0xC9, 0xEC, 0x98, 0x89, 0x1E, 0xCE, 0x23, 0xDA, 0x43, 0xD2, 0x30, 0x45, 0xF7, 
+0x0F, 0x02, 0xB2, 0x77, 0x10, 0x94, 0xEB, 0x3D, 0xF8, 0xC9, 0x26, 0xFB, 0xFB, 0xFB, 0xFB, 0x3B, 
+0x6D, 0x97, 0x6F, 0xBA, 0x26, 0x67, 0x3D, 0x7B, 0xBB, 0xDA, 0xC0, 0x61, 0xFE, 0xB0, 0x07, 0x55, 
+0x48, 0x17, 0x12, 0xD6, 0x26, 0x3D, 0xB8, 0xAB, 0x6A, 0x33, 0x0B, 0xCD, 0xDB, 0xD5, 0xD4, 0xC3, 
+0x8C, 0x2A, 0x40, 0x1F, 0x3D, 0xBC, 0x7F, 0xBF, 0x27, 0xDB, 0xA5, 0xD6, 0x82, 0x2B, 0x6A, 0x52, 
+0xC1, 0xA9, 0x5F, 0x51, 0x55, 0x9F, 0xED, 0xD1, 0x07, 0x14, 0xAB, 0x9A, 0xD0, 0x30, 0xEC, 0x1F, 
+0xD8, 0x55, 0xAD, 0x42, 0xBB, 0xB3, 0x23, 0x97, 0x62, 0x98, 0x91, 0xAC, 0x16, 0x3C, 0xDB, 0x89, 
+0x90, 0x0C, 0xC2, 0xBD, 0xD1, 0x89, 0x41, 0x52, 0x69, 0xF8, 0x9E, 0xF2, 0x19, 0xA1, 0x2E, 0x84, 
+0xDF, 0xED, 0x2A, 0x80, 0xE5, 0x45, 0x42, 0x20, 0xFD, 0x5C, 0x03, 0x44, 0xDE, 0x2B, 0x20, 0xF8, 
+0xFD, 0x3A, 0x8B, 0x73, 0x51, 0x70, 0x56, 0x03, 0x94, 0xAC, 0x53, 0x90, 0xF8, 0xE0, 0xEC, 0xE6, 
+0x3C, 0x4F, 0x36, 0xED, 0x0B, 0xB9, 0xBB, 0x3F, 0x1F, 0xB4, 0xDA, 0x92, 0x85, 0x9B, 0x54, 0x97, 
+0x05, 0xFD, 0x23, 0xE5, 0xE9, 0x26, 0xFC, 0x9D, 0x4B, 0xCA, 0x53, 0x15, 0x84, 0x5B, 0x96, 0xFC, 
+0x21, 0xCE, 0x0B, 0x9A, 0xFC, 0xC8, 0x21, 0xF8, 0x9D, 0xAF, 0x8D, 0x90, 0x05, 0x14, 0x17, 0x08, 
+0xDD, 0xB9, 0x94, 0xE0, 0x25, 0xA6, 0x4B, 0x2A, 0x18, 0x7F, 0xC5, 0x2E, 0xD6, 0x2A, 0x65, 0x0F, 
+0xA1, 0x3A, 0x09, 0x80, 0xAD, 0x55, 0x8C, 0xB2, 0xC9, 0x5F, 0xAB, 0x1C, 0x4B, 0x2E, 0x5A, 0x32, 
+0x54, 0xBE, 0x6C, 0x56, 0x45, 0x06, 0xB0, 0x6C, 0x51, 0x40, 0xBC, 0x19, 0x53, 0x9D, 0xEB, 0xF5, 
+0xBE, 0xD1, 0xA1, 0xDB, 0xA0, 0xA7, 0x34, 0xEB, 0x03, 0xB2, 0x63, 0x08, 0x21, 0x39, 0xE4, 0x9A, 
+0xCD, 0x75, 0xCE, 0xA4, 0x53, 0xB3, 0x84, 0x2D, 0xC5, 0xFE, 0x82, 0x72, 0xBF, 0xD3, 0x81, 0x15, 
+0x74, 0x47, 0x06, 0x6B, 0x51, 0xBE, 0x6C, 0xD7, 0x4A, 0x39, 0x5D, 0x04, 0x31, 0xF8, 0xE5, 0x9E, 
+0x84, 0x35, 0x76, 0xDE, 0xB0, 0x42, 0x70, 0x9A, 0xA8, 0x4D, 0x2D, 0x7B, 0x70, 0xCB, 0x51, 0x40, 
+0xD3, 0x73, 0xD5, 0x41, 0x4A, 0xC7, 0x6F, 0xE6, 0xF8, 0x26, 0x2D, 0x6F, 0xC9, 0xE9, 0xDD, 0xBB, 
+0x96, 0xD4, 0x6E, 0x9E, 0x15, 0x1D, 0x0D, 0xB3, 0xA9, 0x4F, 0x6E, 0xBE, 0xBC, 0x57, 0xFE, 0xF6, 
+0x97, 0xFF, 0xF9, 0x7F, 0xFE, 0xE5, 0x9F, 0xC8, 0x73, 0x68, 0x08, 0x91, 0x09, 0xCB, 0xB7, 0x65, 
+0xAF, 0x99, 0x09, 0x94, 0x86, 0x8A, 0x14, 0x87, 0xE1, 0x08, 0x02, 0x64, 0x50, 0x7D, 0xFA, 0xD2, 
+0xDC, 0x3C, 0x15, 0x60, 0xBD, 0x55, 0xF8, 0xDF, 0xAE, 0xD6, 0xFF, 0xBC, 0xAA, 0x09, 0x7F, 0x0D, 
+0xDE, 0x6E, 0xC5, 0xD7, 0x8A, 0xE0, 0xE0, 0x86, 0x85, 0x22, 0xCF, 0x7C, 0x7A, 0x57, 0xCC, 0x17, 
+0xB5, 0x1A, 0x37, 0xB1, 0x54, 0x4F, 0x42, 0xD2, 0xFA, 0xE2, 0x8C, 0xA5, 0x4D, 0x9D, 0xF7, 0x2A, 
+0x61, 0xA9, 0x1A, 0xDA, 0x1B, 0x47, 0x52, 0x89, 0x72, 0x8D, 0xE4, 0x3F, 0x1E, 0x91, 0x87, 0x07, 
+0xB7, 0x25, 0x76, 0xA7, 0x59, 0xB2, 0x80, 0xB8, 0x6C, 0x33, 0x59, 0x87, 0xE3, 0xFB, 0x83, 0x07, 
+0x3D, 0xD3, 0x52, 0xBA, 0x5C, 0x43, 0xDE, 0x23, 0x32, 0xE8, 0xDD, 0x9A, 0x95, 0x55, 0xE9, 0x5C, 
+0x33, 0x0A, 0x70, 0xA7, 0x8F, 0x1C, 0xF3, 0x9F, 0xFF, 0x97, 0x88, 0xC3, 0x2D, 0x68, 0x37, 0xA8, 
+0x1B, 0xA6, 0xEF, 0x2F, 0x67, 0xDC, 0x8E, 0x4A, 0xF1, 0x56, 0x7E, 0x95, 0xD9, 0xF9, 0x89, 0x39, 
+0x5A, 0x63, 0xDD, 0xDC, 0x11, 0xCE, 0xCE, 0x3B, 0xE5, 0x21, 0x1C, 0x1D, 0x88, 0x3D, 0x31, 0xB2, 
+0xA8, 0xCB, 0x48, 0x07, 0xB8, 0x2A, 0x86, 0x7E, 0x1D, 0x17, 0xFD, 0xDD, 0xBB, 0x95, 0xA3, 0x3D, 
+0xBA, 0xEE, 0xB1, 0x1E, 0xA8, 0x1A, 0xE1, 0x7C, 0x08, 0xD5, 0x0B, 0xDA, 0x71, 0xE5, 0x60, 0x51, 
+0xC3, 0xA2, 0x52, 0xF2, 0xF3, 0x67, 0x2B, 0x09, 0x59, 0x2D, 0x60, 0x45, 0xBA, 0x5D, 0xD3, 0xC6, 
+0x22, 0xB5, 0x9A, 0xE6, 0xD9, 0xE1, 0xD4, 0x10, 0xF5, 0xBB, 0x15, 0x0E, 0x3D, 0x39, 0x3A, 0x68, 
+0x9A, 0x26, 0xD8, 0x67, 0x2A, 0x8E, 0xDE, 0x77, 0xC8, 0x0B, 0xF4, 0xFE, 0x56, 0xCE, 0xC4, 0x77, 
+0x85, 0x10, 0x59, 0xFA, 0x0A, 0xB6, 0x83, 0xAB, 0x40, 0x3B, 0xCF, 0x4F, 0xDF, 0x3D, 0x7F, 0xFF, 
+0xF4, 0xCD, 0xB3, 0xB7, 0xE5, 0x98, 0x2C, 0x3D, 0xA4, 0x55, 0x7A, 0xD1, 0xF9, 0xAA, 0xE6, 0xEC, 
+0x08, 0x12, 0xE1, 0x65, 0xEE, 0xEB, 0xFA, 0x01, 0x00, 0x9C, 0x5C, 0x3F, 0x61, 0x7D, 0x55, 0x0B, 
+0x56, 0xA0, 0x26, 0x4F, 0xC8, 0x0E, 0xCE, 0x70, 0x3B, 0x64, 0x48, 0x76, 0xBE, 0x7B, 0xFA, 0x0F, 
+0x6F, 0xBF, 0xA4, 0x75, 0x72, 0x3E, 0xA8, 0xAE, 0x68, 0x56, 0xD1, 0xAB, 0xE5, 0x45, 0x9A, 0x91, 
+0x92, 0xE6, 0x9A, 0x30, 0x28, 0x8A, 0x17, 0x05, 0xDA, 0xB0, 0x1B, 0x08, 0x32, 0xA0, 0x90, 0x70, 
+0x56, 0x23, 0x4E, 0xA5, 0x7B, 0x41, 0x0E, 0x5A, 0x63, 0xB7, 0x38, 0x52, 0x77, 0x46, 0xD3, 0xF3, 
+0x2D, 0xE4, 0x4D, 0xDB, 0xAD, 0xF5, 0x36, 0xE0, 0x17, 0x8B, 0xDF, 0xEF, 0x56, 0xB6, 0x00, 0xAA, 
+0xAA, 0x00, 0x7E, 0x09, 0xFD, 0x46, 0x9F, 0x6C, 0x22, 0x1D, 0x34, 0x09, 0x1A, 0xB3, 0xDB, 0xEB, 
+0x10, 0x44, 0x59, 0xD7, 0x1E, 0xFA, 0xF8, 0x9F, 0x35, 0x7A, 0xA3, 0xD2, 0xB8, 0x55, 0xBA, 0x42, 
+0x36, 0xC8, 0x24, 0xBD, 0x6C, 0x66, 0xBC, 0x4E, 0xA0, 0x69, 0x66, 0xBE, 0xF9, 0xAA, 0x17, 0x2E, 
+0xEA, 0xD9, 0x9E, 0xBC, 0xD5, 0xC1, 0x2B, 0x40, 0xFA, 0xA0, 0x4D, 0xAE, 0x61, 0xFA, 0x78, 0x9A, 
+0x50, 0x3E, 0x6F, 0xEA, 0x22, 0x4D, 0x58, 0x93, 0xCC, 0x53, 0x28, 0x54, 0x95, 0xF9, 0xD5, 0x08, 
+0x1C, 0x7A, 0xBE, 0x46, 0x4E, 0xC3, 0xD9, 0xF9, 0x29, 0x0B, 0x25, 0xFB, 0xD7, 0x77, 0xB6, 0xAE, 
+0xED, 0x16, 0x1D, 0xAE, 0x31, 0xDF, 0xBD, 0x4B, 0x9A, 0x01, 0xBB, 0xB8, 0x0D, 0x2C, 0x0F, 0xF8, 
+0x89, 0xE7, 0xCC, 0x6B, 0x90, 0x0E, 0x3B, 0xC7, 0xC9, 0x91, 0x10, 0x4C, 0x5C, 0x71, 0xA4, 0x44, 
+0x55, 0x57, 0xE1, 0x8E, 0x2B, 0x2C, 0x98, 0x70, 0x68, 0x6D, 0x0F, 0xAD, 0x96, 0x10, 0xDD, 0x5C, 
+0x9D, 0x7B, 0xE4, 0xB5, 0xA1, 0xDF, 0x66, 0xD9, 0xA5, 0x17, 0x90, 0x3B, 0x77, 0x6A, 0x55, 0xA8, 
+0xF9, 0x18, 0xB7, 0x63, 0x56, 0x34, 0x41, 0x9F, 0x53, 0xA5, 0xA9, 0x77, 0x70, 0xC8, 0x73, 0x7C, 
+0x56, 0x73, 0x2A, 0x8E, 0x4A, 0x3E, 0xE9, 0x5C, 0x2C, 0x29, 0x25, 0x72, 0x7F, 0x66, 0xAB, 0xE4, 
+0xAD, 0x0A, 0x6B, 0xB0, 0x4E, 0xB3, 0x37, 0xEA, 0x7C, 0x7A, 0x9E, 0x46, 0xDB, 0x12, 0x83, 0xB9, 
+0x5D, 0xDB, 0x93, 0x82, 0xE0, 0x15, 0x42, 0x9E, 0xA7, 0x91, 0x63, 0xCF, 0x48, 0x89, 0x7D, 0xA5, 
+0x12, 0xE3, 0xB6, 0x18, 0xC8, 0x3A, 0x87, 0xAE, 0x79, 0x20, 0x9B, 0xAF, 0xDA, 0xAF, 0xA0, 0x9E, 
+0x9B, 0x35, 0xA9, 0xAE, 0xB6, 0x02, 0xFC, 0x55, 0xDA, 0xF4, 0x55, 0x31, 0xDF, 0x66, 0x8C, 0xE9, 
+0xBA, 0x6E, 0x31, 0xC6, 0x34, 0xE6, 0xFA, 0xC8, 0xB1, 0xF3, 0x0A, 0xD7, 0xE8, 0x56, 0x85, 0xA0, 
+0xD2, 0xDA, 0xBA, 0x8A, 0x6D, 0x52, 0x79, 0xDA, 0xD0, 0x56, 0xC7, 0x06, 0xC6, 0x59, 0xAA, 0x12, 
+0x1E, 0x77, 0x7E, 0xD7, 0x3F, 0x3C, 0x3C, 0xD8, 0xDB, 0x07, 0x0F, 0xD6, 0x71, 0x06, 0xDF, 0x68, 
+0x94, 0x39, 0x2B, 0x95, 0xAA, 0xFD, 0x62, 0x61, 0xED, 0xAF, 0xC6, 0x1A, 0xD2, 0x07, 0xB4, 0x87, 
+0x58, 0x9F, 0x26, 0x8C, 0x0B, 0xAA, 0x50, 0xFE, 0x07, 0x96, 0x24, 0xD9, 0xE5, 0x3A, 0x9C, 0x7B, 
+0x4A, 0x39, 0xCB, 0xD5, 0xAB, 0x5C, 0xCA, 0xAE, 0xA8, 0x43, 0x19, 0xEC, 0x60, 0xA7, 0xB9, 0x0B, 
+0x5E, 0xBD, 0x36, 0x70, 0x54, 0xF4, 0xBA, 0xF2, 0x38, 0x13, 0x50, 0xBB, 0xA4, 0xF4, 0xC9, 0xB9, 
+0x47, 0xFB, 0xC9, 0x8E, 0x2C, 0xDD, 0xFC, 0x6D, 0x93, 0xEE, 0x88, 0x9B, 0x19, 0xA7, 0xCB, 0x34, 
+0xF4, 0x9B, 0x92, 0xB7, 0x95, 0x84, 0x83, 0x3D, 0x14, 0x05, 0x70, 0x58, 0x1A, 0x8A, 0x47, 0xB9, 
+0x17, 0x3A, 0x5E, 0x7B, 0x40, 0x0D, 0x16, 0x83, 0x40, 0x67, 0x4B, 0x19, 0x8E, 0x05, 0xD8, 0x63, 
+0x30, 0x62, 0xD0, 0x66, 0x32, 0x28, 0x57, 0x42, 0x41, 0x50, 0x2C, 0xEC, 0x78, 0x18, 0x38, 0xBD, 
+0x52, 0x41, 0x18, 0xFD, 0x1E, 0xCC, 0xC2, 0xB7, 0x6F, 0xD0, 0x26, 0x7C, 0xFB, 0xE2, 0xC5, 0x4E, 
+0x6D, 0xE7, 0xBC, 0x62, 0x68, 0x42, 0xC8, 0xC6, 0x98, 0x25, 0x55, 0x4D, 0x5D, 0x21, 0x4E, 0x0B, 
+0xE6, 0x3A, 0xCA, 0x34, 0x8C, 0x43, 0x95, 0x44, 0x5E, 0xA5, 0xC1, 0x36, 0x2F, 0x03, 0x93, 0x26, 
+0xAB, 0x04, 0xD1, 0x6C, 0xED, 0xCB, 0x0A, 0xF4, 0x57, 0xCF, 0x02, 0xB4, 0x56, 0x81, 0x12, 0x28, 
+0x5B, 0xD0, 0x50, 0xD9, 0x0E, 0x0A, 0x06, 0x14, 0x48, 0xAF, 0x7B, 0x80, 0xCA, 0xA2, 0xEF, 0xD5, 
+0x28, 0xA8, 0x49, 0x52, 0x28, 0xF7, 0x61, 0x75, 0x60, 0x89, 0xC1, 0xBF, 0x49, 0x17, 0x46, 0x19, 
+0x6A, 0x7A, 0xAF, 0x12, 0xCF, 0xEB, 0x95, 0x7B, 0xC3, 0x9A, 0x1F, 0x1B, 0xED, 0x52, 0x76, 0x85, 
+0xA8, 0x90, 0x84, 0xD2, 0x66, 0x38, 0x7E, 0xF9, 0xF4, 0xFD, 0xD9, 0x1F, 0x5E, 0x9C, 0x3C, 0x7F, 
+0xF5, 0xEC, 0x14, 0x8E, 0xF1, 0xD4, 0x7E, 0x62, 0xDB, 0x1D, 0x2C, 0x3D, 0xBE, 0x9F, 0x50, 0xF2, 
+0x9F, 0xC9, 0x68, 0x2E, 0x22, 0x5D, 0x6A, 0x65, 0x9B, 0xEB, 0x52, 0xAE, 0x37, 0xCF, 0xCD, 0x21, 
+0x94, 0x95, 0x38, 0x43, 0x7D, 0x30, 0x65, 0xE3, 0xC1, 0x93, 0xE6, 0xAC, 0x86, 0xCA, 0x19, 0x96, 
+0x2D, 0x38, 0xAC, 0x52, 0xEE, 0x0B, 0xFA, 0xF5, 0xD3, 0xA3, 0xE4, 0xC8, 0xC3, 0x79, 0xCB, 0x84, 
+0x37, 0xA8, 0xCD, 0xD0, 0x75, 0xDB, 0x3B, 0x66, 0x0B, 0x92, 0x3C, 0x21, 0x3D, 0x32, 0x6C, 0x08, 
+0xD9, 0x50, 0xA3, 0x1C, 0xC5, 0x9A, 0x71, 0x2B, 0x53, 0x54, 0xA6, 0x0D, 0x43, 0xCA, 0xB0, 0x3E, 
+0xC5, 0x4E, 0x4D, 0x7A, 0x4B, 0xF0, 0x78, 0xBE, 0xC1, 0xAF, 0x66, 0x4B, 0xF5, 0x89, 0x95, 0x27, 
+0xDE, 0xB0, 0x1B, 0x39, 0x84, 0xF6, 0xE9, 0xDD, 0xCB, 0xE7, 0x8B, 0x2C, 0x84, 0xF3, 0x16, 0x4B, 
+0x44, 0x8F, 0x61, 0x3F, 0x41, 0xFF, 0xA7, 0x01, 0xF1, 0xEC, 0x3B, 0x0C, 0x9A, 0xC2, 0x13, 0x7B, 
+0x87, 0xC4, 0x1B, 0x74, 0xA2, 0x78, 0x1A, 0x83, 0xAF, 0x6A, 0x8E, 0x09, 0xB5, 0xD6, 0x2B, 0x72, 
+0x63, 0xF6, 0x86, 0x7D, 0x79, 0x68, 0x28, 0x6C, 0x5F, 0x44, 0x66, 0x97, 0x1E, 0xBA, 0x4B, 0xBE, 
+0xEF, 0x0A, 0x73, 0xD6, 0x68, 0x25, 0x22, 0x42, 0x95, 0xDF, 0x39, 0xEB, 0xEC, 0xC0, 0xEE, 0xB3, 
+0x7B, 0xA4, 0x6A, 0x37, 0xC1, 0x88, 0x63, 0xD2, 0x51, 0x68, 0xF5, 0x7A, 0x1B, 0x1B, 0x63, 0xCA, 
+0x9A, 0x24, 0xEB, 0x6A, 0x5D, 0x70, 0x60, 0x1F, 0x9E, 0x1F, 0xCB, 0x80, 0x1F, 0xCA, 0x55, 0xF8, 
+0xF1, 0x53, 0xA0, 0x5A, 0x69, 0x98, 0x4B, 0xA7, 0xCC, 0xE1, 0x4C, 0x87, 0x54, 0x31, 0x99, 0x76, 
+0x9A, 0xBA, 0x52, 0x84, 0xF3, 0xA1, 0xE8, 0x23, 0xD2, 0x53, 0x1D, 0x4D, 0xA7, 0xAC, 0xBD, 0xB9, 
+0xD2, 0x1B, 0x77, 0x74, 0x5B, 0x02, 0x58, 0x1E, 0xA8, 0x21, 0x17, 0x58, 0x2B, 0xB7, 0xBA, 0x8F, 
+0x6E, 0xB3, 0x61, 0x2E, 0x91, 0xD5, 0x3F, 0xBB, 0xDB, 0xC7, 0xA3, 0x51, 0xE5, 0x58, 0x59, 0x6B, 
+0x78, 0x21, 0x4D, 0xA8, 0x1B, 0xDF, 0xC2, 0xB9, 0x7D, 0x55, 0xE9, 0x35, 0xB6, 0x4C, 0x56, 0x60, 
+0x2E, 0x4D, 0x63, 0x27, 0x9A, 0xA3, 0x9C, 0x31, 0x2B, 0x05, 0xF6, 0xAA, 0xCD, 0x68, 0xD6, 0x34, 
+0x3C, 0x1E, 0x55, 0xCF, 0xCD, 0x95, 0x41, 0x51, 0xE6, 0xF8, 0xDA, 0x3B, 0x96, 0xA1, 0x02, 0x87, 
+0xB7, 0xFA, 0x98, 0xBA, 0x8E, 0x51, 0x38, 0x50, 0x73, 0x87, 0xF4, 0x8F, 0x48, 0x0C, 0x68, 0x7A, 
+0x47, 0x24, 0xEE, 0x74, 0xB4, 0xCA, 0x70, 0xE9, 0xF9, 0x18, 0x7F, 0xAA, 0x88, 0xA3, 0x55, 0x05, 
+0x2A, 0x53, 0x45, 0x63, 0x4C, 0xEE, 0x91, 0xFE, 0x51, 0x6B, 0xCC, 0x19, 0x3D, 0x2F, 0x0D, 0x78, 
+0xF9, 0xF5, 0x31, 0xB1, 0x22, 0x52, 0x65, 0xCE, 0x8C, 0x6A, 0x67, 0xDB, 0x69, 0xA3, 0x5D, 0xE6, 
+0x91, 0x34, 0x89, 0x6A, 0x05, 0xEB, 0x1C, 0x83, 0xF3, 0x04, 0x14, 0xBB, 0xDB, 0x47, 0x2D, 0x5B, 
+0xA5, 0x9A, 0xF0, 0x69, 0x7F, 0x12, 0xB3, 0x04, 0xC6, 0x9B, 0xAD, 0xD7, 0x2A, 0x01, 0xB2, 0xF1, 
+0x27, 0xFC, 0xDD, 0x8C, 0x5F, 0x9D, 0xF2, 0x3B, 0x7A, 0x6C, 0x6B, 0x39, 0xF9, 0xF2, 0x23, 0xE2, 
+0xFE, 0xD4, 0x56, 0x0A, 0x11, 0xE4, 0xA7, 0x42, 0x6F, 0xBD, 0xF1, 0x32, 0x50, 0xC6, 0x81, 0xB6, 
+0x43, 0xA9, 0xBF, 0x88, 0x0E, 0x14, 0x7C, 0x67, 0x6F, 0xD3, 0xE9, 0x74, 0xE4, 0x2A, 0x74, 0xF8, 
+0x23, 0xD9, 0xFF, 0x47, 0x24, 0xBE, 0x77, 0xAF, 0x1C, 0x43, 0x1A, 0x31, 0xA9, 0x75, 0xBF, 0x23, 
+0xD1, 0xA8, 0x50, 0x91, 0xD5, 0xA5, 0x0E, 0x33, 0x61, 0xB1, 0xF2, 0xBC, 0x2A, 0xD9, 0x17, 0x81, 
+0x33, 0xB7, 0x21, 0xED, 0xC8, 0xA7, 0xF5, 0x2C, 0x0C, 0x24, 0x6D, 0x9A, 0x31, 0x2E, 0xC2, 0x8F, 
+0x2B, 0x9A, 0xFC, 0xA9, 0x2C, 0xA5, 0xD7, 0x3D, 0x26, 0x50, 0xE4, 0x7B, 0x4E, 0x27, 0x71, 0x48, 
+0xF3, 0xE1, 0x8E, 0x0A, 0xC9, 0x52, 0xFA, 0x67, 0x07, 0x10, 0xA4, 0xB9, 0xE0, 0x45, 0x1C, 0xD1, 
+0x1C, 0x0C, 0x2A, 0x5F, 0x8F, 0x0A, 0x04, 0x83, 0x23, 0x4B, 0x77, 0xC8, 0xA2, 0x48, 0x45, 0x96, 
+0x93, 0xB4, 0x60, 0x17, 0x59, 0x0E, 0x66, 0x68, 0x67, 0x47, 0xD5, 0x15, 0x90, 0x1D, 0xF9, 0xB1, 
+0x21, 0xB2, 0xC4, 0x55, 0x0C, 0xEA, 0xB3, 0x39, 0x52, 0x5A, 0x56, 0xF3, 0x18, 0xA9, 0xA8, 0xF0, 
+0xDA, 0x8C, 0x4B, 0x7B, 0xC8, 0x0D, 0xD5, 0xB9, 0xDF, 0x11, 0x4B, 0x98, 0x50, 0x07, 0x4C, 0x37, 
+0x05, 0x20, 0xD7, 0x42, 0x8E, 0xC1, 0x5E, 0x78, 0x0B, 0xE7, 0xCB, 0x82, 0x16, 0x96, 0xB9, 0x5D, 
+0xE6, 0x4C, 0x22, 0x88, 0x39, 0x83, 0x00, 0x13, 0xC8, 0xDA, 0x20, 0x79, 0x12, 0x47, 0x0C, 0x0F, 
+0x75, 0x94, 0x5C, 0x2F, 0x83, 0x96, 0xD5, 0xD1, 0x46, 0xE0, 0x9D, 0xA4, 0xB9, 0x78, 0x11, 0x27, 
+0x60, 0xD6, 0xB9, 0x44, 0x37, 0x9E, 0x85, 0xD4, 0x58, 0xC0, 0x8E, 0x49, 0x96, 0x5F, 0x4E, 0x60, 
+0x9A, 0x52, 0x43, 0xDF, 0x91, 0xD5, 0xBE, 0x94, 0x53, 0x7D, 0x62, 0xB2, 0x52, 0x89, 0xAE, 0xC0, 
+0x2E, 0x38, 0xBB, 0x28, 0x99, 0xFD, 0x31, 0x56, 0x7C, 0x03, 0xED, 0xFD, 0xF9, 0x73, 0x39, 0x97, 
+0xC3, 0x59, 0x17, 0x36, 0x98, 0x03, 0x82, 0x3A, 0x15, 0x00, 0x3A, 0x12, 0x1D, 0x4C, 0xF2, 0x3A, 
+0x0C, 0xCB, 0x25, 0x31, 0xB6, 0xD7, 0xD4, 0xE5, 0xE7, 0xCD, 0x9B, 0xE8, 0x1D, 0x00, 0xEE, 0x4C, 
+0x10, 0xDA, 0x3E, 0xFF, 0xD6, 0x46, 0x0F, 0x2A, 0x18, 0x94, 0xB7, 0x26, 0xB2, 0xF2, 0xDD, 0x92, 
+0x86, 0xB2, 0xF9, 0x80, 0x51, 0x9D, 0x17, 0xB3, 0xB9, 0x98, 0x7B, 0xCC, 0xCA, 0xF6, 0x16, 0x51, 
+0xDD, 0xB2, 0xC2, 0x8B, 0x09, 0x9E, 0x4E, 0x33, 0x1D, 0x0B, 0x37, 0x49, 0xB2, 0x8C, 0xFB, 0x6A, 
+0x7E, 0xD7, 0x34, 0x61, 0x70, 0x22, 0x98, 0x4B, 0xF2, 0xEC, 0x14, 0xF8, 0xA7, 0x8C, 0x66, 0x94, 
+0x76, 0xD1, 0x2D, 0x71, 0xE8, 0xC0, 0x1A, 0x53, 0xFD, 0x63, 0xB3, 0x60, 0x46, 0xF3, 0xDB, 0xEE, 
+0x91, 0x80, 0xFC, 0xF4, 0xF3, 0x5F, 0x12, 0x11, 0xCF, 0x33, 0x92, 0xC0, 0x86, 0x5D, 0x94, 0x0D, 
+0xC9, 0x8C, 0x86, 0x8C, 0xFC, 0xFE, 0x5A, 0x17, 0xBF, 0x99, 0xFD, 0xE4, 0xFA, 0xFD, 0x2D, 0xA2, 
+0xBE, 0x0C, 0x73, 0x89, 0xE0, 0x66, 0x1E, 0xA7, 0x3F, 0x35, 0xC5, 0x10, 0xB9, 0x98, 0xBC, 0x1A, 
+0x26, 0xCE, 0x42, 0x48, 0xEF, 0x54, 0x3B, 0xCC, 0xB7, 0x2E, 0xDE, 0xE9, 0x78, 0xD5, 0xB3, 0x8A, 
+0x61, 0x03, 0x1F, 0x53, 0xDE, 0x68, 0xF2, 0x5E, 0x9A, 0xF9, 0x3E, 0x13, 0x74, 0x6A, 0xD9, 0xE5, 
+0xD7, 0x2D, 0x3C, 0x54, 0x19, 0x52, 0xB8, 0xB2, 0x0E, 0x48, 0x11, 0x24, 0xB7, 0xCE, 0x18, 0x8D, 
+0x18, 0xA4, 0x05, 0x02, 0x30, 0x79, 0x42, 0xAE, 0x89, 0x77, 0x32, 0xE9, 0xBC, 0xC9, 0x52, 0xD6, 
+0x79, 0x4D, 0x45, 0x38, 0xF3, 0xD4, 0x97, 0x1B, 0x32, 0x24, 0xD7, 0x37, 0x15, 0x03, 0x6D, 0xCE, 
+0xF8, 0x94, 0xBD, 0x94, 0x12, 0x69, 0xC2, 0x1A, 0xD1, 0x95, 0xF7, 0x94, 0x73, 0xBA, 0xEC, 0xC6, 
+0x39, 0xFE, 0x95, 0x5E, 0x05, 0xAD, 0x19, 0x4A, 0xE3, 0xC9, 0x38, 0x1C, 0xD4, 0xA7, 0x67, 0x2C, 
+0x29, 0x51, 0x48, 0x4F, 0x44, 0x9C, 0x86, 0xD2, 0xD1, 0xE9, 0x5C, 0x61, 0xD0, 0xD6, 0xA7, 0x80, 
+0xEB, 0xBA, 0xDB, 0xDD, 0x10, 0x88, 0xF5, 0x99, 0x4A, 0x34, 0xC4, 0x39, 0x01, 0x22, 0x4E, 0x7C, 
+0xEF, 0xA5, 0xBE, 0x0C, 0x81, 0x61, 0x09, 0x32, 0xA1, 0x31, 0x64, 0x77, 0x7A, 0x01, 0x61, 0xDD, 
+0x39, 0xCB, 0x73, 0x34, 0x4C, 0xEB, 0xFB, 0x42, 0xAE, 0x3A, 0xD2, 0x82, 0x52, 0x99, 0xA4, 0xE1, 
+0x74, 0x77, 0xBF, 0xDB, 0xED, 0x3A, 0xED, 0x3B, 0x6A, 0xB9, 0x73, 0xC2, 0xBD, 0x7B, 0x56, 0x17, 
+0xCB, 0x33, 0x9C, 0xE8, 0xDC, 0x70, 0xCD, 0xC5, 0xA8, 0xE3, 0x81, 0x0C, 0xAB, 0xAA, 0x55, 0xEA, 
+0x10, 0x4B, 0xF5, 0xB6, 0xA9, 0xAE, 0xDA, 0xFD, 0x0A, 0xD5, 0x29, 0xEA, 0xA6, 0xC6, 0xF8, 0x53, 
+0x08, 0xB5, 0xBE, 0xE3, 0x2C, 0xCF, 0x4A, 0x0D, 0x55, 0x59, 0x70, 0x3C, 0x26, 0xD5, 0x92, 0x0D, 
+0x8C, 0x81, 0x03, 0xA0, 0x42, 0x06, 0x39, 0xDF, 0xAB, 0x56, 0x2D, 0x35, 0x24, 0xD6, 0x19, 0xFD, 
+0x66, 0xFA, 0x5C, 0x45, 0x41, 0xC3, 0x74, 0xBA, 0xAA, 0x9E, 0xE6, 0xE9, 0xD5, 0xAA, 0xBC, 0x56, 
+0x8D, 0xBB, 0x04, 0xB1, 0xBA, 0x8A, 0x06, 0x64, 0xAC, 0xA5, 0x93, 0xEA, 0x1A, 0x80, 0x6B, 0x63, 
+0x63, 0xDF, 0xBA, 0x29, 0x03, 0xEA, 0xC9, 0xC0, 0xA2, 0xEB, 0x0F, 0x66, 0x23, 0x9F, 0x82, 0xE1, 
+0xE7, 0x5A, 0xDA, 0x63, 0xF7, 0xD5, 0xDD, 0xBB, 0x84, 0x7E, 0xA4, 0x2B, 0xDA, 0x21, 0xE1, 0xC7, 
+0xCD, 0x5F, 0xDD, 0x49, 0x3A, 0x62, 0x61, 0x16, 0x99, 0x26, 0x8C, 0x8B, 0xC9, 0x84, 0x59, 0x71, 
+0xFF, 0x70, 0xEE, 0x70, 0x79, 0x16, 0x17, 0xFD, 0x21, 0x66, 0x97, 0x1A, 0x46, 0x0E, 0x4F, 0x00, 
+0x80, 0xA9, 0xEE, 0x43, 0x9C, 0x8A, 0x07, 0x7E, 0xAF, 0x8D, 0xED, 0xED, 0xB7, 0x89, 0x98, 0xF1, 
+0xEC, 0x12, 0xCB, 0xA1, 0xB3, 0xCF, 0xF7, 0x3E, 0xA4, 0x79, 0xB1, 0x80, 0x73, 0x36, 0x59, 0x64, 
+0xEE, 0x1F, 0x51, 0x2B, 0x66, 0xC8, 0x10, 0xA8, 0xE2, 0x31, 0x33, 0x44, 0x04, 0x63, 0x1E, 0xE3, 
+0xDD, 0x1D, 0x88, 0x7E, 0x9B, 0xDC, 0x25, 0xBD, 0xAB, 0x5E, 0x5F, 0xD6, 0xD8, 0xAB, 0xAE, 0xA3, 
+0x6C, 0xE8, 0xFE, 0xA1, 0x3F, 0x30, 0x1B, 0xB0, 0x60, 0x55, 0x64, 0x93, 0x09, 0xF8, 0x4D, 0x46, 
+0xA4, 0x3F, 0x28, 0xCB, 0x25, 0xC5, 0x1C, 0xEC, 0x35, 0x7F, 0xBC, 0x14, 0x2C, 0x0F, 0x30, 0xCA, 
+0xD9, 0x89, 0xE8, 0xBD, 0xB0, 0x73, 0xB4, 0xA4, 0xDA, 0xD2, 0x86, 0xA6, 0x63, 0xAE, 0xF4, 0xEA, 
+0x66, 0xB5, 0x2C, 0xFA, 0x31, 0xFE, 0x84, 0x2E, 0x16, 0x1A, 0xF9, 0x8A, 0x80, 0x7B, 0x24, 0x26, 
+0xDF, 0x12, 0xAC, 0x10, 0x8E, 0x72, 0x55, 0x2F, 0xB5, 0x55, 0xA8, 0xBE, 0x1C, 0x39, 0x6E, 0x93, 
+0xDC, 0x8A, 0x99, 0x9F, 0x24, 0x19, 0xFA, 0x1B, 0xFC, 0x0C, 0x09, 0xB5, 0xC2, 0xD1, 0x75, 0xEB, 
+0x5F, 0x00, 0xC4, 0xDE, 0xC0, 0xCF, 0x54, 0xF3, 0xC9, 0xB7, 0x78, 0x8A, 0x3D, 0xD9, 0x85, 0x3F, 
+0x26, 0xCE, 0x4E, 0x0B, 0x46, 0x2E, 0x73, 0x32, 0x8A, 0x79, 0xEA, 0xEF, 0x07, 0x1A, 0xAB, 0xCD, 
+0x48, 0x0B, 0x53, 0x19, 0xA5, 0xA7, 0xCE, 0xBC, 0x32, 0xE5, 0x90, 0xAA, 0xD2, 0x44, 0x50, 0xAE, 
+0xAB, 0x35, 0x20, 0xB9, 0x3A, 0xDA, 0x49, 0x7E, 0x1E, 0xD4, 0x6A, 0x3E, 0xC1, 0x1E, 0xAC, 0x57, 
+0x2C, 0xD7, 0xF9, 0xB7, 0x2D, 0x86, 0xB1, 0x8F, 0x5F, 0x50, 0x4E, 0xAD, 0xC2, 0x8C, 0x26, 0xC3, 
+0xB9, 0x68, 0x28, 0xC5, 0x33, 0x68, 0x59, 0x8A, 0x6A, 0x58, 0x95, 0xBD, 0x7D, 0x85, 0xCA, 0x40, 
+0x0D, 0x2D, 0x96, 0xE3, 0x5A, 0xC8, 0x37, 0xCF, 0x7A, 0x51, 0xEA, 0x5F, 0xB7, 0x80, 0xB1, 0x43, 
+0x64, 0xEF, 0xC7, 0xF8, 0x53, 0x60, 0x18, 0x39, 0x34, 0xBF, 0xF0, 0x35, 0x30, 0x6F, 0x88, 0xFF, 
+0xE2, 0x23, 0x30, 0x45, 0x1E, 0x10, 0x81, 0x8F, 0x89, 0xCC, 0x0F, 0xC7, 0x3F, 0xF2, 0xBB, 0xAE, 
+0xA8, 0x75, 0xD3, 0x6E, 0x83, 0x24, 0xA1, 0xA6, 0x97, 0xD3, 0xAA, 0x35, 0xA1, 0x8E, 0xAA, 0xDD, 
+0xFE, 0xC0, 0x8C, 0x1F, 0x25, 0x8C, 0x98, 0x90, 0x00, 0x07, 0xCC, 0xDA, 0x17, 0xF6, 0xA0, 0x55, 
+0xD1, 0x74, 0x37, 0xD1, 0x2B, 0xBC, 0xC4, 0xA1, 0xCC, 0x35, 0x35, 0xDA, 0xC7, 0x9D, 0xA4, 0xB5, 
+0x71, 0xE0, 0x22, 0x74, 0xA6, 0x0F, 0x5D, 0x05, 0x16, 0xF4, 0xBD, 0x5D, 0xF5, 0xC1, 0x0B, 0xC8, 
+0x35, 0xA9, 0x5B, 0x2F, 0xC4, 0x58, 0x2F, 0xD7, 0xC4, 0x7B, 0x1A, 0x86, 0x6C, 0x21, 0xBC, 0x21, 
+0xF1, 0xE8, 0x02, 0xA6, 0x1F, 0x5C, 0x2A, 0xED, 0x66, 0xA1, 0x60, 0xA2, 0x23, 0x6F, 0x60, 0xF2, 
+0xE0, 0x78, 0x96, 0x76, 0x0B, 0x8E, 0x5B, 0x4D, 0x7D, 0xCE, 0xF2, 0xD2, 0x15, 0x77, 0x87, 0xB3, 
+0xBC, 0x9B, 0x9D, 0x37, 0xE8, 0xB5, 0x97, 0x67, 0x67, 0xEF, 0x50, 0x83, 0x01, 0x84, 0xF4, 0xEF, 
+0x96, 0x5C, 0x82, 0x77, 0x14, 0x54, 0xC5, 0x77, 0xA8, 0x33, 0xA5, 0x9B, 0x54, 0xE1, 0x97, 0x6A, 
+0x54, 0x56, 0xE1, 0xDA, 0x49, 0x4D, 0x1A, 0xB9, 0xB4, 0x1A, 0x0C, 0x2F, 0x55, 0x4E, 0x59, 0xBB, 
+0xD5, 0x9D, 0xC4, 0x29, 0xDC, 0xC0, 0xA4, 0x1D, 0xB5, 0x2B, 0x3A, 0x84, 0xDC, 0xD8, 0xE9, 0x4B, 
+0x2E, 0x8C, 0x3B, 0x25, 0x50, 0x41, 0x3F, 0x70, 0xE7, 0x20, 0x3F, 0x77, 0xE2, 0xD5, 0xBE, 0x24, 
+0xF0, 0xBC, 0xE3, 0xBD, 0x5B, 0x4F, 0x50, 0x6C, 0x46, 0xC0, 0x06, 0x17, 0x72, 0xA8, 0x00, 0x3C, 
+0xA7, 0x02, 0xEC, 0xBC, 0x63, 0x3C, 0x72, 0xD2, 0x37, 0xA6, 0x9A, 0xEF, 0xA9, 0x2B, 0xB4, 0xD0, 
+0xA1, 0x5E, 0xB3, 0x55, 0xCB, 0xCB, 0xAF, 0xDA, 0x8D, 0x3D, 0x54, 0xB2, 0x5F, 0xEE, 0x4B, 0xF5, 
+0xF6, 0x4B, 0x27, 0x27, 0x8A, 0xA3, 0x73, 0x7B, 0x16, 0x40, 0x2B, 0xD9, 0xC0, 0xDC, 0x33, 0xEF, 
+0xF9, 0x19, 0xC5, 0xD0, 0x63, 0xAB, 0xE3, 0xFE, 0x98, 0xC3, 0xFD, 0x0B, 0x56, 0x8F, 0xA9, 0x1B, 
+0xBE, 0x4A, 0xA1, 0x90, 0x2F, 0x1C, 0x67, 0x9F, 0x73, 0x57, 0x98, 0x7C, 0xEE, 0x5E, 0x68, 0xC3, 
+0x4A, 0x26, 0xB0, 0xE1, 0xBB, 0x9C, 0xF1, 0x0B, 0xC6, 0xDF, 0xC9, 0x3B, 0x60, 0xF4, 0xD1, 0x89, 
+0x72, 0xA9, 0xD1, 0x70, 0x25, 0xDB, 0xBA, 0x42, 0x52, 0xA7, 0xF7, 0xB4, 0xD9, 0xA6, 0x41, 0x91, 
+0x15, 0x4D, 0xF8, 0x9B, 0xEE, 0x69, 0x5B, 0x57, 0xC8, 0xC2, 0x0F, 0x9C, 0x68, 0xB0, 0xA3, 0x31, 
+0xAE, 0xC8, 0xDF, 0x91, 0x1D, 0x2A, 0x3B, 0x57, 0xC6, 0x1A, 0x81, 0x9F, 0x45, 0x1A, 0xCF, 0x65, 
+0xDF, 0xC3, 0xD8, 0x5B, 0x5A, 0x97, 0xF3, 0x44, 0x4D, 0x57, 0xBF, 0xFC, 0xEB, 0x3F, 0xFF, 0xD7, 
+0xFF, 0xA4, 0xB7, 0x14, 0xD5, 0xBD, 0x6E, 0x32, 0x99, 0x07, 0x30, 0x3A, 0xC6, 0xD9, 0x13, 0xD2, 
+0x64, 0x8D, 0x83, 0xBB, 0x46, 0x43, 0x48, 0x67, 0x07, 0x7A, 0xC8, 0x6B, 0x6B, 0x09, 0xF0, 0xFD, 
+0x68, 0xFD, 0x87, 0xFB, 0x68, 0x3B, 0x6D, 0xF8, 0x37, 0xCD, 0x74, 0x69, 0x70, 0xE8, 0xD4, 0x17, 
+0x31, 0xD6, 0xCA, 0xC4, 0xED, 0xF2, 0x9A, 0x89, 0xBC, 0x02, 0xC6, 0x79, 0x63, 0x46, 0x80, 0x1E, 
+0x11, 0xC0, 0x2F, 0x37, 0x19, 0xAC, 0x81, 0x83, 0x72, 0x2F, 0xCB, 0x59, 0x53, 0x95, 0x37, 0xE9, 
+0x68, 0x81, 0x34, 0x2B, 0x7A, 0x0C, 0xBB, 0x1A, 0x95, 0x21, 0x58, 0xD6, 0x27, 0x13, 0xD5, 0x34, 
+0x72, 0xA3, 0x9C, 0x2C, 0x10, 0x3D, 0xAE, 0x88, 0xB5, 0xFB, 0x6B, 0x7F, 0xB6, 0x02, 0x83, 0xEC, 
+0x67, 0x0B, 0x24, 0xB1, 0x42, 0x0E, 0xEC, 0x67, 0x0B, 0xA4, 0x1A, 0xEC, 0xD8, 0x14, 0xC8, 0x58, 
+0x21, 0xDB, 0x06, 0xD4, 0xCF, 0x0D, 0x74, 0xD9, 0x60, 0xF6, 0xBB, 0x06, 0xFA, 0x6C, 0x50, 0xFB, 
+0x9D, 0xEC, 0xF1, 0xCD, 0xE1, 0x99, 0x0D, 0x34, 0xB7, 0x37, 0x45, 0x75, 0x2A, 0xFD, 0xD4, 0x50, 
+0x81, 0x13, 0xC1, 0xE5, 0xB4, 0xB2, 0xBD, 0x3A, 0xD8, 0x6B, 0x35, 0xBA, 0x5A, 0xC8, 0x4F, 0x3D, 
+0xD8, 0x66, 0x7D, 0x94, 0xD0, 0x6A, 0xD4, 0xB5, 0x98, 0x88, 0xA8, 0x7E, 0x02, 0xF3, 0xDA, 0x22, 
+0x16, 0xEA, 0x5F, 0x67, 0x5C, 0x39, 0x97, 0x44, 0xD5, 0xF6, 0x4E, 0xA5, 0xEE, 0x01, 0x4D, 0xE8, 
+0x97, 0x31, 0x51, 0x95, 0x7B, 0x36, 0xDB, 0x04, 0x33, 0x8D, 0xF5, 0x89, 0xF6, 0xF5, 0xEF, 0x47, 
+0xAD, 0xA6, 0xBB, 0x39, 0xAB, 0x17, 0x42, 0x3E, 0x91, 0x53, 0xE9, 0x90, 0xD8, 0x37, 0x40, 0xB9, 
+0x37, 0x98, 0x05, 0x0D, 0x17, 0x75, 0xAE, 0xA0, 0xDB, 0x68, 0x70, 0xD0, 0x6A, 0x74, 0x69, 0x88, 
+0xAF, 0x5E, 0x03, 0x5A, 0x25, 0xBE, 0xF6, 0xFD, 0xA8, 0xD5, 0x74, 0x75, 0xE8, 0xF6, 0xC4, 0x9B, 
+0xC2, 0x90, 0x29, 0x0A, 0x94, 0xB8, 0xF4, 0xD6, 0x6E, 0x48, 0x73, 0xEF, 0x17, 0x90, 0x9F, 0xB2, 
+0x82, 0x87, 0x6C, 0xE5, 0x11, 0x39, 0x78, 0xA5, 0x9A, 0xBA, 0x44, 0x0D, 0xAE, 0x4E, 0xD3, 0x99, 
+0x97, 0xF2, 0x4E, 0x4D, 0xB9, 0x4E, 0xB3, 0xF0, 0xF8, 0x9E, 0xBA, 0x6E, 0x13, 0xA6, 0x79, 0xF9, 
+0xAB, 0xE1, 0x02, 0xA6, 0x6C, 0xC1, 0x20, 0x0A, 0xC2, 0xB7, 0x96, 0x7E, 0xE6, 0xD2, 0xB0, 0xBF, 
+0xFD, 0xE5, 0xAF, 0x12, 0xA1, 0xBE, 0xB0, 0x33, 0x34, 0x7C, 0xE8, 0x98, 0xEB, 0xDC, 0xE4, 0x7D, 
+0x9D, 0x65, 0x1D, 0xF6, 0xCD, 0x9F, 0xD2, 0x62, 0x6B, 0x92, 0x31, 0xEB, 0x6D, 0xD9, 0x83, 0xF5, 
+0xA9, 0x1A, 0xD6, 0x9A, 0x8D, 0x97, 0xDB, 0x1D, 0xC3, 0xAC, 0x4C, 0x8A, 0x05, 0xA4, 0x7D, 0xD0, 
+0x74, 0x29, 0x30, 0xD9, 0x75, 0x1E, 0xE7, 0x39, 0xDE, 0xB9, 0x19, 0x27, 0x0C, 0xA2, 0x25, 0x0C, 
+0xB9, 0xB8, 0x35, 0xB5, 0x92, 0x05, 0xFA, 0xD2, 0x42, 0x9C, 0xE3, 0xED, 0xC9, 0xE6, 0x1F, 0x4E, 
+0xDF, 0xBE, 0x91, 0x27, 0x6D, 0xF9, 0x0C, 0x5D, 0x5A, 0xED, 0xF6, 0x3A, 0x3C, 0x68, 0xF7, 0x39, 
+0x68, 0x4A, 0xAA, 0x6F, 0x89, 0x8A, 0x33, 0xD8, 0xEA, 0x35, 0xFD, 0x52, 0xE3, 0xC1, 0xBA, 0xB2, 
+0x32, 0xEA, 0xB9, 0xEC, 0x52, 0x79, 0xB0, 0x83, 0xDB, 0x37, 0xEE, 0x7E, 0x6D, 0xE9, 0x1B, 0xAC, 
+0xF5, 0x78, 0x92, 0xE5, 0xC2, 0xEA, 0x6C, 0xCE, 0x72, 0x38, 0xF3, 0xA7, 0xB9, 0xB7, 0xF5, 0x5A, 
+0xA7, 0xD6, 0x61, 0x0D, 0x57, 0x0E, 0x56, 0xA3, 0x27, 0x6A, 0x85, 0xBE, 0x42, 0x09, 0xE9, 0x2D, 
+0x3D, 0x1A, 0x59, 0xBE, 0x2C, 0xB5, 0x8A, 0x78, 0x42, 0xDE, 0xF1, 0x6C, 0x1E, 0xE7, 0x70, 0x9D, 
+0x5B, 0x9E, 0x25, 0x70, 0xB3, 0x06, 0x19, 0x92, 0x6D, 0x5D, 0xA7, 0xEF, 0x28, 0x1E, 0x77, 0xA1, 
+0x2D, 0xAD, 0x22, 0xA5, 0x17, 0x34, 0x4E, 0x20, 0x28, 0xA7, 0xE6, 0x3E, 0xC5, 0xEA, 0x95, 0x1D, 
+0x6D, 0x75, 0xA2, 0x6F, 0xD6, 0x1A, 0x8D, 0x46, 0xBF, 0xBE, 0x04, 0xB8, 0xFD, 0x65, 0x36, 0xBF, 
+0x3C, 0x6B, 0x4D, 0x0E, 0x06, 0x75, 0x40, 0x08, 0x91, 0x0B, 0x5C, 0x3C, 0xDE, 0x06, 0x7A, 0xB1, 
+0x65, 0xDD, 0x33, 0xFC, 0x45, 0x8B, 0x02, 0xE9, 0x17, 0x78, 0x6C, 0x39, 0xA5, 0xDB, 0xCD, 0x36, 
+0xEE, 0xAA, 0x81, 0x5F, 0x31, 0xAA, 0x4B, 0x9D, 0xA3, 0xCC, 0x6A, 0x65, 0x06, 0xD7, 0xCC, 0xEA, 
+0xA3, 0x56, 0xED, 0x8A, 0xE4, 0xDD, 0x5D, 0xF2, 0x22, 0x03, 0x95, 0x49, 0xF5, 0x85, 0xB8, 0x98, 
+0xF8, 0x4E, 0x32, 0x68, 0x32, 0xEE, 0x71, 0xAA, 0xF1, 0xDF, 0x1C, 0x60, 0x57, 0x66, 0xFC, 0x3E, 
+0x63, 0xA0, 0x2C, 0x4C, 0x74, 0xE1, 0x4A, 0xCA, 0x1B, 0x64, 0xD6, 0x92, 0xEA, 0xAF, 0x98, 0x7B, 
+0xA4, 0x1B, 0xBC, 0x76, 0xDD, 0x43, 0xBB, 0xA6, 0x92, 0xFF, 0xE9, 0x5F, 0x20, 0x77, 0xE8, 0xD4, 
+0xBD, 0xA6, 0x53, 0xEA, 0x60, 0xE2, 0x67, 0x85, 0x80, 0x53, 0xEB, 0xEB, 0x57, 0x74, 0x12, 0x08, 
+0x31, 0x05, 0xBB, 0xC3, 0xC4, 0x99, 0x79, 0xCD, 0x2A, 0xF8, 0x10, 0x02, 0x7C, 0x9C, 0x23, 0x0D, 
+0xF4, 0x5A, 0x55, 0x52, 0xDD, 0xBC, 0x56, 0x2D, 0x2F, 0x9E, 0xFE, 0x7F, 0x27, 0xB7, 0xCE, 0xE5, 
+0xD6, 0xBF, 0xB0, 0xE4, 0x5A, 0x6B, 0x8B, 0xED, 0x27, 0x26, 0xA7, 0x5F, 0xFE, 0xF5, 0x9F, 0xFF, 
+0xDB, 0x7F, 0x29, 0x6F, 0xC9, 0x98, 0x67, 0x69, 0x2C, 0x32, 0x3C, 0x2B, 0x42, 0xDD, 0x9D, 0xDA, 
+0x21, 0x90, 0x31, 0x8C, 0x2D, 0x31, 0xD7, 0x87, 0xD6, 0xB1, 0xEE, 0xC2, 0xC2, 0x13, 0xEF, 0x0B, 
+0xCD, 0xBD, 0x6D, 0x46, 0x8A, 0x64, 0x69, 0xC3, 0x48, 0xA9, 0xDF, 0x04, 0xBE, 0x75, 0xB3, 0xAA, 
+0x97, 0x22, 0xA2, 0xF5, 0x7A, 0xE2, 0x98, 0xF0, 0x46, 0xD2, 0xFF, 0xFF, 0x5E, 0x88, 0xEB, 0x86, 
+0x1C, 0xC5, 0xF9, 0xB1, 0x39, 0x8D, 0xE8, 0x76, 0x69, 0x6B, 0x5D, 0x73, 0x78, 0xD1, 0xA6, 0x85, 
+0x8B, 0xA9, 0x03, 0x2D, 0xDD, 0xE8, 0xA9, 0xBC, 0xB2, 0xF2, 0x9A, 0x54, 0xAF, 0xA3, 0x2E, 0x69, 
+0xB9, 0xA9, 0x08, 0xCA, 0x8E, 0xC4, 0x4D, 0x10, 0x61, 0xC9, 0xD5, 0x21, 0x81, 0xF5, 0xBA, 0x29, 
+0xB6, 0xBE, 0x0B, 0x5E, 0xD3, 0xB4, 0xA0, 0xC9, 0x6F, 0xAC, 0x13, 0x56, 0xDE, 0x4A, 0x53, 0x4F, 
+0xA8, 0xA4, 0x10, 0x71, 0xED, 0xEF, 0xC8, 0xFC, 0xC7, 0x88, 0x81, 0xF7, 0xF6, 0x4F, 0x05, 0x23, 
+0x63, 0xFA, 0xC7, 0x8C, 0xF8, 0x8F, 0x06, 0xBD, 0x6F, 0xDA, 0x5D, 0xBC, 0xAB, 0x85, 0x91, 0x45, 
+0xC1, 0x22, 0x50, 0xE4, 0x53, 0xCA, 0x1B, 0x0F, 0x5A, 0x51, 0x57, 0x79, 0xAC, 0xD8, 0xD5, 0x47, 
+0x1F, 0xC0, 0x50, 0x9B, 0x25, 0xCA, 0xAB, 0xAD, 0x4E, 0xDD, 0x3C, 0x49, 0x17, 0x68, 0xDF, 0xAF, 
+0x94, 0x14, 0x4B, 0x4A, 0x74, 0x99, 0x32, 0x10, 0x5F, 0xBF, 0x01, 0x04, 0x0E, 0xC2, 0x27, 0xE5, 
+0x89, 0x40, 0xCE, 0x87, 0xAE, 0x0A, 0x09, 0xC5, 0x30, 0xCB, 0x0D, 0x19, 0x66, 0x77, 0x54, 0xAB, 
+0xAA, 0x49, 0x05, 0xB7, 0x49, 0x36, 0x2C, 0xB1, 0x7C, 0x79, 0xB6, 0xC1, 0x82, 0x2E, 0xD5, 0x9D, 
+0xE6, 0x18, 0x4B, 0x15, 0x32, 0x5B, 0x5C, 0x35, 0xFA, 0xC0, 0x3A, 0xC7, 0xD4, 0xAA, 0xD2, 0x30, 
+0x68, 0x48, 0x7A, 0xE0, 0x75, 0xB7, 0x46, 0x8B, 0x42, 0xDB, 0x24, 0xE2, 0x67, 0x6A, 0x4D, 0xFF, 
+0xF7, 0xAD, 0x5F, 0xAC, 0x64, 0xB6, 0x95, 0x9A, 0xC5, 0xF2, 0x5E, 0xAC, 0xD2, 0x29, 0xE5, 0x65, 
+0xF6, 0x5B, 0x6A, 0x93, 0x33, 0xDC, 0x0A, 0xD9, 0xA8, 0x47, 0x00, 0xEC, 0xEF, 0x55, 0x83, 0xD8, 
+0xA9, 0xA7, 0x4A, 0x8B, 0xC8, 0xD4, 0x0A, 0x96, 0x2A, 0x8F, 0x41, 0xA9, 0x4F, 0x5C, 0x1D, 0x82, 
+0x12, 0x4F, 0xB9, 0x0E, 0x18, 0x21, 0x73, 0xE4, 0xC0, 0x17, 0x28, 0x15, 0xE3, 0x3D, 0x34, 0x8A, 
+0x65, 0x65, 0xB2, 0xE5, 0x97, 0x0E, 0x64, 0x99, 0xC5, 0xF9, 0x75, 0x43, 0xD8, 0x11, 0x25, 0x1C, 
+0xBD, 0x52, 0x3C, 0x0C, 0xCE, 0xC6, 0x69, 0x5E, 0x1B, 0x30, 0xF6, 0x75, 0x44, 0xD9, 0x7C, 0x4E, 
+0x53, 0x8C, 0xB3, 0xF8, 0x68, 0x82, 0x21, 0x41, 0xBA, 0x51, 0xC4, 0xC6, 0xD9, 0xD5, 0x17, 0xA5, 
+0xFB, 0xD9, 0x08, 0xBA, 0xD6, 0x21, 0x84, 0x4D, 0xEF, 0xAD, 0x13, 0x5B, 0xBF, 0x3A, 0xDF, 0x4E, 
+0x27, 0x72, 0xE8, 0x56, 0xC9, 0x80, 0x95, 0x6B, 0x62, 0xBB, 0xFD, 0xCC, 0x81, 0xCD, 0xED, 0x6D, 
+0x65, 0xC2, 0x98, 0xDB, 0x6B, 0x64, 0xC2, 0xCA, 0x01, 0xB5, 0xE4, 0x62, 0xA5, 0xCC, 0x2B, 0x6B, 
+0xF9, 0x8E, 0x4A, 0x07, 0xBD, 0x9D, 0x00, 0x95, 0xD9, 0xA8, 0x5F, 0x27, 0x44, 0x37, 0x2B, 0xF9, 
+0x54, 0x11, 0x24, 0x4B, 0xDA, 0x74, 0x89, 0x75, 0xE2, 0xF5, 0xF7, 0xAF, 0xE3, 0x2B, 0x42, 0x5D, 
+0xEA, 0x79, 0xB5, 0xC3, 0xAF, 0x44, 0xEF, 0x59, 0x7C, 0xB1, 0x36, 0xE7, 0xB0, 0x2E, 0xAA, 0x47, 
+0xD5, 0x7D, 0x21, 0x7B, 0x59, 0x81, 0x6A, 0x5E, 0xB2, 0x12, 0x37, 0x86, 0x6C, 0x3D, 0x5F, 0xDD, 
+0x4E, 0xFA, 0x47, 0xA2, 0xB3, 0x44, 0x49, 0x14, 0x5F, 0x90, 0x09, 0x84, 0x49, 0x60, 0x18, 0x70, 
+0x49, 0x5A, 0x25, 0xE9, 0xC9, 0xFA, 0x52, 0x0E, 0x18, 0xAB, 0x0A, 0x74, 0xBB, 0x01, 0x64, 0x80, 
+0xA7, 0xE2, 0xA9, 0xD3, 0x4B, 0x60, 0x47, 0x1E, 0x83, 0x69, 0x8F, 0x4F, 0x4F, 0x49, 0x79, 0xE3, 
+0x39, 0xE1, 0x45, 0x9A, 0xB7, 0xD6, 0x3B, 0xD7, 0x57, 0xCD, 0x7C, 0xEE, 0x60, 0xDC, 0x72, 0xF6, 
+0x3B, 0x35, 0x92, 0xB9, 0x66, 0x06, 0x84, 0x2B, 0xEF, 0x35, 0x5B, 0x7E, 0x23, 0x02, 0x58, 0xD9, 
+0x08, 0x7C, 0xC6, 0xE6, 0x19, 0x9E, 0x2B, 0x4F, 0x3A, 0x65, 0x07, 0x02, 0xD9, 0x51, 0xD3, 0x54, 
+0xF5, 0xDB, 0xBB, 0x74, 0x51, 0xCD, 0xCA, 0xEF, 0xC0, 0x81, 0x43, 0x2F, 0x32, 0x5E, 0x5E, 0xB4, 
+0x48, 0xE8, 0x7C, 0x4C, 0x73, 0x32, 0xCB, 0x38, 0xCD, 0x87, 0x04, 0xCF, 0x67, 0xCA, 0xC8, 0x92, 
+0xBC, 0x88, 0xD3, 0xC6, 0x59, 0xD8, 0xB6, 0x3E, 0x9D, 0x34, 0xE3, 0x61, 0xD9, 0xEA, 0xA0, 0x65, 
+0xE5, 0xFD, 0x0E, 0x75, 0x73, 0x56, 0xDA, 0x9B, 0x0E, 0xA3, 0x4B, 0xE6, 0xB2, 0x54, 0xC0, 0xC0, 
+0x28, 0xE1, 0x36, 0x64, 0x5D, 0x97, 0x7E, 0xED, 0xFA, 0xED, 0xBE, 0x9B, 0x8B, 0xAA, 0x09, 0xE2, 
+0x26, 0x20, 0x07, 0xBD, 0xEA, 0x5D, 0xBA, 0x72, 0x34, 0xBE, 0xB2, 0xF6, 0x89, 0xFE, 0xBE, 0xB5, 
+0x64, 0x25, 0x0B, 0x79, 0xA5, 0x35, 0x5C, 0xD9, 0x19, 0x5B, 0xA5, 0x17, 0x6C, 0xB0, 0xAD, 0xF5, 
+0x82, 0xE6, 0xE6, 0x16, 0x96, 0xB1, 0x06, 0xFD, 0x4D, 0x5A, 0xC7, 0xBF, 0x90, 0x35, 0xD6, 0x98, 
+0x18, 0xFE, 0x65, 0xD6, 0x58, 0xD5, 0x36, 0x70, 0xBB, 0xE7, 0xB6, 0x36, 0x94, 0xD9, 0x30, 0x5F, 
+0x63, 0x43, 0x59, 0xE9, 0xF7, 0x5F, 0x6A, 0x5B, 0x97, 0xF9, 0xFD, 0x5F, 0xBB, 0x44, 0x76, 0x1B, 
+0x8F, 0x26, 0x76, 0x29, 0x6B, 0xB7, 0xB3, 0x8E, 0x68, 0x78, 0x9E, 0x66, 0x97, 0x09, 0x8B, 0xA6, 
+0x0C, 0x33, 0xBD, 0x7F, 0xFB, 0x53, 0x13, 0x92, 0x69, 0xD3, 0x5D, 0x99, 0x9E, 0x9C, 0x71, 0x8B, 
+0xCE, 0x6F, 0x2C, 0x21, 0x6F, 0x76, 0xA9, 0x0F, 0xD8, 0x3A, 0x3A, 0x98, 0xFE, 0xA4, 0x92, 0x90, 
+0xC5, 0xB5, 0xE4, 0xD7, 0x93, 0xBE, 0x81, 0xAC, 0xD7, 0x59, 0xC4, 0xFC, 0x9A, 0xAF, 0xFC, 0x7D, 
+0x91, 0xC2, 0x01, 0x8B, 0xE0, 0x6F, 0x8D, 0x0C, 0xED, 0x3E, 0x72, 0x6D, 0x77, 0x17, 0x3C, 0xE2, 
+0x86, 0x31, 0xD6, 0xFD, 0x9B, 0xAB, 0x92, 0x6A, 0x05, 0x4B, 0x5F, 0xC7, 0x29, 0x0C, 0xBC, 0xBE, 
+0x49, 0xEC, 0xE8, 0x5B, 0xC9, 0xB0, 0x50, 0xC3, 0x33, 0x1D, 0x32, 0x29, 0x43, 0x19, 0x07, 0x83, 
+0xEE, 0x41, 0xD0, 0x2A, 0xE3, 0x18, 0x0F, 0x07, 0x41, 0xCB, 0x3E, 0xB3, 0x72, 0x48, 0xF6, 0x1F, 
+0x04, 0x2D, 0x15, 0xB2, 0x78, 0x78, 0x10, 0xB4, 0xCC, 0x42, 0x77, 0x48, 0xEE, 0x1F, 0x04, 0x2D, 
+0xF0, 0x5F, 0x95, 0x77, 0xEA, 0xA8, 0x75, 0xA7, 0x79, 0x51, 0x9A, 0xE2, 0xEA, 0x45, 0x62, 0xA4, 
+0x4F, 0xBD, 0xA8, 0x7A, 0x25, 0xD5, 0x6D, 0x75, 0xC6, 0xAF, 0x20, 0x9F, 0x5D, 0x6B, 0x4B, 0xBE, 
+0x73, 0x87, 0xB2, 0x82, 0xC3, 0x51, 0x00, 0x37, 0xCD, 0xB5, 0x1A, 0xD2, 0x65, 0x86, 0xC0, 0x38, 
+0x2B, 0xE0, 0x13, 0xEE, 0xFE, 0x72, 0x62, 0x44, 0xE7, 0xF4, 0x0A, 0xD8, 0xF3, 0x4E, 0xDE, 0xB2, 
+0x75, 0x23, 0xA3, 0x25, 0xC7, 0x34, 0x67, 0xEA, 0x0E, 0xD9, 0x41, 0xAF, 0x7C, 0xF5, 0xB2, 0x8C, 
+0xA1, 0x3D, 0xB4, 0x5E, 0xAB, 0x2B, 0x51, 0x0F, 0xAC, 0x57, 0xEA, 0x70, 0xA1, 0x07, 0x07, 0xD5, 
+0x14, 0xAA, 0x7A, 0x72, 0x67, 0x19, 0xFB, 0xFB, 0x76, 0xF2, 0x8C, 0x02, 0x6E, 0x9D, 0x74, 0xE3, 
+0x43, 0x50, 0xB2, 0xEA, 0xDF, 0x76, 0x63, 0xF6, 0x0E, 0xF9, 0x86, 0x0C, 0xF6, 0xED, 0x00, 0xE0, 
+0x1F, 0x28, 0x8F, 0xB5, 0x07, 0x10, 0xC3, 0x90, 0xF3, 0x38, 0x95, 0x51, 0xAD, 0x12, 0x79, 0x87, 
+0x1C, 0x42, 0xEC, 0x31, 0x7E, 0x7A, 0x77, 0x02, 0xE1, 0xC7, 0x03, 0x78, 0xDE, 0x97, 0x7B, 0xF8, 
+0x8C, 0x9E, 0x13, 0x2A, 0xC8, 0x60, 0x31, 0xAF, 0x04, 0x0D, 0xDB, 0x68, 0x3B, 0x6E, 0x3D, 0xDF, 
+0x92, 0x5E, 0xF7, 0x01, 0x16, 0x3F, 0x49, 0x21, 0xBE, 0x0E, 0xDC, 0xA2, 0x09, 0x7E, 0xCA, 0x67, 
+0xF1, 0xA2, 0xA5, 0xC5, 0xCF, 0x04, 0x86, 0x49, 0xBD, 0xA4, 0x24, 0x11, 0x9D, 0x92, 0x18, 0x1B, 
+0xED, 0xFB, 0x86, 0xE7, 0xF7, 0x2A, 0x2D, 0xB9, 0x47, 0x7C, 0x19, 0x51, 0x0D, 0x87, 0xFC, 0x81, 
+0x0E, 0xEA, 0xE0, 0x25, 0xB1, 0x20, 0xE7, 0xDD, 0x83, 0xB6, 0x39, 0xFA, 0xB7, 0xDF, 0x6E, 0xDB, 
+0x42, 0x6D, 0xE5, 0x30, 0x39, 0x5D, 0x77, 0xAF, 0xA1, 0x51, 0xAB, 0x6B, 0x38, 0x68, 0xCB, 0xA1, 
+0x51, 0xC3, 0x87, 0x7D, 0xBE, 0xBA, 0xDC, 0x83, 0xB6, 0x14, 0xE8, 0x5A, 0x39, 0x14, 0x8C, 0xC6, 
+0x72, 0x7B, 0x50, 0x0E, 0xCE, 0x7C, 0x87, 0x43, 0x3C, 0x64, 0x70, 0x74, 0x94, 0x5D, 0xA6, 0x97, 
+0x94, 0x47, 0x44, 0xC0, 0xD5, 0x1F, 0x2D, 0x13, 0x33, 0x8C, 0x42, 0x5D, 0x15, 0x10, 0xDC, 0x20, 
+0x31, 0xA4, 0x75, 0x46, 0x40, 0x8A, 0xBC, 0x23, 0x1D, 0x9E, 0xE7, 0x6A, 0x6C, 0xE3, 0x9D, 0xA4, 
+0x05, 0x04, 0xA9, 0x42, 0xC2, 0x01, 0x87, 0x3B, 0x9D, 0xF2, 0x96, 0x21, 0x0C, 0x4B, 0xC9, 0xDE, 
+0xC4, 0x67, 0x3C, 0x83, 0xB5, 0xB1, 0x88, 0x9D, 0x74, 0x87, 0x63, 0x07, 0x26, 0xF8, 0x4A, 0x5F, 
+0x7F, 0xAC, 0x75, 0xBE, 0x95, 0x06, 0x71, 0x54, 0x8A, 0x86, 0x8A, 0x5C, 0x37, 0xA8, 0xF0, 0x85, 
+0xF5, 0xDD, 0x0A, 0x5D, 0x2F, 0x61, 0xF4, 0x4B, 0x0B, 0xCE, 0xD6, 0x61, 0x0E, 0x2C, 0x7C, 0xB0, 
+0xEB, 0x2B, 0xFD, 0x76, 0x76, 0xA5, 0x34, 0x3D, 0xAF, 0xC6, 0x18, 0xAA, 0x12, 0x26, 0xE7, 0x12, 
+0xC2, 0x00, 0xCB, 0x77, 0x39, 0xC6, 0xA8, 0xCB, 0xBB, 0xB6, 0xB5, 0xA1, 0x6D, 0x2A, 0x69, 0x4A, 
+0xDD, 0xBB, 0x37, 0xD2, 0xBD, 0x75, 0xD4, 0x34, 0xEC, 0xD7, 0x96, 0xDD, 0x34, 0xFA, 0xE3, 0xFC, 
+0x19, 0x5D, 0x0A, 0xB9, 0x6A, 0x2A, 0xB1, 0x3E, 0x1E, 0x91, 0x43, 0x3C, 0x18, 0xD4, 0xBC, 0x79, 
+0x34, 0x22, 0xFD, 0x07, 0xB6, 0xCA, 0x38, 0x03, 0xD9, 0x42, 0xEB, 0x56, 0x23, 0x78, 0x42, 0x06, 
+0xFB, 0xE4, 0xDE, 0xAD, 0xF4, 0x07, 0x19, 0xA2, 0xA2, 0xAC, 0x76, 0xA9, 0x3D, 0xBE, 0xCB, 0xBA, 
+0xD6, 0x0D, 0xE8, 0x81, 0x33, 0xA0, 0xAB, 0xC9, 0x0B, 0x4D, 0xB4, 0x1E, 0x1C, 0x90, 0x21, 0xB9, 
+0xDF, 0x6B, 0x96, 0x17, 0x6B, 0xF4, 0xB9, 0x38, 0xD6, 0x0D, 0x5D, 0x1D, 0x8C, 0xAF, 0xD0, 0x2D, 
+0xD4, 0xD1, 0xA5, 0xAB, 0xE4, 0xCC, 0xDC, 0x12, 0x81, 0x47, 0x5B, 0x37, 0x43, 0xDD, 0x43, 0xB4, 
+0x26, 0x7B, 0x70, 0x3D, 0x2A, 0x7A, 0xE5, 0x0F, 0x56, 0x62, 0xEA, 0x54, 0x09, 0xFF, 0x96, 0x0C, 
+0x64, 0x64, 0xEF, 0x5A, 0xA4, 0x92, 0x07, 0x8D, 0x20, 0xE6, 0x44, 0x0A, 0xC5, 0xD3, 0x72, 0x52, 
+0x42, 0x2D, 0x84, 0xB3, 0xC2, 0xF6, 0xB3, 0x89, 0xD5, 0x0F, 0x3A, 0xC3, 0xC3, 0x22, 0xE0, 0xB0, 
+0x47, 0xEE, 0x59, 0x68, 0xBF, 0x25, 0x7B, 0x07, 0xEB, 0xC4, 0xA1, 0xD7, 0xC8, 0xB4, 0x06, 0xBC, 
+0x55, 0x96, 0xF4, 0x0F, 0xA4, 0x5F, 0xE8, 0x55, 0x76, 0xA9, 0x12, 0x4D, 0xA8, 0x20, 0x29, 0xFC, 
+0xD0, 0x49, 0x75, 0x6E, 0xEF, 0x36, 0xE8, 0x86, 0xCE, 0x88, 0xEC, 0x55, 0x24, 0xA1, 0x3C, 0xC8, 
+0xB6, 0x01, 0xFE, 0xDE, 0x88, 0x3C, 0x50, 0x5E, 0x08, 0x07, 0x39, 0xDE, 0x99, 0xB0, 0x1D, 0x0A, 
+0x54, 0xBF, 0x7B, 0x52, 0x69, 0x27, 0x90, 0xDD, 0x80, 0x77, 0xB2, 0x25, 0x46, 0xED, 0x36, 0xAB, 
+0x30, 0x23, 0x34, 0xBD, 0x60, 0x95, 0x2C, 0x3A, 0xA7, 0x0A, 0xAF, 0x46, 0x52, 0x11, 0x92, 0xB2, 
+0xD4, 0x51, 0x6D, 0x1E, 0x87, 0x85, 0x9E, 0x9E, 0xC5, 0x9D, 0x51, 0x6F, 0xCF, 0xC1, 0xB5, 0x11, 
+0xA9, 0x27, 0xD3, 0x46, 0x39, 0xD4, 0x33, 0x66, 0xBD, 0xFE, 0xC0, 0x9E, 0xFA, 0xD6, 0x69, 0xC9, 
+0xD6, 0xCD, 0xA7, 0x3A, 0xA9, 0xCF, 0x54, 0xE2, 0x9A, 0x74, 0x8E, 0xAC, 0x50, 0xF0, 0xC0, 0xF3, 
+0x7F, 0xC7, 0xD8, 0x22, 0x47, 0x9F, 0x21, 0x46, 0x77, 0xB8, 0x96, 0x61, 0xD3, 0x04, 0x70, 0x03, 
+0xC7, 0xF4, 0x83, 0xB3, 0x04, 0x4A, 0xEF, 0x11, 0x79, 0x36, 0x77, 0x0E, 0x11, 0x5E, 0x09, 0x51, 
+0xAA, 0xB8, 0xDF, 0xD3, 0xA9, 0xD5, 0x24, 0x8F, 0xE7, 0x05, 0x9C, 0x88, 0x1F, 0xE1, 0x37, 0x77, 
+0xB5, 0x50, 0xF3, 0x0A, 0xFD, 0xE6, 0x17, 0x5A, 0x92, 0x72, 0x70, 0xB8, 0xD6, 0x1D, 0x55, 0xF5, 
+0x20, 0x1D, 0x79, 0x37, 0x25, 0x24, 0x07, 0xB5, 0xE6, 0x4C, 0xCC, 0xB2, 0x68, 0x48, 0xBC, 0x77, 
+0x6F, 0x4F, 0xCF, 0xEC, 0xBC, 0xE6, 0x6B, 0xE2, 0x1D, 0xCB, 0x8B, 0xBE, 0x3A, 0x67, 0xCB, 0x05, 
+0xAB, 0xE6, 0x07, 0x41, 0xD8, 0x8C, 0xB9, 0xE6, 0x74, 0x48, 0x30, 0x70, 0x31, 0xC7, 0x93, 0x69, 
+0xE2, 0xC9, 0xD2, 0xF0, 0xAD, 0x55, 0x4D, 0x1B, 0x2A, 0x23, 0x6E, 0xEA, 0xE1, 0x36, 0x2A, 0x7B, 
+0x0F, 0xF3, 0x8C, 0x71, 0x02, 0x06, 0xA9, 0x81, 0x50, 0xC2, 0x44, 0xE4, 0xC0, 0xA9, 0x8F, 0x9F, 
+0xDA, 0xDD, 0x49, 0x9C, 0x08, 0xC6, 0x7D, 0xCC, 0x0F, 0xBA, 0xC3, 0x21, 0xF5, 0x48, 0x0E, 0x72, 
+0x59, 0xCA, 0xE4, 0x93, 0x3A, 0xF1, 0x78, 0xFA, 0x24, 0x65, 0xC5, 0xA4, 0x05, 0xE5, 0x70, 0xD3, 
+0x23, 0x67, 0x7F, 0xC4, 0xA0, 0x2F, 0xE0, 0x95, 0x2C, 0x0D, 0xD1, 0x8A, 0xA0, 0xDB, 0x6A, 0x97, 
+0xA8, 0x3C, 0x35, 0x72, 0x21, 0x48, 0x5E, 0x84, 0x21, 0xCB, 0x73, 0x88, 0x23, 0x5B, 0xBA, 0x6C, 
+0xAE, 0x44, 0x40, 0x6D, 0x6C, 0x78, 0x19, 0xDF, 0x55, 0x46, 0x1B, 0x95, 0xA9, 0x0A, 0xD7, 0xB5, 
+0x24, 0x85, 0x12, 0x7E, 0x4D, 0xAA, 0x82, 0x05, 0xD4, 0x94, 0xB0, 0x50, 0x66, 0x24, 0x58, 0x80, 
+0xEB, 0xF3, 0x12, 0x2C, 0xC0, 0x86, 0xEC, 0x04, 0x93, 0x02, 0x61, 0xE3, 0x53, 0x89, 0x10, 0xCD, 
+0x31, 0xE5, 0xEB, 0x93, 0x65, 0x54, 0xAC, 0x92, 0x2C, 0x5A, 0xCD, 0x96, 0xD9, 0x10, 0xE7, 0xF4, 
+0xB7, 0xFF, 0xF1, 0x9F, 0x75, 0x57, 0x39, 0x51, 0x4E, 0x95, 0x3D, 0x4C, 0x08, 0x65, 0xB6, 0x92, 
+0xAC, 0x1C, 0x5F, 0x40, 0xF9, 0x8D, 0xC0, 0x1D, 0xB0, 0x70, 0x4B, 0x8E, 0x1E, 0xE3, 0x10, 0xBA, 
+0xB9, 0x6A, 0xFC, 0x57, 0xC3, 0xBC, 0x8E, 0x95, 0x5B, 0x47, 0x03, 0x36, 0x95, 0x9D, 0x71, 0x36, 
+0x51, 0x79, 0xB7, 0x02, 0x2E, 0x8D, 0x16, 0x1F, 0x78, 0x72, 0xD4, 0xA8, 0x65, 0x7E, 0x29, 0xED, 
+0x61, 0xAA, 0x21, 0x23, 0xBC, 0xC4, 0x0F, 0x52, 0x9B, 0xE0, 0xAE, 0x3E, 0xAF, 0x42, 0xFD, 0x1B, 
+0x7A, 0x81, 0x0E, 0x81, 0x74, 0x0A, 0xB7, 0x49, 0xFB, 0x58, 0x21, 0x89, 0xD8, 0x45, 0x1B, 0x9A, 
+0x61, 0x90, 0xB8, 0xB9, 0xFF, 0xDB, 0x68, 0xC6, 0xAF, 0xA0, 0x01, 0x10, 0xAC, 0xAA, 0xBE, 0x82, 
+0x74, 0x77, 0x7B, 0xAC, 0xCF, 0x4F, 0xDF, 0xED, 0x0D, 0xEA, 0x68, 0x5B, 0xA9, 0x04, 0x63, 0x3F, 
+0xC6, 0x62, 0x76, 0x66, 0xF6, 0xAA, 0x7C, 0x07, 0xE8, 0xFF, 0x02, 0xD9, 0xF5, 0x7E, 0x94, 0xD8, 
+0xA4, 0x00, 0x00, 0x00
+};
+
+const char script_js_br[] PROGMEM = {
+0x1B, 0xD7, 0xA4, 0x20, 0xBC, 0x0C, 0x70, 0x72, 0x4B, 0xE5, 0x80, 0x23, 0xDD, 0xCC, 0x11, 0x7B, 
+0xF4, 0xD2, 0x86, 0x12, 0xA2, 0x5D, 0xF4, 0x39, 0xF2, 0xAB, 0xD5, 0x6B, 0x6C, 0x35, 0x66, 0x84, 
+0x24, 0xB3, 0x0D, 0xC2, 0x06, 0xF9, 0xEE, 0x5E, 0x55, 0xFD, 0x9D, 0xCB, 0x74, 0x96, 0x5F, 0x1E, 
+0x80, 0x17, 0x80, 0x2E, 0x1D, 0xA9, 0x2E, 0xB2, 0x2D, 0x57, 0xA5, 0x54, 0xA5, 0x41, 0xC4, 0x91, 
+0xC6, 0x37, 0x79, 0xE4, 0xC7, 0x41, 0x2D, 0x65, 0xFC, 0x75, 0x5D, 0x3D, 0x6D, 0x1E, 0xA6, 0xE8, 
+0xC9, 0x42, 0x4F, 0x9A, 0xED, 0x81, 0xF4, 0x31, 0xAC, 0x4B, 0x0A, 0xED, 0xF5, 0x75, 0xD3, 0xFA, 
+0x37, 0x4A, 0xB5, 0x43, 0xA9, 0xCB, 0x94, 0x99, 0x22, 0x40, 0x3F, 0x11, 0x4D, 0xBC, 0xD8, 0x97, 
+0xCA, 0x55, 0x59, 0x1F, 0x3D, 0x2F, 0x1B, 0xEB, 0xAF, 0xA4, 0xC3, 0x39, 0x48, 0x0E, 0x89, 0x6E, 
+0x7C, 0x6A, 0xA0, 0x6A, 0x6F, 0x5E, 0x36, 0xD3, 0x7F, 0x3E, 0x2F, 0x23, 0x97, 0xD5, 0xA1, 0xD1, 
+0xB0, 0x2B, 0xE8, 0xB9, 0x85, 0xF4, 0x67, 0x69, 0x2F, 0x57, 0x38, 0xC9, 0x17, 0xD9, 0x9D, 0x92, 
+0xA6, 0x00, 0xD6, 0x9A, 0xE4, 0xD7, 0xA8, 0x98, 0x52, 0x06, 0xC2, 0x0A, 0x33, 0x5C, 0xFD, 0x1B, 
+0x51, 0xA8, 0x7C, 0x53, 0xD5, 0xDC, 0x7F, 0x99, 0xEE, 0xD3, 0x05, 0x30, 0xCC, 0xB1, 0xC9, 0x12, 
+0x7E, 0xCA, 0x34, 0xDA, 0x81, 0x3D, 0xA7, 0xF4, 0x10, 0xF1, 0xFB, 0xF7, 0x57, 0x95, 0x6B, 0x56, 
+0x4F, 0x0F, 0x7B, 0xEB, 0xAE, 0x80, 0x2C, 0x9D, 0xB5, 0xE4, 0x11, 0x0D, 0x18, 0x9E, 0x0C, 0x1B, 
+0x8F, 0xAF, 0x8C, 0x1B, 0x71, 0x43, 0xFD, 0x33, 0x73, 0xF2, 0x28, 0xB3, 0xAA, 0xEB, 0x6C, 0x56, 
+0xD7, 0x40, 0x55, 0xC3, 0x00, 0x76, 0x0F, 0x48, 0xFC, 0x22, 0xDE, 0xFB, 0x3F, 0xB3, 0xB2, 0x66, 
+0xA6, 0x71, 0x91, 0x07, 0x04, 0xCC, 0xA6, 0x07, 0x74, 0x7C, 0x99, 0x46, 0xAB, 0x85, 0xAE, 0x74, 
+0x1B, 0x62, 0x68, 0x14, 0x55, 0xFC, 0xDC, 0x6D, 0x7E, 0x7F, 0xD8, 0xFC, 0x57, 0x37, 0xDD, 0xA1, 
+0x73, 0xFF, 0xB0, 0x0D, 0x21, 0x04, 0x48, 0x80, 0x72, 0xD9, 0xED, 0x50, 0x26, 0xF0, 0xD7, 0xF9, 
+0xA3, 0x16, 0xB1, 0x58, 0x0A, 0x07, 0x3A, 0xDE, 0x11, 0x74, 0xF8, 0x48, 0xB2, 0xB7, 0x50, 0x96, 
+0x8D, 0x4C, 0xE0, 0x48, 0x07, 0xC2, 0xEC, 0xD4, 0xFC, 0x00, 0xEE, 0x31, 0x37, 0xA4, 0x95, 0x10, 
+0x0E, 0x99, 0x49, 0x83, 0x8B, 0x0C, 0x4F, 0x56, 0xF8, 0xE5, 0x44, 0xDC, 0x8B, 0xC0, 0xB7, 0xC7, 
+0x6C, 0xD9, 0x45, 0x13, 0x89, 0xDB, 0xF8, 0x66, 0x8A, 0x8D, 0xB6, 0x02, 0x40, 0xA9, 0xFB, 0xFA, 
+0xB9, 0x71, 0x96, 0x20, 0x2D, 0x59, 0xAE, 0xAF, 0xC4, 0x76, 0x4B, 0x8C, 0x9F, 0xCB, 0x3F, 0xB4, 
+0xC3, 0x33, 0x25, 0x8E, 0x3E, 0x8B, 0xE4, 0xC1, 0xAB, 0x4B, 0xBB, 0x3E, 0x71, 0xE0, 0x6B, 0xC4, 
+0xB6, 0x95, 0xE2, 0x7C, 0xC4, 0xC7, 0x88, 0xE8, 0x79, 0x05, 0x6F, 0xCE, 0xF7, 0x93, 0xAB, 0x48, 
+0x56, 0x2C, 0x28, 0x81, 0xC9, 0x3C, 0x05, 0x4C, 0xED, 0x12, 0x33, 0xDC, 0xBB, 0x53, 0x52, 0x15, 
+0xF0, 0xF4, 0xB9, 0xE8, 0x4B, 0x3C, 0x19, 0x55, 0x16, 0xD8, 0xC2, 0x77, 0x96, 0x32, 0x9E, 0x24, 
+0xB0, 0x1D, 0x74, 0x71, 0x31, 0x5D, 0x50, 0x68, 0xF8, 0xF0, 0x32, 0x3B, 0x86, 0x4C, 0xF9, 0x98, 
+0x24, 0xDB, 0x27, 0x70, 0xE0, 0xEA, 0x97, 0x4B, 0xF7, 0x68, 0xE7, 0xE3, 0x32, 0x50, 0xB5, 0x27, 
+0xEC, 0x80, 0xE1, 0x09, 0xA1, 0xB2, 0xA4, 0x26, 0x38, 0x09, 0x5B, 0x2C, 0x88, 0x5A, 0x6E, 0xAF, 
+0x63, 0xC1, 0x0C, 0x7E, 0xA1, 0xF8, 0xAA, 0x4C, 0xB8, 0x69, 0xF4, 0xA0, 0x21, 0xD9, 0x1B, 0x18, 
+0xB0, 0xA0, 0xC6, 0xE8, 0x91, 0x78, 0xF2, 0xE2, 0x4F, 0xFB, 0x9C, 0x3F, 0x50, 0x97, 0x6A, 0xB4, 
+0x90, 0x94, 0xB3, 0xA5, 0xB1, 0x02, 0xAE, 0x82, 0x63, 0x53, 0xF4, 0xBB, 0x8B, 0xDF, 0x44, 0xD3, 
+0xA1, 0x87, 0x58, 0x2C, 0xF1, 0x3C, 0xA5, 0xDB, 0xA2, 0x7D, 0xE2, 0xA4, 0x37, 0x32, 0xA6, 0xFD, 
+0x84, 0x86, 0xF8, 0x6B, 0xBE, 0x27, 0x6A, 0xDA, 0xA6, 0xE3, 0xED, 0xB1, 0xB1, 0xA0, 0x64, 0xAE, 
+0x8F, 0x73, 0x05, 0x0F, 0x66, 0x62, 0xEA, 0xB5, 0x02, 0x24, 0x5A, 0x17, 0xE7, 0x8C, 0x31, 0xAF, 
+0xF5, 0xE0, 0x2D, 0xE2, 0x2E, 0x90, 0x41, 0x90, 0xD3, 0x4D, 0x46, 0xD2, 0xE4, 0xB3, 0x6C, 0x52, 
+0x98, 0x97, 0xC2, 0xB4, 0xA1, 0x02, 0xA4, 0xC4, 0x39, 0xDC, 0xA7, 0xD0, 0xC8, 0x73, 0x35, 0xBA, 
+0xE7, 0xBD, 0xC2, 0x36, 0x79, 0x32, 0xA4, 0x1D, 0x9D, 0x89, 0x97, 0x5F, 0x1A, 0x32, 0xC5, 0x18, 
+0x2A, 0x68, 0xA9, 0x43, 0xB9, 0xB0, 0xFA, 0x94, 0x17, 0x85, 0x18, 0x56, 0x51, 0x52, 0x85, 0xD5, 
+0xEF, 0xFE, 0x1D, 0x4D, 0x20, 0x17, 0x53, 0x50, 0xD6, 0xF4, 0x34, 0xB5, 0x21, 0x04, 0xC7, 0x69, 
+0x59, 0xC8, 0xA8, 0x4C, 0xD4, 0x04, 0x16, 0x9D, 0x9F, 0xE1, 0x6C, 0x13, 0x9B, 0xAA, 0x79, 0xA2, 
+0x66, 0x9C, 0x06, 0x51, 0x77, 0xE0, 0x79, 0x7F, 0xA2, 0x04, 0x0E, 0x53, 0x28, 0x5C, 0xA4, 0xD0, 
+0x40, 0x64, 0xBF, 0xDD, 0x7D, 0xCB, 0x8A, 0xE9, 0xF8, 0xF0, 0x6D, 0x02, 0x50, 0x49, 0x7C, 0x88, 
+0xB2, 0xDA, 0xB8, 0x84, 0xE2, 0xDA, 0xFF, 0x7F, 0x58, 0x9F, 0x8C, 0x66, 0x80, 0x00, 0xEF, 0x84, 
+0xCD, 0x55, 0x4D, 0x31, 0xD2, 0x9C, 0x5B, 0x81, 0x47, 0x4D, 0xAB, 0xFC, 0x74, 0x8E, 0xB6, 0xB5, 
+0x80, 0x84, 0x63, 0xBD, 0x87, 0xC4, 0xB9, 0xFE, 0xA7, 0x8A, 0x69, 0xA6, 0x1C, 0x9D, 0xD6, 0x4E, 
+0x79, 0x12, 0x3A, 0x77, 0x7C, 0x0B, 0x7A, 0x06, 0x71, 0x5E, 0xC8, 0xA2, 0x85, 0xA2, 0xF4, 0x07, 
+0x79, 0x8F, 0x2C, 0x5C, 0x05, 0xE7, 0x0A, 0x86, 0x0D, 0xC5, 0xA7, 0x2E, 0x87, 0x79, 0x90, 0xF4, 
+0x03, 0x0E, 0xE0, 0x9F, 0x61, 0x35, 0x53, 0xB9, 0x0E, 0xEE, 0x18, 0xB9, 0x3C, 0x8F, 0xA7, 0x6E, 
+0xB3, 0x32, 0xBF, 0x2E, 0xCD, 0x49, 0xDF, 0x2A, 0x28, 0x1C, 0x22, 0x6B, 0xFB, 0x82, 0x3F, 0xB1, 
+0xE6, 0x8B, 0xF2, 0x35, 0x36, 0xAA, 0x97, 0x8D, 0xA9, 0x5A, 0xB9, 0xD4, 0x1E, 0x16, 0xAA, 0x5C, 
+0x67, 0xBF, 0x62, 0x64, 0x2A, 0x6E, 0x5E, 0x69, 0xB7, 0x85, 0xDC, 0x48, 0x33, 0xAB, 0x17, 0x08, 
+0x69, 0x01, 0x7D, 0x01, 0x50, 0x33, 0x00, 0xE1, 0x6F, 0x0B, 0x95, 0xCD, 0x43, 0x51, 0x8B, 0xB8, 
+0x54, 0xEE, 0xA4, 0xC6, 0xB7, 0xBC, 0x8F, 0xEE, 0xBE, 0x60, 0x84, 0xF1, 0x18, 0xB1, 0x54, 0xD3, 
+0x8C, 0x23, 0x40, 0x68, 0x97, 0x84, 0x46, 0x84, 0xEC, 0xE0, 0xB1, 0x64, 0x85, 0x4B, 0x7A, 0x2F, 
+0x35, 0x53, 0xFC, 0x1D, 0xD7, 0x82, 0x90, 0x61, 0x05, 0xE6, 0x27, 0x79, 0xB5, 0x77, 0xEC, 0x58, 
+0x61, 0x1C, 0xCE, 0x5C, 0x6B, 0x52, 0x2B, 0x6E, 0x16, 0x96, 0x14, 0xD9, 0x1D, 0xA9, 0xAA, 0x8C, 
+0x3B, 0x3C, 0x3A, 0xA4, 0x65, 0x3C, 0x26, 0x5A, 0xD9, 0xC5, 0x3A, 0x1F, 0xC9, 0xA4, 0x73, 0xE4, 
+0x99, 0xF4, 0x6E, 0xB7, 0xD7, 0x92, 0x9C, 0xA3, 0xBB, 0x57, 0x49, 0xD8, 0xB0, 0xC6, 0x95, 0x4B, 
+0x3A, 0xAF, 0xF0, 0xDE, 0x1A, 0x40, 0x91, 0xA8, 0x4E, 0xA3, 0x2D, 0x3A, 0x54, 0x9B, 0x7C, 0x20, 
+0x06, 0x7F, 0x2C, 0x35, 0x14, 0x80, 0xFB, 0x16, 0x36, 0x99, 0x58, 0x22, 0x71, 0xB4, 0xEC, 0xA4, 
+0xD0, 0x83, 0x4D, 0x52, 0x8E, 0x98, 0x33, 0xA7, 0xAA, 0xD8, 0x06, 0xC9, 0x48, 0x4D, 0x42, 0xBD, 
+0x38, 0xCF, 0xF3, 0x9E, 0x6A, 0x82, 0x68, 0xF7, 0xCD, 0x00, 0xA9, 0xB0, 0xCC, 0x03, 0x46, 0xE2, 
+0x90, 0xB3, 0x7D, 0xEE, 0x70, 0xAC, 0xA9, 0x05, 0xF4, 0x07, 0xE3, 0xE9, 0xC9, 0x3F, 0x5A, 0x9E, 
+0xE7, 0x64, 0x95, 0xA9, 0xBD, 0xC0, 0xE4, 0x4E, 0x27, 0xCD, 0x15, 0x69, 0xE1, 0x0B, 0xC5, 0x88, 
+0x30, 0x1D, 0xD6, 0x24, 0x2F, 0x8E, 0x0D, 0xE1, 0x72, 0x89, 0xB5, 0x83, 0x92, 0x44, 0x24, 0x52, 
+0xAC, 0x22, 0x20, 0x44, 0x5A, 0x8C, 0xEC, 0x62, 0x54, 0x68, 0x70, 0x1E, 0x1C, 0x95, 0xD9, 0xEC, 
+0x02, 0xA3, 0x35, 0x6A, 0xBE, 0x73, 0x89, 0xF5, 0xBE, 0x0C, 0x5D, 0x7E, 0x91, 0xE4, 0xEE, 0x64, 
+0x12, 0x24, 0xA2, 0x88, 0xD0, 0xC4, 0x6A, 0xD3, 0x47, 0x23, 0xB8, 0x24, 0x90, 0x25, 0x0E, 0xB6, 
+0xC3, 0x2D, 0x02, 0xB7, 0x31, 0x90, 0xD7, 0x16, 0xAE, 0x8C, 0x21, 0x65, 0x8E, 0xB9, 0xC2, 0x25, 
+0x34, 0x97, 0x92, 0xC5, 0x83, 0x27, 0xF2, 0x09, 0xAA, 0xE3, 0x7E, 0x81, 0x0E, 0x3A, 0x01, 0xCB, 
+0xE3, 0x03, 0x78, 0x61, 0xD2, 0xF9, 0x39, 0x33, 0xEE, 0x24, 0x24, 0x25, 0x72, 0x63, 0xC0, 0xDD, 
+0x26, 0x2D, 0x61, 0x9E, 0x41, 0x91, 0x46, 0x28, 0x6E, 0x64, 0x16, 0x72, 0xBD, 0x7C, 0x12, 0x80, 
+0x53, 0x83, 0x8A, 0xA1, 0x10, 0x77, 0x39, 0x22, 0x89, 0xC8, 0x7D, 0xA9, 0x02, 0x85, 0xBB, 0x13, 
+0xA7, 0x55, 0xD4, 0x86, 0x8D, 0xEC, 0x5F, 0xD3, 0x9C, 0x92, 0x9F, 0x99, 0x1F, 0x70, 0xDF, 0xE8, 
+0x47, 0xC4, 0x22, 0xBA, 0x98, 0xB5, 0x4B, 0x89, 0xB3, 0xBC, 0x0E, 0xCE, 0xA5, 0xCF, 0x14, 0x78, 
+0xE5, 0x96, 0xF8, 0x4D, 0x8B, 0xA9, 0xC5, 0x6C, 0x13, 0x4E, 0x9A, 0xE5, 0xC6, 0xFA, 0xFA, 0x93, 
+0xA3, 0x99, 0x1A, 0x63, 0xF4, 0xAF, 0xD5, 0xFB, 0x39, 0x93, 0x70, 0xC2, 0xFB, 0x6B, 0x01, 0x23, 
+0xC5, 0x14, 0x76, 0x34, 0x83, 0xFB, 0x74, 0x1B, 0x25, 0xE4, 0x98, 0x24, 0xDB, 0xE8, 0x38, 0x24, 
+0x19, 0x07, 0xF3, 0x2D, 0x79, 0xBC, 0x4F, 0x4A, 0x57, 0x53, 0x99, 0x69, 0x5F, 0xCC, 0x26, 0x19, 
+0x67, 0x29, 0x3B, 0xF9, 0x7D, 0x9E, 0x78, 0x59, 0x09, 0x01, 0x2F, 0xA3, 0xB3, 0xE1, 0x4A, 0xFA, 
+0x8A, 0x85, 0x3F, 0x09, 0x60, 0x61, 0xFD, 0x1A, 0x3C, 0x3A, 0x65, 0x4E, 0xA3, 0x71, 0xC9, 0x82, 
+0x2E, 0x0F, 0x3C, 0x7F, 0xFB, 0x8D, 0x5C, 0x05, 0xC2, 0x24, 0x4C, 0x1A, 0x90, 0x7C, 0xBE, 0xBC, 
+0x4B, 0xF6, 0xBE, 0x11, 0xF0, 0x22, 0xEE, 0xB1, 0xBD, 0xC5, 0x37, 0x63, 0x1E, 0x1A, 0xC1, 0xF4, 
+0x32, 0x62, 0xA3, 0x30, 0x8A, 0xC1, 0xE9, 0x7A, 0xE4, 0x29, 0x03, 0x05, 0xCD, 0x86, 0xFC, 0xF3, 
+0xFC, 0xEA, 0x2C, 0x71, 0xFB, 0x3B, 0xD9, 0xC7, 0xCB, 0x75, 0x03, 0xB9, 0x2E, 0xF3, 0x79, 0x0F, 
+0x35, 0x10, 0xF4, 0xD7, 0x57, 0x31, 0x75, 0x43, 0x8A, 0xF2, 0x24, 0x12, 0x6E, 0xFD, 0xFF, 0xB9, 
+0x09, 0x89, 0xE9, 0x4F, 0x7C, 0xFA, 0xBD, 0xCC, 0x7B, 0xD3, 0x48, 0x78, 0x8E, 0x83, 0x4C, 0x61, 
+0x02, 0xC9, 0xAF, 0x01, 0x4A, 0xF1, 0xCF, 0x17, 0x99, 0x28, 0x76, 0xC5, 0x50, 0x27, 0xFA, 0xCA, 
+0x86, 0x3F, 0xD3, 0x73, 0x1C, 0xC8, 0x3F, 0x08, 0x76, 0xEB, 0x27, 0x6B, 0x7E, 0xC5, 0x6E, 0xF3, 
+0xDF, 0x83, 0xF1, 0x71, 0x8B, 0x4A, 0x85, 0xD8, 0xF0, 0xD4, 0x98, 0x14, 0x15, 0x6E, 0xFF, 0x29, 
+0x97, 0x7B, 0xFE, 0x96, 0xEF, 0xBB, 0x42, 0xEE, 0xA8, 0x5B, 0xB5, 0xDB, 0x30, 0x2C, 0x70, 0xBD, 
+0x6E, 0x9B, 0xD6, 0xCF, 0xAF, 0x6D, 0xFD, 0x65, 0x7F, 0x53, 0xFD, 0x0D, 0x0F, 0xF0, 0x75, 0xB8, 
+0xA5, 0x3D, 0xDF, 0x70, 0xEA, 0x67, 0xFD, 0xE1, 0xD0, 0xE8, 0x1F, 0x7C, 0x84, 0xEF, 0x83, 0xA9, 
+0xCB, 0xF8, 0xE0, 0xA9, 0x17, 0x22, 0x43, 0x62, 0x54, 0x4C, 0x37, 0x4C, 0xBF, 0x26, 0x7F, 0xDF, 
+0xB4, 0x7E, 0x3E, 0xB2, 0x7E, 0xEE, 0xEF, 0x78, 0xD2, 0x18, 0xAF, 0x74, 0xCE, 0x20, 0x57, 0x1A, 
+0x8E, 0x2F, 0x66, 0x4D, 0xFE, 0xD9, 0x1C, 0x48, 0x11, 0xFC, 0x7A, 0x5F, 0x77, 0x39, 0x4E, 0x35, 
+0x7D, 0x11, 0x8B, 0x9B, 0x0C, 0xC9, 0x48, 0x69, 0xC2, 0x34, 0x45, 0xA7, 0xA9, 0xD4, 0x24, 0x8E, 
+0x0E, 0xA9, 0xCE, 0x1C, 0xDA, 0xFE, 0x4F, 0x49, 0xBC, 0x02, 0x83, 0xB9, 0x38, 0x59, 0x2C, 0x6A, 
+0xE9, 0x53, 0x2B, 0x43, 0xFB, 0x59, 0xDE, 0xEB, 0xEA, 0xB1, 0xB6, 0x97, 0xB2, 0x11, 0xB7, 0x13, 
+0xBF, 0x3A, 0x84, 0x53, 0x5B, 0x6D, 0xEF, 0xF3, 0x57, 0x0F, 0xD2, 0xA1, 0x8D, 0x5D, 0x9A, 0xF6, 
+0x19, 0xEA, 0x7B, 0x78, 0xB3, 0x34, 0x91, 0xBB, 0x34, 0x65, 0x47, 0x2B, 0xE8, 0x86, 0x4C, 0xB4, 
+0x6D, 0xE0, 0xA4, 0xCF, 0xB6, 0x82, 0xC6, 0x0E, 0x74, 0xE9, 0x9D, 0x43, 0x1A, 0x50, 0x98, 0x99, 
+0x25, 0x49, 0xDF, 0x42, 0x2A, 0xF8, 0xCA, 0x62, 0x1C, 0xBF, 0xCB, 0x5E, 0xE8, 0x16, 0xFD, 0xC5, 
+0x68, 0xA1, 0x06, 0x62, 0x4A, 0xB5, 0x8E, 0x36, 0x06, 0xE1, 0xC8, 0x28, 0x7E, 0xC7, 0xD8, 0x45, 
+0x80, 0x6A, 0x44, 0xE2, 0x2D, 0x88, 0x7B, 0xE8, 0xE5, 0x8D, 0xB1, 0x02, 0xD1, 0x11, 0xD7, 0xBE, 
+0xD1, 0x93, 0x88, 0x53, 0x6D, 0x0D, 0xA7, 0x6D, 0xCC, 0x52, 0xE0, 0x69, 0x22, 0x70, 0xEE, 0x99, 
+0xCB, 0x36, 0x3C, 0xBE, 0x95, 0x00, 0x66, 0xA9, 0xDD, 0x34, 0xE5, 0xD1, 0x9E, 0x60, 0x81, 0x57, 
+0x28, 0x4A, 0xA0, 0xF2, 0x52, 0x0C, 0x6C, 0x53, 0x3B, 0xE5, 0x93, 0xC8, 0x9B, 0xF5, 0xDB, 0x4A, 
+0xD5, 0x73, 0x94, 0x82, 0x1A, 0x79, 0x68, 0xF9, 0x7F, 0x03, 0xD0, 0xAC, 0x31, 0xC7, 0xAD, 0xFB, 
+0x97, 0xA4, 0x75, 0xBE, 0x16, 0xD9, 0xB0, 0xE0, 0xC3, 0x33, 0xFD, 0xB2, 0x2F, 0x8D, 0x0F, 0x8F, 
+0xE4, 0xA5, 0x9B, 0x02, 0x1B, 0xF6, 0x12, 0x59, 0x7C, 0x79, 0x68, 0x09, 0x5E, 0x4A, 0x9F, 0xFC, 
+0x31, 0x67, 0x74, 0x96, 0x19, 0xF6, 0xB2, 0x7B, 0x76, 0xF9, 0x2A, 0x4F, 0x59, 0x8B, 0x03, 0x45, 
+0xAE, 0x2F, 0x60, 0x81, 0xBC, 0x6B, 0xCF, 0xCE, 0x9C, 0x92, 0x03, 0x78, 0x21, 0x32, 0xA7, 0x34, 
+0x9E, 0x3E, 0x7A, 0x47, 0xDE, 0xFC, 0x48, 0xEA, 0x37, 0x75, 0x94, 0xDB, 0x8D, 0xAB, 0xA1, 0xAA, 
+0xBB, 0xE3, 0x8A, 0x8F, 0x2E, 0xC4, 0x8D, 0xB3, 0x18, 0x2B, 0xEF, 0xE3, 0xD3, 0xB3, 0x1C, 0x73, 
+0x04, 0x3C, 0xFA, 0x19, 0x2E, 0x45, 0x9F, 0x61, 0xC7, 0xD9, 0x71, 0xFB, 0xFB, 0x11, 0x76, 0x53, 
+0xDB, 0xA0, 0x93, 0xBB, 0xF3, 0x4E, 0xAB, 0xA2, 0xD8, 0x43, 0xF2, 0x17, 0x71, 0x8F, 0xDE, 0xE4, 
+0x41, 0xDF, 0xDB, 0xB3, 0x0F, 0x9E, 0x01, 0xFF, 0x6C, 0x03, 0xD2, 0x3C, 0x9E, 0x35, 0xD7, 0xED, 
+0x18, 0x56, 0x38, 0x23, 0x16, 0x49, 0x70, 0x78, 0x49, 0xAC, 0x20, 0xD4, 0x06, 0x42, 0x3A, 0x06, 
+0xBA, 0x83, 0x37, 0x77, 0x21, 0x8D, 0x12, 0xA4, 0xF4, 0x06, 0x37, 0x20, 0x8F, 0xC3, 0x4D, 0x37, 
+0xEB, 0x2E, 0x18, 0xDD, 0x45, 0xA9, 0xAD, 0x89, 0x55, 0xC4, 0x9B, 0x7F, 0x44, 0x4B, 0xD7, 0xB7, 
+0x38, 0x11, 0x74, 0xA3, 0xC9, 0xD4, 0x7D, 0x57, 0xB7, 0x87, 0x64, 0x09, 0xDB, 0x04, 0xAA, 0xA1, 
+0xA4, 0xF8, 0x1D, 0x14, 0xB3, 0x04, 0x93, 0x1E, 0x0B, 0x43, 0x4E, 0x58, 0xA2, 0xCE, 0x3B, 0xB3, 
+0x67, 0x8A, 0x8F, 0x3C, 0x06, 0xAD, 0x65, 0x78, 0xD3, 0x63, 0xA3, 0xFF, 0xB2, 0xAF, 0x83, 0xA3, 
+0x8B, 0xFE, 0xD7, 0xE7, 0xA8, 0x83, 0xE0, 0xB7, 0x93, 0xB2, 0xA3, 0xBB, 0xB4, 0x34, 0xC8, 0x4B, 
+0x34, 0xE9, 0xEF, 0x37, 0xDC, 0xE7, 0x11, 0xC1, 0x8A, 0xD2, 0x61, 0x70, 0x2E, 0x02, 0x61, 0xBF, 
+0xCF, 0x8D, 0x0B, 0x58, 0x2F, 0xDB, 0xF2, 0xC2, 0x50, 0x3B, 0x4C, 0x3B, 0x73, 0xCE, 0x07, 0xB2, 
+0xD3, 0xDA, 0x5D, 0x87, 0x4C, 0x08, 0xE2, 0x3F, 0x40, 0x68, 0x4C, 0xAF, 0xBA, 0x51, 0xAB, 0x16, 
+0xFA, 0x63, 0x61, 0xB9, 0x7E, 0x71, 0x1B, 0x6B, 0x29, 0x02, 0x0B, 0xBA, 0xBE, 0x3B, 0x08, 0x48, 
+0xA9, 0x2D, 0x43, 0xC7, 0x54, 0x5B, 0xD9, 0x81, 0xE0, 0xD9, 0x77, 0xF1, 0x04, 0xE2, 0x40, 0xA2, 
+0xF8, 0x9B, 0x29, 0x87, 0x60, 0x52, 0x92, 0xD3, 0xC8, 0x82, 0x4B, 0x2F, 0x19, 0x02, 0xFB, 0xEF, 
+0x3F, 0xC4, 0xD9, 0xD8, 0x49, 0x93, 0x25, 0xA8, 0x86, 0x20, 0x13, 0xA8, 0xD5, 0x6E, 0xB3, 0xF7, 
+0x89, 0x4E, 0x58, 0x4A, 0xF1, 0xC7, 0xF6, 0x34, 0x9A, 0x57, 0x18, 0x6C, 0xF9, 0xFC, 0xFE, 0x7C, 
+0xFA, 0xDD, 0xC1, 0x7D, 0x93, 0x7D, 0x69, 0x36, 0x7A, 0x5F, 0xA8, 0x7E, 0x92, 0xD6, 0x1A, 0xC3, 
+0x9E, 0x60, 0xB2, 0xE5, 0x7A, 0x0F, 0xF5, 0x6E, 0x30, 0x6A, 0xC7, 0xE7, 0xD2, 0x6E, 0xF6, 0xBE, 
+0x10, 0xAF, 0x12, 0x5C, 0x4C, 0x72, 0x79, 0xF0, 0xF9, 0x21, 0x72, 0xD7, 0xE7, 0x5A, 0xC8, 0x12, 
+0xCE, 0x48, 0x5F, 0x3F, 0x49, 0x28, 0xEC, 0x49, 0xC3, 0x8E, 0x08, 0xD4, 0x42, 0x78, 0x9A, 0xAD, 
+0xD3, 0xCF, 0x97, 0x25, 0x63, 0x5A, 0x31, 0xCD, 0x36, 0x8E, 0x6A, 0xC4, 0x8F, 0x47, 0xA6, 0xD5, 
+0x0F, 0x40, 0xCD, 0x08, 0xBF, 0x78, 0xF9, 0xFA, 0x72, 0xEE, 0xAB, 0xDB, 0x87, 0xE7, 0x78, 0x74, 
+0x73, 0x0C, 0x8B, 0x8A, 0x56, 0x2D, 0xB0, 0x1F, 0x23, 0xDE, 0x1F, 0x02, 0x35, 0xA5, 0x51, 0x75, 
+0xFD, 0x4C, 0x9B, 0x50, 0x93, 0xE1, 0xD4, 0xCB, 0xC2, 0x67, 0x26, 0x6C, 0x65, 0xAB, 0xD0, 0x9F, 
+0x0B, 0xD7, 0xDF, 0x51, 0x14, 0x55, 0x27, 0x52, 0x5A, 0x08, 0x93, 0x11, 0x7A, 0x8D, 0xB1, 0xDC, 
+0xA8, 0x5D, 0x68, 0x4C, 0x8D, 0x93, 0xB8, 0x6A, 0x2B, 0xD5, 0xDA, 0x1B, 0xF6, 0xEC, 0x94, 0xAE, 
+0x2C, 0x13, 0x7E, 0x3E, 0xA7, 0x93, 0x06, 0xBD, 0xF3, 0x1F, 0xDF, 0xC3, 0xE9, 0xB6, 0xEB, 0xC7, 
+0xF6, 0xA8, 0xFA, 0x66, 0xFF, 0x74, 0x52, 0x56, 0xBF, 0x80, 0xAA, 0xEC, 0x13, 0x3D, 0x44, 0x55, 
+0x2E, 0xDF, 0xA3, 0xC4, 0x6D, 0x6F, 0x18, 0x82, 0xF1, 0xCD, 0x7D, 0x25, 0x2D, 0x37, 0xD5, 0x32, 
+0x9F, 0x27, 0x46, 0x58, 0x05, 0x1C, 0x89, 0x30, 0x69, 0xFF, 0x07, 0xA7, 0xA7, 0x48, 0x38, 0xEB, 
+0x21, 0xAD, 0xEF, 0x1F, 0xB8, 0x04, 0x74, 0xDE, 0x64, 0xC1, 0x68, 0x5B, 0x57, 0xF3, 0x0A, 0x66, 
+0x7D, 0xE6, 0x00, 0xA3, 0xC4, 0xFA, 0xF1, 0x34, 0xB8, 0x73, 0xB0, 0x5A, 0xAD, 0x32, 0x79, 0x93, 
+0x27, 0x21, 0xBC, 0x00, 0xF3, 0x82, 0x5E, 0x58, 0x3D, 0x9B, 0x0B, 0x8C, 0x45, 0xC2, 0x9A, 0xB2, 
+0x9A, 0xC2, 0xF6, 0x44, 0xF1, 0x5F, 0xB9, 0x6E, 0xCD, 0x85, 0xAE, 0xDE, 0x50, 0xC1, 0xA5, 0x2F, 
+0x3B, 0xD6, 0x67, 0x2C, 0x92, 0x67, 0xF7, 0x0D, 0x3F, 0x8F, 0x6C, 0xDB, 0xAA, 0x1E, 0x9E, 0xFB, 
+0x95, 0xDC, 0xD6, 0xBE, 0xB3, 0x8F, 0x23, 0x93, 0xB6, 0x88, 0x95, 0x32, 0xCF, 0x92, 0x4B, 0xF5, 
+0xA6, 0xE8, 0x45, 0x5B, 0x95, 0x39, 0x50, 0x87, 0xA8, 0xE3, 0xCB, 0xF9, 0x37, 0xCF, 0x87, 0x06, 
+0x97, 0xD9, 0x29, 0x5B, 0x51, 0x05, 0x0B, 0xAF, 0xDD, 0xE6, 0x5F, 0xA9, 0x65, 0x26, 0x1F, 0x86, 
+0x81, 0x66, 0x67, 0xEF, 0x9E, 0xB8, 0x37, 0x39, 0x36, 0xC3, 0xB8, 0xD4, 0x3A, 0xD3, 0xD7, 0x32, 
+0xB2, 0xA2, 0x02, 0xD5, 0x7C, 0x3F, 0x75, 0x25, 0x45, 0xC3, 0x52, 0x4B, 0x4D, 0x6C, 0x58, 0x03, 
+0x8A, 0x97, 0x14, 0x7A, 0x57, 0xD6, 0x4B, 0x5D, 0xAB, 0xD1, 0x38, 0x34, 0xAC, 0x10, 0x34, 0x5D, 
+0x93, 0x51, 0xF7, 0xA3, 0x81, 0xF0, 0x75, 0xD6, 0xA0, 0xBA, 0xFB, 0xA5, 0x27, 0x29, 0x90, 0x8F, 
+0x25, 0x75, 0x2E, 0x3D, 0x6C, 0x39, 0x07, 0xCE, 0x1A, 0x62, 0xFD, 0x28, 0x2B, 0x98, 0x09, 0x22, 
+0xF3, 0x7C, 0x51, 0x29, 0xFF, 0x76, 0xE4, 0x24, 0xD4, 0xCF, 0x03, 0x5B, 0x30, 0xDF, 0x53, 0x48, 
+0x70, 0xB2, 0xB4, 0x6A, 0x58, 0x3C, 0x3F, 0x15, 0x60, 0x76, 0x47, 0x9E, 0x56, 0x35, 0xC4, 0x23, 
+0x6B, 0x83, 0x37, 0xCE, 0xFB, 0xC5, 0x5E, 0xE6, 0x58, 0x71, 0x3C, 0x84, 0xBA, 0x1D, 0x60, 0xFD, 
+0x4E, 0xC4, 0x87, 0x32, 0x0A, 0x83, 0xD4, 0x95, 0x1A, 0xA1, 0x4F, 0x17, 0xE1, 0xEE, 0xA8, 0xEF, 
+0xF2, 0xE5, 0x87, 0x8B, 0x8D, 0x1A, 0x8A, 0xD9, 0x59, 0x9C, 0xFA, 0x2E, 0x90, 0x3A, 0xB0, 0xBF, 
+0xCF, 0x14, 0x6E, 0x8A, 0x9C, 0x71, 0x4C, 0xC8, 0x9F, 0x07, 0xE8, 0x18, 0xAF, 0x27, 0xE9, 0x45, 
+0xB8, 0x98, 0xC4, 0x38, 0xB8, 0xD8, 0xCB, 0xF2, 0x59, 0x80, 0x6E, 0x0F, 0xD3, 0x53, 0x02, 0xD5, 
+0xBD, 0xAA, 0x69, 0x07, 0x5D, 0x95, 0x27, 0xA8, 0x22, 0x36, 0x2A, 0xDF, 0x1D, 0x60, 0xE4, 0xBD, 
+0x74, 0xF3, 0xBD, 0xD4, 0x83, 0xE9, 0x21, 0x52, 0x12, 0x27, 0x3A, 0x2B, 0x12, 0xFD, 0xC2, 0x7E, 
+0x4F, 0xD0, 0x6C, 0x91, 0x98, 0xEE, 0x13, 0xDD, 0xC5, 0x72, 0xCA, 0x7E, 0xDC, 0xC5, 0x1A, 0x5D, 
+0x7F, 0xFC, 0xA1, 0x3A, 0x87, 0x4B, 0x87, 0x56, 0xE9, 0xB3, 0x1F, 0x52, 0x38, 0x8F, 0xEC, 0xEF, 
+0x32, 0xD5, 0xC3, 0x9D, 0xB7, 0xB5, 0x3D, 0x87, 0x2C, 0xC3, 0x39, 0x83, 0x11, 0xC0, 0x37, 0x2B, 
+0xD1, 0x13, 0x7D, 0x20, 0x93, 0x13, 0x47, 0x8D, 0xA0, 0x1F, 0x17, 0xEE, 0x0F, 0xF5, 0xED, 0xA7, 
+0x1D, 0xD0, 0xE3, 0x33, 0x8D, 0x38, 0x45, 0xD1, 0x0F, 0x03, 0xD6, 0xC1, 0x11, 0xB6, 0x1E, 0xCB, 
+0xCA, 0x00, 0x90, 0x68, 0x1C, 0x89, 0x8A, 0xDF, 0xE3, 0x71, 0x63, 0x8B, 0x8A, 0xA0, 0x3B, 0x07, 
+0x5E, 0xD4, 0xF6, 0x99, 0x48, 0x5C, 0x18, 0x9E, 0xBD, 0x21, 0x2F, 0x08, 0xF8, 0x7F, 0x95, 0xD5, 
+0x15, 0x56, 0x6B, 0x94, 0xF8, 0x6F, 0x12, 0xD5, 0xF1, 0x7F, 0xBD, 0xCE, 0xF7, 0x8F, 0xA4, 0x1C, 
+0xB4, 0x6C, 0x38, 0x96, 0xB5, 0x1F, 0xEC, 0x62, 0x82, 0xA8, 0x1D, 0xCC, 0x23, 0x7E, 0x9B, 0x95, 
+0xBA, 0x0C, 0xF4, 0x9B, 0xC7, 0xDE, 0x36, 0xF9, 0xCA, 0x9A, 0xB8, 0xE0, 0x36, 0xF0, 0xEF, 0x5B, 
+0xB2, 0xF2, 0x2D, 0xCA, 0x83, 0xED, 0xA1, 0xD4, 0xAE, 0x46, 0x64, 0x92, 0xFC, 0xE9, 0x18, 0x8E, 
+0x4A, 0xEB, 0xC4, 0xE8, 0x95, 0x99, 0xD9, 0xBF, 0x7A, 0x86, 0x0F, 0xCC, 0xC1, 0xF6, 0xD7, 0xEC, 
+0xF3, 0x45, 0x5E, 0x57, 0x2F, 0x52, 0xD3, 0xD5, 0x34, 0x5C, 0x31, 0x17, 0x7B, 0xCC, 0xE2, 0xBD, 
+0xAE, 0xCD, 0x96, 0x3F, 0x98, 0xB3, 0x6D, 0x14, 0x2B, 0x52, 0x94, 0xAA, 0xC6, 0x74, 0x2C, 0xD1, 
+0x7D, 0x0B, 0x0B, 0x5F, 0x64, 0x35, 0x5A, 0x5B, 0xED, 0x4D, 0x3D, 0x34, 0x39, 0xB9, 0xF0, 0x38, 
+0x49, 0x99, 0xD6, 0xAB, 0x58, 0x97, 0x7D, 0xAD, 0x93, 0xCD, 0x77, 0x6C, 0x91, 0x22, 0xE6, 0x51, 
+0x4B, 0xCF, 0x1F, 0x57, 0x0E, 0xEA, 0x5E, 0xA3, 0x47, 0x07, 0x8C, 0x48, 0x75, 0xD1, 0x5B, 0xF6, 
+0x2C, 0x59, 0x8C, 0x04, 0xCE, 0xE2, 0x81, 0xD4, 0xD3, 0xD9, 0x7F, 0x00, 0x99, 0x96, 0xAE, 0xC4, 
+0x8A, 0x55, 0xAB, 0xD2, 0x76, 0x4D, 0xD8, 0x47, 0xAD, 0x65, 0x05, 0x83, 0xD3, 0x99, 0x90, 0x5E, 
+0x6E, 0x3A, 0xBC, 0x37, 0x14, 0xA5, 0xBF, 0x71, 0xBF, 0xAE, 0x25, 0xCC, 0xFF, 0xB6, 0x33, 0x33, 
+0xCD, 0x7F, 0x32, 0x5B, 0x3A, 0x1E, 0xE9, 0xE5, 0x6D, 0x57, 0xEF, 0x96, 0xB8, 0x31, 0xD6, 0x7B, 
+0x24, 0xFE, 0x08, 0xD3, 0x30, 0xC5, 0x50, 0x08, 0xAD, 0x93, 0xF6, 0x0B, 0xE5, 0xE5, 0x57, 0xBC, 
+0x89, 0x26, 0xF8, 0x90, 0x16, 0x5F, 0xF2, 0x44, 0x03, 0xAC, 0x86, 0x45, 0xBE, 0x17, 0xE5, 0x5B, 
+0x65, 0x16, 0xE8, 0xEB, 0xDE, 0x14, 0xD4, 0x70, 0xA2, 0x3A, 0x71, 0x5A, 0xEF, 0xB5, 0xED, 0x8C, 
+0x6D, 0x79, 0xAA, 0x79, 0x01, 0x7C, 0x16, 0x0D, 0x5D, 0xDD, 0x05, 0x23, 0x81, 0x4E, 0x3B, 0xAB, 
+0xB3, 0xDF, 0x91, 0x0C, 0xD6, 0xC5, 0x77, 0x6F, 0x40, 0x69, 0x16, 0x62, 0x26, 0xFA, 0x65, 0xC2, 
+0x2A, 0x04, 0x29, 0x5B, 0x48, 0xBD, 0x52, 0x0D, 0x97, 0x0B, 0xBB, 0x6B, 0xA4, 0x4A, 0x24, 0x26, 
+0x71, 0x2C, 0x11, 0x73, 0xE4, 0x3F, 0xF4, 0x24, 0xDE, 0x4D, 0xA9, 0xA2, 0xB5, 0x13, 0x3F, 0xFD, 
+0x27, 0x86, 0xD1, 0xA5, 0x49, 0x74, 0xBD, 0x96, 0x2E, 0x11, 0x7F, 0x9A, 0x18, 0x1B, 0xD3, 0xBD, 
+0x8F, 0xED, 0xDE, 0x22, 0x1C, 0xA1, 0x0B, 0x2C, 0xB3, 0x3A, 0xEB, 0x15, 0x95, 0x25, 0xEE, 0xA1, 
+0xBF, 0xB5, 0xB9, 0xE9, 0xFE, 0x93, 0x65, 0x57, 0xFB, 0xBD, 0xD0, 0xC6, 0x81, 0x5E, 0x68, 0x28, 
+0xBA, 0xCB, 0x72, 0x9F, 0x4D, 0x0B, 0x42, 0x5E, 0x93, 0x9B, 0xEE, 0xBF, 0x41, 0xE6, 0xB3, 0xDF, 
+0x0D, 0x76, 0x0D, 0xE3, 0x1A, 0x18, 0x88, 0x2E, 0xD1, 0x2C, 0xA4, 0x2C, 0x8D, 0x76, 0xE1, 0xCE, 
+0xE9, 0xF3, 0x8D, 0x0E, 0x76, 0x69, 0x49, 0x27, 0x0C, 0xEF, 0xC0, 0xEA, 0xD7, 0xE5, 0x91, 0x61, 
+0xCC, 0xE2, 0x80, 0xD6, 0xE3, 0xBF, 0x8C, 0x38, 0xF6, 0x5C, 0x8F, 0x3C, 0x52, 0x5C, 0x92, 0x2F, 
+0x06, 0x16, 0xDA, 0x28, 0x88, 0xE8, 0xDE, 0xB4, 0xC6, 0xB0, 0xCB, 0xB5, 0x31, 0xCB, 0x62, 0x76, 
+0x6D, 0x84, 0xB2, 0x8D, 0x7E, 0x58, 0x6A, 0x4B, 0x74, 0x4A, 0xEF, 0xBB, 0xFB, 0x97, 0xE8, 0xEA, 
+0x8D, 0x5A, 0x3B, 0xD5, 0x67, 0xF5, 0x45, 0x80, 0x27, 0xA8, 0x8F, 0x1D, 0x1D, 0x26, 0xAC, 0x4B, 
+0x69, 0x68, 0x3F, 0x09, 0xFB, 0x17, 0xBB, 0x5A, 0xBB, 0xE5, 0x62, 0xCA, 0x73, 0xB3, 0xD0, 0x2C, 
+0xE5, 0x5A, 0xC0, 0xF6, 0x0A, 0xCF, 0x46, 0x25, 0xAC, 0x28, 0x2C, 0x60, 0x38, 0x09, 0x38, 0xE6, 
+0x41, 0x93, 0x2D, 0x27, 0x79, 0xA1, 0xDD, 0xB8, 0x2F, 0x45, 0x5E, 0x9F, 0x1A, 0xDD, 0x72, 0xF1, 
+0x39, 0xF8, 0x99, 0xC5, 0xB1, 0x2B, 0xFD, 0x12, 0x4A, 0x2F, 0x47, 0x1F, 0xED, 0x94, 0x89, 0x42, 
+0x7D, 0xCE, 0xE4, 0xC1, 0xB0, 0x09, 0x0A, 0xDF, 0xF6, 0xF4, 0x2C, 0xB0, 0x2E, 0x0A, 0x2F, 0xDD, 
+0x39, 0x85, 0xE3, 0x6F, 0x6A, 0xB0, 0x9F, 0x14, 0x5C, 0x1D, 0x42, 0xB0, 0x21, 0x45, 0x2F, 0x5D, 
+0x32, 0x03, 0x81, 0x54, 0x48, 0xEC, 0x7F, 0x02, 0x2C, 0x17, 0xEE, 0x4D, 0xC5, 0x86, 0xF4, 0x84, 
+0xD6, 0x4F, 0x72, 0xC6, 0x98, 0x67, 0x70, 0x6C, 0xAB, 0x35, 0x1A, 0x26, 0x3F, 0x58, 0x80, 0x32, 
+0x02, 0xDB, 0xB0, 0xB5, 0x1B, 0x6D, 0x71, 0xAE, 0xA5, 0x16, 0x7A, 0x5F, 0xC6, 0xC0, 0xE7, 0x2D, 
+0x9B, 0x5A, 0xBF, 0x1C, 0x6C, 0x5D, 0x18, 0xD1, 0x93, 0xAF, 0x19, 0x6D, 0xBF, 0x47, 0x4B, 0xB5, 
+0xE2, 0x1D, 0xBE, 0x4B, 0x57, 0xBE, 0x57, 0x8F, 0x64, 0x25, 0xEE, 0x84, 0xC7, 0xBD, 0x14, 0x18, 
+0x8A, 0x77, 0x26, 0x21, 0x52, 0x67, 0xB2, 0x53, 0xE6, 0x61, 0xF8, 0x9A, 0x33, 0xB3, 0x07, 0x1B, 
+0x6D, 0x56, 0x05, 0x7A, 0xD1, 0x87, 0xBC, 0x8D, 0x97, 0xD2, 0xA1, 0xA0, 0x58, 0xB7, 0x21, 0x80, 
+0x13, 0x2E, 0xFB, 0x0A, 0x57, 0x5E, 0xDA, 0x43, 0x39, 0xA2, 0x14, 0xAE, 0x15, 0x27, 0x89, 0xB5, 
+0xD8, 0x70, 0x05, 0x44, 0x51, 0xCA, 0x6F, 0x76, 0xA1, 0x28, 0x31, 0x55, 0x8D, 0x8E, 0x75, 0x54, 
+0x8C, 0xA8, 0x08, 0x29, 0x6C, 0xCC, 0x06, 0xC0, 0x3D, 0xDB, 0xD6, 0x2E, 0x65, 0x2F, 0x34, 0xC5, 
+0xF7, 0x94, 0x76, 0x2F, 0x2A, 0x3C, 0xB1, 0xBD, 0x7C, 0xD8, 0x8C, 0x7D, 0x76, 0x78, 0x50, 0xEC, 
+0x88, 0x79, 0xE7, 0x2D, 0x17, 0x9E, 0x38, 0x3C, 0xF8, 0x09, 0xA0, 0x8C, 0xF3, 0xA1, 0x60, 0xE1, 
+0x52, 0x22, 0xF3, 0xB5, 0xC4, 0x19, 0x13, 0x16, 0x25, 0xE1, 0x90, 0x43, 0xFB, 0xB7, 0x5C, 0x9C, 
+0xB1, 0x0D, 0xEC, 0xF6, 0xC4, 0x11, 0x19, 0x54, 0x1A, 0x93, 0x56, 0xBB, 0x3F, 0x73, 0x7B, 0x98, 
+0xEA, 0x0D, 0x1D, 0x0E, 0xDE, 0x61, 0xA9, 0x65, 0x3E, 0x66, 0xF7, 0x9A, 0xBB, 0x5B, 0xCD, 0xD2, 
+0x1E, 0xA5, 0x6D, 0x5F, 0xDB, 0x6D, 0xE6, 0x4E, 0x31, 0x5D, 0x17, 0xBC, 0x75, 0x48, 0xAB, 0xC4, 
+0x51, 0x80, 0xB5, 0xA1, 0xC1, 0x46, 0xD1, 0x49, 0x53, 0xB6, 0xE2, 0x6E, 0x91, 0x18, 0xB7, 0xA0, 
+0xCC, 0xE2, 0x17, 0xB4, 0x51, 0xDF, 0x66, 0xF6, 0xCC, 0x41, 0x9F, 0x0F, 0x14, 0x09, 0x78, 0x5B, 
+0xC1, 0x1B, 0xF2, 0x45, 0xCB, 0x53, 0xCE, 0xBF, 0xF7, 0x6F, 0x38, 0xAF, 0x74, 0x63, 0x98, 0x76, 
+0x07, 0xEE, 0x38, 0x71, 0xC4, 0xE3, 0x40, 0x3B, 0x3E, 0x49, 0x22, 0x6D, 0xC5, 0x35, 0xC5, 0x3E, 
+0x98, 0x06, 0xD8, 0xAD, 0xF4, 0x5B, 0xC9, 0xEF, 0xC3, 0xB0, 0x95, 0xDF, 0x51, 0x92, 0x79, 0x7F, 
+0xE8, 0x69, 0x3C, 0xB6, 0x3F, 0x36, 0x3C, 0xB5, 0x44, 0x30, 0x82, 0x4F, 0x95, 0x38, 0x55, 0xA2, 
+0x2B, 0x91, 0x95, 0xD4, 0xAF, 0x49, 0xE6, 0xAD, 0x29, 0xE8, 0x13, 0xF5, 0x44, 0xFD, 0x96, 0xD5, 
+0x79, 0xEB, 0xDC, 0xE2, 0x15, 0xF9, 0xEF, 0xBF, 0x58, 0x8E, 0x05, 0x8A, 0x8C, 0x15, 0xDA, 0x58, 
+0x1A, 0x31, 0x37, 0x83, 0x5B, 0x83, 0x81, 0x93, 0xFB, 0xDB, 0xAA, 0x6F, 0x6B, 0xFF, 0xAD, 0x0C, 
+0x27, 0x87, 0xDB, 0xC6, 0xDF, 0x62, 0xA0, 0xAB, 0x7F, 0xA7, 0xAB, 0x7B, 0x36, 0x96, 0x47, 0x21, 
+0xA6, 0x3E, 0x4E, 0x56, 0x9F, 0x3C, 0xCE, 0x7C, 0x21, 0xC8, 0x9B, 0x30, 0x4C, 0x6D, 0x83, 0x88, 
+0xB2, 0x19, 0xA9, 0xAC, 0x0D, 0x69, 0x79, 0x6D, 0x7D, 0x8A, 0x2D, 0xFD, 0xB2, 0x15, 0x22, 0xC5, 
+0x0C, 0xA4, 0x5E, 0xDE, 0x55, 0x35, 0x56, 0x6B, 0x8F, 0x21, 0xC7, 0x02, 0x1F, 0x23, 0x74, 0x8E, 
+0xD4, 0x4B, 0x8C, 0xF1, 0x7B, 0xE7, 0xC7, 0x80, 0x7C, 0x6B, 0x8B, 0xE1, 0x75, 0x92, 0xBC, 0xCD, 
+0x12, 0xDA, 0xD3, 0xEC, 0x4C, 0x3A, 0xB7, 0x74, 0xB9, 0xDB, 0xCA, 0x61, 0x04, 0xA4, 0x56, 0x00, 
+0x68, 0x38, 0x8A, 0x4D, 0x8B, 0x4E, 0xCF, 0x60, 0x54, 0x64, 0xE2, 0x2C, 0x42, 0x94, 0x93, 0xB7, 
+0x77, 0x1F, 0x32, 0x02, 0x6F, 0xD9, 0x37, 0x01, 0x07, 0x11, 0x5D, 0x8C, 0x6C, 0x98, 0xAC, 0xD4, 
+0x1A, 0x99, 0x79, 0x13, 0x41, 0xA1, 0x38, 0xD8, 0xCD, 0x2F, 0xBF, 0xD1, 0xF3, 0xD5, 0xB5, 0xE3, 
+0xCB, 0xA4, 0xAD, 0x44, 0xAE, 0x9D, 0xE0, 0xA3, 0x69, 0x8C, 0x62, 0x37, 0xEA, 0xEA, 0xB2, 0xD6, 
+0x5D, 0xEF, 0x4F, 0xD2, 0x90, 0xBA, 0xEB, 0x83, 0x3F, 0xE6, 0xEA, 0x9C, 0x9A, 0x41, 0x2E, 0x5F, 
+0x69, 0xDC, 0x3E, 0x08, 0xBE, 0x6E, 0x3D, 0xD4, 0x0B, 0xB4, 0x74, 0xC6, 0xCA, 0x64, 0xA1, 0x61, 
+0x59, 0xFE, 0x04, 0x77, 0xC7, 0x36, 0x65, 0x7C, 0xC2, 0x30, 0x7D, 0x50, 0x6F, 0x1A, 0xA0, 0x89, 
+0xF2, 0xCE, 0x00, 0xB1, 0x3E, 0x59, 0xE4, 0x6E, 0x48, 0x23, 0x6D, 0x80, 0x86, 0xD4, 0xD8, 0xD5, 
+0x3F, 0x33, 0xAD, 0x7F, 0xFE, 0xAA, 0x40, 0x55, 0xEF, 0xF9, 0x51, 0x28, 0x82, 0x23, 0xDF, 0xE6, 
+0x73, 0xF1, 0x27, 0x66, 0xA3, 0x6D, 0x4D, 0x25, 0x8D, 0x70, 0x13, 0xD4, 0x56, 0xA0, 0x10, 0xEA, 
+0xA9, 0x97, 0xF9, 0x18, 0x70, 0x14, 0xD7, 0x03, 0xFD, 0x99, 0x33, 0x08, 0x27, 0x2B, 0xDF, 0x0B, 
+0x25, 0xAD, 0x68, 0xB0, 0xDD, 0x99, 0x39, 0x1B, 0xE1, 0xC9, 0xDB, 0xAE, 0x9C, 0x36, 0xD8, 0xC9, 
+0x94, 0xA9, 0xD2, 0xE4, 0xED, 0x9A, 0xAE, 0xF4, 0x3E, 0x63, 0xFC, 0x23, 0xE9, 0x10, 0x1A, 0xD8, 
+0x2C, 0x4C, 0xB6, 0x83, 0x76, 0x5A, 0x8C, 0x2B, 0x54, 0xC9, 0x8D, 0x09, 0xB5, 0xF4, 0xCF, 0x44, 
+0x25, 0xD2, 0x92, 0x2C, 0x9F, 0x3C, 0x7A, 0x8F, 0x2B, 0x37, 0x9F, 0x2B, 0xAE, 0x42, 0x21, 0x2D, 
+0x0B, 0x59, 0xDA, 0xA1, 0x2D, 0xBC, 0x3B, 0xE5, 0x3D, 0x35, 0xAD, 0x14, 0x09, 0x8B, 0x16, 0xE2, 
+0x56, 0x17, 0xE6, 0x35, 0x87, 0xB6, 0xEC, 0x2B, 0x50, 0x10, 0x9F, 0xB2, 0xB7, 0xCB, 0x42, 0xA7, 
+0x31, 0x3B, 0x58, 0x5F, 0x58, 0x3F, 0x75, 0x65, 0xB6, 0xBD, 0x1B, 0xED, 0x1B, 0xEB, 0xEE, 0xFA, 
+0x1D, 0x5E, 0xA3, 0x28, 0xD6, 0xAA, 0x0D, 0xF3, 0xB6, 0xE8, 0xE5, 0xC6, 0xD0, 0x28, 0xF9, 0x7D, 
+0x95, 0x0D, 0x45, 0x08, 0x41, 0xA2, 0xE7, 0x82, 0xDC, 0x98, 0xC8, 0xC0, 0x30, 0x51, 0x1C, 0xCA, 
+0xC3, 0x8D, 0x0A, 0x86, 0x7E, 0x48, 0x38, 0xAE, 0x4A, 0x61, 0xC1, 0x7E, 0xBE, 0xC8, 0xC3, 0x5F, 
+0xF3, 0xA5, 0x03, 0xA7, 0x49, 0xC4, 0x17, 0x70, 0x8F, 0x57, 0x3C, 0x8E, 0x3B, 0x74, 0x20, 0x85, 
+0xDA, 0x77, 0x0D, 0x1D, 0x15, 0x46, 0xC4, 0xF9, 0x30, 0x06, 0xF3, 0x55, 0xE9, 0x15, 0x0C, 0x7C, 
+0x56, 0xEF, 0x10, 0xC9, 0x8A, 0xA9, 0xE9, 0x04, 0x22, 0xB1, 0x4A, 0xA7, 0x7A, 0x62, 0x83, 0x3E, 
+0xB4, 0x56, 0x92, 0x05, 0x16, 0xED, 0x18, 0xC2, 0x47, 0xAB, 0x74, 0x64, 0xE8, 0xB8, 0x19, 0xA3, 
+0xB6, 0x34, 0x13, 0x02, 0xC0, 0xB9, 0xA9, 0xCF, 0xED, 0xB2, 0x11, 0xAE, 0x5E, 0xAD, 0x7C, 0x2C, 
+0x18, 0x59, 0x7E, 0x63, 0x7D, 0xAB, 0x34, 0x72, 0x58, 0x77, 0x94, 0x2C, 0xDA, 0x5B, 0x87, 0xBC, 
+0x2E, 0x56, 0x6F, 0x2F, 0x26, 0xAA, 0xC8, 0xFD, 0x47, 0x34, 0x41, 0x8B, 0x8D, 0x26, 0x6D, 0x9A, 
+0x90, 0x38, 0x1D, 0x3C, 0x84, 0xFC, 0x8B, 0xA6, 0x88, 0x52, 0xEB, 0x4C, 0xF4, 0xCC, 0x74, 0x83, 
+0xB1, 0x59, 0x19, 0x8C, 0xBE, 0x34, 0xFA, 0x83, 0xEF, 0x96, 0x88, 0xD1, 0xC7, 0x06, 0x2F, 0x51, 
+0x80, 0x10, 0xBF, 0x11, 0x28, 0x05, 0x17, 0x5C, 0xE4, 0x62, 0x3E, 0x67, 0xFA, 0x90, 0x5F, 0x64, 
+0x32, 0x95, 0x22, 0x57, 0xF4, 0x56, 0x8C, 0xB0, 0x7E, 0x10, 0x6F, 0xB9, 0x4C, 0xF9, 0x76, 0xC9, 
+0x3D, 0xFB, 0xC7, 0xF4, 0x02, 0xB4, 0xCD, 0xF2, 0xA0, 0x1C, 0xA6, 0x32, 0xA0, 0x90, 0xDA, 0xF6, 
+0xF0, 0xB3, 0xCA, 0x02, 0x8F, 0x72, 0x0D, 0x46, 0x86, 0xEA, 0xF0, 0xB6, 0x99, 0x17, 0x6C, 0x54, 
+0x24, 0x6C, 0xEA, 0x0B, 0xC3, 0x9B, 0x9F, 0xBD, 0xFD, 0x59, 0x9B, 0xD0, 0xAE, 0xFB, 0x2C, 0x8C, 
+0x42, 0xDF, 0xBA, 0x3F, 0x8C, 0x26, 0xFA, 0x0E, 0xC5, 0x55, 0xEA, 0x21, 0x2C, 0x18, 0x1A, 0xAA, 
+0xEA, 0x7F, 0x07, 0x17, 0x35, 0x52, 0xA4, 0xEA, 0x17, 0x99, 0x22, 0xD6, 0xD6, 0xC0, 0xFF, 0x54, 
+0x7B, 0xD4, 0xF5, 0x3E, 0x60, 0x0C, 0x6B, 0xA2, 0xEF, 0x35, 0xB6, 0x94, 0xBD, 0xA2, 0xD8, 0x76, 
+0x7C, 0xD0, 0xB1, 0x37, 0xEA, 0x16, 0x14, 0x1E, 0x6C, 0xC1, 0xF0, 0x75, 0x75, 0x01, 0xB4, 0x35, 
+0x22, 0xA0, 0xFF, 0xE9, 0x5F, 0xDC, 0xB7, 0x8B, 0xBB, 0x4D, 0x2A, 0xC8, 0x77, 0xEC, 0x24, 0x7B, 
+0xF5, 0xBC, 0x03, 0xCA, 0xA2, 0x68, 0xE5, 0x91, 0xF9, 0xED, 0xA0, 0x77, 0x8D, 0x66, 0xF5, 0x31, 
+0xD2, 0xEE, 0x9A, 0x70, 0xEE, 0x4C, 0xF5, 0x13, 0x06, 0x47, 0x37, 0xA6, 0x65, 0xE0, 0xF6, 0x8D, 
+0xA2, 0x9D, 0x68, 0x83, 0xC4, 0xA5, 0xA4, 0x77, 0x8F, 0x0D, 0x79, 0xCF, 0x1E, 0x22, 0x1D, 0xF1, 
+0x6D, 0x0B, 0xCB, 0xAE, 0x22, 0x22, 0x8D, 0x19, 0x99, 0x61, 0x49, 0x44, 0xB3, 0x1D, 0x32, 0x5D, 
+0xF7, 0xED, 0x30, 0x74, 0x1A, 0x69, 0xCB, 0xA5, 0xD0, 0xAB, 0xAA, 0xF3, 0x06, 0x40, 0xA3, 0xE0, 
+0xC9, 0x77, 0x5D, 0xC7, 0xF2, 0x07, 0x2E, 0x10, 0x29, 0x9C, 0xEA, 0x5D, 0x5C, 0x02, 0xA4, 0xDD, 
+0x4E, 0x61, 0x00, 0xB7, 0xF4, 0xE3, 0x0F, 0x11, 0xFD, 0x57, 0xC3, 0xFE, 0xCB, 0xFD, 0xAB, 0xA3, 
+0xEB, 0x68, 0x19, 0x0B, 0x49, 0x9D, 0x64, 0x37, 0x42, 0xCA, 0x38, 0x1E, 0x37, 0x9A, 0xBF, 0xF6, 
+0x89, 0x03, 0xC2, 0xCC, 0x16, 0x9D, 0xB5, 0x6A, 0x47, 0x34, 0x61, 0x3F, 0x44, 0x47, 0x28, 0xB9, 
+0x70, 0xA8, 0x29, 0xE4, 0x49, 0xE0, 0x0F, 0xEE, 0x40, 0xA8, 0x84, 0xE0, 0xCC, 0x76, 0x92, 0x19, 
+0x64, 0x34, 0x25, 0xA9, 0x64, 0xE7, 0xE1, 0xC1, 0x6E, 0x5D, 0x27, 0x68, 0xFB, 0xD1, 0xE4, 0xD0, 
+0xD7, 0x83, 0x8E, 0x3E, 0x6B, 0xF1, 0x75, 0x23, 0x34, 0x3E, 0x13, 0x03, 0x9E, 0x0C, 0xF5, 0xD8, 
+0x37, 0xC8, 0x31, 0xE9, 0x9A, 0x3B, 0x43, 0x37, 0x96, 0x2C, 0x3F, 0x7E, 0xE8, 0x08, 0xDA, 0x16, 
+0x60, 0x57, 0xE1, 0x04, 0x17, 0x29, 0xBD, 0xA8, 0x1F, 0xA9, 0x70, 0x1F, 0x48, 0x8C, 0x00, 0x6B, 
+0x4D, 0x80, 0x08, 0xA2, 0x3E, 0xA2, 0x23, 0x73, 0x5F, 0x5D, 0x5C, 0x38, 0xDF, 0xD9, 0xEE, 0xA5, 
+0x2F, 0xEF, 0xA7, 0x0C, 0xDD, 0xC0, 0x7F, 0x07, 0x30, 0xDB, 0xB9, 0x2A, 0xE8, 0x6F, 0xC5, 0x05, 
+0xEA, 0x4F, 0x99, 0x21, 0x1A, 0xE4, 0x6D, 0x5F, 0xD7, 0x2E, 0x36, 0xBE, 0x44, 0xDA, 0xAA, 0xC1, 
+0xBE, 0xEB, 0xCD, 0xC5, 0xA5, 0x1D, 0x47, 0x24, 0x69, 0x45, 0x41, 0x15, 0x9E, 0xBD, 0x7C, 0xC5, 
+0x82, 0xA7, 0xBD, 0xBE, 0x69, 0xE1, 0x40, 0x7E, 0x4E, 0xE4, 0xF2, 0xDD, 0x00, 0x2B, 0xCF, 0xC2, 
+0xC7, 0xFA, 0xF8, 0xB9, 0x5B, 0x4D, 0x2D, 0x80, 0xD0, 0xE6, 0x34, 0x90, 0x80, 0x82, 0x18, 0x50, 
+0x68, 0x63, 0xC6, 0xA0, 0x24, 0xBC, 0x88, 0xE1, 0xB0, 0x87, 0xA8, 0xCD, 0xD5, 0xEE, 0x62, 0x3E, 
+0x8F, 0xC0, 0x83, 0x08, 0x9E, 0x48, 0xDF, 0xA7, 0x56, 0xB4, 0xD8, 0x02, 0xB6, 0x5A, 0x83, 0xAD, 
+0x16, 0x57, 0xB0, 0xAB, 0x2A, 0x3A, 0x20, 0xA2, 0x81, 0x8A, 0x69, 0x65, 0xD6, 0x6E, 0xF0, 0x17, 
+0x36, 0xC7, 0x12, 0x54, 0xBE, 0x8B, 0xA6, 0x7F, 0xFB, 0xAD, 0xEB, 0xC8, 0x5A, 0xD0, 0x9E, 0x53, 
+0xF4, 0x31, 0xE9, 0x93, 0xBF, 0x7C, 0x6C, 0x90, 0xFC, 0x85, 0x26, 0xFC, 0xE6, 0x16, 0xE2, 0x96, 
+0xC4, 0xE5, 0xC9, 0x45, 0xDB, 0xB8, 0xDE, 0xCB, 0xB4, 0x86, 0xAE, 0x2F, 0x0E, 0xC0, 0x85, 0xAB, 
+0xEA, 0xC2, 0xD4, 0x6D, 0xCE, 0xE0, 0x57, 0x27, 0x50, 0x3F, 0xEA, 0x8B, 0x68, 0xA2, 0x19, 0xAD, 
+0x1B, 0x68, 0x21, 0xF2, 0x5A, 0xE4, 0x21, 0xBE, 0x76, 0xF1, 0xEA, 0x38, 0x32, 0x07, 0xE7, 0x52, 
+0xB6, 0x2E, 0xF5, 0x98, 0xD6, 0x2E, 0x06, 0x9C, 0xB5, 0x36, 0x8F, 0x3F, 0x44, 0x2C, 0x53, 0xEF, 
+0x15, 0x59, 0x88, 0x35, 0xE2, 0x47, 0xFE, 0x41, 0xCE, 0xB7, 0x99, 0x15, 0x8A, 0xBA, 0x2A, 0xE2, 
+0xFB, 0x48, 0x5F, 0xB1, 0xC3, 0xEE, 0xBA, 0x8A, 0x71, 0x85, 0xA7, 0xEE, 0x5D, 0xA7, 0xD4, 0xD6, 
+0x7C, 0x9E, 0xA6, 0xF2, 0x59, 0x33, 0xB0, 0x9A, 0x9B, 0xAD, 0x5B, 0x63, 0x69, 0x76, 0x2C, 0x31, 
+0xCF, 0xEB, 0xD9, 0x03, 0x97, 0xD2, 0xFD, 0x50, 0x40, 0x19, 0xAC, 0x3B, 0xC3, 0xCA, 0xC8, 0xA4, 
+0x77, 0x3F, 0xF8, 0x65, 0x28, 0xE9, 0x9F, 0xA9, 0x16, 0x8F, 0xD8, 0x9F, 0xF1, 0x36, 0xAF, 0x36, 
+0x54, 0xC8, 0xF6, 0xDB, 0x0C, 0xE4, 0x48, 0x12, 0x3D, 0xED, 0x35, 0xCF, 0x13, 0x80, 0x13, 0xF6, 
+0x79, 0xE2, 0xB9, 0x35, 0xC8, 0xC1, 0xE4, 0x55, 0xAA, 0xF2, 0x50, 0x56, 0x2F, 0xB4, 0x48, 0x83, 
+0x64, 0x13, 0xB1, 0x36, 0x02, 0xCE, 0xCB, 0x52, 0x1E, 0xFA, 0x97, 0x67, 0x56, 0x14, 0x8C, 0x9B, 
+0x24, 0x65, 0xB8, 0xB8, 0xBE, 0x7A, 0xFF, 0x14, 0xD7, 0xC7, 0xC7, 0x3D, 0xE7, 0x54, 0xD2, 0x9A, 
+0x4B, 0xED, 0xEE, 0x91, 0xB8, 0xA5, 0x91, 0x3E, 0x86, 0xCD, 0xF6, 0x3B, 0xC1, 0x9C, 0x30, 0xC7, 
+0x9F, 0x92, 0x11, 0x53, 0x98, 0xFB, 0x9A, 0x5D, 0x21, 0xA7, 0xB0, 0x77, 0x5F, 0x17, 0x02, 0xAC, 
+0x09, 0xD8, 0x90, 0x11, 0x54, 0xB8, 0x49, 0xDB, 0x53, 0x6E, 0xF9, 0x2A, 0x32, 0x64, 0x6F, 0x55, 
+0x4B, 0x5E, 0x5C, 0x7B, 0xED, 0x9E, 0x88, 0x3C, 0x30, 0x21, 0x17, 0xE9, 0x75, 0x4B, 0x0A, 0x2B, 
+0x7A, 0x89, 0xC3, 0x85, 0xB7, 0xB0, 0x2F, 0xFB, 0x99, 0x60, 0x7E, 0x12, 0x48, 0x8B, 0xEF, 0x7E, 
+0xC8, 0xC4, 0x76, 0xB9, 0x82, 0x0A, 0x4F, 0x36, 0xE0, 0xA7, 0x82, 0x35, 0xF9, 0xFA, 0xAB, 0x6D, 
+0xF7, 0x30, 0x3B, 0x2D, 0x2A, 0x0E, 0x25, 0xC2, 0x5A, 0xE8, 0xBB, 0x78, 0xDB, 0x52, 0x40, 0x2B, 
+0x74, 0x61, 0x2C, 0x3A, 0x77, 0x76, 0x2D, 0xA0, 0x53, 0x37, 0x16, 0xFD, 0x50, 0x66, 0x55, 0x0D, 
+0xD9, 0x37, 0x65, 0xBD, 0xEF, 0x49, 0xEF, 0xAE, 0x21, 0xEB, 0xC6, 0xF2, 0xA9, 0xDA, 0x86, 0x0A, 
+0x7B, 0xAE, 0xC3, 0xB2, 0x03, 0x29, 0xC0, 0xAB, 0xEA, 0x62, 0x0D, 0x07, 0xEE, 0x0F, 0x6D, 0xDD, 
+0xC3, 0xE3, 0x83, 0x06, 0xBC, 0x5D, 0x07, 0xD1, 0xD4, 0xDA, 0xB0, 0x88, 0x8E, 0x90, 0xBD, 0xC0, 
+0xE8, 0xBC, 0xB2, 0xE5, 0xB0, 0xF0, 0xC5, 0x3A, 0xA0, 0xE3, 0x49, 0xFB, 0xE8, 0x1D, 0x5F, 0x01, 
+0xF8, 0x5E, 0xD5, 0x59, 0xF7, 0xA8, 0xBE, 0x43, 0xB2, 0x6B, 0x2E, 0xDC, 0x81, 0xF9, 0x33, 0xF7, 
+0xBB, 0xB6, 0xB8, 0x01, 0xC6, 0x75, 0xA1, 0x85, 0xF8, 0x87, 0xB0, 0xDA, 0x77, 0x30, 0x6A, 0x7F, 
+0xC9, 0x91, 0x5A, 0xFA, 0x83, 0xC0, 0xFA, 0xA3, 0x57, 0x15, 0x92, 0x70, 0xA2, 0x26, 0xE5, 0xDA, 
+0x5D, 0xD6, 0xDD, 0xC3, 0x13, 0xF9, 0x1C, 0x43, 0x50, 0x8B, 0xDC, 0xBB, 0xDB, 0xE0, 0x26, 0x7F, 
+0x06, 0x6A, 0x69, 0xA5, 0x08, 0x43, 0xF1, 0x6B, 0x10, 0xAF, 0x4D, 0x0F, 0x14, 0xD9, 0xAB, 0x2A, 
+0x7B, 0x9B, 0x9E, 0x6A, 0xCC, 0xAA, 0xF6, 0xCC, 0x3D, 0x34, 0xEE, 0xED, 0xAC, 0x73, 0xEB, 0xA4, 
+0xCF, 0x3E, 0x74, 0x21, 0xDB, 0x21, 0x4B, 0xAC, 0xB4, 0x70, 0xFF, 0xF4, 0xB3, 0x0E, 0x75, 0xFE, 
+0x7E, 0x70, 0x5F, 0x21, 0x73, 0xAE, 0xA9, 0x21, 0x73, 0xA7, 0xBA, 0x75, 0xE3, 0x07, 0xD0, 0x4E, 
+0x9A, 0x3E, 0xB3, 0x05, 0xF4, 0x6B, 0xC1, 0xF5, 0x1A, 0x95, 0xBD, 0x1B, 0x32, 0x82, 0x7B, 0x18, 
+0x0C, 0xDD, 0xC7, 0x21, 0x8F, 0xD5, 0xB8, 0xB7, 0xFB, 0x75, 0x7B, 0xB4, 0xCF, 0x5C, 0xF1, 0xE5, 
+0x10, 0x51, 0xB5, 0xE0, 0x9A, 0xA8, 0x1F, 0xB2, 0x98, 0x8C, 0x82, 0x78, 0xFC, 0xD4, 0xD7, 0x25, 
+0x70, 0x00, 0x36, 0x20, 0x8C, 0x98, 0xC9, 0x4B, 0xEA, 0x8F, 0xEC, 0xCD, 0x19, 0xE4, 0x9E, 0xA1, 
+0x0F, 0x57, 0x44, 0x32, 0xAE, 0xD9, 0x9E, 0xAE, 0x73, 0xAF, 0x3E, 0x59, 0x7B, 0xB0, 0x5D, 0x8F, 
+0xD2, 0x2A, 0x4F, 0x8E, 0x8E, 0x20, 0xB1, 0xEE, 0x7B, 0x60, 0xCB, 0x2F, 0xD2, 0xE8, 0xC2, 0x63, 
+0x7A, 0x19, 0x5E, 0x78, 0x63, 0xA4, 0x46, 0x42, 0x92, 0xF4, 0xC8, 0x1E, 0x43, 0x64, 0xB0, 0x45, 
+0x4C, 0x91, 0xCC, 0xC7, 0x3C, 0x28, 0x13, 0xBD, 0x72, 0x17, 0x69, 0x78, 0x05, 0xB8, 0xB2, 0xA5, 
+0x52, 0x2A, 0x98, 0x43, 0xA7, 0x1E, 0x51, 0xCE, 0x8C, 0xC6, 0x26, 0xDB, 0x54, 0x51, 0x6E, 0x36, 
+0x67, 0x1A, 0xBA, 0x14, 0x30, 0x8E, 0x8F, 0x56, 0x90, 0xAA, 0x5E, 0x83, 0x7A, 0x2C, 0x27, 0xEF, 
+0x34, 0xF1, 0xD1, 0xAD, 0x5E, 0x47, 0x76, 0xCB, 0xCB, 0xC3, 0xBA, 0x15, 0x16, 0x5F, 0xC4, 0x7C, 
+0x29, 0xE8, 0x74, 0xFD, 0x78, 0x84, 0x7E, 0xE7, 0x73, 0x64, 0xA2, 0x04, 0xA1, 0x8C, 0xE4, 0xDC, 
+0x19, 0x56, 0x57, 0xC6, 0x0D, 0x44, 0x52, 0x1E, 0x0C, 0x44, 0xD8, 0x8F, 0xBB, 0x37, 0xA3, 0xBF, 
+0x83, 0xB1, 0xE2, 0xE7, 0x93, 0x6D, 0x10, 0xE8, 0x1E, 0x0D, 0xD0, 0xC3, 0x68, 0x44, 0xDC, 0x9B, 
+0x85, 0x80, 0x18, 0xA8, 0x47, 0xDD, 0xB8, 0x5D, 0x88, 0x31, 0x56, 0xAF, 0xB0, 0x2E, 0xAB, 0xD4, 
+0x3B, 0xAE, 0xD2, 0xDE, 0x41, 0x3E, 0x58, 0xD5, 0x83, 0x8B, 0x13, 0xC9, 0x23, 0x6F, 0x12, 0x9C, 
+0xAF, 0xE6, 0xD4, 0xD5, 0xB3, 0xD7, 0x20, 0x42, 0x5E, 0xAC, 0x2B, 0xF2, 0xC7, 0x9E, 0x44, 0x57, 
+0x86, 0xC2, 0xB1, 0x7D, 0x68, 0x41, 0x4B, 0x12, 0x52, 0x71, 0x8E, 0xCD, 0x07, 0xC1, 0x3B, 0x4E, 
+0x53, 0x4D, 0x65, 0xC4, 0x50, 0xC8, 0xA7, 0x15, 0x8A, 0x18, 0x57, 0x54, 0x9F, 0x63, 0xFC, 0x33, 
+0x12, 0x46, 0x58, 0x37, 0x4A, 0x75, 0x7B, 0x5E, 0xB9, 0x24, 0x95, 0x0D, 0x0A, 0xC1, 0x68, 0xC9, 
+0xF8, 0xD7, 0xB5, 0x84, 0xA4, 0xEC, 0xF6, 0xA8, 0x19, 0x62, 0xDD, 0xB4, 0xE9, 0xFA, 0x5B, 0xC7, 
+0xD0, 0x69, 0xAB, 0x83, 0x9C, 0xD6, 0x3A, 0x46, 0x92, 0x41, 0x86, 0xAB, 0x13, 0x41, 0xAC, 0xCD, 
+0xBB, 0xBC, 0x5B, 0xA2, 0xA5, 0x27, 0x7D, 0x08, 0x0E, 0x30, 0xA2, 0x0F, 0x1A, 0x57, 0x81, 0xF1, 
+0x44, 0xE2, 0xFD, 0x5B, 0x4A, 0x01, 0xE5, 0x19, 0x70, 0x9A, 0xE5, 0x68, 0x26, 0x22, 0x92, 0x54, 
+0x40, 0xB3, 0x19, 0xAF, 0x96, 0xEC, 0x1B, 0x31, 0x20, 0x9F, 0xC6, 0xFE, 0x18, 0x5C, 0x27, 0x14, 
+0x54, 0xCD, 0x2C, 0xA5, 0x62, 0x0C, 0xB3, 0x32, 0xE8, 0x91, 0x5F, 0xB6, 0x47, 0x9E, 0x75, 0xE2, 
+0x06, 0x11, 0xD8, 0x47, 0xB0, 0x13, 0x91, 0x00, 0x19, 0xA0, 0x20, 0x70, 0x70, 0x1B, 0x6B, 0x8C, 
+0xD0, 0xF3, 0xA0, 0x34, 0xA7, 0x72, 0xCD, 0x07, 0xAF, 0xE0, 0x88, 0x9E, 0xFB, 0xD1, 0x3B, 0x03, 
+0xBF, 0x30, 0xE5, 0x99, 0x39, 0xD1, 0xCC, 0x06, 0x48, 0x61, 0x91, 0xDF, 0xA4, 0x33, 0x03, 0x29, 
+0x03, 0x44, 0xC1, 0x01, 0x41, 0xAA, 0x15, 0xA9, 0xFA, 0x9A, 0xF4, 0x9E, 0x56, 0x86, 0x4C, 0x14, 
+0xE5, 0x89, 0x2B, 0x1D, 0x9B, 0xE0, 0x8D, 0xFB, 0x55, 0x0B, 0x3C, 0xB6, 0xB2, 0xA9, 0x78, 0x92, 
+0x85, 0xFA, 0x89, 0x92, 0x62, 0x42, 0xF7, 0x29, 0xF8, 0xD7, 0x2B, 0x34, 0x5A, 0xD2, 0x68, 0x48, 
+0x34, 0xAC, 0x5B, 0xE3, 0x14, 0x4C, 0x5A, 0x05, 0xC1, 0x14, 0x78, 0xF0, 0x94, 0xBF, 0x8B, 0x76, 
+0xF5, 0xA7, 0x3D, 0x34, 0x2D, 0xDC, 0x7D, 0x23, 0x39, 0xDF, 0xDA, 0xA1, 0xD2, 0x4E, 0x1F, 0x7D, 
+0x31, 0x7C, 0x88, 0x5F, 0xFF, 0xD7, 0xA2, 0x7F, 0xD2, 0xB5, 0x1A, 0xE4, 0x05, 0x8E, 0x53, 0xBF, 
+0xB2, 0xC2, 0x82, 0x36, 0x64, 0xDF, 0x3A, 0xF0, 0x19, 0x55, 0x8B, 0xF9, 0x81, 0xDF, 0x76, 0xF4, 
+0xCB, 0xAC, 0x47, 0x48, 0x1F, 0xCC, 0x7A, 0xC7, 0xD5, 0x43, 0x92, 0xBC, 0x51, 0xBA, 0xE4, 0xAA, 
+0xA4, 0xF9, 0x22, 0x64, 0xC7, 0xE6, 0xEB, 0x29, 0x40, 0x36, 0xCF, 0xA7, 0x79, 0xDB, 0x86, 0x23, 
+0x59, 0xB2, 0x05, 0x3F, 0xBA, 0xBF, 0x5F, 0x00, 0x18, 0x94, 0xE6, 0xAA, 0x25, 0x34, 0x3F, 0x97, 
+0x0B, 0xDB, 0xF8, 0x73, 0x5A, 0x69, 0x84, 0x5F, 0x69, 0xB4, 0xF2, 0x00, 0x23, 0xDA, 0xA8, 0x1E, 
+0xAC, 0xD9, 0xA8, 0xA5, 0x79, 0xF8, 0xE9, 0x00, 0x2D, 0x02, 0xFF, 0x57, 0x0B, 0x16, 0x28, 0x1C, 
+0x3C, 0xFD, 0x04, 0xE0, 0xB0, 0x15, 0xF3, 0x44, 0x89, 0x05, 0x7D, 0x18, 0x57, 0x68, 0x2D, 0x4A, 
+0x83, 0x59, 0x6A, 0x84, 0x1D, 0x81, 0xD3, 0xFA, 0xD3, 0x9B, 0x9D, 0xCB, 0x14, 0x94, 0x8E, 0xA9, 
+0x05, 0xA9, 0x74, 0xB2, 0x23, 0x01, 0x6A, 0x0F, 0x46, 0x1A, 0xD2, 0x19, 0x55, 0x3D, 0x63, 0x37, 
+0xCD, 0x1D, 0xDF, 0xE3, 0xE3, 0xD4, 0xAE, 0xA1, 0x44, 0x22, 0x31, 0xAC, 0x24, 0x12, 0x51, 0x0F, 
+0x8C, 0xC2, 0xD5, 0x79, 0xEE, 0xC4, 0x6B, 0x34, 0xB5, 0x70, 0xE5, 0xC3, 0x87, 0xBE, 0x0C, 0xFE, 
+0x3C, 0x32, 0xA1, 0x61, 0x5C, 0x82, 0xF4, 0x6A, 0x0D, 0x5B, 0xC5, 0xD6, 0xAB, 0x81, 0x81, 0xAA, 
+0xD6, 0x25, 0x49, 0xC5, 0x9A, 0x96, 0xDA, 0x9C, 0xBC, 0x97, 0x01, 0x52, 0x8F, 0x46, 0x39, 0x34, 
+0x17, 0x52, 0xEE, 0x5E, 0x67, 0x46, 0x6A, 0xB8, 0xC6, 0x9B, 0x05, 0xFF, 0x25, 0x7B, 0x6E, 0x04, 
+0x05, 0xCF, 0xB7, 0xA1, 0x85, 0xB4, 0xE8, 0xCF, 0x4D, 0x09, 0xE6, 0x06, 0x8D, 0x5A, 0x87, 0x6E, 
+0xD2, 0xB0, 0xC1, 0xFE, 0xDC, 0xA6, 0x18, 0xC8, 0x83, 0x6F, 0x9D, 0xEF, 0xB5, 0xE1, 0x73, 0xEA, 
+0x2C, 0x01, 0xE3, 0xA6, 0xC3, 0xE3, 0xB4, 0xD5, 0x80, 0x5D, 0x1D, 0xFC, 0x04, 0x63, 0x2F, 0xE3, 
+0xA7, 0x94, 0x6E, 0x84, 0x89, 0xED, 0xA3, 0xC3, 0x5A, 0xF1, 0x82, 0x0F, 0xDF, 0x8F, 0x7A, 0xA7, 
+0xD0, 0xC8, 0xAB, 0x18, 0x00, 0x12, 0x3D, 0xFD, 0x9C, 0x65, 0xD1, 0x7A, 0x57, 0xBC, 0x71, 0x88, 
+0xB2, 0xC4, 0xAA, 0xFF, 0x1F, 0xF8, 0x4B, 0xD8, 0x1D, 0x57, 0xE7, 0x86, 0xEF, 0x21, 0x98, 0xC6, 
+0x50, 0xB9, 0x8B, 0xB6, 0xFB, 0x61, 0x6F, 0x02, 0xA5, 0xDD, 0x07, 0x6C, 0x4E, 0xFE, 0x21, 0xD4, 
+0x98, 0xE7, 0xB1, 0x9D, 0x19, 0xD5, 0x52, 0xC1, 0x0B, 0x12, 0xDE, 0xD0, 0x58, 0x3F, 0x64, 0x29, 
+0x33, 0xCD, 0xD2, 0x48, 0x20, 0x45, 0x45, 0x25, 0x81, 0xA1, 0x21, 0x37, 0xB2, 0x65, 0x5B, 0xF4, 
+0xA2, 0x13, 0xF8, 0xBB, 0x6A, 0x96, 0x6E, 0xC4, 0xAC, 0x54, 0x30, 0x70, 0x61, 0xAD, 0x3F, 0x98, 
+0x7D, 0xB0, 0x5B, 0xDF, 0x3A, 0xEC, 0xEF, 0x79, 0x46, 0x6E, 0x54, 0x87, 0xF9, 0x11, 0xAB, 0xFE, 
+0x3E, 0xE3, 0x4D, 0x42, 0xD6, 0x46, 0x3A, 0x5F, 0xA9, 0x57, 0x47, 0x0E, 0x4E, 0xA6, 0x80, 0xC7, 
+0xB4, 0x66, 0x4C, 0xB1, 0x6C, 0xC6, 0x94, 0xB5, 0x9A, 0x96, 0x04, 0xF4, 0x02, 0x46, 0x3D, 0x95, 
+0x34, 0x5C, 0xA4, 0x78, 0x88, 0xD9, 0x29, 0x89, 0x27, 0xAE, 0xB7, 0x84, 0x21, 0x37, 0x32, 0xA4, 
+0x18, 0xA2, 0xB2, 0xDA, 0xBC, 0x3E, 0x19, 0x14, 0xA1, 0xBA, 0x6B, 0x69, 0x0D, 0x35, 0xD2, 0xC9, 
+0x80, 0xEE, 0x18, 0xE8, 0xDC, 0x86, 0x3F, 0x3C, 0x5E, 0xE7, 0xC4, 0x65, 0x17, 0xA2, 0x50, 0xD7, 
+0xE8, 0xD3, 0xC3, 0x86, 0xB8, 0x4F, 0x59, 0xB1, 0x2F, 0x33, 0x41, 0x1C, 0x78, 0x19, 0x90, 0xB9, 
+0x17, 0x49, 0x31, 0x55, 0x34, 0x0A, 0xC2, 0x1C, 0x82, 0xA5, 0x57, 0xAD, 0x50, 0x52, 0xA8, 0x55, 
+0xBC, 0x6C, 0x36, 0x96, 0x77, 0x03, 0x4F, 0x8C, 0x9F, 0x9E, 0xD5, 0x1F, 0xDA, 0x24, 0xAA, 0x3F, 
+0x0E, 0x7D, 0xB5, 0x8C, 0xD8, 0x55, 0x21, 0x53, 0x47, 0x13, 0x1B, 0x42, 0xAF, 0xD4, 0xC9, 0xAA, 
+0x8D, 0x36, 0xF8, 0xDD, 0x91, 0x39, 0xE0, 0xBA, 0xE5, 0x3A, 0xB2, 0x43, 0x33, 0xB9, 0x8A, 0xF9, 
+0xD2, 0xA5, 0xFC, 0x91, 0xF1, 0x76, 0x6C, 0x39, 0x7C, 0x61, 0xE4, 0x3F, 0xCB, 0xCB, 0x99, 0x7D, 
+0x80, 0x2D, 0xC2, 0xBF, 0xB1, 0xFD, 0x0F, 0xD6, 0xC8, 0x31, 0x90, 0xC3, 0x82, 0x05, 0x87, 0xA6, 
+0x4D, 0xAF, 0xF8, 0x72, 0xBB, 0x5E, 0x92, 0x4D, 0x26, 0xB5, 0xAC, 0x6A, 0xD6, 0x52, 0xA7, 0x6E, 
+0x64, 0x9F, 0xBF, 0xA3, 0x62, 0x78, 0x04, 0xFC, 0x68, 0xC7, 0x31, 0x7B, 0x34, 0x61, 0x51, 0x1D, 
+0x9E, 0x48, 0xA7, 0x0C, 0xE3, 0xCD, 0x4D, 0x5D, 0x00, 0x45, 0x3D, 0xED, 0xE9, 0x83, 0x04, 0xA7, 
+0x6C, 0xC9, 0x6D, 0x81, 0xD9, 0x7D, 0x09, 0x2B, 0xB7, 0xB7, 0x11, 0x0A, 0x90, 0x80, 0xB9, 0xCB, 
+0x99, 0x00, 0xF0, 0x2B, 0xD0, 0x3B, 0xD2, 0x84, 0x21, 0xBC, 0x5E, 0xD4, 0x16, 0x09, 0x93, 0xF9, 
+0xD1, 0x61, 0x5C, 0xC4, 0xCA, 0x9A, 0x39, 0x42, 0xF1, 0x1F, 0x30, 0x92, 0x4B, 0xE3, 0x7E, 0x7E, 
+0x4B, 0x23, 0x39, 0x6F, 0x6F, 0x45, 0x9B, 0x8C, 0x48, 0x07, 0x21, 0x26, 0x40, 0x5A, 0xC4, 0xEB, 
+0x8C, 0xC2, 0x6A, 0x8C, 0x83, 0x66, 0xC7, 0xC9, 0x4A, 0x4B, 0x7C, 0x68, 0x85, 0x49, 0x52, 0xFD, 
+0x8E, 0x49, 0xA5, 0xBA, 0x50, 0x1E, 0x15, 0x67, 0xEC, 0x84, 0x9F, 0x28, 0x4A, 0x1B, 0xCD, 0x8C, 
+0x65, 0xB5, 0x2D, 0xA7, 0x2B, 0xAD, 0x2D, 0x98, 0x32, 0xB0, 0x44, 0x2B, 0xBC, 0x11, 0xC9, 0xBD, 
+0x89, 0x7D, 0xF9, 0xB9, 0x81, 0xAC, 0x38, 0x49, 0x0A, 0xDF, 0xBB, 0x95, 0xD3, 0xF8, 0xD9, 0xCF, 
+0x77, 0xF1, 0x5A, 0xA0, 0x80, 0xA7, 0x0D, 0xCC, 0x4C, 0xD8, 0xE1, 0x1E, 0xAF, 0xD3, 0xC4, 0xC6, 
+0x2B, 0xFD, 0x53, 0x7F, 0x72, 0x1C, 0xC7, 0x9A, 0x5C, 0x2D, 0xC6, 0xBF, 0x3A, 0x5E, 0x79, 0x92, 
+0xBC, 0x86, 0x5D, 0x53, 0xBB, 0x4C, 0x85, 0xAB, 0x21, 0x32, 0x0E, 0xA0, 0x25, 0x06, 0x2C, 0x78, 
+0xA0, 0xF9, 0xD9, 0xCF, 0x01, 0xFA, 0xAF, 0x5D, 0x25, 0xFC, 0x4E, 0x86, 0x0A, 0x8C, 0x9E, 0xA6, 
+0x48, 0xCA, 0x70, 0xA1, 0xEB, 0x62, 0x79, 0x5F, 0x1C, 0x2E, 0x4C, 0x57, 0xD9, 0x61, 0xE4, 0xD6, 
+0xF8, 0x66, 0xAB, 0x75, 0x8C, 0xB9, 0xC9, 0x70, 0x18, 0x18, 0xF6, 0x9E, 0x28, 0xAF, 0xF5, 0x51, 
+0xD9, 0x9A, 0xCD, 0xA9, 0x58, 0xEF, 0xC8, 0xE3, 0x60, 0x05, 0xB8, 0x51, 0x5B, 0xEA, 0x43, 0xB5, 
+0xD5, 0xCD, 0xE5, 0x27, 0x30, 0xA3, 0x96, 0x94, 0x1E, 0x63, 0x64, 0x98, 0x88, 0x79, 0xFF, 0xE8, 
+0x0D, 0xAB, 0xA5, 0xA8, 0xE5, 0x1A, 0x4E, 0x25, 0x39, 0x30, 0x86, 0x5F, 0x39, 0x3E, 0xCF, 0xB1, 
+0x76, 0xF4, 0x97, 0xA7, 0x7F, 0x97, 0xFD, 0x0F, 0x1C, 0x02, 0xA4, 0xB7, 0xE7, 0x11, 0xA4, 0x31, 
+0x7D, 0x76, 0xBD, 0x4E, 0x82, 0x1C, 0x25, 0x36, 0x76, 0xB7, 0xF2, 0x0E, 0x14, 0x92, 0xE7, 0xD9, 
+0x09, 0x29, 0xFE, 0xA1, 0x08, 0xC4, 0xAE, 0xB4, 0x79, 0x4F, 0xFD, 0xE7, 0x34, 0x19, 0x81, 0x94, 
+0xE9, 0x54, 0xF2, 0x31, 0x65, 0xE6, 0x24, 0xFA, 0x7A, 0x25, 0x95, 0xDC, 0x02, 0x16, 0x57, 0x32, 
+0x12, 0x30, 0x52, 0x80, 0x65, 0xB1, 0x3D, 0x58, 0x95, 0x89, 0xF0, 0x2D, 0x67, 0x60, 0xEC, 0xCF, 
+0xB6, 0x08, 0x93, 0xBA, 0x92, 0x35, 0xAF, 0xD6, 0xB8, 0x16, 0x16, 0xB7, 0xB2, 0x62, 0x13, 0x21, 
+0xB8, 0x2A, 0x42, 0x59, 0xD0, 0xE0, 0x4D, 0x57, 0x84, 0x5B, 0x59, 0x37, 0x28, 0xAC, 0x72, 0x28, 
+0xDF, 0x03, 0xCE, 0x85, 0x2F, 0x61, 0x49, 0xEB, 0x3B, 0x56, 0xEB, 0x32, 0x66, 0x94, 0x07, 0x58, 
+0xAE, 0xAA, 0x91, 0x46, 0xC8, 0x74, 0x75, 0x8D, 0x44, 0x42, 0xA7, 0x27, 0xF5, 0xF4, 0x5E, 0x35, 
+0x34, 0xEB, 0x64, 0xDF, 0xB8, 0xC2, 0xA4, 0x6B, 0x4C, 0xB7, 0xA3, 0x5E, 0x89, 0x2B, 0x3A, 0x94, 
+0x78, 0x73, 0xE8, 0x76, 0x8C, 0x19, 0x4B, 0x36, 0xCF, 0x9B, 0x63, 0xAE, 0x9B, 0x6A, 0xC7, 0x1E, 
+0x59, 0xE8, 0x0B, 0xBF, 0xB8, 0xB4, 0x9A, 0xE2, 0x72, 0xF3, 0x47, 0xAD, 0x7C, 0x9C, 0xA8, 0x7C, 
+0xF7, 0x29, 0xC4, 0x0F, 0x84, 0xAD, 0x27, 0x4C, 0xF2, 0xA1, 0x36, 0x8F, 0xA8, 0x29, 0xDD, 0xD4, 
+0x40, 0xAE, 0xD7, 0x86, 0xE7, 0xCC, 0xC7, 0x84, 0x9C, 0x74, 0xDA, 0x74, 0xBD, 0x99, 0x65, 0x4C, 
+0x36, 0x88, 0xD9, 0x75, 0x34, 0xC5, 0xD0, 0x42, 0xBA, 0x0B, 0xF1, 0xB1, 0x1C, 0x7A, 0xD6, 0xE9, 
+0xC7, 0xA6, 0xC6, 0x85, 0x20, 0x71, 0xE1, 0xEA, 0xE1, 0x17, 0x35, 0x8F, 0x45, 0x89, 0x89, 0x24, 
+0xA7, 0x83, 0xA4, 0xA5, 0x43, 0x98, 0x61, 0xAB, 0x0E, 0x38, 0xDB, 0xD4, 0x4B, 0x0E, 0x4A, 0xB5, 
+0x4D, 0x5D, 0x61, 0xF4, 0x34, 0x4B, 0xAB, 0x83, 0x4A, 0xCB, 0xAA, 0x05, 0x54, 0x67, 0x24, 0xAC, 
+0x6C, 0x15, 0x4D, 0xAF, 0x0F, 0x6A, 0x63, 0x30, 0xC9, 0x51, 0x5D, 0x58, 0x28, 0x31, 0x95, 0x8E, 
+0x1B, 0x76, 0xE6, 0x9E, 0x83, 0x93, 0x63, 0x76, 0xFA, 0x48, 0xDC, 0x33, 0x3D, 0xA2, 0x9B, 0x7E, 
+0xD2, 0x9A, 0xC0, 0x2E, 0x26, 0xDA, 0xAA, 0xC1, 0x8C, 0x1B, 0xA2, 0x27, 0x46, 0x6D, 0x4D, 0x7F, 
+0xAF, 0x8F, 0x6F, 0x87, 0xF9, 0x44, 0x3F, 0xBB, 0x74, 0xF0, 0x48, 0x43, 0xD7, 0xCB, 0xE1, 0xC5, 
+0xD4, 0x31, 0x8E, 0x1F, 0xB1, 0x62, 0x8A, 0x6F, 0x38, 0xCB, 0x05, 0x8E, 0x5B, 0xD8, 0xB9, 0x25, 
+0xE8, 0x1B, 0x19, 0x4C, 0x18, 0x3F, 0xED, 0x84, 0x85, 0xCB, 0x95, 0xCF, 0xAB, 0x0E, 0x2A, 0x39, 
+0x25, 0x9F, 0x4E, 0xF8, 0xA0, 0xD8, 0xE6, 0x91, 0x7B, 0x7B, 0xDD, 0x6B, 0x52, 0x36, 0xB4, 0x1B, 
+0x47, 0x62, 0x84, 0x9F, 0xD4, 0x96, 0x99, 0xF7, 0xC4, 0x54, 0x9C, 0x17, 0x0F, 0xD6, 0x3C, 0x5D, 
+0x06, 0x21, 0x77, 0xFF, 0xB6, 0x09, 0xBE, 0xD6, 0xCF, 0x9E, 0xDD, 0xC9, 0xFD, 0x2C, 0x1D, 0x75, 
+0xB0, 0x56, 0x81, 0x22, 0x33, 0xB7, 0x3A, 0x39, 0xA4, 0x31, 0x03, 0xE3, 0xAA, 0x6F, 0xE2, 0x4C, 
+0xD9, 0xB4, 0x3B, 0xC6, 0xD4, 0xF6, 0xDB, 0x34, 0x29, 0x69, 0xA0, 0x41, 0x4A, 0x4F, 0x65, 0x56, 
+0x77, 0x65, 0x89, 0xCE, 0xEE, 0x42, 0xA3, 0x21, 0xE7, 0x25, 0xA8, 0xA0, 0xC0, 0x92, 0xD2, 0xA5, 
+0x3F, 0xCE, 0x64, 0x76, 0xA3, 0x9A, 0xEE, 0x07, 0x00, 0x6E, 0xC3, 0x9F, 0xAD, 0xA3, 0x7B, 0xC4, 
+0x07, 0x9B, 0x23, 0x8A, 0xE6, 0x71, 0x45, 0x01, 0xC0, 0x23, 0x51, 0xDA, 0xB7, 0xB2, 0x7C, 0x81, 
+0xA0, 0xF0, 0x9B, 0x25, 0xC9, 0xEA, 0xC9, 0xDC, 0x96, 0xB8, 0x1F, 0xD3, 0xD5, 0x40, 0x95, 0x7D, 
+0xE9, 0x52, 0x59, 0x8E, 0x94, 0x7A, 0xBA, 0x18, 0x93, 0xD9, 0x9E, 0xF4, 0x03, 0x5D, 0x5A, 0xDB, 
+0x77, 0x99, 0x1D, 0xC3, 0xEE, 0x48, 0x11, 0x50, 0xAF, 0x63, 0x17, 0x1A, 0xFD, 0x86, 0x9F, 0xBD, 
+0x42, 0x2B, 0xF1, 0x31, 0xD8, 0xA6, 0x01, 0x7B, 0x65, 0xEA, 0x07, 0xF1, 0xB4, 0x32, 0xE2, 0xC3, 
+0xE6, 0x48, 0xE5, 0x39, 0xBE, 0xF9, 0x90, 0x82, 0x64, 0x62, 0x78, 0x07, 0xE4, 0x18, 0xEA, 0x95, 
+0x51, 0x3A, 0xCF, 0xC0, 0x63, 0x1C, 0xBD, 0x81, 0xEF, 0x37, 0xA0, 0x6E, 0x29, 0xDC, 0x15, 0x75, 
+0x7C, 0x62, 0xAF, 0x06, 0xCC, 0xAE, 0x2A, 0xE1, 0x0D, 0x8B, 0x6E, 0xC6, 0x72, 0x73, 0x06, 0x5D, 
+0x45, 0x71, 0xB3, 0x7D, 0xC5, 0xEC, 0xC5, 0x50, 0xBA, 0x29, 0x7A, 0xCD, 0x85, 0xDF, 0xE5, 0x0D, 
+0x94, 0x51, 0xCC, 0xF3, 0x8B, 0xC3, 0xA7, 0x3E, 0xAD, 0x3D, 0x70, 0xEE, 0x18, 0x8E, 0x20, 0x5A, 
+0x43, 0xDC, 0xAD, 0xE4, 0x3D, 0x31, 0x64, 0x28, 0x2E, 0xFD, 0x22, 0x0B, 0x70, 0x54, 0x97, 0x7C, 
+0x30, 0xF0, 0x21, 0x5C, 0x06, 0x7B, 0x6B, 0xBD, 0x20, 0x1D, 0x1D, 0xA4, 0xE2, 0x11, 0xD8, 0xFF, 
+0x43, 0x8F, 0x89, 0x9B, 0xD6, 0x3A, 0xDA, 0xF1, 0x5C, 0x1D, 0x79, 0xD8, 0x96, 0x6B, 0xB3, 0xED, 
+0xBF, 0xA8, 0x57, 0xDE, 0x45, 0xAD, 0x01, 0xF4, 0x89, 0xA6, 0xBF, 0x0D, 0xEF, 0xD7, 0x08, 0x70, 
+0x59, 0xB7, 0xE4, 0x6C, 0x5A, 0xC3, 0xCA, 0x44, 0xA0, 0x1F, 0x03, 0xCE, 0x82, 0xB1, 0x6F, 0xB0, 
+0x04, 0x28, 0x93, 0x3D, 0x7C, 0x41, 0x9F, 0xB5, 0xC8, 0xAD, 0xE4, 0xAD, 0x3E, 0x30, 0x4D, 0x43, 
+0x9B, 0x4A, 0x3D, 0x64, 0x34, 0xDA, 0x04, 0xF2, 0x87, 0x58, 0xC2, 0x0C, 0xFA, 0x73, 0xF2, 0x4C, 
+0x5F, 0x2E, 0x95, 0x8F, 0xD7, 0x79, 0x9B, 0x1D, 0xAE, 0x05, 0x4F, 0xB4, 0x45, 0x9F, 0xAF, 0x61, 
+0xB5, 0xAF, 0x15, 0x8E, 0xE6, 0x51, 0xDD, 0xB1, 0xCF, 0x62, 0x00, 0xEB, 0x81, 0x93, 0x01, 0x85, 
+0x1D, 0x6F, 0x62, 0x8E, 0x93, 0xCD, 0x81, 0xA5, 0x3C, 0xD1, 0xD8, 0x35, 0x45, 0x10, 0x5D, 0x0B, 
+0x18, 0xE7, 0x5A, 0xD7, 0x29, 0x50, 0xDC, 0xA6, 0xBF, 0x8B, 0xEB, 0x1F, 0x5D, 0x03, 0x1B, 0x99, 
+0x4D, 0x23, 0x87, 0xA5, 0x9F, 0x83, 0xB5, 0x37, 0x2C, 0x10, 0xAD, 0xA8, 0xC1, 0xC1, 0xFE, 0x13, 
+0x16, 0xC3, 0x9A, 0xA3, 0x3A, 0xD5, 0x55, 0x05, 0x86, 0x58, 0xDA, 0xB0, 0xA6, 0xBB, 0x32, 0x0D, 
+0xB6, 0x72, 0xBD, 0xB8, 0xF9, 0xEA, 0xD3, 0x08, 0xA3, 0x98, 0xAB, 0xA1, 0x1C, 0x95, 0x67, 0x6E, 
+0xF1, 0x22, 0x46, 0xC2, 0x7C, 0x2F, 0xE1, 0x22, 0x60, 0x7D, 0xC4, 0x0A, 0x3E, 0x07, 0x13, 0x28, 
+0xC2, 0xC0, 0xBE, 0xA2, 0x44, 0x20, 0x6F, 0xC9, 0x42, 0xC4, 0x5B, 0x9F, 0xBA, 0x20, 0xB1, 0xD6, 
+0x15, 0x87, 0x8E, 0x60, 0xFA, 0x28, 0x44, 0x4A, 0x14, 0x23, 0x1A, 0xE8, 0x4F, 0xBB, 0x58, 0x67, 
+0x44, 0x27, 0x7E, 0x3D, 0xB4, 0x5C, 0x61, 0x81, 0x21, 0x65, 0x4B, 0x53, 0x7B, 0xCB, 0x15, 0xC5, 
+0x65, 0x60, 0x58, 0x69, 0x2C, 0x8E, 0xA1, 0x09, 0x11, 0x58, 0x43, 0x88, 0xA3, 0xAD, 0x6B, 0x7A, 
+0xA6, 0x61, 0x8A, 0x0A, 0xC6, 0x9C, 0x4D, 0x10, 0x66, 0xDA, 0x60, 0xEB, 0x25, 0x80, 0x73, 0xE6, 
+0xB1, 0xC3, 0xB7, 0xF8, 0x0B, 0x38, 0x18, 0x4F, 0xC4, 0xDA, 0xEA, 0x26, 0xCF, 0x5C, 0xAE, 0xBA, 
+0xC9, 0x1D, 0xDB, 0x72, 0xD0, 0x61, 0x36, 0x75, 0xA9, 0x38, 0x59, 0x04, 0x05, 0x54, 0x26, 0xF5, 
+0x0F, 0x16, 0x44, 0xD0, 0xBC, 0x10, 0x2C, 0x04, 0x8D, 0xC6, 0x60, 0xCF, 0x04, 0xF3, 0x34, 0x6A, 
+0x11, 0x3A, 0x60, 0x18, 0xA2, 0x75, 0x2B, 0x0D, 0x47, 0xAF, 0x2E, 0x59, 0x15, 0xC3, 0x52, 0x0C, 
+0x70, 0x34, 0xD4, 0x1C, 0xC2, 0x6E, 0xF1, 0x62, 0x9E, 0xAC, 0xC8, 0x44, 0x3D, 0x51, 0x31, 0xF4, 
+0x3D, 0x72, 0xA4, 0xE9, 0x57, 0xFF, 0xD0, 0x9A, 0x8A, 0xF8, 0x24, 0x67, 0x21, 0xAC, 0x53, 0x6E, 
+0x62, 0xDF, 0x50, 0x10, 0xF5, 0xF9, 0x1E, 0xA5, 0xAD, 0xBF, 0x0C, 0xEF, 0x21, 0x58, 0x4D, 0xE7, 
+0x81, 0x28, 0xB7, 0x92, 0xBA, 0xAC, 0xDD, 0x53, 0xB9, 0x91, 0x71, 0x26, 0xD8, 0x82, 0x7C, 0x1A, 
+0x80, 0x9F, 0xD1, 0x1E, 0x9C, 0x7E, 0x46, 0x24, 0x76, 0xB0, 0x93, 0xDF, 0x80, 0xF0, 0x76, 0xFA, 
+0x6A, 0xB6, 0x48, 0xF2, 0xCC, 0x1A, 0xDB, 0xCA, 0xD7, 0xDB, 0x95, 0x1F, 0x21, 0x87, 0x53, 0x80, 
+0xE4, 0x53, 0xB3, 0x12, 0xC4, 0x28, 0xF9, 0xE4, 0xCC, 0x2D, 0x20, 0x0C, 0xA6, 0xFB, 0x02, 0x65, 
+0x8A, 0x0F, 0x32, 0x3B, 0xA8, 0x99, 0xF6, 0x43, 0x1D, 0xDC, 0x3F, 0x68, 0xAB, 0x5B, 0xD3, 0xB8, 
+0x8B, 0x54, 0xCC, 0x7B, 0xC3, 0x36, 0xCE, 0xB2, 0xCB, 0xC7, 0x5A, 0xBC, 0x14, 0xFA, 0x66, 0xEC, 
+0x18, 0x8E, 0xAD, 0xAD, 0x1E, 0x9B, 0x8A, 0xB7, 0xFD, 0x3B, 0x7C, 0x10, 0x29, 0xE2, 0x98, 0x00, 
+0x8D, 0x2D, 0x8D, 0xD7, 0xAC, 0xC3, 0xAF, 0xD4, 0x7D, 0x3E, 0x64, 0x5D, 0xD4, 0x96, 0xE4, 0x8C, 
+0xBC, 0x2E, 0xF8, 0xBB, 0x24, 0xA5, 0xB8, 0x51, 0x80, 0xF6, 0x69, 0x78, 0xCD, 0xA2, 0xED, 0xDA, 
+0x00, 0xBF, 0x3D, 0x4D, 0x53, 0x47, 0x2C, 0xD2, 0x99, 0xC7, 0x54, 0x05, 0x25, 0x5B, 0x0E, 0xDF, 
+0xE2, 0x17, 0x7E, 0xE5, 0x4B, 0xDB, 0xCE, 0xB1, 0x76, 0xD1, 0x40, 0xC8, 0xE1, 0x16, 0x32, 0xB4, 
+0x71, 0xC9, 0x79, 0x7F, 0xEB, 0x49, 0x20, 0xAF, 0x3E, 0x41, 0xE6, 0xBE, 0xB2, 0xE2, 0x25, 0x4D, 
+0x46, 0x45, 0x1F, 0x1A, 0x7A, 0x21, 0x82, 0xE6, 0x85, 0x60, 0x2B, 0x4A, 0x5E, 0x13, 0xCB, 0x6A, 
+0x53, 0x47, 0xF1, 0xC2, 0x54, 0x36, 0xC3, 0xD0, 0xA0, 0x09, 0xA4, 0x7C, 0xEE, 0xB6, 0x68, 0xEC, 
+0xCD, 0xDB, 0x2D, 0x4A, 0x3B, 0x81, 0xD2, 0x40, 0x7A, 0xA6, 0xA1, 0x62, 0xD4, 0x45, 0xF9, 0x37, 
+0x0C, 0xE9, 0xE0, 0x2E, 0x95, 0x38, 0x5B, 0xC1, 0x28, 0x1A, 0x50, 0xE5, 0x84, 0x62, 0x60, 0xE0, 
+0xAF, 0xB4, 0xFB, 0xF6, 0x49, 0xB1, 0xE4, 0xC5, 0xE5, 0x36, 0x6D, 0xE5, 0x0B, 0x9E, 0xC0, 0x92, 
+0x3F, 0x96, 0x8C, 0x7B, 0xC5, 0x9E, 0x1C, 0x3C, 0x46, 0xE0, 0x0D, 0x0A, 0xC4, 0x7B, 0xB4, 0xAB, 
+0xFD, 0xE3, 0x66, 0xD2, 0xA5, 0x88, 0x81, 0x51, 0xDB, 0x8E, 0x35, 0x6A, 0x0F, 0x0B, 0x4B, 0xAC, 
+0xFB, 0x62, 0xD6, 0x66, 0xFC, 0x19, 0x8C, 0x6B, 0x49, 0xEF, 0x9F, 0x54, 0xB8, 0xD4, 0x6D, 0xE5, 
+0x4B, 0xAC, 0x6C, 0x48, 0xB5, 0x16, 0x4F, 0x15, 0x6A, 0xCF, 0xEB, 0xBE, 0xC7, 0x2A, 0x11, 0x29, 
+0xC2, 0xB2, 0x57, 0xDD, 0x7C, 0x64, 0xB8, 0x8E, 0xEA, 0xC5, 0x17, 0x86, 0x6E, 0x5F, 0xB2, 0x82, 
+0x49, 0xB0, 0x5F, 0x71, 0x85, 0x55, 0xFC, 0x0C, 0xAB, 0xF9, 0x1D, 0x16, 0x8D, 0x08, 0x6F, 0x67, 
+0xA1, 0xD4, 0x62, 0xA6, 0xB3, 0xBC, 0x2B, 0xEB, 0x7C, 0x5E, 0xEB, 0xF4, 0x73, 0x35, 0xD1, 0x38, 
+0xDF, 0xA7, 0xED, 0x6C, 0x85, 0xC9, 0x73, 0x03, 0x18, 0x87, 0x91, 0xBD, 0xC2, 0x70, 0xED, 0xDA, 
+0x69, 0x35, 0xDA, 0xF5, 0x62, 0x8B, 0x8D, 0x8A, 0xBA, 0x9E, 0xBF, 0x58, 0xFF, 0x42, 0xD7, 0xAC, 
+0xAA, 0x15, 0x55, 0xDE, 0xBE, 0xB3, 0xAC, 0xFE, 0x7B, 0x70, 0x5D, 0x1E, 0x01, 0x3D, 0xDB, 0xDD, 
+0x9C, 0x97, 0x01, 0x62, 0x2F, 0x3E, 0x5E, 0x35, 0xE0, 0x79, 0x13, 0xC7, 0x4C, 0xD6, 0x01, 0xF6, 
+0x19, 0x9E, 0xB3, 0x21, 0xCF, 0x1B, 0x58, 0x24, 0x25, 0xFE, 0x17, 0x69, 0x45, 0x23, 0xDE, 0x7A, 
+0xF1, 0x70, 0x00, 0x09, 0xF2, 0x55, 0x3A, 0xC7, 0x29, 0x99, 0x96, 0xBA, 0xBC, 0x7F, 0x28, 0xF3, 
+0xDA, 0xD4, 0x1B, 0x0E, 0x98, 0x37, 0x68, 0xAB, 0x9E, 0x8A, 0xA1, 0x0E, 0x0C, 0x36, 0x2D, 0xF5, 
+0xF0, 0x74, 0x6C, 0x19, 0x02, 0x8F, 0xE4, 0x53, 0xED, 0x61, 0xBD, 0x5A, 0x2D, 0x97, 0x44, 0xF5, 
+0xE8, 0x5D, 0x29, 0xD9, 0xBE, 0x49, 0x39, 0x66, 0x83, 0x9A, 0xD3, 0xDA, 0x58, 0x8F, 0x13, 0x2B, 
+0x41, 0xFD, 0x2A, 0xAD, 0x29, 0xCD, 0xAC, 0x27, 0x5C, 0x87, 0x66, 0x4C, 0xD1, 0xF7, 0x66, 0xCA, 
+0x5D, 0xBD, 0x2D, 0xF9, 0xDE, 0xAE, 0xB1, 0x23, 0xA2, 0xA4, 0xB7, 0xB7, 0x1A, 0xDD, 0xAA, 0x10, 
+0xA6, 0xE3, 0xE2, 0x61, 0xA3, 0xBE, 0xDC, 0x16, 0x5B, 0x29, 0xFA, 0xF1, 0x40, 0xFC, 0x93, 0xE9, 
+0xEC, 0xCA, 0xFC, 0xD9, 0x5E, 0x31, 0x2F, 0x90, 0x7C, 0x76, 0x08, 0x94, 0x8F, 0x13, 0x46, 0xB0, 
+0x8F, 0xC4, 0xA9, 0x9B, 0xEB, 0xA1, 0x06, 0x5E, 0x83, 0x55, 0xD3, 0xFB, 0xE8, 0xED, 0xF3, 0xFE, 
+0xFB, 0x63, 0x2C, 0x8B, 0x88, 0x8E, 0x91, 0x33, 0xDA, 0x60, 0xF0, 0xE4, 0xC0, 0x0B, 0x26, 0xD8, 
+0x56, 0xBB, 0xC7, 0x76, 0x77, 0x88, 0x3E, 0x72, 0xCF, 0xBC, 0x7B, 0xE3, 0x68, 0x5D, 0x68, 0x09, 
+0xB1, 0xD6, 0xD0, 0x61, 0x95, 0xD7, 0x1D, 0x1B, 0xD6, 0x95, 0x20, 0xF4, 0xB3, 0x08, 0xC6, 0xF5, 
+0x25, 0x68, 0x10, 0x63, 0x01, 0x1C, 0xDB, 0xCA, 0x17, 0x97, 0x68, 0xE1, 0x8E, 0x0D, 0x59, 0x35, 
+0x43, 0x1A, 0x2A, 0xA7, 0xB5, 0x13, 0x56, 0x97, 0xF3, 0x37, 0xF3, 0xB4, 0x36, 0x21, 0xEA, 0xAD, 
+0xF7, 0x4E, 0xAB, 0xF1, 0xB0, 0x63, 0x1F, 0xC5, 0xFC, 0x66, 0xE3, 0xFD, 0x04, 0x80, 0xCC, 0x38, 
+0x61, 0x7B, 0x91, 0x32, 0x4E, 0x8E, 0x58, 0x84, 0xCD, 0x27, 0x16, 0x38, 0x59, 0x57, 0x6E, 0x6D, 
+0xAF, 0xA2, 0x21, 0x35, 0xBA, 0xD7, 0xC1, 0xEB, 0x4A, 0x60, 0x1C, 0xBF, 0xE4, 0x3A, 0x26, 0xA1, 
+0x44, 0x48, 0x87, 0x01, 0xC3, 0x72, 0x5F, 0x8D, 0x51, 0xDC, 0xAD, 0x6B, 0x8F, 0xD3, 0xDF, 0xD2, 
+0xD3, 0xF6, 0x0B, 0x55, 0x72, 0x7F, 0xFE, 0x79, 0xA1, 0x51, 0x32, 0xC8, 0x84, 0x08, 0x18, 0xD1, 
+0xB4, 0xC7, 0x5E, 0x4D, 0x7F, 0x3A, 0xC6, 0x49, 0xD7, 0x7B, 0x69, 0x5B, 0x50, 0xF3, 0x81, 0x22, 
+0xD0, 0xBB, 0x75, 0x03, 0xE0, 0x23, 0x4A, 0xD5, 0x7A, 0xAD, 0x1F, 0xB6, 0xCF, 0x0C, 0x73, 0x69, 
+0x5E, 0x37, 0x6A, 0xDA, 0x0F, 0x62, 0xA6, 0xA1, 0x6F, 0xC6, 0x4B, 0x36, 0xD4, 0x6F, 0xE6, 0x64, 
+0x67, 0x6B, 0xA1, 0x97, 0x20, 0x88, 0xA0, 0x18, 0x06, 0x52, 0x28, 0xA5, 0x57, 0x00, 0x43, 0x72, 
+0xC7, 0xB0, 0xFD, 0x8E, 0x59, 0x64, 0xDE, 0xAB, 0xAE, 0x10, 0xB1, 0x4E, 0xBE, 0x35, 0xA3, 0xCE, 
+0xB9, 0x72, 0x37, 0x95, 0x4E, 0xBE, 0x6C, 0x7B, 0x06, 0x26, 0x0E, 0xFA, 0x04, 0x0F, 0xFF, 0xBF, 
+0x6E, 0xD6, 0x83, 0x6B, 0xE2, 0xE1, 0x53, 0xE9, 0x91, 0x06, 0x06, 0x26, 0x77, 0xEA, 0x46, 0xB6, 
+0xD4, 0xED, 0xD5, 0xD1, 0x25, 0xFC, 0x18, 0x36, 0xA1, 0x3F, 0x16, 0x95, 0xC0, 0x27, 0x43, 0xA6, 
+0x81, 0x6B, 0x13, 0xBA, 0xA4, 0xE4, 0xAD, 0x49, 0xB1, 0x10, 0x6E, 0x46, 0x5E, 0x0B, 0x8E, 0x69, 
+0xC7, 0xC2, 0x6D, 0x78, 0xC8, 0xCE, 0x9A, 0xC1, 0xCD, 0x55, 0xE5, 0x92, 0xD7, 0xE3, 0x2D, 0x46, 
+0xFC, 0xA0, 0x86, 0xF3, 0x48, 0x49, 0x7D, 0x5A, 0x0F, 0x8A, 0x54, 0x9A, 0x15, 0x12, 0x8E, 0x68, 
+0xED, 0xD7, 0x2C, 0x28, 0xAF, 0xCC, 0xAA, 0x96, 0x58, 0xC7, 0x9C, 0xE5, 0x23, 0x2D, 0x32, 0x1E, 
+0x6C, 0x97, 0x27, 0xB9, 0xB0, 0xC6, 0xB3, 0x59, 0x8B, 0x89, 0xC3, 0x9A, 0x0E, 0x40, 0x79, 0xC9, 
+0xC9, 0x14, 0x93, 0x29, 0xE0, 0xAB, 0xCC, 0xD6, 0xD3, 0xA4, 0xF1, 0x0E, 0x71, 0x52, 0xBB, 0xC9, 
+0x01, 0xEA, 0x39, 0x74, 0x09, 0xFD, 0x47, 0xCC, 0x30, 0xE4, 0x05, 0x43, 0xB7, 0xB8, 0xBC, 0x16, 
+0x7E, 0x6C, 0xC4, 0x69, 0x59, 0x55, 0xB5, 0x9E, 0xCE, 0xB8, 0x37, 0x31, 0xB2, 0xED, 0x90, 0xFD, 
+0xCE, 0xDF, 0xCC, 0xC1, 0xF1, 0x1B, 0xBB, 0xCA, 0x1A, 0x07, 0xD9, 0xE4, 0x00, 0x3B, 0x33, 0xD7, 
+0xC0, 0xB4, 0x89, 0x90, 0xD4, 0x9C, 0xF1, 0x91, 0x4E, 0x17, 0x56, 0xDD, 0x45, 0x9D, 0x04, 0xE1, 
+0x23, 0xA1, 0x5C, 0xB0, 0x6E, 0xD3, 0xB4, 0x1C, 0x2A, 0x2B, 0xDD, 0x64, 0xEF, 0x14, 0x74, 0x3A, 
+0x73, 0xE3, 0x29, 0xD7, 0x79, 0xB6, 0x39, 0x85, 0xEA, 0x41, 0x26, 0x98, 0xE4, 0xF7, 0x0B, 0xB7, 
+0x1B, 0x0D, 0x3D, 0x13, 0xDD, 0xA7, 0xED, 0xAD, 0xC4, 0x54, 0x83, 0xDE, 0xA4, 0x34, 0x56, 0xC9, 
+0xB3, 0xCE, 0x94, 0xC9, 0x27, 0x9B, 0xBA, 0x65, 0xF9, 0xA4, 0xFD, 0x85, 0x5D, 0x40, 0x20, 0x9F, 
+0x10, 0x6F, 0xF9, 0x38, 0x2A, 0x6A, 0x16, 0xCC, 0x3D, 0x0A, 0x53, 0x3B, 0x8F, 0x9C, 0x4E, 0x2B, 
+0x41, 0xF5, 0x72, 0x7B, 0x59, 0xC5, 0x8B, 0xA7, 0x38, 0xEF, 0xAF, 0xBC, 0x9D, 0x02, 0x8D, 0xB4, 
+0xB6, 0x56, 0x88, 0x70, 0xDC, 0x50, 0x6F, 0x94, 0x40, 0xD8, 0x9E, 0x4D, 0x13, 0x7C, 0xA9, 0x37, 
+0x50, 0x50, 0x80, 0x00, 0xC9, 0xD5, 0xF5, 0xB9, 0x87, 0xF5, 0x6A, 0x2F, 0xC3, 0xEA, 0x4A, 0x6A, 
+0x3A, 0x5C, 0xFB, 0x56, 0x75, 0xDA, 0xBF, 0x4F, 0xF5, 0xAD, 0x78, 0x4B, 0x6B, 0x2B, 0x49, 0x6D, 
+0x66, 0xD6, 0x7E, 0x4F, 0x97, 0x62, 0xB3, 0xFE, 0x28, 0xAE, 0x18, 0xCD, 0xA5, 0xF6, 0x66, 0x93, 
+0x08, 0xC8, 0xE7, 0x83, 0x66, 0x25, 0x3B, 0x84, 0xAD, 0x19, 0xE7, 0xF4, 0xE5, 0xF6, 0xBF, 0x99, 
+0x26, 0xD9, 0xB9, 0xF3, 0x26, 0xD6, 0xF5, 0xBF, 0x29, 0x05, 0x88, 0xDB, 0x74, 0x0A, 0x58, 0x2D, 
+0x73, 0xD7, 0xB9, 0x87, 0x65, 0x0E, 0x28, 0x0E, 0xE6, 0xC7, 0xA5, 0x54, 0xC1, 0x6C, 0x90, 0x76, 
+0x3E, 0x09, 0x96, 0x53, 0xE5, 0x12, 0xC7, 0x53, 0x24, 0x07, 0x86, 0x10, 0x8E, 0x2B, 0x23, 0x43, 
+0x70, 0xB4, 0x50, 0x90, 0xE2, 0x7D, 0x9D, 0x56, 0xCE, 0x6F, 0xD3, 0x7F, 0x35, 0xDC, 0xF0, 0x73, 
+0xD3, 0x74, 0xCD, 0x22, 0x1C, 0x00
+};
+
+const size_t script_js_len = 10819;
+const size_t script_js_br_len = 9381;
+const size_t script_js_size = 42200; // Uncompressed
+const char script_js_hash[] = "bc6ef452";
+
+#endif
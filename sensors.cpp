@@ -1,386 +1,527 @@
-#include "sensors.h"
-#include <algorithm>
-#include <vector>
-
-DHT dht(DHT_PIN, DHT11);
-OneWire oneWire(ONE_WIRE_BUS);
-DallasTemperature sensors(&oneWire);
-
-void initSensors() {
-    dht.begin();
-    
-    // DHT11 needs 2 seconds to stabilize after power-on
-    delay(2000);
-    
-    // Perform dummy reads to flush initial garbage data
-    dht.readTemperature();
-    dht.readHumidity();
-    
-    sensors.begin();
-    pinMode(PIR_PIN, INPUT);
-    pinMode(TRIG_PIN, OUTPUT);
-    pinMode(ECHO_PIN, INPUT);
-    pinMode(SOIL_MOISTURE_PIN, INPUT);
-    pinMode(LDR_PIN, INPUT);
-    
-    // Attach interrupt for PIR sensor
-    attachInterrupt(digitalPinToInterrupt(PIR_PIN), []() {
-        extern volatile bool motionDetectedFlag;
-        motionDetectedFlag = true;
-    }, RISING);
-}
-
-// Flag to capture motion events from ISR
-volatile bool motionDetectedFlag = false;
-
-float readAmbientTemp() {
-    const int NUM_SAMPLES = 10;
-    const int TRIM_COUNT = 2; // Remove top 2 and bottom 2
-    std::vector<float> samples;
-    
-    // Take 10 samples with small delay
-    for (int i = 0; i < NUM_SAMPLES; ++i) {
-        float t = dht.readTemperature();
-        if (!isnan(t)) {
-            samples.push_back(t);
-        }
-        delay(100); // DHT11 needs time between readings
-    }
-    
-    // Need at least enough samples to trim
-    if (samples.size() < (TRIM_COUNT * 2 + 1)) return -999.0;
-    
-    // Sort samples to identify outliers
-    std::sort(samples.begin(), samples.end());
-    
-    // Calculate Trimmed Mean (average of central values)
-    float sum = 0;
-    int count = 0;
-    
-    for (size_t i = TRIM_COUNT; i < samples.size() - TRIM_COUNT; ++i) {
-        sum += samples[i];
-        count++;
-    }
-    
-    if (count == 0) return -999.0;
-    
-    float avgTemp = sum / count;
-    
-    // Round to 1 decimal place
-    return round(avgTemp * 10.0) / 10.0;
-}
-
-float readAmbientHumidity() {
-    const int NUM_SAMPLES = 10;
-    const int TRIM_COUNT = 2; // Remove top 2 and bottom 2
-    std::vector<float> samples;
-    
-    // Take 10 samples with small delay
-    for (int i = 0; i < NUM_SAMPLES; ++i) {
-        float h = dht.readHumidity();
-        if (!isnan(h)) {
-            samples.push_back(h);
-        }
-        delay(100); // DHT11 needs time between readings
-    }
-    
-    // Need at least enough samples to trim
-    if (samples.size() < (TRIM_COUNT * 2 + 1)) return -999.0;
-    
-    // Sort samples to identify outliers
-    std::sort(samples.begin(), samples.end());
-    
-    // Calculate Trimmed Mean (average of central values)
-    float sum = 0;
-    int count = 0;
-    
-    for (size_t i = TRIM_COUNT; i < samples.size() - TRIM_COUNT; ++i) {
-        sum += samples[i];
-        count++;
-    }
-    
-    if (count == 0) return -999.0;
-    
-    float avgHumidity = sum / count;
-    
-    // Round to 1 decimal place
-    return round(avgHumidity * 10.0) / 10.0;
-}
-
-float readSoilTemp() {
-    sensors.requestTemperatures();
-    float t = sensors.getTempCByIndex(0);
-    if (t == DEVICE_DISCONNECTED_C) return -999.0;
-    return t;
-}
-
-int readSoilMoisturePercent() {
-    const int NUM_SAMPLES = 10;
-    const int TRIM_COUNT = 2; // Remove top 2 and bottom 2
-    std::vector<int> samples;
-    
-    // Take 10 samples with small delay
-    for (int i = 0; i < NUM_SAMPLES; ++i) {
-        int raw = analogRead(SOIL_MOISTURE_PIN);
-        if (raw >= 100) { // Only add valid readings
-            samples.push_back(raw);
-        }
-        delay(2); // Reduced delay to 2ms
-    }
-    
-    // Need at least enough samples to trim
-    if (samples.size() < (TRIM_COUNT * 2 + 1)) return -999;
-    
-    // Sort samples to identify outliers
-    std::sort(samples.begin(), samples.end());
-    
-    // Calculate Trimmed Mean (average of central values)
-    int sum = 0;
-    int count = 0;
-    
-    for (size_t i = TRIM_COUNT; i < samples.size() - TRIM_COUNT; ++i) {
-        sum += samples[i];
-        count++;
-    }
-    
-    if (count == 0) return -999;
-    
-    int avgRaw = sum / count;
-    Serial.println(avgRaw);
-    // Map to percentage
-    int percent = map(avgRaw, SOIL_DRY, SOIL_WET, 0, 100);
-    return constrain(percent, 0, 100);
-}
-
-int readTankLevelPercent(float temp, float humidity) {
-    const int NUM_SAMPLES = 20;
-    const int TRIM_COUNT = 7;
-    std::vector<float> distances;
-    
-    // Calculate speed of sound with temperature and humidity correction
-    // Formula: v = 331.3 + 0.606*T + 0.0124*H (m/s)
-    // where T is temperature in °C and H is relative humidity in %
-    float speedOfSound = 331.3 + (0.606 * temp) + (0.0124 * humidity);
-    
-    // Convert to cm/us: speedOfSound (m/s) * 100 (cm/m) / 1000000 (us/s) = speedOfSound / 10000
-    float conversionFactor = speedOfSound / 10000.0; // One-way conversion
-    
-    // If temp/humidity sensors failed, fall back to standard speed (343 m/s at 20°C)
-    if (temp == -999 || humidity == -999) {
-        conversionFactor = 0.0343; // Standard: 343 m/s = 0.0343 cm/us
-    }
-    
-    for (int i = 0; i < NUM_SAMPLES; ++i) {
-        // Ensure trigger is LOW for at least 5us before pulsing
-        digitalWrite(TRIG_PIN, LOW);
-        delayMicroseconds(5);
-        
-        // Send 10us HIGH pulse to trigger
-        digitalWrite(TRIG_PIN, HIGH);
-        delayMicroseconds(10);
-        digitalWrite(TRIG_PIN, LOW);
-
-        // Wait for echo with 35ms timeout (enough for ~6m max distance)
-        long duration = pulseIn(ECHO_PIN, HIGH, 35000);
-        
-        if (duration > 0) {
-            // Calculate distance with corrected speed of sound
-            float distanceCm = (duration * conversionFactor) / 2.0; // Divide by 2 for one-way distance
-            
-            // Valid range check (2cm to 400cm for HC-SR04)
-            if (distanceCm >= 2.0 && distanceCm <= 400.0) {
-                distances.push_back(distanceCm);
-                Serial.print("Distancia: ");
-                Serial.println(distanceCm);
-            }
-        }
-
-        // Reduced delay to 30ms (User requested optimization)
-        delay(30); 
-    }
-    
-    // Need at least enough samples to trim
-    if (distances.size() < (TRIM_COUNT * 2 + 1)) return -999;
-    
-    // Sort to separate outliers
-    std::sort(distances.begin(), distances.end());
-    
-    // Calculate Trimmed Mean (average of the central values)
-    float sum = 0;
-    int count = 0;
-    // Start after bottom trim, end before top trim
-    for (size_t i = TRIM_COUNT; i < distances.size() - TRIM_COUNT; ++i) {
-        sum += distances[i];
-        count++;
-    }
-    
-    if (count == 0) return -999;
-    
-    float avgDistance = sum / count;
-    
-    // No rounding - keep full precision for accurate percentage calculation
-    Serial.print("Distancia Promedio (Usada): ");
-    Serial.println(avgDistance);
-    
-    // Constrain to valid range BEFORE calculation
-    // If distance >= TANK_DEPTH_CM (15.0), tank is empty (0%)
-    if (avgDistance >= TANK_DEPTH_CM) return 0;
-    
-    // If distance <= TANK_MIN_DISTANCE (8.5), tank is full (100%)
-    if (avgDistance <= TANK_MIN_DISTANCE) return 100;
-
-    // Calculate percentage for values in between
-    float effectiveDepth = (float)TANK_DEPTH_CM - TANK_MIN_DISTANCE;
-    float currentLevel = (float)TANK_DEPTH_CM - avgDistance;
-    
-    float percent = (currentLevel / effectiveDepth) * 100.0;
-    
-    return constrain((int)percent, 0, 100);
-}
-
-// Read Light Level (LDR) with robust trimmed mean filter
-int readLightLevel() {
-    const int NUM_SAMPLES = 10;
-    const int TRIM_COUNT = 2;
-    std::vector<int> samples;
-    
-    // Take 10 samples with small delay
-    for (int i = 0; i < NUM_SAMPLES; ++i) {
-        samples.push_back(analogRead(LDR_PIN));
-        delay(2);
-    }
-    
-    // Sort samples
-    std::sort(samples.begin(), samples.end());
-    
-    // Trim outliers (remove top 25% and bottom 25%)
-    int trimCount = NUM_SAMPLES / 4; // Remove 5 from each end
-    int sum = 0;
-    int count = 0;
-    
-    for (size_t i = trimCount; i < samples.size() - trimCount; ++i) {
-        sum += samples[i];
-        count++;
-    }
-    
-    if (count == 0) return -999;
-    
-    int avgValue = sum / count;
-    
-    // Sensor not connected or reading too low
-    if (avgValue < 10) return -999;
-    
-    // Calibrated range: LIGHT_MIN_RAW -> 0%, LIGHT_MAX_RAW -> 100%
-    if (avgValue <= LIGHT_MIN_RAW) return 0;
-    if (avgValue >= LIGHT_MAX_RAW) return 100;
-    Serial.println(avgValue);
-    int percent = map(avgValue, LIGHT_MIN_RAW, LIGHT_MAX_RAW, 0, 100);
-    return constrain(percent, 0, 100);
-}
-
-bool readMotionSensor() {
-    extern volatile bool motionDetectedFlag;
-    if (motionDetectedFlag) {
-        motionDetectedFlag = false; // Reset flag
-        return true;
-    }
-    return digitalRead(PIR_PIN) == HIGH;
-}
-
-// Read raw soil moisture ADC value (0-4095)
-int readSoilMoistureRaw() {
-    const int NUM_SAMPLES = 10;
-    const int TRIM_COUNT = 2;
-    std::vector<int> samples;
-    
-    for (int i = 0; i < NUM_SAMPLES; ++i) {
-        int raw = analogRead(SOIL_MOISTURE_PIN);
-        if (raw >= 100) {
-            samples.push_back(raw);
-        }
-        delay(2);
-    }
-    
-    if (samples.size() < (TRIM_COUNT * 2 + 1)) return -999;
-    
-    std::sort(samples.begin(), samples.end());
-    
-    int sum = 0;
-    int count = 0;
-    for (size_t i = TRIM_COUNT; i < samples.size() - TRIM_COUNT; ++i) {
-        sum += samples[i];
-        count++;
-    }
-    
-    if (count == 0) return -999;
-    return sum / count;
-}
-
-// Read raw light sensor ADC value (0-4095)
-int readLightRaw() {
-    const int NUM_SAMPLES = 10;
-    const int TRIM_COUNT = 2;
-    std::vector<int> samples;
-    
-    for (int i = 0; i < NUM_SAMPLES; ++i) {
-        samples.push_back(analogRead(LDR_PIN));
-        delay(2);
-    }
-    
-    std::sort(samples.begin(), samples.end());
-    
-    int trimCount = NUM_SAMPLES / 4;
-    int sum = 0;
-    int count = 0;
-    
-    for (size_t i = trimCount; i < samples.size() - trimCount; ++i) {
-        sum += samples[i];
-        count++;
-    }
-    
-    if (count == 0) return -999;
-    
-    int avgValue = sum / count;
-    if (avgValue < 10) return -999;
-    
-    return avgValue;
-}
-
-// Read raw ultrasonic distance in cm
-float readRawUltrasonicDistance() {
-    const int NUM_SAMPLES = 5; // Fewer samples for faster reading
-    std::vector<float> distances;
-    
-    // Use default speed of sound (can be improved with temp/humidity)
-    float conversionFactor = 0.0343; // 343 m/s = 0.0343 cm/us
-    
-    for (int i = 0; i < NUM_SAMPLES; ++i) {
-        digitalWrite(TRIG_PIN, LOW);
-        delayMicroseconds(5);
-        
-        digitalWrite(TRIG_PIN, HIGH);
-        delayMicroseconds(10);
-        digitalWrite(TRIG_PIN, LOW);
-        
-        long duration = pulseIn(ECHO_PIN, HIGH, 35000);
-        
-        if (duration > 0) {
-            float distanceCm = (duration * conversionFactor) / 2.0;
-            if (distanceCm >= 2.0 && distanceCm <= 400.0) {
-                distances.push_back(distanceCm);
-            }
-        }
-        delay(30);
-    }
-    
-    if (distances.size() == 0) return -999.0;
-    
-    // Simple average
-    float sum = 0;
-    for (float d : distances) {
-        sum += d;
-    }
-    
-    return sum / distances.size();
-}
-
+#include "sensors.h"
+#include "logic.h"
+#include "logger.h"
+#include "hal.h"
+#include <algorithm>
+
+void initSensors() {
+    halDhtBegin();
+    
+    // DHT11 needs 2 seconds to stabilize after power-on
+    halDelay(2000);
+    
+    // Perform dummy reads to flush initial garbage data
+    halDhtReadTemperature();
+    halDhtReadHumidity();
+    
+    halSoilProbeBegin();
+    halPinMode(PIR_PIN, INPUT);
+    halPinMode(TRIG_PIN, OUTPUT);
+    halPinMode(ECHO_PIN, INPUT);
+    halPinMode(SOIL_MOISTURE_PIN, INPUT);
+    halPinMode(LDR_PIN, INPUT);
+    
+    // Attach interrupt for PIR sensor
+    halAttachRisingInterrupt(PIR_PIN, []() {
+        extern volatile bool motionDetectedFlag;
+        motionDetectedFlag = true;
+    });
+}
+
+// Flag to capture motion events from ISR
+volatile bool motionDetectedFlag = false;
+
+// The samples of one read, on the stack. Same interface as the std::vector
+// the filters below used, without its heap allocation per read.
+template <typename T, int N>
+class SampleBuffer {
+public:
+    SampleBuffer() : count(0) {}
+
+    void push_back(T value) { if (count < N) values[count++] = value; }
+    size_t size() const { return count; }
+    T* begin() { return values; }
+    T* end() { return values + count; }
+    T operator[](size_t i) const { return values[i]; }
+
+private:
+    T values[N];
+    size_t count;
+};
+
+// ==========================================
+// Sensor Telemetry
+// ==========================================
+static const char* const CHANNEL_NAMES[SENSOR_CHANNEL_COUNT] = {
+    "temp", "humidity", "soilTemp", "soilMoisture", "soilRaw", "light", "lightRaw", "tankLevel", "tankDistance"
+};
+static const char* const REJECT_NAMES[SENSOR_REJECT_COUNT] = {"no_reading", "out_of_range"};
+
+static SensorStats sensorStats[SENSOR_CHANNEL_COUNT];
+// Acquisitions of the measurement in progress; loop task only, no lock
+static SensorStats pendingStats[SENSOR_CHANNEL_COUNT];
+
+// One read*() call. Counts locally and adds to pendingStats when it goes
+// out of scope; publishSensorStats() moves them to sensorStats.
+class Acquisition {
+public:
+    explicit Acquisition(SensorChannel channel)
+        : channel(channel), start(halMicros()), samples(0), valid(0), failed(false) {
+        rejects[REJECT_NO_READING] = rejects[REJECT_OUT_OF_RANGE] = 0;
+    }
+
+    ~Acquisition() {
+        unsigned long elapsed = halMicros() - start;
+        SensorStats& stats = pendingStats[channel];
+        stats.reads++;
+        if (failed) stats.failures++;
+        stats.samples += samples;
+        stats.valid += valid;
+        for (int i = 0; i < SENSOR_REJECT_COUNT; ++i) stats.rejects[i] += rejects[i];
+        stats.lastUs = elapsed;
+        if (elapsed > stats.maxUs) stats.maxUs = elapsed;
+        stats.totalUs += elapsed;
+    }
+
+    void accept() {
+        samples++;
+        valid++;
+    }
+
+    void reject(SensorReject reason) {
+        samples++;
+        rejects[reason]++;
+    }
+
+    // return acquisition.fail(-999);
+    template <typename T> T fail(T value) {
+        failed = true;
+        return value;
+    }
+
+private:
+    SensorChannel channel;
+    unsigned long start;
+    unsigned long samples;
+    unsigned long valid;
+    unsigned long rejects[SENSOR_REJECT_COUNT];
+    bool failed;
+};
+
+void publishSensorStats() {
+    for (int c = 0; c < SENSOR_CHANNEL_COUNT; ++c) {
+        SensorStats& pending = pendingStats[c];
+        if (pending.reads == 0) continue;
+        SensorStats& stats = sensorStats[c];
+        stats.reads += pending.reads;
+        stats.failures += pending.failures;
+        stats.samples += pending.samples;
+        stats.valid += pending.valid;
+        for (int i = 0; i < SENSOR_REJECT_COUNT; ++i) stats.rejects[i] += pending.rejects[i];
+        stats.lastUs = pending.lastUs;
+        if (pending.maxUs > stats.maxUs) stats.maxUs = pending.maxUs;
+        stats.totalUs += pending.totalUs;
+        memset(&pending, 0, sizeof(pending));
+    }
+}
+
+SensorStats getSensorStats(SensorChannel channel) {
+    lockState();
+    SensorStats stats = sensorStats[channel];
+    unlockState();
+    return stats;
+}
+
+const char* sensorChannelName(SensorChannel channel) {
+    return CHANNEL_NAMES[channel];
+}
+
+const char* sensorRejectName(SensorReject reason) {
+    return REJECT_NAMES[reason];
+}
+
+float readAmbientTemp() {
+    const int NUM_SAMPLES = 10;
+    const int TRIM_COUNT = 2; // Remove top 2 and bottom 2
+    SampleBuffer<float, NUM_SAMPLES> samples;
+    Acquisition acquisition(SENSOR_AMBIENT_TEMP);
+    
+    // Take 10 samples with small delay
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        float t = halDhtReadTemperature();
+        if (!isnan(t)) {
+            samples.push_back(t);
+            acquisition.accept();
+        } else {
+            acquisition.reject(REJECT_NO_READING);
+        }
+        halDelay(100); // DHT11 needs time between readings
+    }
+    
+    // Need at least enough samples to trim
+    if (samples.size() < (TRIM_COUNT * 2 + 1)) return acquisition.fail(-999.0f);
+    
+    // Sort samples to identify outliers
+    std::sort(samples.begin(), samples.end());
+    
+    // Calculate Trimmed Mean (average of central values)
+    float sum = 0;
+    int count = 0;
+    
+    for (size_t i = TRIM_COUNT; i < samples.size() - TRIM_COUNT; ++i) {
+        sum += samples[i];
+        count++;
+    }
+    
+    if (count == 0) return acquisition.fail(-999.0f);
+    
+    float avgTemp = sum / count;
+    
+    // Round to 1 decimal place
+    return round(avgTemp * 10.0) / 10.0;
+}
+
+float readAmbientHumidity() {
+    const int NUM_SAMPLES = 10;
+    const int TRIM_COUNT = 2; // Remove top 2 and bottom 2
+    SampleBuffer<float, NUM_SAMPLES> samples;
+    Acquisition acquisition(SENSOR_AMBIENT_HUMIDITY);
+    
+    // Take 10 samples with small delay
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        float h = halDhtReadHumidity();
+        if (!isnan(h)) {
+            samples.push_back(h);
+            acquisition.accept();
+        } else {
+            acquisition.reject(REJECT_NO_READING);
+        }
+        halDelay(100); // DHT11 needs time between readings
+    }
+    
+    // Need at least enough samples to trim
+    if (samples.size() < (TRIM_COUNT * 2 + 1)) return acquisition.fail(-999.0f);
+    
+    // Sort samples to identify outliers
+    std::sort(samples.begin(), samples.end());
+    
+    // Calculate Trimmed Mean (average of central values)
+    float sum = 0;
+    int count = 0;
+    
+    for (size_t i = TRIM_COUNT; i < samples.size() - TRIM_COUNT; ++i) {
+        sum += samples[i];
+        count++;
+    }
+    
+    if (count == 0) return acquisition.fail(-999.0f);
+    
+    float avgHumidity = sum / count;
+    
+    // Round to 1 decimal place
+    return round(avgHumidity * 10.0) / 10.0;
+}
+
+float readSoilTemp() {
+    Acquisition acquisition(SENSOR_SOIL_TEMP);
+    float t = halSoilProbeReadC();
+    if (t == HAL_PROBE_DISCONNECTED) {
+        acquisition.reject(REJECT_NO_READING);
+        return acquisition.fail(-999.0f);
+    }
+    acquisition.accept();
+    return t;
+}
+
+int readSoilMoisturePercent() {
+    const int NUM_SAMPLES = 10;
+    const int TRIM_COUNT = 2; // Remove top 2 and bottom 2
+    SampleBuffer<int, NUM_SAMPLES> samples;
+    Acquisition acquisition(SENSOR_SOIL_MOISTURE);
+    
+    // Take 10 samples with small delay
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        int raw = halAnalogRead(SOIL_MOISTURE_PIN);
+        if (raw >= 100) { // Only add valid readings
+            samples.push_back(raw);
+            acquisition.accept();
+        } else {
+            acquisition.reject(REJECT_OUT_OF_RANGE);
+        }
+        halDelay(2); // Reduced delay to 2ms
+    }
+    
+    // Need at least enough samples to trim
+    if (samples.size() < (TRIM_COUNT * 2 + 1)) return acquisition.fail(-999);
+    
+    // Sort samples to identify outliers
+    std::sort(samples.begin(), samples.end());
+    
+    // Calculate Trimmed Mean (average of central values)
+    int sum = 0;
+    int count = 0;
+    
+    for (size_t i = TRIM_COUNT; i < samples.size() - TRIM_COUNT; ++i) {
+        sum += samples[i];
+        count++;
+    }
+    
+    if (count == 0) return acquisition.fail(-999);
+    
+    int avgRaw = sum / count;
+    LOG_DEBUG("SOIL", "Raw average %d", avgRaw);
+    // Map to percentage
+    int percent = map(avgRaw, SOIL_DRY, SOIL_WET, 0, 100);
+    return constrain(percent, 0, 100);
+}
+
+int readTankLevelPercent(float temp, float humidity) {
+    const int NUM_SAMPLES = 20;
+    const int TRIM_COUNT = 7;
+    SampleBuffer<float, NUM_SAMPLES> distances;
+    Acquisition acquisition(SENSOR_TANK);
+    
+    // Calculate speed of sound with temperature and humidity correction
+    // Formula: v = 331.3 + 0.606*T + 0.0124*H (m/s)
+    // where T is temperature in °C and H is relative humidity in %
+    float speedOfSound = 331.3 + (0.606 * temp) + (0.0124 * humidity);
+    
+    // Convert to cm/us: speedOfSound (m/s) * 100 (cm/m) / 1000000 (us/s) = speedOfSound / 10000
+    float conversionFactor = speedOfSound / 10000.0; // One-way conversion
+    
+    // If temp/humidity sensors failed, fall back to standard speed (343 m/s at 20°C)
+    if (temp == -999 || humidity == -999) {
+        conversionFactor = 0.0343; // Standard: 343 m/s = 0.0343 cm/us
+    }
+    
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        // Ensure trigger is LOW for at least 5us before pulsing
+        halDigitalWrite(TRIG_PIN, LOW);
+        halDelayMicroseconds(5);
+        
+        // Send 10us HIGH pulse to trigger
+        halDigitalWrite(TRIG_PIN, HIGH);
+        halDelayMicroseconds(10);
+        halDigitalWrite(TRIG_PIN, LOW);
+
+        // Wait for echo with 35ms timeout (enough for ~6m max distance)
+        long duration = halPulseIn(ECHO_PIN, HIGH, 35000);
+        
+        if (duration > 0) {
+            // Calculate distance with corrected speed of sound
+            float distanceCm = (duration * conversionFactor) / 2.0; // Divide by 2 for one-way distance
+            
+            // Valid range check (2cm to 400cm for HC-SR04)
+            if (distanceCm >= 2.0 && distanceCm <= 400.0) {
+                distances.push_back(distanceCm);
+                acquisition.accept();
+                LOG_DEBUG("TANK", "Distancia: %.2f", distanceCm);
+            } else {
+                acquisition.reject(REJECT_OUT_OF_RANGE);
+            }
+        } else {
+            acquisition.reject(REJECT_NO_READING);
+        }
+
+        // Reduced delay to 30ms (User requested optimization)
+        halDelay(30); 
+    }
+    
+    // Need at least enough samples to trim
+    if (distances.size() < (TRIM_COUNT * 2 + 1)) return acquisition.fail(-999);
+    
+    // Sort to separate outliers
+    std::sort(distances.begin(), distances.end());
+    
+    // Calculate Trimmed Mean (average of the central values)
+    float sum = 0;
+    int count = 0;
+    // Start after bottom trim, end before top trim
+    for (size_t i = TRIM_COUNT; i < distances.size() - TRIM_COUNT; ++i) {
+        sum += distances[i];
+        count++;
+    }
+    
+    if (count == 0) return acquisition.fail(-999);
+    
+    float avgDistance = sum / count;
+    
+    // No rounding - keep full precision for accurate percentage calculation
+    LOG_DEBUG("TANK", "Distancia Promedio (Usada): %.2f", avgDistance);
+    
+    // Constrain to valid range BEFORE calculation
+    // If distance >= TANK_DEPTH_CM (15.0), tank is empty (0%)
+    if (avgDistance >= TANK_DEPTH_CM) return 0;
+    
+    // If distance <= TANK_MIN_DISTANCE (8.5), tank is full (100%)
+    if (avgDistance <= TANK_MIN_DISTANCE) return 100;
+
+    // Calculate percentage for values in between
+    float effectiveDepth = (float)TANK_DEPTH_CM - TANK_MIN_DISTANCE;
+    float currentLevel = (float)TANK_DEPTH_CM - avgDistance;
+    
+    float percent = (currentLevel / effectiveDepth) * 100.0;
+    
+    return constrain((int)percent, 0, 100);
+}
+
+// Read Light Level (LDR) with robust trimmed mean filter
+int readLightLevel() {
+    const int NUM_SAMPLES = 10;
+    const int TRIM_COUNT = 2;
+    SampleBuffer<int, NUM_SAMPLES> samples;
+    Acquisition acquisition(SENSOR_LIGHT);
+    
+    // Take 10 samples with small delay
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        samples.push_back(halAnalogRead(LDR_PIN));
+        acquisition.accept(); // Every sample is kept; a dark or open LDR shows in the average
+        halDelay(2);
+    }
+    
+    // Sort samples
+    std::sort(samples.begin(), samples.end());
+    
+    // Trim outliers (remove top 25% and bottom 25%)
+    int trimCount = NUM_SAMPLES / 4; // Remove 5 from each end
+    int sum = 0;
+    int count = 0;
+    
+    for (size_t i = trimCount; i < samples.size() - trimCount; ++i) {
+        sum += samples[i];
+        count++;
+    }
+    
+    if (count == 0) return acquisition.fail(-999);
+    
+    int avgValue = sum / count;
+    
+    // Sensor not connected or reading too low
+    if (avgValue < 10) return acquisition.fail(-999);
+    
+    // Calibrated range: LIGHT_MIN_RAW -> 0%, LIGHT_MAX_RAW -> 100%
+    if (avgValue <= LIGHT_MIN_RAW) return 0;
+    if (avgValue >= LIGHT_MAX_RAW) return 100;
+    LOG_DEBUG("LIGHT", "Raw average %d", avgValue);
+    int percent = map(avgValue, LIGHT_MIN_RAW, LIGHT_MAX_RAW, 0, 100);
+    return constrain(percent, 0, 100);
+}
+
+bool readMotionSensor() {
+    extern volatile bool motionDetectedFlag;
+    if (motionDetectedFlag) {
+        motionDetectedFlag = false; // Reset flag
+        return true;
+    }
+    return halDigitalRead(PIR_PIN) == HIGH;
+}
+
+// Read raw soil moisture ADC value (0-4095)
+int readSoilMoistureRaw() {
+    const int NUM_SAMPLES = 10;
+    const int TRIM_COUNT = 2;
+    SampleBuffer<int, NUM_SAMPLES> samples;
+    Acquisition acquisition(SENSOR_SOIL_RAW);
+    
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        int raw = halAnalogRead(SOIL_MOISTURE_PIN);
+        if (raw >= 100) {
+            samples.push_back(raw);
+            acquisition.accept();
+        } else {
+            acquisition.reject(REJECT_OUT_OF_RANGE);
+        }
+        halDelay(2);
+    }
+    
+    if (samples.size() < (TRIM_COUNT * 2 + 1)) return acquisition.fail(-999);
+    
+    std::sort(samples.begin(), samples.end());
+    
+    int sum = 0;
+    int count = 0;
+    for (size_t i = TRIM_COUNT; i < samples.size() - TRIM_COUNT; ++i) {
+        sum += samples[i];
+        count++;
+    }
+    
+    if (count == 0) return acquisition.fail(-999);
+    return sum / count;
+}
+
+// Read raw light sensor ADC value (0-4095)
+int readLightRaw() {
+    const int NUM_SAMPLES = 10;
+    const int TRIM_COUNT = 2;
+    SampleBuffer<int, NUM_SAMPLES> samples;
+    Acquisition acquisition(SENSOR_LIGHT_RAW);
+    
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        samples.push_back(halAnalogRead(LDR_PIN));
+        acquisition.accept(); // Every sample is kept; a dark or open LDR shows in the average
+        halDelay(2);
+    }
+    
+    std::sort(samples.begin(), samples.end());
+    
+    int trimCount = NUM_SAMPLES / 4;
+    int sum = 0;
+    int count = 0;
+    
+    for (size_t i = trimCount; i < samples.size() - trimCount; ++i) {
+        sum += samples[i];
+        count++;
+    }
+    
+    if (count == 0) return acquisition.fail(-999);
+    
+    int avgValue = sum / count;
+    if (avgValue < 10) return acquisition.fail(-999);
+    
+    return avgValue;
+}
+
+// Read raw ultrasonic distance in cm
+float readRawUltrasonicDistance() {
+    const int NUM_SAMPLES = 5; // Fewer samples for faster reading
+    SampleBuffer<float, NUM_SAMPLES> distances;
+    Acquisition acquisition(SENSOR_TANK_RAW);
+    
+    // Use default speed of sound (can be improved with temp/humidity)
+    float conversionFactor = 0.0343; // 343 m/s = 0.0343 cm/us
+    
+    for (int i = 0; i < NUM_SAMPLES; ++i) {
+        halDigitalWrite(TRIG_PIN, LOW);
+        halDelayMicroseconds(5);
+        
+        halDigitalWrite(TRIG_PIN, HIGH);
+        halDelayMicroseconds(10);
+        halDigitalWrite(TRIG_PIN, LOW);
+        
+        long duration = halPulseIn(ECHO_PIN, HIGH, 35000);
+        
+        if (duration > 0) {
+            float distanceCm = (duration * conversionFactor) / 2.0;
+            if (distanceCm >= 2.0 && distanceCm <= 400.0) {
+                distances.push_back(distanceCm);
+                acquisition.accept();
+            } else {
+                acquisition.reject(REJECT_OUT_OF_RANGE);
+            }
+        } else {
+            acquisition.reject(REJECT_NO_READING);
+        }
+        halDelay(30);
+    }
+    
+    if (distances.size() == 0) return acquisition.fail(-999.0f);
+    
+    // Simple average
+    float sum = 0;
+    for (float d : distances) {
+        sum += d;
+    }
+    
+    return sum / distances.size();
+}
+
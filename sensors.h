@@ -1,24 +1,66 @@
-#ifndef SENSORS_H
-#define SENSORS_H
-
-#include <Arduino.h>
-#include "config.h"
-#include <DHT.h>
-#include <OneWire.h>
-#include <DallasTemperature.h>
-
-void initSensors();
-
-float readAmbientTemp();
-float readAmbientHumidity();
-float readSoilTemp();
-int readSoilMoisturePercent();
-int readTankLevelPercent(float temp, float humidity);
-
-bool readMotionSensor();
-int readLightLevel(); // Returns percentage 0-100
-int readSoilMoistureRaw(); // Returns raw ADC value
-int readLightRaw(); // Returns raw ADC value
-float readRawUltrasonicDistance(); // Returns distance in cm
-
-#endif // SENSORS_H
+#ifndef SENSORS_H
+#define SENSORS_H
+
+#include <Arduino.h>
+#include "config.h"
+
+void initSensors();
+
+float readAmbientTemp();
+float readAmbientHumidity();
+float readSoilTemp();
+int readSoilMoisturePercent();
+int readTankLevelPercent(float temp, float humidity);
+
+bool readMotionSensor();
+int readLightLevel(); // Returns percentage 0-100
+int readSoilMoistureRaw(); // Returns raw ADC value
+int readLightRaw(); // Returns raw ADC value
+float readRawUltrasonicDistance(); // Returns distance in cm
+
+// ==========================================
+// Sensor Telemetry
+// ==========================================
+// Every read*() call is one acquisition on its channel: how long it took,
+// how many raw samples it took and kept, why the others were dropped, and
+// whether it ended in -999. Read functions run in the loop task and count
+// privately; publishMeasurement() (publishTankLevel() for the tank-only
+// readings taken while pumping) folds them in under the state lock
+// together with the readings, so the counts served by /data only move with
+// the state version that announces them.
+enum SensorChannel : uint8_t {
+    SENSOR_AMBIENT_TEMP,
+    SENSOR_AMBIENT_HUMIDITY,
+    SENSOR_SOIL_TEMP,
+    SENSOR_SOIL_MOISTURE,
+    SENSOR_SOIL_RAW,
+    SENSOR_LIGHT,
+    SENSOR_LIGHT_RAW,
+    SENSOR_TANK,
+    SENSOR_TANK_RAW,
+    SENSOR_CHANNEL_COUNT
+};
+
+enum SensorReject : uint8_t {
+    REJECT_NO_READING,   // NaN, echo timeout, probe disconnected
+    REJECT_OUT_OF_RANGE, // Soil raw < 100, distance outside 2-400 cm
+    SENSOR_REJECT_COUNT
+};
+
+struct SensorStats {
+    unsigned long reads;     // Acquisitions
+    unsigned long failures;  // Acquisitions that returned -999
+    unsigned long samples;   // Raw samples taken
+    unsigned long valid;     // Raw samples kept
+    unsigned long rejects[SENSOR_REJECT_COUNT];
+    unsigned long lastUs;
+    unsigned long maxUs;
+    uint64_t totalUs;
+};
+
+void publishSensorStats(); // Under the state lock, from publishMeasurement() and publishTankLevel()
+SensorStats getSensorStats(SensorChannel channel); // Copy; takes the state lock
+const char* sensorChannelName(SensorChannel channel); // Matches the /data field
+const char* sensorRejectName(SensorReject reason);
+
+#endif // SENSORS_H
@@ -1,291 +1,545 @@
-#ifndef STYLE_CSS_H_H
-#define STYLE_CSS_H_H
-
-#include <Arduino.h>
-
-const char style_css[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xCD, 0x3C, 0xD9, 0x8E, 0xE3, 0xBA, 
-0x95, 0xEF, 0xF3, 0x15, 0x9A, 0x34, 0x1A, 0x5D, 0x4E, 0x24, 0x43, 0xBB, 0x65, 0x1B, 0x08, 0x92, 
-0x19, 0xE0, 0x22, 0xF7, 0x21, 0x09, 0x30, 0xC1, 0x00, 0x33, 0x8F, 0x94, 0x44, 0xD9, 0x4A, 0xCB, 
-0x92, 0x21, 0xC9, 0x55, 0x5D, 0xD7, 0xF0, 0xBF, 0xE7, 0x90, 0xD4, 0xC2, 0x4D, 0x8B, 0xAB, 0xB2, 
-0xDD, 0xBE, 0x5D, 0x6D, 0x53, 0xD4, 0xD9, 0x78, 0x78, 0x36, 0x1E, 0xD6, 0xB9, 0xBD, 0x14, 0xF7, 
-0x18, 0x25, 0xDF, 0x4F, 0x75, 0x75, 0x2B, 0x53, 0x2B, 0xA9, 0x8A, 0xAA, 0x3E, 0x7C, 0xC9, 0xBC, 
-0xCC, 0xCF, 0xC2, 0x63, 0x5B, 0xA3, 0xB2, 0xC9, 0xDB, 0xBC, 0x2A, 0x0F, 0xF2, 0x1C, 0x63, 0x1B, 
-0x34, 0x06, 0x46, 0x0D, 0x7E, 0x9C, 0x01, 0xC4, 0x36, 0x45, 0xF5, 0x77, 0xAB, 0x3D, 0xE3, 0x0B, 
-0xD6, 0x40, 0xB3, 0x91, 0x9D, 0x39, 0xF8, 0x71, 0xA8, 0xAB, 0xAA, 0xBD, 0x5B, 0x56, 0x7C, 0x92, 
-0xD0, 0x58, 0x56, 0x82, 0xEA, 0x14, 0xC6, 0x61, 0x24, 0xCB, 0xE0, 0x6B, 0x8B, 0x7F, 0xB4, 0xD6, 
-0xB5, 0xCE, 0x2F, 0xA8, 0x7E, 0x3F, 0x7C, 0x71, 0x32, 0x77, 0xEF, 0xED, 0xFA, 0xE1, 0x06, 0x27, 
-0x55, 0x99, 0xD2, 0x07, 0x61, 0xBC, 0x73, 0x23, 0x1B, 0x1E, 0x74, 0x53, 0x7B, 0xB0, 0x6E, 0x10, 
-0x7A, 0x38, 0x86, 0xF1, 0xE6, 0x96, 0x24, 0xB8, 0x69, 0xFA, 0x71, 0xC7, 0x8E, 0xF7, 0x91, 0x03, 
-0xE3, 0x6F, 0xA8, 0x2E, 0xF3, 0x72, 0x24, 0x23, 0xD8, 0x63, 0x9B, 0xCC, 0x4F, 0x51, 0x79, 0xC2, 
-0x75, 0x3F, 0x8C, 0x33, 0x1F, 0xFE, 0x83, 0xE1, 0xB8, 0xAA, 0x53, 0x6E, 0x38, 0xC0, 0x3B, 0x0A, 
-0x3D, 0x39, 0xA3, 0xBA, 0xB5, 0x4E, 0x75, 0x9E, 0xF2, 0x9C, 0xD0, 0x41, 0xCA, 0x0A, 0x22, 0x7F, 
-0x1E, 0x71, 0x95, 0xBE, 0xF3, 0xE2, 0xE1, 0xF9, 0x67, 0x82, 0xE1, 0xF9, 0x77, 0x90, 0xEB, 0x79, 
-0xAE, 0x22, 0x02, 0x4E, 0x2C, 0x1C, 0xFF, 0x49, 0x9C, 0x06, 0xD8, 0x51, 0xF9, 0x0F, 0x6D, 0x14, 
-0x64, 0x48, 0x21, 0xDC, 0xF3, 0x7C, 0x27, 0x08, 0x24, 0xC2, 0x1D, 0x0C, 0xC2, 0x8D, 0x05, 0xC2, 
-0x81, 0xA6, 0x9D, 0xBB, 0x97, 0x09, 0x37, 0xB6, 0x84, 0x48, 0x6E, 0x75, 0x0F, 0x45, 0x5E, 0x62, 
-0x54, 0x03, 0x1C, 0x94, 0xE6, 0xB8, 0x6C, 0x5F, 0x1C, 0x2F, 0x48, 0xF1, 0xC9, 0xFC, 0xE2, 0x38, 
-0x4E, 0xE4, 0xEE, 0x0C, 0xFB, 0xAB, 0xC9, 0x40, 0x21, 0xC3, 0xB1, 0xED, 0xAF, 0x9B, 0xFF, 0xCC, 
-0x2F, 0xD7, 0xAA, 0x6E, 0x51, 0xD9, 0x1E, 0xAB, 0x2B, 0x4A, 0xF2, 0xF6, 0xFD, 0xE0, 0x70, 0x63, 
-0x71, 0xF5, 0xC3, 0x6A, 0xCE, 0x28, 0xAD, 0xDE, 0x0E, 0xB6, 0x11, 0x5D, 0x7F, 0x18, 0xAE, 0x0D, 
-0x3F, 0xEA, 0x53, 0x8C, 0x5E, 0x6C, 0x93, 0xFC, 0xD9, 0xFA, 0x1B, 0xD3, 0x36, 0x7C, 0x18, 0x74, 
-0xE4, 0x27, 0xDE, 0x46, 0x00, 0xC4, 0x33, 0xCD, 0xF8, 0x1B, 0x1F, 0x6B, 0xD8, 0xAA, 0xCA, 0xB6, 
-0xAE, 0x0A, 0x2B, 0x6F, 0xF1, 0xC5, 0x54, 0x9E, 0xC2, 0x3B, 0xDF, 0xAD, 0x02, 0x35, 0xAD, 0x95, 
-0xE5, 0x45, 0x81, 0x05, 0x01, 0x74, 0xEC, 0xA9, 0x20, 0xE9, 0x4B, 0xAF, 0x79, 0x73, 0x43, 0x85, 
-0xF5, 0x56, 0xA3, 0xEB, 0x15, 0xD7, 0xAB, 0x04, 0x47, 0x69, 0x55, 0x04, 0x27, 0x71, 0xE4, 0xEF, 
-0x82, 0x20, 0xD4, 0x2D, 0x0F, 0x5D, 0xC0, 0x27, 0xD0, 0x75, 0x38, 0x08, 0xBA, 0x0E, 0x33, 0x45, 
-0xA7, 0x42, 0x6E, 0xDE, 0x1B, 0x90, 0x8D, 0xD5, 0xB4, 0xA8, 0xBD, 0x35, 0x82, 0x00, 0x3A, 0xED, 
-0xD1, 0xE9, 0x99, 0x02, 0xE6, 0x8C, 0x51, 0xBA, 0x52, 0x0E, 0x8B, 0x0A, 0x24, 0x28, 0x0B, 0x55, 
-0x09, 0xF7, 0x13, 0x2A, 0xB1, 0xA5, 0x04, 0x5A, 0x6D, 0x75, 0x3A, 0x15, 0xD8, 0x8A, 0xDB, 0xF2, 
-0x9E, 0xE6, 0xCD, 0xB5, 0x40, 0xEF, 0x87, 0xAC, 0xC0, 0x3F, 0x8E, 0xA8, 0xC8, 0x4F, 0x25, 0x55, 
-0x8F, 0xE6, 0x90, 0x00, 0x9D, 0xB8, 0x3E, 0xFE, 0xF5, 0xD6, 0xB4, 0x79, 0x46, 0x36, 0x1C, 0x7C, 
-0x2D, 0xDB, 0x7E, 0xF8, 0x2D, 0x4F, 0xDB, 0xF3, 0xC1, 0x07, 0xF5, 0x3C, 0x9E, 0x71, 0x7E, 0x3A, 
-0xB7, 0xEC, 0x33, 0x43, 0x7F, 0x70, 0x80, 0xC4, 0xA6, 0x2A, 0xF2, 0xD4, 0x78, 0x45, 0xF5, 0x8B, 
-0xB8, 0x3B, 0x61, 0x91, 0x47, 0xB9, 0xB0, 0xC7, 0x9D, 0x4D, 0xD8, 0x1C, 0x93, 0x5B, 0xDD, 0x00, 
-0xDD, 0xD7, 0x2A, 0xA7, 0x48, 0xBA, 0xD7, 0x88, 0xD0, 0x6E, 0xCD, 0x81, 0xEC, 0x05, 0xDE, 0x4E, 
-0xA3, 0xA2, 0x30, 0xB6, 0x5E, 0x63, 0x24, 0xB7, 0x38, 0x4F, 0xAC, 0x18, 0xFF, 0x92, 0xE3, 0xFA, 
-0x65, 0xEB, 0x06, 0xE6, 0x36, 0x32, 0xC9, 0x3F, 0xCE, 0xE6, 0x78, 0x45, 0x69, 0x0A, 0xD6, 0xEF, 
-0x00, 0x9B, 0xEC, 0x78, 0xAD, 0xBA, 0xF7, 0x6A, 0x5C, 0xA0, 0x36, 0x7F, 0xC5, 0xC7, 0xEA, 0x15, 
-0xD7, 0x59, 0x01, 0x82, 0x3D, 0xE7, 0x69, 0x8A, 0x4B, 0x51, 0xD4, 0x84, 0x05, 0x4F, 0x92, 0xB4, 
-0x1D, 0x6C, 0x54, 0x09, 0x1E, 0xCE, 0x04, 0xCE, 0x5D, 0x61, 0xAA, 0xB7, 0x7D, 0x1B, 0x46, 0x73, 
-0x56, 0xD5, 0x97, 0x03, 0xFD, 0x04, 0xD8, 0xF1, 0xFF, 0xBF, 0x58, 0xB0, 0x8C, 0x1B, 0x11, 0x25, 
-0x59, 0xD8, 0x50, 0x42, 0xE9, 0x68, 0x94, 0x54, 0x59, 0xC3, 0x45, 0x3D, 0x9D, 0xDA, 0x48, 0xCB, 
-0xBC, 0x74, 0x6A, 0xB9, 0x4C, 0xA8, 0xAB, 0x11, 0x4D, 0x8F, 0x20, 0x07, 0xE5, 0xB9, 0x33, 0x8D, 
-0x71, 0x39, 0x8D, 0xA1, 0x9F, 0x45, 0xC7, 0x24, 0x2F, 0x6F, 0x24, 0x2F, 0xAF, 0xE7, 0x9B, 0xCE, 
-0x36, 0x08, 0xCD, 0x6D, 0xE8, 0x93, 0x05, 0x1E, 0x44, 0x6B, 0x55, 0x75, 0x7E, 0xCA, 0xCB, 0x51, 
-0x3D, 0x8B, 0x82, 0xD8, 0x79, 0x70, 0x72, 0x87, 0x61, 0x8E, 0xD9, 0x19, 0xE3, 0x79, 0x42, 0xAD, 
-0x12, 0xBF, 0xDD, 0x07, 0x65, 0x41, 0x31, 0xE8, 0xF1, 0xAD, 0xC5, 0xC7, 0xB6, 0xBA, 0x1E, 0x02, 
-0xFB, 0xEB, 0xB1, 0xC0, 0x59, 0x4B, 0x3F, 0x80, 0x1B, 0x22, 0x08, 0x2D, 0xBA, 0x1F, 0x6D, 0xF8, 
-0x43, 0x3F, 0x2D, 0xCB, 0x58, 0x10, 0x4A, 0xEF, 0x68, 0x5D, 0x1C, 0x65, 0xF6, 0x63, 0xCB, 0x0C, 
-0xC7, 0x3F, 0x6E, 0x5F, 0x96, 0x55, 0x89, 0x75, 0xBB, 0x4A, 0xDA, 0x77, 0x4F, 0x6E, 0xB2, 0xA5, 
-0x8D, 0x35, 0xF0, 0x35, 0xA7, 0x07, 0x1C, 0xCE, 0x61, 0xC1, 0x28, 0x66, 0x12, 0x79, 0x1D, 0x7F, 
-0xB1, 0xF2, 0x32, 0xC5, 0x3F, 0x0E, 0xCE, 0x83, 0x38, 0xB1, 0x2C, 0x3F, 0xC9, 0x7A, 0x3F, 0x65, 
-0x60, 0xBD, 0x38, 0x72, 0xB3, 0x90, 0x1A, 0x58, 0x16, 0x2B, 0x0D, 0x8E, 0x66, 0x4A, 0x9F, 0x83, 
-0xBD, 0xE9, 0x78, 0xB6, 0xE9, 0xFA, 0x21, 0x61, 0x70, 0xC3, 0x23, 0x54, 0xB7, 0xC7, 0x14, 0xDA, 
-0x0E, 0x17, 0x75, 0x38, 0xA9, 0x8F, 0xD3, 0xA8, 0x43, 0xBB, 0xD6, 0x14, 0x88, 0x86, 0x9E, 0x27, 
-0xC9, 0x93, 0x48, 0x42, 0x09, 0x11, 0xB9, 0xB9, 0x2D, 0xAA, 0x53, 0x75, 0x6B, 0xB9, 0xA1, 0xBB, 
-0x16, 0x97, 0x2D, 0xBC, 0x6D, 0xF0, 0x2B, 0xC3, 0xC3, 0x10, 0x1E, 0xF4, 0x5A, 0x0A, 0xA1, 0x99, 
-0x2A, 0x0D, 0x71, 0xE6, 0x88, 0xB3, 0xAE, 0xC0, 0x87, 0xE2, 0x97, 0xBD, 0x0D, 0xF2, 0xD0, 0xD8, 
-0xB0, 0xE7, 0x56, 0xD1, 0xCF, 0xFC, 0x10, 0x07, 0x54, 0x9C, 0xBE, 0xE7, 0x45, 0x09, 0x5A, 0x5C, 
-0xC5, 0xDD, 0xDE, 0xDC, 0x81, 0xC4, 0xDC, 0x3D, 0xF1, 0x8F, 0x73, 0xE8, 0xD7, 0xAF, 0x69, 0x87, 
-0x99, 0x10, 0xE1, 0xED, 0x3C, 0x1B, 0x79, 0x3A, 0x22, 0xC4, 0x85, 0xE3, 0xA8, 0xF0, 0x41, 0xF0, 
-0xA3, 0x7C, 0xD7, 0xE0, 0x63, 0x41, 0x39, 0xC5, 0x97, 0x26, 0x6E, 0xE8, 0x86, 0x8B, 0x4C, 0xBB, 
-0xDE, 0xDE, 0x0C, 0x23, 0xF2, 0x3F, 0xD3, 0x5C, 0x4E, 0x27, 0x56, 0x73, 0xD9, 0xA1, 0x22, 0x58, 
-0xE3, 0xBD, 0x93, 0x38, 0xC9, 0xA7, 0x34, 0x97, 0xA3, 0xC8, 0xD3, 0x51, 0x34, 0xA5, 0x3D, 0x03, 
-0x8E, 0xFF, 0x63, 0x38, 0xD4, 0x15, 0x7C, 0x4E, 0x96, 0x53, 0x5C, 0xCD, 0xC8, 0xD2, 0xB5, 0x4D, 
-0x2F, 0x22, 0xFF, 0x6B, 0x15, 0xE8, 0x23, 0xA2, 0xED, 0x30, 0x13, 0x22, 0xF6, 0x7B, 0x27, 0x76, 
-0xB4, 0xB6, 0x48, 0x92, 0xDF, 0x48, 0x85, 0x3F, 0x38, 0x58, 0x22, 0xAB, 0x6D, 0x73, 0x2B, 0x21, 
-0x41, 0x6A, 0x5B, 0x08, 0x6F, 0x4C, 0x7E, 0xFC, 0x52, 0x55, 0xC3, 0x83, 0x3B, 0x2A, 0x21, 0x5B, 
-0xA2, 0x36, 0x95, 0x3C, 0xFB, 0x09, 0x24, 0xFD, 0xE7, 0x5B, 0x6B, 0x6C, 0x7D, 0x66, 0x55, 0x2D, 
-0xE0, 0xC0, 0x00, 0x71, 0x43, 0x8E, 0x98, 0x36, 0x0F, 0x05, 0x48, 0x9D, 0x37, 0x32, 0x70, 0x82, 
-0x94, 0x0D, 0x6B, 0x40, 0xFF, 0x5C, 0x8E, 0x90, 0xF3, 0x72, 0x04, 0xFC, 0xBB, 0xEF, 0xF8, 0x3D, 
-0xAB, 0xD1, 0x05, 0x37, 0x06, 0x47, 0xC5, 0xDD, 0xFE, 0x7A, 0x1F, 0x92, 0x23, 0x4E, 0xBB, 0x9A, 
-0x04, 0x15, 0xF8, 0x05, 0xC2, 0x1E, 0x22, 0x9B, 0x61, 0x86, 0xAD, 0xCC, 0xD8, 0x46, 0x9B, 0x87, 
-0x0E, 0xF4, 0xCF, 0xE5, 0x7D, 0xF1, 0x3D, 0x01, 0xB4, 0x16, 0xF9, 0x10, 0x22, 0x0C, 0x5E, 0xC9, 
-0x22, 0xAB, 0x0C, 0x0E, 0x79, 0x0C, 0x0D, 0xB2, 0xFC, 0x07, 0x4E, 0x69, 0x5C, 0x60, 0xB3, 0xA8, 
-0xC0, 0xEE, 0xBC, 0x2F, 0x01, 0xDF, 0xFB, 0x36, 0xFA, 0xB9, 0xF3, 0xAB, 0x16, 0x7E, 0x05, 0x75, 
-0x68, 0x98, 0x17, 0xEE, 0x3D, 0xDA, 0x1E, 0xFE, 0x3B, 0x8E, 0xE4, 0x2E, 0x85, 0x91, 0x0C, 0x35, 
-0x81, 0x30, 0x4D, 0xE2, 0xB6, 0x73, 0x00, 0xE3, 0x12, 0x35, 0x90, 0x01, 0x14, 0x98, 0x88, 0x87, 
-0x2E, 0x91, 0xE8, 0xCC, 0x7D, 0x1A, 0xBE, 0x81, 0x27, 0xE7, 0xC5, 0x39, 0xBE, 0x01, 0xE2, 0x34, 
-0xC5, 0xB5, 0x78, 0x04, 0xDC, 0xB7, 0xAD, 0x1D, 0x3D, 0x34, 0x79, 0xD4, 0x5B, 0xDE, 0x26, 0x67, 
-0xF8, 0x17, 0x72, 0x00, 0x61, 0x73, 0x2C, 0x45, 0xA4, 0xDD, 0x8B, 0x79, 0x79, 0xBD, 0x41, 0x4C, 
-0x73, 0xC6, 0xC9, 0x77, 0x9C, 0xFE, 0x66, 0x12, 0x0C, 0x13, 0x91, 0x50, 0x13, 0xD0, 0x25, 0x75, 
-0x02, 0x31, 0x87, 0x18, 0xC3, 0x5A, 0xEB, 0x8A, 0x37, 0xC4, 0xBF, 0xA9, 0xE1, 0xDB, 0xD3, 0x61, 
-0x76, 0x1F, 0xD2, 0xB2, 0x9A, 0xC5, 0x1C, 0xC4, 0x2D, 0xFC, 0xB5, 0xAA, 0x55, 0x06, 0x8C, 0x15, 
-0x74, 0x58, 0xA2, 0x18, 0xEC, 0xC3, 0x70, 0xDF, 0xD9, 0x8E, 0x91, 0x74, 0x89, 0x16, 0xDB, 0xDF, 
-0x45, 0xC1, 0x6E, 0x19, 0x7B, 0x96, 0x7D, 0xC6, 0x17, 0x4D, 0xA2, 0x67, 0xB6, 0x4E, 0x83, 0x3E, 
-0x27, 0xB6, 0x84, 0xAC, 0xAE, 0x3E, 0xCB, 0x98, 0x16, 0x67, 0xE6, 0x64, 0x41, 0xA6, 0xD1, 0x98, 
-0x0B, 0x6E, 0x6B, 0xD0, 0xE6, 0x57, 0x54, 0xDC, 0xF0, 0x1A, 0x56, 0x80, 0x56, 0xCA, 0x07, 0x5B, 
-0x9E, 0x8E, 0x0F, 0xEB, 0x0D, 0xC7, 0xDF, 0x73, 0xB0, 0xE7, 0x9C, 0x52, 0x14, 0xF9, 0xF5, 0x40, 
-0xEA, 0x50, 0xC3, 0x43, 0x5A, 0x94, 0xCA, 0x68, 0x66, 0x41, 0x49, 0xA2, 0x3B, 0xEF, 0x8A, 0x6A, 
-0x4C, 0xF2, 0x6E, 0xCD, 0x8B, 0x2A, 0xAD, 0xD4, 0x0C, 0xB0, 0xDD, 0x49, 0x93, 0xDE, 0x6E, 0xA7, 
-0x02, 0xE4, 0xCB, 0xF5, 0x2E, 0x32, 0xDF, 0x25, 0x44, 0x6B, 0xE2, 0x12, 0x70, 0x12, 0x36, 0xF3, 
-0x6D, 0x5E, 0xEA, 0x64, 0x76, 0xA4, 0x73, 0x2B, 0xE4, 0xCF, 0x90, 0xCE, 0xBA, 0x3E, 0x04, 0xEE, 
-0x41, 0x64, 0x3A, 0x0E, 0xC9, 0xDB, 0x4C, 0xC5, 0xE9, 0x70, 0x8F, 0x75, 0xBE, 0x6F, 0x8A, 0x8B, 
-0xF3, 0xED, 0x92, 0xA7, 0x60, 0x13, 0x24, 0x4E, 0x58, 0x08, 0xBE, 0x86, 0x13, 0x07, 0x7B, 0x28, 
-0x60, 0xAB, 0xE3, 0x20, 0x17, 0xFB, 0xDA, 0x30, 0x4F, 0xE0, 0x44, 0x08, 0xD6, 0x55, 0x4E, 0x84, 
-0xC0, 0xF9, 0x09, 0x4E, 0x9A, 0x2A, 0x2F, 0x24, 0x2E, 0xBA, 0x8A, 0xEA, 0x9A, 0x62, 0x53, 0xE8, 
-0xE3, 0xBE, 0xB6, 0x15, 0x78, 0xA9, 0x9B, 0x2D, 0x72, 0xE1, 0x84, 0xA6, 0x13, 0x81, 0xCC, 0x49, 
-0x9C, 0xA8, 0xE1, 0x82, 0x7F, 0x0C, 0x5C, 0xFC, 0xFA, 0x4E, 0x21, 0xE5, 0xBF, 0x90, 0xCA, 0x46, 
-0x47, 0x24, 0x8C, 0xF4, 0x09, 0xA9, 0x3D, 0x54, 0x3D, 0xEC, 0x63, 0x06, 0xC9, 0xA1, 0x95, 0xA1, 
-0x4B, 0x5E, 0xBC, 0x1F, 0x2C, 0x74, 0x05, 0x8B, 0x6E, 0xB1, 0x0A, 0x97, 0xF9, 0x5F, 0x40, 0xFD, 
-0xF7, 0x3F, 0xA2, 0xE4, 0x2F, 0xF4, 0xEB, 0x4F, 0x30, 0xCF, 0xFC, 0xF6, 0x17, 0x7C, 0xAA, 0xB0, 
-0xF1, 0xBF, 0x3F, 0x7F, 0x33, 0xBF, 0xFD, 0x4F, 0x15, 0x57, 0x6D, 0x05, 0x1F, 0xFE, 0x80, 0x8B, 
-0x57, 0xDC, 0xE6, 0x10, 0xF7, 0xFE, 0x09, 0xDF, 0x30, 0x0C, 0xFC, 0xBE, 0xCE, 0x51, 0xF1, 0xCD, 
-0x6C, 0x40, 0xF5, 0x21, 0xCC, 0xA8, 0xF3, 0x6C, 0x55, 0xE9, 0xDC, 0x94, 0xBE, 0xF2, 0xB2, 0x1D, 
-0xEB, 0xEB, 0x64, 0x7D, 0x38, 0xAF, 0x75, 0x45, 0x27, 0xDC, 0x07, 0x16, 0x6E, 0x30, 0xE9, 0xB6, 
-0x8E, 0xBC, 0x2F, 0xE0, 0x8B, 0xC9, 0x63, 0xFD, 0x87, 0x66, 0x98, 0x64, 0xBD, 0xAC, 0xDE, 0x2D, 
-0x6F, 0x03, 0xDE, 0xDB, 0x8D, 0x98, 0xEE, 0x59, 0x5D, 0x5D, 0x38, 0x57, 0xD7, 0x56, 0x63, 0xA0, 
-0xD0, 0xF9, 0x39, 0x32, 0xD9, 0xC2, 0x3F, 0x72, 0x29, 0xC2, 0xEA, 0x61, 0xD0, 0x08, 0xCB, 0x9D, 
-0xA4, 0x56, 0x1B, 0x17, 0x71, 0xEF, 0x8A, 0x04, 0x38, 0x3C, 0x01, 0x36, 0x84, 0x25, 0xB0, 0x88, 
-0x34, 0xE5, 0x47, 0xC0, 0x4C, 0x6D, 0x6E, 0xD1, 0xAD, 0x3D, 0xF3, 0xDF, 0xBB, 0xBC, 0x66, 0x18, 
-0xE1, 0xE8, 0x1B, 0xC6, 0x7A, 0x91, 0x2A, 0x59, 0xBD, 0x36, 0x10, 0x90, 0x5E, 0x9B, 0x97, 0x4F, 
-0x82, 0xCA, 0x57, 0xD4, 0xDC, 0xA5, 0x48, 0x85, 0xAF, 0x3F, 0x0A, 0xF4, 0xDF, 0x2F, 0xE8, 0x87, 
-0xD5, 0xC5, 0x4C, 0x60, 0xC3, 0xAE, 0xA3, 0x0E, 0x1B, 0xC0, 0x58, 0xF5, 0xE8, 0xEA, 0xA8, 0x42, 
-0x29, 0x44, 0xAE, 0x7B, 0x80, 0x01, 0x4E, 0xC0, 0x9D, 0xE1, 0xF6, 0x0D, 0xE3, 0x52, 0x57, 0x28, 
-0x61, 0x20, 0x61, 0x87, 0xB4, 0x6D, 0x75, 0x39, 0xB8, 0x3E, 0xA9, 0x86, 0x4C, 0x16, 0x20, 0x7B, 
-0x85, 0x71, 0x48, 0x1E, 0xC0, 0xE6, 0x8A, 0xD5, 0x12, 0x97, 0x0E, 0x2D, 0x95, 0x64, 0xED, 0x88, 
-0xEC, 0x62, 0x32, 0xEA, 0xCB, 0x4F, 0x48, 0x18, 0x1F, 0x83, 0x7C, 0x52, 0x91, 0x2D, 0xF2, 0xC3, 
-0x4A, 0xF3, 0x1A, 0x27, 0xDD, 0x62, 0x15, 0xB7, 0x4B, 0xD9, 0xCD, 0x34, 0x80, 0x47, 0x10, 0x3C, 
-0xD9, 0xCB, 0xB0, 0xEB, 0xF1, 0x61, 0x1B, 0x05, 0x35, 0xBE, 0xA8, 0x6A, 0x3F, 0x9C, 0x97, 0x6C, 
-0xD8, 0xC6, 0x7F, 0x63, 0xBA, 0x1E, 0xDA, 0x10, 0x05, 0x93, 0xE7, 0x63, 0x9C, 0x7B, 0x23, 0x85, 
-0xF3, 0x84, 0x14, 0x56, 0x0A, 0xC8, 0x14, 0x80, 0x3D, 0x22, 0x45, 0xC2, 0xF7, 0xD6, 0x0E, 0x00, 
-0x72, 0x27, 0x32, 0x12, 0xDA, 0x02, 0xFD, 0x43, 0xF9, 0x06, 0x51, 0xDA, 0x9A, 0xC5, 0xD2, 0xD4, 
-0x09, 0x5D, 0xA9, 0xA0, 0xC6, 0x7A, 0xD6, 0x0D, 0x64, 0xBF, 0xF2, 0x45, 0x5A, 0xAA, 0x65, 0xAB, 
-0x60, 0xD1, 0xA8, 0xBA, 0x13, 0x39, 0x5D, 0x05, 0x36, 0x30, 0x57, 0x5C, 0x56, 0x6D, 0xBC, 0x44, 
-0x03, 0x07, 0x49, 0x8A, 0x45, 0xA5, 0xE2, 0xFF, 0x93, 0xC4, 0x92, 0xCF, 0x86, 0x23, 0x69, 0xD7, 
-0x64, 0x0C, 0x62, 0x67, 0x69, 0xD6, 0x87, 0x53, 0x59, 0x82, 0x77, 0xC2, 0xF1, 0x07, 0xC7, 0xE1, 
-0x97, 0x38, 0xCE, 0x76, 0xA9, 0xBD, 0xA8, 0x85, 0x13, 0xD5, 0x6A, 0x5D, 0x25, 0x8F, 0x5A, 0x5A, 
-0x91, 0xD7, 0x2E, 0x85, 0xD5, 0xA7, 0xF8, 0xCE, 0xAA, 0x3A, 0x35, 0x68, 0x3C, 0x00, 0xA5, 0xD0, 
-0xAC, 0xB4, 0x6A, 0xEF, 0x7D, 0x26, 0x34, 0x56, 0xF9, 0xE8, 0x67, 0x35, 0xE8, 0xEE, 0xFD, 0xAA, 
-0xC0, 0x20, 0xA9, 0xAF, 0x4A, 0xEE, 0x32, 0xD2, 0x79, 0x43, 0xE0, 0x90, 0x33, 0xC0, 0xB7, 0x02, 
-0x32, 0x4F, 0x40, 0x6E, 0x80, 0xF5, 0xCD, 0xC1, 0x0E, 0x96, 0xB0, 0x5E, 0x82, 0x95, 0xED, 0x27, 
-0x28, 0x29, 0x8D, 0x36, 0x07, 0x14, 0xB2, 0x9C, 0x48, 0x9D, 0xB1, 0xA5, 0x79, 0xA2, 0x20, 0x48, 
-0xB6, 0x53, 0xFB, 0x08, 0x3C, 0x0C, 0x32, 0x3F, 0x3C, 0xF2, 0xFB, 0x76, 0x47, 0x37, 0xEE, 0xA7, 
-0x36, 0xE7, 0x13, 0x67, 0x56, 0x6B, 0x02, 0x14, 0x9A, 0x25, 0x68, 0x0F, 0xDF, 0x58, 0x9A, 0xA1, 
-0x41, 0x37, 0x2E, 0xF2, 0xCC, 0x6A, 0x2E, 0xAF, 0x5D, 0xB8, 0x74, 0xFC, 0x26, 0x08, 0x13, 0x02, 
-0x5B, 0x84, 0x03, 0xF0, 0x1F, 0x05, 0xAA, 0x2F, 0x24, 0x75, 0x86, 0x90, 0xA4, 0xAD, 0xEA, 0xA7, 
-0x77, 0x69, 0xD8, 0x99, 0x6B, 0x49, 0xE1, 0x68, 0x80, 0xB0, 0x62, 0xA5, 0xA6, 0xB6, 0x93, 0x44, 
-0x56, 0xF7, 0xBD, 0x84, 0xE5, 0x44, 0x85, 0x90, 0xE8, 0xB0, 0x9D, 0xAF, 0xD9, 0xE8, 0xCC, 0x0E, 
-0xF4, 0xC9, 0x8E, 0x13, 0x86, 0x81, 0xE7, 0x4F, 0xC1, 0xED, 0x0E, 0xF5, 0x45, 0xC0, 0x18, 0xDE, 
-0x8F, 0x34, 0x80, 0xE1, 0x81, 0x1D, 0xA1, 0x21, 0x29, 0x45, 0x11, 0xB2, 0x27, 0x01, 0xB3, 0xAE, 
-0x00, 0x19, 0xAE, 0x9B, 0xB9, 0x5A, 0xB8, 0x09, 0x4A, 0x06, 0xB8, 0x2C, 0x2B, 0x54, 0x76, 0x23, 
-0x05, 0x3B, 0xBF, 0x1F, 0xE9, 0x14, 0x75, 0x47, 0x8A, 0xDB, 0x6F, 0xF7, 0x18, 0x48, 0x26, 0x85, 
-0xC2, 0x71, 0xA5, 0x1C, 0xB2, 0x4C, 0x42, 0x64, 0xF7, 0xD8, 0x82, 0x3E, 0x90, 0xDA, 0x1C, 0x39, 
-0xF5, 0x1F, 0xF4, 0x83, 0x7C, 0x39, 0x92, 0x1F, 0x34, 0xD7, 0x22, 0xA6, 0xCD, 0x62, 0x3E, 0x16, 
-0xD6, 0x3E, 0xAB, 0x0D, 0x27, 0xAB, 0xA5, 0xA7, 0x75, 0xF5, 0xD6, 0x1C, 0x48, 0x14, 0x42, 0x43, 
-0x11, 0x36, 0x01, 0x74, 0xC9, 0x1D, 0xA3, 0x94, 0x21, 0xA4, 0xB0, 0x89, 0xAB, 0x63, 0xD0, 0xB6, 
-0xC4, 0xAF, 0x98, 0xFD, 0x97, 0x9A, 0x50, 0x34, 0x90, 0xD0, 0x45, 0x2C, 0x8D, 0x30, 0xF7, 0xB7, 
-0x5D, 0xFE, 0xDA, 0x10, 0x84, 0x77, 0x4A, 0x02, 0x7B, 0x0A, 0x36, 0x89, 0x7E, 0x83, 0x61, 0x76, 
-0xEA, 0x31, 0x42, 0x9C, 0x7E, 0xC7, 0xD5, 0xBD, 0xC3, 0xD0, 0x90, 0x10, 0xE7, 0x50, 0x92, 0x68, 
-0xF1, 0x9C, 0x17, 0xE9, 0x8B, 0xBB, 0x99, 0x42, 0xE6, 0xCA, 0xC8, 0x68, 0x33, 0xC4, 0x04, 0x16, 
-0x77, 0x1E, 0x8B, 0x37, 0x89, 0xC5, 0x3B, 0xAE, 0x09, 0x7F, 0x04, 0x42, 0xD2, 0xFC, 0x75, 0x8A, 
-0x8C, 0x35, 0xD0, 0x86, 0xE5, 0x7B, 0x08, 0xE2, 0x5B, 0xA1, 0x20, 0x0E, 0x53, 0x10, 0x41, 0x07, 
-0x04, 0x20, 0xDB, 0xF6, 0xAD, 0x22, 0xB3, 0xEF, 0x93, 0xEF, 0x2F, 0x89, 0x49, 0xEE, 0x69, 0xA0, 
-0x1C, 0x9C, 0xFA, 0x75, 0x5C, 0xD9, 0x8D, 0xD2, 0x57, 0x36, 0xB2, 0x7D, 0x86, 0xB2, 0x58, 0x34, 
-0xEA, 0x7D, 0xE4, 0x10, 0x72, 0xB6, 0xD0, 0xB5, 0x95, 0x30, 0x82, 0xB4, 0x9B, 0xB8, 0x01, 0xFC, 
-0xB0, 0x02, 0xE5, 0x20, 0xDA, 0x64, 0x86, 0x9C, 0xCE, 0xB1, 0xD4, 0x73, 0xEA, 0x75, 0x67, 0xFF, 
-0x2B, 0xD6, 0x49, 0x36, 0xB2, 0x33, 0x99, 0x9F, 0x72, 0xF4, 0xF8, 0x50, 0x52, 0xFA, 0xBB, 0xB6, 
-0xA7, 0xE0, 0xE0, 0x0E, 0x54, 0x72, 0x55, 0x1C, 0xF5, 0xED, 0xD9, 0xC8, 0xC8, 0x57, 0x23, 0x23, 
-0x22, 0x1B, 0x9F, 0x0A, 0x48, 0xE9, 0xDC, 0x71, 0x02, 0x22, 0x41, 0x26, 0x61, 0x5B, 0x2F, 0x61, 
-0x15, 0x7F, 0x5F, 0x90, 0x60, 0xCA, 0x76, 0x57, 0x63, 0x10, 0xDB, 0x9D, 0x79, 0xEB, 0x53, 0x65, 
-0x25, 0xD0, 0xA6, 0xB8, 0x3B, 0xC2, 0x04, 0x1F, 0xE0, 0x25, 0xBB, 0xA7, 0xCA, 0x4A, 0xCE, 0x7C, 
-0x59, 0x69, 0x8E, 0xEA, 0x4F, 0x97, 0x91, 0x70, 0x96, 0x85, 0xDD, 0x56, 0x48, 0x63, 0x8C, 0x32, 
-0xFC, 0x54, 0x19, 0x49, 0x43, 0xB9, 0x58, 0x65, 0x9A, 0xA6, 0xFC, 0x53, 0x65, 0x23, 0x9C, 0x40, 
-0x64, 0xC0, 0xCE, 0x38, 0x59, 0xB0, 0xF3, 0x54, 0xD9, 0x48, 0x43, 0xB5, 0x58, 0x55, 0x62, 0x66, 
-0xC4, 0xFA, 0x5C, 0x4A, 0x4D, 0x37, 0x2C, 0x44, 0x67, 0x75, 0x2B, 0xF9, 0x40, 0x96, 0xEE, 0x51, 
-0x0C, 0x6D, 0xDE, 0x16, 0x98, 0xF7, 0xD0, 0x5B, 0x47, 0x0E, 0xA5, 0x76, 0x10, 0x4A, 0xCD, 0x65, 
-0xAF, 0xA3, 0xDB, 0x7F, 0x32, 0x36, 0xDE, 0xD2, 0x06, 0x0E, 0x90, 0x58, 0x97, 0x7F, 0xF8, 0x11, 
-0xD7, 0x07, 0x11, 0xE9, 0xB3, 0xF9, 0x0F, 0x36, 0x5A, 0xF0, 0x0C, 0xBA, 0x3A, 0x06, 0x95, 0x94, 
-0x49, 0x29, 0x05, 0x44, 0x9B, 0x89, 0xAE, 0x07, 0xB7, 0x0F, 0x2B, 0x47, 0x13, 0x64, 0x8C, 0xAC, 
-0x69, 0x8C, 0x00, 0x39, 0x5A, 0x8D, 0x4F, 0x56, 0xBC, 0xB2, 0x04, 0xDE, 0xED, 0x0A, 0x7A, 0x1A, 
-0x9A, 0xA5, 0xF1, 0xB0, 0x41, 0x86, 0xAE, 0x31, 0xDF, 0x46, 0x19, 0x85, 0x78, 0xAA, 0x41, 0x05, 
-0x56, 0x81, 0x64, 0x2A, 0x4B, 0x40, 0xA2, 0x5D, 0xE6, 0xA5, 0xB6, 0x08, 0x92, 0xE5, 0x42, 0x14, 
-0xE4, 0x3B, 0x2E, 0x0A, 0xF0, 0xBB, 0x6B, 0x2C, 0x10, 0x33, 0x3B, 0xD4, 0x02, 0xA5, 0x38, 0x8C, 
-0x90, 0x08, 0x73, 0xEF, 0xFA, 0xB6, 0x8D, 0x29, 0xCC, 0xAA, 0x26, 0x81, 0xEB, 0x3A, 0x1F, 0x89, 
-0xD3, 0x34, 0xE8, 0xAC, 0x5A, 0xBA, 0x43, 0x12, 0xCC, 0xC4, 0xF5, 0x1D, 0x3B, 0x19, 0x32, 0xD9, 
-0x31, 0xCF, 0xE8, 0xF2, 0x59, 0x4E, 0x9F, 0x1C, 0x55, 0x9F, 0x68, 0xDA, 0xCA, 0xC5, 0xCE, 0xA9, 
-0x93, 0x06, 0x69, 0x7F, 0x48, 0x74, 0xF0, 0xC6, 0xD8, 0x79, 0x9F, 0x20, 0x0F, 0x65, 0x8A, 0xA7, 
-0x9B, 0x3E, 0x9A, 0xD3, 0x79, 0x3A, 0x99, 0xC6, 0xC3, 0x01, 0x65, 0xA0, 0x99, 0xF7, 0x5E, 0x51, 
-0xBF, 0x7D, 0x3B, 0xAE, 0x68, 0x63, 0xD2, 0xB8, 0xB6, 0x17, 0x0B, 0x1E, 0x98, 0xE4, 0xC7, 0xA6, 
-0x3B, 0xD1, 0xB4, 0x7B, 0xA6, 0xE5, 0x4A, 0x84, 0xC4, 0x71, 0x5E, 0x9E, 0x71, 0x9D, 0xB7, 0x3A, 
-0xC6, 0xBA, 0xB2, 0x83, 0x44, 0x73, 0x7F, 0x54, 0xF9, 0x89, 0x13, 0x30, 0xDD, 0xB1, 0x97, 0x6C, 
-0x34, 0xF5, 0x46, 0x31, 0x24, 0x36, 0xD3, 0x1E, 0xF7, 0x25, 0xFF, 0xCC, 0x57, 0x2B, 0x0B, 0x27, 
-0x50, 0x5B, 0x21, 0x95, 0x99, 0xE2, 0xA6, 0x5F, 0x88, 0x89, 0xD3, 0xE0, 0xC1, 0xBA, 0x79, 0x1A, 
-0x08, 0xB8, 0xAE, 0xAB, 0x55, 0xCD, 0x04, 0xD3, 0xDD, 0x21, 0xEA, 0x31, 0xDC, 0xB4, 0x38, 0xB8, 
-0xFE, 0x0C, 0x59, 0x1A, 0xDC, 0x23, 0x8D, 0x30, 0x28, 0x9D, 0x86, 0x43, 0x82, 0xB3, 0x39, 0x79, 
-0xD0, 0xDC, 0xEE, 0xDF, 0x9F, 0x1B, 0x96, 0xA6, 0x0A, 0xCC, 0x28, 0x79, 0x2A, 0x59, 0xFE, 0x21, 
-0x4D, 0xFD, 0x3B, 0xE8, 0x17, 0x4D, 0x70, 0x25, 0x38, 0x63, 0x23, 0x38, 0x3F, 0x37, 0x62, 0x70, 
-0xA6, 0xAA, 0x28, 0x2A, 0xA9, 0x4C, 0x89, 0x16, 0x69, 0x5D, 0x2B, 0xAE, 0x79, 0x4A, 0xB9, 0xA9, 
-0x32, 0xA1, 0x02, 0x02, 0x0D, 0x9D, 0x13, 0xA9, 0xBF, 0xB2, 0xC0, 0xC1, 0x34, 0x2E, 0xDD, 0xA3, 
-0x50, 0xAA, 0xDD, 0x05, 0x32, 0x40, 0xDD, 0x4B, 0x3E, 0x83, 0xA7, 0x13, 0x8E, 0x4B, 0xEA, 0x7C, 
-0xC2, 0x31, 0xF3, 0xE8, 0xFC, 0xDD, 0x6D, 0x24, 0x3B, 0xFF, 0x48, 0x17, 0xDD, 0x0C, 0x47, 0x52, 
-0x62, 0xDC, 0x44, 0xEA, 0xC5, 0x52, 0x24, 0x63, 0x41, 0x4C, 0x0F, 0x10, 0x27, 0x4A, 0x4D, 0x2B, 
-0x22, 0x49, 0x0D, 0x56, 0xD6, 0x39, 0x17, 0x07, 0x41, 0xE8, 0xFD, 0x43, 0x0F, 0xBC, 0x85, 0x80, 
-0x45, 0x90, 0xD8, 0x44, 0xE6, 0xD2, 0xCD, 0xB9, 0xC1, 0x96, 0x9B, 0x0F, 0x19, 0xC3, 0x85, 0x90, 
-0xB1, 0x13, 0x2B, 0x75, 0x6B, 0xFE, 0x98, 0x9E, 0x5B, 0x59, 0x55, 0x11, 0x53, 0x2C, 0x15, 0x8C, 
-0x56, 0x05, 0x9F, 0x21, 0x7F, 0x0E, 0x42, 0x8A, 0x40, 0x9F, 0x2C, 0xDC, 0x6E, 0x1B, 0x96, 0xE7, 
-0x3E, 0x5F, 0x98, 0x9A, 0xAB, 0x3B, 0xD1, 0x0B, 0x18, 0xE3, 0x89, 0xDA, 0x0A, 0xB0, 0x62, 0x3D, 
-0x8B, 0x68, 0xA0, 0x1A, 0xF5, 0x3E, 0xB4, 0x17, 0x3B, 0x86, 0xA3, 0x3A, 0x3E, 0x0A, 0xB2, 0x57, 
-0x1E, 0x79, 0xD0, 0x6B, 0x43, 0x54, 0x11, 0xD9, 0xB5, 0x22, 0x7D, 0x7D, 0xC2, 0x5D, 0xD9, 0xA9, 
-0x2F, 0x47, 0x54, 0x43, 0xA8, 0x35, 0x6C, 0xF4, 0xBC, 0x6C, 0x70, 0xDB, 0xED, 0xE8, 0xE8, 0xAA, 
-0x29, 0x66, 0xE8, 0x1E, 0xD0, 0x48, 0xFA, 0x0D, 0x91, 0xC5, 0x23, 0x7A, 0xAF, 0xE9, 0x03, 0xEF, 
-0x84, 0x2F, 0xF4, 0x7A, 0xCD, 0xB1, 0x1F, 0xD9, 0x94, 0x7D, 0x76, 0x51, 0x89, 0x35, 0x69, 0xB0, 
-0x96, 0x64, 0xAE, 0xAD, 0x92, 0xA1, 0x60, 0x12, 0xD5, 0xF4, 0xBC, 0x8F, 0x51, 0xA0, 0x60, 0xC7, 
-0x48, 0x63, 0x24, 0x77, 0x41, 0x48, 0xEA, 0x75, 0xE0, 0xB8, 0x38, 0xF4, 0x2D, 0x4F, 0x8B, 0x91, 
-0x21, 0xAD, 0x5A, 0xB0, 0xD8, 0x90, 0x84, 0x7F, 0xC7, 0xBE, 0x57, 0x7B, 0x8C, 0x60, 0x5C, 0x69, 
-0xB9, 0x09, 0x9F, 0xA0, 0x21, 0x03, 0xBF, 0x10, 0xDC, 0xE7, 0xD7, 0x06, 0x1B, 0xA8, 0x35, 0x98, 
-0x26, 0x99, 0xCC, 0x9A, 0x06, 0x81, 0xD9, 0xFF, 0x05, 0xEA, 0x88, 0x1C, 0x38, 0x63, 0x62, 0xEC, 
-0x88, 0x28, 0x46, 0xA7, 0xFC, 0x86, 0x5E, 0xB1, 0xE1, 0x0D, 0xAD, 0x84, 0xB4, 0x4F, 0x51, 0xE7, 
-0x98, 0xC9, 0xBC, 0xC1, 0x7D, 0x68, 0x9B, 0x47, 0xED, 0x8D, 0x21, 0x36, 0x3F, 0x07, 0x53, 0x33, 
-0x2D, 0x37, 0xF8, 0x2A, 0x4C, 0x26, 0xF5, 0x19, 0xDA, 0x08, 0x48, 0x36, 0x02, 0x60, 0xAF, 0x9E, 
-0xDB, 0x5B, 0x6A, 0x31, 0x59, 0xD8, 0xCA, 0x9A, 0x44, 0x53, 0xD8, 0x51, 0x43, 0x0F, 0x47, 0x47, 
-0x40, 0x81, 0x5F, 0x71, 0x61, 0x75, 0x14, 0xAC, 0x38, 0x3A, 0x9E, 0x4A, 0x5B, 0x67, 0x8E, 0x6B, 
-0xA5, 0x63, 0x57, 0x8E, 0x0A, 0x8B, 0x16, 0x60, 0x0F, 0x9E, 0xCD, 0x65, 0x3C, 0x4C, 0x1B, 0x66, 
-0x6B, 0x7D, 0x7C, 0xD0, 0xDB, 0x1D, 0xEC, 0xD3, 0xBB, 0x12, 0x3A, 0x96, 0x8C, 0xE7, 0x1C, 0xEC, 
-0x2C, 0x08, 0xC5, 0x9B, 0x28, 0xF9, 0xF9, 0x82, 0x37, 0x79, 0xA8, 0x77, 0xE1, 0xB8, 0xB3, 0xA1, 
-0xDD, 0x92, 0x07, 0x19, 0x1A, 0x71, 0xE8, 0x03, 0x2A, 0xF1, 0x5E, 0xD6, 0xFD, 0xB2, 0xFA, 0xCC, 
-0xF6, 0x08, 0xD9, 0x22, 0x2B, 0xDB, 0x4A, 0x06, 0x31, 0x1C, 0x6C, 0x3C, 0x0D, 0xEA, 0xAC, 0x4B, 
-0x73, 0x12, 0x68, 0xE1, 0x3A, 0x01, 0xFA, 0x5B, 0x9C, 0x2A, 0xD6, 0x81, 0x20, 0x59, 0x06, 0x17, 
-0xD8, 0x5C, 0x43, 0x47, 0x8C, 0x4B, 0x7C, 0x14, 0x73, 0x27, 0xB4, 0x16, 0xDD, 0xB9, 0xAB, 0x3B, 
-0xBF, 0x8C, 0x1F, 0x56, 0x3C, 0x01, 0xB2, 0xE4, 0x4F, 0xF8, 0x04, 0x29, 0xE4, 0xBB, 0x40, 0x74, 
-0x2F, 0x19, 0x5D, 0x8F, 0xC9, 0xF8, 0x2E, 0x77, 0xFB, 0x8D, 0x87, 0x22, 0xDC, 0x7A, 0xEB, 0xF7, 
-0xB0, 0x71, 0xBD, 0x2F, 0xB6, 0x4D, 0xF0, 0x27, 0x80, 0x8F, 0xE1, 0xCE, 0x24, 0x59, 0xA5, 0xEB, 
-0x9A, 0x8D, 0x37, 0x76, 0x3F, 0xF0, 0xD7, 0x2D, 0x3F, 0xD9, 0xC4, 0x32, 0xF4, 0xA5, 0xB8, 0x6B, 
-0x94, 0x66, 0xAC, 0x4C, 0x2C, 0x34, 0x4B, 0x7C, 0x01, 0xDE, 0x6F, 0x90, 0xB0, 0xBF, 0x5B, 0x4D, 
-0x72, 0xC6, 0xE9, 0x8D, 0x14, 0xEE, 0x26, 0x99, 0x8A, 0x78, 0x9E, 0x0A, 0x14, 0xE3, 0xE2, 0x99, 
-0xB0, 0xEA, 0x93, 0xB1, 0x13, 0xD7, 0x86, 0x2B, 0x34, 0x5C, 0xA8, 0x45, 0x18, 0x8E, 0xF9, 0x79, 
-0xF3, 0x24, 0x88, 0x31, 0xCB, 0x8E, 0x12, 0x33, 0x8A, 0xBD, 0x98, 0xBF, 0x23, 0x35, 0x73, 0x4A, 
-0xB1, 0xDC, 0xA9, 0x41, 0x2A, 0x81, 0x1F, 0x95, 0xC7, 0x93, 0xCD, 0x1B, 0xBE, 0x2E, 0x1C, 0xA2, 
-0x97, 0xF7, 0x46, 0x88, 0x4B, 0x17, 0x88, 0xFE, 0x99, 0x1D, 0xCC, 0x33, 0xAD, 0x27, 0x52, 0x5F, 
-0xA4, 0x4A, 0x56, 0x7F, 0x35, 0x63, 0xBA, 0x5F, 0x4B, 0x4A, 0xC9, 0xFF, 0xB9, 0xDD, 0xD1, 0xEB, 
-0x6E, 0xF2, 0xE8, 0x38, 0xCB, 0xB2, 0x65, 0xD6, 0xC4, 0x14, 0x9E, 0x15, 0x96, 0xAC, 0x37, 0x20, 
-0xC3, 0xFC, 0x42, 0xE2, 0x12, 0x43, 0x18, 0xE9, 0xCF, 0x5C, 0xC4, 0x51, 0x72, 0x9E, 0x21, 0x8E, 
-0x14, 0x2C, 0x44, 0x15, 0x80, 0x81, 0x6D, 0xE5, 0x47, 0xEE, 0x82, 0x37, 0xE2, 0x8C, 0xB3, 0x54, 
-0x20, 0xE7, 0x9E, 0xF4, 0xB6, 0x31, 0x2F, 0xE9, 0x49, 0x7E, 0x5C, 0x54, 0xC9, 0x77, 0xFE, 0x4E, 
-0xF3, 0xB8, 0x02, 0x90, 0xA2, 0x73, 0x0F, 0xA6, 0x92, 0xD8, 0x1B, 0x09, 0xFD, 0x35, 0xF3, 0xE4, 
-0x7C, 0x56, 0xA5, 0x71, 0x01, 0xD2, 0x43, 0x3A, 0xA6, 0xED, 0xFC, 0x8D, 0x47, 0xEF, 0x58, 0x72, 
-0xDE, 0x4C, 0xCD, 0x60, 0x06, 0x03, 0x1E, 0xCC, 0xF6, 0x1F, 0xCE, 0xF7, 0x79, 0xF5, 0x29, 0xCD, 
-0xE4, 0xDD, 0x64, 0xAD, 0xA7, 0x24, 0x4D, 0x96, 0x9C, 0x0F, 0x27, 0xC7, 0x57, 0x59, 0x05, 0x32, 
-0x5B, 0x95, 0x2C, 0xD6, 0xF8, 0x8A, 0x51, 0xFB, 0xE2, 0x99, 0x10, 0xBD, 0x6E, 0x94, 0x4C, 0x94, 
-0xE4, 0x0C, 0x2C, 0x0D, 0xA5, 0x30, 0xA9, 0xA3, 0x93, 0xCD, 0xAA, 0xE8, 0xBA, 0x3E, 0xE4, 0xA7, 
-0x8E, 0x4F, 0x38, 0x4F, 0x8D, 0x0B, 0x67, 0xF7, 0x3F, 0xEE, 0xEA, 0xA2, 0xE8, 0xF4, 0x4E, 0x73, 
-0x83, 0x96, 0x71, 0xC8, 0xDF, 0x4C, 0xE1, 0xEE, 0x17, 0xC9, 0x05, 0xF2, 0x47, 0x7F, 0x59, 0x45, 
-0xCD, 0xB0, 0x64, 0x0F, 0xC2, 0xDF, 0x1C, 0xAA, 0x87, 0xF2, 0x7A, 0x97, 0x5E, 0xAA, 0xBD, 0x55, 
-0x49, 0x92, 0xF0, 0x5E, 0x67, 0xEB, 0x37, 0x0F, 0xE9, 0x4A, 0x8B, 0x06, 0x65, 0x27, 0xA3, 0x5F, 
-0xFD, 0x6A, 0x8C, 0x8D, 0x46, 0x55, 0x0D, 0xFB, 0x64, 0x8F, 0x2D, 0x0D, 0xAB, 0x2A, 0x68, 0xBB, 
-0xF4, 0xC8, 0x42, 0x4A, 0xB8, 0x3F, 0x73, 0x45, 0x87, 0xBD, 0x9B, 0x55, 0xC9, 0xAD, 0x19, 0xDF, 
-0x94, 0x8A, 0x7E, 0xA0, 0x10, 0x33, 0xEF, 0x4A, 0x78, 0x7B, 0x09, 0x68, 0x53, 0x3B, 0xB2, 0x7E, 
-0x9B, 0x5E, 0x56, 0x5B, 0x4A, 0xDC, 0x5D, 0x54, 0x44, 0x8F, 0x96, 0x8C, 0xF8, 0x09, 0xC3, 0x2D, 
-0x21, 0xF9, 0xB8, 0xE3, 0xC1, 0x5F, 0x61, 0xE1, 0xC2, 0xF9, 0x95, 0xBF, 0xFA, 0x40, 0x00, 0xE7, 
-0xF7, 0x4D, 0x67, 0x5D, 0x8B, 0x7E, 0x7F, 0x7C, 0xC2, 0xEB, 0xB0, 0x36, 0xAE, 0xEA, 0xEB, 0x7A, 
-0x8F, 0xDF, 0x5D, 0x30, 0xE4, 0xDF, 0xC6, 0x0B, 0xD7, 0x48, 0x6D, 0x93, 0x92, 0xCE, 0xE6, 0x2E, 
-0x74, 0x41, 0x4D, 0xF6, 0xA5, 0x4C, 0x35, 0x3D, 0xAD, 0xE9, 0x67, 0x5A, 0xD5, 0x6A, 0x33, 0xD5, 
-0xEA, 0x64, 0x4E, 0x77, 0x34, 0x99, 0x6A, 0xAF, 0x8C, 0x3C, 0x5B, 0x33, 0x26, 0x77, 0x07, 0xD1, 
-0x82, 0xDD, 0xD0, 0x20, 0xC4, 0x78, 0x52, 0xDA, 0xA6, 0xA6, 0xCC, 0x9D, 0x4B, 0xCD, 0xDD, 0x43, 
-0x23, 0xDE, 0x5D, 0x18, 0x29, 0xD2, 0xFD, 0xA8, 0x40, 0x9E, 0x79, 0xF1, 0xD8, 0x69, 0xD7, 0xE3, 
-0xC3, 0x6B, 0xD1, 0x41, 0x90, 0x3B, 0xB6, 0x78, 0x99, 0xC8, 0x38, 0xA6, 0x3A, 0xC7, 0xBA, 0xEA, 
-0xDB, 0x62, 0xEF, 0x17, 0x9B, 0x17, 0xCC, 0x75, 0xAF, 0xC9, 0x44, 0xF1, 0x3D, 0x67, 0xEC, 0x99, 
-0xAF, 0x69, 0x03, 0xEB, 0x9E, 0x7C, 0xB8, 0xEB, 0xCB, 0xFC, 0x54, 0xF7, 0xD6, 0xBF, 0x58, 0x8D, 
-0x69, 0x21, 0x59, 0xCC, 0xDA, 0x60, 0xF6, 0x05, 0x3C, 0x52, 0x7B, 0xD7, 0x16, 0x25, 0x05, 0x4B, 
-0x3C, 0xDE, 0x27, 0x55, 0x7D, 0x31, 0x17, 0x29, 0xD8, 0xDC, 0x9D, 0x54, 0xB9, 0xFA, 0xCA, 0x39, 
-0x7F, 0xEE, 0xB2, 0x91, 0xC1, 0x79, 0x73, 0x7B, 0xC6, 0x04, 0x2E, 0xFE, 0x8A, 0x8F, 0xF1, 0x1A, 
-0xCA, 0x34, 0xA3, 0xDB, 0xE6, 0x0C, 0xCA, 0xC3, 0x47, 0x36, 0x4C, 0xC5, 0x87, 0x23, 0x24, 0x8E, 
-0x46, 0xA9, 0x49, 0xBF, 0xE7, 0xBB, 0x13, 0x15, 0x35, 0xFC, 0x3D, 0x74, 0x6A, 0xD5, 0x67, 0x5A, 
-0xFF, 0xA9, 0x8A, 0xE1, 0x32, 0x65, 0x49, 0x3E, 0xC1, 0x38, 0x1B, 0x8C, 0xC8, 0x90, 0x9F, 0x2B, 
-0x22, 0x50, 0xEF, 0x50, 0xB0, 0x5F, 0x7A, 0xA1, 0x83, 0x63, 0xC8, 0x39, 0xF8, 0x72, 0x65, 0x8A, 
-0x0F, 0xC1, 0x03, 0x5A, 0x45, 0x1B, 0x7C, 0x99, 0x4E, 0x85, 0xF8, 0x6A, 0x95, 0xFB, 0x71, 0x17, 
-0x37, 0xA1, 0x89, 0xE3, 0x6F, 0xFD, 0x99, 0x3C, 0x2C, 0x53, 0xEE, 0xBC, 0xA8, 0xB5, 0x2D, 0x8D, 
-0xFF, 0x7C, 0xD0, 0x24, 0xA9, 0x41, 0xAF, 0xE3, 0xBE, 0x58, 0x15, 0x96, 0xA8, 0xF9, 0x9A, 0xEE, 
-0x17, 0xA6, 0xF8, 0x43, 0xFC, 0xE4, 0x71, 0x31, 0x22, 0xFD, 0xFC, 0xC1, 0x56, 0x22, 0x29, 0x2E, 
-0x94, 0xEA, 0x10, 0xB3, 0xD7, 0xEB, 0xDC, 0x46, 0x6E, 0xC4, 0x22, 0xFA, 0x2C, 0xB3, 0xAF, 0xFC, 
-0x8A, 0x02, 0xAD, 0x10, 0xE8, 0xA4, 0x8D, 0xE6, 0x6D, 0xA5, 0x1C, 0xD0, 0xDD, 0xA4, 0xDF, 0x07, 
-0x1B, 0xEE, 0xCC, 0x1F, 0x48, 0x04, 0x96, 0xC9, 0xA5, 0x44, 0x5E, 0x25, 0xF7, 0xD3, 0xA5, 0xD7, 
-0xBE, 0xA3, 0x4F, 0x8A, 0xC2, 0xE7, 0x3A, 0xF9, 0x49, 0xC0, 0x2A, 0x9F, 0xDD, 0x13, 0x95, 0xE0, 
-0xDB, 0x32, 0x9E, 0xBC, 0xEB, 0x34, 0x53, 0x91, 0xD5, 0xB4, 0x06, 0xEA, 0xAA, 0xB3, 0x1A, 0x09, 
-0xE8, 0x4E, 0x5C, 0x66, 0x92, 0x0D, 0xAE, 0xAB, 0x68, 0xA9, 0xA9, 0xA8, 0x5B, 0x39, 0x50, 0x19, 
-0x72, 0x70, 0xF2, 0xDF, 0xE4, 0x8B, 0x7A, 0xAE, 0x4E, 0x24, 0xB0, 0xD4, 0x51, 0x1F, 0x3E, 0x1E, 
-0xFF, 0xF1, 0x37, 0xF8, 0xA6, 0xD4, 0x18, 0x13, 0x51, 0x00, 0x00, 0x00
-};
-
-#endif
+#ifndef STYLE_CSS_H_H
+#define STYLE_CSS_H_H
+
+#include <Arduino.h>
+
+// Generated by tools/build_assets.js from style.css - do not edit
+const char style_css[] PROGMEM = {
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xCD, 0x3C, 0x6B, 0x8F, 0xAB, 0xBA, 
+0x76, 0x7F, 0x85, 0xDE, 0xAD, 0xAD, 0x99, 0xB4, 0x80, 0x78, 0x87, 0x10, 0xA9, 0xBA, 0x6D, 0xA5, 
+0xAB, 0x9E, 0x0F, 0x6D, 0xA5, 0x5E, 0x55, 0x6A, 0x3F, 0x1A, 0xB0, 0x13, 0x77, 0x13, 0x40, 0xE0, 
+0x4C, 0x32, 0x27, 0xE2, 0xBF, 0x57, 0xB6, 0x79, 0xD8, 0xC6, 0x10, 0x32, 0xD3, 0x7B, 0x5B, 0xCD, 
+0x3E, 0x73, 0x12, 0x1E, 0xEB, 0xED, 0xF5, 0xF2, 0xF2, 0x9C, 0xC9, 0xA5, 0x78, 0xA4, 0x20, 0xFB, 
+0x75, 0x6A, 0xAA, 0x6B, 0x99, 0x5B, 0x59, 0x55, 0x54, 0x4D, 0xF2, 0x03, 0xF9, 0x28, 0x40, 0xD1, 
+0x91, 0x34, 0xA0, 0x6C, 0x31, 0xC1, 0x55, 0x99, 0xA8, 0xCF, 0x18, 0x76, 0xD8, 0x1A, 0x10, 0xB4, 
+0xB0, 0x3B, 0x93, 0x4B, 0x61, 0xE7, 0xA0, 0xF9, 0x65, 0x91, 0x33, 0xBC, 0x40, 0x0D, 0x34, 0x07, 
+0x38, 0xC8, 0x85, 0x5D, 0xD2, 0x54, 0x15, 0x79, 0x58, 0x56, 0x7A, 0x52, 0xD0, 0x58, 0x56, 0x06, 
+0x9A, 0xDC, 0x4A, 0x4F, 0xC9, 0x0F, 0x84, 0xD0, 0xD1, 0xB2, 0x08, 0xBC, 0x13, 0xAB, 0x6E, 0xF0, 
+0x05, 0x34, 0x9F, 0xC9, 0x0F, 0x17, 0x79, 0x07, 0x7F, 0x3F, 0x5C, 0x6E, 0x61, 0x56, 0x95, 0x39, 
+0xBB, 0x11, 0xA5, 0x7B, 0x2F, 0x76, 0x8E, 0xD6, 0xF0, 0xE8, 0x00, 0xD6, 0x0B, 0x23, 0x1F, 0xA6, 
+0x47, 0xCB, 0x6A, 0xAF, 0x59, 0x06, 0xDB, 0x76, 0xB8, 0xEE, 0x3A, 0xE9, 0x21, 0x76, 0x8F, 0x96, 
+0x75, 0x03, 0x4D, 0x89, 0xCB, 0x89, 0x8C, 0xF0, 0x00, 0x1D, 0xFA, 0x7C, 0x0E, 0xCA, 0x13, 0x6C, 
+0x86, 0xCB, 0x10, 0x05, 0x41, 0x10, 0x1C, 0x2D, 0x2B, 0xAD, 0x9A, 0x5C, 0xB8, 0x1C, 0xC2, 0x3D, 
+0x83, 0x9E, 0x9D, 0x41, 0x43, 0xAC, 0x53, 0x83, 0x73, 0x91, 0x13, 0x76, 0x91, 0xB1, 0x02, 0xE8, 
+0x4F, 0x97, 0x56, 0xF9, 0xA7, 0x28, 0x1E, 0x91, 0x7F, 0x2E, 0x18, 0x91, 0x7F, 0x17, 0x78, 0xBE, 
+0xEF, 0xCD, 0x44, 0x20, 0x88, 0x45, 0xE0, 0x3F, 0x4B, 0xF3, 0x10, 0xBA, 0x73, 0xFE, 0x23, 0x07, 
+0x84, 0x08, 0xCC, 0x08, 0xF7, 0xFD, 0xC0, 0x0D, 0x43, 0x85, 0x70, 0x17, 0x7A, 0x07, 0x3F, 0x95, 
+0x08, 0x77, 0x90, 0xBB, 0xF7, 0x0E, 0x2A, 0xE1, 0x86, 0x4D, 0x89, 0x14, 0xB4, 0x9B, 0x14, 0xB8, 
+0x84, 0xA0, 0xB1, 0x4E, 0x0D, 0xC8, 0x31, 0x2C, 0xC9, 0xBB, 0xEB, 0x87, 0x39, 0x3C, 0x99, 0x3F, 
+0x5C, 0xD7, 0x8D, 0xBD, 0xBD, 0xE1, 0xFC, 0x34, 0x39, 0x28, 0x60, 0xB8, 0x8E, 0xF3, 0x73, 0xF7, 
+0x37, 0xF8, 0x52, 0x57, 0x0D, 0x01, 0x25, 0x39, 0x56, 0x35, 0xC8, 0x30, 0xF9, 0x4C, 0x5C, 0xE1, 
+0x5A, 0x5A, 0xDD, 0xAD, 0xF6, 0x0C, 0xF2, 0xEA, 0x96, 0x38, 0x46, 0x5C, 0xDF, 0x0D, 0xCF, 0xA9, 
+0xEF, 0x46, 0x73, 0x4A, 0xC1, 0xBB, 0x63, 0xD2, 0x1F, 0x3B, 0xD8, 0x99, 0x8E, 0x11, 0xD4, 0x77, 
+0xC3, 0x55, 0xEF, 0xF8, 0x3B, 0x09, 0x90, 0xC8, 0x34, 0xE7, 0x6F, 0xBA, 0xAD, 0x61, 0xAB, 0x2A, 
+0x49, 0x53, 0x15, 0x16, 0x26, 0xF0, 0x62, 0xCE, 0xEE, 0x12, 0x50, 0xFE, 0xB2, 0x0A, 0xD0, 0x12, 
+0x0B, 0xE1, 0xA2, 0x80, 0x92, 0x00, 0x7A, 0xF6, 0x3A, 0xFD, 0x4B, 0x1F, 0xB8, 0xBD, 0x82, 0xC2, 
+0xBA, 0x35, 0xA0, 0xAE, 0x61, 0xB3, 0x49, 0x70, 0x8C, 0xD6, 0x99, 0xE0, 0x14, 0x8E, 0x82, 0x7D, 
+0x18, 0x46, 0x3A, 0xF5, 0x30, 0x05, 0xBE, 0x80, 0xAE, 0xC7, 0x41, 0xD1, 0xF5, 0x98, 0x19, 0xBA, 
+0x39, 0xE4, 0xF6, 0xB3, 0x25, 0xF0, 0x62, 0xB5, 0x04, 0x90, 0x6B, 0x2B, 0x09, 0xA0, 0xB7, 0x1E, 
+0x9D, 0x9D, 0xCD, 0xC0, 0x9C, 0x21, 0xC8, 0x37, 0xCA, 0xE1, 0xA9, 0x01, 0x49, 0xC6, 0xC2, 0x4C, 
+0xC2, 0xFB, 0x86, 0x49, 0xD8, 0x8C, 0x40, 0x8B, 0x54, 0xA7, 0x53, 0x01, 0xAD, 0x94, 0x94, 0x8F, 
+0x1C, 0xB7, 0x75, 0x01, 0x3E, 0x13, 0x54, 0xC0, 0xFB, 0x11, 0x14, 0xF8, 0x54, 0x32, 0xF3, 0x68, 
+0x93, 0x0C, 0x96, 0x04, 0x36, 0xC7, 0xFF, 0xBE, 0xB6, 0x04, 0x23, 0xBA, 0xE0, 0x4A, 0x02, 0x4B, 
+0x32, 0x5C, 0xBE, 0xE1, 0x9C, 0x9C, 0x93, 0xC0, 0xA9, 0xEF, 0xC7, 0x33, 0xC4, 0xA7, 0x33, 0xE1, 
+0x9F, 0x39, 0xFA, 0xC4, 0xAD, 0xEF, 0x46, 0x5B, 0x15, 0x38, 0x37, 0x3E, 0x40, 0xF3, 0x2E, 0xAF, 
+0xCE, 0xDD, 0x51, 0x90, 0x0B, 0xBF, 0xDD, 0xFB, 0x84, 0xDD, 0x31, 0xBB, 0x36, 0x6D, 0xD5, 0x24, 
+0x75, 0x85, 0x19, 0x92, 0xFE, 0x35, 0x2A, 0xB4, 0x6B, 0x9B, 0xD0, 0xB5, 0x20, 0xFA, 0x69, 0x50, 
+0x14, 0x86, 0xED, 0xB7, 0x46, 0x76, 0x4D, 0x71, 0x66, 0xA5, 0xF0, 0x77, 0x0C, 0x9B, 0x77, 0xDB, 
+0x0B, 0x4D, 0x3B, 0x36, 0xE9, 0xFF, 0xDC, 0xDD, 0xB1, 0x06, 0x79, 0x8E, 0xCB, 0x53, 0x12, 0xD7, 
+0xF7, 0x63, 0x5D, 0xF5, 0xEF, 0x35, 0xB0, 0x00, 0x04, 0x7F, 0xC0, 0x63, 0xF5, 0x01, 0x1B, 0x54, 
+0x54, 0xB7, 0xE4, 0x8C, 0xF3, 0x1C, 0x96, 0xB2, 0xA8, 0x29, 0x0B, 0xBE, 0x22, 0x69, 0x27, 0xDC, 
+0xCD, 0x25, 0x98, 0x9C, 0x29, 0x9C, 0xC7, 0x8C, 0xA9, 0xC1, 0xF7, 0xED, 0x38, 0xCD, 0xA8, 0x6A, 
+0x2E, 0x09, 0xFB, 0x54, 0x00, 0x02, 0xFF, 0xEB, 0xDD, 0xF2, 0xEA, 0xFB, 0x4E, 0x46, 0x49, 0x15, 
+0x1B, 0x29, 0x28, 0x5D, 0x8D, 0x91, 0xCE, 0x74, 0xF8, 0xD4, 0x4E, 0x97, 0x16, 0xD2, 0x73, 0x5E, 
+0x7A, 0xB3, 0x7C, 0x4E, 0xA8, 0xA7, 0x11, 0xCD, 0x80, 0x00, 0x67, 0x55, 0xF9, 0xE0, 0x16, 0xE3, 
+0x09, 0x16, 0xC3, 0x3E, 0xCB, 0x81, 0x49, 0x55, 0x6F, 0xAC, 0xAA, 0xD7, 0x0F, 0x4C, 0xD7, 0x0E, 
+0x23, 0xD3, 0x8E, 0x02, 0xAA, 0xE0, 0x51, 0xB4, 0x56, 0xD5, 0xE0, 0x13, 0x2E, 0x27, 0xF3, 0x2C, 
+0x0A, 0xEA, 0xE7, 0xCB, 0x13, 0x4C, 0xC6, 0x67, 0xCC, 0xDE, 0x19, 0xAF, 0x13, 0x6A, 0x95, 0xF0, 
+0xF6, 0x18, 0x8D, 0x05, 0xA4, 0x6D, 0x55, 0x5C, 0x09, 0x3C, 0x92, 0xAA, 0x4E, 0x42, 0xE7, 0xE7, 
+0xB1, 0x80, 0x88, 0xB0, 0x0F, 0x17, 0xD0, 0x50, 0x84, 0x16, 0x5B, 0x8F, 0x8E, 0xE1, 0x18, 0xEC, 
+0xD3, 0x73, 0x19, 0x4B, 0x42, 0x19, 0x02, 0xAD, 0x07, 0x63, 0xE4, 0x74, 0x36, 0x77, 0x1C, 0x7F, 
+0xB9, 0x75, 0x59, 0x56, 0x25, 0xD4, 0xAD, 0x2A, 0x65, 0xDD, 0xBD, 0xB8, 0xC8, 0x9E, 0x2D, 0xAC, 
+0x91, 0xAF, 0x35, 0x3B, 0x10, 0x70, 0x8E, 0x0A, 0x63, 0x98, 0x69, 0xE6, 0x75, 0xFC, 0xDD, 0xC2, 
+0x65, 0x0E, 0xEF, 0x89, 0xDB, 0xD1, 0x20, 0x86, 0xF0, 0x49, 0xB5, 0xFB, 0x25, 0x07, 0xEB, 0xA7, 
+0xB1, 0x87, 0x22, 0xE6, 0x60, 0x79, 0xAE, 0x34, 0x06, 0x9A, 0x25, 0x7B, 0x0E, 0x0F, 0xA6, 0xEB, 
+0x3B, 0xA6, 0x17, 0x44, 0x94, 0xC1, 0x9D, 0x88, 0x70, 0xBE, 0x3C, 0x96, 0xD0, 0xF6, 0xB8, 0x58, 
+0xC0, 0xC9, 0x03, 0x98, 0xC7, 0x3D, 0xDA, 0xAD, 0xAE, 0x40, 0x76, 0xF4, 0x22, 0x49, 0xBE, 0x42, 
+0x12, 0xC8, 0xA8, 0xC8, 0x4D, 0xBB, 0xA8, 0x4E, 0xD5, 0x95, 0x08, 0x97, 0x1E, 0x5A, 0x5C, 0x8E, 
+0xF4, 0xB6, 0x21, 0x6A, 0x46, 0x84, 0x21, 0xDD, 0x18, 0xAC, 0x14, 0x21, 0x34, 0x97, 0x86, 0xFC, 
+0xE4, 0x84, 0xB3, 0xA9, 0x08, 0x20, 0xF0, 0xFD, 0xE0, 0xE4, 0xF0, 0xB4, 0xD3, 0xA6, 0x22, 0x2F, 
+0x68, 0x31, 0x40, 0x41, 0x04, 0x43, 0x26, 0xCE, 0xC0, 0xF7, 0xE3, 0x0C, 0x3C, 0xD5, 0xE2, 0xFE, 
+0x60, 0xEE, 0x1D, 0xD3, 0xF3, 0x0E, 0x34, 0x3E, 0xAE, 0xA1, 0xDF, 0xAE, 0xD3, 0x1E, 0x33, 0x25, 
+0xC2, 0xDF, 0xFB, 0x0E, 0xF0, 0x75, 0x44, 0xC8, 0x8A, 0x13, 0xA8, 0x08, 0x76, 0x9D, 0x20, 0xDF, 
+0x2D, 0xF8, 0x78, 0x52, 0xCE, 0xF0, 0xE5, 0x99, 0x17, 0x79, 0xD1, 0x53, 0xA6, 0x3D, 0xFF, 0x60, 
+0x46, 0x31, 0xFD, 0xC7, 0x2D, 0x57, 0xB0, 0x89, 0xCD, 0x5C, 0xF6, 0xA8, 0x28, 0xD6, 0xF4, 0xE0, 
+0x66, 0x6E, 0xF6, 0x2D, 0xCB, 0x15, 0x28, 0xF2, 0x75, 0x14, 0x2D, 0x59, 0xCF, 0x88, 0xE3, 0x3F, 
+0x39, 0x8E, 0xB9, 0x06, 0x5F, 0x93, 0xE5, 0x12, 0x57, 0x2B, 0xB2, 0xF4, 0x1C, 0xD3, 0x8F, 0xE9, 
+0x3F, 0xAD, 0x01, 0x7D, 0x45, 0xB4, 0x3D, 0x66, 0x4A, 0xC4, 0xE1, 0xE0, 0xA6, 0x6E, 0xFA, 0xDC, 
+0x80, 0x04, 0x2A, 0x82, 0x31, 0xC0, 0x52, 0x59, 0xD9, 0xED, 0xB5, 0xB4, 0x5A, 0x48, 0x08, 0x2E, 
+0x4F, 0xA6, 0x78, 0xFD, 0x52, 0x55, 0xE3, 0x8D, 0x07, 0x28, 0xF1, 0x05, 0x30, 0x9F, 0x4A, 0xEF, 
+0xFD, 0x09, 0xE4, 0xF0, 0xDF, 0xAE, 0xC4, 0xB0, 0x03, 0xEE, 0x55, 0xAD, 0xEA, 0x4A, 0x0C, 0x54, 
+0x35, 0x37, 0xD0, 0xE4, 0x6D, 0x37, 0x03, 0xD2, 0xE0, 0x56, 0x05, 0x4E, 0x91, 0xF2, 0xCB, 0x1A, 
+0xD0, 0xBF, 0x95, 0x13, 0x64, 0x5C, 0x4E, 0x80, 0xFF, 0xF8, 0x0B, 0x7E, 0xA2, 0x06, 0x5C, 0x60, 
+0x6B, 0x08, 0x54, 0x3C, 0x9C, 0x9F, 0x8F, 0xB1, 0x38, 0x12, 0xAC, 0xAB, 0xCD, 0x40, 0x01, 0xDF, 
+0xDD, 0x5D, 0x47, 0x65, 0x33, 0x3E, 0xE1, 0xCC, 0x9E, 0xB0, 0xE3, 0x5D, 0xA7, 0x03, 0xFD, 0x5B, 
+0xF9, 0x78, 0xFA, 0x9E, 0x04, 0x5A, 0x8B, 0x7C, 0x4C, 0x11, 0xC6, 0xA8, 0x64, 0x51, 0x2D, 0x17, 
+0xE0, 0x73, 0x4A, 0x0D, 0x10, 0xBE, 0xC3, 0x9C, 0xE5, 0x05, 0x0E, 0xCF, 0x0A, 0x9C, 0x3E, 0xFA, 
+0x52, 0xF0, 0x43, 0x6C, 0x63, 0x9F, 0xFB, 0xB8, 0x6A, 0xC1, 0x0F, 0x58, 0x92, 0x96, 0x47, 0xE1, 
+0x21, 0xA2, 0x1D, 0x0E, 0x87, 0xC3, 0x71, 0x22, 0xF7, 0x59, 0x1A, 0xC9, 0x51, 0x53, 0x08, 0xCB, 
+0x24, 0xDA, 0x7D, 0x00, 0x98, 0x54, 0xD4, 0xE2, 0x4B, 0x5D, 0x40, 0x2A, 0x1E, 0xA6, 0x22, 0x39, 
+0x98, 0x07, 0x2C, 0x7D, 0x33, 0xDD, 0x9D, 0x28, 0xCE, 0xE9, 0x8D, 0x87, 0xF3, 0xD3, 0x94, 0x75, 
+0xD1, 0x85, 0xC2, 0x37, 0xDB, 0x89, 0x3B, 0x4D, 0x1D, 0x75, 0xC3, 0x24, 0x3B, 0x1B, 0x76, 0x5B, 
+0x60, 0xB9, 0x12, 0x7A, 0x96, 0x91, 0xF6, 0x2F, 0xE2, 0xB2, 0xBE, 0x92, 0x24, 0x3B, 0xC3, 0xEC, 
+0x17, 0xCC, 0xFF, 0x6E, 0x11, 0x0C, 0x17, 0x91, 0xD4, 0x13, 0xD8, 0x3D, 0x23, 0x26, 0x49, 0x21, 
+0xAA, 0x1A, 0x5D, 0xF3, 0x86, 0xC6, 0xB7, 0x79, 0xFA, 0xF6, 0x72, 0x9A, 0x3D, 0xA4, 0xB4, 0xBC, 
+0x67, 0xB1, 0x06, 0xD1, 0x4E, 0x49, 0x69, 0x55, 0x9B, 0x1C, 0x18, 0x6F, 0xE8, 0xF0, 0x42, 0x31, 
+0x3C, 0x44, 0xD1, 0xA1, 0xF7, 0x1D, 0x13, 0xE9, 0x0A, 0x2D, 0x4E, 0xB0, 0x8F, 0xC3, 0xFD, 0x73, 
+0xEC, 0x08, 0x7D, 0x27, 0x16, 0x2D, 0xA2, 0xE7, 0xBE, 0x4E, 0x83, 0x1E, 0x53, 0x5F, 0x42, 0xB5, 
+0xAB, 0xAF, 0x32, 0x96, 0xC5, 0x89, 0x5C, 0x14, 0x22, 0x8D, 0xC5, 0x5C, 0x20, 0x69, 0x70, 0x66, 
+0x7D, 0x80, 0xE2, 0x0A, 0xB7, 0xB0, 0x82, 0x10, 0x62, 0x7C, 0x70, 0xF5, 0xF4, 0x7C, 0x58, 0x37, 
+0x98, 0xFE, 0xC2, 0xC4, 0x12, 0x8D, 0xA2, 0xC0, 0x75, 0x42, 0xFB, 0x50, 0xE3, 0x4D, 0xD6, 0x94, 
+0x42, 0xAC, 0xB2, 0x60, 0x24, 0xB1, 0x95, 0x57, 0x83, 0x06, 0xD2, 0xBA, 0x5B, 0xF3, 0xE2, 0x9C, 
+0x56, 0xE6, 0x06, 0xF8, 0xEA, 0x64, 0x45, 0x6F, 0xBF, 0x52, 0x2D, 0x02, 0x2F, 0xF5, 0x43, 0x66, 
+0xBE, 0x2F, 0x88, 0xB6, 0xE4, 0x25, 0x9E, 0xE7, 0x38, 0x3C, 0xB6, 0xF9, 0xB9, 0x8B, 0x9C, 0x58, 
+0x17, 0x56, 0xE8, 0xCF, 0x58, 0xCE, 0x7A, 0x41, 0x68, 0xBA, 0x61, 0x6C, 0xBA, 0x2E, 0xAD, 0xDB, 
+0xCC, 0x59, 0xD0, 0x11, 0x6E, 0xEB, 0x62, 0xDF, 0x12, 0x17, 0xE7, 0xEB, 0x05, 0xE7, 0x98, 0x7C, 
+0x2A, 0x9C, 0xF0, 0x14, 0xFC, 0xB8, 0xA9, 0x2B, 0xE4, 0x83, 0x90, 0x6B, 0xC7, 0x05, 0x1E, 0x0C, 
+0xC0, 0x53, 0x4E, 0xA4, 0x64, 0x7D, 0xCE, 0x89, 0x94, 0x38, 0xBF, 0xC0, 0x49, 0x5B, 0xE1, 0x42, 
+0xE1, 0xA2, 0xEF, 0xA8, 0x6E, 0x69, 0x36, 0x45, 0x01, 0x1C, 0x7A, 0x5B, 0xA1, 0x9F, 0x7B, 0xE8, 
+0x29, 0x17, 0x6E, 0x64, 0xBA, 0x71, 0x68, 0xBA, 0x34, 0x4F, 0xD4, 0x70, 0x21, 0xDE, 0xF6, 0x77, 
+0xDD, 0xDF, 0x3E, 0x18, 0x24, 0xFC, 0x3B, 0xED, 0x6C, 0xF4, 0x44, 0xA6, 0xD5, 0x7D, 0x28, 0x48, 
+0x9D, 0xB1, 0xEB, 0xE1, 0x1C, 0x51, 0x55, 0x12, 0x0B, 0x81, 0x0B, 0x2E, 0x3E, 0x13, 0x0B, 0xD4, 
+0x75, 0x01, 0x2D, 0xDE, 0xE1, 0x32, 0xFF, 0xB1, 0xC0, 0xE5, 0xAF, 0x7F, 0x01, 0xD9, 0x9F, 0xD9, 
+0xD7, 0x3F, 0x55, 0x25, 0x31, 0xDF, 0xFE, 0x0C, 0x4F, 0x15, 0x34, 0xFE, 0xE3, 0xB7, 0x37, 0xF3, 
+0xED, 0xDF, 0xAB, 0xB4, 0x22, 0xD5, 0x9B, 0xF9, 0xF6, 0xCF, 0xB0, 0xF8, 0x80, 0x04, 0x67, 0xC0, 
+0xF8, 0x57, 0x78, 0x85, 0x6F, 0xE6, 0xDB, 0x3F, 0x34, 0x18, 0x14, 0x6F, 0x66, 0x0B, 0xCA, 0xD6, 
+0x6A, 0x61, 0x83, 0xD1, 0xA6, 0xD6, 0xB9, 0xA9, 0x7C, 0x15, 0x65, 0x3B, 0xF5, 0xD7, 0xA9, 0x7E, 
+0x84, 0xA8, 0x55, 0x83, 0x13, 0x1C, 0x12, 0x0B, 0x2F, 0x5C, 0x0C, 0x5B, 0x47, 0x31, 0x16, 0x88, 
+0xCD, 0xE4, 0xA9, 0xFF, 0xC3, 0x2A, 0x4C, 0xAA, 0x2F, 0x6B, 0x08, 0xCB, 0x76, 0x28, 0x46, 0xBB, 
+0x09, 0xD3, 0x03, 0x35, 0xD5, 0x45, 0x08, 0x75, 0xA4, 0x9A, 0x12, 0x85, 0x3E, 0xCE, 0xD1, 0x87, 
+0x2D, 0x78, 0xC7, 0x4A, 0x86, 0x35, 0xC0, 0x60, 0x19, 0x96, 0xB7, 0x48, 0xAD, 0x36, 0x2F, 0x12, 
+0xDE, 0x95, 0x09, 0x70, 0x45, 0x02, 0x9C, 0xAE, 0xB3, 0x41, 0x5D, 0xB3, 0x92, 0x1F, 0xE0, 0x12, 
+0x36, 0xA6, 0x0D, 0xAE, 0xE4, 0x2C, 0x7E, 0xEF, 0xEB, 0x9A, 0xF1, 0x8A, 0x40, 0xDF, 0x78, 0x6D, 
+0x10, 0xA9, 0xBF, 0x29, 0x11, 0x50, 0x5E, 0x5B, 0x97, 0x4F, 0x06, 0xCA, 0x0F, 0xD0, 0x3E, 0x94, 
+0x4C, 0x45, 0xEC, 0x3F, 0x4A, 0xF4, 0x3F, 0x2E, 0xE0, 0x6E, 0xF5, 0x39, 0x93, 0xE7, 0x50, 0x1D, 
+0x0D, 0x36, 0x6C, 0x80, 0x2B, 0xA9, 0xBA, 0xBE, 0x8F, 0x2A, 0xB5, 0x42, 0xD4, 0xBE, 0x47, 0x5B, 
+0x83, 0x0C, 0x5A, 0x29, 0x24, 0x37, 0x08, 0x4B, 0x5D, 0xA3, 0x84, 0x83, 0xB4, 0xD2, 0x8A, 0x90, 
+0xEA, 0x92, 0x78, 0x01, 0xED, 0x86, 0x2C, 0x36, 0x20, 0x07, 0x83, 0x71, 0x69, 0x1D, 0xC0, 0x9F, 
+0x95, 0xBB, 0x25, 0x1E, 0xBB, 0xF4, 0xAC, 0x25, 0xEB, 0xC4, 0x74, 0x15, 0xD3, 0xAB, 0x81, 0x7A, 
+0x87, 0xA6, 0xF1, 0x69, 0x03, 0xCA, 0x5C, 0x66, 0x8B, 0xFE, 0xB2, 0x72, 0xDC, 0xC0, 0xAC, 0x57, 
+0x56, 0x71, 0xBD, 0x94, 0xFD, 0x93, 0x46, 0x5B, 0x83, 0xF2, 0xC1, 0xD6, 0x72, 0x8B, 0x7F, 0x87, 
+0x89, 0x1D, 0x87, 0x0D, 0xBC, 0xCC, 0xCD, 0x7E, 0xDC, 0x2F, 0xD9, 0xF1, 0x85, 0x7F, 0xE3, 0xB6, 
+0x1E, 0x39, 0xCE, 0x91, 0xDD, 0x9F, 0xF2, 0xDC, 0x2B, 0x6D, 0x9C, 0x67, 0xB4, 0xB1, 0x52, 0x40, 
+0x42, 0x33, 0x53, 0x2A, 0x45, 0xCA, 0xB7, 0xED, 0x84, 0xF0, 0x32, 0x88, 0x8C, 0xA6, 0xB6, 0x41, 
+0x7D, 0x1F, 0xDB, 0x37, 0x80, 0xD1, 0xD6, 0x3E, 0x6D, 0x4D, 0x9D, 0x40, 0xCD, 0x04, 0x35, 0xF5, 
+0xB3, 0xAE, 0x84, 0x6C, 0x7D, 0x91, 0xB5, 0x6A, 0xB9, 0x16, 0x2C, 0x96, 0x55, 0xF7, 0x22, 0x67, 
+0x5A, 0xE0, 0x17, 0xD6, 0x9A, 0xCB, 0x73, 0x1F, 0xAF, 0xD0, 0x20, 0x40, 0x52, 0x72, 0x51, 0xA5, 
+0xF9, 0xFF, 0x22, 0xB1, 0xF4, 0xB3, 0xE1, 0x2A, 0xD6, 0xB5, 0x98, 0x83, 0x38, 0x28, 0x47, 0x43, 
+0x3A, 0x85, 0x32, 0xB8, 0x97, 0xB6, 0x3F, 0x04, 0x0E, 0x7F, 0xA4, 0x29, 0xDA, 0xE7, 0xCE, 0x53, 
+0x2B, 0x5C, 0xE8, 0x56, 0xEB, 0x3A, 0x79, 0xCC, 0xD3, 0xCA, 0xBC, 0xF6, 0x25, 0xAC, 0xBE, 0xC4, 
+0x77, 0x37, 0xF5, 0xA9, 0x9D, 0x78, 0xD7, 0xD9, 0x1C, 0x9A, 0x95, 0x57, 0xE4, 0x31, 0x54, 0x42, 
+0x53, 0x97, 0x8F, 0x7D, 0x9E, 0x27, 0xDD, 0x43, 0x5C, 0x95, 0x18, 0xA4, 0xFD, 0x55, 0x25, 0x5C, 
+0xC6, 0xBA, 0x68, 0x18, 0xEE, 0x8E, 0x82, 0x03, 0xBE, 0x16, 0x2D, 0xA4, 0xC8, 0x0D, 0xAF, 0x35, 
+0x70, 0x89, 0x70, 0x89, 0x09, 0x94, 0xBC, 0xEC, 0xF0, 0xC0, 0xAC, 0xA4, 0xD1, 0xD6, 0x80, 0x52, 
+0x95, 0x13, 0xCF, 0x9F, 0xB0, 0x59, 0x9D, 0x28, 0x09, 0x92, 0xAF, 0xD4, 0x21, 0x03, 0x8F, 0x42, 
+0x14, 0x44, 0x47, 0x71, 0xDD, 0xEE, 0xD9, 0xC2, 0xFD, 0xD6, 0xE2, 0x7C, 0x61, 0xCF, 0x6A, 0x4B, 
+0x82, 0xC2, 0xAA, 0x04, 0xED, 0xE6, 0x1B, 0x2F, 0x33, 0x34, 0xE8, 0x26, 0x25, 0xAF, 0x68, 0xF3, 
+0xB9, 0xEE, 0xA2, 0x67, 0xDB, 0x6F, 0x92, 0x30, 0x73, 0x17, 0x01, 0x18, 0x76, 0x36, 0x28, 0x40, 
+0x73, 0xA1, 0xA5, 0x33, 0xCE, 0x00, 0xA9, 0x9A, 0x97, 0x57, 0x69, 0xD4, 0xBB, 0x6B, 0xC5, 0xE0, 
+0x58, 0x82, 0xB0, 0x41, 0x53, 0x4B, 0xCB, 0x49, 0x21, 0xAB, 0xFF, 0x5E, 0x56, 0xCD, 0x05, 0x14, 
+0x52, 0xA1, 0xC3, 0x57, 0xBE, 0x66, 0xA1, 0x73, 0x3F, 0x30, 0x14, 0x3B, 0x6E, 0x14, 0x85, 0x7E, 
+0xB0, 0x04, 0xB7, 0xDF, 0xD4, 0x97, 0x01, 0x43, 0x94, 0xC1, 0x58, 0x03, 0x18, 0x41, 0xE4, 0xC4, 
+0x60, 0x2C, 0x4A, 0x41, 0x0C, 0x9C, 0x45, 0xC0, 0x7C, 0x2A, 0x40, 0x85, 0xEB, 0x21, 0x4F, 0x0B, 
+0x37, 0x03, 0xD9, 0x08, 0x97, 0x57, 0x85, 0xB3, 0xD5, 0xC8, 0xC0, 0xAE, 0xAF, 0x47, 0xF6, 0xC8, 
+0x7C, 0x45, 0xCA, 0xCB, 0x6F, 0xDF, 0x8D, 0x24, 0xD3, 0x46, 0xE1, 0xA4, 0x29, 0x97, 0xAA, 0x49, 
+0xCA, 0xEC, 0x3A, 0xBB, 0x00, 0x9F, 0xB4, 0x37, 0x47, 0x77, 0xFD, 0x47, 0xFB, 0xA0, 0x5F, 0x8E, 
+0xF4, 0x17, 0xAB, 0xB5, 0xA8, 0x6B, 0xB3, 0x78, 0x8C, 0x6D, 0x13, 0x0F, 0x35, 0x86, 0x8B, 0x1A, 
+0xE5, 0x6E, 0x53, 0xDD, 0xDA, 0x84, 0x66, 0x21, 0x2C, 0x15, 0xE1, 0x0F, 0x80, 0x9A, 0x1B, 0x8A, 
+0x92, 0x52, 0x38, 0x34, 0xD4, 0x71, 0x68, 0x36, 0x8D, 0x2B, 0xE6, 0xF0, 0xA5, 0xA1, 0x14, 0x8D, 
+0x24, 0xF4, 0x19, 0x4B, 0x2B, 0x3D, 0xFB, 0xF7, 0x7D, 0xFD, 0xDA, 0x52, 0x84, 0x0F, 0x46, 0x02, 
+0xBF, 0x9B, 0xB8, 0x9C, 0xA0, 0xA6, 0xBA, 0xF1, 0x5D, 0x8F, 0x09, 0xE2, 0xF2, 0x3B, 0x9E, 0xEE, 
+0x1D, 0x8E, 0x86, 0xA6, 0x38, 0x49, 0x49, 0xB3, 0xC5, 0x33, 0x2E, 0xF2, 0x77, 0x6F, 0xB7, 0x84, 
+0xCC, 0x53, 0x91, 0xB1, 0x61, 0x88, 0x05, 0x2C, 0xDE, 0x3A, 0x16, 0x7F, 0x11, 0x8B, 0x7F, 0xDC, 
+0x92, 0xFE, 0x48, 0x84, 0xE4, 0xF8, 0x63, 0x89, 0x8C, 0x2D, 0xD0, 0x46, 0xF5, 0x75, 0x92, 0xF8, 
+0x36, 0x18, 0x88, 0xCB, 0x0D, 0x44, 0xB2, 0x01, 0x09, 0x88, 0x4D, 0x6E, 0x15, 0x7D, 0xFA, 0xB1, 
+0xF8, 0xFE, 0x33, 0x31, 0xA9, 0x33, 0x0D, 0x8C, 0x83, 0xD3, 0xA0, 0xC7, 0x8D, 0xD3, 0x28, 0x43, 
+0x67, 0x03, 0x1D, 0x10, 0x40, 0xA9, 0xEC, 0xD4, 0x87, 0xCC, 0x21, 0x12, 0x7C, 0xA1, 0xE7, 0xCC, 
+0xD2, 0x08, 0x3A, 0x6E, 0xE2, 0x85, 0xF5, 0xDD, 0xB0, 0xC2, 0xD9, 0x46, 0xB4, 0xC9, 0x1D, 0x39, 
+0x7B, 0xC6, 0x9A, 0xEF, 0x53, 0x6F, 0xDB, 0xFB, 0xDF, 0xA0, 0x27, 0xD5, 0xC9, 0xAE, 0x54, 0x7E, 
+0xB3, 0xAD, 0xC7, 0x6E, 0x56, 0xD2, 0x3F, 0xB4, 0x33, 0x05, 0x89, 0x37, 0x52, 0x29, 0x74, 0x71, 
+0xE6, 0x6F, 0xAF, 0x66, 0x46, 0xC1, 0x3C, 0x33, 0xA2, 0xB2, 0x09, 0x98, 0x80, 0x66, 0x93, 0x3B, 
+0x6E, 0x48, 0x25, 0xC8, 0x25, 0xEC, 0xE8, 0x25, 0xDC, 0x2D, 0x36, 0x24, 0xB8, 0xB1, 0x3D, 0xE6, 
+0x39, 0x88, 0xE3, 0xAD, 0xBC, 0xF5, 0xAD, 0xB6, 0x12, 0x42, 0x28, 0xED, 0xB7, 0x30, 0x11, 0x44, 
+0x7E, 0xB6, 0x7F, 0xA9, 0xAD, 0xE4, 0xAE, 0xB7, 0x95, 0xD6, 0xA8, 0xFE, 0x76, 0x1B, 0x09, 0x22, 
+0x14, 0xF5, 0x4B, 0x21, 0x4F, 0x21, 0x40, 0xF0, 0xA5, 0x36, 0x92, 0xBB, 0xDE, 0x46, 0x5A, 0xA3, 
+0xFC, 0x5B, 0x6D, 0x23, 0x98, 0xA1, 0x1C, 0xF1, 0x3D, 0x4E, 0x9E, 0xEC, 0xBC, 0xD4, 0x36, 0x72, 
+0xD7, 0xDB, 0x46, 0x94, 0x6A, 0x56, 0xE4, 0x7E, 0xAF, 0xA4, 0x66, 0x0B, 0xB6, 0x25, 0xA0, 0x21, 
+0x4A, 0x0C, 0xE4, 0xE5, 0x1E, 0xC3, 0x40, 0x30, 0x29, 0xA0, 0x18, 0xA1, 0x6D, 0x57, 0x4D, 0xA5, 
+0xF6, 0x8E, 0xB3, 0x5A, 0xBD, 0x4E, 0x61, 0xFF, 0xC5, 0xDC, 0xD8, 0x66, 0x03, 0x1C, 0x69, 0x75, 
+0xEF, 0xEB, 0x8F, 0x20, 0x16, 0xE6, 0x20, 0x62, 0x7D, 0x35, 0xFF, 0xC5, 0x41, 0x0B, 0x91, 0x41, 
+0x4F, 0xC7, 0xE0, 0xAC, 0x64, 0x0A, 0xE6, 0x25, 0xD3, 0xC2, 0xD4, 0x83, 0x37, 0xA4, 0x95, 0x93, 
+0x0B, 0x32, 0x26, 0xD6, 0x34, 0x4E, 0x80, 0x6E, 0xAD, 0xA6, 0x27, 0x2B, 0xDD, 0xD8, 0x02, 0xEF, 
+0x57, 0x05, 0xDB, 0x0D, 0x45, 0x79, 0x3A, 0x2E, 0x90, 0x71, 0x6A, 0x2C, 0x70, 0x00, 0x62, 0x10, 
+0x4F, 0x0D, 0x84, 0xDB, 0x36, 0x58, 0xB9, 0xC9, 0x52, 0x90, 0x60, 0x8F, 0xFC, 0xDC, 0x91, 0x41, 
+0xF2, 0x5A, 0x88, 0x81, 0xFC, 0x84, 0x45, 0x51, 0xDD, 0x36, 0xC5, 0x33, 0xEE, 0x76, 0x98, 0x07, 
+0xCA, 0x61, 0x14, 0x03, 0x19, 0xE6, 0xC1, 0x0B, 0x1C, 0x07, 0x32, 0x98, 0x55, 0x43, 0x13, 0xD7, 
+0x6D, 0x31, 0x12, 0xE6, 0x79, 0xD8, 0x7B, 0xB5, 0x7C, 0x0F, 0x14, 0x98, 0x99, 0x17, 0xB8, 0x4E, 
+0x36, 0x56, 0xB2, 0x53, 0x9D, 0xD1, 0xD7, 0xB3, 0x82, 0x3D, 0xB9, 0x73, 0x7B, 0x62, 0x65, 0xAB, 
+0x90, 0x3B, 0xE7, 0x6E, 0x1E, 0xE6, 0xC3, 0x26, 0x51, 0xE2, 0x4F, 0xB9, 0xF3, 0x21, 0x03, 0x3E, 
+0x40, 0xB3, 0x48, 0x17, 0xBC, 0x14, 0xE9, 0x54, 0x1A, 0x93, 0x04, 0x20, 0x02, 0x9B, 0xC7, 0x60, 
+0xA8, 0x6F, 0x6F, 0xC7, 0x0D, 0x63, 0x4C, 0x9A, 0xD0, 0xF6, 0x6E, 0x85, 0xCE, 0x4F, 0x93, 0xFE, 
+0xDA, 0xF5, 0x3B, 0x9A, 0xCE, 0xC0, 0xB4, 0xB3, 0xCE, 0x31, 0x2E, 0xCF, 0xB0, 0xC1, 0x44, 0xC7, 
+0x58, 0xDF, 0x76, 0x50, 0x68, 0x1E, 0xB6, 0x2A, 0xBF, 0xB1, 0x03, 0xA6, 0xDB, 0xF6, 0x52, 0x9D, 
+0xA6, 0xDE, 0x29, 0x46, 0xD4, 0x67, 0x3A, 0xD3, 0xBA, 0x14, 0xEF, 0x05, 0xF3, 0xCE, 0xC2, 0xA9, 
+0xA8, 0x6E, 0x52, 0x29, 0xB3, 0xC4, 0xCD, 0xA0, 0x88, 0x85, 0xDD, 0xE0, 0xD1, 0xBB, 0xF9, 0x1A, 
+0x08, 0xB0, 0x69, 0xAA, 0xE6, 0x7B, 0xD3, 0x21, 0xF3, 0x6D, 0xB8, 0x65, 0x71, 0x08, 0xF3, 0x19, 
+0xAA, 0x34, 0x84, 0x5B, 0x1A, 0x61, 0x30, 0x3A, 0x0D, 0x97, 0x26, 0x67, 0x6B, 0xF2, 0x60, 0xB5, 
+0xDD, 0xFF, 0x7F, 0x6E, 0x78, 0x99, 0x2A, 0x31, 0x33, 0xAB, 0x53, 0xA9, 0xFA, 0xC7, 0x32, 0xF5, 
+0x7F, 0xC1, 0xBE, 0x58, 0x81, 0xAB, 0xC0, 0x99, 0x06, 0xC1, 0xC5, 0x67, 0x63, 0x0E, 0x67, 0xA9, 
+0x8B, 0x32, 0x27, 0x95, 0x1B, 0xD1, 0x53, 0x5A, 0xB7, 0x8A, 0x6B, 0x9D, 0x52, 0xE1, 0x51, 0x95, 
+0x50, 0x09, 0x41, 0xB7, 0xB9, 0xF4, 0x9F, 0x29, 0x38, 0x5C, 0xC6, 0x15, 0xEA, 0x71, 0x49, 0xCD, 
+0x83, 0x50, 0x05, 0x18, 0x6A, 0xD9, 0x64, 0xF0, 0x74, 0xC2, 0xF1, 0x68, 0x9F, 0x4F, 0xDA, 0x66, 
+0x9E, 0x82, 0xBF, 0x67, 0xC7, 0x6A, 0xF0, 0x8F, 0x75, 0xD9, 0xCD, 0xB8, 0x25, 0x25, 0xE7, 0x4D, 
+0xB4, 0x5F, 0xAC, 0x64, 0x32, 0x96, 0xED, 0x78, 0xF0, 0xB2, 0xD4, 0x6A, 0xDA, 0x90, 0x49, 0x6A, 
+0xB0, 0xF2, 0xC9, 0xB9, 0x34, 0x0C, 0x23, 0xFF, 0x2F, 0xBA, 0xE1, 0x2D, 0x25, 0x2C, 0x92, 0xC4, 
+0x16, 0x2A, 0x97, 0xFE, 0x99, 0x6B, 0x89, 0xC9, 0x7A, 0xCA, 0x18, 0x3D, 0x49, 0x19, 0x7B, 0xB1, 
+0xB2, 0xB0, 0x16, 0x4C, 0xE5, 0xB9, 0x85, 0xAA, 0x8A, 0xBA, 0x62, 0xA5, 0x61, 0xB4, 0x29, 0xF9, 
+0x8C, 0xC4, 0x7D, 0x10, 0xDA, 0x04, 0xFA, 0x66, 0xE3, 0xD6, 0x6E, 0x79, 0x9D, 0xFB, 0x7A, 0x63, 
+0x6A, 0xAD, 0xEF, 0xC4, 0x0E, 0x60, 0x4C, 0x3B, 0x6A, 0x1B, 0xC0, 0xCA, 0xFD, 0x2C, 0x6A, 0x81, 
+0xF3, 0xAC, 0xB7, 0xD3, 0x1E, 0xEC, 0x18, 0xB7, 0xEA, 0xC4, 0x2C, 0xC8, 0xD9, 0xB8, 0xE5, 0xC1, 
+0x8E, 0x0D, 0x31, 0x43, 0xE4, 0xC7, 0x8A, 0xF4, 0xFD, 0x09, 0x6F, 0xE3, 0xA4, 0xBE, 0x9A, 0x51, 
+0x8D, 0xA9, 0xD6, 0xB8, 0xD0, 0x71, 0xD9, 0x42, 0xD2, 0xAF, 0xE8, 0x58, 0xD7, 0xCC, 0xD0, 0xDD, 
+0x60, 0x99, 0xF4, 0x0D, 0x50, 0xE5, 0x51, 0xBB, 0xD7, 0xCC, 0x81, 0xF7, 0xC2, 0x97, 0x66, 0xBD, 
+0xD6, 0xD8, 0x8F, 0x1D, 0xC6, 0x3E, 0x3F, 0xA8, 0xC4, 0x87, 0x34, 0xF8, 0x48, 0xB2, 0x30, 0x56, 
+0xC9, 0x51, 0x70, 0x89, 0x6A, 0x66, 0xDE, 0xA7, 0x2C, 0x50, 0xF2, 0x63, 0x74, 0x30, 0x52, 0x38, 
+0x20, 0xA4, 0xCC, 0x3A, 0x08, 0x5C, 0x24, 0xC3, 0xC8, 0xD3, 0xD3, 0xCC, 0x90, 0x75, 0x2D, 0x78, 
+0x6E, 0x48, 0xD3, 0xBF, 0xE3, 0x30, 0xAB, 0x3D, 0x65, 0x30, 0x9E, 0xA2, 0x6E, 0xCA, 0x27, 0x28, 
+0x26, 0x7E, 0x61, 0x51, 0xE0, 0xBA, 0x85, 0x06, 0x20, 0x06, 0xB7, 0x24, 0x93, 0x7B, 0xD3, 0x30, 
+0x34, 0x87, 0xFF, 0x6C, 0x9F, 0xF9, 0x23, 0xC1, 0x99, 0x18, 0x7B, 0x2A, 0x8A, 0x29, 0x28, 0xDF, 
+0xC0, 0x07, 0x34, 0xFC, 0x71, 0x94, 0x90, 0xCD, 0x29, 0xEA, 0x02, 0x33, 0x7D, 0x6E, 0x0C, 0x1F, 
+0xDA, 0xE1, 0x51, 0x67, 0x67, 0xC8, 0xC3, 0xCF, 0xE1, 0xD2, 0x93, 0x96, 0x17, 0xFE, 0x94, 0x1E, 
+0xA6, 0xFD, 0x19, 0x36, 0x08, 0x48, 0x17, 0x02, 0x2E, 0x51, 0xF5, 0xDA, 0xDA, 0x9A, 0x37, 0x93, 
+0xA5, 0xA5, 0xAC, 0x29, 0x34, 0xA5, 0x15, 0x35, 0xCE, 0x70, 0xF4, 0x04, 0x14, 0xF0, 0x03, 0x16, 
+0x56, 0x4F, 0xC1, 0x86, 0xAD, 0xE3, 0xA5, 0xB2, 0x75, 0x65, 0xBB, 0x56, 0xD9, 0x76, 0x15, 0xA8, 
+0xB0, 0x58, 0x03, 0x36, 0xF1, 0x1D, 0xA1, 0xE2, 0xE1, 0xD6, 0xB0, 0xDA, 0xEB, 0x13, 0x93, 0xDE, 
+0x7E, 0x63, 0x9F, 0x9D, 0x95, 0xD0, 0xB1, 0x64, 0xBC, 0x16, 0x60, 0x57, 0x41, 0xCC, 0xA2, 0x89, 
+0xF7, 0x62, 0x34, 0xE9, 0xE6, 0x67, 0xE1, 0x84, 0xBD, 0xA1, 0xFD, 0xB3, 0x08, 0x32, 0x0E, 0xE2, 
+0xB0, 0x1B, 0x4C, 0xE2, 0x83, 0xAC, 0x07, 0xB5, 0x06, 0xDC, 0xF7, 0x48, 0xD5, 0x22, 0x6F, 0xDB, 
+0x2A, 0x0E, 0x31, 0x1A, 0x7D, 0x3C, 0x4B, 0xEA, 0xAC, 0x4B, 0x7B, 0x92, 0x68, 0x11, 0x26, 0x01, 
+0x86, 0x53, 0x9C, 0x73, 0xAC, 0x23, 0x41, 0xAA, 0x0C, 0x2E, 0xB8, 0x9C, 0x26, 0x62, 0x3C, 0x1A, 
+0xA3, 0x78, 0x38, 0x61, 0xBD, 0xE8, 0x3E, 0x5C, 0x3D, 0x44, 0x35, 0x7E, 0xD9, 0xF0, 0x24, 0xC8, 
+0x4A, 0x3C, 0x11, 0x0B, 0xA4, 0x48, 0x9C, 0x02, 0xD1, 0xBD, 0x64, 0xF4, 0x33, 0x26, 0xD3, 0xBB, 
+0xC2, 0xE9, 0x37, 0x11, 0x8A, 0x74, 0xEA, 0x6D, 0x58, 0xC3, 0x46, 0xFD, 0x78, 0x3A, 0x36, 0x21, 
+0xEE, 0x00, 0x76, 0xE3, 0x99, 0x49, 0xAA, 0xA5, 0xFA, 0xB1, 0x71, 0x9B, 0xA1, 0x6F, 0x87, 0x09, 
+0xC7, 0x2D, 0xBF, 0x39, 0xC4, 0x32, 0xCE, 0xA5, 0x78, 0x5B, 0x8C, 0x26, 0xDE, 0x78, 0x12, 0xAF, 
+0xFB, 0xD1, 0xC2, 0xEC, 0xDA, 0x60, 0xF2, 0x69, 0xB5, 0xD9, 0x19, 0xE6, 0x57, 0xDA, 0xB8, 0x5B, 
+0x64, 0x2A, 0x16, 0x79, 0x2A, 0x40, 0x0A, 0x8B, 0x57, 0xD2, 0xAA, 0x6F, 0xE6, 0x4E, 0xC2, 0x18, 
+0xAE, 0x34, 0x70, 0x31, 0x6F, 0xC2, 0x08, 0xCC, 0x7B, 0x5B, 0x8F, 0x21, 0xB2, 0x01, 0x56, 0x85, 
+0x99, 0x99, 0xBF, 0x58, 0x3F, 0x23, 0x15, 0x6E, 0x8C, 0xDA, 0xDA, 0x49, 0x0D, 0xDA, 0x09, 0xFC, 
+0xAA, 0x3C, 0x5E, 0x1C, 0xDE, 0x08, 0x74, 0xE9, 0x10, 0x3B, 0xBC, 0x37, 0x41, 0x7C, 0x76, 0x80, 
+0xE8, 0xAF, 0x39, 0xC1, 0xBC, 0x32, 0x7A, 0xA2, 0xCC, 0x45, 0xCE, 0xC9, 0x1A, 0x8E, 0x66, 0x2C, 
+0xCF, 0x6B, 0x29, 0x25, 0xF9, 0x5F, 0x77, 0x3A, 0x7A, 0xDB, 0x49, 0x1E, 0x5F, 0x4B, 0xD6, 0x73, 
+0xD6, 0xE4, 0x12, 0x9E, 0x37, 0x96, 0xAC, 0x5B, 0xD5, 0xE4, 0xE6, 0x0F, 0x9A, 0x97, 0x18, 0xD2, 
+0x95, 0x61, 0xCF, 0x45, 0xBE, 0x4A, 0xF7, 0x33, 0xE4, 0x2B, 0x05, 0x4F, 0x51, 0x25, 0x60, 0xA0, 
+0xFC, 0x25, 0x5E, 0x79, 0x48, 0xD1, 0x48, 0x70, 0xCE, 0x4A, 0x83, 0x5C, 0xB8, 0x33, 0xF8, 0x46, 
+0x5C, 0xB2, 0x9D, 0xFC, 0xB4, 0xA8, 0xB2, 0x5F, 0xE2, 0x99, 0xE6, 0x49, 0x03, 0x8E, 0x21, 0xBE, 
+0xB7, 0x54, 0xC4, 0x5E, 0x69, 0xEA, 0xAF, 0x79, 0x4E, 0xAD, 0x67, 0xE7, 0x34, 0x3E, 0x81, 0xD4, 
+0x29, 0xDB, 0xB4, 0x7D, 0xBC, 0xF1, 0xD9, 0x19, 0x4B, 0x21, 0x9A, 0xCD, 0x2B, 0x98, 0xD1, 0x81, 
+0x87, 0xAB, 0xF3, 0x87, 0xEB, 0x73, 0x5E, 0x43, 0x49, 0xB3, 0x78, 0x36, 0x59, 0x1B, 0x29, 0xE9, 
+0x90, 0xA5, 0x10, 0xC3, 0xE9, 0xF6, 0x15, 0xAA, 0xAC, 0x14, 0x6C, 0x2A, 0x16, 0x1B, 0x58, 0x43, 
+0x40, 0xDE, 0x7D, 0xD3, 0x45, 0xCD, 0x6E, 0x56, 0x89, 0xD2, 0x9A, 0x81, 0x97, 0xA1, 0x0C, 0x26, 
+0x0B, 0x74, 0xAA, 0x5B, 0x95, 0x43, 0xD7, 0x97, 0xE2, 0xD4, 0xF1, 0x85, 0xE0, 0xA9, 0x09, 0xE1, 
+0xFC, 0xFC, 0xC7, 0x63, 0xAE, 0x14, 0x9D, 0xDD, 0x69, 0x4E, 0xD0, 0x72, 0x0E, 0xC5, 0x93, 0x29, 
+0xC2, 0xF9, 0x22, 0xB5, 0x41, 0xDE, 0x0D, 0x87, 0x55, 0xE6, 0x15, 0x96, 0x1A, 0x41, 0xC4, 0x93, 
+0x43, 0xCD, 0xD8, 0x5E, 0xEF, 0xCB, 0xCB, 0xF9, 0x6C, 0x55, 0x96, 0x65, 0x62, 0xD4, 0xB1, 0x83, 
+0xB6, 0x53, 0x8E, 0xB4, 0x68, 0x50, 0xF6, 0x32, 0xFA, 0xC3, 0x1F, 0xA6, 0xDC, 0x68, 0x32, 0xD5, 
+0x68, 0x28, 0xF6, 0xB8, 0x6A, 0x78, 0x57, 0x41, 0x3B, 0xA5, 0x47, 0x15, 0xA9, 0xE0, 0xFE, 0xCE, 
+0x11, 0x1D, 0xFE, 0x2E, 0xAA, 0xB2, 0x6B, 0x3B, 0xBD, 0xA9, 0x34, 0xFD, 0xEA, 0xBB, 0xB1, 0xF2, 
+0xAE, 0x82, 0x77, 0x90, 0x80, 0xB6, 0xB4, 0xA3, 0xFA, 0xDB, 0x0D, 0xB2, 0xB2, 0x19, 0x71, 0x0F, 
+0xD9, 0x10, 0x7D, 0xD6, 0x32, 0x12, 0x1F, 0x18, 0x4F, 0x09, 0xA9, 0xDB, 0x1D, 0x9D, 0x78, 0x84, 
+0x45, 0x48, 0xE7, 0x37, 0xFE, 0xE9, 0x03, 0x09, 0x5C, 0x30, 0x0C, 0x9D, 0xF5, 0x23, 0xFA, 0xC3, 
+0xF6, 0x89, 0x68, 0xC3, 0xDA, 0xBC, 0x6A, 0xE8, 0xEB, 0x75, 0x7F, 0xBC, 0xC0, 0x1C, 0x03, 0xE3, 
+0x5D, 0x18, 0xA4, 0x76, 0x68, 0x4B, 0x67, 0xF7, 0x90, 0xA6, 0xA0, 0x16, 0xE7, 0x52, 0x96, 0x86, 
+0x9E, 0xB6, 0xCC, 0x33, 0x6D, 0x1A, 0xB5, 0x59, 0x1A, 0x75, 0x32, 0x97, 0x27, 0x9A, 0xCC, 0xF9, 
+0xAC, 0x8C, 0xA9, 0x19, 0x49, 0x32, 0xD7, 0xA7, 0x83, 0x58, 0xC3, 0x6E, 0x1C, 0x10, 0xE2, 0x3C, 
+0xCD, 0xC6, 0xA6, 0x96, 0xDC, 0x9D, 0xC7, 0xDC, 0x5D, 0xA7, 0x11, 0xEF, 0x3E, 0x8A, 0x67, 0xD2, 
+0xFD, 0xAA, 0x40, 0x5E, 0x79, 0xF1, 0xD8, 0x5B, 0x57, 0xF7, 0x65, 0x5D, 0xF4, 0x10, 0xBC, 0x95, 
+0xF1, 0x33, 0x15, 0xC7, 0xD2, 0xE4, 0x58, 0xDF, 0x7D, 0x7B, 0x3A, 0xFB, 0xC5, 0x9F, 0x0B, 0xD7, 
+0xA6, 0xD7, 0x54, 0xA2, 0xC4, 0x99, 0x33, 0x7E, 0x2F, 0xD0, 0x8C, 0x81, 0xF5, 0x77, 0xBE, 0x3C, 
+0xF5, 0x65, 0x7E, 0x6B, 0x7A, 0xEB, 0xFF, 0xD8, 0x8C, 0x59, 0x23, 0x59, 0xAE, 0xDA, 0xAC, 0xAC, 
+0xBA, 0xD4, 0x20, 0x23, 0x0F, 0x6D, 0x53, 0x52, 0xF2, 0xC4, 0xD3, 0x79, 0xD2, 0x79, 0x2C, 0x16, 
+0x32, 0x05, 0x47, 0x38, 0x93, 0xAA, 0x76, 0x5F, 0x85, 0xE0, 0x2F, 0x1C, 0x36, 0x32, 0x84, 0x68, 
+0xEE, 0xAC, 0xB8, 0xC0, 0xA7, 0x7F, 0xE2, 0x63, 0x3A, 0x86, 0xB2, 0xCC, 0xA8, 0xDD, 0x9E, 0xAB, 
+0x9B, 0x94, 0xD9, 0x70, 0x13, 0x1F, 0xB7, 0x90, 0x04, 0x1A, 0x95, 0x21, 0xFD, 0x81, 0xEF, 0x5E, 
+0x54, 0xCC, 0xF1, 0x0F, 0xD0, 0x99, 0x57, 0x5F, 0x19, 0xFD, 0x67, 0x26, 0x06, 0xCB, 0x9C, 0x17, 
+0xF9, 0x14, 0xE3, 0x6A, 0x32, 0xA2, 0x42, 0x7E, 0xAD, 0x89, 0xC0, 0xA2, 0x43, 0xC1, 0xFF, 0xE8, 
+0x85, 0x0E, 0x8E, 0xA1, 0xD6, 0xE0, 0xCF, 0x3B, 0x53, 0x62, 0x0A, 0x1E, 0xB2, 0x2E, 0xDA, 0x18, 
+0xCB, 0x74, 0x26, 0x24, 0x76, 0xAB, 0xBC, 0xAF, 0x87, 0xB8, 0x05, 0x4B, 0x9C, 0xFE, 0xEA, 0xCF, 
+0xE2, 0x66, 0xD9, 0xEC, 0xCC, 0xCB, 0xBC, 0xB7, 0xA5, 0x89, 0x9F, 0x1D, 0x2B, 0x92, 0x5A, 0xF0, 
+0x31, 0xAD, 0x8B, 0x4D, 0x69, 0xC9, 0xBC, 0x5E, 0xD3, 0xFD, 0xC1, 0x94, 0x60, 0xCC, 0x9F, 0x7C, 
+0x21, 0x47, 0x64, 0x9F, 0xBF, 0x38, 0x4A, 0xA4, 0xE4, 0x85, 0x4A, 0x1F, 0x62, 0xF5, 0x78, 0x9D, 
+0xD7, 0xAA, 0x83, 0x58, 0xD4, 0x9E, 0x55, 0xF6, 0x67, 0x7F, 0xA2, 0x40, 0x2B, 0x04, 0xF6, 0xD0, 
+0x4E, 0xF3, 0xF6, 0xAC, 0x1D, 0xD0, 0x9F, 0xA4, 0x3F, 0x84, 0x3B, 0x61, 0xCF, 0x1F, 0x13, 0x0C, 
+0x0A, 0x76, 0x28, 0x51, 0x34, 0xC9, 0xC3, 0x72, 0xEB, 0x75, 0x98, 0xE8, 0x53, 0xB2, 0xF0, 0xB5, 
+0x49, 0x7E, 0x9A, 0xB0, 0xAA, 0x7B, 0xF7, 0xD4, 0x24, 0xC4, 0xB1, 0x8C, 0x17, 0xCF, 0x3A, 0xAD, 
+0x74, 0x64, 0x35, 0xA3, 0x81, 0xBA, 0xEE, 0xAC, 0x46, 0x02, 0xBA, 0x1D, 0x97, 0x95, 0x62, 0x43, 
+0x98, 0x2A, 0x7A, 0x36, 0x54, 0xD4, 0x6B, 0x2E, 0xBB, 0x36, 0x74, 0xE3, 0xE4, 0x9F, 0xE8, 0x97, 
+0xF9, 0xBE, 0x3A, 0x95, 0xC0, 0xB3, 0x89, 0xFA, 0xA8, 0xEB, 0xFE, 0x07, 0xFB, 0xFF, 0x8B, 0x6C, 
+0x12, 0x51, 0x00, 0x00, 0x00
+};
+
+const char style_css_br[] PROGMEM = {
+0x1B, 0x11, 0x51, 0x20, 0x9C, 0x05, 0x4E, 0xD9, 0x14, 0xFF, 0x34, 0x16, 0x8F, 0x41, 0xCA, 0xEC, 
+0x11, 0xAE, 0x5B, 0x39, 0xE7, 0x74, 0xD7, 0x08, 0x49, 0x66, 0xCD, 0x1A, 0x4B, 0xE5, 0x09, 0xB2, 
+0x03, 0xC9, 0xC1, 0xB7, 0xAA, 0x55, 0x55, 0x40, 0xE3, 0x99, 0xCD, 0x69, 0xFE, 0x57, 0xB5, 0x21, 
+0x1A, 0xCC, 0x32, 0x96, 0x34, 0xB2, 0xCC, 0xEB, 0x2A, 0x79, 0x03, 0xFC, 0x2E, 0x85, 0xBB, 0xB5, 
+0x9C, 0xEA, 0x38, 0x59, 0xE2, 0x01, 0x37, 0x65, 0x9B, 0xBE, 0x1D, 0xAE, 0x21, 0xAD, 0xFA, 0xFD, 
+0xD4, 0xB2, 0x6A, 0xB9, 0x73, 0x12, 0x36, 0x1F, 0xC7, 0x4D, 0x60, 0xE7, 0xCA, 0xB9, 0xB5, 0x4B, 
+0x24, 0xCD, 0xEC, 0xB1, 0x49, 0x7A, 0x82, 0x8D, 0xF3, 0xE6, 0xCA, 0x56, 0x9A, 0xB9, 0xF6, 0x4C, 
+0x1C, 0x99, 0x43, 0xF3, 0xD5, 0x2B, 0x36, 0xA0, 0x00, 0x33, 0x3B, 0x73, 0x4A, 0x14, 0xEB, 0xA7, 
+0xA7, 0x77, 0xF4, 0x7B, 0xBB, 0xF7, 0x2F, 0x60, 0x8A, 0x4C, 0xD3, 0xDD, 0x33, 0x8B, 0xF7, 0xD2, 
+0x09, 0x90, 0x5E, 0xE6, 0x94, 0xA8, 0x72, 0x97, 0xC3, 0xC8, 0x69, 0x24, 0x39, 0x8B, 0x0C, 0xB5, 
+0x53, 0x74, 0x95, 0x58, 0x6C, 0xD3, 0xAF, 0xE2, 0x54, 0x19, 0x9D, 0xA8, 0x6B, 0xD0, 0x01, 0xF3, 
+0x59, 0xF5, 0x73, 0x85, 0x6C, 0x5D, 0x0C, 0x09, 0x06, 0x3F, 0x24, 0x2C, 0x0D, 0xD1, 0xE6, 0x18, 
+0xB4, 0x77, 0x1D, 0x4F, 0xA4, 0xB9, 0x44, 0xBE, 0xF1, 0x0D, 0xC0, 0x49, 0xCA, 0xF0, 0xDF, 0x0B, 
+0x19, 0xD0, 0xFC, 0x1F, 0xBE, 0xEB, 0x50, 0x25, 0x1A, 0x29, 0x25, 0x8D, 0x89, 0x06, 0x78, 0x9D, 
+0x52, 0x23, 0x4C, 0xA1, 0x31, 0xD1, 0xD4, 0x34, 0x01, 0x04, 0x3E, 0x13, 0x96, 0xE9, 0x90, 0x51, 
+0xFB, 0x49, 0xC3, 0x0E, 0x6E, 0x9E, 0xD0, 0xCD, 0x1E, 0x03, 0x18, 0x3B, 0xCC, 0xF9, 0x09, 0x91, 
+0xAE, 0xBB, 0x60, 0x53, 0xC3, 0x5D, 0x4F, 0x20, 0xCC, 0x31, 0x34, 0xEC, 0xB9, 0x6B, 0x9E, 0x80, 
+0x76, 0xDC, 0x83, 0x98, 0x4F, 0xA2, 0x1E, 0x9E, 0x9E, 0xE0, 0x78, 0x97, 0xCD, 0x98, 0x0E, 0x9B, 
+0xEB, 0xAD, 0xF7, 0x05, 0xC0, 0x7C, 0x88, 0x30, 0xDC, 0x4D, 0x63, 0xF0, 0x7A, 0xFD, 0x10, 0xF1, 
+0x9B, 0x48, 0x01, 0x4F, 0x20, 0x64, 0x40, 0x60, 0x60, 0x43, 0x42, 0x9F, 0x29, 0x63, 0x52, 0xB9, 
+0xDB, 0x13, 0xC0, 0xE1, 0x7D, 0xA8, 0xF4, 0x33, 0xA7, 0x3E, 0x77, 0xC8, 0x16, 0x59, 0xF7, 0xF7, 
+0x94, 0xD4, 0x1A, 0xF9, 0xAE, 0xB4, 0xC7, 0x51, 0xE7, 0x7B, 0x0C, 0x47, 0xEB, 0x65, 0x8C, 0x31, 
+0xA8, 0x27, 0x99, 0x2D, 0xF8, 0x25, 0x6C, 0xFE, 0x11, 0xCA, 0x25, 0xF5, 0x99, 0x0E, 0xB5, 0x91, 
+0x72, 0xDB, 0xD7, 0x6E, 0x99, 0x5A, 0x0B, 0xE9, 0x57, 0xBC, 0x77, 0xB9, 0x45, 0xA9, 0xF7, 0xCA, 
+0xDB, 0x99, 0x13, 0x7F, 0xAC, 0x1B, 0xED, 0x41, 0x57, 0x4F, 0xBF, 0xAE, 0x17, 0x84, 0xB0, 0x46, 
+0xE0, 0xD5, 0x7C, 0xF9, 0xA1, 0xD9, 0xD7, 0xFC, 0x2E, 0x6D, 0x6A, 0x58, 0xDF, 0xCC, 0x82, 0x15, 
+0x27, 0xD6, 0xAA, 0xBF, 0x2A, 0x68, 0xFE, 0xB4, 0xDD, 0xD8, 0x44, 0x2B, 0x86, 0xD0, 0x32, 0x9C, 
+0x3D, 0x11, 0xA6, 0x77, 0xB9, 0x3B, 0xAA, 0xE5, 0x39, 0xC2, 0x7C, 0x8C, 0xB1, 0x40, 0x12, 0x18, 
+0x60, 0x0B, 0x5B, 0xF8, 0xA7, 0xD3, 0xF3, 0xDD, 0x38, 0x21, 0xF9, 0xC2, 0x0E, 0xAB, 0xCB, 0x07, 
+0xAE, 0x51, 0x67, 0xCA, 0x9D, 0xF4, 0x1E, 0xD2, 0x7D, 0x98, 0x52, 0x89, 0x58, 0x0C, 0x04, 0x5D, 
+0xB8, 0x0E, 0x42, 0xE6, 0x7A, 0xB9, 0x88, 0xB1, 0x64, 0x3C, 0xD5, 0x0C, 0x20, 0x71, 0xA8, 0xF1, 
+0x4F, 0x1A, 0x43, 0x64, 0x7E, 0xA6, 0xE3, 0x05, 0x47, 0xC5, 0x90, 0x92, 0x86, 0xAF, 0x63, 0x8C, 
+0x35, 0xF8, 0xB4, 0x90, 0xDB, 0x41, 0x2C, 0x59, 0x96, 0xDE, 0x6F, 0x74, 0x89, 0x98, 0xAF, 0x81, 
+0x75, 0x39, 0x09, 0xE4, 0x33, 0xD2, 0x18, 0x09, 0xD6, 0xD1, 0x70, 0x8F, 0x46, 0xB7, 0x6D, 0x05, 
+0x54, 0x01, 0x9B, 0x88, 0x7A, 0x6D, 0x8F, 0xAB, 0xC3, 0xFC, 0xF3, 0xD4, 0x4C, 0xD0, 0x76, 0x1B, 
+0x41, 0xA3, 0x63, 0xE0, 0xB2, 0xB0, 0x39, 0x1B, 0xD7, 0x69, 0x4C, 0xA9, 0xE0, 0x36, 0xE5, 0x58, 
+0xC2, 0x74, 0x20, 0x4B, 0xF5, 0xDF, 0xBA, 0xDA, 0x76, 0x06, 0xF9, 0x7E, 0x75, 0x73, 0x6F, 0x73, 
+0x07, 0xF1, 0x5B, 0xA6, 0xA9, 0x81, 0xB0, 0x22, 0xEA, 0x47, 0x33, 0x54, 0x22, 0x92, 0x54, 0x68, 
+0x5A, 0xC0, 0x02, 0x2C, 0xB6, 0xA0, 0xD0, 0xAE, 0xA9, 0x2C, 0x4F, 0x7B, 0x00, 0x0B, 0x10, 0x35, 
+0xF9, 0x52, 0x2E, 0xED, 0x9A, 0x20, 0xA5, 0xC9, 0x06, 0x75, 0xE5, 0x82, 0xB3, 0x5A, 0x5F, 0xFE, 
+0x37, 0x11, 0x5F, 0x7E, 0x6C, 0xA9, 0x35, 0xF7, 0xAF, 0x57, 0xB4, 0x71, 0xCA, 0x57, 0x42, 0x7C, 
+0xF1, 0x9F, 0x4B, 0xBE, 0xCD, 0xC1, 0x91, 0xE9, 0x59, 0xD7, 0x2A, 0x81, 0x4E, 0xF8, 0xA4, 0x90, 
+0x3F, 0xD2, 0xA4, 0x39, 0x0F, 0x1A, 0xBD, 0x49, 0x71, 0x13, 0xDF, 0xC3, 0xFD, 0x9D, 0xAB, 0xAA, 
+0x55, 0x2D, 0xCD, 0xF3, 0x66, 0x37, 0x1B, 0xBA, 0x31, 0x88, 0x12, 0x6B, 0x84, 0x4E, 0xDB, 0xED, 
+0x40, 0x05, 0x74, 0x87, 0x68, 0x89, 0x5B, 0x8F, 0x3D, 0xEA, 0x7A, 0x06, 0x1C, 0xFD, 0x2C, 0x04, 
+0xC3, 0xC7, 0x7E, 0xEB, 0x18, 0x1A, 0xEE, 0x23, 0x05, 0xA5, 0x3E, 0x0E, 0xFD, 0x44, 0x1B, 0x31, 
+0x25, 0xBB, 0x78, 0xC1, 0x86, 0x27, 0x98, 0x29, 0x5C, 0x42, 0x5C, 0xBB, 0x7E, 0xF4, 0x01, 0xF8, 
+0x7B, 0x86, 0xF3, 0xCA, 0x9C, 0x9A, 0x40, 0xE5, 0x0A, 0x13, 0x8B, 0x9B, 0x7A, 0x69, 0xCE, 0x33, 
+0xBF, 0xB9, 0x65, 0x9A, 0xE6, 0x3A, 0x14, 0x48, 0xB1, 0xA6, 0xCF, 0x54, 0xE1, 0x40, 0x7C, 0x35, 
+0x23, 0x55, 0x37, 0x4D, 0xA7, 0xA7, 0x5E, 0x01, 0x4C, 0xBE, 0x6B, 0x6C, 0x5D, 0x9A, 0x11, 0x0F, 
+0xD7, 0xE4, 0x92, 0x0E, 0xAE, 0x43, 0x7A, 0x51, 0x1B, 0x55, 0xCA, 0x14, 0x9B, 0xB7, 0xB1, 0x50, 
+0xCA, 0xC4, 0x19, 0xE2, 0x59, 0x32, 0x16, 0x07, 0xA1, 0x8E, 0x36, 0x73, 0x5B, 0x7A, 0xAE, 0x06, 
+0xF2, 0x5A, 0x4F, 0x6B, 0xD5, 0x3F, 0xD5, 0xD4, 0xEF, 0x18, 0x07, 0x2A, 0xBA, 0xFD, 0x58, 0xAF, 
+0xAD, 0x96, 0xE2, 0x8A, 0xCC, 0xA0, 0x60, 0x3A, 0xC7, 0x64, 0x43, 0xF6, 0x91, 0x81, 0xBA, 0x07, 
+0x80, 0x01, 0x42, 0x23, 0xDB, 0xC5, 0x4E, 0xFE, 0xAE, 0xB5, 0x2E, 0xA3, 0x59, 0x60, 0xDB, 0xD7, 
+0xCB, 0x58, 0x9A, 0x1D, 0x59, 0x97, 0x0F, 0xEB, 0xF6, 0xF6, 0x43, 0xCB, 0xAA, 0xB1, 0x66, 0x30, 
+0xBA, 0x86, 0xDF, 0x2C, 0xA3, 0x42, 0x6B, 0x90, 0x7A, 0xB7, 0x62, 0xE1, 0x10, 0xEA, 0x52, 0x57, 
+0x64, 0x92, 0xFB, 0x4E, 0xAA, 0x48, 0x60, 0x06, 0xC4, 0xFE, 0xED, 0x46, 0xBA, 0x1C, 0xC2, 0x87, 
+0x66, 0xFA, 0xA6, 0x13, 0xEF, 0xB1, 0x32, 0xB7, 0x47, 0xED, 0xB3, 0xD3, 0x14, 0x99, 0x5E, 0x43, 
+0xB1, 0x34, 0x08, 0x5F, 0x2B, 0x19, 0x69, 0x6D, 0x3A, 0x78, 0x69, 0xA5, 0x06, 0xA4, 0xF2, 0x00, 
+0xA2, 0xC5, 0x5C, 0xFF, 0x4F, 0x78, 0xB1, 0x32, 0x4B, 0xBF, 0x61, 0x9E, 0xE0, 0xBC, 0x4F, 0x50, 
+0x33, 0x48, 0xF1, 0x98, 0x3A, 0x74, 0xB1, 0x70, 0x08, 0xC1, 0xB8, 0x8F, 0xB3, 0xC9, 0xD1, 0x54, 
+0x44, 0x07, 0x0B, 0x79, 0x2C, 0xF7, 0xE5, 0x7E, 0x00, 0x8B, 0x5E, 0x70, 0xBB, 0x66, 0xEE, 0xEB, 
+0x70, 0x4E, 0xE4, 0xAB, 0xFE, 0xA9, 0x65, 0x55, 0xBD, 0x28, 0x07, 0xAA, 0x49, 0x7F, 0xEF, 0xB7, 
+0x73, 0x7D, 0xCD, 0x47, 0xBD, 0x57, 0x67, 0xFA, 0xCD, 0x17, 0xCD, 0x67, 0xE6, 0x65, 0x2E, 0xF9, 
+0x9B, 0x72, 0x71, 0x8F, 0x98, 0x7B, 0xDB, 0xF7, 0xE3, 0xA9, 0x6D, 0x3E, 0x9E, 0xE6, 0x7E, 0x5E, 
+0xFD, 0x2A, 0x4F, 0x68, 0x2F, 0xA6, 0x22, 0x0B, 0x85, 0xF7, 0xC2, 0x1F, 0xD9, 0x03, 0x0C, 0x7E, 
+0xFE, 0xE8, 0x93, 0x55, 0xF4, 0x35, 0x22, 0xF5, 0x9F, 0x3D, 0x08, 0x68, 0xEE, 0xA6, 0x22, 0xBD, 
+0xFB, 0x97, 0x94, 0x1E, 0xE4, 0xF2, 0x43, 0x80, 0x58, 0x88, 0x29, 0x81, 0x50, 0xC3, 0xA2, 0x0E, 
+0x40, 0x6E, 0x01, 0xB7, 0x31, 0x2F, 0x79, 0x8A, 0x44, 0x10, 0xBD, 0xE9, 0x4D, 0x44, 0xAD, 0x31, 
+0x44, 0x11, 0x1A, 0x11, 0x87, 0x48, 0x2D, 0x5A, 0x48, 0xD0, 0xAC, 0x1A, 0xFB, 0x50, 0x92, 0xBA, 
+0x74, 0xC8, 0xC4, 0xB1, 0x96, 0x89, 0xC7, 0x01, 0x56, 0x2F, 0x69, 0xD9, 0x8A, 0xBA, 0x81, 0xC0, 
+0xE0, 0xF3, 0x86, 0x51, 0x70, 0x9D, 0x43, 0x20, 0x6A, 0x25, 0xEA, 0xB4, 0x12, 0xD7, 0x1D, 0xED, 
+0xE7, 0xEC, 0x8A, 0x23, 0x00, 0x71, 0xCE, 0x10, 0xAD, 0x8D, 0x89, 0x21, 0x16, 0xB3, 0x2F, 0x02, 
+0x51, 0x2A, 0xA7, 0x85, 0x1F, 0xE9, 0x0E, 0xE5, 0xA9, 0x2D, 0xBD, 0xC8, 0x09, 0xA1, 0x44, 0xC5, 
+0x02, 0xBD, 0xB2, 0xF5, 0x89, 0x83, 0xB0, 0x4A, 0xAA, 0xD6, 0x1E, 0x00, 0xBE, 0x4D, 0x99, 0xD2, 
+0x46, 0xAA, 0x16, 0xC5, 0x16, 0xCE, 0x99, 0x76, 0xF9, 0x67, 0x9B, 0x51, 0xD7, 0x30, 0x94, 0xE9, 
+0x40, 0xE8, 0x10, 0x38, 0xDC, 0x87, 0x55, 0x7B, 0xAE, 0x3A, 0xA3, 0x02, 0xFB, 0x18, 0xEC, 0x15, 
+0xD8, 0xFE, 0x60, 0x74, 0xE4, 0xF3, 0x80, 0xCB, 0x9D, 0x14, 0xE6, 0xCE, 0x7B, 0x42, 0x07, 0x4B, 
+0x8C, 0x86, 0x3B, 0x44, 0xDF, 0x07, 0x08, 0xC4, 0x58, 0xFB, 0xCD, 0xEB, 0x94, 0x3B, 0x88, 0xFC, 
+0xBC, 0x5B, 0x33, 0x05, 0xE0, 0x5B, 0xEC, 0x21, 0x0C, 0x28, 0xC2, 0x2D, 0x60, 0x5C, 0xCC, 0xD9, 
+0xF2, 0x18, 0x44, 0x51, 0x66, 0xBF, 0xDA, 0x06, 0xF1, 0x08, 0xD6, 0xD1, 0x96, 0x2C, 0x56, 0xC6, 
+0xB4, 0x42, 0x75, 0x6D, 0xE1, 0x26, 0xF0, 0xBD, 0x89, 0xDF, 0x54, 0x32, 0xF6, 0x82, 0xB4, 0xDF, 
+0xF0, 0x44, 0xDE, 0xA4, 0xC9, 0xC3, 0x22, 0x80, 0xBF, 0xEE, 0xD6, 0x80, 0x41, 0xBD, 0x31, 0x1C, 
+0xED, 0xCF, 0xDB, 0x58, 0xC5, 0xA8, 0x6A, 0x15, 0x22, 0x6D, 0xAA, 0x94, 0x18, 0xDB, 0x49, 0x4B, 
+0x43, 0xBE, 0xC3, 0x74, 0xDF, 0xE7, 0x3E, 0xD7, 0x6B, 0x63, 0x90, 0x0A, 0xF7, 0x0E, 0x75, 0xB4, 
+0x27, 0x6E, 0xF1, 0x21, 0x51, 0x46, 0xCF, 0x4C, 0x89, 0x63, 0x1A, 0x84, 0x18, 0xA9, 0x05, 0xA5, 
+0x7A, 0x60, 0x1A, 0x82, 0x73, 0xD0, 0x3B, 0xD4, 0x05, 0xB7, 0x3D, 0xC9, 0x87, 0x16, 0xA8, 0x9B, 
+0xE0, 0x66, 0xF9, 0xBB, 0x06, 0xAB, 0x64, 0x08, 0x31, 0x20, 0x8C, 0x7D, 0xFE, 0xCD, 0x6C, 0xCC, 
+0x7C, 0x13, 0x6E, 0x60, 0x3D, 0x3B, 0x97, 0xE5, 0x51, 0xE2, 0xBD, 0x09, 0x2F, 0x82, 0xEF, 0x46, 
+0x48, 0xF2, 0x13, 0x68, 0x83, 0xA2, 0x03, 0xD9, 0xFD, 0xB4, 0xDF, 0x49, 0x95, 0x24, 0xCA, 0x73, 
+0xF8, 0xFB, 0xDD, 0xFA, 0xB9, 0x97, 0x81, 0xCC, 0xE5, 0xF7, 0xF5, 0xBA, 0xEE, 0x93, 0xDC, 0x35, 
+0xFC, 0x7F, 0xE5, 0xD0, 0xB7, 0x13, 0xD5, 0xDC, 0x25, 0x73, 0x44, 0x77, 0xEA, 0x8B, 0xEE, 0x7F, 
+0x3F, 0xA7, 0xDD, 0x33, 0x85, 0x86, 0xBF, 0xF4, 0xBC, 0xCC, 0x3D, 0x62, 0xCD, 0x99, 0x1D, 0xD0, 
+0x45, 0x36, 0xE2, 0x52, 0x82, 0xFD, 0x90, 0xB6, 0xD8, 0x3A, 0xF3, 0xA1, 0x10, 0xD1, 0x01, 0x91, 
+0x27, 0x1B, 0x11, 0x90, 0x66, 0x32, 0x89, 0x12, 0x60, 0x17, 0x2D, 0x0D, 0xE1, 0x59, 0x85, 0x45, 
+0xFF, 0x94, 0x0A, 0xF6, 0xF3, 0xC4, 0x5A, 0x4F, 0x89, 0x2E, 0x2A, 0xFE, 0xE1, 0xE0, 0xAF, 0x4C, 
+0x64, 0xE9, 0x6C, 0x30, 0xB4, 0xE6, 0x0A, 0xCB, 0xA4, 0x91, 0x9D, 0x9C, 0xA9, 0xC3, 0xCB, 0x14, 
+0x70, 0xA5, 0xCF, 0xD3, 0x88, 0x5F, 0x6C, 0xE4, 0x29, 0xC8, 0x7B, 0x7D, 0xB8, 0x0A, 0x59, 0x1B, 
+0xF3, 0x64, 0x57, 0xD1, 0x3C, 0x85, 0x50, 0xED, 0x7D, 0xD2, 0x02, 0x26, 0xA5, 0x37, 0x88, 0xFA, 
+0xD6, 0xF1, 0xE1, 0x94, 0x8A, 0x10, 0x2B, 0x44, 0x04, 0x49, 0x9B, 0xB0, 0x5C, 0xDE, 0xF8, 0x02, 
+0xB2, 0x09, 0x54, 0x62, 0x66, 0x18, 0x2B, 0x4F, 0x93, 0x58, 0xD9, 0x03, 0x2A, 0x0D, 0xE1, 0x45, 
+0x1F, 0xA0, 0x08, 0x4A, 0xA0, 0xAA, 0x12, 0x65, 0x25, 0x8C, 0x0A, 0x08, 0x74, 0x84, 0x6E, 0x32, 
+0x48, 0x33, 0x66, 0x6E, 0x96, 0x83, 0x3B, 0x11, 0xF7, 0x12, 0x88, 0xAF, 0x54, 0x76, 0x0C, 0x62, 
+0x22, 0xD7, 0x5C, 0x5A, 0x3B, 0x15, 0x25, 0x0F, 0xEA, 0x33, 0xA6, 0x65, 0xEA, 0x7D, 0x0E, 0xCA, 
+0x51, 0xAD, 0xD4, 0xC2, 0xC8, 0xCA, 0xC1, 0xC7, 0xD6, 0xD0, 0xF5, 0x19, 0xC1, 0xB7, 0x7D, 0x3F, 
+0xF2, 0x51, 0x65, 0x02, 0x4F, 0x44, 0x21, 0x3A, 0xB7, 0x03, 0x97, 0x28, 0x16, 0xA9, 0x0B, 0xAA, 
+0xBA, 0xA8, 0x93, 0xAD, 0x68, 0x15, 0x5B, 0x02, 0x63, 0x86, 0x8B, 0x07, 0x80, 0xFB, 0x1E, 0x55, 
+0x6A, 0x33, 0xEB, 0xE5, 0x47, 0x82, 0x83, 0x8A, 0x3D, 0x3F, 0xE9, 0xD4, 0x94, 0x07, 0x1E, 0x61, 
+0x65, 0xD2, 0xA2, 0x5E, 0xF5, 0xF9, 0x83, 0xB4, 0x96, 0xEA, 0xF2, 0xDA, 0x24, 0x1D, 0xA1, 0xAF, 
+0x73, 0x95, 0x2F, 0x0B, 0xCB, 0x3C, 0x5B, 0x0D, 0x3B, 0x33, 0x8E, 0x1C, 0xA5, 0xF2, 0xFF, 0x74, 
+0xEB, 0xAB, 0x36, 0xC1, 0x39, 0xCE, 0x9B, 0x0C, 0x59, 0x10, 0xB0, 0x31, 0x45, 0xF5, 0x10, 0x77, 
+0xB4, 0x10, 0x24, 0xE8, 0x97, 0xB7, 0x3C, 0x85, 0x17, 0x86, 0x81, 0xE8, 0x2F, 0xB0, 0x16, 0x84, 
+0x79, 0xB8, 0xD8, 0x32, 0xCD, 0x45, 0x2E, 0xD6, 0x81, 0xCB, 0x6F, 0x95, 0x44, 0xD5, 0x74, 0xD0, 
+0x8F, 0x53, 0x9F, 0xE1, 0x7C, 0x58, 0xAD, 0x82, 0xBE, 0x97, 0x2A, 0x10, 0x01, 0x0F, 0x87, 0x5A, 
+0x69, 0x1B, 0x41, 0xC4, 0xCA, 0x61, 0xCC, 0xCA, 0x79, 0xD9, 0x99, 0x25, 0xAE, 0xC1, 0x73, 0xEE, 
+0xBB, 0x42, 0xE5, 0x77, 0x99, 0xF9, 0x96, 0xA7, 0x03, 0xE7, 0x43, 0xAE, 0xB4, 0x9A, 0x99, 0x38, 
+0xC8, 0xD5, 0xF8, 0xB0, 0x81, 0x94, 0xD1, 0xA9, 0x88, 0x48, 0x5D, 0x4B, 0x72, 0xB0, 0xD4, 0x93, 
+0x35, 0x24, 0xC2, 0x2F, 0xE1, 0x3C, 0xAC, 0xBB, 0x4C, 0xDD, 0xA8, 0x9F, 0x33, 0x9C, 0x9F, 0x5E, 
+0x6A, 0xAB, 0xF4, 0x68, 0x14, 0x64, 0x14, 0x44, 0xFD, 0x9B, 0xE6, 0x34, 0x84, 0x40, 0xFA, 0xD9, 
+0xA9, 0x43, 0xFD, 0xBB, 0xAF, 0xC2, 0xA7, 0xAB, 0x2B, 0x3C, 0xFF, 0xC2, 0x08, 0x49, 0xB3, 0xBF, 
+0xCF, 0x2D, 0x4D, 0x7B, 0x7C, 0x82, 0xC6, 0xED, 0x3B, 0x4C, 0x13, 0xF5, 0xDA, 0x5E, 0x2E, 0x4B, 
+0xFB, 0xCD, 0x86, 0x67, 0x67, 0x39, 0xCD, 0x28, 0xBE, 0x66, 0x78, 0x95, 0xB6, 0x45, 0x20, 0xBD, 
+0x82, 0x93, 0x5F, 0x98, 0xEB, 0xB8, 0x14, 0x34, 0x0F, 0xA0, 0x3C, 0x2B, 0x77, 0xAA, 0x65, 0x8D, 
+0x7A, 0x7D, 0xE6, 0xE1, 0xF5, 0x9C, 0x3B, 0x5A, 0xF6, 0x73, 0x38, 0xBF, 0x1A, 0xF2, 0x0D, 0x29, 
+0x2F, 0x39, 0xA0, 0x61, 0x00, 0x7B, 0x7C, 0xF5, 0x37, 0x90, 0x7B, 0xBA, 0xD4, 0x21, 0x63, 0xC8, 
+0x4F, 0x48, 0xC8, 0xD9, 0xF9, 0x09, 0x63, 0x09, 0x4F, 0xCC, 0x0C, 0x9C, 0xD8, 0xCF, 0x5A, 0x6F, 
+0xA2, 0x03, 0x3A, 0x8C, 0x74, 0xA1, 0xC4, 0x5D, 0x7C, 0xFE, 0x62, 0x88, 0x40, 0xF1, 0x6F, 0x86, 
+0x88, 0xDA, 0x8E, 0xE2, 0xFB, 0x26, 0x4C, 0x43, 0x12, 0xFC, 0x99, 0xF2, 0xFA, 0xE6, 0xE3, 0xCD, 
+0xE8, 0x78, 0x8B, 0xA0, 0x7E, 0x94, 0x5E, 0x65, 0xF0, 0x06, 0x01, 0x5E, 0xC6, 0xF1, 0x38, 0x56, 
+0x38, 0xAA, 0x22, 0x02, 0xB6, 0xD3, 0x19, 0x46, 0x1E, 0xB5, 0x34, 0xDD, 0x36, 0x98, 0x9F, 0x98, 
+0x5A, 0x84, 0x06, 0x43, 0x34, 0x7A, 0xF2, 0x91, 0x85, 0x8D, 0x4A, 0x99, 0x0D, 0x39, 0xEA, 0x08, 
+0x63, 0x83, 0xEA, 0xA4, 0xF6, 0xA8, 0x66, 0x91, 0x4C, 0x1D, 0x93, 0x0D, 0xC8, 0x58, 0x92, 0xA2, 
+0x72, 0x96, 0x86, 0xF7, 0xDB, 0x03, 0x7E, 0x8F, 0x0F, 0x5B, 0xE5, 0x52, 0x5E, 0x7F, 0xAC, 0x13, 
+0x3B, 0x15, 0x34, 0x08, 0x1E, 0xB8, 0xDC, 0xE6, 0xBC, 0x50, 0x40, 0xB4, 0x2E, 0xBB, 0xE9, 0xE7, 
+0xD3, 0x25, 0xC5, 0x0C, 0x4D, 0x0F, 0x16, 0x14, 0x82, 0xDE, 0x63, 0xA4, 0x26, 0x7C, 0xE7, 0x90, 
+0xCF, 0x1C, 0x5F, 0x9F, 0x43, 0x82, 0xD6, 0x24, 0x0B, 0x2F, 0x48, 0xB1, 0x66, 0x0D, 0xD0, 0x88, 
+0xB8, 0x74, 0x25, 0x24, 0x48, 0x4D, 0xB8, 0xD1, 0x01, 0x23, 0x92, 0x5B, 0x8E, 0x78, 0x08, 0x9C, 
+0x30, 0x46, 0x2C, 0x25, 0xD1, 0xB9, 0x54, 0x26, 0xEA, 0x9B, 0x0F, 0xEA, 0xA2, 0x63, 0xB7, 0x96, 
+0x8F, 0x11, 0x62, 0xF4, 0xDF, 0xFD, 0xD5, 0xFF, 0xBE, 0x5D, 0xC5, 0xAF, 0xB3, 0x2E, 0xCC, 0x9F, 
+0xAC, 0x7D, 0x2C, 0x57, 0xAE, 0xBE, 0x4C, 0xD4, 0x9B, 0x58, 0xD1, 0x9B, 0x6C, 0x0B, 0x72, 0x84, 
+0x0C, 0xDC, 0x89, 0xA3, 0x01, 0x64, 0x05, 0x9E, 0x46, 0xC1, 0x68, 0xB3, 0x0D, 0xE7, 0x19, 0x2C, 
+0x0E, 0xC8, 0x03, 0x81, 0xD6, 0x54, 0x26, 0xA1, 0xC7, 0x5B, 0x85, 0x90, 0x21, 0x3D, 0x14, 0xAE, 
+0x40, 0xC9, 0x52, 0x1D, 0xC0, 0x2D, 0xB5, 0x1F, 0x39, 0x38, 0xBF, 0xD5, 0x3E, 0x08, 0x2D, 0x90, 
+0x2B, 0x54, 0x92, 0xF4, 0xB0, 0x83, 0xE7, 0xF8, 0xC8, 0x99, 0x50, 0x62, 0x1A, 0x84, 0x16, 0xC8, 
+0x15, 0x28, 0x39, 0xAA, 0x73, 0xE5, 0x9E, 0x67, 0x9A, 0xDE, 0x49, 0x2F, 0x0C, 0x74, 0xD3, 0x15, 
+0x07, 0x3E, 0x37, 0x43, 0xAE, 0x1A, 0xE6, 0x2C, 0xD8, 0x59, 0x72, 0x68, 0x50, 0x15, 0x8C, 0x85, 
+0x80, 0x41, 0x26, 0x41, 0xD2, 0x9B, 0x5D, 0x44, 0x4D, 0x05, 0xC3, 0x9D, 0x81, 0xB5, 0x30, 0x7F, 
+0x9A, 0xE4, 0x71, 0xE4, 0x09, 0x04, 0x25, 0x0F, 0x4B, 0xC4, 0x14, 0xE2, 0xA5, 0xD1, 0x42, 0x30, 
+0xF4, 0x59, 0xD8, 0x5A, 0x90, 0x36, 0x0E, 0xC8, 0x02, 0xD7, 0x34, 0x80, 0x72, 0x31, 0x7C, 0xB8, 
+0xDE, 0x1A, 0xA6, 0xA8, 0x2B, 0x35, 0xAD, 0x13, 0xD7, 0x81, 0x1A, 0x8F, 0x7D, 0x16, 0x88, 0x14, 
+0x3C, 0x9C, 0x18, 0xF0, 0xD2, 0x41, 0xD0, 0xB7, 0x4C, 0xC6, 0x70, 0x6C, 0x6E, 0x0E, 0x89, 0x4C, 
+0xC1, 0xEE, 0xD6, 0xF7, 0x8C, 0xA3, 0x16, 0x42, 0x07, 0xEE, 0xA1, 0x06, 0xCA, 0x0E, 0x41, 0xD0, 
+0x56, 0xC0, 0xBE, 0x67, 0x5C, 0x79, 0x20, 0xBC, 0x07, 0x18, 0xCD, 0x87, 0xAC, 0x1B, 0xC5, 0x80, 
+0x5D, 0x9B, 0x37, 0x3F, 0xFF, 0x87, 0x41, 0x7D, 0x3F, 0x7B, 0x2D, 0xEF, 0x17, 0x1C, 0xE8, 0xCC, 
+0x86, 0x95, 0x99, 0x35, 0x24, 0x32, 0x0E, 0xA9, 0x97, 0xAA, 0x26, 0x89, 0x73, 0x25, 0xE4, 0x73, 
+0x3F, 0x46, 0x46, 0x9B, 0x2F, 0xC9, 0x3E, 0x8F, 0x35, 0xDF, 0x32, 0x90, 0xDD, 0xE0, 0x2A, 0xA1, 
+0x9A, 0x63, 0xC3, 0xAE, 0xB5, 0x74, 0x53, 0xC6, 0xEA, 0xBE, 0xAE, 0xAF, 0xEF, 0x59, 0x32, 0x49, 
+0xD8, 0x6D, 0xA4, 0x77, 0x6A, 0x91, 0x7B, 0x9F, 0x58, 0xA5, 0x66, 0x93, 0xB7, 0xBD, 0x60, 0xA3, 
+0xCD, 0x77, 0x82, 0x26, 0xB4, 0x4D, 0x8F, 0x69, 0xA1, 0xDA, 0xB8, 0x78, 0x66, 0xA6, 0x04, 0x13, 
+0x35, 0x5F, 0xDC, 0xBA, 0xE9, 0xB2, 0x2E, 0x46, 0x7E, 0xAF, 0x6F, 0xF8, 0xE7, 0x0A, 0x13, 0x2E, 
+0x1C, 0x5C, 0xB6, 0xE1, 0x7C, 0x76, 0x6C, 0x50, 0xD8, 0x17, 0x2E, 0x0A, 0x61, 0xB3, 0xC0, 0x55, 
+0x69, 0x26, 0x60, 0xCA, 0x9E, 0x95, 0x52, 0x4E, 0xD6, 0xC4, 0x09, 0x10, 0x11, 0x4C, 0x34, 0xE8, 
+0x3D, 0xDD, 0x2B, 0xDF, 0x43, 0x55, 0x8F, 0xD6, 0x68, 0x69, 0x2F, 0xC8, 0x58, 0xFE, 0xC7, 0x35, 
+0x08, 0x39, 0x55, 0xBC, 0x17, 0x1F, 0x70, 0x04, 0x98, 0x63, 0xD6, 0x43, 0x6C, 0x0B, 0x3A, 0xCB, 
+0x6A, 0x84, 0x46, 0x10, 0xCE, 0x82, 0x14, 0xB6, 0xB6, 0xD8, 0x3F, 0xE6, 0x21, 0x3B, 0x88, 0x79, 
+0x3E, 0x9A, 0xD8, 0xC2, 0x3D, 0x2D, 0x63, 0xC3, 0x28, 0xF7, 0xCF, 0xF7, 0x71, 0x8B, 0x2C, 0x6E, 
+0x80, 0x8D, 0x13, 0xDF, 0x95, 0x32, 0x4F, 0xF1, 0x74, 0xBD, 0x0D, 0xC8, 0x81, 0x14, 0x54, 0xD3, 
+0x4C, 0x08, 0x9C, 0x57, 0xF4, 0x32, 0x83, 0xE9, 0xAA, 0x95, 0xA2, 0xA4, 0x93, 0x92, 0xB0, 0xB3, 
+0xC4, 0xCC, 0xA8, 0x20, 0x10, 0x27, 0x69, 0x93, 0x2F, 0x31, 0x29, 0x15, 0xAC, 0x8D, 0xE7, 0xFE, 
+0xB7, 0x93, 0xAD, 0xAB, 0xCE, 0x9B, 0xD2, 0x2C, 0x14, 0x68, 0x4E, 0xCC, 0x0B, 0x46, 0x53, 0xDE, 
+0x4A, 0x1E, 0x54, 0xE3, 0xA0, 0x74, 0xE2, 0xFD, 0x93, 0x2B, 0x0E, 0x3D, 0x86, 0x53, 0x17, 0x2B, 
+0x33, 0xF2, 0xA7, 0x3F, 0xF3, 0xAE, 0x0A, 0x01, 0x61, 0x50, 0x96, 0xB2, 0x5B, 0xFC, 0xA5, 0xA7, 
+0xA5, 0x26, 0x9B, 0xF2, 0x13, 0x3D, 0x69, 0x1F, 0x0C, 0xA3, 0x54, 0xF3, 0xCE, 0x99, 0x11, 0x69, 
+0x05, 0x26, 0x11, 0xBE, 0xD5, 0xEA, 0xDB, 0x61, 0xB4, 0x75, 0x84, 0x10, 0xEA, 0x3D, 0xB4, 0x1E, 
+0xE8, 0x39, 0x04, 0x41, 0x7B, 0x16, 0x61, 0x10, 0x88, 0x72, 0x4F, 0x9B, 0x62, 0x89, 0xA8, 0x32, 
+0xD4, 0x96, 0x99, 0xEB, 0xCB, 0x9F, 0x8E, 0x85, 0xEA, 0xA4, 0xAE, 0x98, 0xF2, 0x0C, 0x79, 0x9F, 
+0x26, 0xA6, 0xC1, 0x8F, 0x0C, 0x86, 0xBE, 0x64, 0x0A, 0x8E, 0xF0, 0x27, 0xE6, 0x5E, 0xEE, 0x10, 
+0xB8, 0x35, 0x80, 0xBE, 0x4A, 0x10, 0x34, 0x2F, 0xAB, 0x03, 0x99, 0xE9, 0xF8, 0x83, 0xD2, 0xB5, 
+0x38, 0x09, 0x41, 0xBA, 0x94, 0x8D, 0x0B, 0x11, 0xC8, 0x88, 0xE6, 0x0E, 0xB4, 0x21, 0x49, 0xB0, 
+0x7A, 0xF2, 0x24, 0x0E, 0x41, 0x70, 0xA1, 0x9F, 0xA2, 0x38, 0x87, 0xE6, 0xDA, 0x77, 0xE1, 0x9E, 
+0xEB, 0x71, 0xD5, 0xD4, 0xB6, 0xB4, 0x0B, 0x3F, 0x72, 0xB7, 0xED, 0xF2, 0x58, 0xC8, 0x5C, 0x55, 
+0x17, 0xDF, 0xD8, 0x2D, 0xA8, 0x33, 0xC8, 0xFA, 0x6E, 0x2C, 0x74, 0x49, 0xB2, 0xFD, 0x72, 0xA3, 
+0x71, 0x67, 0xE1, 0x65, 0xE5, 0xB0, 0xDC, 0x9D, 0xD6, 0x84, 0x60, 0xAA, 0x28, 0xE2, 0x66, 0x15, 
+0xD5, 0x60, 0x10, 0xD9, 0x7E, 0x74, 0x37, 0x2C, 0xC6, 0xFE, 0xB9, 0xA5, 0x59, 0xE4, 0x43, 0x23, 
+0xF2, 0xFE, 0x4E, 0x89, 0x68, 0xC6, 0x5B, 0x9D, 0x0B, 0xCA, 0x8F, 0x31, 0xAD, 0xE9, 0x25, 0xCB, 
+0x93, 0xCD, 0xAC, 0x1B, 0x30, 0x98, 0x49, 0x65, 0xCC, 0x38, 0xB0, 0x0E, 0xE0, 0xD2, 0x98, 0xE0, 
+0xEC, 0xAB, 0x3D, 0x76, 0xE1, 0x5C, 0x1D, 0x35, 0xB6, 0xBC, 0xE6, 0xB5, 0x06, 0xC6, 0xB1, 0x33, 
+0x97, 0xCE, 0x04, 0x78, 0x65, 0xCB, 0x16, 0xF7, 0x11, 0xBA, 0x17, 0x57, 0x2F, 0x48, 0x23, 0xB7, 
+0x6A, 0x03, 0x1A, 0x1C, 0x2B, 0xE7, 0xE2, 0x86, 0x50, 0x06, 0xA7, 0xCB, 0xD5, 0x1D, 0x8E, 0x28, 
+0xE0, 0x7B, 0xD3, 0x4F, 0xC6, 0x8E, 0x41, 0x70, 0x44, 0x35, 0x3D, 0x1B, 0xD7, 0xF2, 0x43, 0x26, 
+0x13, 0x4A, 0x6E, 0xB9, 0x35, 0xB1, 0xBB, 0x2F, 0xF3, 0x40, 0xD7, 0x1D, 0x8A, 0xFD, 0xBA, 0xAE, 
+0x4E, 0x8E, 0x67, 0xA4, 0xA3, 0x85, 0x82, 0x4D, 0x9D, 0x78, 0x30, 0xEC, 0xF4, 0x36, 0x1F, 0x8C, 
+0x62, 0xA6, 0x7B, 0xDF, 0x4B, 0xD3, 0xE2, 0x68, 0xC4, 0x58, 0x05, 0xE9, 0xC9, 0x6C, 0xC6, 0x1E, 
+0xC9, 0x1C, 0x51, 0x8A, 0xCC, 0x23, 0x15, 0xDC, 0x10, 0x44, 0x4C, 0x97, 0x18, 0x33, 0x13, 0x2B, 
+0xB9, 0x65, 0x61, 0x42, 0x33, 0xB2, 0xF6, 0xD8, 0xD3, 0x78, 0x6F, 0xCD, 0xE7, 0xB7, 0xF3, 0x04, 
+0x25, 0x60, 0xB7, 0xBA, 0x4D, 0x82, 0x5F, 0xB1, 0xF7, 0xDC, 0x33, 0x06, 0x10, 0xD4, 0xE3, 0x32, 
+0x43, 0x3B, 0x16, 0x33, 0x74, 0xB6, 0x59, 0x72, 0x1B, 0x4C, 0x7F, 0x81, 0xFC, 0x04, 0x7D, 0xE4, 
+0x1B, 0xDD, 0x84, 0xD3, 0x78, 0x8B, 0xD2, 0xAE, 0xC2, 0x3C, 0x81, 0x83, 0x76, 0x5A, 0x94, 0x55, 
+0x96, 0xE4, 0x13, 0xB1, 0xC4, 0xA5, 0x36, 0x17, 0x41, 0x38, 0xB6, 0x7F, 0xA0, 0xCD, 0x40, 0xB2, 
+0x1D, 0xDC, 0xFF, 0x22, 0x01, 0x2A, 0xBB, 0x49, 0xF9, 0x2B, 0x2A, 0x7C, 0x8D, 0x35, 0x82, 0xC8, 
+0x06, 0x24, 0x69, 0xDA, 0x6F, 0x54, 0x16, 0x45, 0xD4, 0x26, 0x25, 0x53, 0x4F, 0x1F, 0xA2, 0xAB, 
+0xC7, 0x88, 0x59, 0xB2, 0x3E, 0x91, 0x4D, 0x23, 0xC5, 0x9A, 0x21, 0x74, 0x64, 0x93, 0x2D, 0x99, 
+0x2B, 0xBF, 0x8A, 0x0C, 0xA4, 0xFD, 0x9D, 0x79, 0xE4, 0xC6, 0x6D, 0x23, 0xF8, 0x6C, 0x72, 0xD1, 
+0x07, 0x8D, 0x41, 0xD4, 0xAF, 0x49, 0x3C, 0x5A, 0xFE, 0x94, 0x3E, 0xF4, 0xCA, 0x50, 0xED, 0xC2, 
+0xEC, 0x50, 0x2A, 0x0D, 0xE6, 0x08, 0x9F, 0x4A, 0x85, 0x9E, 0xD5, 0xF2, 0x4A, 0x0E, 0x45, 0x41, 
+0x48, 0xD6, 0x42, 0xCC, 0xCA, 0xC8, 0xED, 0x9D, 0xF2, 0x27, 0x28, 0xB1, 0x63, 0xD8, 0x9D, 0xD0, 
+0xCE, 0xAB, 0xA4, 0x6E, 0x7C, 0x6C, 0xF4, 0x47, 0xFD, 0x4B, 0x51, 0x29, 0x4B, 0x2B, 0x57, 0xD3, 
+0x27, 0xB3, 0x32, 0xD5, 0xD4, 0x22, 0xCA, 0xB9, 0x25, 0x8D, 0xF0, 0x04, 0x02, 0x13, 0x63, 0xD6, 
+0xF0, 0x56, 0x69, 0x82, 0x28, 0x32, 0x44, 0x02, 0x57, 0xE3, 0xEA, 0x9E, 0x2C, 0x22, 0x4B, 0xB0, 
+0xB3, 0xB4, 0xD1, 0xB8, 0xD2, 0x60, 0x9D, 0x3B, 0x0F, 0x10, 0xE6, 0x17, 0xF5, 0xBF, 0xE9, 0x42, 
+0x9F, 0xB3, 0xEA, 0x78, 0xB3, 0xCC, 0xE8, 0xB8, 0x5B, 0xBD, 0x4A, 0x67, 0xAB, 0x71, 0x1D, 0xB7, 
+0xB2, 0x52, 0xEC, 0x95, 0x05, 0xAA, 0xDA, 0x40, 0x11, 0x7F, 0x4A, 0x58, 0x1C, 0x5D, 0x40, 0x2A, 
+0xA4, 0x5F, 0xC4, 0xA1, 0x27, 0x38, 0xD1, 0x62, 0x23, 0x89, 0x73, 0x8A, 0x65, 0x03, 0xCB, 0xCB, 
+0xC8, 0x93, 0xD3, 0xD3, 0x44, 0xE0, 0x1E, 0x59, 0x24, 0x42, 0x9D, 0x87, 0xE2, 0xEF, 0x0C, 0x0C, 
+0x87, 0x29, 0x19, 0xCB, 0xED, 0xA2, 0xDA, 0x21, 0x9E, 0xC3, 0xC0, 0xDE, 0x4F, 0xAF, 0x16, 0xB1, 
+0x54, 0x04, 0x53, 0xDB, 0xD2, 0x12, 0x79, 0x64, 0x8D, 0xD6, 0xA6, 0xF3, 0x7B, 0xD0, 0x3B, 0xBA, 
+0x70, 0xD8, 0x12, 0xBD, 0x63, 0xD8, 0xE2, 0xB3, 0xF2, 0xD2, 0xC1, 0xE4, 0xF0, 0x49, 0x5C, 0xCC, 
+0x85, 0x13, 0xD3, 0xD5, 0x24, 0x1E, 0xE4, 0xA2, 0x0D, 0x10, 0x64, 0xEE, 0x4E, 0x75, 0x61, 0xD3, 
+0x82, 0xAB, 0xE1, 0xEB, 0x57, 0x22, 0x63, 0xB1, 0x27, 0x0D, 0x26, 0x4E, 0x98, 0x27, 0xAF, 0xF1, 
+0x28, 0xA8, 0x17, 0x8B, 0xA1, 0xE8, 0x53, 0x19, 0xCB, 0x34, 0x47, 0x48, 0x49, 0xAC, 0xF4, 0x51, 
+0x83, 0x42, 0x87, 0x71, 0x67, 0x38, 0x0A, 0x14, 0xC7, 0xEA, 0xE7, 0xCF, 0x6E, 0x95, 0xDF, 0xB0, 
+0xA5, 0xBE, 0x1B, 0x62, 0x9B, 0x5A, 0x31, 0x84, 0x72, 0x98, 0xDE, 0xAE, 0x76, 0x4F, 0x9E, 0x26, 
+0x4D, 0xFE, 0xD6, 0x36, 0x8E, 0xD6, 0x4E, 0x34, 0x5B, 0x71, 0x2F, 0x35, 0x97, 0xA1, 0x09, 0x84, 
+0xAB, 0x25, 0x03, 0x21, 0x68, 0x88, 0x79, 0x81, 0x2B, 0x18, 0xD3, 0x1F, 0xF7, 0x15, 0xEF, 0x3A, 
+0x57, 0x29, 0x84, 0x77, 0x3B, 0x3C, 0x4E, 0xD9, 0xC0, 0x24, 0xB5, 0xB4, 0x49, 0x1C, 0x60, 0xD4, 
+0x2C, 0x2A, 0xF5, 0x4C, 0x5A, 0xB5, 0x05, 0x9A, 0x8E, 0xE4, 0x67, 0x3C, 0x86, 0x51, 0x07, 0x21, 
+0x6F, 0xCC, 0x62, 0xAB, 0xB6, 0x5C, 0xAA, 0x6C, 0x76, 0x86, 0xBB, 0x83, 0xE2, 0xFB, 0x1A, 0x1F, 
+0xB3, 0x31, 0xFC, 0xDA, 0x18, 0xCE, 0x80, 0xEB, 0xEA, 0x1F, 0xC9, 0x23, 0xE1, 0x19, 0xB7, 0x04, 
+0x9F, 0x1F, 0x8F, 0x30, 0xD5, 0xD2, 0x62, 0x4C, 0x5D, 0x4A, 0x25, 0x74, 0x6C, 0x13, 0x0B, 0x39, 
+0xBA, 0xA5, 0xB2, 0x02, 0x58, 0x1B, 0xFF, 0x13, 0x7F, 0xA3, 0xFC, 0x15, 0x42, 0x6F, 0x95, 0x17, 
+0x96, 0x77, 0x1A, 0xB8, 0xE9, 0xDA, 0xD6, 0xF0, 0x5B, 0x30, 0xA5, 0xC4, 0x8D, 0x1E, 0xE5, 0x46, 
+0x8B, 0x64, 0xAA, 0xC9, 0xDB, 0xE9, 0x63, 0x08, 0x57, 0x4C, 0x35, 0x38, 0xB0, 0x00, 0x5C, 0xD8, 
+0x5D, 0xAD, 0xFF, 0x61, 0x94, 0x4D, 0xF3, 0x63, 0xCF, 0xE7, 0x07, 0xF0, 0xA0, 0x47, 0xD8, 0xCC, 
+0x53, 0x94, 0x23, 0x8C, 0xAB, 0x97, 0x08, 0x5B, 0x11, 0x94, 0x55, 0xA9, 0x61, 0xC3, 0xB7, 0x1B, 
+0xFA, 0x39, 0x68, 0x04, 0x9D, 0x49, 0xA3, 0x88, 0x0A, 0xAC, 0x36, 0x8E, 0xB1, 0x9C, 0x38, 0x18, 
+0x29, 0xDD, 0xEB, 0xA8, 0x2F, 0x63, 0xDD, 0x5E, 0x04, 0xF1, 0x96, 0x88, 0x42, 0x1B, 0xCA, 0x27, 
+0xCD, 0xBC, 0xF2, 0x69, 0xC4, 0xF8, 0x53, 0x26, 0x02, 0xCB, 0x26, 0x7F, 0xCE, 0x94, 0xEE, 0x22, 
+0xA1, 0xF2, 0x49, 0x26, 0x06, 0x99, 0x89, 0x35, 0x11, 0x4B, 0x1A, 0x32, 0xA2, 0x08, 0x0F, 0x0F, 
+0xBB, 0xCD, 0xFA, 0xDD, 0x16, 0x4B, 0x9D, 0x58, 0x08, 0x20, 0xBF, 0xE8, 0x03, 0x07, 0x88, 0x57, 
+0x61, 0x33, 0x10, 0x24, 0x02, 0xE8, 0x4C, 0xDF, 0x36, 0xE8, 0xF6, 0x61, 0x7D, 0x33, 0x03, 0x9B, 
+0xE6, 0x83, 0x8C, 0xB2, 0xC5, 0x21, 0x7D, 0x45, 0x5D, 0x08, 0x4B, 0x88, 0x3B, 0x1B, 0xF3, 0x07, 
+0x9D, 0x55, 0xDF, 0xC3, 0xA0, 0x21, 0x96, 0x19, 0x29, 0x0A, 0x53, 0x9C, 0x85, 0xB2, 0x92, 0x75, 
+0xA0, 0x20, 0xA0, 0x95, 0x81, 0x20, 0x29, 0x5D, 0x9C, 0xF9, 0x8D, 0xDC, 0x3C, 0x79, 0xD9, 0x15, 
+0x61, 0xE7, 0xE1, 0x67, 0x42, 0x8C, 0xBE, 0x6D, 0x53, 0xD5, 0xBA, 0x81, 0x8A, 0xA3, 0x51, 0x3D, 
+0x2A, 0x38, 0xC7, 0x9C, 0x0A, 0x00
+};
+
+const size_t style_css_len = 4484;
+const size_t style_css_br_len = 3925;
+const size_t style_css_size = 20754; // Uncompressed
+const char style_css_hash[] = "261b31dd";
+
+#endif
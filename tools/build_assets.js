@@ -0,0 +1,315 @@
+#!/usr/bin/env node
+// ==========================================
+// Web Asset Pipeline
+// ==========================================
+// Regenerates the *_html.h / *_js.h / *_css.h headers from the sources in
+// the sketch folder, plus the web_assets.h manifest. Run it after editing
+// any page, script or stylesheet:
+//
+//     node tools/build_assets.js
+//
+// Each asset is minified (conservatively: line trimming and comment
+// removal only, never renaming), compressed with both brotli and gzip and
+// written as PROGMEM arrays with their lengths and a content hash. The
+// server picks the encoding from Accept-Encoding. Output is byte-for-byte
+// reproducible so unchanged assets leave no diff. Only Node built-ins are
+// used.
+//
+// Scripts and stylesheets are served at versioned URLs (/script.<hash>.js)
+// with an immutable cache lifetime; the pages' references to them are
+// rewritten here, so a page's hash changes whenever anything it loads does.
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+const crypto = require('crypto');
+const vm = require('vm');
+
+const ROOT = path.resolve(__dirname, '..');
+
+// source, C identifier, MIME type, minify
+const ASSETS = [
+    { source: 'login.html',  name: 'login_html',  type: 'text/html',              minify: true },
+    { source: 'index.html',  name: 'index_html',  type: 'text/html',              minify: true },
+    { source: 'view.html',   name: 'view_html',   type: 'text/html',              minify: true },
+    { source: 'config.html', name: 'config_html', type: 'text/html',              minify: true },
+    { source: 'style.css',   name: 'style_css',   type: 'text/css',               minify: true },
+    { source: 'script.js',   name: 'script_js',   type: 'application/javascript', minify: true },
+    { source: 'view.js',     name: 'view_js',     type: 'application/javascript', minify: true },
+    { source: 'chart.js',    name: 'chart_js',    type: 'application/javascript', minify: true },
+];
+
+const EOL = '\r\n'; // Sketch sources use CRLF
+
+// ------------------------------------------
+// Minifiers
+// ------------------------------------------
+
+// Returns true if a template literal is still open at the end of the line.
+// Tracks quotes and comments so backticks inside them are not counted.
+function templateOpenAfter(line, insideTemplate) {
+    let quote = insideTemplate ? '`' : null;
+    for (let i = 0; i < line.length; i++) {
+        const c = line[i];
+        if (quote) {
+            if (c === '\\') i++;
+            else if (c === quote) quote = null;
+            continue;
+        }
+        if (c === '/' && line[i + 1] === '/') break;
+        if (c === '/' && line[i + 1] === '*') {
+            const end = line.indexOf('*/', i + 2);
+            if (end < 0) break;
+            i = end + 1;
+            continue;
+        }
+        if (c === '"' || c === '\'' || c === '`') quote = c;
+    }
+    return quote === '`';
+}
+
+// Line-based: trims indentation, drops blank lines and whole-line comments.
+// Lines inside multi-line template literals are kept verbatim.
+function minifyJs(source) {
+    const out = [];
+    let inTemplate = false;
+    let inComment = false;
+    for (const raw of source.split(/\r?\n/)) {
+        if (inTemplate) {
+            out.push(raw);
+            inTemplate = templateOpenAfter(raw, true);
+            continue;
+        }
+        let line = raw.trim();
+        if (inComment) {
+            const end = line.indexOf('*/');
+            if (end < 0) continue;
+            line = line.slice(end + 2).trim();
+            inComment = false;
+        }
+        if (line.startsWith('/*') && !line.startsWith('/*!')) {
+            const end = line.indexOf('*/', 2);
+            if (end < 0) {
+                inComment = true;
+                continue;
+            }
+            line = line.slice(end + 2).trim();
+        }
+        if (line === '' || line.startsWith('//')) continue;
+        out.push(line);
+        inTemplate = templateOpenAfter(line, false);
+    }
+    return out.join('\n');
+}
+
+function minifyCss(source) {
+    return source
+        .replace(/\/\*[\s\S]*?\*\//g, '')
+        .split(/\r?\n/)
+        .map((line) => line.trim())
+        .filter((line) => line !== '')
+        .join('\n');
+}
+
+// Scripts and styles go through their own minifiers; <pre> and <textarea>
+// are left alone since their whitespace is content.
+function minifyHtml(source, file) {
+    const parts = source.split(/(<script\b[^>]*>[\s\S]*?<\/script>|<style\b[^>]*>[\s\S]*?<\/style>|<pre\b[\s\S]*?<\/pre>|<textarea\b[\s\S]*?<\/textarea>)/i);
+    return parts.map((part, i) => {
+        if (i % 2 === 0) {
+            return part
+                .replace(/<!--[\s\S]*?-->/g, '')
+                .split(/\r?\n/)
+                .map((line) => line.trim())
+                .filter((line) => line !== '')
+                .join('\n');
+        }
+        const block = part.match(/^(<(script|style)\b[^>]*>)([\s\S]*?)(<\/\2>)$/i);
+        if (!block) return part;
+        const [, open, tag, body, close] = block;
+        if (tag.toLowerCase() === 'style') return open + '\n' + minifyCss(body) + '\n' + close;
+        const code = minifyJs(body);
+        checkJs(code, file + ' inline script');
+        return open + '\n' + code + '\n' + close;
+    }).filter((part) => part !== '').join('\n');
+}
+
+// The minifier is line-based; refuse to ship a script it broke
+function checkJs(code, label) {
+    try {
+        new vm.Script(code);
+    } catch (err) {
+        throw new Error(label + ': minified output does not parse (' + err.message + ')');
+    }
+}
+
+// "script.js" / '/script.js' -> "/script.<hash>.js"
+function rewriteReferences(text, assets) {
+    for (const asset of assets) {
+        if (!asset.url) continue;
+        const name = asset.source.replace(/[.]/g, '\\.');
+        text = text.replace(new RegExp('(["\'])/?' + name + '\\1', 'g'), '$1' + asset.url + '$1');
+    }
+    return text;
+}
+
+function minify(asset, text) {
+    if (!asset.minify) return text;
+    if (asset.type === 'text/html') return minifyHtml(text, asset.source);
+    if (asset.type === 'text/css') return minifyCss(text);
+    const code = minifyJs(text);
+    checkJs(code, asset.source);
+    return code;
+}
+
+// ------------------------------------------
+// Compression and Output
+// ------------------------------------------
+
+// Fixed header fields (no mtime, unknown OS) keep the output reproducible
+function gzip(data) {
+    const out = zlib.gzipSync(data, { level: zlib.constants.Z_BEST_COMPRESSION });
+    out.writeUInt32LE(0, 4);
+    out[9] = 0xff;
+    return out;
+}
+
+function brotli(data) {
+    return zlib.brotliCompressSync(data, {
+        params: {
+            [zlib.constants.BROTLI_PARAM_MODE]: zlib.constants.BROTLI_MODE_TEXT,
+            [zlib.constants.BROTLI_PARAM_QUALITY]: zlib.constants.BROTLI_MAX_QUALITY,
+            [zlib.constants.BROTLI_PARAM_SIZE_HINT]: data.length,
+        },
+    });
+}
+
+function contentHash(data) {
+    return crypto.createHash('sha256').update(data).digest('hex').slice(0, 8);
+}
+
+// Same layout as the original headers: 16 bytes per line plus a trailing
+// 0x00 that is not counted in the length
+function byteArray(bytes) {
+    const values = Array.from(bytes, (b) => '0x' + b.toString(16).toUpperCase().padStart(2, '0'));
+    values.push('0x00');
+    const lines = [];
+    for (let i = 0; i < values.length; i += 16) {
+        lines.push(values.slice(i, i + 16).join(', '));
+    }
+    return lines.join(', ' + EOL);
+}
+
+function writeIfChanged(file, content) {
+    const target = path.join(ROOT, file);
+    if (fs.existsSync(target) && fs.readFileSync(target, 'utf8') === content) return false;
+    fs.writeFileSync(target, content);
+    return true;
+}
+
+function assetHeader(asset, gz, br, size, hash) {
+    const guard = asset.name.toUpperCase() + '_H_H';
+    return [
+        '#ifndef ' + guard,
+        '#define ' + guard,
+        '',
+        '#include <Arduino.h>',
+        '',
+        '// Generated by tools/build_assets.js from ' + asset.source + ' - do not edit',
+        'const char ' + asset.name + '[] PROGMEM = {',
+        byteArray(gz),
+        '};',
+        '',
+        'const char ' + asset.name + '_br[] PROGMEM = {',
+        byteArray(br),
+        '};',
+        '',
+        'const size_t ' + asset.name + '_len = ' + gz.length + ';',
+        'const size_t ' + asset.name + '_br_len = ' + br.length + ';',
+        'const size_t ' + asset.name + '_size = ' + size + '; // Uncompressed',
+        'const char ' + asset.name + '_hash[] = "' + hash + '";',
+        '',
+        '#endif',
+        '',
+    ].join(EOL);
+}
+
+function manifestHeader(assets) {
+    const lines = [
+        '#ifndef WEB_ASSETS_H',
+        '#define WEB_ASSETS_H',
+        '',
+        '// Generated by tools/build_assets.js - do not edit',
+        '',
+        '#include <Arduino.h>',
+    ];
+    for (const asset of assets) lines.push('#include "' + asset.name + '.h"');
+    lines.push(
+        '',
+        'struct WebAsset {',
+        '    const char* path;        // URL it is served at',
+        '    const char* contentType;',
+        '    const char* gzip;        // PROGMEM',
+        '    size_t gzipLength;',
+        '    const char* brotli;      // PROGMEM',
+        '    size_t brotliLength;',
+        '    size_t size;             // Uncompressed',
+        '    const char* hash;        // First 8 hex digits of SHA-256 of the minified source',
+        '    bool versioned;          // Path carries the hash: cacheable forever',
+        '};',
+        '',
+    );
+    for (const asset of assets) {
+        const n = asset.name;
+        lines.push('const WebAsset ASSET_' + n.toUpperCase() + ' = {"' + (asset.url || '/' + asset.source) + '", "' +
+                   asset.type + '", ' + n + ', ' + n + '_len, ' + n + '_br, ' + n + '_br_len, ' + n + '_size, ' +
+                   n + '_hash, ' + (asset.url ? 'true' : 'false') + '};');
+    }
+    lines.push('', 'const WebAsset* const WEB_ASSETS[] = {');
+    for (const asset of assets) lines.push('    &ASSET_' + asset.name.toUpperCase() + ',');
+    lines.push(
+        '};',
+        'const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);',
+        '',
+        '#endif // WEB_ASSETS_H',
+        '',
+    );
+    return lines.join(EOL);
+}
+
+function main() {
+    const rows = {};
+    // Pages last: they need the versioned URLs of everything they load
+    const pagesLast = ASSETS.filter((a) => a.type !== 'text/html').concat(ASSETS.filter((a) => a.type === 'text/html'));
+    for (const asset of pagesLast) {
+        const source = fs.readFileSync(path.join(ROOT, asset.source), 'utf8');
+        let text = minify(asset, source);
+        if (asset.type === 'text/html') text = rewriteReferences(text, ASSETS);
+
+        const minified = Buffer.from(text, 'utf8');
+        const gz = gzip(minified);
+        const br = brotli(minified);
+        const hash = contentHash(minified);
+        if (asset.type !== 'text/html') {
+            const dot = asset.source.lastIndexOf('.');
+            asset.url = '/' + asset.source.slice(0, dot) + '.' + hash + asset.source.slice(dot);
+        }
+        const changed = writeIfChanged(asset.name + '.h', assetHeader(asset, gz, br, minified.length, hash));
+        rows[asset.source] = [asset.source, Buffer.byteLength(source), minified.length, gz.length, br.length, hash, changed ? 'updated' : ''];
+    }
+    writeIfChanged('web_assets.h', manifestHeader(ASSETS));
+
+    console.log('asset          source  minified      gzip    brotli  hash');
+    const totals = [0, 0, 0, 0];
+    for (const [file, ...row] of ASSETS.map((a) => rows[a.source])) {
+        const [src, min, gz, br, hash, note] = row;
+        console.log(file.padEnd(12) + [src, min, gz, br].map((n) => String(n).padStart(10)).join('').slice(1) +
+                    '  ' + hash + (note ? '  ' + note : ''));
+        [src, min, gz, br].forEach((n, i) => { totals[i] += n; });
+    }
+    console.log('total'.padEnd(12) + totals.map((n) => String(n).padStart(10)).join('').slice(1));
+}
+
+main();
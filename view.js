@@ -1,713 +1,959 @@
-// Configuración
-let chart;
-let tankSparklineChart;
-let lastData = null;
-const maxDataPoints = 24;
-let sensorDataInterval = 5000;  // Default 5s, updated from backend config
-let sensorDataTimeout = null;
-
-window.onload = function() {
-    // Check authentication
-    const isAuthenticated = localStorage.getItem('isAuthenticated');
-    if (!isAuthenticated || isAuthenticated !== 'true') {
-        window.location.href = '/';
-        return;
-    }
-    
-    // Prevent back button from going to login
-    history.replaceState(null, null, window.location.href);
-    window.addEventListener('popstate', function(event) {
-        history.pushState(null, null, window.location.href);
-        const isAuth = localStorage.getItem('isAuthenticated');
-        if (!isAuth || isAuth !== 'true') {
-            window.location.href = '/';
-        }
-    });
-    
-    // Initialize theme
-    initTheme();
-    
-    // Start fetching data IMMEDIATELY
-    if (window.location.protocol === 'file:' || window.location.hostname === 'localhost' || window.location.hostname === '127.0.0.1') {
-        setDemoMode();
-    } else {
-        fetchSensorData();
-    }
-    
-    // Initialize charts asynchronously
-    waitForChart();
-};
-
-function waitForChart() {
-    if (typeof Chart !== 'undefined') {
-        initChart();
-        // If data has already arrived, update the UI immediately
-        if (lastData) {
-            console.log("Charts ready, populating with cached data...");
-            updateUI(lastData);
-        }
-    } else {
-        console.log('Esperando a Chart.js...');
-        setTimeout(waitForChart, 100);
-    }
-}
-
-// Logout function
-function logout() {
-    localStorage.removeItem('isAuthenticated');
-    localStorage.removeItem('username');
-    localStorage.removeItem('isGuest');
-    navigateWithTransition('login.html');
-}
-
-function navigateWithTransition(url) {
-    document.body.classList.add('page-exiting');
-    setTimeout(function() {
-        window.location.href = url;
-    }, 200);
-}
-
-// Theme Management
-function initTheme() {
-    const themeToggleBtn = document.getElementById('theme-toggle-btn');
-    const savedTheme = localStorage.getItem('theme');
-    
-    if (savedTheme === 'dark') {
-        document.body.classList.add('dark-theme');
-        document.documentElement.classList.add('dark-theme');
-        updateThemeIcon(true, false);
-    }
-    
-    themeToggleBtn.addEventListener('click', function() {
-        const willBeDark = !document.body.classList.contains('dark-theme');
-        triggerThemeTransition(willBeDark);
-    });
-}
-
-function triggerThemeTransition(toDark) {
-    const overlay = document.getElementById('theme-transition-overlay');
-    const themeToggleBtn = document.getElementById('theme-toggle-btn');
-    
-    const currentIcon = themeToggleBtn.querySelector('.theme-icon');
-    const newIcon = document.createElementNS('http://www.w3.org/2000/svg', 'svg');
-    newIcon.setAttribute('class', 'theme-icon theme-icon-new');
-    newIcon.setAttribute('viewBox', '0 0 24 24');
-    newIcon.setAttribute('fill', 'none');
-    newIcon.setAttribute('stroke', 'currentColor');
-    newIcon.setAttribute('stroke-width', '2');
-    
-    if (toDark) {
-        newIcon.innerHTML = `<path d="M21 12.79A9 9 0 1 1 11.21 3 7 7 0 0 0 21 12.79z"></path>`;
-        currentIcon.classList.add('sun-setting');
-        newIcon.classList.add('moon-rising');
-    } else {
-        newIcon.innerHTML = `
-            <circle cx="12" cy="12" r="5"></circle>
-            <line x1="12" y1="1" x2="12" y2="3"></line>
-            <line x1="12" y1="21" x2="12" y2="23"></line>
-            <line x1="4.22" y1="4.22" x2="5.64" y2="5.64"></line>
-            <line x1="18.36" y1="18.36" x2="19.78" y2="19.78"></line>
-            <line x1="1" y1="12" x2="3" y2="12"></line>
-            <line x1="21" y1="12" x2="23" y2="12"></line>
-            <line x1="4.22" y1="19.78" x2="5.64" y2="18.36"></line>
-            <line x1="18.36" y1="5.64" x2="19.78" y2="4.22"></line>
-        `;
-        currentIcon.classList.add('moon-setting');
-        newIcon.classList.add('sun-rising');
-    }
-    
-    themeToggleBtn.appendChild(newIcon);
-    overlay.classList.add('active');
-    
-    if (toDark) {
-        document.body.classList.add('dark-theme');
-        document.documentElement.classList.add('dark-theme');
-        document.documentElement.setAttribute('style', 'background-color: #0a0f1e !important;');
-        document.body.setAttribute('style', 'background-color: #0a0f1e !important; color: #ffffff !important;');
-    } else {
-        document.body.classList.remove('dark-theme');
-        document.documentElement.classList.remove('dark-theme');
-        document.documentElement.removeAttribute('style');
-        document.body.removeAttribute('style');
-    }
-    
-    localStorage.setItem('theme', toDark ? 'dark' : 'light');
-    
-    setTimeout(() => {
-        const originalAnimationDuration = chart.options.animation.y.duration;
-        chart.options.animation.y.duration = 0;
-        chart.update('none');
-        setTimeout(() => {
-            chart.options.animation.y.duration = originalAnimationDuration;
-        }, 100);
-    }, 200);
-    
-    setTimeout(() => {
-        overlay.classList.remove('active');
-        currentIcon.remove();
-        newIcon.classList.remove('moon-rising', 'sun-rising', 'sun-setting', 'moon-setting');
-        newIcon.classList.remove('theme-icon-new');
-    }, 400);
-}
-
-function updateThemeIcon(isDark, animate = false) {
-    const themeIcon = document.querySelector('.theme-icon');
-    
-    if (animate) return;
-    
-    if (isDark) {
-        themeIcon.innerHTML = `<path d="M21 12.79A9 9 0 1 1 11.21 3 7 7 0 0 0 21 12.79z"></path>`;
-    } else {
-        themeIcon.innerHTML = `
-            <circle cx="12" cy="12" r="5"></circle>
-            <line x1="12" y1="1" x2="12" y2="3"></line>
-            <line x1="12" y1="21" x2="12" y2="23"></line>
-            <line x1="4.22" y1="4.22" x2="5.64" y2="5.64"></line>
-            <line x1="18.36" y1="18.36" x2="19.78" y2="19.78"></line>
-            <line x1="1" y1="12" x2="3" y2="12"></line>
-            <line x1="21" y1="12" x2="23" y2="12"></line>
-            <line x1="4.22" y1="19.78" x2="5.64" y2="18.36"></line>
-            <line x1="18.36" y1="5.64" x2="19.78" y2="4.22"></line>
-        `;
-    }
-}
-
-// Chart Initialization
-function initChart() {
-    const ctx = document.getElementById('historyChart').getContext('2d');
-    Chart.defaults.font.family = "'Inter', sans-serif";
-    Chart.defaults.color = '#9ca3af';
-    
-    const gradientTemp = ctx.createLinearGradient(0, 0, 0, 400);
-    gradientTemp.addColorStop(0, 'rgba(245, 158, 11, 0.5)');
-    gradientTemp.addColorStop(1, 'rgba(245, 158, 11, 0.1)');
-    const gradientHum = ctx.createLinearGradient(0, 0, 0, 400);
-    gradientHum.addColorStop(0, 'rgba(59, 130, 246, 0.5)');
-    gradientHum.addColorStop(1, 'rgba(59, 130, 246, 0.1)');
-    const gradientSoil = ctx.createLinearGradient(0, 0, 0, 400);
-    gradientSoil.addColorStop(0, 'rgba(16, 185, 129, 0.5)');
-    gradientSoil.addColorStop(1, 'rgba(16, 185, 129, 0.1)');
-    
-    chart = new Chart(ctx, {
-        type: 'line',
-        data: {
-            labels: [],
-            datasets: [
-                { 
-                    label: 'Temp', 
-                    borderColor: '#f59e0b', 
-                    backgroundColor: gradientTemp, 
-                    data: [], 
-                    tension: 0.4, 
-                    fill: true,
-                    pointRadius: 4,
-                    pointHoverRadius: 6,
-                    pointBackgroundColor: '#f59e0b',
-                    pointBorderColor: '#fff',
-                    pointBorderWidth: 2,
-                    borderWidth: 3,
-                    hidden: false 
-                },
-                { 
-                    label: 'Humedad', 
-                    borderColor: '#3b82f6', 
-                    backgroundColor: gradientHum, 
-                    data: [], 
-                    tension: 0.4, 
-                    fill: true,
-                    pointRadius: 4,
-                    pointHoverRadius: 6,
-                    pointBackgroundColor: '#3b82f6',
-                    pointBorderColor: '#fff',
-                    pointBorderWidth: 2,
-                    borderWidth: 3,
-                    hidden: true 
-                },
-                { 
-                    label: 'Suelo', 
-                    borderColor: '#10b981', 
-                    backgroundColor: gradientSoil, 
-                    data: [], 
-                    tension: 0.4, 
-                    fill: true,
-                    pointRadius: 4,
-                    pointHoverRadius: 6,
-                    pointBackgroundColor: '#10b981',
-                    pointBorderColor: '#fff',
-                    pointBorderWidth: 2,
-                    borderWidth: 3,
-                    hidden: true 
-                }
-            ]
-        },
-        options: {
-            responsive: true,
-            maintainAspectRatio: false,
-            plugins: { 
-                legend: { display: false },
-                tooltip: {
-                    mode: 'index',
-                    intersect: false,
-                    backgroundColor: 'rgba(255, 255, 255, 0.9)',
-                    titleColor: '#1f2937',
-                    bodyColor: '#4b5563',
-                    borderColor: '#e5e7eb',
-                    borderWidth: 1,
-                    padding: 12,
-                    cornerRadius: 8,
-                    displayColors: true,
-                    boxPadding: 4
-                }
-            },
-            scales: { 
-                y: { 
-                    grid: { 
-                        display: true,
-                        color: '#f3f4f6',
-                        drawBorder: false
-                    }, 
-                    beginAtZero: true,
-                    ticks: { padding: 10, font: { size: 11 } }
-                },
-                x: { 
-                    grid: { display: false },
-                    ticks: { padding: 10, font: { size: 11 }, maxRotation: 0, autoSkipPadding: 20 }
-                }
-            },
-            interaction: { mode: 'nearest', axis: 'x', intersect: false },
-            layout: { padding: { top: 10, right: 10, bottom: 5, left: 5 } },
-            animation: {
-                duration: 2000,
-                easing: 'easeOutQuart'
-            }
-        }
-    });
-    
-    // Tank Sparkline Chart
-    const tankCtx = document.getElementById('tankSparkline').getContext('2d');
-    const tankGradient = tankCtx.createLinearGradient(0, 0, 0, 160);
-    tankGradient.addColorStop(0, 'rgba(59, 130, 246, 0.6)');
-    tankGradient.addColorStop(1, 'rgba(59, 130, 246, 0.0)');
-
-    tankSparklineChart = new Chart(tankCtx, {
-        type: 'line',
-        data: {
-            labels: [],
-            datasets: [{
-                data: [],
-                borderColor: '#2563eb',
-                backgroundColor: tankGradient,
-                borderWidth: 2,
-                tension: 0.5,
-                fill: true,
-                pointRadius: 4,
-                pointHoverRadius: 6,
-                pointBackgroundColor: '#2563eb',
-                pointBorderColor: '#fff',
-                pointBorderWidth: 2,
-                pointHitRadius: 20,
-            }]
-        },
-        options: {
-            responsive: true,
-            maintainAspectRatio: false,
-            plugins: {
-                legend: { display: false },
-                tooltip: {
-                    enabled: true,
-                    mode: 'index',
-                    intersect: false,
-                    backgroundColor: 'rgba(255, 255, 255, 0.95)',
-                    titleColor: '#1f2937',
-                    bodyColor: '#4b5563',
-                    borderColor: '#e5e7eb',
-                    borderWidth: 1,
-                    padding: 10,
-                    cornerRadius: 8,
-                    displayColors: false,
-                    titleFont: { size: 12, weight: 'bold' },
-                    bodyFont: { size: 13, weight: '600' },
-                    callbacks: {
-                        title: (context) => context[0].label || 'Nivel',
-                        label: (context) => `${context.parsed.y}%`
-                    }
-                }
-            },
-            scales: {
-                y: {
-                    display: true,
-                    position: 'right',
-                    beginAtZero: true,
-                    max: 100,
-                    grid: {
-                        display: true,
-                        color: '#f3f4f6',
-                        drawBorder: false,
-                        tickLength: 0
-                    },
-                    ticks: {
-                        display: true,
-                        font: { size: 10, weight: '500' },
-                        color: '#9ca3af',
-                        padding: 8,
-                        maxTicksLimit: 3,
-                        callback: (value) => value + '%'
-                    }
-                },
-                x: { display: false }
-            },
-            interaction: { mode: 'nearest', axis: 'x', intersect: false },
-            animation: {
-                duration: 2000,
-                easing: 'easeOutQuart'
-            }
-        }
-    });
-}
-
-function showChart(type) {
-    document.querySelectorAll('.interactive-card').forEach(el => {
-        el.classList.remove('active-metric', 'active-temp', 'active-humidity', 'active-soil');
-    });
-    
-    if (typeof chart === 'undefined') return;
-    
-    chart.data.datasets.forEach(ds => ds.hidden = true);
-    chart.update('none');
-    
-    let title = "";
-    let color = "";
-    
-    if (type === 'temp') {
-        chart.data.datasets[0].hidden = false;
-        title = "Gráfico: Temperatura";
-        document.getElementById('card-temp').classList.add('active-metric', 'active-temp');
-        color = "#f59e0b";
-    } else if (type === 'humidity') {
-        chart.data.datasets[1].hidden = false;
-        title = "Gráfico: Humedad";
-        document.getElementById('card-humidity').classList.add('active-metric', 'active-humidity');
-        color = "#3b82f6";
-    } else if (type === 'soil') {
-        chart.data.datasets[2].hidden = false;
-        title = "Gráfico: Suelo";
-        document.getElementById('card-soil').classList.add('active-metric', 'active-soil');
-        color = "#10b981";
-    }
-    
-    document.getElementById('chart-title').innerText = title;
-    document.getElementById('chart-title').style.color = color;
-    
-    chart.options.animation.y = { from: 0 };
-    chart.update();
-}
-
-// Helper for color interpolation
-function interpolateColor(value, min, max, startColor, endColor) {
-    value = Math.max(min, Math.min(max, value));
-    const ratio = (value - min) / (max - min);
-    
-    const parseHex = (hex) => {
-        const r = parseInt(hex.slice(1, 3), 16);
-        const g = parseInt(hex.slice(3, 5), 16);
-        const b = parseInt(hex.slice(5, 7), 16);
-        return [r, g, b];
-    };
-    
-    const [r1, g1, b1] = parseHex(startColor);
-    const [r2, g2, b2] = parseHex(endColor);
-    
-    const r = Math.round(r1 + (r2 - r1) * ratio);
-    const g = Math.round(g1 + (g2 - g1) * ratio);
-    const b = Math.round(b1 + (b2 - b1) * ratio);
-    
-    return `rgb(${r}, ${g}, ${b})`;
-}
-
-// Data Fetching
-function fetchSensorData() {
-    fetch('/data')
-        .then(response => response.json())
-        .then(data => {
-            // Update interval from backend config
-            if (data.config && data.config.serverPollingInterval) {
-                sensorDataInterval = data.config.serverPollingInterval * 1000;
-            }
-            
-            updateUI(data);
-            sensorDataTimeout = setTimeout(fetchSensorData, sensorDataInterval);
-        })
-        .catch(error => {
-            console.error('Error fetching data:', error);
-            sensorDataTimeout = setTimeout(fetchSensorData, sensorDataInterval);
-        });
-}
-
-function updateUI(data) {
-    lastData = data;
-    
-    // If charts aren't ready yet, wait for them
-    if (typeof chart === 'undefined' || typeof tankSparklineChart === 'undefined') {
-        console.log("Charts not ready, deferring UI update...");
-        return;
-    }
-    const isStartup = data.lastMeasurementTime === 0;
-    
-    if (window.wasStartup && !isStartup) {
-        console.log("✅ First measurement received, refreshing UI...");
-        window.lastHistoryLength = null;
-        window.lastHistoryTimestamp = null;
-    }
-    window.wasStartup = isStartup;
-
-    // Update metrics
-    const updateMetric = (id, value, unit = "") => {
-        const el = document.getElementById(id);
-        const unitEl = el.nextElementSibling;
-        
-        if (isStartup) {
-             el.innerHTML = '<span class="status-initializing">Iniciando...</span>';
-             if (unitEl && unitEl.classList.contains('metric-unit')) {
-                unitEl.style.display = 'none';
-             }
-        } else if (value === -999 || value === -999.0) {
-            el.innerHTML = '<span class="error-word">ERROR</span>';
-            if (unitEl && unitEl.classList.contains('metric-unit')) {
-                unitEl.style.display = 'none';
-            }
-        } else {
-            el.innerText = value.toFixed(id === 'temp' ? 1 : 0);
-            
-            // Dynamic Colors
-            if (id === 'temp') {
-                el.style.color = interpolateColor(value, 15, 35, "#3b82f6", "#ef4444");
-            } else if (id === 'humidity') {
-                el.style.color = interpolateColor(value, 30, 90, "#9ca3af", "#2563eb");
-            } else if (id === 'soil') {
-                el.style.color = interpolateColor(value, 0, 100, "#d97706", "#10b981");
-            } else if (id === 'light') {
-                el.style.color = interpolateColor(value, 0, 100, "#1e3a8a", "#facc15");
-            } else {
-                el.style.color = "";
-            }
-            
-            if (unitEl && unitEl.classList.contains('metric-unit')) {
-                unitEl.style.display = '';
-            }
-        }
-    };
-    
-    updateMetric('temp', data.temp, '°C');
-    updateMetric('humidity', data.humidity, '%');
-    updateMetric('soil', data.soilMoisture, '%');
-    updateMetric('light', data.light, '%');
-    
-    // Tank
-    const tankEl = document.getElementById('tank');
-    const tankUnitEl = tankEl.nextElementSibling;
-    const tankWarn = document.getElementById('tank-warning');
-    const tankVisualWrapper = document.querySelector('.tank-visual-wrapper');
-
-    if (isStartup) {
-        tankEl.innerHTML = '<span class="status-initializing">Iniciando...</span>';
-        if (tankUnitEl) tankUnitEl.style.display = 'none';
-        document.getElementById('water-level').style.height = '0%';
-        tankWarn.innerText = "Iniciando sistema...";
-        tankWarn.style.color = "var(--text-secondary)";
-        tankVisualWrapper.style.borderColor = "";
-    } else if (data.tankLevel === -999) {
-        tankEl.innerHTML = '<span class="error-word">ERROR</span>';
-        if (tankUnitEl && tankUnitEl.classList.contains('metric-unit')) {
-            tankUnitEl.style.display = 'none';
-        }
-        document.getElementById('water-level').style.height = '0%';
-        tankWarn.innerText = "⚠️ Error Sensor";
-        tankVisualWrapper.style.borderColor = "#ef4444";
-    } else {
-        tankEl.innerText = data.tankLevel.toFixed(0);
-        tankEl.style.color = "";
-        if (tankUnitEl && tankUnitEl.classList.contains('metric-unit')) {
-            tankUnitEl.style.display = '';
-        }
-        document.getElementById('water-level').style.height = data.tankLevel + '%';
-        
-        tankVisualWrapper.style.borderColor = "";
-
-        if (data.tankPump) {
-            tankVisualWrapper.style.borderColor = "#10b981";
-            tankWarn.innerText = "Llenando...";
-            tankWarn.style.color = "#10b981";
-        } else if (data.tankLevel >= 95) {
-            tankWarn.innerText = "Lleno";
-            tankWarn.style.color = "#6b7280";
-        } else if (data.tankLevel < 20) {
-            tankVisualWrapper.style.borderColor = "#ef4444";
-            tankWarn.innerText = "⚠️ Nivel Crítico";
-            tankWarn.style.color = "#ef4444";
-        } else {
-            tankWarn.innerText = "";
-        }
-    }
-    
-    // System Status
-    const statusDot = document.getElementById('status-dot');
-    const statusText = document.getElementById('status-text');
-    
-    if (data.status === 0) {
-        statusDot.style.backgroundColor = "#166534";
-        statusText.innerText = "Conectado";
-    } else if (data.status === 1) {
-        statusDot.style.backgroundColor = "#ca8a04";
-        statusText.innerText = "Alerta";
-    } else if (data.status === 3) {
-        statusDot.style.backgroundColor = "#ef4444";
-        statusText.innerText = "Error Sensor";
-    } else {
-        statusDot.style.backgroundColor = "#ef4444";
-        statusText.innerText = "Alarma";
-    }
-    
-    // Chart Update from History
-    if (data.history && Array.isArray(data.history)) {
-        const historyChanged = !window.lastHistoryLength || 
-                               window.lastHistoryLength !== data.history.length ||
-                               (data.history.length > 0 && 
-                                (!window.lastHistoryTimestamp || 
-                                 window.lastHistoryTimestamp !== data.history[data.history.length - 1].timestamp));
-        
-        if (historyChanged) {
-            window.lastHistoryLength = data.history.length;
-            if (data.history.length > 0) {
-                window.lastHistoryTimestamp = data.history[data.history.length - 1].timestamp;
-            }
-            
-            // Only update charts if they are initialized
-            if (typeof chart !== 'undefined' && typeof tankSparklineChart !== 'undefined') {
-                updateChartWithHistory(data.history);
-                updateTankSparkline(data.history);
-            }
-        }
-    }
-}
-
-function updateChartWithHistory(history) {
-    chart.data.labels = [];
-    chart.data.datasets[0].data = [];
-    chart.data.datasets[1].data = [];
-    chart.data.datasets[2].data = [];
-    
-    const now = Date.now();
-    const systemNow = lastData ? lastData.lastMeasurementTime : 0;
-    const isEpoch = systemNow > 10000000000;
-    
-    history.forEach((record) => {
-        let label = "";
-        if (record.timestamp !== undefined) {
-            if (isEpoch) {
-                const date = new Date(record.timestamp);
-                label = date.toLocaleTimeString('es-ES', { hour: '2-digit', minute: '2-digit' });
-            } else {
-                const minutesAgo = Math.round((systemNow - record.timestamp) / 60000);
-                label = minutesAgo === 0 ? "Ahora" : `-${minutesAgo}m`;
-            }
-        } else {
-            label = "?";
-        }
-        
-        chart.data.labels.push(label);
-        chart.data.datasets[0].data.push(record.temp !== undefined ? record.temp : null);
-        chart.data.datasets[1].data.push(record.humidity !== undefined ? record.humidity : null);
-        chart.data.datasets[2].data.push(record.soilMoisture !== undefined ? record.soilMoisture : null);
-    });
-    
-    delete chart.options.animation.y;
-    chart.update(); // Animación estándar suave para nuevos puntos
-}
-
-function updateTankSparkline(history) {
-    console.log("Actualizando Sparkline Tanque con", history.length, "puntos");
-    tankSparklineChart.data.labels = [];
-    tankSparklineChart.data.datasets[0].data = [];
-    
-    const systemNow = lastData ? lastData.lastMeasurementTime : 0;
-    const isEpoch = systemNow > 10000000000;
-    
-    history.forEach((record) => {
-        let label = "";
-        if (record.timestamp !== undefined) {
-            if (isEpoch) {
-                const date = new Date(record.timestamp);
-                label = date.toLocaleTimeString('es-ES', { hour: '2-digit', minute: '2-digit' });
-            } else {
-                const minutesAgo = Math.round((systemNow - record.timestamp) / 60000);
-                label = minutesAgo === 0 ? "Ahora" : `-${minutesAgo}m`;
-            }
-        } else {
-            label = "?";
-        }
-        
-        tankSparklineChart.data.labels.push(label);
-        
-        // Robust check for tank level (backend sends 'tank', demo might send 'tankLevel')
-        let val = null;
-        if (record.tank !== undefined) val = record.tank;
-        else if (record.tankLevel !== undefined) val = record.tankLevel;
-        
-        tankSparklineChart.data.datasets[0].data.push(val);
-    });
-    
-    delete tankSparklineChart.options.animation.y;
-    tankSparklineChart.update(); // Animación estándar suave para nuevos puntos
-}
-
-// Demo Mode
-function setDemoMode() {
-    console.log("Demo mode activated");
-    
-    const demoData = {
-        temp: 24.5,
-        humidity: 65,
-        soilMoisture: 45,
-        light: 78,
-        tankLevel: 75,
-        tankPump: false,
-        status: 0,
-        lastMeasurementTime: Date.now(),
-        history: []
-    };
-    
-    // Generate demo history
-    for (let i = 23; i >= 0; i--) {
-        demoData.history.push({
-            timestamp: Date.now() - (i * 10 * 60 * 1000),
-            temp: 22 + Math.random() * 5,
-            humidity: 60 + Math.random() * 15,
-            soilMoisture: 40 + Math.random() * 20,
-            tank: 70 + Math.random() * 15
-        });
-    }
-    
-    updateUI(demoData);
-    
-    // Update demo data periodically
-    setInterval(() => {
-        demoData.temp = 22 + Math.random() * 5;
-        demoData.humidity = 60 + Math.random() * 15;
-        demoData.soilMoisture = 40 + Math.random() * 20;
-        demoData.light = 70 + Math.random() * 20;
-        demoData.tankLevel = Math.max(20, Math.min(95, demoData.tankLevel + (Math.random() - 0.5) * 5));
-        // Round tank level for display consistency in demo data
-        demoData.tankLevel = Math.round(demoData.tankLevel);
-        
-        demoData.history.shift();
-        demoData.history.push({
-            timestamp: Date.now(),
-            temp: demoData.temp,
-            humidity: demoData.humidity,
-            soilMoisture: demoData.soilMoisture,
-            tank: demoData.tankLevel
-        });
-        
-        updateUI(demoData);
-    }, 5000);
-}
+// Configuración
+let chart;
+let tankSparklineChart;
+let lastData = null;
+const maxDataPoints = 24;
+let sensorDataInterval = 5000;  // Default 5s, updated from backend config
+let dataEtag = null; // State version of the last /data response
+let configVersion = null; // Version of the /config copy in use
+let eventsConnected = false; // /events stream is up; polling stays paused
+let configEtag = null;
+let historyRecords = [];  // Local copy of the device history ring
+let historyCursor = null; // Timestamp of the newest record held locally
+let historyVersion = 0;   // Bumped whenever historyRecords changes
+let historyResetAt = 0;   // historyVersion of the last full replace
+let chartVersion = -1;    // historyVersion the charts currently show
+let chartCursor = null;   // Timestamp of the newest record on the charts
+let chartFrame = 0;       // Pending chart sync (requestAnimationFrame id)
+let sensorDataTimeout = null;
+
+window.onload = function() {
+    // Check authentication
+    const isAuthenticated = localStorage.getItem('isAuthenticated');
+    if (!isAuthenticated || isAuthenticated !== 'true') {
+        window.location.href = '/';
+        return;
+    }
+    
+    // Prevent back button from going to login
+    history.replaceState(null, null, window.location.href);
+    window.addEventListener('popstate', function(event) {
+        history.pushState(null, null, window.location.href);
+        const isAuth = localStorage.getItem('isAuthenticated');
+        if (!isAuth || isAuth !== 'true') {
+            window.location.href = '/';
+        }
+    });
+    
+    // Initialize theme
+    initTheme();
+    
+    // Start fetching data IMMEDIATELY
+    if (window.location.protocol === 'file:' || window.location.hostname === 'localhost' || window.location.hostname === '127.0.0.1') {
+        setDemoMode();
+    } else {
+        fetchSensorData();
+        startEventStream(); // Push channel; polling continues only as fallback
+    }
+    
+    // Initialize charts asynchronously
+    waitForChart();
+};
+
+function waitForChart() {
+    if (typeof LineChart !== 'undefined') {
+        const started = performance.now();
+        initChart();
+        console.log('Charts initialized in ' + (performance.now() - started).toFixed(1) + ' ms');
+        // If data has already arrived, update the UI immediately
+        if (lastData) {
+            console.log("Charts ready, populating with cached data...");
+            updateUI(lastData);
+        }
+    } else {
+        console.log('Esperando a chart.js...');
+        setTimeout(waitForChart, 100);
+    }
+}
+
+// Logout function
+function logout() {
+    localStorage.removeItem('isAuthenticated');
+    localStorage.removeItem('username');
+    localStorage.removeItem('isGuest');
+    navigateWithTransition('login.html');
+}
+
+function navigateWithTransition(url) {
+    document.body.classList.add('page-exiting');
+    setTimeout(function() {
+        window.location.href = url;
+    }, 200);
+}
+
+// Theme Management
+function initTheme() {
+    const themeToggleBtn = document.getElementById('theme-toggle-btn');
+    const savedTheme = localStorage.getItem('theme');
+    
+    if (savedTheme === 'dark') {
+        document.body.classList.add('dark-theme');
+        document.documentElement.classList.add('dark-theme');
+        updateThemeIcon(true, false);
+    }
+    
+    themeToggleBtn.addEventListener('click', function() {
+        const willBeDark = !document.body.classList.contains('dark-theme');
+        triggerThemeTransition(willBeDark);
+    });
+}
+
+function triggerThemeTransition(toDark) {
+    const overlay = document.getElementById('theme-transition-overlay');
+    const themeToggleBtn = document.getElementById('theme-toggle-btn');
+    
+    const currentIcon = themeToggleBtn.querySelector('.theme-icon');
+    const newIcon = document.createElementNS('http://www.w3.org/2000/svg', 'svg');
+    newIcon.setAttribute('class', 'theme-icon theme-icon-new');
+    newIcon.setAttribute('viewBox', '0 0 24 24');
+    newIcon.setAttribute('fill', 'none');
+    newIcon.setAttribute('stroke', 'currentColor');
+    newIcon.setAttribute('stroke-width', '2');
+    
+    if (toDark) {
+        newIcon.innerHTML = `<path d="M21 12.79A9 9 0 1 1 11.21 3 7 7 0 0 0 21 12.79z"></path>`;
+        currentIcon.classList.add('sun-setting');
+        newIcon.classList.add('moon-rising');
+    } else {
+        newIcon.innerHTML = `
+            <circle cx="12" cy="12" r="5"></circle>
+            <line x1="12" y1="1" x2="12" y2="3"></line>
+            <line x1="12" y1="21" x2="12" y2="23"></line>
+            <line x1="4.22" y1="4.22" x2="5.64" y2="5.64"></line>
+            <line x1="18.36" y1="18.36" x2="19.78" y2="19.78"></line>
+            <line x1="1" y1="12" x2="3" y2="12"></line>
+            <line x1="21" y1="12" x2="23" y2="12"></line>
+            <line x1="4.22" y1="19.78" x2="5.64" y2="18.36"></line>
+            <line x1="18.36" y1="5.64" x2="19.78" y2="4.22"></line>
+        `;
+        currentIcon.classList.add('moon-setting');
+        newIcon.classList.add('sun-rising');
+    }
+    
+    themeToggleBtn.appendChild(newIcon);
+    overlay.classList.add('active');
+    
+    if (toDark) {
+        document.body.classList.add('dark-theme');
+        document.documentElement.classList.add('dark-theme');
+        document.documentElement.setAttribute('style', 'background-color: #0a0f1e !important;');
+        document.body.setAttribute('style', 'background-color: #0a0f1e !important; color: #ffffff !important;');
+    } else {
+        document.body.classList.remove('dark-theme');
+        document.documentElement.classList.remove('dark-theme');
+        document.documentElement.removeAttribute('style');
+        document.body.removeAttribute('style');
+    }
+    
+    localStorage.setItem('theme', toDark ? 'dark' : 'light');
+    
+    setTimeout(() => {
+        if (typeof chart !== 'undefined') chart.update('none');
+    }, 200);
+    
+    setTimeout(() => {
+        overlay.classList.remove('active');
+        currentIcon.remove();
+        newIcon.classList.remove('moon-rising', 'sun-rising', 'sun-setting', 'moon-setting');
+        newIcon.classList.remove('theme-icon-new');
+    }, 400);
+}
+
+function updateThemeIcon(isDark, animate = false) {
+    const themeIcon = document.querySelector('.theme-icon');
+    
+    if (animate) return;
+    
+    if (isDark) {
+        themeIcon.innerHTML = `<path d="M21 12.79A9 9 0 1 1 11.21 3 7 7 0 0 0 21 12.79z"></path>`;
+    } else {
+        themeIcon.innerHTML = `
+            <circle cx="12" cy="12" r="5"></circle>
+            <line x1="12" y1="1" x2="12" y2="3"></line>
+            <line x1="12" y1="21" x2="12" y2="23"></line>
+            <line x1="4.22" y1="4.22" x2="5.64" y2="5.64"></line>
+            <line x1="18.36" y1="18.36" x2="19.78" y2="19.78"></line>
+            <line x1="1" y1="12" x2="3" y2="12"></line>
+            <line x1="21" y1="12" x2="23" y2="12"></line>
+            <line x1="4.22" y1="19.78" x2="5.64" y2="18.36"></line>
+            <line x1="18.36" y1="5.64" x2="19.78" y2="4.22"></line>
+        `;
+    }
+}
+
+// Chart Initialization
+function initChart() {
+    const ctx = document.getElementById('historyChart').getContext('2d');
+    LineChart.defaults.font.family = "'Inter', sans-serif";
+    LineChart.defaults.color = '#9ca3af';
+    
+    const gradientTemp = ctx.createLinearGradient(0, 0, 0, 400);
+    gradientTemp.addColorStop(0, 'rgba(245, 158, 11, 0.5)');
+    gradientTemp.addColorStop(1, 'rgba(245, 158, 11, 0.1)');
+    const gradientHum = ctx.createLinearGradient(0, 0, 0, 400);
+    gradientHum.addColorStop(0, 'rgba(59, 130, 246, 0.5)');
+    gradientHum.addColorStop(1, 'rgba(59, 130, 246, 0.1)');
+    const gradientSoil = ctx.createLinearGradient(0, 0, 0, 400);
+    gradientSoil.addColorStop(0, 'rgba(16, 185, 129, 0.5)');
+    gradientSoil.addColorStop(1, 'rgba(16, 185, 129, 0.1)');
+    const gradientLight = ctx.createLinearGradient(0, 0, 0, 400);
+    gradientLight.addColorStop(0, 'rgba(251, 191, 36, 0.5)');
+    gradientLight.addColorStop(1, 'rgba(251, 191, 36, 0.1)');
+    
+    chart = new LineChart(ctx, {
+        type: 'line',
+        data: {
+            labels: [],
+            datasets: [
+                { 
+                    label: 'Temp', 
+                    borderColor: '#f59e0b', 
+                    backgroundColor: gradientTemp, 
+                    data: [], 
+                    tension: 0.4, 
+                    fill: true,
+                    pointRadius: 4,
+                    pointHoverRadius: 6,
+                    pointBackgroundColor: '#f59e0b',
+                    pointBorderColor: '#fff',
+                    pointBorderWidth: 2,
+                    borderWidth: 3,
+                    hidden: false 
+                },
+                { 
+                    label: 'Humedad', 
+                    borderColor: '#3b82f6', 
+                    backgroundColor: gradientHum, 
+                    data: [], 
+                    tension: 0.4, 
+                    fill: true,
+                    pointRadius: 4,
+                    pointHoverRadius: 6,
+                    pointBackgroundColor: '#3b82f6',
+                    pointBorderColor: '#fff',
+                    pointBorderWidth: 2,
+                    borderWidth: 3,
+                    hidden: true 
+                },
+                { 
+                    label: 'Suelo', 
+                    borderColor: '#10b981', 
+                    backgroundColor: gradientSoil, 
+                    data: [], 
+                    tension: 0.4, 
+                    fill: true,
+                    pointRadius: 4,
+                    pointHoverRadius: 6,
+                    pointBackgroundColor: '#10b981',
+                    pointBorderColor: '#fff',
+                    pointBorderWidth: 2,
+                    borderWidth: 3,
+                    hidden: true 
+                },
+                { 
+                    label: 'Luminosidad', 
+                    borderColor: '#fbbf24', 
+                    backgroundColor: gradientLight, 
+                    data: [], 
+                    tension: 0.4, 
+                    fill: true,
+                    pointRadius: 4,
+                    pointHoverRadius: 6,
+                    pointBackgroundColor: '#fbbf24',
+                    pointBorderColor: '#fff',
+                    pointBorderWidth: 2,
+                    borderWidth: 3,
+                    hidden: true 
+                }
+            ]
+        },
+        options: {
+            responsive: true,
+            maintainAspectRatio: false,
+            plugins: { 
+                legend: { display: false },
+                tooltip: {
+                    mode: 'index',
+                    intersect: false,
+                    backgroundColor: 'rgba(255, 255, 255, 0.9)',
+                    titleColor: '#1f2937',
+                    bodyColor: '#4b5563',
+                    borderColor: '#e5e7eb',
+                    borderWidth: 1,
+                    padding: 12,
+                    cornerRadius: 8,
+                    displayColors: true,
+                    boxPadding: 4
+                }
+            },
+            scales: { 
+                y: { 
+                    grid: { 
+                        display: true,
+                        color: '#f3f4f6',
+                        drawBorder: false
+                    }, 
+                    beginAtZero: true,
+                    ticks: { padding: 10, font: { size: 11 } }
+                },
+                x: { 
+                    grid: { display: false },
+                    ticks: { padding: 10, font: { size: 11 }, maxRotation: 0, autoSkipPadding: 20 }
+                }
+            },
+            interaction: { mode: 'nearest', axis: 'x', intersect: false },
+            layout: { padding: { top: 10, right: 10, bottom: 5, left: 5 } },
+            animation: {
+                duration: 2000,
+                easing: 'easeOutQuart'
+            }
+        }
+    });
+    
+    // Tank Sparkline Chart
+    const tankCtx = document.getElementById('tankSparkline').getContext('2d');
+    const tankGradient = tankCtx.createLinearGradient(0, 0, 0, 160);
+    tankGradient.addColorStop(0, 'rgba(59, 130, 246, 0.6)');
+    tankGradient.addColorStop(1, 'rgba(59, 130, 246, 0.0)');
+
+    tankSparklineChart = new LineChart(tankCtx, {
+        type: 'line',
+        data: {
+            labels: [],
+            datasets: [{
+                data: [],
+                borderColor: '#2563eb',
+                backgroundColor: tankGradient,
+                borderWidth: 2,
+                tension: 0.5,
+                fill: true,
+                pointRadius: 4,
+                pointHoverRadius: 6,
+                pointBackgroundColor: '#2563eb',
+                pointBorderColor: '#fff',
+                pointBorderWidth: 2,
+                pointHitRadius: 20,
+            }]
+        },
+        options: {
+            responsive: true,
+            maintainAspectRatio: false,
+            plugins: {
+                legend: { display: false },
+                tooltip: {
+                    enabled: true,
+                    mode: 'index',
+                    intersect: false,
+                    backgroundColor: 'rgba(255, 255, 255, 0.95)',
+                    titleColor: '#1f2937',
+                    bodyColor: '#4b5563',
+                    borderColor: '#e5e7eb',
+                    borderWidth: 1,
+                    padding: 10,
+                    cornerRadius: 8,
+                    displayColors: false,
+                    titleFont: { size: 12, weight: 'bold' },
+                    bodyFont: { size: 13, weight: '600' },
+                    callbacks: {
+                        title: (context) => context[0].label || 'Nivel',
+                        label: (context) => `${context.parsed.y}%`
+                    }
+                }
+            },
+            scales: {
+                y: {
+                    display: true,
+                    position: 'right',
+                    beginAtZero: true,
+                    max: 100,
+                    grid: {
+                        display: true,
+                        color: '#f3f4f6',
+                        drawBorder: false,
+                        tickLength: 0
+                    },
+                    ticks: {
+                        display: true,
+                        font: { size: 10, weight: '500' },
+                        color: '#9ca3af',
+                        padding: 8,
+                        maxTicksLimit: 3,
+                        callback: (value) => value + '%'
+                    }
+                },
+                x: { display: false }
+            },
+            interaction: { mode: 'nearest', axis: 'x', intersect: false },
+            animation: {
+                duration: 2000,
+                easing: 'easeOutQuart'
+            }
+        }
+    });
+}
+
+function showChart(type) {
+    document.querySelectorAll('.interactive-card').forEach(el => {
+        el.classList.remove('active-metric', 'active-temp', 'active-humidity', 'active-soil');
+    });
+    
+    if (typeof chart === 'undefined') return;
+    
+    chart.data.datasets.forEach(ds => ds.hidden = true);
+    chart.update('none');
+    
+    let title = "";
+    let color = "";
+    
+    if (type === 'temp') {
+        chart.data.datasets[0].hidden = false;
+        title = "Gráfico: Temperatura";
+        document.getElementById('card-temp').classList.add('active-metric', 'active-temp');
+        color = "#f59e0b";
+    } else if (type === 'humidity') {
+        chart.data.datasets[1].hidden = false;
+        title = "Gráfico: Humedad";
+        document.getElementById('card-humidity').classList.add('active-metric', 'active-humidity');
+        color = "#3b82f6";
+    } else if (type === 'soil') {
+        chart.data.datasets[2].hidden = false;
+        title = "Gráfico: Suelo";
+        document.getElementById('card-soil').classList.add('active-metric', 'active-soil');
+        color = "#10b981";
+    } else if (type === 'light') {
+        chart.data.datasets[3].hidden = false;
+        title = "Gráfico: Luminosidad";
+        document.getElementById('card-light').classList.add('active-metric', 'active-light');
+        color = "#fbbf24";
+    }
+    
+    document.getElementById('chart-title').innerText = title;
+    document.getElementById('chart-title').style.color = color;
+    
+    chart.options.animation.y = { from: 0 };
+    chart.update();
+}
+
+// Helper for color interpolation
+// ------------------------------------------
+// DOM Updates
+// ------------------------------------------
+// updateUI() runs on every poll and pushed event, usually with the same
+// values. Writes go through these helpers, which remember the last value
+// given to each element property and skip the DOM when it is unchanged:
+// a quiet poll then causes no style recalculation, layout or repaint.
+
+const renderedValues = new WeakMap(); // element -> { property: last value }
+
+function changed(el, key, value) {
+    let last = renderedValues.get(el);
+    if (!last) {
+        last = {};
+        renderedValues.set(el, last);
+    }
+    if (last[key] === value) return false;
+    last[key] = value;
+    return true;
+}
+
+function setText(el, text) {
+    if (el && changed(el, 'content', text)) el.innerText = text;
+}
+
+function setHtml(el, html) {
+    if (el && changed(el, 'content', html)) el.innerHTML = html;
+}
+
+function setStyle(el, name, value) {
+    if (el && changed(el, 'style.' + name, value)) el.style[name] = value;
+}
+
+// Gauge colours are recomputed from the same few readings on every poll;
+// the cache is cleared when it fills so slow drift cannot grow it forever
+const colorCache = new Map();
+
+function interpolateColor(value, min, max, startColor, endColor) {
+    const key = value + '|' + min + '|' + max + '|' + startColor + '|' + endColor;
+    let color = colorCache.get(key);
+    if (color === undefined) {
+        if (colorCache.size >= 256) colorCache.clear();
+        color = mixColor(value, min, max, startColor, endColor);
+        colorCache.set(key, color);
+    }
+    return color;
+}
+
+function mixColor(value, min, max, startColor, endColor) {
+    value = Math.max(min, Math.min(max, value));
+    const ratio = (value - min) / (max - min);
+    
+    const parseHex = (hex) => {
+        const r = parseInt(hex.slice(1, 3), 16);
+        const g = parseInt(hex.slice(3, 5), 16);
+        const b = parseInt(hex.slice(5, 7), 16);
+        return [r, g, b];
+    };
+    
+    const [r1, g1, b1] = parseHex(startColor);
+    const [r2, g2, b2] = parseHex(endColor);
+    
+    const r = Math.round(r1 + (r2 - r1) * ratio);
+    const g = Math.round(g1 + (g2 - g1) * ratio);
+    const b = Math.round(b1 + (b2 - b1) * ratio);
+    
+    return `rgb(${r}, ${g}, ${b})`;
+}
+
+// Data Fetching
+// Conditional GET: the server answers 304 while its state version matches.
+// 'no-store' keeps the browser cache from revalidating on its own, so the
+// 304 reaches this code and the UI update can be skipped.
+function conditionalRequest(etag) {
+    return {
+        cache: 'no-store',
+        headers: etag ? { 'If-None-Match': etag } : {}
+    };
+}
+
+// Merges a /data response into the local history copy. Delta responses only
+// carry the records newer than historyCursor; a full one replaces the copy.
+// A delta built against another cursor (a poll crossing a pushed event) is
+// dropped and the full history refetched, instead of appending records
+// twice. historyVersion only moves when the records actually changed.
+function mergeHistory(data) {
+    if (!Array.isArray(data.history)) return;
+    if (data.historyDelta) {
+        if (data.since !== historyCursor) {
+            fetchHistory().catch(error => console.warn('History refetch failed:', error.message));
+        } else if (data.history.length > 0) {
+            historyRecords.push(...data.history);
+            historyVersion++;
+        }
+    } else if (!sameHistory(historyRecords, data.history)) {
+        historyRecords = data.history;
+        historyVersion++;
+        historyResetAt = historyVersion;
+    }
+    if (data.historySize !== undefined && historyRecords.length > data.historySize) {
+        historyRecords.splice(0, historyRecords.length - data.historySize);
+    }
+    historyCursor = historyRecords.length > 0 ? historyRecords[historyRecords.length - 1].timestamp : null;
+    data.history = historyRecords;
+}
+
+// Full responses repeat the whole ring; same ends and length means no change
+function sameHistory(a, b) {
+    if (a.length !== b.length) return false;
+    return a.length === 0 || (a[0].timestamp === b[0].timestamp && a[a.length - 1].timestamp === b[b.length - 1].timestamp);
+}
+
+// Packed history from /history (layout in history_binary.h): a 12-byte
+// header, then one little-endian column per field. Returns the same shape
+// as the JSON history fields of /data, so mergeHistory() takes either.
+function decodeHistory(buffer) {
+    const view = new DataView(buffer);
+    if (view.getUint8(0) !== 1) throw new Error('Unsupported history format ' + view.getUint8(0));
+    const delta = (view.getUint8(1) & 0x01) !== 0;
+    const count = view.getUint16(2, true);
+    let offset = 12;
+    const column = (bytes, read) => {
+        const values = new Array(count);
+        for (let i = 0; i < count; i++) values[i] = read(offset + i * bytes);
+        offset += count * bytes;
+        return values;
+    };
+    // Floats travel as float32; round like the JSON writer does
+    const float = (o) => Math.round(view.getFloat32(o, true) * 100) / 100;
+    const timestamps = column(4, (o) => view.getUint32(o, true));
+    const temp = column(4, float);
+    const humidity = column(4, float);
+    const soil = column(2, (o) => view.getInt16(o, true));
+    const tank = column(2, (o) => view.getInt16(o, true));
+    const light = column(2, (o) => view.getInt16(o, true));
+    const data = {
+        historyDelta: delta,
+        historySize: view.getUint16(4, true),
+        history: timestamps.map((timestamp, i) => ({
+            temp: temp[i], humidity: humidity[i], soil: soil[i], tank: tank[i], light: light[i], timestamp
+        }))
+    };
+    if (delta) data.since = view.getUint32(8, true);
+    return data;
+}
+
+// Full history in the packed format, once per page load; /data polls then
+// only carry deltas. Concurrent callers share one request.
+let historyRequest = null;
+let historyLoaded = false;
+function fetchHistory() {
+    if (!historyRequest) {
+        historyRequest = fetch('/history', { cache: 'no-store', headers: { 'Accept': 'application/octet-stream' } })
+            .then(res => {
+                if (!res.ok) throw new Error('HTTP ' + res.status);
+                return res.arrayBuffer();
+            })
+            .then(buffer => {
+                mergeHistory(decodeHistory(buffer));
+                historyLoaded = true;
+            })
+            .finally(() => { historyRequest = null; });
+    }
+    return historyRequest;
+}
+
+function dataUrl() {
+    return historyCursor !== null ? '/data?since=' + historyCursor : '/data';
+}
+
+// Fetch backend config (polling interval)
+function fetchConfig() {
+    fetch('/config', conditionalRequest(configEtag))
+        .then(response => {
+            if (response.status === 304) return null;
+            configEtag = response.headers.get('ETag');
+            return response.json();
+        })
+        .then(config => {
+            if (!config) return;
+            configVersion = config.version;
+            if (config.serverPollingInterval) {
+                sensorDataInterval = config.serverPollingInterval * 1000;
+            }
+        })
+        .catch(error => console.error('Error fetching config:', error));
+}
+
+// Applies a /data payload (poll response or pushed "data" event)
+function applySensorData(data) {
+    mergeHistory(data);
+
+    // Backend config is served by /config; refetch only when it changed
+    if (data.configVersion !== undefined && data.configVersion !== configVersion) {
+        fetchConfig();
+    }
+    
+    updateUI(data);
+}
+
+// Applies a pushed "state" event on top of the last readings
+function applyStatus(data) {
+    if (!lastData) return;
+    lastData.pump = data.pump;
+    lastData.tankPump = data.tankPump;
+    lastData.status = data.status;
+    lastData.security = data.security;
+    lastData.luminary = data.luminary;
+    lastData.irrigationAuto = data.irrigationAuto;
+    lastData.tankAuto = data.tankAuto;
+    lastData.securityAuto = data.securityAuto;
+    lastData.luminaryAuto = data.luminaryAuto;
+    updateUI(lastData);
+}
+
+// Polling is the fallback: while the event stream is up, nothing is scheduled
+function scheduleSensorPoll() {
+    if (sensorDataTimeout) clearTimeout(sensorDataTimeout);
+    sensorDataTimeout = eventsConnected ? null : setTimeout(fetchSensorData, sensorDataInterval);
+}
+
+// Server-Sent Events: state changes, measurements and alarms are pushed
+function startEventStream() {
+    if (typeof EventSource === 'undefined') return; // Polling only
+
+    const events = new EventSource('/events');
+    events.addEventListener('open', () => {
+        eventsConnected = true;
+        scheduleSensorPoll();
+        fetchSensorData(); // Catch up on anything missed while disconnected
+    });
+    events.addEventListener('state', e => applyStatus(JSON.parse(e.data)));
+    events.addEventListener('data', e => applySensorData(JSON.parse(e.data)));
+    events.addEventListener('resync', () => fetchSensorData());
+    events.addEventListener('error', () => {
+        // EventSource reconnects by itself; poll until it does
+        if (!eventsConnected) return;
+        eventsConnected = false;
+        fetchSensorData();
+    });
+}
+
+function fetchSensorData() {
+    if (sensorDataTimeout) clearTimeout(sensorDataTimeout);
+    // The first poll loads the history packed, so /data only adds a delta.
+    // Firmware without /history just gets the JSON history from /data.
+    const ready = historyLoaded ? Promise.resolve() : fetchHistory().catch(error => console.warn('Packed history unavailable:', error.message));
+    ready
+        .then(() => fetch(dataUrl(), conditionalRequest(dataEtag)))
+        .then(response => {
+            if (response.status === 304) return null; // Nothing changed since last poll
+            dataEtag = response.headers.get('ETag');
+            return response.json();
+        })
+        .then(data => {
+            if (data) applySensorData(data);
+            scheduleSensorPoll();
+        })
+        .catch(error => {
+            console.error('Error fetching data:', error);
+            dataEtag = null;
+            scheduleSensorPoll();
+        });
+}
+
+function updateUI(data) {
+    lastData = data;
+    
+    // If charts aren't ready yet, wait for them
+    if (typeof chart === 'undefined' || typeof tankSparklineChart === 'undefined') {
+        console.log("Charts not ready, deferring UI update...");
+        return;
+    }
+    const isStartup = data.lastMeasurementTime === 0;
+    
+    if (window.wasStartup && !isStartup) {
+        console.log("✅ First measurement received, refreshing UI...");
+        chartVersion = -1; // Rebuild the charts with real timestamps
+    }
+    window.wasStartup = isStartup;
+
+    // Update metrics
+    const updateMetric = (id, value) => {
+        const el = document.getElementById(id);
+        const unitEl = el.nextElementSibling;
+        const hasUnit = unitEl && unitEl.classList.contains('metric-unit');
+        
+        if (isStartup) {
+            setHtml(el, '<span class="status-initializing">Iniciando...</span>');
+            if (hasUnit) setStyle(unitEl, 'display', 'none');
+        } else if (value === -999 || value === -999.0) {
+            setHtml(el, '<span class="error-word">ERROR</span>');
+            if (hasUnit) setStyle(unitEl, 'display', 'none');
+        } else {
+            setText(el, value.toFixed(id === 'temp' ? 1 : 0));
+            
+            // Dynamic Colors
+            if (id === 'temp') {
+                setStyle(el, 'color', interpolateColor(value, 15, 35, "#3b82f6", "#ef4444"));
+            } else if (id === 'humidity') {
+                setStyle(el, 'color', interpolateColor(value, 30, 90, "#9ca3af", "#2563eb"));
+            } else if (id === 'soil') {
+                setStyle(el, 'color', interpolateColor(value, 0, 100, "#d97706", "#10b981"));
+            } else if (id === 'light') {
+                setStyle(el, 'color', interpolateColor(value, 0, 100, "#1e3a8a", "#facc15"));
+            } else {
+                setStyle(el, 'color', "");
+            }
+            
+            if (hasUnit) setStyle(unitEl, 'display', '');
+        }
+    };
+    
+    updateMetric('temp', data.temp);
+    updateMetric('humidity', data.humidity);
+    updateMetric('soil', data.soilMoisture);
+    updateMetric('light', data.light);
+    
+    // Tank
+    const tankEl = document.getElementById('tank');
+    const tankUnitEl = tankEl.nextElementSibling;
+    const tankWarn = document.getElementById('tank-warning');
+    const tankVisualWrapper = document.querySelector('.tank-visual-wrapper');
+    const waterLevel = document.getElementById('water-level');
+
+    if (isStartup) {
+        setHtml(tankEl, '<span class="status-initializing">Iniciando...</span>');
+        if (tankUnitEl) setStyle(tankUnitEl, 'display', 'none');
+        setStyle(waterLevel, 'height', '0%');
+        setText(tankWarn, "Iniciando sistema...");
+        setStyle(tankWarn, 'color', "var(--text-secondary)");
+        setStyle(tankVisualWrapper, 'borderColor', "");
+    } else if (data.tankLevel === -999) {
+        setHtml(tankEl, '<span class="error-word">ERROR</span>');
+        if (tankUnitEl && tankUnitEl.classList.contains('metric-unit')) {
+            setStyle(tankUnitEl, 'display', 'none');
+        }
+        setStyle(waterLevel, 'height', '0%');
+        setText(tankWarn, "⚠️ Error Sensor");
+        setStyle(tankVisualWrapper, 'borderColor', "#ef4444");
+    } else {
+        setText(tankEl, data.tankLevel.toFixed(0));
+        setStyle(tankEl, 'color', "");
+        if (tankUnitEl && tankUnitEl.classList.contains('metric-unit')) {
+            setStyle(tankUnitEl, 'display', '');
+        }
+        setStyle(waterLevel, 'height', data.tankLevel + '%');
+
+        if (data.tankPump) {
+            setStyle(tankVisualWrapper, 'borderColor', "#10b981");
+            setText(tankWarn, "Llenando...");
+            setStyle(tankWarn, 'color', "#10b981");
+        } else if (data.tankLevel >= 95) {
+            setStyle(tankVisualWrapper, 'borderColor', "");
+            setText(tankWarn, "Lleno");
+            setStyle(tankWarn, 'color', "#6b7280");
+        } else if (data.tankLevel < 20) {
+            setStyle(tankVisualWrapper, 'borderColor', "#ef4444");
+            setText(tankWarn, "⚠️ Nivel Crítico");
+            setStyle(tankWarn, 'color', "#ef4444");
+        } else {
+            setStyle(tankVisualWrapper, 'borderColor', "");
+            setText(tankWarn, "");
+        }
+    }
+    
+    // System Status
+    const statusDot = document.getElementById('status-dot');
+    const statusText = document.getElementById('status-text');
+    
+    if (data.status === 0) {
+        setStyle(statusDot, 'backgroundColor', "#166534");
+        setText(statusText, "Conectado");
+    } else if (data.status === 1) {
+        setStyle(statusDot, 'backgroundColor', "#ca8a04");
+        setText(statusText, "Alerta");
+    } else if (data.status === 3) {
+        setStyle(statusDot, 'backgroundColor', "#ef4444");
+        setText(statusText, "Error Sensor");
+    } else {
+        setStyle(statusDot, 'backgroundColor', "#ef4444");
+        setText(statusText, "Alarma");
+    }
+    
+    // Charts follow historyRecords: redraw only when it changed, batched
+    // into the next animation frame
+    if (historyVersion !== chartVersion) scheduleChartSync();
+}
+
+// ------------------------------------------
+// Charts from History
+// ------------------------------------------
+// After a full replace the charts are rebuilt; otherwise only the records
+// past chartCursor are appended and the oldest dropped. Labels are relative
+// ("-5m") so they are recomputed on every sync; that is string work only.
+
+const CHART_FIELDS = ['temp', 'humidity', 'soil', 'light']; // Dataset order
+
+function scheduleChartSync() {
+    if (chartFrame) return;
+    chartFrame = requestAnimationFrame(() => {
+        chartFrame = 0;
+        syncCharts();
+    });
+}
+
+// Missing readings leave a gap instead of dragging the line to -999
+function chartValue(value) {
+    return value === undefined || value === -999 ? null : value;
+}
+
+// Backend sends 'tank', demo data might send 'tankLevel'
+function tankValue(record) {
+    return chartValue(record.tank !== undefined ? record.tank : record.tankLevel);
+}
+
+function historyLabels() {
+    const systemNow = lastData ? lastData.lastMeasurementTime : 0;
+    const isEpoch = systemNow > 10000000000;
+    return historyRecords.map((record) => {
+        if (record.timestamp === undefined) return "?";
+        if (isEpoch) {
+            return new Date(record.timestamp).toLocaleTimeString('es-ES', { hour: '2-digit', minute: '2-digit' });
+        }
+        const minutesAgo = Math.round((systemNow - record.timestamp) / 60000);
+        return minutesAgo === 0 ? "Ahora" : `-${minutesAgo}m`;
+    });
+}
+
+function syncCharts() {
+    if (typeof chart === 'undefined' || typeof tankSparklineChart === 'undefined' || chartVersion === historyVersion) return;
+    const count = historyRecords.length;
+
+    // Records after the chart's newest one, if the charts are still a prefix
+    let start = -1;
+    if (chartVersion >= historyResetAt && chartCursor !== null) {
+        for (let i = count - 1; i >= 0; i--) {
+            if (historyRecords[i].timestamp === chartCursor) {
+                start = i + 1;
+                break;
+            }
+        }
+        if (start > chart.data.labels.length) start = -1;
+    }
+
+    if (start < 0) {
+        CHART_FIELDS.forEach((field, i) => {
+            chart.data.datasets[i].data = historyRecords.map(record => chartValue(record[field]));
+        });
+        tankSparklineChart.data.datasets[0].data = historyRecords.map(tankValue);
+    } else {
+        for (let i = start; i < count; i++) {
+            const record = historyRecords[i];
+            chart.append('', CHART_FIELDS.map(field => chartValue(record[field])), count);
+            tankSparklineChart.append('', [tankValue(record)], count);
+        }
+    }
+    const labels = historyLabels();
+    chart.data.labels = labels;
+    tankSparklineChart.data.labels = labels.slice();
+
+    chartVersion = historyVersion;
+    chartCursor = count > 0 ? historyRecords[count - 1].timestamp : null;
+    delete chart.options.animation.y;
+    chart.update(); // Only new points animate in, the rest slide over
+    delete tankSparklineChart.options.animation.y;
+    tankSparklineChart.update();
+}
+
+function setDemoMode() {
+    console.log("Demo mode activated");
+    
+    const demoData = {
+        temp: 24.5,
+        humidity: 65,
+        soilMoisture: 45,
+        light: 78,
+        tankLevel: 75,
+        tankPump: false,
+        status: 0,
+        lastMeasurementTime: Date.now(),
+        history: [],
+        historySize: maxDataPoints
+    };
+    
+    // Generate demo history
+    for (let i = 23; i >= 0; i--) {
+        demoData.history.push({
+            timestamp: Date.now() - (i * 10 * 60 * 1000),
+            temp: 22 + Math.random() * 5,
+            humidity: 60 + Math.random() * 15,
+            soil: 40 + Math.random() * 20,
+            tank: 70 + Math.random() * 15
+        });
+    }
+    
+    mergeHistory(demoData);
+    updateUI(demoData);
+    
+    // Update demo data periodically
+    setInterval(() => {
+        demoData.temp = 22 + Math.random() * 5;
+        demoData.humidity = 60 + Math.random() * 15;
+        demoData.soilMoisture = 40 + Math.random() * 20;
+        demoData.light = 70 + Math.random() * 20;
+        demoData.tankLevel = Math.max(20, Math.min(95, demoData.tankLevel + (Math.random() - 0.5) * 5));
+        // Round tank level for display consistency in demo data
+        demoData.tankLevel = Math.round(demoData.tankLevel);
+        
+        // New record as a delta, the way the device sends it
+        demoData.history = [{
+            timestamp: Date.now(),
+            temp: demoData.temp,
+            humidity: demoData.humidity,
+            soil: demoData.soilMoisture,
+            tank: demoData.tankLevel
+        }];
+        demoData.historyDelta = true;
+        mergeHistory(demoData); // Keeps the last maxDataPoints
+        updateUI(demoData);
+    }, 5000);
+}
@@ -1,232 +1,357 @@
-#ifndef VIEW_HTML_H_H
-#define VIEW_HTML_H_H
-
-#include <Arduino.h>
-
-const char view_html[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xDD, 0x5B, 0xEF, 0x6E, 0xDB, 0xC8, 
-0x11, 0xFF, 0x5E, 0xA0, 0xEF, 0xB0, 0xE1, 0x21, 0xB5, 0x7C, 0x30, 0x69, 0x91, 0x96, 0x64, 0xD9, 
-0x91, 0x84, 0xE6, 0x1C, 0x5F, 0x13, 0x20, 0xC1, 0x05, 0x67, 0xF7, 0xDA, 0xFB, 0xB8, 0x22, 0x57, 
-0xD2, 0xD6, 0x14, 0xA9, 0x2E, 0x97, 0xB2, 0x75, 0x77, 0x79, 0x91, 0x7E, 0xEB, 0x03, 0x14, 0x38, 
-0xA0, 0x6F, 0x70, 0x79, 0xB1, 0xCE, 0xEC, 0x92, 0x12, 0xFF, 0x8B, 0x72, 0x9C, 0x1C, 0x50, 0x5E, 
-0x70, 0x22, 0xB9, 0xCB, 0xD9, 0x99, 0xDF, 0xCC, 0xCE, 0xCE, 0xEC, 0xAC, 0x47, 0xCF, 0x5E, 0x7D, 
-0x77, 0x75, 0xFB, 0xE3, 0xFB, 0x6B, 0xB2, 0x90, 0x4B, 0x7F, 0xF2, 0xC7, 0x3F, 0x8C, 0xF0, 0x97, 
-0xF8, 0x34, 0x98, 0x8F, 0x0D, 0x16, 0x19, 0xEA, 0x0D, 0xA3, 0x1E, 0xFC, 0x12, 0xB8, 0x46, 0x4B, 
-0x26, 0x29, 0x71, 0x17, 0x54, 0x44, 0x4C, 0x8E, 0x8D, 0xBF, 0xDE, 0x7E, 0x6B, 0x0E, 0x8D, 0x5C, 
-0x5B, 0x40, 0x97, 0x6C, 0x6C, 0xAC, 0x39, 0xBB, 0x5F, 0x85, 0x42, 0x1A, 0xC4, 0x0D, 0x03, 0xC9, 
-0x02, 0xE8, 0x7B, 0xCF, 0x3D, 0xB9, 0x18, 0x7B, 0x6C, 0xCD, 0x5D, 0x66, 0xAA, 0x87, 0x13, 0xC2, 
-0x03, 0x2E, 0x39, 0xF5, 0xCD, 0xC8, 0xA5, 0x3E, 0x1B, 0xDB, 0x56, 0x77, 0x4B, 0x4B, 0x72, 0xE9, 
-0xB3, 0xC9, 0x7B, 0x1A, 0x30, 0x9F, 0x78, 0x8C, 0xFC, 0xC0, 0xA3, 0x98, 0xFA, 0xFC, 0x27, 0xEA, 
-0xF2, 0x8F, 0xFF, 0x0D, 0x88, 0x49, 0xDE, 0x04, 0x6B, 0x26, 0x02, 0xEA, 0x31, 0x11, 0x8E, 0x4E, 
-0x75, 0xE7, 0xE4, 0xCB, 0xC8, 0x15, 0x7C, 0x25, 0x93, 0x27, 0xBC, 0x4E, 0x4F, 0xC9, 0xCB, 0xD5, 
-0xCA, 0xDF, 0x10, 0xB9, 0x60, 0x4B, 0x46, 0xDE, 0xBC, 0x7B, 0x77, 0xFD, 0xEA, 0xCD, 0xCB, 0xDB, 
-0xEB, 0xB7, 0x3F, 0x92, 0x29, 0x9B, 0x85, 0x82, 0x11, 0x1A, 0x6C, 0xE4, 0x82, 0x07, 0x73, 0xC2, 
-0xFC, 0x88, 0x11, 0x19, 0x92, 0x95, 0x60, 0x6B, 0x60, 0x9A, 0xCC, 0x7C, 0x1A, 0x2D, 0x76, 0x94, 
-0x3A, 0xB3, 0x38, 0x70, 0x25, 0x0F, 0x83, 0xCE, 0x31, 0xF9, 0x79, 0xF7, 0x1A, 0x2F, 0x29, 0x36, 
-0xC5, 0x57, 0x78, 0x81, 0xF4, 0x91, 0x24, 0x11, 0x5D, 0x33, 0xEF, 0x56, 0x8D, 0x3E, 0x26, 0x7E, 
-0x08, 0xC2, 0xDE, 0xC8, 0x50, 0xD0, 0x39, 0xB3, 0xE6, 0x4C, 0xBE, 0x91, 0x6C, 0xD9, 0x39, 0x52, 
-0xBC, 0x1D, 0x1D, 0xBF, 0x28, 0x93, 0xE0, 0x33, 0xD2, 0xC9, 0x12, 0x18, 0x8F, 0xC9, 0x91, 0x47, 
-0xC5, 0xDD, 0x51, 0x89, 0x87, 0xF4, 0xF2, 0x42, 0x37, 0x5E, 0x02, 0xFB, 0x56, 0x7A, 0x73, 0xED, 
-0x33, 0xF5, 0xEC, 0x82, 0x38, 0xD1, 0x5B, 0x1E, 0x49, 0x8B, 0x7A, 0x5E, 0x47, 0x51, 0x31, 0xEB, 
-0x07, 0x6E, 0x24, 0x05, 0xEA, 0x7F, 0x29, 0xA5, 0xE0, 0xD3, 0x58, 0xB2, 0xCE, 0x51, 0x24, 0x37, 
-0x3E, 0x3B, 0x3A, 0x21, 0x47, 0x53, 0xEA, 0xDE, 0xCD, 0x45, 0x18, 0x07, 0x9E, 0xE9, 0x86, 0x7E, 
-0x28, 0x2E, 0xC9, 0x57, 0x5D, 0xDA, 0x9D, 0xD9, 0x8C, 0x3C, 0xE3, 0x4B, 0x34, 0x08, 0x1A, 0xC8, 
-0x17, 0xB5, 0xA3, 0xA1, 0xA8, 0xDB, 0x11, 0xA7, 0xA1, 0xB7, 0xA9, 0x15, 0x31, 0xC7, 0x1B, 0xF6, 
-0x7C, 0x84, 0x6C, 0x65, 0x1A, 0x9F, 0x22, 0x14, 0x49, 0x9B, 0x66, 0xEA, 0x6A, 0x25, 0xEF, 0x07, 
-0x6D, 0x70, 0x6D, 0x64, 0x04, 0xA1, 0xAE, 0xD1, 0x24, 0x51, 0x42, 0x16, 0x30, 0xD1, 0x39, 0x7A, 
-0xF5, 0xDD, 0xBB, 0x2B, 0x3D, 0xB7, 0xDE, 0x86, 0x30, 0x0F, 0x3C, 0xE0, 0xB4, 0xDE, 0x3C, 0x3F, 
-0x07, 0x76, 0xBF, 0x3F, 0x7E, 0x0A, 0xC3, 0x5A, 0x70, 0xCB, 0xAF, 0x0B, 0xAF, 0x3E, 0x10, 0x97, 
-0x4A, 0x77, 0xD1, 0x61, 0x95, 0x70, 0xE1, 0xD4, 0x0D, 0x7D, 0x66, 0x31, 0x21, 0x42, 0x80, 0xFB, 
-0x1A, 0x7F, 0x08, 0x45, 0x47, 0x82, 0x9E, 0x42, 0xC1, 0x73, 0x09, 0xD2, 0xB1, 0xE2, 0xF8, 0x99, 
-0x41, 0x3E, 0x1C, 0x77, 0xD2, 0xD6, 0xD1, 0x69, 0xCE, 0x2F, 0x8D, 0x14, 0x38, 0x59, 0x27, 0xF5, 
-0x35, 0xB9, 0x12, 0xE0, 0x0C, 0xC1, 0x37, 0x24, 0x7E, 0x4A, 0xF5, 0x88, 0xC8, 0xD7, 0xA7, 0xBB, 
-0x4E, 0xCA, 0x35, 0xFF, 0x4C, 0x2A, 0xF0, 0x9C, 0x9D, 0xCD, 0x7A, 0xB3, 0x41, 0x0E, 0x4F, 0x29, 
-0x68, 0x10, 0x71, 0x34, 0x87, 0xCB, 0xD2, 0x17, 0xA4, 0x6B, 0xF5, 0x23, 0xC2, 0x68, 0xC4, 0x5E, 
-0x64, 0xF9, 0x45, 0xFA, 0xD6, 0x4E, 0xFB, 0xD5, 0x43, 0x55, 0xA8, 0x2E, 0x43, 0x02, 0xED, 0xA0, 
-0x35, 0x8B, 0x69, 0x93, 0x3D, 0x73, 0x2E, 0xCE, 0xCE, 0xDB, 0xB2, 0x7C, 0x42, 0x0E, 0x91, 0xA1, 
-0x9E, 0xA1, 0x83, 0x6C, 0x30, 0x3B, 0x44, 0x4E, 0x6B, 0xAF, 0x60, 0xA8, 0x44, 0x63, 0x21, 0x2C, 
-0x49, 0x82, 0x7B, 0x15, 0x4A, 0xCB, 0x32, 0x64, 0xB9, 0x54, 0x78, 0x39, 0x8E, 0x2E, 0x89, 0xCF, 
-0x03, 0x46, 0x85, 0x39, 0x17, 0xD4, 0xE3, 0x30, 0x9B, 0x3A, 0xF6, 0x59, 0xDF, 0x63, 0xF3, 0x13, 
-0x40, 0xC6, 0xB6, 0x87, 0xCE, 0x39, 0xE9, 0x3E, 0x87, 0x7B, 0xE0, 0xF6, 0xDC, 0xA1, 0xC4, 0xEE, 
-0x76, 0x9F, 0x1F, 0xE7, 0x58, 0x9B, 0x86, 0x02, 0xD6, 0xC1, 0xAD, 0x5C, 0x36, 0x03, 0x34, 0xA7, 
-0x8F, 0x90, 0xAB, 0xC8, 0x29, 0xAE, 0xFB, 0x4C, 0x7C, 0x61, 0x56, 0x1B, 0xF8, 0xB1, 0xA0, 0xC7, 
-0x9D, 0xB9, 0x56, 0xA1, 0x80, 0x79, 0x2F, 0x60, 0x2E, 0x1E, 0xC0, 0x9D, 0x1E, 0xE9, 0x20, 0xEE, 
-0x7A, 0xE7, 0xFD, 0xFE, 0xE0, 0xA2, 0x35, 0x77, 0x18, 0x15, 0xC9, 0x43, 0xF9, 0x4A, 0x78, 0x51, 
-0x7C, 0x25, 0x3C, 0x96, 0xF9, 0x6A, 0x1A, 0x35, 0xDA, 0xC0, 0x82, 0xB0, 0x34, 0x23, 0x49, 0x65, 
-0x1C, 0xB5, 0x1E, 0x75, 0xD0, 0x63, 0x5B, 0x34, 0x7A, 0xE7, 0xC3, 0xFE, 0xF9, 0x7E, 0x34, 0xBA, 
-0xFD, 0x8B, 0xC1, 0x01, 0x68, 0xE4, 0xF9, 0x8A, 0x56, 0x34, 0x00, 0xE6, 0x52, 0x5A, 0x9E, 0x3D, 
-0xA3, 0xAC, 0xDF, 0x9A, 0x16, 0x04, 0x96, 0x82, 0xBB, 0xE6, 0x9A, 0xFA, 0x31, 0x6B, 0x2B, 0x62, 
-0x62, 0xEA, 0x4A, 0x44, 0x77, 0xEA, 0xF5, 0x99, 0x5D, 0x21, 0xA2, 0x79, 0xCF, 0xA6, 0x77, 0x5C, 
-0x9A, 0x59, 0xEF, 0xE0, 0xF3, 0xD5, 0x25, 0x91, 0xEC, 0x41, 0x56, 0xF6, 0xC4, 0x06, 0x73, 0xC6, 
-0x7D, 0x3F, 0xC5, 0x45, 0xF9, 0xAC, 0x15, 0x15, 0x18, 0x2E, 0xE6, 0xD0, 0xDB, 0x4B, 0xB2, 0xD1, 
-0x96, 0xC0, 0x47, 0x98, 0x2A, 0xAC, 0x3D, 0x29, 0x37, 0x4E, 0x61, 0x48, 0x4F, 0x41, 0x5A, 0xD1, 
-0x98, 0x60, 0x35, 0x0B, 0x43, 0xC9, 0x44, 0x7D, 0x7B, 0x0C, 0x91, 0x77, 0x46, 0x21, 0x09, 0x42, 
-0xAD, 0x27, 0x22, 0xFE, 0x98, 0x32, 0x9C, 0xCF, 0x7D, 0x66, 0x4E, 0x65, 0x50, 0x50, 0x4A, 0xD5, 
-0xBC, 0xFE, 0xB4, 0xB9, 0x55, 0x1A, 0x30, 0x79, 0xC3, 0x61, 0x95, 0xCE, 0x88, 0xC1, 0x1C, 0x36, 
-0x9C, 0x75, 0x5B, 0x53, 0xF5, 0xC3, 0x79, 0x18, 0xCB, 0x0A, 0x01, 0x6A, 0xAD, 0xCA, 0x73, 0x9D, 
-0x81, 0x33, 0xD0, 0x56, 0x35, 0xBD, 0xB0, 0x5D, 0xDB, 0x3D, 0x70, 0xBA, 0x72, 0x88, 0xD8, 0x04, 
-0x85, 0x28, 0x6D, 0xCD, 0x4C, 0x54, 0xB2, 0x95, 0xDC, 0xC3, 0x5C, 0x59, 0x21, 0x13, 0x79, 0x94, 
-0x66, 0xFD, 0x0B, 0xD6, 0x9D, 0xD6, 0xD8, 0x55, 0x03, 0x9B, 0x3D, 0xC7, 0xE9, 0x76, 0x13, 0x36, 
-0xCF, 0x60, 0xB2, 0x75, 0x87, 0x4F, 0xC4, 0xE6, 0x22, 0x5E, 0x72, 0x8F, 0xCB, 0x4D, 0x99, 0xD5, 
-0xB3, 0xE9, 0xD0, 0x29, 0x2C, 0xEF, 0x2D, 0x1D, 0xF3, 0x19, 0xED, 0x27, 0xF3, 0xD4, 0xA6, 0x0E, 
-0xEB, 0x55, 0x39, 0xE6, 0xC7, 0xB0, 0x1A, 0x85, 0xDC, 0x2F, 0xB3, 0x69, 0x77, 0xA7, 0x17, 0x43, 
-0xFB, 0x70, 0x36, 0x73, 0x1E, 0xB3, 0x7F, 0xE6, 0x39, 0xB3, 0x03, 0xD9, 0xD4, 0x8B, 0xA9, 0x09, 
-0xA1, 0xB1, 0x84, 0xC0, 0x72, 0xC7, 0x98, 0xCF, 0x66, 0x72, 0xCF, 0xAC, 0xC8, 0xC5, 0x1B, 0x3F, 
-0x40, 0x66, 0x4D, 0xDE, 0x43, 0xEE, 0x48, 0x6E, 0x56, 0xCC, 0xE5, 0x33, 0xEE, 0x92, 0xB7, 0x74, 
-0x03, 0x66, 0x9C, 0x0B, 0x3A, 0x2C, 0x58, 0x84, 0x4C, 0x4C, 0xBD, 0x29, 0x08, 0x24, 0x8A, 0xE1, 
-0xAD, 0xC7, 0xA3, 0x95, 0x4F, 0x37, 0x97, 0x90, 0xDF, 0xB2, 0x87, 0x42, 0xF8, 0x8A, 0xAF, 0x4C, 
-0x8F, 0x0B, 0xE6, 0xEA, 0x38, 0x0C, 0x58, 0x8B, 0x97, 0x41, 0xA1, 0xD3, 0x9C, 0x82, 0x43, 0x73, 
-0x7A, 0xAB, 0xE2, 0xC7, 0x4B, 0xFA, 0xA0, 0x53, 0xFB, 0x4B, 0x62, 0xF7, 0xBA, 0xDD, 0x8A, 0x76, 
-0x31, 0xE7, 0x40, 0xB4, 0x4B, 0x68, 0x2C, 0xC3, 0x42, 0xE3, 0x0A, 0x92, 0x0F, 0x08, 0xAD, 0x4B, 
-0x84, 0x8B, 0x08, 0x7C, 0x1B, 0x0A, 0x97, 0x91, 0x5E, 0xC2, 0x59, 0x44, 0x20, 0x85, 0x27, 0xDA, 
-0xAB, 0x45, 0x44, 0x84, 0xF7, 0x27, 0x69, 0x1C, 0x86, 0x61, 0xBA, 0x0A, 0xA2, 0x2D, 0x37, 0xCA, 
-0x87, 0x64, 0x89, 0x13, 0x8C, 0x4C, 0xE8, 0x5E, 0x8B, 0xCD, 0x1C, 0x48, 0x64, 0x35, 0x51, 0x40, 
-0x00, 0x5A, 0xD5, 0xA4, 0xF5, 0xA9, 0x64, 0x66, 0xC2, 0xCA, 0x25, 0x11, 0x6C, 0xC5, 0xA8, 0xEC, 
-0xF4, 0x4E, 0x88, 0x3D, 0x13, 0xC7, 0x0D, 0x9F, 0xA7, 0x00, 0x56, 0x77, 0xC9, 0x89, 0x5C, 0xD0, 
-0xE5, 0x24, 0x8D, 0x20, 0xF3, 0x14, 0x53, 0xD8, 0xC1, 0x28, 0xF3, 0x84, 0xD2, 0xDB, 0x1C, 0x86, 
-0xB7, 0x10, 0x49, 0x29, 0x70, 0x10, 0x24, 0xEA, 0xFD, 0x23, 0x8E, 0x24, 0xA6, 0x71, 0x11, 0x6E, 
-0x7E, 0x2C, 0x31, 0x29, 0x22, 0x3C, 0xF0, 0xD8, 0x83, 0xA5, 0x32, 0x8E, 0x48, 0x8A, 0xD8, 0x95, 
-0xB1, 0x60, 0x79, 0x10, 0x55, 0x34, 0xF6, 0x28, 0x1B, 0xAB, 0x33, 0x1F, 0xEA, 0xF3, 0x79, 0x60, 
-0x72, 0x80, 0x15, 0xA0, 0x84, 0x51, 0x19, 0x30, 0xB2, 0x4F, 0x98, 0xEA, 0xA0, 0xB0, 0x12, 0x9B, 
-0x61, 0xD9, 0x20, 0x17, 0x8C, 0xCF, 0x17, 0x12, 0x60, 0x1B, 0x94, 0xDB, 0xF4, 0x04, 0x05, 0x46, 
-0x41, 0x4B, 0x90, 0x09, 0x82, 0x35, 0xAC, 0xA9, 0xE8, 0x98, 0x66, 0xD6, 0xA3, 0x14, 0x93, 0xBF, 
-0xA4, 0x0D, 0xDD, 0x47, 0x0C, 0x32, 0xD8, 0x4E, 0x89, 0xEA, 0x2A, 0x4C, 0x33, 0x1C, 0xC1, 0xC0, 
-0x76, 0xC0, 0x53, 0x15, 0x3A, 0xA0, 0xF5, 0xCE, 0xFC, 0xF0, 0xFE, 0x92, 0x2C, 0xB8, 0xE7, 0xB1, 
-0xE2, 0xD4, 0xCB, 0xAD, 0xB3, 0x33, 0x7B, 0xD6, 0x9F, 0x5D, 0xEC, 0x85, 0xE8, 0x1E, 0x6C, 0x54, 
-0xA8, 0xA8, 0xA5, 0x88, 0xCC, 0x8E, 0x1B, 0x3A, 0x05, 0x19, 0x21, 0x6F, 0x2F, 0x09, 0x04, 0xFE, 
-0x6A, 0x09, 0x33, 0xB6, 0xF0, 0x1E, 0xDD, 0x56, 0xF9, 0x6D, 0xB5, 0x11, 0x16, 0xD9, 0x2E, 0x39, 
-0xD9, 0x61, 0x57, 0x3B, 0xD9, 0x41, 0x17, 0x96, 0x82, 0x24, 0x18, 0x4E, 0xD6, 0x13, 0xE5, 0x64, 
-0x0B, 0xB4, 0xB2, 0x69, 0xA2, 0x56, 0x20, 0xB1, 0x23, 0xE2, 0xC6, 0x53, 0x88, 0x6B, 0xA6, 0xEC, 
-0x27, 0xCE, 0x44, 0xA7, 0x6B, 0xC1, 0x14, 0xEC, 0xC2, 0x3F, 0xCB, 0x81, 0xA9, 0x58, 0x24, 0x10, 
-0xAE, 0xA8, 0x0B, 0x8B, 0x18, 0xF0, 0x6F, 0x0D, 0xDB, 0xD9, 0x17, 0x0F, 0x66, 0x61, 0x11, 0x3B, 
-0x34, 0x6C, 0x90, 0xF5, 0x45, 0x7B, 0xBB, 0x6F, 0xE5, 0x5B, 0x71, 0x2E, 0xF2, 0xD9, 0xC6, 0x4C, 
-0x36, 0x4E, 0x2F, 0x31, 0xD0, 0x73, 0x21, 0xE8, 0x61, 0xF2, 0x9E, 0xE5, 0xAC, 0xA1, 0x81, 0x5D, 
-0x9F, 0xAD, 0x99, 0x6F, 0x26, 0xAC, 0x7C, 0x1E, 0xEF, 0x5F, 0xF2, 0xD1, 0x75, 0xBC, 0xA8, 0xA8, 
-0xBD, 0x6E, 0x66, 0x36, 0xF1, 0x92, 0xF3, 0x06, 0x53, 0xC8, 0xF3, 0xD1, 0x6E, 0x3E, 0x89, 0x15, 
-0x9D, 0xA1, 0x45, 0x5A, 0xB8, 0x76, 0xEA, 0x5C, 0xF2, 0xC0, 0xDC, 0x3A, 0x89, 0xC2, 0x8A, 0xB6, 
-0x77, 0xA4, 0x66, 0x77, 0x54, 0x31, 0x4B, 0x32, 0x23, 0x15, 0x9B, 0xB2, 0x8C, 0x0C, 0x5B, 0xF0, 
-0x91, 0xDD, 0x50, 0x52, 0x09, 0xC3, 0x76, 0x39, 0xD4, 0x2B, 0xE6, 0xDB, 0xAB, 0xF7, 0x79, 0x77, 
-0xAE, 0xB3, 0x8A, 0xA7, 0xB4, 0x95, 0x0F, 0x25, 0xEA, 0x0B, 0xBB, 0x84, 0x3A, 0x58, 0xB9, 0x19, 
-0xF1, 0x9F, 0x18, 0xF8, 0x59, 0xC1, 0x96, 0xC5, 0x21, 0xB0, 0xF5, 0x7E, 0x2B, 0x75, 0xD1, 0xDD, 
-0x14, 0xF6, 0x8F, 0x6A, 0x62, 0x8D, 0x92, 0xE7, 0x92, 0xE8, 0x0D, 0x71, 0x56, 0xA9, 0x68, 0xC3, 
-0xEC, 0x5A, 0x5D, 0xA7, 0x34, 0x32, 0xDA, 0xDA, 0x4E, 0xF1, 0x96, 0x53, 0x2D, 0x56, 0x4D, 0x6A, 
-0x56, 0x16, 0xB3, 0x7E, 0x13, 0xAC, 0x09, 0x2E, 0x9D, 0x35, 0xD7, 0x02, 0x06, 0xDE, 0xAB, 0x5F, 
-0xC6, 0x2C, 0x1D, 0x6A, 0x30, 0x3D, 0x77, 0x86, 0x45, 0xE1, 0x73, 0x80, 0x0E, 0x4A, 0x80, 0xAA, 
-0xEC, 0x56, 0xB9, 0x57, 0x30, 0x11, 0xF0, 0xFA, 0x31, 0x9A, 0xAF, 0x8B, 0x5B, 0x6C, 0xCD, 0x18, 
-0x02, 0x84, 0xFD, 0x12, 0x23, 0x5A, 0x01, 0x90, 0xB4, 0x35, 0x4D, 0xD1, 0x74, 0x8F, 0xA9, 0xBD, 
-0xD9, 0xB5, 0xF6, 0x8F, 0x78, 0xE5, 0x7C, 0x88, 0xCB, 0x30, 0x55, 0xA8, 0xE6, 0x32, 0x5D, 0xE7, 
-0x2A, 0xA2, 0x92, 0xFC, 0x8A, 0xAB, 0xAE, 0xBA, 0xC8, 0xD5, 0x1E, 0x40, 0xAC, 0x50, 0x45, 0x62, 
-0x6F, 0x58, 0x30, 0x0D, 0x1F, 0xCC, 0x68, 0x41, 0x3D, 0x5C, 0xF7, 0xBB, 0x08, 0x97, 0xEA, 0x44, 
-0xC4, 0x7C, 0x4A, 0x3B, 0xDD, 0x13, 0xF5, 0x9F, 0xD5, 0x1D, 0x1E, 0xD7, 0x98, 0x4B, 0x92, 0x5C, 
-0x50, 0x35, 0x13, 0xA3, 0x47, 0x3B, 0xD9, 0x4A, 0x80, 0x94, 0x8B, 0x2D, 0x70, 0x5C, 0x31, 0xF6, 
-0x36, 0xB1, 0x79, 0xF2, 0xB1, 0x87, 0xE5, 0x18, 0x4A, 0xE3, 0x6D, 0xEA, 0x20, 0xA4, 0x12, 0xCD, 
-0x6D, 0x6E, 0x05, 0xED, 0xDB, 0xF8, 0xED, 0x2B, 0xD6, 0x67, 0xE7, 0x6C, 0xDA, 0x90, 0x5B, 0x7C, 
-0xCF, 0xA2, 0x15, 0x48, 0x01, 0x51, 0x59, 0x2E, 0x2A, 0xCE, 0x3A, 0xCA, 0x3F, 0x2F, 0x99, 0xC7, 
-0x29, 0xE9, 0x64, 0x73, 0x1D, 0x07, 0x57, 0x86, 0x52, 0x15, 0xA1, 0x29, 0xCD, 0x50, 0xD2, 0x35, 
-0xE6, 0x10, 0xCE, 0xBE, 0x1C, 0xE2, 0x43, 0x8D, 0x18, 0x15, 0x0C, 0x0E, 0x7A, 0x4F, 0xC8, 0x1F, 
-0x70, 0xD5, 0x8A, 0x29, 0x35, 0x44, 0x73, 0x92, 0x80, 0x57, 0xAB, 0x90, 0xA3, 0x92, 0x6C, 0x73, 
-0xD0, 0x8F, 0x57, 0xFD, 0x4A, 0x8B, 0x57, 0xDD, 0xBA, 0x5E, 0x35, 0x60, 0x7D, 0x08, 0x7D, 0xD0, 
-0x38, 0x55, 0xCD, 0x5B, 0x7F, 0x6B, 0x86, 0x82, 0xAB, 0x25, 0x0B, 0xED, 0xB6, 0xA9, 0x23, 0xF8, 
-0x3C, 0x2C, 0x98, 0xFF, 0xBD, 0xA3, 0x13, 0x12, 0x15, 0xED, 0x41, 0xAC, 0x7B, 0xDC, 0x54, 0x8A, 
-0xD2, 0xB7, 0xA3, 0xD3, 0x6C, 0xE1, 0x69, 0x04, 0xAB, 0xDC, 0x1D, 0xE6, 0x21, 0x63, 0x43, 0x47, 
-0x06, 0x0B, 0xC6, 0xA4, 0x41, 0x16, 0x82, 0xCD, 0x92, 0x37, 0x98, 0x3A, 0x1B, 0x4D, 0x95, 0x75, 
-0xB5, 0x13, 0xB1, 0x0B, 0xC8, 0xC9, 0x9F, 0xC8, 0xCB, 0x58, 0x66, 0x4A, 0xE6, 0x69, 0x49, 0x92, 
-0x04, 0x74, 0xCD, 0xE7, 0x00, 0xE2, 0xDF, 0xB8, 0x5C, 0xDC, 0x6E, 0xFB, 0x77, 0x62, 0xE1, 0x97, 
-0xEC, 0xB2, 0x5D, 0x19, 0xB8, 0xB1, 0x84, 0xB9, 0x02, 0xB6, 0x4C, 0xF6, 0x00, 0x63, 0x04, 0xF3, 
-0xCA, 0xF2, 0x61, 0xC4, 0xE4, 0x2D, 0x5F, 0xB2, 0x30, 0x96, 0x9D, 0xCE, 0x31, 0x19, 0x4F, 0x40, 
-0x85, 0x01, 0x38, 0x5F, 0x0B, 0xAB, 0xF3, 0xC8, 0x98, 0x85, 0x20, 0x90, 0x31, 0x01, 0xFE, 0x4E, 
-0x08, 0x4C, 0xEF, 0x12, 0xB4, 0xB5, 0xA5, 0xDB, 0x7A, 0x42, 0x7B, 0xB5, 0x83, 0xD7, 0xEE, 0xAE, 
-0xE1, 0xB4, 0x01, 0x22, 0x54, 0x1A, 0x27, 0x8C, 0x24, 0x1E, 0xBE, 0xD0, 0x27, 0x04, 0xD4, 0x29, 
-0x03, 0x7C, 0x75, 0x44, 0x7E, 0xF9, 0xA5, 0xCC, 0x53, 0xAE, 0xAF, 0xED, 0x9C, 0x5B, 0xB0, 0xBA, 
-0x58, 0x76, 0xF5, 0x91, 0x82, 0xB4, 0x10, 0xEA, 0x87, 0xF3, 0xCE, 0xD1, 0xDB, 0x94, 0x2E, 0xF1, 
-0x98, 0x84, 0x29, 0xCB, 0x60, 0x51, 0xFC, 0x66, 0xB3, 0x02, 0xF0, 0xD5, 0x4E, 0x02, 0xE8, 0x9E, 
-0xB8, 0x0B, 0xE6, 0xDE, 0x55, 0x82, 0x0E, 0x09, 0x7D, 0x2C, 0xF6, 0x4C, 0x6D, 0x7D, 0x62, 0x82, 
-0x47, 0x68, 0x46, 0xA0, 0x5D, 0x88, 0x5F, 0x61, 0x8C, 0xDA, 0x63, 0x13, 0x85, 0x7E, 0xA5, 0x51, 
-0x11, 0xA8, 0x67, 0x45, 0x62, 0x00, 0x48, 0xF1, 0xD5, 0x33, 0xC4, 0x41, 0x8A, 0x98, 0x55, 0x43, 
-0x50, 0xA3, 0x53, 0x40, 0x19, 0xE6, 0xAB, 0xDA, 0x24, 0x39, 0x7A, 0xA4, 0xB8, 0x0B, 0x30, 0xD9, 
-0x50, 0x6C, 0x2C, 0x70, 0xFA, 0x3E, 0x84, 0x31, 0x37, 0x12, 0xD8, 0xE9, 0x04, 0xB1, 0x0F, 0x56, 
-0xA7, 0xFF, 0x5F, 0x35, 0x74, 0x2E, 0x0C, 0xD8, 0xD5, 0x98, 0xF1, 0xDA, 0xDD, 0x25, 0x1F, 0x96, 
-0x0F, 0x0E, 0xAC, 0xC2, 0x15, 0x56, 0x65, 0x58, 0xF6, 0xC0, 0x80, 0x3A, 0xEE, 0x52, 0x12, 0xFD, 
-0xFF, 0x44, 0x17, 0xF5, 0x73, 0x35, 0x45, 0x7F, 0x15, 0x47, 0x8B, 0xC3, 0xA1, 0x2F, 0xA8, 0xF3, 
-0x43, 0x45, 0xAD, 0x7F, 0x74, 0x9A, 0x1C, 0x9E, 0x1A, 0xA1, 0x97, 0x4A, 0x1D, 0xA9, 0xC7, 0xD7, 
-0x44, 0x39, 0xAC, 0xB1, 0x91, 0x14, 0x36, 0xB6, 0x0E, 0xD1, 0xC4, 0xED, 0x1F, 0x08, 0x98, 0x0C, 
-0xC2, 0xBD, 0x86, 0xD6, 0xC9, 0xE8, 0x14, 0x88, 0x24, 0xF4, 0xCA, 0x54, 0x73, 0x3B, 0x86, 0x46, 
-0xC6, 0x63, 0x8F, 0x9E, 0x99, 0x26, 0x79, 0xAD, 0x63, 0x6E, 0xD3, 0xCC, 0x36, 0xE8, 0x30, 0x6E, 
-0x92, 0x97, 0x2E, 0x4B, 0x53, 0xA5, 0x24, 0xC6, 0xA4, 0x0C, 0xE2, 0x68, 0x61, 0xD7, 0x1D, 0xD4, 
-0x02, 0xF1, 0xED, 0xAA, 0x2F, 0x30, 0xB1, 0x99, 0xDC, 0xA0, 0x45, 0x2E, 0x29, 0x7E, 0xF5, 0x2E, 
-0x0C, 0x38, 0x28, 0x82, 0x85, 0xF8, 0x90, 0x3B, 0xDA, 0xA5, 0x7A, 0x16, 0x98, 0xCA, 0x88, 0x5E, 
-0xC5, 0x68, 0x3E, 0x18, 0xAE, 0xE4, 0x38, 0xD3, 0x3B, 0x57, 0xA7, 0xD4, 0xA8, 0x03, 0x72, 0x81, 
-0x8E, 0x46, 0xD2, 0xD7, 0x15, 0x34, 0x4A, 0x74, 0x54, 0x4F, 0xD3, 0x0B, 0xA5, 0x26, 0x92, 0x79, 
-0x9E, 0x54, 0x71, 0x9C, 0xC3, 0x22, 0xFB, 0x05, 0xE6, 0x60, 0xC6, 0xE4, 0x2A, 0x44, 0x16, 0x20, 
-0x1F, 0xA8, 0x84, 0xA0, 0x0E, 0x86, 0x1A, 0x28, 0x92, 0xD8, 0xBC, 0x56, 0x0C, 0xDD, 0x5E, 0xFC, 
-0x48, 0x06, 0x64, 0x57, 0x20, 0xD3, 0x42, 0x65, 0x9F, 0xA9, 0xE0, 0xD4, 0xF4, 0xE9, 0x14, 0xA3, 
-0x87, 0x2B, 0x26, 0x04, 0x15, 0xB0, 0xA8, 0x46, 0xA8, 0x75, 0x83, 0x84, 0x81, 0xEB, 0x73, 0xF7, 
-0x2E, 0xFD, 0xA0, 0x73, 0x6C, 0x10, 0x55, 0xCC, 0x2C, 0xF5, 0xAC, 0xE1, 0x48, 0x03, 0xB3, 0x9E, 
-0x17, 0x58, 0xC2, 0x6A, 0x9F, 0x41, 0xF0, 0x6C, 0xE1, 0x37, 0xE1, 0xC3, 0xD8, 0xE8, 0x42, 0xA6, 
-0xE4, 0xF4, 0xE0, 0x9F, 0x41, 0x30, 0x30, 0x1B, 0x1B, 0x01, 0x80, 0x66, 0xE0, 0xC6, 0x71, 0x78, 
-0x07, 0x43, 0xB9, 0xB1, 0xC0, 0xAA, 0xEC, 0x15, 0xE6, 0xC3, 0xE9, 0x5B, 0x1D, 0x10, 0x8F, 0x0D, 
-0xA7, 0x69, 0x64, 0x35, 0xFA, 0x8A, 0xC2, 0x52, 0x06, 0x22, 0xBF, 0xBB, 0x20, 0x8E, 0xFD, 0xBA, 
-0x4F, 0x1D, 0xE2, 0x10, 0x1C, 0xD0, 0x36, 0x1D, 0xD3, 0xF9, 0x21, 0xF3, 0x4C, 0xE0, 0x79, 0xD1, 
-0x43, 0x25, 0xE3, 0x27, 0x7B, 0xC9, 0x86, 0x3E, 0x6E, 0xBA, 0x33, 0xB2, 0x0A, 0x39, 0x64, 0x16, 
-0x63, 0xC3, 0x1E, 0x10, 0xFB, 0x1C, 0x86, 0x80, 0x24, 0x02, 0xD2, 0x47, 0x72, 0xAE, 0x08, 0x25, 
-0x9D, 0xF6, 0x11, 0x53, 0x84, 0x1E, 0x6C, 0x10, 0xC7, 0x36, 0xC8, 0x06, 0x7E, 0x6D, 0xC7, 0x20, 
-0x0F, 0xCE, 0xD8, 0xB8, 0x80, 0x47, 0x47, 0x3D, 0x02, 0xB5, 0x3D, 0x94, 0xC0, 0xC0, 0xD6, 0xF3, 
-0x3A, 0xCB, 0x38, 0xD5, 0xA6, 0xD1, 0xCE, 0x70, 0x8A, 0x45, 0xDA, 0x9C, 0x0F, 0xCB, 0xBC, 0xCD, 
-0x5A, 0xCE, 0xAD, 0x7A, 0xAF, 0x0F, 0xD0, 0xB4, 0xB5, 0x86, 0x5D, 0xE9, 0xF7, 0x4B, 0x19, 0x83, 
-0xCB, 0x85, 0x0B, 0x5C, 0xBA, 0x0F, 0x1A, 0x62, 0x77, 0xA3, 0x7F, 0xC5, 0xD8, 0xE8, 0x23, 0xC2, 
-0xBA, 0xB9, 0xB5, 0xB6, 0xF0, 0x53, 0xA5, 0x2D, 0xAD, 0x2C, 0xF5, 0x08, 0xBF, 0x67, 0x2D, 0x94, 
-0x55, 0x4D, 0xC8, 0x29, 0x50, 0x72, 0x0E, 0x27, 0xD5, 0xB3, 0x9C, 0x84, 0x98, 0xBE, 0x43, 0x72, 
-0x7D, 0x6B, 0xD0, 0xD3, 0x04, 0xD5, 0xDD, 0xC1, 0xDC, 0x0D, 0xAD, 0xB3, 0x41, 0x22, 0xA9, 0xBE, 
-0x55, 0x3C, 0x5E, 0x58, 0xE7, 0xC3, 0xC4, 0x3C, 0xD5, 0xED, 0xC1, 0x64, 0xF3, 0xA6, 0x7E, 0x76, 
-0x80, 0xA9, 0xE7, 0x09, 0x15, 0x27, 0x8D, 0xF3, 0x78, 0x52, 0x3B, 0xF4, 0x12, 0xF1, 0xF2, 0xF0, 
-0x69, 0xF1, 0x3F, 0x01, 0x3F, 0x4D, 0xAA, 0x00, 0x9F, 0x1A, 0xF4, 0xB3, 0xCD, 0xEF, 0xCA, 0x55, 
-0xB6, 0xF0, 0x4E, 0x47, 0x37, 0x2A, 0x6A, 0x28, 0x84, 0x18, 0xEF, 0x92, 0x7A, 0xEC, 0x15, 0x15, 
-0x5E, 0x44, 0xBE, 0x0F, 0xEF, 0x0B, 0xD1, 0x46, 0x66, 0x8D, 0xCA, 0x6C, 0x42, 0x14, 0xE7, 0xA1, 
-0x22, 0x75, 0xCB, 0x96, 0x90, 0xDD, 0xC3, 0xD2, 0x28, 0x68, 0x9E, 0x48, 0x91, 0x90, 0xAA, 0x8A, 
-0x16, 0x4F, 0x03, 0x90, 0xE4, 0x5E, 0x8F, 0x42, 0x32, 0xA7, 0x2D, 0x32, 0xAB, 0x54, 0xB4, 0x08, 
-0xEF, 0xAF, 0x70, 0xC7, 0xBE, 0x73, 0x84, 0x2D, 0x47, 0xC7, 0x49, 0x1C, 0xA0, 0x0E, 0xE1, 0x60, 
-0xD7, 0x3D, 0xCB, 0xAC, 0xEA, 0xA8, 0xA1, 0xA8, 0x5D, 0x63, 0xD5, 0x32, 0x9F, 0xED, 0xAF, 0x16, 
-0x44, 0x63, 0x92, 0x11, 0xAF, 0x76, 0xA9, 0x2F, 0x8E, 0x87, 0xAE, 0xCF, 0x9C, 0x86, 0x0F, 0x64, 
-0x3A, 0x37, 0x37, 0xCC, 0xF7, 0x11, 0xB9, 0xDB, 0xDF, 0x7E, 0xAD, 0x8D, 0x08, 0x1A, 0x22, 0x85, 
-0x36, 0xEC, 0x66, 0x8F, 0x5F, 0x25, 0x3E, 0x5D, 0x81, 0x62, 0x9A, 0x09, 0xC7, 0x55, 0xBD, 0xF1, 
-0x80, 0x91, 0x31, 0xF9, 0xED, 0xD7, 0xAB, 0x4F, 0x0A, 0x60, 0x72, 0xA7, 0x99, 0x8C, 0xC9, 0x4B, 
-0x2E, 0x18, 0x79, 0xB9, 0x9C, 0x62, 0xD9, 0x90, 0x35, 0x59, 0x68, 0x85, 0x1D, 0xBD, 0x8E, 0x97, 
-0xCC, 0xA3, 0xDE, 0x23, 0x6C, 0xA8, 0xDA, 0x52, 0xD2, 0xA3, 0x30, 0x39, 0x6B, 0x49, 0x5F, 0x7E, 
-0x4E, 0x8B, 0x49, 0x04, 0x79, 0x94, 0xB5, 0x4C, 0x51, 0x85, 0x93, 0xD7, 0xCF, 0xBF, 0x9C, 0xA9, 
-0xEC, 0x10, 0x69, 0x61, 0x2E, 0xCF, 0x9F, 0xD2, 0x58, 0x52, 0x85, 0x7F, 0xAF, 0xEB, 0xEC, 0xF4, 
-0x40, 0x7B, 0xB9, 0x89, 0x99, 0x1F, 0x3E, 0x99, 0xB5, 0xE0, 0x69, 0xA4, 0x9C, 0xA5, 0xE0, 0x8B, 
-0xCF, 0x69, 0x25, 0x8A, 0xFD, 0x47, 0xD9, 0xC8, 0x5C, 0x30, 0x06, 0x91, 0xF9, 0xCD, 0x17, 0x34, 
-0x12, 0x0D, 0xC6, 0xEF, 0x65, 0x20, 0x90, 0x73, 0xDE, 0x72, 0xCC, 0x4B, 0x0E, 0xB4, 0x90, 0xB7, 
-0x60, 0xDA, 0x41, 0x18, 0xF1, 0xA7, 0xF4, 0x2A, 0x3E, 0x6E, 0x15, 0xE7, 0x0C, 0x45, 0xBD, 0xF9, 
-0x9C, 0x96, 0x92, 0x11, 0xE3, 0x51, 0xF6, 0x12, 0x0A, 0x1A, 0xCC, 0x91, 0xCE, 0x17, 0x34, 0x98, 
-0x04, 0x94, 0x2F, 0x6D, 0x31, 0x6F, 0xB0, 0xE4, 0xA8, 0x15, 0x0E, 0xA8, 0x7D, 0xFC, 0x4F, 0xC0, 
-0xDD, 0x46, 0xA3, 0x29, 0x3E, 0x17, 0xA2, 0x24, 0x75, 0x0A, 0xEB, 0x46, 0x9F, 0x90, 0xC6, 0x48, 
-0xA9, 0x3E, 0x48, 0x52, 0x06, 0xB3, 0xC7, 0xC2, 0x1A, 0xF4, 0x5F, 0xAB, 0xFB, 0xEB, 0x08, 0xF7, 
-0x18, 0x60, 0x06, 0xF8, 0xC8, 0xCC, 0x3F, 0x63, 0xF6, 0xA8, 0x1D, 0x97, 0x7C, 0x91, 0x67, 0x9F, 
-0xAD, 0x56, 0xD4, 0x6E, 0x1A, 0x37, 0x58, 0x50, 0xDF, 0xBA, 0xFC, 0xA2, 0x0A, 0x1D, 0x46, 0x4A, 
-0x67, 0x57, 0x92, 0x31, 0xF4, 0xC1, 0x06, 0xDC, 0x27, 0xD0, 0x95, 0x96, 0xEE, 0xF3, 0x17, 0xF5, 
-0xBB, 0x2E, 0x6D, 0xF4, 0xBE, 0x3D, 0xF4, 0xD3, 0x66, 0xEB, 0xA7, 0x7C, 0xE4, 0xA6, 0x31, 0x93, 
-0x2D, 0x41, 0x91, 0x3D, 0x20, 0xB3, 0x37, 0x15, 0xDD, 0x13, 0x98, 0x01, 0xC1, 0x4F, 0x9C, 0x16, 
-0xFB, 0x60, 0xDA, 0xB6, 0xAF, 0xF2, 0xF2, 0xD3, 0x48, 0x1F, 0x8C, 0x67, 0xDE, 0x8E, 0x95, 0xDC, 
-0xDB, 0xC9, 0xC7, 0x7F, 0xF9, 0x92, 0x2F, 0x43, 0x02, 0x4F, 0x01, 0x58, 0xDD, 0x25, 0x41, 0x3E, 
-0x57, 0xED, 0x87, 0x50, 0x7F, 0x89, 0x65, 0x2E, 0xA3, 0x79, 0x66, 0x80, 0x7B, 0x2A, 0x02, 0x1E, 
-0xCC, 0xD5, 0xAE, 0x49, 0x6D, 0x92, 0xD3, 0xE0, 0x66, 0x4A, 0x56, 0x9C, 0x3D, 0x22, 0x74, 0x90, 
-0x1A, 0x73, 0x47, 0x7E, 0xF6, 0xEF, 0x28, 0xD0, 0x60, 0x4D, 0xA3, 0xAD, 0x1C, 0x37, 0x2B, 0x2A, 
-0xEE, 0x30, 0x91, 0x53, 0xDB, 0x09, 0xAA, 0xED, 0x91, 0xAA, 0x39, 0xC4, 0xEA, 0x5B, 0xBA, 0x29, 
-0xB5, 0x34, 0x3D, 0xA1, 0x83, 0x4A, 0x67, 0x6B, 0x55, 0xFD, 0xFF, 0x10, 0xEF, 0xA5, 0xD7, 0x48, 
-0x05, 0x7B, 0xF2, 0x22, 0x21, 0x9C, 0x3F, 0x3E, 0x0F, 0x34, 0xFF, 0x22, 0x3E, 0xFE, 0x7B, 0x06, 
-0x6B, 0xD6, 0x25, 0xD9, 0x97, 0x6E, 0xED, 0x73, 0x75, 0x7B, 0xB5, 0x9C, 0xD5, 0x6C, 0x52, 0x5E, 
-0x50, 0xF8, 0xD5, 0x2A, 0xB6, 0x4E, 0x09, 0x65, 0x85, 0x28, 0x65, 0xBC, 0x62, 0x33, 0x26, 0xB4, 
-0x4A, 0xAC, 0x7F, 0xA8, 0xF3, 0xBA, 0x7C, 0xB9, 0x12, 0xE1, 0x9A, 0xA5, 0x7F, 0x4C, 0x4D, 0xFC, 
-0x30, 0x1B, 0x8F, 0x54, 0x56, 0x6D, 0xF1, 0x2F, 0x46, 0x77, 0x34, 0x68, 0xB4, 0x09, 0xDC, 0x85, 
-0x08, 0x83, 0x30, 0x8E, 0xFC, 0xCD, 0xAE, 0x63, 0x43, 0x01, 0x52, 0x57, 0x86, 0x14, 0x18, 0x37, 
-0x8A, 0x3E, 0x19, 0xEF, 0x0A, 0xB2, 0xAE, 0x60, 0xE0, 0x9A, 0x93, 0xBF, 0x14, 0x86, 0xD0, 0x57, 
-0x75, 0x28, 0x95, 0x83, 0x32, 0x1F, 0x5B, 0x91, 0x70, 0xB1, 0x84, 0xE3, 0x26, 0x1C, 0x15, 0x0B, 
-0x38, 0xD9, 0xAE, 0x9E, 0x92, 0x7F, 0x4C, 0xB0, 0x40, 0x54, 0x3C, 0x7A, 0x99, 0xAB, 0x08, 0xA3, 
-0x86, 0x02, 0xEF, 0x6A, 0xC1, 0x7D, 0xAF, 0x93, 0x21, 0x50, 0x53, 0x3B, 0x2B, 0xFD, 0x7D, 0xA6, 
-0x96, 0x0A, 0x18, 0xD3, 0x7F, 0xCC, 0x0E, 0x5C, 0x19, 0x44, 0x8D, 0x3D, 0xC9, 0x95, 0x77, 0x92, 
-0xB2, 0xCE, 0xE8, 0x34, 0xF9, 0xF3, 0xF9, 0xFF, 0x01, 0x66, 0xAD, 0x46, 0x68, 0x50, 0x3F, 0x00, 
-0x00, 0x00
-};
-
-#endif
+#ifndef VIEW_HTML_H_H
+#define VIEW_HTML_H_H
+
+#include <Arduino.h>
+
+// Generated by tools/build_assets.js from view.html - do not edit
+const char view_html[] PROGMEM = {
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xCD, 0x5A, 0xD1, 0x8E, 0xDB, 0xB8, 
+0x15, 0x7D, 0xF7, 0x57, 0xDC, 0x28, 0x08, 0xEC, 0x01, 0x2C, 0x8D, 0xA4, 0xB1, 0x3D, 0x1E, 0x7B, 
+0x6C, 0x34, 0x3B, 0x9B, 0x36, 0x0B, 0x64, 0xB1, 0x8B, 0x66, 0xBA, 0x6D, 0x1F, 0x69, 0xE9, 0xCA, 
+0xE6, 0x8E, 0x4C, 0xAA, 0x24, 0xE5, 0x19, 0x6F, 0x92, 0x1F, 0xE9, 0x5B, 0x3F, 0xA0, 0xC0, 0x02, 
+0xFD, 0x83, 0xCD, 0x8F, 0x15, 0x24, 0x25, 0x5B, 0xB2, 0x65, 0x8F, 0x67, 0x92, 0x16, 0x9B, 0x20, 
+0xB1, 0x44, 0x5E, 0x5E, 0x1E, 0x1E, 0x5E, 0x5E, 0x92, 0xC7, 0xBE, 0x7E, 0xF1, 0xED, 0x0F, 0x37, 
+0xB7, 0x7F, 0xFF, 0xF1, 0x0D, 0x2C, 0xD4, 0x32, 0x9D, 0xB6, 0xAE, 0xF5, 0x07, 0xA4, 0x84, 0xCD, 
+0x27, 0x0E, 0x4A, 0x47, 0x17, 0x20, 0x89, 0xA7, 0xAD, 0xEB, 0x25, 0x2A, 0x02, 0xD1, 0x82, 0x08, 
+0x89, 0x6A, 0xE2, 0xFC, 0xE5, 0xF6, 0x8F, 0xEE, 0xD0, 0x29, 0x8B, 0x19, 0x59, 0xE2, 0xC4, 0x59, 
+0x51, 0xBC, 0xCF, 0xB8, 0x50, 0x0E, 0x44, 0x9C, 0x29, 0x64, 0x6A, 0xE2, 0xDC, 0xD3, 0x58, 0x2D, 
+0x26, 0x31, 0xAE, 0x68, 0x84, 0xAE, 0x79, 0xE9, 0x02, 0x65, 0x54, 0x51, 0x92, 0xBA, 0x32, 0x22, 
+0x29, 0x4E, 0x02, 0xCF, 0xD7, 0x6E, 0x14, 0x55, 0x29, 0x4E, 0x7F, 0x24, 0x0C, 0x53, 0x88, 0x11, 
+0x7E, 0xA2, 0x32, 0x27, 0x29, 0xFD, 0x85, 0x44, 0xF4, 0xF3, 0x7F, 0x18, 0xB8, 0xF0, 0x1D, 0x5B, 
+0xA1, 0x60, 0x24, 0x46, 0xC1, 0xAF, 0xCF, 0xAD, 0x71, 0xEB, 0x5A, 0x46, 0x82, 0x66, 0x6A, 0xDA, 
+0xEA, 0x24, 0x39, 0x8B, 0x14, 0xE5, 0xAC, 0x73, 0x06, 0x1F, 0x5A, 0x4A, 0xAC, 0xE1, 0x43, 0x2B, 
+0xE2, 0x4C, 0x2A, 0x90, 0x64, 0x85, 0xF1, 0xED, 0x02, 0x97, 0x08, 0x13, 0x48, 0x79, 0x44, 0xD2, 
+0xF7, 0x8A, 0x0B, 0x32, 0x47, 0x6F, 0x8E, 0xEA, 0x3B, 0x85, 0xCB, 0x4E, 0x5B, 0xE9, 0xDA, 0xF6, 
+0xD9, 0xB8, 0x45, 0x13, 0xE8, 0x54, 0xED, 0x27, 0x13, 0x68, 0xC7, 0x44, 0xDC, 0xB5, 0xB5, 0xD3, 
+0x98, 0x47, 0xF9, 0x12, 0x99, 0xF2, 0xCA, 0x87, 0x37, 0x29, 0x9A, 0xF7, 0x28, 0x25, 0x52, 0xBE, 
+0xA3, 0x52, 0x79, 0x24, 0x8E, 0x3B, 0xA6, 0x81, 0xBB, 0x71, 0x79, 0xB0, 0x95, 0x44, 0xF5, 0x5A, 
+0x29, 0x41, 0x67, 0xB9, 0xC2, 0x4E, 0x5B, 0xAA, 0x75, 0x8A, 0xED, 0x2E, 0xB4, 0x67, 0x24, 0xBA, 
+0x9B, 0x0B, 0x9E, 0xB3, 0xD8, 0x8D, 0x78, 0xCA, 0xC5, 0x08, 0x5E, 0xFA, 0xC4, 0x4F, 0x02, 0x84, 
+0x17, 0x74, 0xA9, 0xA9, 0x25, 0x4C, 0x8D, 0x4B, 0xAC, 0x1B, 0xE7, 0x33, 0x1E, 0xAF, 0x6B, 0x18, 
+0x75, 0xC1, 0x89, 0xC0, 0x8C, 0xE9, 0x97, 0xA0, 0x81, 0xB2, 0x2A, 0x31, 0x7F, 0x76, 0x81, 0x7E, 
+0x02, 0x4C, 0x25, 0x56, 0xC1, 0x91, 0x38, 0x7E, 0xB3, 0x42, 0xA6, 0x34, 0x34, 0x64, 0x28, 0x3A, 
+0xED, 0x6F, 0x7F, 0xF8, 0xFE, 0xC6, 0x06, 0xCC, 0x3B, 0x4E, 0x62, 0x8C, 0xDB, 0x5D, 0xA8, 0x4D, 
+0xE8, 0xEF, 0x72, 0x5C, 0xFA, 0x9F, 0xFE, 0x0B, 0x11, 0x51, 0xD1, 0xA2, 0x83, 0x67, 0x45, 0xCC, 
+0xF1, 0x14, 0x3D, 0x14, 0x82, 0x8B, 0x4E, 0xFB, 0x8D, 0xFE, 0x00, 0x92, 0x65, 0xE9, 0x9A, 0xB2, 
+0x39, 0x18, 0x90, 0xA3, 0x76, 0x17, 0xD0, 0xB6, 0x3D, 0xEB, 0x9C, 0x8D, 0x5B, 0xD7, 0xE7, 0x65, 
+0x10, 0x5F, 0x1B, 0x7C, 0xD3, 0x96, 0x59, 0x7F, 0x1F, 0xA0, 0x01, 0x64, 0x72, 0x91, 0xF4, 0x92, 
+0x41, 0x0D, 0xA4, 0x12, 0x84, 0x49, 0xAA, 0x99, 0x1A, 0xED, 0xB5, 0x00, 0xDF, 0xEB, 0x4B, 0x40, 
+0x22, 0x71, 0x0C, 0x9F, 0x8C, 0x5B, 0x6F, 0x4B, 0x56, 0x73, 0x0F, 0x0D, 0x34, 0x7C, 0x6A, 0x69, 
+0x2A, 0x4F, 0x06, 0x54, 0x56, 0x05, 0x49, 0x78, 0x75, 0x71, 0x79, 0x2A, 0xC0, 0x2E, 0x9C, 0x80, 
+0xF8, 0x30, 0x8E, 0x27, 0xCD, 0x5E, 0x83, 0x67, 0x2F, 0x22, 0x22, 0xAE, 0xB9, 0x1E, 0x41, 0x4A, 
+0x19, 0x12, 0xE1, 0xCE, 0x05, 0x89, 0x29, 0x32, 0xD5, 0x09, 0x2E, 0xFA, 0x31, 0xCE, 0xBB, 0xF0, 
+0x32, 0x08, 0x82, 0x61, 0x78, 0x09, 0xFE, 0xAB, 0x2E, 0xBC, 0xF4, 0x93, 0xE0, 0x32, 0x24, 0x10, 
+0xF8, 0xFE, 0xAB, 0xB3, 0x5A, 0x1F, 0x33, 0x2E, 0x62, 0x14, 0x1B, 0x80, 0x01, 0x86, 0x57, 0x17, 
+0xB3, 0xE7, 0x03, 0xD4, 0x29, 0x18, 0xC5, 0xFF, 0x19, 0x61, 0x03, 0x4F, 0x8A, 0xB0, 0x3B, 0x77, 
+0x65, 0x72, 0xB3, 0x7B, 0x2F, 0x48, 0x96, 0x3D, 0x01, 0x94, 0xED, 0xE0, 0x49, 0xA0, 0x7A, 0x97, 
+0xFD, 0xFE, 0xE0, 0xEA, 0xD1, 0xC9, 0x5B, 0x10, 0xA1, 0x9E, 0x0A, 0xA7, 0x80, 0x60, 0xE0, 0x14, 
+0xD0, 0xF6, 0xE1, 0x34, 0x74, 0x26, 0xD7, 0x52, 0xE1, 0xD2, 0x95, 0x8A, 0xA8, 0x5C, 0x9E, 0xDC, 
+0xD9, 0xA0, 0x87, 0x9B, 0xB1, 0xF7, 0x2E, 0x87, 0xFD, 0xCB, 0xC7, 0xC7, 0xEE, 0xF7, 0xAF, 0x06, 
+0x8F, 0x8F, 0xBD, 0x0E, 0x47, 0x66, 0x84, 0xC1, 0x87, 0x4D, 0x68, 0xC5, 0x41, 0x42, 0xB0, 0xFF, 
+0x98, 0x8B, 0x25, 0x2A, 0x41, 0x23, 0x77, 0x45, 0xD2, 0x1C, 0x4F, 0x1D, 0x50, 0x11, 0xB4, 0x66, 
+0x40, 0xD1, 0x2C, 0xEE, 0x63, 0xD0, 0x30, 0x20, 0xF7, 0x1E, 0x67, 0x77, 0x54, 0xB9, 0xD5, 0x05, 
+0x9B, 0xD2, 0x6C, 0x04, 0x0A, 0x1F, 0x54, 0xA3, 0xA5, 0xAE, 0x70, 0x13, 0x9A, 0xA6, 0x25, 0x0B, 
+0x26, 0x7B, 0x64, 0x44, 0x20, 0xAB, 0x37, 0x78, 0xDC, 0xE5, 0x81, 0x45, 0xEE, 0x9A, 0xA3, 0x43, 
+0x17, 0xF6, 0x2A, 0x67, 0x82, 0xB0, 0xD8, 0x10, 0xD8, 0x50, 0x59, 0x50, 0x94, 0x70, 0xAE, 0x50, 
+0x1C, 0xAE, 0xCF, 0x19, 0x55, 0x15, 0xFA, 0x0B, 0x62, 0x1E, 0x5B, 0x52, 0xFA, 0xC3, 0x55, 0x7C, 
+0x3E, 0x4F, 0xD1, 0x9D, 0x29, 0xB6, 0x33, 0x05, 0x4D, 0x0B, 0xF3, 0x59, 0xAB, 0x64, 0xAF, 0x9F, 
+0xA2, 0x84, 0x46, 0xBC, 0x1A, 0x33, 0x18, 0xE2, 0x30, 0xF1, 0x1F, 0x73, 0x96, 0xF2, 0x39, 0xCF, 
+0x55, 0x03, 0xDC, 0x83, 0x11, 0x13, 0x47, 0xE1, 0x20, 0x1C, 0xD8, 0x88, 0x99, 0x5D, 0x05, 0x51, 
+0x10, 0x9D, 0xB6, 0xDE, 0x28, 0x53, 0x28, 0x48, 0xA4, 0xE8, 0x0A, 0x5D, 0x3D, 0x81, 0x5E, 0xF1, 
+0xAC, 0x70, 0x99, 0xE9, 0xBE, 0xEB, 0x54, 0x24, 0xFD, 0x2B, 0xF4, 0x67, 0x07, 0x42, 0xE5, 0x08, 
+0xBA, 0x5E, 0x18, 0xFA, 0x7E, 0x81, 0xEE, 0x22, 0x0E, 0x12, 0x7F, 0xF8, 0x65, 0xE8, 0x16, 0xF9, 
+0x92, 0xC6, 0x54, 0xAD, 0xF7, 0x11, 0x5E, 0xCC, 0x86, 0xE1, 0xCE, 0x96, 0x79, 0x62, 0xFA, 0xBC, 
+0x20, 0xFD, 0x62, 0xC5, 0x05, 0x24, 0xC4, 0x1E, 0xF9, 0x32, 0x84, 0x92, 0xD3, 0x74, 0x1F, 0x5D, 
+0xE0, 0xCF, 0xAE, 0x86, 0xC1, 0xD3, 0xD1, 0xD5, 0x12, 0x5C, 0xFF, 0x22, 0x0E, 0x93, 0xD3, 0xD0, 
+0xD9, 0x7D, 0xCD, 0x9D, 0xE5, 0x4A, 0x71, 0x26, 0xB7, 0x78, 0x52, 0x4C, 0xD4, 0xF1, 0xF8, 0xF6, 
+0x48, 0x96, 0xB9, 0xFA, 0x9A, 0x41, 0x28, 0xD3, 0x59, 0xBF, 0x15, 0x53, 0x99, 0xA5, 0x64, 0x3D, 
+0x82, 0x24, 0xC5, 0x87, 0x71, 0x4B, 0xFF, 0xEF, 0xC6, 0x54, 0x60, 0x64, 0xCF, 0x1E, 0x11, 0x4F, 
+0xF3, 0x25, 0x1B, 0xB7, 0xE6, 0x24, 0x1B, 0x41, 0xD8, 0xCB, 0x1E, 0xC6, 0xAD, 0x25, 0x79, 0xB0, 
+0x57, 0x92, 0x11, 0x04, 0x3D, 0xDF, 0xB7, 0x45, 0x62, 0x4E, 0xD9, 0x08, 0x7C, 0x20, 0xB9, 0xE2, 
+0xE3, 0x56, 0x46, 0xE2, 0x98, 0xB2, 0x79, 0xD9, 0xE2, 0x53, 0xAB, 0x58, 0xEA, 0xD2, 0x15, 0xFC, 
+0xBE, 0xDA, 0xE9, 0x5C, 0xD0, 0xB8, 0x8A, 0xB0, 0xA5, 0x0B, 0x4C, 0x90, 0xA6, 0x44, 0xA1, 0x6B, 
+0x7B, 0x97, 0x23, 0x10, 0x98, 0x21, 0x51, 0x9D, 0x5E, 0x17, 0x82, 0x44, 0x9C, 0xD5, 0x5B, 0x94, 
+0xC8, 0x6A, 0xA5, 0x7B, 0x23, 0x9D, 0x96, 0xA7, 0x95, 0x56, 0x89, 0xDD, 0xF7, 0x5F, 0x19, 0x3B, 
+0xB3, 0x39, 0x1F, 0xA1, 0xA4, 0x32, 0x74, 0x92, 0xD2, 0x39, 0x73, 0xA9, 0xC2, 0xA5, 0x1C, 0x81, 
+0x54, 0x02, 0x55, 0xB4, 0xD8, 0xFA, 0xD8, 0xDD, 0xE0, 0xCB, 0x9E, 0x86, 0x86, 0xA3, 0x05, 0xD2, 
+0xF9, 0x42, 0x8D, 0x20, 0x18, 0x98, 0x57, 0x3B, 0x63, 0x23, 0x08, 0xB3, 0x07, 0x90, 0x3C, 0xA5, 
+0x31, 0xAC, 0x88, 0xE8, 0xB8, 0x6E, 0x35, 0xB2, 0xCE, 0x4A, 0x33, 0x57, 0x47, 0x4E, 0x2E, 0x47, 
+0x10, 0x84, 0xBA, 0x6D, 0xC6, 0xCB, 0xA3, 0xA1, 0xC0, 0x94, 0xE8, 0xB8, 0x1C, 0xB7, 0xF8, 0x0A, 
+0x45, 0x92, 0xF2, 0xFB, 0x11, 0x2C, 0x68, 0x1C, 0x23, 0x1B, 0xB7, 0x6A, 0xE9, 0x30, 0x09, 0x92, 
+0x7E, 0x72, 0x65, 0xB0, 0xDE, 0x13, 0x85, 0xC2, 0x6C, 0x17, 0xF0, 0xA1, 0xE2, 0x8A, 0xCC, 0x24, 
+0x4F, 0x73, 0x85, 0xBA, 0x4F, 0xA5, 0xF8, 0x72, 0x04, 0xFE, 0xB8, 0xA5, 0x03, 0xCA, 0x3C, 0xD4, 
+0x48, 0x3B, 0x1A, 0xDB, 0x43, 0xDF, 0xC6, 0xF6, 0xC0, 0x27, 0xFD, 0xA4, 0x38, 0x29, 0x14, 0xAB, 
+0xD7, 0xC4, 0xF6, 0xB8, 0x55, 0x3D, 0xDB, 0x5A, 0x56, 0x20, 0x90, 0x10, 0xE5, 0x33, 0x1A, 0xB9, 
+0x33, 0xFC, 0x85, 0xA2, 0xE8, 0xF8, 0x5E, 0xAF, 0x0B, 0x7E, 0x17, 0x7C, 0x2F, 0xEC, 0x42, 0x70, 
+0x36, 0x6E, 0xF1, 0x8C, 0x44, 0x54, 0xAD, 0x47, 0xE0, 0x7B, 0xC3, 0x2D, 0xE3, 0x94, 0x25, 0x1C, 
+0x3E, 0x98, 0xA0, 0x1D, 0x41, 0x30, 0x3E, 0x35, 0x98, 0x7F, 0xCE, 0xA5, 0xA2, 0xC9, 0xDA, 0x2D, 
+0xAE, 0xDB, 0x23, 0xBD, 0x7F, 0x45, 0xE8, 0xCE, 0x50, 0xDD, 0xA3, 0x66, 0xAE, 0x74, 0x9F, 0xE2, 
+0x0A, 0x53, 0xB7, 0x70, 0xFA, 0xC4, 0xB5, 0x52, 0x06, 0xBE, 0x8D, 0x0C, 0x7D, 0x48, 0xA8, 0x04, 
+0xC6, 0x8E, 0xA3, 0x5A, 0x58, 0xCD, 0x88, 0x44, 0x4D, 0x6A, 0x93, 0x1F, 0x7B, 0x64, 0x93, 0xB6, 
+0xC3, 0xEA, 0xC0, 0x97, 0x94, 0xB9, 0x9B, 0x00, 0xB3, 0x6B, 0xB2, 0xDE, 0x66, 0x2F, 0x28, 0xED, 
+0x4C, 0x56, 0xDA, 0xBC, 0xAA, 0x7B, 0x19, 0x96, 0x4E, 0xEC, 0x0E, 0x7F, 0xF2, 0xE0, 0x37, 0x2D, 
+0x16, 0x81, 0x06, 0xC8, 0x99, 0x72, 0x25, 0xFD, 0x05, 0x47, 0x10, 0x0A, 0x5C, 0x8E, 0x6D, 0xC1, 
+0xFD, 0xA6, 0x0F, 0x7F, 0xDC, 0xDA, 0xB9, 0xF9, 0x6C, 0x73, 0x89, 0x8E, 0x3E, 0xA5, 0x43, 0x55, 
+0xCF, 0x8E, 0xC9, 0x26, 0xAE, 0xEF, 0xF9, 0xA1, 0xF6, 0xA2, 0xF9, 0xD9, 0x8E, 0xD7, 0x0B, 0x75, 
+0xB7, 0x07, 0x8E, 0x26, 0x06, 0xC6, 0xE1, 0x8B, 0xD7, 0x16, 0xAF, 0x3D, 0x04, 0x56, 0x11, 0xFB, 
+0xDE, 0xB0, 0x6F, 0x40, 0x97, 0xCD, 0x07, 0xB3, 0xCB, 0x70, 0xE8, 0xEF, 0x0C, 0x62, 0xA0, 0x07, 
+0x61, 0x4E, 0x60, 0x26, 0xAE, 0x13, 0x2E, 0x96, 0x23, 0xC8, 0x35, 0xD9, 0x91, 0xBE, 0x90, 0xED, 
+0x0D, 0xC2, 0xF7, 0xFC, 0xBE, 0x76, 0x6A, 0xC7, 0xE9, 0x2A, 0xBE, 0x9D, 0xE4, 0xF2, 0xBA, 0xB2, 
+0xCB, 0xF5, 0x63, 0xF1, 0x5A, 0x8B, 0x9F, 0x08, 0xF5, 0xD6, 0xB5, 0xF1, 0x5F, 0x2E, 0x66, 0x9B, 
+0xC0, 0xEA, 0x39, 0xC1, 0xFC, 0xA9, 0x64, 0xEB, 0x60, 0x90, 0x3D, 0x94, 0x86, 0x4D, 0x79, 0x67, 
+0xC6, 0x1F, 0x5C, 0xB9, 0x20, 0xB1, 0xCE, 0x32, 0xBE, 0x06, 0x6D, 0xCA, 0x41, 0xCC, 0x67, 0xA4, 
+0xE3, 0x77, 0xCD, 0x5F, 0xCF, 0x1F, 0x9A, 0x5B, 0x7A, 0xB9, 0x45, 0x11, 0x13, 0x1E, 0xF2, 0x91, 
+0x98, 0x2F, 0x31, 0x9B, 0x88, 0xB7, 0x7D, 0x6D, 0x5D, 0x6C, 0x76, 0xB9, 0xD3, 0x5D, 0x0C, 0x4D, 
+0x96, 0xB4, 0xC3, 0x72, 0x6D, 0x0E, 0x2B, 0x47, 0xB0, 0xD9, 0x27, 0x47, 0x10, 0x6C, 0x52, 0xEF, 
+0x4B, 0xEC, 0xE3, 0x25, 0xCE, 0x74, 0xAF, 0x7F, 0x58, 0x62, 0x4C, 0x09, 0x74, 0xAA, 0xBB, 0x5C, 
+0xA8, 0x57, 0x94, 0x16, 0x2A, 0x76, 0xB6, 0xB1, 0xE3, 0x9B, 0x55, 0xD8, 0xB0, 0x59, 0x7D, 0x6A, 
+0xEE, 0x61, 0xD0, 0x7B, 0x52, 0x07, 0x41, 0x22, 0x76, 0x63, 0x78, 0x6F, 0x13, 0x3B, 0xB2, 0x3E, 
+0x8F, 0x6E, 0x56, 0x7B, 0x79, 0xA1, 0x98, 0x8C, 0xDA, 0xAE, 0x71, 0x24, 0x87, 0x6C, 0x16, 0x81, 
+0xCB, 0x05, 0x35, 0x0B, 0x59, 0x93, 0x5D, 0x29, 0x1F, 0x81, 0x11, 0x30, 0xFF, 0xD6, 0xB1, 0xFB, 
+0x9D, 0xC9, 0xB1, 0x5D, 0xF0, 0xCF, 0x0A, 0x61, 0xE8, 0xFA, 0xBC, 0xD0, 0x73, 0xAE, 0x53, 0xCA, 
+0xEE, 0xF4, 0x06, 0x37, 0x71, 0x4C, 0x89, 0x5C, 0x20, 0x2A, 0x07, 0x16, 0x02, 0x93, 0x89, 0x63, 
+0x8D, 0xBC, 0x70, 0x10, 0xCC, 0x2E, 0x82, 0x38, 0xF6, 0x22, 0x69, 0x24, 0xD7, 0x52, 0x13, 0x2A, 
+0x65, 0x30, 0x60, 0x64, 0x45, 0xE7, 0x44, 0xE1, 0x5F, 0xA9, 0x5A, 0xDC, 0x6E, 0xB6, 0x9D, 0x4E, 
+0x2E, 0x52, 0xCD, 0xF6, 0xD3, 0xD5, 0xC0, 0x8C, 0xCC, 0xD1, 0xC5, 0x07, 0xAA, 0x28, 0x9B, 0x6B, 
+0x39, 0x4B, 0xA2, 0xBA, 0xA5, 0x4B, 0xE4, 0xB9, 0xEA, 0x74, 0xCE, 0x60, 0x32, 0x85, 0x7B, 0xCA, 
+0x62, 0x7E, 0xEF, 0x69, 0xC9, 0x54, 0xF7, 0xE4, 0x69, 0xB8, 0x30, 0x81, 0x5C, 0xA4, 0x5D, 0x08, 
+0x7D, 0xBF, 0xAA, 0xEC, 0x1D, 0x36, 0xB5, 0x4C, 0xD4, 0xD5, 0x59, 0x8D, 0x75, 0xAF, 0x05, 0x97, 
+0x4A, 0x4B, 0xC8, 0x56, 0x73, 0x35, 0x32, 0xAD, 0x2E, 0x6A, 0xC3, 0xC7, 0x8F, 0x70, 0xDC, 0x36, 
+0x08, 0x2F, 0x3D, 0xDF, 0xF3, 0xBD, 0xA0, 0x5D, 0xD5, 0xDF, 0x52, 0x3E, 0xEF, 0xB4, 0xDF, 0x95, 
+0x6E, 0x20, 0x46, 0x85, 0x91, 0xC2, 0x78, 0x04, 0xDF, 0xAC, 0x33, 0x22, 0xA5, 0x16, 0xE3, 0x48, 
+0xAE, 0x16, 0x10, 0x2D, 0x30, 0xBA, 0xD3, 0xC3, 0x17, 0xA8, 0x72, 0x61, 0x82, 0xCA, 0xCA, 0xC6, 
+0x54, 0xBE, 0xCE, 0xD5, 0x02, 0x99, 0xA2, 0x11, 0x51, 0x18, 0x1F, 0xD4, 0x8E, 0x77, 0xEC, 0x4A, 
+0x65, 0xF6, 0xC5, 0x6E, 0xFB, 0x8F, 0x1F, 0xF7, 0x5C, 0xBE, 0xD0, 0xF0, 0x95, 0xC8, 0xD1, 0x20, 
+0x3F, 0xC0, 0x61, 0x3B, 0xE5, 0x73, 0xCA, 0x3C, 0xBD, 0x25, 0xB4, 0xAB, 0x28, 0x17, 0x54, 0x2A, 
+0x2E, 0xD6, 0x9E, 0xC0, 0x2C, 0x25, 0x11, 0xBE, 0x57, 0x44, 0x61, 0x87, 0xE5, 0x69, 0xDA, 0x05, 
+0xFB, 0x7F, 0x93, 0x3F, 0xA3, 0x5A, 0x6A, 0xCD, 0xB1, 0xA8, 0xDC, 0x17, 0x62, 0x33, 0x9E, 0x69, 
+0x25, 0x01, 0xAB, 0x02, 0x2C, 0x6A, 0x93, 0xB3, 0x8D, 0xA0, 0xFE, 0xFB, 0x64, 0x66, 0x13, 0x8B, 
+0x25, 0x31, 0x59, 0x2E, 0x17, 0xA7, 0xB3, 0x62, 0xD4, 0xDC, 0x8A, 0x12, 0x7B, 0x5E, 0x7C, 0xE5, 
+0xA1, 0x57, 0xCE, 0xB4, 0x75, 0x1D, 0xD3, 0x15, 0x98, 0xF5, 0x33, 0x71, 0x8A, 0x5B, 0xF4, 0x66, 
+0x05, 0xBA, 0xFA, 0xB8, 0x9A, 0x92, 0xB5, 0x03, 0x34, 0x3E, 0x52, 0x3B, 0xBD, 0x3E, 0x8F, 0xE9, 
+0xAA, 0xEE, 0xAA, 0x76, 0xAC, 0x2F, 0xBF, 0x67, 0x41, 0x51, 0x37, 0x32, 0x5B, 0xBA, 0xA9, 0x0C, 
+0x0E, 0x7D, 0x39, 0x72, 0x7D, 0xBE, 0x08, 0x74, 0xCA, 0xC8, 0x08, 0x9B, 0xBE, 0xD7, 0x53, 0xB9, 
+0x24, 0xDA, 0xE8, 0x7B, 0xCE, 0xA8, 0xE2, 0x02, 0xB9, 0x7E, 0xA9, 0x7D, 0x7B, 0x62, 0x2C, 0x5B, 
+0x0D, 0x88, 0xEA, 0x5B, 0x9D, 0x53, 0xAF, 0xAC, 0x29, 0x4D, 0x76, 0xB8, 0x11, 0x67, 0xCC, 0xA6, 
+0xE5, 0xB2, 0x78, 0xA7, 0x89, 0x29, 0x74, 0x63, 0xAE, 0xAC, 0x7D, 0xE5, 0x7D, 0x43, 0x88, 0x39, 
+0xAD, 0x54, 0x2A, 0xF5, 0x01, 0xC4, 0x99, 0xDE, 0x70, 0xED, 0x98, 0xC4, 0x27, 0xA0, 0x2D, 0x76, 
+0x55, 0xDD, 0xB5, 0x7D, 0xDC, 0xAD, 0x57, 0x0C, 0xB6, 0x72, 0x85, 0x05, 0x52, 0x7D, 0x27, 0x82, 
+0x12, 0x37, 0x25, 0x33, 0x9D, 0x9F, 0x6F, 0x50, 0x08, 0x22, 0x40, 0xA2, 0xD4, 0xC4, 0x3A, 0xC0, 
+0x59, 0x94, 0xD2, 0xE8, 0xAE, 0x6C, 0xD0, 0x39, 0x73, 0xC0, 0xE8, 0x47, 0x7B, 0x96, 0x7A, 0x20, 
+0xAB, 0xF9, 0x4E, 0xCF, 0x5A, 0x59, 0x71, 0x40, 0x7F, 0x29, 0xF6, 0x0D, 0x7F, 0x98, 0x38, 0x3E, 
+0xF8, 0x10, 0xF6, 0x20, 0xEC, 0x39, 0xA0, 0x77, 0x9F, 0x89, 0xC3, 0x38, 0x43, 0x47, 0xDF, 0xBE, 
+0xF8, 0x1D, 0x4E, 0x9C, 0x28, 0x17, 0x5A, 0xE6, 0xBA, 0xD1, 0x47, 0xB4, 0xB2, 0xD4, 0x6E, 0xAB, 
+0x13, 0x27, 0xD4, 0x1D, 0x64, 0x44, 0x2D, 0x20, 0x9E, 0x38, 0xDF, 0x5F, 0x41, 0x18, 0xBC, 0xED, 
+0x93, 0x10, 0x42, 0xD0, 0x3E, 0x03, 0x37, 0x74, 0xC3, 0x9F, 0x2A, 0xEF, 0x10, 0xBA, 0xE1, 0xA2, 
+0xA7, 0x29, 0xD6, 0x4D, 0x74, 0x4B, 0x9E, 0xAE, 0xF5, 0x49, 0x13, 0x32, 0x4E, 0x99, 0x92, 0x13, 
+0x27, 0x18, 0x40, 0x70, 0x09, 0x61, 0x00, 0x41, 0x08, 0xC1, 0x00, 0x2E, 0x8D, 0x6D, 0x61, 0x64, 
+0x37, 0x2C, 0x84, 0x87, 0x60, 0xE2, 0x84, 0x81, 0x03, 0xEB, 0x60, 0xE2, 0x04, 0xA1, 0x03, 0x0F, 
+0xE1, 0xC4, 0xB9, 0x72, 0x60, 0x1D, 0x9A, 0xD7, 0xE9, 0xF5, 0x79, 0x61, 0x7C, 0x2E, 0x57, 0x73, 
+0xFD, 0x61, 0xC9, 0xDF, 0x9B, 0x85, 0x5D, 0xD9, 0xA9, 0xB6, 0x50, 0x2A, 0xA5, 0xD5, 0x69, 0xB8, 
+0x35, 0xE5, 0xF6, 0xFB, 0x92, 0x1D, 0x6A, 0xB7, 0x9A, 0xD5, 0x57, 0x64, 0x36, 0xA2, 0x22, 0x4A, 
+0x11, 0xA2, 0x07, 0x3B, 0xD2, 0x68, 0x6D, 0x3F, 0xC5, 0xC4, 0xE9, 0xEB, 0x81, 0xDA, 0xEA, 0x2A, 
+0x2F, 0xBA, 0xD6, 0xF0, 0x62, 0x69, 0x31, 0xAF, 0xE1, 0xC4, 0xB9, 0xA8, 0xD0, 0xB2, 0x67, 0x1B, 
+0xEE, 0x18, 0x87, 0x8D, 0xD6, 0x3D, 0x2F, 0x2C, 0xEC, 0xED, 0x93, 0x6E, 0xD1, 0xF7, 0x06, 0x3D, 
+0xDB, 0xC6, 0x3C, 0x35, 0xF5, 0x31, 0xF4, 0x2E, 0x06, 0x05, 0x24, 0xFB, 0x68, 0x7A, 0xBA, 0xF2, 
+0x2E, 0x87, 0xC5, 0x8C, 0x99, 0xC7, 0xA6, 0x96, 0xF5, 0x09, 0xBE, 0x68, 0x98, 0xE0, 0x83, 0xD1, 
+0x10, 0x1E, 0xB5, 0xDE, 0x8E, 0xA4, 0xC0, 0x51, 0x1F, 0x8A, 0xC5, 0x79, 0x7C, 0x2C, 0xD6, 0x7A, 
+0x67, 0x28, 0xC6, 0xEF, 0x91, 0xF0, 0x2B, 0x12, 0x45, 0xF9, 0xD1, 0x94, 0x54, 0x2B, 0x67, 0xD3, 
+0x9D, 0x8C, 0x65, 0x94, 0x95, 0x5D, 0xC9, 0x0C, 0x8A, 0x67, 0xDB, 0x0C, 0x2A, 0x02, 0x64, 0x25, 
+0x43, 0xC8, 0x05, 0xBF, 0xBF, 0xD1, 0x37, 0xD4, 0x4E, 0x5B, 0xD7, 0xB4, 0xCF, 0x8A, 0x14, 0x69, 
+0x34, 0x67, 0x6D, 0xBA, 0xDF, 0x91, 0x6B, 0xB1, 0x39, 0x65, 0x16, 0xAC, 0x56, 0x99, 0x34, 0xE3, 
+0x4C, 0x6F, 0x71, 0x99, 0xA1, 0x20, 0x2A, 0x17, 0x64, 0x93, 0x09, 0x2B, 0x5E, 0xF4, 0x3A, 0x70, 
+0x67, 0xFC, 0x01, 0x66, 0x73, 0x77, 0x8D, 0x69, 0xAA, 0xC7, 0x73, 0xFB, 0xDB, 0xAF, 0x3B, 0x1C, 
+0x54, 0x12, 0x6D, 0x8D, 0x00, 0x7B, 0x9B, 0x2F, 0x16, 0xA4, 0x81, 0xE8, 0xBA, 0x45, 0x2F, 0x4D, 
+0xD6, 0x5A, 0xDD, 0x76, 0xA6, 0xBF, 0xFD, 0x7A, 0x73, 0x24, 0x27, 0xD7, 0x84, 0x72, 0x67, 0xFA, 
+0x9A, 0x0A, 0x84, 0xD7, 0xCB, 0x99, 0x16, 0x54, 0x70, 0x1F, 0xD5, 0x51, 0xD6, 0x9B, 0xB9, 0x2D, 
+0x85, 0xD5, 0x1A, 0xBF, 0x65, 0xE1, 0xF3, 0x38, 0x7E, 0x9B, 0x2F, 0x31, 0x26, 0xF1, 0x63, 0xFC, 
+0xCE, 0x34, 0x57, 0xD3, 0xB7, 0xAF, 0x9E, 0x41, 0xEE, 0x16, 0xDF, 0x09, 0x04, 0xBF, 0x3A, 0x9D, 
+0xDE, 0x02, 0x39, 0xFC, 0xD9, 0x8A, 0x67, 0xE4, 0xAB, 0x30, 0xAC, 0x85, 0xE1, 0x1A, 0xBB, 0xBA, 
+0xE0, 0x79, 0xCC, 0xBE, 0xCF, 0x31, 0xE5, 0x8F, 0xF1, 0x3A, 0x17, 0x88, 0xCC, 0x99, 0xBE, 0x7F, 
+0x0E, 0xB1, 0x16, 0xDA, 0xFF, 0x86, 0xD4, 0x18, 0xE1, 0x96, 0xEA, 0x5D, 0xFE, 0xAB, 0xB0, 0x9A, 
+0xEA, 0xAB, 0x65, 0x8D, 0x56, 0x53, 0xF2, 0x3C, 0x5E, 0xDF, 0xE5, 0x4B, 0xCA, 0xB8, 0xA4, 0x27, 
+0x44, 0x2D, 0x17, 0x84, 0xCD, 0x75, 0x93, 0xE7, 0xD0, 0x5B, 0x40, 0xFC, 0xBA, 0xFC, 0x7E, 0xA7, 
+0xA5, 0x1F, 0x83, 0x1D, 0xDE, 0xE5, 0xCB, 0xCF, 0xFF, 0x66, 0x34, 0xDA, 0xA5, 0xB8, 0x99, 0xE9, 
+0xE7, 0x71, 0xF5, 0x46, 0xEA, 0x63, 0x24, 0xC4, 0x98, 0xC2, 0x2D, 0x61, 0xFF, 0xC8, 0xF1, 0x08, 
+0xD2, 0xBA, 0xF6, 0xE0, 0x34, 0x54, 0xD6, 0xC5, 0x86, 0xD2, 0x42, 0x73, 0x65, 0x65, 0x05, 0x23, 
+0x02, 0x38, 0x65, 0x93, 0xAD, 0xD4, 0xA0, 0x8F, 0x1D, 0x6B, 0x7D, 0x6E, 0x2C, 0x35, 0x06, 0xFF, 
+0xD5, 0x78, 0x7B, 0x06, 0x3E, 0x80, 0x44, 0x8B, 0xC2, 0x4D, 0x20, 0x6A, 0x6A, 0x6E, 0x23, 0xCA, 
+0xAA, 0x4A, 0xEB, 0x3C, 0x9E, 0xFB, 0x09, 0xBB, 0x7B, 0xDE, 0x2C, 0x67, 0x75, 0x5C, 0x44, 0xDA, 
+0x6F, 0x6F, 0x31, 0xDE, 0x3A, 0xAE, 0x95, 0x4E, 0x3F, 0xFF, 0x33, 0x55, 0x74, 0xC9, 0x21, 0x4D, 
+0x91, 0x91, 0x98, 0x8F, 0x40, 0xF7, 0x9A, 0xED, 0x79, 0x32, 0xBF, 0x9F, 0x71, 0x97, 0x72, 0x5E, 
+0xF1, 0x73, 0x4F, 0x04, 0xA3, 0x6C, 0x6E, 0x8E, 0xAA, 0x47, 0x66, 0xAF, 0x2A, 0x2C, 0x3B, 0x07, 
+0x0D, 0x2A, 0xDC, 0x44, 0x84, 0xAD, 0x88, 0xDC, 0xF4, 0xF3, 0x3E, 0x23, 0xE2, 0x4E, 0x9F, 0x2D, 
+0xCC, 0xC9, 0xCF, 0xD4, 0xED, 0x1F, 0x2A, 0xBE, 0x2C, 0x5A, 0xCB, 0x58, 0x68, 0x92, 0xFD, 0x8E, 
+0x84, 0xB2, 0x4D, 0x1D, 0x06, 0x7E, 0x51, 0x50, 0xF8, 0xA9, 0x7F, 0xF9, 0x39, 0x76, 0xA6, 0x7F, 
+0x12, 0x9F, 0xFF, 0x95, 0xD0, 0x88, 0x8F, 0xA0, 0xE9, 0xFC, 0xD0, 0x80, 0xF7, 0x08, 0x27, 0xC5, 
+0x85, 0xDA, 0xA4, 0xB1, 0xC7, 0x29, 0x69, 0xFE, 0x41, 0x9E, 0x55, 0x0E, 0x4C, 0x2F, 0xEF, 0x8D, 
+0x01, 0x4C, 0x60, 0xA3, 0x4E, 0x45, 0x02, 0x89, 0xC2, 0xE2, 0x77, 0x71, 0x9D, 0xB6, 0xF5, 0xA0, 
+0xE5, 0x82, 0x8A, 0xBD, 0x27, 0x45, 0xA4, 0xEF, 0xFC, 0xE7, 0xA6, 0xCC, 0xF3, 0x49, 0x14, 0x06, 
+0x3D, 0x1C, 0x78, 0x3F, 0xCB, 0x76, 0xDD, 0x2E, 0xC6, 0x04, 0x05, 0x4C, 0x40, 0xAB, 0x07, 0xBB, 
+0x3F, 0x06, 0xD3, 0xA3, 0x63, 0xF1, 0xCD, 0x82, 0xA6, 0x71, 0xA7, 0xD2, 0x66, 0xA3, 0x8A, 0x54, 
+0x7F, 0x89, 0x65, 0x51, 0x4A, 0x11, 0x4D, 0x9C, 0x73, 0x7D, 0xCD, 0xF0, 0x86, 0x17, 0x71, 0xD8, 
+0x1B, 0x5C, 0x5E, 0x78, 0x3F, 0x4B, 0x07, 0x4C, 0x2F, 0xD3, 0x56, 0x4D, 0x31, 0x28, 0xA4, 0x82, 
+0x73, 0xF3, 0x23, 0xCA, 0xFF, 0x02, 0xC9, 0x1E, 0xA7, 0xD0, 0x54, 0x29, 0x00, 0x00, 0x00
+};
+
+const char view_html_br[] PROGMEM = {
+0x1B, 0x53, 0x29, 0x00, 0xAC, 0x06, 0x6C, 0x63, 0x22, 0xDE, 0x10, 0xB6, 0xD9, 0x1E, 0xCD, 0x2D, 
+0x9B, 0xB1, 0xC8, 0xE1, 0x8F, 0x17, 0x15, 0x27, 0x06, 0xCD, 0x17, 0x75, 0x6F, 0xD3, 0xEA, 0x62, 
+0x4A, 0x71, 0xA5, 0x67, 0xEE, 0x01, 0xC1, 0x6E, 0xC7, 0xD6, 0xE1, 0xA7, 0xA4, 0x80, 0xFB, 0xD2, 
+0xC2, 0xC6, 0xD8, 0x39, 0xDF, 0x27, 0x3F, 0x10, 0x5A, 0x66, 0xAE, 0x69, 0xE5, 0xBB, 0x2D, 0xB6, 
+0x82, 0xFD, 0xE7, 0xDF, 0xFA, 0x1A, 0x49, 0x1E, 0x63, 0x01, 0x1F, 0x72, 0xD6, 0x7D, 0xFC, 0x06, 
+0xF1, 0xE9, 0x49, 0x49, 0x81, 0xB7, 0xFE, 0x25, 0x1D, 0x85, 0xA6, 0x06, 0xEB, 0x84, 0x88, 0x5F, 
+0x2D, 0x7B, 0xA5, 0x8A, 0x09, 0x0A, 0x10, 0xB1, 0x0F, 0xB0, 0x22, 0xC2, 0x29, 0x60, 0xF5, 0xEB, 
+0x9E, 0x29, 0xCF, 0xDE, 0x9E, 0xD2, 0x9D, 0x53, 0xB8, 0x73, 0x48, 0x61, 0xBA, 0x7B, 0x67, 0x77, 
+0x1D, 0x63, 0x04, 0xC4, 0x65, 0x6E, 0x84, 0x5C, 0x2E, 0x6E, 0x08, 0xBF, 0x65, 0x26, 0xD3, 0x1A, 
+0x72, 0x90, 0x5C, 0x2B, 0xAE, 0xB2, 0xDC, 0x57, 0x0E, 0x0E, 0xFC, 0x37, 0xF8, 0x99, 0xED, 0xC0, 
+0xBC, 0x3F, 0x05, 0xD0, 0x15, 0x3B, 0x72, 0xD4, 0x1A, 0x71, 0x19, 0xF6, 0x12, 0x97, 0xD1, 0xC1, 
+0x89, 0x4C, 0xDD, 0xE7, 0x50, 0x42, 0xCA, 0x31, 0x9B, 0xA6, 0xCC, 0x8D, 0x41, 0x07, 0x70, 0x33, 
+0x22, 0x3E, 0x54, 0xE2, 0x3F, 0x29, 0x57, 0x74, 0xF2, 0xFF, 0xB9, 0x01, 0xF5, 0x26, 0x9C, 0x72, 
+0x0A, 0x48, 0x9C, 0x22, 0xF3, 0x42, 0x72, 0x31, 0x06, 0x3B, 0x63, 0xD7, 0xD3, 0x61, 0x8F, 0xEB, 
+0x10, 0x6D, 0x01, 0xBE, 0xA9, 0xA6, 0x62, 0x11, 0xD9, 0x1B, 0xD3, 0xA4, 0xFE, 0x8B, 0xF5, 0x7C, 
+0xCE, 0x55, 0x5D, 0xE4, 0x52, 0x11, 0x41, 0x49, 0x4A, 0xD9, 0x99, 0xFC, 0xBA, 0x38, 0x4D, 0x2F, 
+0x0E, 0xC7, 0x74, 0x13, 0xFE, 0x90, 0x87, 0x05, 0x89, 0x18, 0xA5, 0x93, 0xB4, 0x37, 0xCD, 0x95, 
+0x4A, 0x96, 0x86, 0xE0, 0x6C, 0x33, 0x9B, 0xC6, 0xEE, 0x98, 0x10, 0x49, 0x94, 0xC7, 0xBD, 0xA8, 
+0x79, 0x1F, 0xCA, 0x24, 0xDC, 0x22, 0x2F, 0xD0, 0x6B, 0x08, 0x7B, 0x40, 0xA7, 0x52, 0x2C, 0x27, 
+0x8E, 0x8D, 0x77, 0x47, 0x51, 0x4D, 0x5B, 0x0A, 0x45, 0x93, 0xD8, 0x98, 0x22, 0x83, 0xAF, 0xB6, 
+0xB8, 0xFC, 0x9C, 0xEE, 0xF9, 0xA7, 0x0F, 0xE9, 0x9C, 0xF7, 0xD1, 0xA5, 0x52, 0xF8, 0xB1, 0x29, 
+0x6C, 0xF4, 0x93, 0xAE, 0xA1, 0xB3, 0x31, 0xBE, 0xAA, 0x90, 0xC3, 0x89, 0xF7, 0xA8, 0x3A, 0x00, 
+0x0E, 0xB9, 0x7F, 0x2A, 0xC1, 0x1B, 0x42, 0x2F, 0xB2, 0xEB, 0x40, 0xB3, 0x6F, 0x66, 0x44, 0x79, 
+0x8C, 0xD9, 0xC8, 0x83, 0x0F, 0x76, 0x73, 0xD9, 0xA9, 0x74, 0xC4, 0x8A, 0xCF, 0x8E, 0xEC, 0xC7, 
+0xB6, 0x75, 0xA1, 0x69, 0x6A, 0x37, 0x89, 0x61, 0x4F, 0x19, 0xBB, 0x71, 0xBA, 0x57, 0x67, 0x18, 
+0x7C, 0x29, 0x64, 0x05, 0xD9, 0x26, 0x76, 0xB6, 0x43, 0x54, 0xD0, 0xFE, 0x84, 0xB0, 0x20, 0x99, 
+0x40, 0xE4, 0xC3, 0xAD, 0xA1, 0x5A, 0x68, 0xE9, 0x32, 0x06, 0x5D, 0xD7, 0xE9, 0xA1, 0x5B, 0xE8, 
+0x6D, 0x6C, 0xCD, 0xCF, 0xF4, 0x97, 0xE0, 0x57, 0x42, 0x12, 0x0E, 0x5A, 0x62, 0xE3, 0x6A, 0xF3, 
+0x35, 0x1B, 0xCC, 0x1C, 0x11, 0x14, 0x6D, 0xFD, 0x7D, 0x25, 0x12, 0x0E, 0xC8, 0x62, 0xDD, 0xDB, 
+0xEF, 0xFA, 0xC3, 0x25, 0x6F, 0x24, 0x72, 0x3F, 0xE2, 0x86, 0x64, 0x0A, 0x57, 0xAE, 0xFF, 0x9F, 
+0xCD, 0xE7, 0x15, 0xB5, 0x55, 0x06, 0x50, 0x8F, 0xC5, 0xC9, 0x35, 0xDA, 0x22, 0x0C, 0x9E, 0xB4, 
+0xB8, 0xEC, 0x25, 0x1B, 0x9C, 0xF3, 0x09, 0xCD, 0x92, 0x56, 0x49, 0x12, 0x32, 0xB0, 0x08, 0x79, 
+0x58, 0x8A, 0x3C, 0xE4, 0x9A, 0x73, 0x00, 0xB5, 0xE7, 0xFA, 0x39, 0xC3, 0xDB, 0x16, 0xFE, 0xAD, 
+0xB4, 0x21, 0xBA, 0xB0, 0x96, 0x5C, 0xF2, 0xED, 0x5D, 0x08, 0xF2, 0x38, 0x78, 0x4B, 0x5E, 0x7B, 
+0xA5, 0xB6, 0x24, 0x73, 0xEF, 0x26, 0xF5, 0x19, 0x6B, 0x12, 0x07, 0x9D, 0x83, 0xF2, 0x40, 0xC5, 
+0x84, 0x8B, 0x65, 0xB7, 0x86, 0x15, 0xF5, 0x1A, 0x4B, 0x03, 0xB0, 0x07, 0xAF, 0x09, 0x8E, 0xA3, 
+0x8B, 0x60, 0x08, 0xD7, 0x34, 0x69, 0x26, 0x68, 0xED, 0x09, 0x27, 0x72, 0x90, 0x42, 0x59, 0xF2, 
+0x9D, 0x2D, 0xCE, 0xE8, 0x15, 0xEC, 0x18, 0xC1, 0x7E, 0x42, 0xDF, 0x8D, 0x76, 0x1A, 0xD1, 0x88, 
+0x4D, 0xDC, 0x14, 0x6E, 0x68, 0x86, 0x7A, 0x97, 0x21, 0x0A, 0x02, 0x73, 0x8A, 0x16, 0xFC, 0x3A, 
+0x80, 0xE6, 0xDF, 0xF3, 0xA1, 0x68, 0x88, 0x86, 0x98, 0x39, 0x3B, 0xCE, 0x29, 0xB6, 0x5F, 0xA2, 
+0x4A, 0x5D, 0xD0, 0x8C, 0xF0, 0xBD, 0xD4, 0xD0, 0xA2, 0x10, 0x35, 0x4E, 0xC7, 0x85, 0x92, 0x5C, 
+0x9E, 0x6A, 0x66, 0x54, 0xD7, 0xF6, 0xF0, 0x9F, 0x80, 0x32, 0xE2, 0x81, 0x87, 0x3C, 0x97, 0x37, 
+0x7C, 0x13, 0xEC, 0x61, 0x5B, 0xFE, 0x26, 0xFC, 0xE5, 0x0E, 0x6F, 0xEC, 0xD8, 0xA9, 0xF4, 0x52, 
+0xA3, 0x52, 0x4E, 0xE1, 0x3A, 0x0B, 0x10, 0xED, 0x87, 0xA6, 0xB2, 0x50, 0xFC, 0x12, 0xBF, 0x8B, 
+0xBD, 0x90, 0xE8, 0x85, 0xCA, 0x7D, 0xD8, 0x94, 0x08, 0xF1, 0x33, 0xB8, 0x99, 0xEC, 0x64, 0x3F, 
+0xE4, 0x8C, 0x66, 0x33, 0xC1, 0x48, 0xF6, 0xB2, 0x0F, 0x33, 0x95, 0x14, 0x59, 0x17, 0x72, 0xEF, 
+0x80, 0x33, 0x15, 0xB2, 0x08, 0x94, 0x24, 0xE0, 0x6B, 0xA0, 0x09, 0x7D, 0xD4, 0x82, 0x34, 0x7E, 
+0x99, 0xCE, 0xCB, 0x03, 0x60, 0x19, 0x0F, 0x78, 0x6B, 0xEC, 0xD3, 0x1C, 0x39, 0xF9, 0x3C, 0xEE, 
+0xB7, 0x1E, 0xC0, 0x6A, 0xDC, 0x1F, 0xBA, 0xEA, 0xB8, 0x5F, 0x78, 0xB0, 0xA6, 0xC4, 0x39, 0x6D, 
+0x86, 0x67, 0x6C, 0x7E, 0xC2, 0x96, 0x48, 0x39, 0x62, 0x3C, 0x98, 0x1C, 0x26, 0xC0, 0x49, 0x6C, 
+0x6B, 0x7C, 0x53, 0x76, 0x7F, 0x6D, 0x86, 0x31, 0x9E, 0x3C, 0x26, 0xC8, 0x3B, 0x7F, 0x4D, 0x29, 
+0x0E, 0xA1, 0xBF, 0x55, 0x43, 0xDF, 0x7F, 0x60, 0xFF, 0x7B, 0x57, 0xBF, 0x8F, 0x3D, 0xC0, 0x32, 
+0xB2, 0x28, 0xA7, 0x4E, 0xEB, 0xD8, 0xA1, 0x1D, 0xCE, 0x5A, 0x2C, 0xBD, 0xE0, 0x86, 0x6A, 0xCB, 
+0x2C, 0x2A, 0xE8, 0x66, 0x6C, 0xD1, 0xC1, 0x47, 0x5F, 0xBE, 0x82, 0x23, 0x4D, 0xBB, 0x89, 0x49, 
+0x13, 0xAB, 0x5B, 0xBB, 0xE3, 0x57, 0xF2, 0xC1, 0x37, 0x4C, 0x30, 0x14, 0xE0, 0x85, 0xA3, 0xEC, 
+0x95, 0x44, 0xAC, 0xD0, 0xC3, 0x5D, 0xE1, 0xDF, 0xE7, 0x88, 0xA9, 0xD4, 0xF7, 0xA9, 0x6B, 0x58, 
+0x36, 0x9A, 0x20, 0xF5, 0x1C, 0x2E, 0xB2, 0x03, 0x09, 0x6B, 0x86, 0x2C, 0xC4, 0xB9, 0x73, 0x22, 
+0x1C, 0x27, 0xC7, 0x36, 0xA0, 0x8B, 0xC4, 0xAB, 0x48, 0x4B, 0x9C, 0x24, 0x7A, 0xD1, 0xB1, 0x45, 
+0x95, 0xF1, 0x64, 0xE6, 0x96, 0x80, 0x47, 0x84, 0x09, 0x27, 0xD3, 0xBD, 0x12, 0x15, 0xFE, 0xD0, 
+0x8C, 0x6B, 0x9E, 0xBE, 0x57, 0x44, 0x9A, 0xE1, 0x29, 0x3B, 0xC9, 0x92, 0x83, 0xB1, 0xDC, 0xEF, 
+0x5E, 0xED, 0x5B, 0xC1, 0x73, 0xFF, 0x86, 0xD6, 0xA4, 0x5C, 0xB1, 0x12, 0x07, 0x85, 0xAF, 0xC2, 
+0xA9, 0x44, 0xDA, 0x1E, 0xA0, 0x03, 0xA4, 0x71, 0x80, 0x77, 0xEF, 0xB5, 0x40, 0x4C, 0x5E, 0x63, 
+0x91, 0x8E, 0x5C, 0x27, 0x40, 0xB0, 0xBA, 0x25, 0xDC, 0x57, 0xC4, 0xE2, 0x7B, 0x09, 0x5A, 0x90, 
+0xAE, 0x7C, 0x46, 0xB1, 0xCA, 0x0E, 0xFF, 0xAB, 0x01, 0xA1, 0xC8, 0xBC, 0x40, 0xCF, 0xBF, 0x06, 
+0x87, 0xDB, 0xCC, 0x2F, 0x58, 0x83, 0x63, 0x68, 0x28, 0xC4, 0xC4, 0x61, 0x5F, 0x74, 0xD2, 0x22, 
+0x78, 0x82, 0x18, 0xEB, 0xBA, 0xC5, 0xCD, 0x36, 0xC1, 0x3B, 0x54, 0xE0, 0xCF, 0x9B, 0x49, 0x80, 
+0x44, 0x36, 0x9F, 0xB4, 0xBD, 0xDC, 0x7F, 0x1D, 0x9B, 0xF9, 0xE5, 0x0E, 0xB6, 0x5C, 0x1A, 0xC6, 
+0x15, 0xB5, 0x7C, 0x4B, 0x0C, 0x88, 0xB6, 0x0E, 0xAF, 0x5B, 0x2F, 0x39, 0x48, 0x77, 0x26, 0xC6, 
+0xB6, 0xBF, 0x29, 0x6C, 0xFD, 0x8D, 0x22, 0xD1, 0xBD, 0x7A, 0x3F, 0xB1, 0x3C, 0x41, 0x0A, 0x4C, 
+0x9A, 0x5C, 0x05, 0x1B, 0xBF, 0xB2, 0xD5, 0x93, 0x26, 0xB8, 0xA4, 0x10, 0xD8, 0x35, 0xAC, 0xE1, 
+0x14, 0x94, 0x8A, 0x94, 0x86, 0x9D, 0xAF, 0x48, 0x33, 0xDA, 0x31, 0xEA, 0x03, 0xC9, 0xAD, 0x72, 
+0x5F, 0xC1, 0x89, 0x33, 0x7D, 0x09, 0x78, 0xB5, 0x02, 0x32, 0xCF, 0xA3, 0x15, 0x16, 0x0F, 0x2A, 
+0x0F, 0x83, 0x57, 0x09, 0x5C, 0x72, 0x96, 0x03, 0xEB, 0x3C, 0x97, 0x23, 0xCD, 0x12, 0xD1, 0x5C, 
+0xB4, 0x9B, 0xFC, 0x2E, 0x4C, 0xB3, 0x3A, 0x0D, 0xC9, 0x81, 0x8A, 0x18, 0x60, 0x25, 0x0A, 0x31, 
+0xAB, 0x5C, 0xC0, 0xB7, 0xBC, 0xC4, 0x5E, 0xC2, 0x1E, 0x86, 0xDD, 0xB2, 0x07, 0x1A, 0xF5, 0x19, 
+0x7B, 0x3E, 0xD9, 0x22, 0xC2, 0xF1, 0x75, 0x13, 0x93, 0xFC, 0x0A, 0x4B, 0x74, 0xF0, 0xFD, 0x14, 
+0x4D, 0xB1, 0xA7, 0x1E, 0xAA, 0x29, 0x81, 0xEF, 0x9C, 0x70, 0xF9, 0x74, 0x23, 0xD5, 0x8F, 0x18, 
+0x9B, 0xAA, 0xE9, 0xDA, 0x74, 0x26, 0xC5, 0x55, 0x63, 0xB8, 0x70, 0x59, 0x82, 0x26, 0xCA, 0x39, 
+0x92, 0x77, 0xA5, 0xE6, 0x5A, 0x68, 0xC5, 0xE7, 0xEA, 0x31, 0xC2, 0x7F, 0xBB, 0x52, 0x4D, 0x37, 
+0x0F, 0x04, 0x56, 0x18, 0x55, 0x59, 0x49, 0x85, 0xB5, 0x25, 0xDC, 0x85, 0x1B, 0x5F, 0x1E, 0x31, 
+0x6F, 0x57, 0x72, 0x5A, 0xAD, 0x6E, 0x45, 0xD6, 0x30, 0x8F, 0xEA, 0x0A, 0xAB, 0xB0, 0x6C, 0xC0, 
+0xA2, 0x6B, 0x8E, 0x82, 0x72, 0x24, 0x66, 0x84, 0x01, 0x00, 0xBB, 0xC9, 0x0E, 0x98, 0xCE, 0xF5, 
+0x2A, 0x3B, 0x26, 0x7C, 0xF4, 0xB3, 0xEB, 0x3C, 0xEC, 0x5D, 0x6D, 0x4C, 0xBB, 0xE0, 0x50, 0x84, 
+0x71, 0x73, 0x94, 0xDD, 0x43, 0x71, 0xA1, 0x7C, 0xE3, 0x3A, 0x3C, 0x17, 0xC3, 0xB5, 0xCE, 0x0E, 
+0x92, 0x83, 0x9B, 0x61, 0xED, 0x99, 0x39, 0x1C, 0x13, 0xDF, 0xF7, 0x33, 0x3B, 0x9B, 0x9B, 0x27, 
+0x9D, 0x8C, 0x3B, 0x8E, 0xB7, 0x8D, 0x08, 0x12, 0x3A, 0x9C, 0x40, 0x3E, 0x71, 0xB2, 0x04, 0x7F, 
+0xCB, 0x8F, 0x15, 0xFD, 0x45, 0xA7, 0x1E, 0x84, 0x92, 0x5F, 0x69, 0xEA, 0x64, 0xDC, 0xD5, 0x44, 
+0x1E, 0x0A, 0xDD, 0x6B, 0x68, 0x9C, 0xB9, 0xA1, 0x11, 0x5A, 0xD0, 0x6B, 0xDB, 0xBA, 0x34, 0x66, 
+0x0D, 0x88, 0xBB, 0x02, 0xAA, 0x25, 0xE5, 0xB7, 0xF1, 0xE2, 0xFA, 0x5A, 0x99, 0xBF, 0x80, 0x11, 
+0x34, 0x7D, 0xBF, 0x1F, 0x77, 0x18, 0xDC, 0x89, 0xFF, 0xA3, 0xBF, 0x0E, 0xDF, 0x3B, 0xF5, 0xF3, 
+0x86, 0x58, 0xD9, 0x29, 0x93, 0xF5, 0xF4, 0x42, 0xE8, 0x3F, 0xC5, 0x13, 0x5D, 0x0F, 0xB3, 0x27, 
+0x16, 0xC8, 0x51, 0xAA, 0xD4, 0x37, 0xD0, 0xF1, 0x44, 0xA6, 0x65, 0x01, 0xF8, 0x1F, 0x56, 0x59, 
+0x1E, 0x1A, 0x13, 0x7E, 0x6C, 0x99, 0x0D, 0xE8, 0xEC, 0x1D, 0x0D, 0x3D, 0x0A, 0x8B, 0xA9, 0x9C, 
+0xEE, 0x82, 0x40, 0x60, 0x3D, 0xA8, 0x6F, 0xC2, 0xC7, 0xAA, 0x13, 0x0C, 0xE0, 0xA1, 0x8A, 0x2A, 
+0x4A, 0x83, 0x88, 0x45, 0x24, 0x79, 0x38, 0xC1, 0x9F, 0x90, 0xC8, 0xF2, 0x6F, 0xAE, 0x9B, 0x75, 
+0x59, 0x92, 0x26, 0x1E, 0x7A, 0x60, 0xEC, 0x64, 0x19, 0x0F, 0xD9, 0x39, 0x05, 0xC2, 0xA6, 0x66, 
+0x8C, 0xC8, 0x3C, 0x66, 0x71, 0x27, 0xA6, 0xC7, 0xF0, 0x4A, 0x42, 0xA9, 0x96, 0x9E, 0xEF, 0x20, 
+0xE9, 0x88, 0x21, 0x26, 0xD1, 0x62, 0x28, 0xE9, 0x49, 0xC7, 0x5C, 0x58, 0x83, 0x50, 0x87, 0xA5, 
+0x3C, 0xCD, 0x4C, 0xDC, 0x59, 0x32, 0x18, 0xDD, 0xB4, 0x0F, 0xB2, 0x96, 0x07, 0xE0, 0x64, 0x10, 
+0xD5, 0x3A, 0x0C, 0xDC, 0xA5, 0x96, 0x80, 0x84, 0xE5, 0x64, 0x7A, 0x36, 0x6B, 0x99, 0x74, 0x89, 
+0x9E, 0x64, 0x7A, 0x8D, 0x23, 0x1C, 0x15, 0xB4, 0x04, 0x05, 0xA6, 0x5D, 0x51, 0x92, 0x51, 0xDD, 
+0x59, 0xE2, 0x24, 0x8D, 0x36, 0x71, 0x90, 0x33, 0xB9, 0x12, 0x6B, 0xD9, 0xD6, 0xF0, 0x3E, 0x81, 
+0x1A, 0xF5, 0x53, 0xAB, 0x05, 0xA6, 0x80, 0x74, 0x65, 0x80, 0xA5, 0x80, 0x47, 0x9E, 0x2D, 0x1C, 
+0x7F, 0xB8, 0x48, 0x14, 0xA3, 0x66, 0xE5, 0x85, 0xFF, 0x34, 0xCC, 0x00, 0xA7, 0xC8, 0x20, 0x0B, 
+0x26, 0x46, 0xA9, 0x65, 0xA7, 0x71, 0x8D, 0x77, 0xE5, 0x20, 0xE3, 0x5F, 0x72, 0x29, 0x19, 0x5B, 
+0x3A, 0xA1, 0xB4, 0x2B, 0x52, 0xB3, 0x4C, 0x53, 0x60, 0x1E, 0xE8, 0xE8, 0x7D, 0xA7, 0xC9, 0x7D, 
+0xE8, 0x4E, 0x38, 0x7F, 0xF4, 0xFA, 0xCE, 0xA7, 0xA4, 0x48, 0xC1, 0x2A, 0xD8, 0xF5, 0xF3, 0x19, 
+0x4C, 0xB3, 0x18, 0x51, 0x0F, 0xEC, 0x92, 0xB8, 0xE5, 0xA9, 0x14, 0x0F, 0xF7, 0xE8, 0x0F, 0x3A, 
+0x43, 0x90, 0x14, 0x93, 0x27, 0x34, 0x00, 0xE0, 0xBF, 0xA7, 0xE9, 0x87, 0xA4, 0xC0, 0xAF, 0x5D, 
+0x86, 0x82, 0x22, 0x45, 0x8A, 0x7B, 0xF4, 0xF8, 0xA9, 0x36, 0x57, 0x1D, 0xF9, 0x6D, 0xD9, 0x4C, 
+0xD6, 0xC8, 0xF6, 0xC9, 0x71, 0x77, 0x69, 0x6D, 0xF2, 0xFF, 0x13, 0xD2, 0xEF, 0x65, 0xAF, 0x38, 
+0x28, 0xB0, 0x62, 0xA8, 0xBF, 0xAB, 0x60, 0x9E, 0x0D, 0x4A, 0xA5, 0x75, 0x26, 0x9B, 0x73, 0x6B, 
+0xBD, 0x00, 0xBC, 0xEE, 0xE2, 0xF7, 0x25, 0x8C, 0x25, 0xE7, 0xED, 0xE3, 0x92, 0xD2, 0xBC, 0x36, 
+0x59, 0x12, 0x0B, 0x93, 0x33, 0x1D, 0xFD, 0xAF, 0x1C, 0x01, 0x76, 0x4C, 0x68, 0xE8, 0x49, 0x22, 
+0xC1, 0xD3, 0xD1, 0x51, 0xC1, 0xF7, 0x85, 0x86, 0x41, 0xCD, 0x5E, 0xB1, 0x3C, 0xAB, 0x5E, 0x65, 
+0xC6, 0xFC, 0x53, 0x8D, 0x3B, 0x87, 0x76, 0x34, 0x5C, 0x7E, 0x9F, 0x8C, 0x53, 0xF7, 0x0A, 0x23, 
+0x9A, 0x37, 0x2B, 0x19, 0xBC, 0x8E, 0x18, 0x4B, 0x6D, 0x16, 0xDF, 0xFC, 0x1D, 0x61, 0xBB, 0x73, 
+0x6C, 0xA7, 0x59, 0x8D, 0x1B, 0xFE, 0xC2, 0xC7, 0xD4, 0x69, 0x6F, 0x6F, 0xB8, 0xF8, 0xFE, 0x4C, 
+0xA3, 0x36, 0xFE, 0x25, 0xFC, 0x89, 0xAF, 0x69, 0xD2, 0x21, 0xBE, 0xF0, 0xC5, 0xFD, 0xB2, 0x22, 
+0x79, 0x13, 0x53, 0x94, 0x22, 0xEE, 0x18, 0x36, 0xFC, 0xD0, 0x08, 0x01, 0xFA, 0x4D, 0x68, 0x2D, 
+0x79, 0x63, 0x1B, 0xFA, 0x09, 0x6E, 0x37, 0x4E, 0x82, 0xFE, 0x50, 0x75, 0xB7, 0x60, 0xCD, 0xDB, 
+0xA7, 0x56, 0xA9, 0x05, 0x74, 0xC5, 0x84, 0xCD, 0x16, 0x1A, 0xB6, 0xDA, 0x37, 0x20, 0x64, 0x5E, 
+0x4A, 0x90, 0x48, 0x1D, 0xE7, 0x47, 0x36, 0x75, 0xBA, 0x47, 0x5E, 0x96, 0xD8, 0xD9, 0x51, 0x18, 
+0xF7, 0x3C, 0x8B, 0xA3, 0x0E, 0xB8, 0x24, 0xD4, 0xDA, 0x32, 0x6A, 0x84, 0xF6, 0x32, 0x73, 0x4D, 
+0x4E, 0xA8, 0x45, 0xC2, 0xD2, 0x50, 0xBB, 0x44, 0x79, 0x01, 0xFB, 0xA0, 0x3C, 0xDB, 0xAC, 0x3C, 
+0x1C, 0x46, 0xC8, 0x93, 0x7E, 0xBF, 0x6D, 0x64, 0xB6, 0xE5, 0x8D, 0x82, 0xFD, 0x99, 0x56, 0x26, 
+0x73, 0xDC, 0xF7, 0x3E, 0xB9, 0x36, 0x68, 0xEE, 0xD4, 0xA7, 0x7A, 0xDB, 0xB3, 0x72, 0x59, 0x83, 
+0xE5, 0xD7, 0xBA, 0xEF, 0x89, 0x8C, 0xFC, 0x80, 0xDA, 0x14, 0x65, 0xA5, 0x9C, 0x6F, 0xC0, 0xDF, 
+0x00, 0xAE, 0x6A, 0x1E, 0x07, 0x8D, 0x0E, 0xF8, 0xFC, 0x71, 0xBD, 0x3E, 0x99, 0x31, 0x21, 0x5D, 
+0x68, 0x02, 0xD7, 0x47, 0xFA, 0xF5, 0xD6, 0x73, 0xA0, 0xB1, 0x9C, 0xC9, 0xF7, 0xD0, 0xD6, 0x55, 
+0xA8, 0xAF, 0xCD, 0x01, 0xD4, 0x3F, 0xFB, 0x72, 0xC4, 0x2F, 0x02, 0x87, 0x35, 0x87, 0x49, 0xB1, 
+0x03, 0xEE, 0x62, 0x1F, 0x51, 0x45, 0x57, 0xCC, 0x61, 0x7B, 0x8F, 0x7F, 0xDB, 0x40, 0xDE, 0x6C, 
+0x64, 0xEC, 0x88, 0xF8, 0xFC, 0xCE, 0x74, 0xBF, 0x61, 0xB0, 0x8D, 0xDE, 0xA0, 0xDA, 0xC1, 0xDB, 
+0xD7, 0xFA, 0xFE, 0x64, 0x26, 0x21, 0x66, 0x49, 0xB9, 0x7C, 0x84, 0x33, 0xF7, 0xF8, 0xFB, 0x1B, 
+0xC8, 0x9C, 0x55, 0x9F, 0xE9, 0x0D, 0xFC, 0x03, 0xFA, 0x6F, 0x6D, 0xDE, 0x4E, 0x66, 0xFF, 0x9B, 
+0x8B, 0x63, 0x73, 0x01, 0xB7, 0x3B, 0xE0, 0x17, 0xEF, 0x42, 0xEB, 0x5F, 0x4A, 0xBC, 0x33, 0x1F, 
+0x79, 0xFE, 0x57, 0x30, 0xB5, 0x06, 0xFE, 0x60, 0xF9, 0xE9, 0x01, 0x0E, 0x62, 0x0A, 0xFC, 0x62, 
+0x68, 0x01, 0x53, 0x2C, 0x06, 0x6B, 0x19, 0xDC, 0x60, 0x0E, 0x08, 0x7B, 0x8B, 0xB4, 0x75, 0x6F, 
+0x3E, 0x0C, 0x73, 0x04, 0x86, 0x5D, 0x42, 0x34, 0xA2, 0xEB, 0x1A, 0xD2, 0x48, 0xED, 0xDD, 0xBA, 
+0x8F, 0x6A, 0xD8, 0xEB, 0xE0, 0xF5, 0x0E, 0x3E, 0x6D, 0x23, 0xCC, 0x12, 0xDC, 0x11, 0x93, 0xE3, 
+0xB6, 0xCE, 0x0D, 0xBB, 0xE3, 0xBF, 0xCA, 0x3E, 0x1A, 0x95, 0x2B, 0x05, 0xA4, 0x68, 0xF9, 0x7C, 
+0xC7, 0x4B, 0xD7, 0x30, 0x86, 0xE6, 0xB9, 0x30, 0xCB, 0xFE, 0x5D, 0x0E, 0xB6, 0x07, 0x96, 0x7C, 
+0xBE, 0x99, 0xE0, 0xF2, 0x5D, 0xBA, 0x37, 0xA4, 0xF8, 0x73, 0x9D, 0x8B, 0xE1, 0x88, 0xD9, 0xAF, 
+0x25, 0xEF, 0xFF, 0xD0, 0x76, 0xB7, 0xCD, 0x63, 0xD6, 0x37, 0x13, 0x67, 0xA7, 0x29, 0x36, 0xA4, 
+0x07, 0x17, 0xFA, 0x6B, 0x9A, 0x9C, 0x41, 0x26, 0x82, 0x20, 0x8A, 0xC1, 0x2D, 0x43, 0x00, 0xFA, 
+0xCF, 0xDF, 0x9B, 0x0F, 0x5F, 0x8D, 0x77, 0x8A, 0xB8, 0x68, 0xB5, 0x21, 0x7C, 0x9A, 0x1B, 0xF3, 
+0x45, 0x3A, 0xD5, 0x28, 0xCA, 0x0A, 0xD9, 0xE2, 0x0F, 0xCA, 0x13, 0xF4, 0x00, 0x3E, 0xF1, 0x7D, 
+0x2B, 0x9A, 0x0C, 0xC7, 0xF7, 0xC6, 0xB1, 0xF7, 0xB3, 0x23, 0xA7, 0xAE, 0xAB, 0x3A, 0x54, 0xBF, 
+0x69, 0x9D, 0xF2, 0xD0, 0x66, 0xDB, 0xFC, 0x40, 0x5D, 0x6D, 0xF6, 0x92, 0xCA, 0xBF, 0x9C, 0xF6, 
+0x2C, 0x6F, 0xA0, 0x60, 0x7A, 0xDC, 0x63, 0x6E, 0x8F, 0x91, 0x11, 0x8D, 0x01, 0x18, 0xC3, 0x2C, 
+0x69, 0x1A, 0xE5, 0x1F, 0x8F, 0xA6, 0xC2, 0xFA, 0x60, 0xF4, 0xDF, 0x7C, 0xCF, 0xA7, 0xFB, 0xCD, 
+0xB2, 0x65, 0x8C, 0xE5, 0x04, 0x00
+};
+
+const size_t view_html_len = 2990;
+const size_t view_html_br_len = 2421;
+const size_t view_html_size = 10580; // Uncompressed
+const char view_html_hash[] = "06740f09";
+
+#endif
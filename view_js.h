@@ -1,381 +1,853 @@
-#ifndef VIEW_JS_H_H
-#define VIEW_JS_H_H
-
-#include <Arduino.h>
-
-const char view_js[] PROGMEM = {
-0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xED, 0x3D, 0x5D, 0x73, 0x1B, 0xB7, 
-0x76, 0xEF, 0x99, 0xC9, 0x7F, 0x80, 0x99, 0xE4, 0x92, 0x6A, 0x48, 0x8A, 0xA4, 0x44, 0xD9, 0x92, 
-0x2D, 0x67, 0x64, 0x59, 0x89, 0x35, 0x23, 0x27, 0xA9, 0xA5, 0x34, 0xD3, 0x7A, 0x3C, 0xE3, 0xE5, 
-0x2E, 0x48, 0xE2, 0x7A, 0xB9, 0xCB, 0xBB, 0x8B, 0x95, 0xC4, 0x38, 0x7A, 0xEC, 0x73, 0xDF, 0x3B, 
-0x7D, 0xE8, 0xFD, 0x01, 0x9D, 0xE9, 0x4C, 0x5F, 0xFA, 0xDC, 0xFC, 0x93, 0xFB, 0x07, 0xFA, 0x17, 
-0x7A, 0x0E, 0x80, 0xDD, 0x05, 0x76, 0x81, 0x25, 0x69, 0x27, 0xF1, 0xBD, 0x4D, 0xE8, 0x44, 0x5A, 
-0x2E, 0x70, 0x80, 0xF3, 0x85, 0x73, 0x0E, 0x0E, 0x3E, 0xB4, 0xBB, 0x4B, 0x4E, 0xE3, 0x68, 0xCA, 
-0x66, 0x59, 0xE2, 0xF9, 0xEC, 0xA7, 0xFF, 0x8A, 0x3E, 0xFE, 0x28, 0xA4, 0x9C, 0xF8, 0x73, 0x2F, 
-0xE1, 0x0F, 0xE5, 0x33, 0xF7, 0xA2, 0x37, 0x97, 0x4B, 0x2F, 0x79, 0x13, 0xB2, 0x88, 0x9E, 0x6A, 
-0x05, 0xA1, 0x97, 0xF2, 0xA7, 0x1E, 0xF7, 0xC8, 0x31, 0x89, 0xB2, 0x30, 0x84, 0xB7, 0x7E, 0x1C, 
-0xA5, 0x9C, 0x2C, 0xBC, 0x5B, 0x7C, 0xFD, 0x6D, 0xCC, 0x22, 0x9E, 0x42, 0xE1, 0x68, 0x5F, 0x01, 
-0xA4, 0x34, 0x4A, 0xE3, 0x04, 0xCB, 0xCE, 0x23, 0x4E, 0x93, 0x6B, 0x2F, 0x84, 0xD2, 0xF1, 0x60, 
-0x30, 0x78, 0x48, 0xC8, 0xEE, 0x2E, 0x79, 0x4A, 0xA7, 0x5E, 0x16, 0x72, 0x32, 0x4E, 0xBB, 0x24, 
-0x5B, 0x06, 0x1E, 0xA7, 0x01, 0x99, 0x26, 0xF1, 0x82, 0x4C, 0x3C, 0xFF, 0x0D, 0x8D, 0x02, 0xE2, 
-0x0B, 0x4C, 0xAB, 0x6D, 0x5D, 0xB1, 0x05, 0x8D, 0x33, 0x5E, 0x62, 0xF1, 0xF1, 0x47, 0x37, 0x2C, 
-0x0A, 0xE2, 0x9B, 0x7E, 0x1C, 0x85, 0xB1, 0x17, 0x40, 0xC1, 0x34, 0x8B, 0x7C, 0xCE, 0xE2, 0xA8, 
-0xB3, 0x43, 0xDE, 0x7E, 0xFC, 0x11, 0x21, 0xA2, 0xBB, 0xD3, 0x39, 0xF5, 0xDF, 0x10, 0x2F, 0xE3, 
-0x73, 0x1A, 0x71, 0xE6, 0x7B, 0x58, 0x41, 0x16, 0x4A, 0x32, 0x58, 0x7A, 0x52, 0x96, 0x51, 0x6C, 
-0x26, 0x8C, 0x7D, 0x2F, 0xBC, 0xE4, 0x71, 0xE2, 0xCD, 0x68, 0x7F, 0x46, 0xF9, 0x39, 0xA7, 0x8B, 
-0x4E, 0xBB, 0x52, 0xAF, 0xBD, 0xF3, 0x50, 0xB6, 0xC2, 0xA6, 0xA4, 0x73, 0xAF, 0xDA, 0xC8, 0x8F, 
-0x3F, 0xD6, 0xDA, 0xBD, 0x77, 0x7C, 0x4C, 0xDA, 0x3C, 0xC9, 0x68, 0xBB, 0xC0, 0x0E, 0x3F, 0x8A, 
-0x06, 0xEC, 0x13, 0x31, 0xEB, 0xCF, 0x13, 0x3A, 0x05, 0x1C, 0xDA, 0xBB, 0xED, 0x87, 0x65, 0xA5, 
-0x84, 0xF2, 0x2C, 0x89, 0xD4, 0x8B, 0x3B, 0xF9, 0xAB, 0x20, 0xF0, 0xDB, 0x84, 0x5E, 0x43, 0x37, 
-0x82, 0x7D, 0x64, 0x92, 0x71, 0x1E, 0x47, 0x92, 0x9F, 0x33, 0x90, 0xCC, 0x8C, 0xF0, 0x18, 0x08, 
-0x9A, 0x31, 0x45, 0xF3, 0x9C, 0xA5, 0x40, 0xD8, 0xAA, 0x9F, 0xD0, 0x65, 0xE8, 0xF9, 0xF4, 0x92, 
-0x03, 0x6E, 0x1D, 0x64, 0x68, 0x97, 0xC8, 0x9F, 0x36, 0x7C, 0x72, 0x52, 0x55, 0x99, 0x17, 0x04, 
-0x67, 0xD8, 0xE3, 0x05, 0xB4, 0x45, 0x23, 0x9A, 0x74, 0xDA, 0xCB, 0x78, 0x99, 0x62, 0x4B, 0xED, 
-0x6E, 0x29, 0x03, 0x81, 0x94, 0x41, 0x6A, 0xDE, 0xF7, 0x32, 0x4B, 0xE7, 0xDB, 0x75, 0x5C, 0x95, 
-0xD6, 0xD6, 0x42, 0xAA, 0x08, 0xAA, 0x94, 0x8F, 0x4B, 0x2C, 0x1B, 0x8B, 0x46, 0x49, 0xE3, 0x2E, 
-0xEF, 0xA9, 0x10, 0xCB, 0x79, 0xC4, 0x38, 0xF3, 0x42, 0xF6, 0x03, 0x25, 0x80, 0xD1, 0x82, 0x2A, 
-0x6D, 0x81, 0xB7, 0x57, 0xF8, 0xB5, 0x53, 0x03, 0x00, 0x96, 0x24, 0x9C, 0x4C, 0x29, 0xF7, 0xE7, 
-0x28, 0xB7, 0x00, 0x87, 0xDC, 0xF9, 0xF3, 0xE7, 0x67, 0x4F, 0xCF, 0x4F, 0xAE, 0xCE, 0x2E, 0xFE, 
-0xB1, 0xD4, 0xB6, 0x2A, 0x5E, 0xCB, 0x24, 0xE6, 0xB1, 0x1F, 0xC3, 0x28, 0x43, 0x5A, 0xA6, 0x2C, 
-0xA4, 0x47, 0x6D, 0xA4, 0xB0, 0x86, 0x7F, 0x9C, 0xF2, 0xC8, 0x5B, 0x50, 0x59, 0x4F, 0x30, 0x10, 
-0x5F, 0x6D, 0x50, 0x77, 0x38, 0xBA, 0xDF, 0x1F, 0xC0, 0xBF, 0xA1, 0xC9, 0xA4, 0x94, 0xF2, 0xA7, 
-0x74, 0x11, 0x3F, 0x8F, 0x83, 0x92, 0x9C, 0x3B, 0x42, 0xC3, 0x94, 0xEA, 0xB5, 0x04, 0x45, 0x97, 
-0xC5, 0x38, 0x2E, 0x6B, 0xBA, 0x19, 0x26, 0xEC, 0x52, 0x4A, 0xBC, 0x74, 0x15, 0xF9, 0xF3, 0x24, 
-0x8E, 0xE2, 0x2C, 0x0D, 0x57, 0x4A, 0x07, 0x3D, 0xC6, 0xBF, 0x8C, 0x13, 0x61, 0xA0, 0x44, 0x53, 
-0x77, 0xC2, 0x14, 0xE4, 0x6A, 0x57, 0x29, 0xCF, 0xF1, 0x40, 0xB6, 0xF1, 0xD5, 0x92, 0xC6, 0x53, 
-0x22, 0x4A, 0xA4, 0xD8, 0xB3, 0x28, 0xA0, 0x53, 0xB0, 0x76, 0x81, 0x49, 0x16, 0xCA, 0xA8, 0x6C, 
-0x3F, 0x7F, 0x8B, 0x18, 0x4E, 0xA5, 0x54, 0xE6, 0x1E, 0xE0, 0x16, 0x26, 0xD4, 0x0B, 0x56, 0xC4, 
-0x4B, 0x12, 0x76, 0x4D, 0x83, 0xDC, 0x94, 0xA1, 0xAC, 0xC9, 0x77, 0xE7, 0x84, 0x2D, 0x16, 0x34, 
-0x60, 0xF0, 0x22, 0xC7, 0x3B, 0xC7, 0x22, 0xB7, 0xA6, 0x35, 0x6D, 0x43, 0xFD, 0x8E, 0x43, 0x0A, 
-0x22, 0x98, 0x75, 0x5A, 0xA7, 0x92, 0x01, 0xA2, 0x8B, 0x2E, 0x81, 0xE1, 0x95, 0x85, 0x20, 0x17, 
-0xD0, 0x8A, 0x1B, 0x06, 0x3A, 0xEB, 0x7B, 0xFE, 0x1C, 0x2C, 0x0A, 0xE2, 0xD2, 0xEF, 0xF7, 0x5B, 
-0x3A, 0x96, 0xF8, 0x91, 0x98, 0x7C, 0x77, 0x5E, 0xF6, 0x65, 0xD1, 0xD7, 0x9A, 0x98, 0xF4, 0xFE, 
-0xDB, 0x67, 0xE9, 0x92, 0x26, 0x1E, 0xA8, 0x04, 0xF1, 0x24, 0xC3, 0xFA, 0x7F, 0x4C, 0xA1, 0x2B, 
-0x63, 0x3C, 0x81, 0xF4, 0x95, 0x4D, 0xEE, 0xE8, 0x4C, 0xEF, 0x92, 0xE1, 0x60, 0xA0, 0xC9, 0xF8, 
-0x0E, 0xC5, 0x03, 0xCC, 0xBB, 0x88, 0x67, 0x68, 0xBE, 0x73, 0x41, 0x69, 0x22, 0x0B, 0x45, 0x49, 
-0x29, 0x2C, 0x63, 0x68, 0x27, 0xA0, 0x60, 0xD7, 0xB4, 0x79, 0x74, 0x3B, 0x01, 0xB2, 0x94, 0x26, 
-0xA8, 0xC5, 0xEB, 0x6B, 0xB2, 0xF4, 0xAB, 0x8C, 0xC2, 0x58, 0xC8, 0x2B, 0x46, 0xDE, 0x35, 0x9B, 
-0x41, 0x27, 0xDF, 0x03, 0xBF, 0xAF, 0x80, 0x13, 0x29, 0x13, 0x46, 0xAD, 0x2D, 0x4C, 0x69, 0x7F, 
-0xCE, 0x17, 0xA1, 0xA8, 0x7A, 0x67, 0xE8, 0x9E, 0x03, 0x28, 0x4B, 0xC2, 0x82, 0xB6, 0x20, 0xF6, 
-0xB3, 0x05, 0x50, 0xD0, 0x9F, 0xC4, 0xC1, 0xAA, 0xEF, 0x83, 0x84, 0x52, 0x34, 0xA3, 0x68, 0x53, 
-0xC1, 0x8C, 0x02, 0x56, 0x3D, 0x7A, 0xCB, 0x50, 0xD2, 0x05, 0x26, 0x1A, 0x9B, 0xEB, 0xFE, 0xAD, 
-0xC1, 0x4C, 0x41, 0xAF, 0xB9, 0x10, 0xBA, 0x64, 0x24, 0x45, 0x92, 0xCB, 0x42, 0x58, 0x20, 0xF2, 
-0xDC, 0x8B, 0xA0, 0x43, 0xC4, 0x46, 0xA3, 0x41, 0x33, 0x50, 0x79, 0x27, 0xD2, 0xF2, 0x0A, 0x23, 
-0x76, 0x15, 0xCF, 0x66, 0x21, 0x7D, 0xC2, 0x23, 0xE8, 0xA0, 0x20, 0x05, 0xAC, 0xEF, 0x59, 0x28, 
-0xDA, 0x79, 0xB2, 0x3A, 0x07, 0x32, 0x44, 0xCD, 0x1E, 0x17, 0x55, 0x7B, 0x13, 0x1E, 0x15, 0xA4, 
-0xC8, 0x86, 0x52, 0x0F, 0xC6, 0x8B, 0xC4, 0xC0, 0x65, 0xC6, 0x45, 0x0B, 0x6D, 0xD3, 0x42, 0xE2, 
-0xE0, 0xD1, 0x41, 0x71, 0x00, 0x07, 0x10, 0xAE, 0x98, 0x63, 0xB7, 0x91, 0xBF, 0x58, 0xBD, 0x67, 
-0xB6, 0x6D, 0xC0, 0xE4, 0x0F, 0x8A, 0x9A, 0x0D, 0xC1, 0xE5, 0x70, 0x13, 0x58, 0x9D, 0x03, 0x85, 
-0x1D, 0x74, 0x26, 0xE0, 0x07, 0x3D, 0x18, 0x5F, 0x56, 0x53, 0x67, 0x32, 0xD2, 0xE2, 0x4D, 0xFD, 
-0x90, 0xF9, 0x6F, 0x74, 0x57, 0xBA, 0x53, 0x1D, 0xA7, 0x1C, 0x84, 0x1E, 0x86, 0x4F, 0xE8, 0x53, 
-0xC0, 0x08, 0x98, 0x78, 0xCF, 0x45, 0x35, 0xD4, 0xE5, 0x1E, 0x8B, 0x52, 0x27, 0xEE, 0x3C, 0x61, 
-0xB3, 0x19, 0x4D, 0x04, 0xF2, 0x9A, 0xC6, 0x96, 0xAD, 0x17, 0x14, 0xD4, 0xB5, 0xDD, 0x01, 0xCB, 
-0x63, 0x01, 0x67, 0x2A, 0x0F, 0x8C, 0xB3, 0x24, 0xF4, 0x56, 0x1B, 0x68, 0x4D, 0xD1, 0x50, 0x4F, 
-0xC1, 0x54, 0xB4, 0xE7, 0x67, 0x50, 0x43, 0xBD, 0x39, 0x3F, 0x4B, 0x12, 0x80, 0x40, 0xC1, 0x41, 
-0x5B, 0x15, 0xD1, 0xFC, 0x29, 0xA3, 0xC9, 0xEA, 0x92, 0x86, 0xD4, 0x07, 0x05, 0xED, 0xB4, 0xFB, 
-0xB2, 0x45, 0x06, 0x75, 0x2B, 0x48, 0x45, 0xF4, 0x46, 0xB5, 0x50, 0x60, 0xE3, 0x83, 0xED, 0xE6, 
-0x54, 0x21, 0xF4, 0xF5, 0x65, 0xA7, 0x3D, 0xE7, 0x7C, 0x79, 0xB4, 0xBB, 0x7B, 0x73, 0x73, 0xD3, 
-0xBF, 0xD9, 0xEB, 0xC7, 0xC9, 0x6C, 0x17, 0x06, 0xE5, 0x60, 0x37, 0xBD, 0x9E, 0x81, 0xA8, 0xDB, 
-0xF8, 0xAB, 0xB0, 0x3D, 0xB2, 0xB5, 0x3E, 0x8C, 0xFC, 0x13, 0x0E, 0x5C, 0x86, 0x98, 0x8E, 0xA2, 
-0x56, 0x80, 0x54, 0xB1, 0x6A, 0x89, 0x05, 0x29, 0x1F, 0x7B, 0x00, 0xB4, 0xA6, 0x81, 0x6B, 0x46, 
-0x6F, 0x9E, 0xC4, 0xB7, 0xD8, 0xC4, 0x80, 0x0C, 0x20, 0x5C, 0x87, 0xFF, 0xD6, 0x80, 0x40, 0x2C, 
-0x11, 0x62, 0xFD, 0x28, 0x8E, 0xE8, 0x9A, 0xAA, 0x29, 0x4F, 0xE2, 0x37, 0x18, 0x00, 0xB6, 0x15, 
-0x4B, 0x4F, 0xE3, 0x30, 0x4E, 0x36, 0x02, 0xEA, 0xDD, 0xB0, 0x80, 0xCF, 0x11, 0x74, 0x64, 0x19, 
-0xF3, 0x15, 0x7D, 0xD2, 0x1B, 0x63, 0x11, 0x8C, 0x97, 0x67, 0x57, 0xCF, 0x2F, 0x80, 0xF1, 0xAF, 
-0x1F, 0x2D, 0x3D, 0x70, 0x8D, 0xC1, 0x71, 0xEB, 0xF9, 0x68, 0x48, 0x86, 0xA3, 0xFE, 0xFD, 0xC3, 
-0x93, 0x43, 0x72, 0x08, 0x84, 0x0E, 0xF1, 0xDF, 0xB0, 0x0F, 0x6F, 0xF7, 0xC8, 0x7D, 0xF8, 0x37, 
-0x10, 0xFF, 0xF2, 0x4A, 0x3F, 0xB4, 0x1E, 0x3F, 0xDA, 0x45, 0xD0, 0xC7, 0xAF, 0xF5, 0x60, 0xB3, 
-0x54, 0x8B, 0xAA, 0x15, 0x48, 0xB3, 0xA8, 0x07, 0x54, 0x18, 0x36, 0x5A, 0x47, 0xAA, 0x52, 0x7D, 
-0x11, 0x83, 0x70, 0x12, 0x96, 0xEA, 0xD5, 0xEB, 0xCE, 0xD7, 0x4A, 0x91, 0xE9, 0xD5, 0x1F, 0xF9, 
-0x2C, 0xF1, 0x43, 0x88, 0x8D, 0x6E, 0x8F, 0x5B, 0xC3, 0x51, 0x8B, 0xF8, 0x2B, 0xF9, 0x3B, 0x39, 
-0x6E, 0x8D, 0x91, 0x06, 0x59, 0xFC, 0xB8, 0x02, 0x84, 0x93, 0x39, 0x72, 0x3B, 0x94, 0x55, 0x57, 
-0xF8, 0xBB, 0x45, 0x6E, 0x47, 0xEA, 0x2B, 0xFC, 0xDE, 0x43, 0x50, 0xAC, 0xB4, 0x16, 0x70, 0x54, 
-0x81, 0x1C, 0xAD, 0x07, 0xDD, 0xEF, 0x8F, 0x14, 0xB0, 0x7C, 0x42, 0xF0, 0x71, 0xFF, 0x60, 0x5F, 
-0x36, 0x20, 0x9E, 0xD6, 0xF6, 0xFE, 0xA0, 0xBF, 0x77, 0xA0, 0x30, 0x97, 0x8F, 0x02, 0x87, 0xC3, 
-0xFE, 0xFD, 0x07, 0xB2, 0x15, 0xF9, 0xB8, 0xB6, 0x19, 0xD5, 0x84, 0x42, 0x62, 0x4F, 0xC1, 0x8E, 
-0xD6, 0x02, 0x8E, 0x2A, 0x90, 0xA3, 0xCD, 0x41, 0x4B, 0xEA, 0x15, 0xBA, 0x26, 0xF9, 0x92, 0x9C, 
-0x2D, 0xE8, 0x97, 0xA0, 0x15, 0xF2, 0x45, 0x27, 0xF5, 0x46, 0x36, 0xD4, 0x65, 0xA1, 0x9C, 0x5B, 
-0x28, 0x33, 0xEA, 0x7E, 0x55, 0x97, 0x9B, 0x5C, 0xDB, 0x72, 0x09, 0xF3, 0xF9, 0xD3, 0x39, 0x0B, 
-0x83, 0x8E, 0x6A, 0x31, 0x07, 0x53, 0xC6, 0xBD, 0xDA, 0x81, 0x07, 0xAE, 0xE5, 0xDA, 0xE6, 0xF9, 
-0x2D, 0x56, 0xE0, 0x03, 0xB8, 0x7A, 0x27, 0x78, 0xD5, 0xAC, 0xAD, 0x42, 0x61, 0x0A, 0x71, 0x4A, 
-0x3E, 0x4B, 0x62, 0x98, 0x67, 0xF4, 0x7C, 0x34, 0x87, 0x47, 0xE4, 0x93, 0x81, 0x37, 0x98, 0x0E, 
-0x29, 0xB9, 0xC7, 0x16, 0xCB, 0x38, 0xE1, 0x5E, 0xC4, 0x1F, 0xDA, 0x7B, 0x10, 0x44, 0xBD, 0x4F, 
-0xB3, 0x24, 0x2F, 0x9A, 0x8A, 0x8F, 0xB5, 0xC7, 0xBA, 0x21, 0x72, 0x31, 0x55, 0xC6, 0xCA, 0xEF, 
-0xC3, 0xD7, 0x77, 0x6D, 0x41, 0xC2, 0xD5, 0xD8, 0xE0, 0x66, 0xDA, 0x1A, 0x00, 0x43, 0x61, 0x8D, 
-0xF0, 0x33, 0x35, 0xC3, 0xCF, 0x2E, 0x91, 0x4A, 0x47, 0xBE, 0x50, 0x81, 0x26, 0x39, 0x82, 0x59, 
-0x33, 0x9B, 0xCD, 0x79, 0x45, 0x3F, 0xB5, 0x08, 0x1D, 0x42, 0xB5, 0xE3, 0xC7, 0xF5, 0x68, 0x2D, 
-0x86, 0x50, 0x89, 0x45, 0x5E, 0x78, 0x12, 0xB1, 0x85, 0x08, 0xD2, 0x9F, 0x66, 0x89, 0xF8, 0x0D, 
-0x66, 0x5E, 0xCC, 0x75, 0xFB, 0xF1, 0x12, 0xBF, 0xA6, 0x7D, 0x2F, 0xAF, 0xD1, 0x5F, 0xF5, 0x03, 
-0x55, 0x49, 0x1F, 0xCB, 0x6B, 0x2B, 0x43, 0x8B, 0x83, 0x1A, 0x80, 0x0C, 0x51, 0x3B, 0xA6, 0x1F, 
-0x5F, 0x87, 0xFA, 0xC6, 0xFD, 0x39, 0xA9, 0xD3, 0xA7, 0x9D, 0xE6, 0xB4, 0xB0, 0x98, 0x91, 0x6C, 
-0xC6, 0xC5, 0xBA, 0xB5, 0xC8, 0xB5, 0xA9, 0x62, 0x30, 0x04, 0xCE, 0x9A, 0xBD, 0x53, 0xD5, 0x9A, 
-0x4D, 0x5B, 0xDE, 0x96, 0xEE, 0xAA, 0x31, 0x24, 0xCB, 0xAA, 0xDF, 0x72, 0x4B, 0x09, 0x5F, 0xB7, 
-0xB0, 0x9C, 0x79, 0xF3, 0x8E, 0x60, 0x0D, 0x78, 0xB1, 0xAF, 0xCD, 0xCE, 0x8A, 0xF0, 0xBA, 0x3A, 
-0xAD, 0x60, 0x29, 0x2A, 0x63, 0x97, 0x48, 0x21, 0xE0, 0xDC, 0x49, 0x4E, 0x31, 0x2C, 0xB3, 0xB4, 
-0x6A, 0x2C, 0xBA, 0x41, 0x1C, 0x5B, 0x5A, 0x5A, 0xD5, 0xFE, 0x8E, 0x99, 0x74, 0x2C, 0xCB, 0x25, 
-0x1E, 0x86, 0x25, 0x2E, 0x3A, 0xFD, 0x85, 0x22, 0xB2, 0xBA, 0x99, 0x72, 0xF4, 0xF8, 0x7B, 0xC4, 
-0xF4, 0x7B, 0xC4, 0xF4, 0x9E, 0x11, 0x93, 0x96, 0xB1, 0x92, 0x99, 0xC2, 0x22, 0x2D, 0xE9, 0x55, 
-0xD2, 0x56, 0x5A, 0x9A, 0xD0, 0x1C, 0x83, 0x3E, 0xBF, 0x6D, 0x9A, 0x97, 0xAA, 0x34, 0xB8, 0x00, 
-0x6D, 0xEF, 0x60, 0xF1, 0x29, 0x4C, 0xD3, 0xE9, 0x2D, 0xEF, 0xB4, 0x47, 0x65, 0x4E, 0x4B, 0x66, 
-0xDD, 0x02, 0xB9, 0x56, 0x92, 0xF6, 0xA7, 0x50, 0xA5, 0x3F, 0xF5, 0x16, 0x2C, 0xC4, 0x49, 0x74, 
-0xAB, 0x2D, 0x56, 0x56, 0xC0, 0x10, 0xA5, 0x30, 0x5D, 0x06, 0x3B, 0x94, 0xB0, 0x69, 0xCB, 0x0E, 
-0x28, 0xA2, 0x00, 0xCC, 0x5A, 0x7F, 0x72, 0xE8, 0x7B, 0x7B, 0xDE, 0xB4, 0x6D, 0x0C, 0x68, 0x89, 
-0xF0, 0x2C, 0xF1, 0x02, 0x06, 0xF8, 0x5D, 0xD1, 0xC5, 0x12, 0x3D, 0x12, 0xBF, 0x55, 0xD3, 0xD7, 
-0x0B, 0xE0, 0x91, 0x97, 0x7C, 0xA5, 0x8A, 0x3B, 0x83, 0x2E, 0x91, 0xFF, 0xED, 0x97, 0xC6, 0x5B, 
-0x87, 0xC5, 0xD8, 0x49, 0x4C, 0xFB, 0xC0, 0xA3, 0x2E, 0xB1, 0x76, 0x3B, 0x99, 0x4D, 0xBC, 0xCE, 
-0x68, 0x7F, 0x0C, 0xD6, 0x7F, 0xFC, 0x00, 0x7E, 0x0C, 0x01, 0xBC, 0x3F, 0xDE, 0x69, 0xAF, 0x87, 
-0x1E, 0xBA, 0xA0, 0x87, 0x3B, 0x95, 0xC9, 0x77, 0xDE, 0xC6, 0xB3, 0x6C, 0xF1, 0xAE, 0xC8, 0x03, 
-0xA8, 0x03, 0xF7, 0xF1, 0x21, 0xF4, 0xBB, 0x07, 0x5F, 0x47, 0xFB, 0x07, 0x0E, 0xDC, 0x6B, 0xC0, 
-0x43, 0x17, 0xB0, 0x13, 0xF5, 0xCB, 0x98, 0x85, 0xEF, 0x8A, 0x3B, 0xC2, 0x3A, 0x90, 0x1F, 0x42, 
-0xAF, 0xC3, 0x07, 0xC8, 0xBE, 0xD1, 0xA1, 0x03, 0xF9, 0x3A, 0xF4, 0xD0, 0x05, 0xED, 0xC4, 0xFE, 
-0x02, 0x63, 0xA2, 0x77, 0x45, 0x5F, 0x00, 0xBB, 0x14, 0x67, 0x0C, 0xC8, 0x0C, 0x0F, 0xE1, 0xC7, 
-0x9E, 0x8B, 0xF9, 0x16, 0xF0, 0xA1, 0x0B, 0x5C, 0x23, 0x40, 0x91, 0x21, 0x06, 0xF8, 0x31, 0xFA, 
-0x6C, 0x39, 0x6C, 0x3A, 0x40, 0x42, 0xD7, 0xF0, 0x33, 0xAB, 0x25, 0x15, 0x51, 0x1F, 0xC4, 0x4D, 
-0x5D, 0x2D, 0xE0, 0xF4, 0xB8, 0x77, 0x54, 0x8D, 0x95, 0x42, 0x6F, 0x02, 0x6E, 0xEA, 0x88, 0xBC, 
-0x7C, 0xD5, 0x35, 0x0B, 0xB0, 0x36, 0x84, 0x0A, 0x58, 0x64, 0x16, 0xE0, 0xE7, 0x2D, 0xA9, 0xBF, 
-0x2B, 0x5A, 0x83, 0xAE, 0x71, 0x64, 0xC0, 0x38, 0xB7, 0x57, 0x9A, 0xC4, 0x49, 0x40, 0x93, 0x53, 
-0x19, 0xE8, 0xB7, 0x3F, 0x99, 0x8E, 0x0F, 0xE9, 0x60, 0xE2, 0xAE, 0x5D, 0x4C, 0x1B, 0x14, 0x84, 
-0x3E, 0xFA, 0x5C, 0x40, 0x92, 0x54, 0xA0, 0xC9, 0x51, 0xCE, 0x69, 0x94, 0x82, 0x35, 0x3C, 0x02, 
-0xFE, 0xEE, 0xBB, 0xEA, 0x60, 0x1A, 0xE9, 0x88, 0x88, 0xBC, 0xA8, 0xBD, 0xC2, 0x12, 0xD7, 0x90, 
-0x5F, 0x00, 0x32, 0x19, 0x30, 0x69, 0xBF, 0xA9, 0xD2, 0x33, 0x0C, 0x05, 0xF3, 0x9A, 0x07, 0x4D, 
-0x35, 0x9F, 0x54, 0xA9, 0x2D, 0xF9, 0xD3, 0x04, 0x55, 0xE1, 0xE8, 0x74, 0xBA, 0x41, 0xF5, 0xEF, 
-0x31, 0x7F, 0x75, 0x44, 0x46, 0x8E, 0x9A, 0x13, 0xBD, 0xD2, 0x9E, 0xA3, 0xD2, 0x9C, 0x05, 0x01, 
-0x05, 0x36, 0x8A, 0xA0, 0xCE, 0xC2, 0xC7, 0x3B, 0x0B, 0xDC, 0x3A, 0xDD, 0x01, 0xCB, 0x44, 0x03, 
-0x2F, 0xD8, 0x54, 0x7D, 0xF6, 0x26, 0x0F, 0x46, 0xD3, 0x83, 0xED, 0xD5, 0x07, 0xBA, 0xF9, 0x2D, 
-0x68, 0x4F, 0xCE, 0x9E, 0xBF, 0x66, 0xED, 0x41, 0x2E, 0xFD, 0x4C, 0xCA, 0x73, 0x99, 0xD1, 0x30, 
-0xDE, 0x54, 0x75, 0x86, 0x83, 0xC9, 0xE1, 0x83, 0xE1, 0xF6, 0xAA, 0x83, 0xEE, 0xE7, 0xB7, 0xA0, 
-0x3B, 0x39, 0x7F, 0x7E, 0x23, 0xBA, 0x73, 0x91, 0x2D, 0x58, 0x14, 0xA7, 0x6C, 0x0B, 0xE3, 0x33, 
-0x9D, 0x4C, 0xA6, 0xA3, 0xFD, 0xED, 0x35, 0x48, 0x04, 0x00, 0xBF, 0x05, 0x15, 0xCA, 0x19, 0xF4, 
-0xB7, 0xA8, 0x42, 0xE6, 0xAB, 0x57, 0x7A, 0x5A, 0x48, 0x4B, 0xF2, 0xC8, 0x2C, 0x53, 0x2D, 0xAE, 
-0x4A, 0x68, 0xBA, 0x84, 0xF7, 0xEC, 0x9A, 0x5A, 0xC5, 0xB0, 0xF0, 0x98, 0x58, 0xE4, 0x3C, 0x49, 
-0x97, 0xD4, 0x07, 0x39, 0x40, 0x23, 0xCA, 0x8B, 0x56, 0x2A, 0x2E, 0xC3, 0x6C, 0xC6, 0x44, 0xFB, 
-0x16, 0x14, 0x43, 0x3A, 0xA3, 0x51, 0x80, 0x65, 0x01, 0x4B, 0x97, 0xA1, 0xB7, 0xCA, 0x3D, 0xB1, 
-0x4D, 0xFD, 0x79, 0x1C, 0x87, 0x9C, 0x2D, 0x6B, 0x98, 0x16, 0x28, 0xC5, 0x01, 0x46, 0x8D, 0x2C, 
-0x0A, 0xE8, 0xAD, 0x4B, 0x02, 0x0C, 0x27, 0x70, 0x29, 0x60, 0x6C, 0x47, 0x36, 0xFF, 0xD4, 0xF4, 
-0x3E, 0x0F, 0x6D, 0x21, 0x2E, 0x2F, 0x7F, 0x0C, 0xFA, 0x87, 0x3B, 0xAE, 0x8E, 0x38, 0xE3, 0x21, 
-0x2D, 0x0D, 0xD1, 0x74, 0x74, 0xB8, 0x77, 0xDF, 0x55, 0x17, 0xF3, 0xA7, 0x45, 0xD5, 0xFD, 0xC9, 
-0x78, 0x7C, 0xB0, 0xE7, 0xAE, 0x6A, 0xE8, 0x1A, 0x1D, 0xD3, 0xFB, 0xD4, 0x19, 0x5A, 0x19, 0x4A, 
-0x34, 0x74, 0xE9, 0x24, 0x44, 0xF1, 0x2C, 0x9A, 0x41, 0x05, 0x97, 0x2E, 0xFA, 0x71, 0x12, 0x95, 
-0x03, 0xE8, 0x81, 0xA3, 0x96, 0x12, 0xA0, 0x40, 0x2D, 0x6D, 0x1C, 0xB9, 0x93, 0xF8, 0xF6, 0xDB, 
-0xBC, 0xD3, 0xFD, 0xB5, 0x6A, 0x5B, 0xD5, 0x84, 0xD4, 0xF7, 0x42, 0xEA, 0x50, 0xA7, 0x95, 0xFD, 
-0x35, 0x7E, 0x66, 0x09, 0x0B, 0xDC, 0xA5, 0x1A, 0x01, 0x8D, 0xA8, 0xE3, 0xC7, 0x2F, 0x06, 0xFA, 
-0xDE, 0x74, 0xDF, 0x1D, 0x99, 0x88, 0x26, 0x13, 0xEF, 0x46, 0x0E, 0x77, 0xA5, 0x6E, 0xF6, 0xAA, 
-0x77, 0x4E, 0xF3, 0x4B, 0x61, 0xE8, 0x9C, 0xF0, 0x7F, 0xA2, 0x49, 0xDC, 0x88, 0x16, 0x67, 0xFE, 
-0x1B, 0xC1, 0x92, 0x52, 0x98, 0x30, 0x9B, 0xC3, 0xE4, 0x05, 0xBE, 0x4C, 0xD9, 0x0F, 0x30, 0x2E, 
-0x86, 0x43, 0x72, 0x57, 0xE5, 0xAD, 0xEC, 0xBC, 0xFE, 0xEE, 0x76, 0x3D, 0x1F, 0x37, 0x18, 0xAF, 
-0xDB, 0x60, 0xD6, 0xC5, 0x7D, 0xAD, 0x2F, 0x62, 0x2E, 0xB2, 0x3D, 0x47, 0x38, 0x69, 0xF5, 0x32, 
-0x1E, 0x5F, 0xBE, 0x61, 0xCB, 0x42, 0x55, 0x46, 0x03, 0x2B, 0xFA, 0xCD, 0xDA, 0x22, 0xC6, 0xBB, 
-0xE7, 0xCB, 0x56, 0xDF, 0xE6, 0x26, 0x02, 0xA7, 0xC9, 0xB8, 0xED, 0x08, 0x7A, 0xB9, 0x65, 0x80, 
-0x5E, 0x1B, 0x97, 0xE7, 0xAB, 0xA6, 0xA1, 0xD6, 0x16, 0x90, 0x1B, 0x67, 0xDC, 0x20, 0xE6, 0x2D, 
-0x18, 0xA5, 0xA5, 0xA4, 0x29, 0x41, 0x8F, 0x28, 0x1F, 0x27, 0x31, 0xE7, 0xF1, 0xE2, 0x88, 0x80, 
-0x89, 0x08, 0xE9, 0x14, 0x5E, 0x8E, 0x91, 0xF5, 0x95, 0xD6, 0x8A, 0xAC, 0xBE, 0xD5, 0x9E, 0xE5, 
-0x79, 0x7E, 0x24, 0x7B, 0x30, 0xB0, 0x30, 0x97, 0x7A, 0xA9, 0xC0, 0xA0, 0x0D, 0x0F, 0xF4, 0x9B, 
-0x8C, 0xFF, 0x7D, 0x86, 0x79, 0xAD, 0x0A, 0x33, 0x34, 0x8B, 0xAF, 0xD2, 0x6C, 0xB5, 0xED, 0x8F, 
-0x57, 0x5E, 0xF4, 0x86, 0x14, 0x1B, 0x90, 0xE5, 0x7C, 0x5C, 0xCF, 0x36, 0xE0, 0xFE, 0xE4, 0xD3, 
-0xE6, 0xCC, 0x9A, 0xB1, 0x85, 0xD9, 0x9D, 0x5A, 0x2B, 0xDB, 0xCB, 0x33, 0x14, 0xB8, 0xF5, 0x43, 
-0x36, 0xBF, 0x26, 0x81, 0x31, 0x3C, 0x28, 0x12, 0x18, 0x3A, 0xFC, 0x86, 0xC9, 0xA3, 0x83, 0x32, 
-0x01, 0xE1, 0x86, 0x76, 0x66, 0x8F, 0x06, 0x12, 0xBA, 0x84, 0x37, 0x77, 0x6B, 0x1B, 0x79, 0x0C, 
-0x45, 0xCD, 0x2F, 0x9A, 0xCB, 0xB0, 0x29, 0x4B, 0x1E, 0x6F, 0xD5, 0x8B, 0x2A, 0xFE, 0x62, 0x04, 
-0xAE, 0xC5, 0xEE, 0x2F, 0x6A, 0x1E, 0x4F, 0x67, 0x95, 0xB3, 0xE1, 0x86, 0x28, 0x46, 0x0B, 0xF2, 
-0xC6, 0x96, 0xE2, 0xC6, 0xF8, 0x6E, 0x6D, 0x6C, 0xB7, 0x59, 0x5C, 0xE7, 0x8A, 0xE9, 0xDC, 0x5C, 
-0xD8, 0x22, 0x9E, 0xDB, 0x2C, 0x96, 0x93, 0x88, 0xB2, 0x82, 0x98, 0x51, 0x75, 0x2C, 0xDF, 0x7D, 
-0xF0, 0xB0, 0xEC, 0x17, 0x8E, 0xCA, 0x68, 0xE4, 0x4D, 0x42, 0x1A, 0x34, 0xFA, 0xAF, 0x0F, 0x11, 
-0xB9, 0x8D, 0xFF, 0x3F, 0x85, 0x6E, 0x36, 0x0F, 0x81, 0x9F, 0x77, 0x0A, 0xDD, 0x9A, 0xD8, 0x2B, 
-0x78, 0xF3, 0xA5, 0xE9, 0xBE, 0x47, 0x5D, 0x72, 0x43, 0xA5, 0xF7, 0x6B, 0x4F, 0xE2, 0x30, 0x68, 
-0x3B, 0xA3, 0x01, 0xE4, 0x56, 0x05, 0x78, 0x4F, 0x03, 0x3E, 0x18, 0x0C, 0xDC, 0xB0, 0x10, 0xF6, 
-0x85, 0x28, 0x5C, 0xBB, 0xCA, 0x1A, 0xF8, 0x1D, 0x91, 0x8E, 0x2F, 0x1D, 0x90, 0x58, 0xD1, 0x56, 
-0xCF, 0x2F, 0x07, 0xAF, 0xFA, 0xC2, 0xC0, 0xE2, 0xC6, 0xFB, 0xF6, 0xD7, 0x30, 0x82, 0xC2, 0xA6, 
-0xD8, 0x4D, 0x4D, 0xAA, 0x8D, 0x96, 0x5E, 0x7F, 0xFA, 0x56, 0x7D, 0xED, 0x83, 0x13, 0x48, 0x69, 
-0xD0, 0x5F, 0xDD, 0x7D, 0xF6, 0xDA, 0xDE, 0xC6, 0xF6, 0xB1, 0x4A, 0x11, 0xD9, 0xDA, 0x03, 0xDB, 
-0x46, 0xD9, 0xAD, 0x99, 0x2A, 0xCB, 0xBD, 0x9D, 0x38, 0x18, 0xC4, 0x46, 0x0A, 0x97, 0x78, 0x36, 
-0x0C, 0x37, 0x21, 0x54, 0x43, 0x9D, 0x73, 0x29, 0x9D, 0x0A, 0x11, 0x3F, 0x6C, 0xA4, 0xDD, 0x50, 
-0x17, 0x63, 0xD2, 0x0B, 0x1A, 0xCD, 0x70, 0x68, 0x0D, 0x5C, 0x11, 0x79, 0x73, 0x38, 0xFB, 0xFE, 
-0xB4, 0x55, 0x42, 0xE0, 0x81, 0x36, 0x0C, 0xC6, 0x4D, 0xC3, 0x00, 0x3F, 0x05, 0x5F, 0xD4, 0xDA, 
-0x62, 0x43, 0xD5, 0xC2, 0x44, 0xB8, 0xC6, 0x3E, 0x7E, 0x40, 0x9E, 0x57, 0x48, 0xD8, 0x05, 0x5B, 
-0x30, 0xEE, 0x4E, 0x37, 0x88, 0xAE, 0xD5, 0x28, 0x84, 0x81, 0x71, 0xED, 0x85, 0x19, 0x15, 0xC3, 
-0x42, 0x3C, 0x91, 0xCF, 0x49, 0xFB, 0xB3, 0xF6, 0xE6, 0x63, 0xC1, 0x35, 0xED, 0xA8, 0xBA, 0x9C, 
-0x5F, 0x2F, 0xBE, 0xFF, 0x70, 0x11, 0xB9, 0xB9, 0x05, 0x25, 0x9D, 0xC7, 0x37, 0x2A, 0x9E, 0x84, 
-0xD8, 0xB1, 0x7E, 0x86, 0xC1, 0xD8, 0x57, 0x72, 0x12, 0x86, 0x9D, 0x76, 0xBF, 0x60, 0xC3, 0x35, 
-0xED, 0xF9, 0x5E, 0x02, 0x41, 0x77, 0x7F, 0x1A, 0x27, 0x67, 0x9E, 0x3F, 0xEF, 0x80, 0xBD, 0x33, 
-0x77, 0xF5, 0xD0, 0xD0, 0xB9, 0xA1, 0xA7, 0xB7, 0xA0, 0x3C, 0x61, 0x3E, 0xEE, 0xB4, 0x51, 0x2F, 
-0xB8, 0x5C, 0x07, 0xCB, 0xBF, 0xCE, 0xB3, 0x05, 0x0B, 0x18, 0x5F, 0x69, 0xAF, 0xD2, 0x98, 0x85, 
-0xE5, 0xAE, 0x1A, 0xCB, 0x16, 0x42, 0x79, 0xFE, 0x47, 0x2D, 0xFA, 0x55, 0xCF, 0xFF, 0x58, 0x76, 
-0xBB, 0xC8, 0xCD, 0x4F, 0xE2, 0x94, 0x4D, 0x1E, 0xF6, 0x16, 0xC4, 0x04, 0x29, 0x12, 0x13, 0xA4, 
-0x7D, 0x99, 0xFA, 0xC2, 0x09, 0x04, 0x0C, 0xB3, 0x62, 0x86, 0xE1, 0xDE, 0x75, 0x25, 0x7F, 0x8A, 
-0x03, 0x97, 0xE8, 0x21, 0x70, 0x31, 0x3F, 0x5F, 0xB9, 0x17, 0x27, 0x32, 0xD5, 0x72, 0x7D, 0xF1, 
-0xD2, 0xC4, 0x5F, 0xE2, 0x2D, 0x78, 0x61, 0x1E, 0x0A, 0xA8, 0xA3, 0x8A, 0x5E, 0xA6, 0x40, 0x4E, 
-0xE8, 0x99, 0xBE, 0xEF, 0x3F, 0xEF, 0xFB, 0xAB, 0xE4, 0xA7, 0x3F, 0x4F, 0x99, 0x0F, 0x66, 0x16, 
-0x17, 0x01, 0x41, 0x74, 0xC0, 0x05, 0xAF, 0xA5, 0xD5, 0x74, 0x4E, 0xB6, 0x50, 0xBA, 0x52, 0x2A, 
-0x3B, 0xF6, 0x5D, 0x9C, 0x0E, 0x19, 0x9A, 0x67, 0xFA, 0x14, 0xB5, 0x6A, 0x69, 0x2E, 0xEF, 0x58, 
-0x6D, 0xF8, 0x31, 0xA9, 0x2E, 0x44, 0xBE, 0x96, 0xF2, 0xE1, 0x76, 0x94, 0xAB, 0x65, 0xB2, 0xCD, 
-0xA9, 0x2E, 0x31, 0xD9, 0x94, 0xF2, 0x12, 0xC2, 0x4A, 0xBD, 0x5C, 0x5A, 0x6A, 0xA4, 0x5E, 0x6A, 
-0xF7, 0x3A, 0xCA, 0x47, 0xDB, 0x51, 0x2E, 0xD6, 0x78, 0x36, 0xA7, 0x5B, 0xE2, 0xB0, 0x29, 0xCD, 
-0xC6, 0x78, 0x34, 0xE9, 0x95, 0xCB, 0x21, 0x8D, 0xF4, 0xAA, 0x8D, 0x96, 0xEB, 0x08, 0xDE, 0xDB, 
-0x8E, 0x60, 0x6D, 0x61, 0x62, 0x73, 0xB2, 0x15, 0x2A, 0x9B, 0xD2, 0x6D, 0x6E, 0x11, 0xAD, 0xA8, 
-0xB9, 0x48, 0xE2, 0x17, 0x84, 0xEB, 0x43, 0xDC, 0x8D, 0x03, 0x92, 0xDD, 0x13, 0xC4, 0x00, 0x12, 
-0x62, 0xBF, 0xDB, 0x15, 0x04, 0x7E, 0x68, 0x72, 0xF0, 0xDD, 0xC3, 0xAD, 0xC0, 0xC5, 0x5E, 0xD8, 
-0x62, 0x53, 0x90, 0xF8, 0x6D, 0xB1, 0x79, 0x96, 0x0D, 0x9F, 0x50, 0xFB, 0xAD, 0x38, 0x56, 0x0C, 
-0xA1, 0x0A, 0xB9, 0xB3, 0xD9, 0x39, 0xFD, 0x80, 0xD9, 0x33, 0x1A, 0x82, 0x31, 0x81, 0xD8, 0x22, 
-0x51, 0xC4, 0x0B, 0xBF, 0xB0, 0x8C, 0xC3, 0xFA, 0x26, 0xAA, 0xFC, 0xBD, 0x9C, 0xE8, 0x48, 0x67, 
-0xDE, 0x25, 0x20, 0x26, 0x91, 0x89, 0xEB, 0x92, 0x14, 0x8F, 0xC5, 0x8A, 0xB2, 0x2E, 0xA1, 0x6A, 
-0x32, 0x55, 0xA8, 0x85, 0x74, 0xF8, 0xC7, 0xE4, 0xB9, 0xC7, 0xE7, 0x7D, 0xA8, 0xDE, 0x11, 0x70, 
-0xF2, 0x1B, 0x8B, 0x3A, 0xA2, 0x01, 0x19, 0x1E, 0x98, 0xC9, 0x1F, 0xE1, 0x41, 0x01, 0x4E, 0x76, 
-0x47, 0x7A, 0xD8, 0xDF, 0x0E, 0xD9, 0x25, 0x08, 0xA1, 0xBE, 0x59, 0xF6, 0x49, 0x89, 0x50, 0xFB, 
-0x19, 0xC5, 0x1C, 0x54, 0x67, 0x4E, 0x6F, 0xED, 0x7B, 0x7D, 0x91, 0xAF, 0xA2, 0xE2, 0x79, 0xC4, 
-0xB1, 0x56, 0x3F, 0x0D, 0x99, 0x4F, 0x31, 0xAD, 0xB3, 0xB7, 0x83, 0x09, 0xA4, 0xFA, 0x99, 0xE6, 
-0x99, 0x1D, 0x02, 0x26, 0x24, 0x63, 0x07, 0xC4, 0xC4, 0x0E, 0x01, 0xF3, 0xC9, 0xFB, 0x35, 0x08, 
-0xE9, 0xD8, 0xC8, 0x4B, 0x60, 0xDF, 0xAC, 0x4B, 0x26, 0xAF, 0x72, 0xDD, 0xB3, 0xD0, 0xF7, 0x32, 
-0x01, 0x2C, 0x67, 0xF0, 0xFF, 0x64, 0xF8, 0x2A, 0xEF, 0x01, 0xC8, 0xED, 0x94, 0x22, 0x30, 0xB9, 
-0xF8, 0x32, 0x81, 0x19, 0xD7, 0x0C, 0xFE, 0x9F, 0x8C, 0x8C, 0xFA, 0x85, 0x98, 0x2C, 0x7D, 0x24, 
-0xB9, 0xB4, 0xC4, 0xD4, 0xB8, 0x93, 0x0C, 0x21, 0x5C, 0xEB, 0x24, 0x23, 0x60, 0x7A, 0x32, 0xDC, 
-0x21, 0x7F, 0x27, 0x25, 0x53, 0xD9, 0x67, 0x64, 0x82, 0xCC, 0x04, 0xC8, 0x0C, 0x41, 0x66, 0x2E, 
-0x90, 0x89, 0x09, 0x32, 0x11, 0x20, 0x13, 0x04, 0x99, 0xD4, 0x41, 0xE4, 0x4F, 0xC5, 0xA7, 0xD7, 
-0x30, 0x4B, 0xEF, 0x7C, 0xFA, 0x36, 0xB9, 0xEB, 0x92, 0x4F, 0xDF, 0xCE, 0xC4, 0xCF, 0xC9, 0xDD, 
-0xCE, 0x6B, 0x4D, 0xB7, 0xC5, 0x5D, 0x08, 0x5F, 0xAA, 0x63, 0xDA, 0x9A, 0x2A, 0xD7, 0xCE, 0x39, 
-0xE7, 0xBA, 0x21, 0x0A, 0x3A, 0xED, 0x5D, 0x34, 0x5A, 0xED, 0x9D, 0x52, 0x32, 0xB8, 0x0F, 0x37, 
-0xEA, 0xA8, 0x3C, 0x0A, 0x45, 0x65, 0xCA, 0x9F, 0xFB, 0x7F, 0x4C, 0xF1, 0xD8, 0x5F, 0xAD, 0xAE, 
-0x38, 0x7D, 0x5C, 0xDF, 0xA5, 0x0D, 0x48, 0x7D, 0x27, 0x4F, 0x1F, 0xB3, 0xFC, 0xC2, 0x05, 0xEB, 
-0x85, 0x0A, 0x3A, 0x0C, 0x5A, 0x5B, 0x61, 0x4A, 0x65, 0x21, 0xF9, 0xC3, 0x1F, 0x88, 0xF6, 0xB5, 
-0x9F, 0x42, 0x33, 0x34, 0xF9, 0x36, 0x0E, 0x43, 0x20, 0x32, 0xBF, 0xC6, 0xA1, 0x76, 0x66, 0x19, 
-0x3F, 0xD6, 0xDB, 0x1E, 0xD6, 0x36, 0x05, 0x32, 0x18, 0xE2, 0x8D, 0x10, 0xCE, 0xA8, 0xB4, 0x14, 
-0x4C, 0xFE, 0x29, 0x8E, 0x35, 0x07, 0x95, 0x23, 0xCD, 0x26, 0x16, 0xE5, 0x3D, 0x11, 0xFA, 0xC9, 
-0x59, 0x53, 0x36, 0x5D, 0x0B, 0xD6, 0xC6, 0x21, 0x69, 0x9D, 0xF3, 0xBE, 0x87, 0xE2, 0xA3, 0x49, 
-0x82, 0x26, 0xB3, 0xBE, 0x43, 0x5E, 0x1D, 0x9B, 0x16, 0xE5, 0x9D, 0xF6, 0x99, 0xA8, 0x66, 0x1C, 
-0xE2, 0x3F, 0x02, 0xDF, 0x20, 0x4A, 0x7F, 0x69, 0x9C, 0x1D, 0x5B, 0xC8, 0x73, 0x8E, 0x15, 0xC7, 
-0xAB, 0xCB, 0xFB, 0x3C, 0xF0, 0x7D, 0x35, 0x0F, 0x7F, 0x3E, 0x2D, 0x8E, 0xDF, 0x27, 0x34, 0x6A, 
-0x73, 0x79, 0x08, 0x9D, 0xAC, 0x28, 0xEF, 0x8A, 0xC3, 0xF5, 0xC2, 0xA8, 0xE3, 0xFE, 0xEB, 0xCD, 
-0x22, 0x6B, 0xCC, 0x71, 0xA8, 0x72, 0x5B, 0xCE, 0xBA, 0xE1, 0x18, 0xBE, 0xED, 0x40, 0x7C, 0x14, 
-0xF3, 0xFC, 0x50, 0x3C, 0xC0, 0x00, 0x57, 0x91, 0xC9, 0xDF, 0x9D, 0x2B, 0x4A, 0xAB, 0x87, 0xE1, 
-0x6D, 0xD7, 0x66, 0xE4, 0xD7, 0x48, 0x88, 0xDB, 0x16, 0xB2, 0x65, 0xAE, 0xAB, 0xC8, 0x94, 0xE7, 
-0x30, 0x5F, 0xCA, 0x12, 0xE1, 0x3A, 0x51, 0x06, 0x02, 0xB9, 0x81, 0xC1, 0x1E, 0xED, 0xF6, 0x85, 
-0x1B, 0xAF, 0x68, 0x02, 0x86, 0xCE, 0xBD, 0xA2, 0x41, 0x37, 0x09, 0x7F, 0xF9, 0xB7, 0x7F, 0x26, 
-0x5F, 0xB2, 0x04, 0x6F, 0x4E, 0x29, 0x3B, 0x02, 0x1C, 0x7D, 0x2A, 0x2F, 0x10, 0x48, 0xE8, 0x14, 
-0xC6, 0xFF, 0x5C, 0x52, 0x54, 0x25, 0x25, 0x3F, 0xE4, 0x0D, 0x68, 0x3E, 0x93, 0xFB, 0x87, 0x65, 
-0xE2, 0xA0, 0xBC, 0x0E, 0xC5, 0x5D, 0x13, 0x89, 0x01, 0x13, 0x2E, 0xF6, 0xF6, 0x6A, 0x95, 0x15, 
-0x43, 0xEA, 0xF4, 0x1C, 0x97, 0xEC, 0x29, 0xD6, 0x1B, 0x4A, 0x13, 0x23, 0xE3, 0x9D, 0x54, 0xE7, 
-0xA6, 0xE4, 0xFE, 0x73, 0x51, 0x80, 0xBE, 0x91, 0x05, 0xCA, 0xEB, 0x76, 0x49, 0x16, 0x31, 0x2E, 
-0xA6, 0x33, 0x76, 0x67, 0x49, 0xC3, 0x86, 0xF5, 0x1C, 0x16, 0xD4, 0x3D, 0x1F, 0xB6, 0x77, 0x86, 
-0x40, 0x30, 0x79, 0x8C, 0x20, 0x0A, 0x52, 0xF5, 0x2F, 0xD9, 0x04, 0xAD, 0x8B, 0x56, 0xBD, 0x7C, 
-0x92, 0x87, 0x16, 0x6C, 0xE2, 0x11, 0x1F, 0x68, 0x48, 0x3F, 0x43, 0xD0, 0x7E, 0x94, 0x2E, 0xBD, 
-0x88, 0x88, 0x58, 0xEF, 0xB8, 0x85, 0xB7, 0x9A, 0x64, 0x69, 0x8F, 0xE5, 0x7B, 0xC0, 0xA1, 0x8F, 
-0xD6, 0xE3, 0xF3, 0x88, 0xF9, 0x0C, 0x2F, 0x47, 0x00, 0x21, 0x3D, 0xDA, 0xC5, 0xEA, 0x8F, 0xDB, 
-0x95, 0xA1, 0x2D, 0x3A, 0x55, 0xB8, 0x82, 0x7A, 0xC8, 0x27, 0xEB, 0xC1, 0x6C, 0xC9, 0xCE, 0x1E, 
-0xD6, 0x68, 0xEF, 0x58, 0x0D, 0xAC, 0x02, 0x96, 0x91, 0x9B, 0x4A, 0x4A, 0x20, 0xA2, 0x62, 0x5A, 
-0x59, 0xED, 0x57, 0x9F, 0xD7, 0x97, 0x61, 0xB5, 0x0A, 0x93, 0x40, 0x9F, 0x7B, 0x87, 0x87, 0x87, 
-0x38, 0x24, 0xCD, 0x37, 0xFD, 0x41, 0xAD, 0xE7, 0x46, 0xB6, 0x08, 0x73, 0xD6, 0xBB, 0x89, 0x93, 
-0xA0, 0xF5, 0xF8, 0xEC, 0xC5, 0x8B, 0x6F, 0x5E, 0x38, 0xD8, 0xF0, 0x81, 0xB8, 0x50, 0x67, 0x82, 
-0x83, 0x38, 0x15, 0x47, 0x0B, 0x66, 0xF4, 0x79, 0xFC, 0x25, 0xBB, 0xA5, 0xA8, 0x76, 0xDA, 0x2C, 
-0x9B, 0x7C, 0x41, 0x86, 0x04, 0x42, 0xDE, 0xAA, 0xED, 0xAE, 0x39, 0xE0, 0xA7, 0xAB, 0xC8, 0x5B, 
-0x80, 0xFA, 0xCB, 0xDC, 0x75, 0x9D, 0x0D, 0x46, 0xAB, 0x56, 0x0A, 0x69, 0x58, 0x89, 0xCE, 0x5D, 
-0xB1, 0xF1, 0x10, 0xE2, 0xBC, 0x3D, 0xF8, 0xBF, 0x98, 0x37, 0xE2, 0x23, 0x9D, 0xEE, 0xC3, 0xA7, 
-0x76, 0x17, 0x88, 0xA6, 0x04, 0x39, 0x06, 0xF6, 0x79, 0xF4, 0xD6, 0x58, 0xE0, 0xCA, 0xE4, 0xE1, 
-0x00, 0xBB, 0x96, 0xC9, 0x3F, 0x81, 0x85, 0x5C, 0xD0, 0xDA, 0x04, 0x8B, 0xFA, 0x7C, 0x76, 0x6B, 
-0x0C, 0x06, 0xE2, 0x4C, 0x19, 0x76, 0x1B, 0x1C, 0xDE, 0xBF, 0x3F, 0x90, 0x7C, 0x50, 0x53, 0xCB, 
-0x0D, 0x30, 0xB0, 0xCC, 0x30, 0xDF, 0x03, 0x85, 0x21, 0xDD, 0xF3, 0x1E, 0x78, 0x02, 0x85, 0xA9, 
-0xE7, 0xFB, 0xC3, 0xB1, 0x0B, 0x85, 0x4D, 0xBA, 0x6B, 0xB5, 0xDC, 0x1A, 0x8D, 0x9F, 0x5F, 0x7D, 
-0x94, 0x35, 0x8D, 0x30, 0xDB, 0x7C, 0x42, 0xF7, 0x08, 0x9D, 0xB6, 0xCA, 0xDD, 0x09, 0x47, 0xCB, 
-0xC5, 0x5E, 0xF3, 0xF6, 0xFF, 0xFC, 0xE7, 0x69, 0x31, 0x45, 0x36, 0x2B, 0x6B, 0x99, 0x3D, 0x01, 
-0x90, 0x7F, 0xEF, 0x62, 0x56, 0xD7, 0x0E, 0x22, 0x74, 0x49, 0x55, 0xC7, 0xE7, 0xE7, 0x31, 0xD0, 
-0x0D, 0x0E, 0xB6, 0x01, 0x44, 0x0A, 0x5F, 0xC1, 0x84, 0x72, 0x0F, 0xA1, 0x56, 0xB9, 0x70, 0x7A, 
-0xB8, 0x2B, 0x41, 0x77, 0x75, 0x18, 0xC3, 0x9C, 0x35, 0x39, 0x2D, 0xB1, 0x09, 0xC1, 0xB2, 0xD5, 
-0xE0, 0xBB, 0xDC, 0x71, 0xC9, 0x16, 0xDC, 0xCE, 0xAB, 0x04, 0xF9, 0xDE, 0x4B, 0x9A, 0x2F, 0xB8, 
-0x80, 0x3A, 0xBD, 0x1B, 0xA8, 0xA4, 0x9F, 0x41, 0x2C, 0xC1, 0xFF, 0x81, 0xA5, 0x99, 0x17, 0x7E, 
-0x9F, 0xE0, 0x29, 0xEC, 0xA4, 0xF1, 0x38, 0x20, 0xB6, 0x73, 0x2D, 0x6A, 0xF7, 0x6E, 0x64, 0x75, 
-0x6D, 0xA7, 0x81, 0xDB, 0x7D, 0x2A, 0x4A, 0x7E, 0x5E, 0xEF, 0x29, 0xE2, 0xC9, 0x82, 0x5F, 0x3B, 
-0x1A, 0xEF, 0xD6, 0xDB, 0x7E, 0x27, 0xA7, 0x6E, 0x40, 0xF2, 0x49, 0x2F, 0xA4, 0xB8, 0xD2, 0x96, 
-0xE7, 0x40, 0xE6, 0x54, 0x1D, 0x5B, 0x69, 0x0F, 0x3E, 0xD3, 0x1B, 0xC9, 0x39, 0x6F, 0x78, 0x88, 
-0x56, 0x81, 0x35, 0x49, 0xF1, 0x9E, 0x96, 0x85, 0xB8, 0x78, 0xC9, 0x06, 0x55, 0x19, 0xC8, 0xD7, 
-0x5E, 0xD2, 0xE9, 0xF5, 0x70, 0xA1, 0xAE, 0x97, 0x52, 0x90, 0x4D, 0xE0, 0x25, 0xAB, 0x9D, 0x2A, 
-0xA0, 0x21, 0x29, 0xD5, 0x82, 0xB6, 0x48, 0xAB, 0x1B, 0x04, 0xCD, 0x8E, 0xC9, 0xE1, 0x04, 0xE0, 
-0x17, 0x48, 0x57, 0xE1, 0xCB, 0xB7, 0x13, 0xD1, 0x26, 0x9E, 0xDC, 0x14, 0x09, 0xDA, 0x18, 0x4D, 
-0x28, 0xDB, 0xDB, 0x99, 0x6D, 0x24, 0x7A, 0xF7, 0xAB, 0x08, 0xF7, 0x2F, 0xFF, 0xFA, 0xEF, 0xFF, 
-0xFB, 0xDF, 0xFF, 0x42, 0xE4, 0xDC, 0x4D, 0xCE, 0xB8, 0xDE, 0x41, 0x44, 0xB9, 0x0B, 0x36, 0x25, 
-0xE5, 0x10, 0x86, 0xEA, 0xDA, 0x94, 0x61, 0x11, 0x82, 0x18, 0xE1, 0x86, 0x02, 0x6B, 0xF0, 0x10, 
-0xBF, 0xA2, 0x80, 0x7E, 0x56, 0xE1, 0x54, 0x34, 0x58, 0xAC, 0xDB, 0x59, 0x43, 0xF8, 0x2D, 0x06, 
-0x89, 0xC9, 0x95, 0xA2, 0x87, 0x6F, 0xB3, 0x45, 0x3D, 0xF6, 0xDF, 0x54, 0xB0, 0x66, 0xBA, 0xBA, 
-0x59, 0x97, 0x2E, 0x42, 0x1A, 0x29, 0xEB, 0xE6, 0x04, 0xA8, 0x88, 0xD2, 0xD2, 0xBE, 0x7B, 0x98, 
-0x3F, 0x3E, 0x26, 0x87, 0x63, 0x2B, 0x25, 0x76, 0x5C, 0xE2, 0x8D, 0xB1, 0x38, 0x98, 0xDC, 0x1F, 
-0x3D, 0x18, 0x6C, 0x86, 0xC5, 0x23, 0x32, 0xAA, 0x4F, 0x19, 0xDE, 0x6D, 0x9C, 0x34, 0x93, 0xA0, 
-0x86, 0xA6, 0xD8, 0x24, 0x41, 0x4E, 0x93, 0x9F, 0xFE, 0x83, 0x33, 0x7F, 0x73, 0x92, 0xEA, 0x3D, 
-0xD9, 0x83, 0x30, 0x7B, 0xDF, 0xAD, 0xBA, 0xAE, 0x57, 0xEF, 0x2C, 0xBC, 0x5C, 0xA1, 0x33, 0xC0, 
-0xAB, 0x1B, 0xC1, 0xD1, 0xE9, 0x0E, 0x58, 0xBA, 0xBE, 0xA7, 0x31, 0x6F, 0x72, 0xE0, 0xCA, 0x3F, 
-0x06, 0x31, 0xAF, 0xB8, 0x6F, 0x59, 0x90, 0xDB, 0x88, 0x35, 0xE0, 0xE8, 0x5C, 0x2C, 0xE7, 0xF8, 
-0x65, 0x34, 0x24, 0xAA, 0xC8, 0x4C, 0x86, 0x79, 0x75, 0x63, 0x8E, 0x5F, 0x2E, 0x23, 0x73, 0xB7, 
-0x92, 0x54, 0xCB, 0x83, 0x83, 0xF1, 0x9E, 0xC1, 0xBD, 0x12, 0x2F, 0x93, 0x53, 0xA7, 0x60, 0xB6, 
-0x7D, 0xEE, 0x05, 0xB1, 0xCB, 0x4D, 0x69, 0x78, 0x0C, 0xB7, 0xC6, 0xC3, 0x87, 0xC0, 0x7A, 0xB0, 
-0x11, 0x1E, 0x27, 0x21, 0x4D, 0xB8, 0xB7, 0x01, 0x12, 0x7B, 0x5B, 0x23, 0x51, 0x57, 0x25, 0x17, 
-0x12, 0x36, 0x37, 0x52, 0x57, 0xBB, 0x9F, 0xB7, 0xCF, 0x93, 0xD0, 0x4B, 0x16, 0x25, 0xE1, 0x15, 
-0x2D, 0x95, 0xB9, 0x36, 0x95, 0xBF, 0x11, 0x99, 0x61, 0x95, 0x19, 0xAA, 0x68, 0x8B, 0x3A, 0x99, 
-0x8E, 0x0E, 0xE4, 0x24, 0x49, 0xBC, 0x55, 0x9F, 0xA5, 0xE2, 0xB7, 0x51, 0xBA, 0x53, 0xCB, 0x70, 
-0x71, 0x52, 0x1E, 0x69, 0x8F, 0x66, 0xE2, 0x0A, 0xDD, 0x7B, 0xCE, 0x7C, 0xD5, 0x8F, 0x3F, 0x36, 
-0xEC, 0x7C, 0x57, 0x1F, 0x27, 0x30, 0xDE, 0xDA, 0xA9, 0xE3, 0xD2, 0x0F, 0xF3, 0x46, 0xD7, 0xB6, 
-0xD9, 0xB1, 0xC1, 0x3D, 0x26, 0x03, 0x24, 0x76, 0x2D, 0x30, 0xE9, 0x58, 0x08, 0x2A, 0xD3, 0x6A, 
-0x9B, 0xD0, 0xD4, 0x9C, 0x98, 0xAB, 0x12, 0xF6, 0xD2, 0x86, 0x6D, 0x8F, 0x0C, 0x5F, 0xF5, 0x79, 
-0x0E, 0xB3, 0xB3, 0x63, 0x75, 0x95, 0x28, 0x4C, 0x53, 0x1C, 0xCE, 0x7B, 0x6D, 0x2D, 0xB9, 0x44, 
-0x4B, 0xB7, 0x96, 0x94, 0x8E, 0x83, 0x95, 0xD6, 0x19, 0x65, 0x73, 0x3A, 0x72, 0x4B, 0x9A, 0xB7, 
-0x99, 0x15, 0x83, 0xDE, 0x7F, 0x13, 0x85, 0xAB, 0xFC, 0x5E, 0x56, 0x95, 0xD3, 0x06, 0xF4, 0xF9, 
-0x9C, 0xE2, 0xB5, 0xAD, 0x94, 0x14, 0xF3, 0x12, 0x1A, 0xD4, 0x69, 0x34, 0x72, 0xDA, 0x95, 0xDB, 
-0x62, 0x45, 0x84, 0xE5, 0xCC, 0x69, 0x37, 0x5D, 0x2D, 0x9B, 0x7F, 0x24, 0x52, 0xA2, 0x3E, 0x5E, 
-0x16, 0xAA, 0x38, 0x63, 0x8E, 0xB3, 0x6A, 0x6A, 0xAF, 0x00, 0xBB, 0xD2, 0xFB, 0x6C, 0x84, 0xB1, 
-0x4C, 0xD3, 0xED, 0x6B, 0x04, 0x35, 0x4C, 0xF2, 0x06, 0x8B, 0x9B, 0x2D, 0xCA, 0xB5, 0x77, 0xB9, 
-0x37, 0x1C, 0x84, 0xF7, 0x32, 0x5F, 0x4B, 0x74, 0xEC, 0x3E, 0x91, 0xAB, 0x55, 0xCD, 0xD5, 0x86, 
-0x9B, 0x55, 0x1B, 0xD5, 0xAB, 0xE9, 0xFE, 0x32, 0x8A, 0x6F, 0xA0, 0xE8, 0x29, 0x2E, 0x01, 0xC0, 
-0x63, 0xA7, 0xE2, 0x4C, 0x85, 0x8F, 0xFE, 0x5A, 0x54, 0x29, 0xD6, 0x3E, 0xBE, 0x28, 0x1E, 0xAD, 
-0xA9, 0xFF, 0xA3, 0x22, 0xF1, 0x9F, 0xAF, 0x17, 0x9C, 0x2D, 0x63, 0x1F, 0x47, 0x48, 0xD9, 0xDA, 
-0x63, 0xB1, 0x82, 0xA5, 0x3E, 0x06, 0x52, 0xB9, 0x0E, 0xE7, 0x9B, 0x85, 0x3A, 0x09, 0x4C, 0xFD, 
-0x92, 0xA0, 0x9A, 0x02, 0x97, 0x97, 0xAB, 0x4F, 0x44, 0x0E, 0xBC, 0x16, 0xCF, 0x4B, 0x90, 0x52, 
-0xF5, 0x85, 0x5A, 0x15, 0x5A, 0x55, 0x53, 0x2A, 0x39, 0x4B, 0x17, 0x48, 0x5A, 0x15, 0x4E, 0x92, 
-0x11, 0xC8, 0x8B, 0x83, 0xF0, 0x9C, 0x00, 0x32, 0xAB, 0xD6, 0x89, 0x4D, 0xE7, 0x72, 0x0C, 0xC5, 
-0x02, 0x0B, 0x8F, 0x2F, 0xF0, 0xC6, 0x2C, 0x8A, 0x4C, 0xBA, 0xE4, 0xB8, 0xFA, 0xD2, 0x69, 0xD3, 
-0xB4, 0x77, 0x76, 0xD9, 0xEE, 0x92, 0xB7, 0x64, 0x1E, 0x67, 0xB8, 0x1B, 0x70, 0xD4, 0x0B, 0xD8, 
-0x8C, 0x61, 0x76, 0x65, 0xC1, 0xA2, 0x8C, 0x53, 0xED, 0x55, 0xB9, 0x2F, 0xAB, 0xD0, 0x4B, 0x67, 
-0x56, 0x4C, 0xDD, 0x32, 0x2F, 0x9A, 0x48, 0x4F, 0x66, 0xB1, 0xB9, 0xA4, 0xDB, 0x29, 0x05, 0xD1, 
-0x23, 0x35, 0x3A, 0xC8, 0x2E, 0x39, 0x40, 0xB1, 0x34, 0x11, 0xA4, 0xB7, 0x8C, 0xF1, 0x11, 0xE8, 
-0x44, 0xEB, 0x64, 0x1E, 0x27, 0x5E, 0x0B, 0xC4, 0xFF, 0xBA, 0xF7, 0xE9, 0xDB, 0xB2, 0xC2, 0xDD, 
-0xE2, 0x75, 0xC3, 0xC8, 0xB2, 0x52, 0x50, 0x08, 0xF6, 0x0B, 0x4B, 0x18, 0x59, 0xAA, 0x8A, 0x20, 
-0xB4, 0x3A, 0xB6, 0xC4, 0x0D, 0xE9, 0x1D, 0xF1, 0x6C, 0xAC, 0x80, 0xB8, 0x87, 0x99, 0x84, 0xC8, 
-0xD9, 0x40, 0xAB, 0xEA, 0x02, 0xA4, 0xE9, 0x65, 0x47, 0x62, 0x19, 0x68, 0x5D, 0xD3, 0x43, 0x4B, 
-0xD3, 0x79, 0x32, 0xCE, 0xD5, 0x7C, 0x51, 0xBE, 0x59, 0x17, 0x23, 0x4B, 0x17, 0x7A, 0x02, 0xCF, 
-0xD5, 0x8D, 0x51, 0x67, 0xB3, 0xAE, 0xF6, 0x2C, 0x5D, 0x89, 0xBC, 0x9F, 0xAB, 0x0F, 0x59, 0x68, 
-0x36, 0x5E, 0xD9, 0x55, 0x18, 0x50, 0x18, 0xC2, 0xD4, 0xBD, 0x67, 0xC6, 0x30, 0x68, 0xC5, 0x2E, 
-0x19, 0xF4, 0x4C, 0xE2, 0xAA, 0x34, 0xF1, 0x87, 0x18, 0x08, 0x68, 0xEC, 0x4F, 0x7F, 0xC6, 0xBC, 
-0x10, 0x81, 0x99, 0xD3, 0x35, 0xC5, 0x5D, 0x14, 0x1E, 0x74, 0x4A, 0xAF, 0xE3, 0x94, 0x2C, 0xB3, 
-0x88, 0xC7, 0xA9, 0xE3, 0x66, 0x30, 0xC3, 0x0B, 0xD4, 0xEC, 0xB5, 0xBE, 0xF2, 0x78, 0xE2, 0xF3, 
-0x4C, 0xDC, 0x60, 0x84, 0xF9, 0xAB, 0xF2, 0x88, 0x15, 0xB4, 0xF0, 0xA7, 0x8C, 0x62, 0xD5, 0x56, 
-0x97, 0x98, 0x7E, 0xB7, 0x4B, 0x5A, 0xB2, 0xEF, 0x22, 0x8B, 0x5D, 0x77, 0x74, 0x2E, 0x6F, 0xE0, 
-0xAA, 0xD9, 0xE4, 0x1A, 0x7E, 0xB7, 0xD7, 0x95, 0xCF, 0xEF, 0xF6, 0xBA, 0x46, 0xD0, 0x5F, 0x8D, 
-0xBD, 0x6E, 0x1E, 0x0A, 0x0E, 0xE3, 0x5D, 0x3E, 0xC1, 0xF0, 0x7F, 0x11, 0x4F, 0x32, 0xBC, 0x28, 
-0x4C, 0xFC, 0x69, 0x12, 0xB1, 0x9F, 0x02, 0x0F, 0x3F, 0x8A, 0x2C, 0x19, 0xE9, 0xE4, 0xBB, 0x76, 
-0x52, 0xF8, 0x91, 0x12, 0xB9, 0x9E, 0x80, 0xDB, 0x1D, 0x16, 0x31, 0xB0, 0x00, 0x6D, 0x12, 0x16, 
-0xC8, 0xF7, 0x17, 0x32, 0xAF, 0x66, 0xAA, 0xA8, 0xDC, 0x81, 0x53, 0xD9, 0x15, 0xA0, 0xAB, 0x28, 
-0xF6, 0x55, 0xD1, 0x4E, 0x09, 0xA3, 0x55, 0xD0, 0x40, 0x8B, 0x49, 0xB4, 0x56, 0x2C, 0xB3, 0x40, 
-0xEB, 0x1A, 0x11, 0xB5, 0x9C, 0x09, 0xBD, 0x4D, 0x6C, 0x84, 0x64, 0xA6, 0xB6, 0xD3, 0xC5, 0x6E, 
-0x81, 0x2D, 0xCD, 0xB9, 0xCD, 0xB1, 0xA5, 0xF2, 0x7B, 0xDB, 0x66, 0xF1, 0x67, 0x6D, 0x40, 0x40, 
-0xF8, 0xA7, 0x30, 0xF4, 0x0D, 0xF4, 0xFA, 0x1F, 0xC8, 0xB0, 0x9A, 0x66, 0x01, 0x85, 0x87, 0x05, 
-0x88, 0xD8, 0x3D, 0x8A, 0x7F, 0xD6, 0xA0, 0xB5, 0x63, 0x31, 0x8A, 0x28, 0x7E, 0xB5, 0x69, 0x47, 
-0xCF, 0x28, 0x83, 0x37, 0x3F, 0x22, 0xA3, 0x7D, 0xE3, 0x60, 0x63, 0xEE, 0x83, 0x8F, 0xC8, 0x81, 
-0xFE, 0x5A, 0xF7, 0x99, 0x47, 0x64, 0x5F, 0x2F, 0x0A, 0xE5, 0x79, 0x8F, 0xFB, 0xFA, 0xD1, 0x8C, 
-0x42, 0x7E, 0xF0, 0x7E, 0x5C, 0x79, 0x8F, 0xC9, 0xD4, 0xFA, 0xE9, 0x16, 0x99, 0x9B, 0xC0, 0x23, 
-0xD3, 0x5A, 0xCB, 0x75, 0x5B, 0x7D, 0xA4, 0xC5, 0xE9, 0x3A, 0xD6, 0xD2, 0x06, 0xE3, 0xE9, 0x51, 
-0x25, 0xE9, 0xEA, 0x52, 0xDC, 0x57, 0x78, 0x3B, 0x3E, 0x1A, 0x44, 0x31, 0x14, 0xE6, 0x7A, 0x06, 
-0x03, 0x87, 0x50, 0x07, 0x75, 0x9F, 0x01, 0x7F, 0x46, 0x7B, 0x0F, 0xE1, 0xF7, 0x63, 0xDC, 0xBB, 
-0x43, 0x58, 0xAF, 0x67, 0xDE, 0x19, 0xAC, 0xD8, 0x58, 0x4C, 0x33, 0x85, 0x7E, 0x55, 0xB3, 0x81, 
-0xB9, 0x59, 0xD2, 0x51, 0x05, 0xAB, 0xD5, 0x61, 0x62, 0xD7, 0x1A, 0xFC, 0x38, 0x18, 0xA8, 0xFD, 
-0x6B, 0x3B, 0x95, 0xE3, 0x17, 0x4A, 0x20, 0x23, 0xF2, 0xB9, 0xB2, 0x7D, 0xE8, 0x72, 0x17, 0x1D, 
-0xDC, 0x72, 0x58, 0x3D, 0x7B, 0xAA, 0x89, 0x69, 0x60, 0xA9, 0x3E, 0xAC, 0xD6, 0xAF, 0xC8, 0xCF, 
-0x06, 0x53, 0x3B, 0xD3, 0x89, 0xC2, 0x02, 0xF9, 0xD9, 0xDB, 0xD7, 0xAC, 0x9C, 0xF5, 0x6E, 0xDC, 
-0x72, 0xF7, 0x98, 0x62, 0x5A, 0x6D, 0x71, 0x54, 0x65, 0x94, 0x84, 0x3C, 0x84, 0x47, 0x5F, 0xD2, 
-0x84, 0xC5, 0x01, 0xC3, 0xB3, 0x39, 0x4A, 0x32, 0x78, 0xA7, 0xAE, 0xDA, 0xAC, 0x56, 0xBF, 0xD6, 
-0xB5, 0x90, 0x06, 0x97, 0x17, 0x0F, 0xDA, 0xF9, 0xF6, 0xD0, 0x26, 0xBE, 0x3C, 0xCE, 0x3C, 0x76, 
-0x71, 0xCF, 0x06, 0x65, 0x84, 0x8D, 0xC7, 0x2E, 0x1E, 0xDA, 0x20, 0x43, 0xB5, 0x62, 0x61, 0x65, 
-0xA5, 0x1D, 0x44, 0x5B, 0x99, 0x2B, 0xB7, 0x27, 0x83, 0x84, 0xCA, 0xDD, 0xC9, 0x87, 0xE3, 0xAE, 
-0xAD, 0xFA, 0xE7, 0xA4, 0x63, 0xF6, 0xD0, 0x13, 0x57, 0xDF, 0x21, 0x2B, 0x8C, 0x9C, 0x8F, 0xF0, 
-0x23, 0x60, 0x7E, 0x75, 0xE7, 0x81, 0x03, 0x21, 0x5F, 0xAD, 0x41, 0xC3, 0x21, 0xFE, 0xA6, 0x84, 
-0xBF, 0x22, 0x2C, 0x2A, 0xA5, 0xB4, 0x09, 0xAE, 0xD2, 0x67, 0xD7, 0xCB, 0xED, 0x1E, 0xAD, 0x36, 
-0xAA, 0xD2, 0x39, 0x9B, 0x9A, 0x7F, 0x3D, 0xE7, 0xDD, 0x07, 0x9E, 0x75, 0x84, 0x19, 0x9A, 0xE3, 
-0x1C, 0x58, 0x35, 0x75, 0x69, 0x1C, 0x52, 0x56, 0x35, 0xB1, 0x0E, 0xA8, 0x3A, 0x5F, 0x2C, 0x63, 
-0xC9, 0x64, 0x91, 0x73, 0x30, 0xDD, 0x75, 0xC5, 0x9F, 0x46, 0x53, 0x9B, 0x37, 0xFF, 0x0F, 0x55, 
-0xAC, 0x12, 0xA4, 0xA8, 0x6D, 0x00, 0x00, 0x00
-};
-
-#endif
+#ifndef VIEW_JS_H_H
+#define VIEW_JS_H_H
+
+#include <Arduino.h>
+
+// Generated by tools/build_assets.js from view.js - do not edit
+const char view_js[] PROGMEM = {
+0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xED, 0x3D, 0xDB, 0x96, 0xDB, 0x36, 
+0x92, 0xEF, 0xFA, 0x8A, 0x4A, 0x4F, 0xC6, 0xA4, 0x62, 0x8A, 0x2D, 0xA9, 0x2F, 0x76, 0xAB, 0xAD, 
+0xF6, 0x71, 0x6C, 0x67, 0xEC, 0x5D, 0x3B, 0xF1, 0xBA, 0x9D, 0xE4, 0x9C, 0xF5, 0xF1, 0xD9, 0x40, 
+0x24, 0x24, 0x61, 0x9A, 0x22, 0x35, 0x20, 0xD8, 0xDD, 0x9A, 0x9E, 0x7E, 0xDC, 0xE7, 0x7D, 0xDF, 
+0xB3, 0x0F, 0xBB, 0x1F, 0xB0, 0xEF, 0xFB, 0x3E, 0x7F, 0x32, 0x3F, 0xB0, 0xBF, 0xB0, 0xA7, 0x0A, 
+0x00, 0x09, 0x5E, 0xD4, 0x17, 0x3B, 0x93, 0xA7, 0x4D, 0x72, 0x6C, 0x91, 0x2C, 0x54, 0x15, 0x0A, 
+0x85, 0xAA, 0x02, 0x50, 0x85, 0x24, 0x5C, 0x41, 0xB4, 0x64, 0x52, 0x1D, 0xF7, 0x12, 0xAE, 0x40, 
+0xB1, 0xF4, 0xEC, 0x74, 0xCD, 0xE4, 0x59, 0x22, 0x52, 0xFE, 0xBC, 0x7A, 0x9F, 0xB0, 0x5C, 0xBD, 
+0x60, 0x8A, 0xC1, 0x14, 0xD2, 0x22, 0x49, 0x8E, 0x7B, 0x51, 0x96, 0xE6, 0x0A, 0x56, 0xEC, 0x12, 
+0xDF, 0xBE, 0xCB, 0x44, 0xAA, 0x72, 0x98, 0xC2, 0x78, 0x5F, 0x83, 0xE7, 0x3C, 0xCD, 0x33, 0x89, 
+0x9F, 0x5E, 0xA7, 0x8A, 0xCB, 0x73, 0x96, 0xC0, 0x14, 0x0E, 0x86, 0xC3, 0xE1, 0x31, 0xC0, 0xEE, 
+0x2E, 0xBC, 0xE0, 0x73, 0x56, 0x24, 0x0A, 0x0E, 0xF2, 0x00, 0x8A, 0x75, 0xCC, 0x14, 0x8F, 0x61, 
+0x2E, 0xB3, 0x15, 0xCC, 0x58, 0x74, 0xC6, 0xD3, 0x18, 0xA2, 0x2C, 0x9D, 0x8B, 0x05, 0xA1, 0x8A, 
+0x99, 0x62, 0x2F, 0x15, 0x5B, 0x58, 0xCA, 0xD8, 0xFE, 0x54, 0x31, 0xC5, 0xE1, 0x9C, 0xCB, 0x5C, 
+0x64, 0x29, 0x64, 0x73, 0x50, 0x4B, 0x4E, 0x2C, 0xC2, 0x2E, 0x82, 0x83, 0xE4, 0xF9, 0x3A, 0x4B, 
+0x73, 0x4E, 0x08, 0x34, 0xAE, 0x9F, 0x0C, 0xB0, 0x83, 0xE5, 0xA7, 0x7A, 0xFB, 0x5D, 0x0D, 0x08, 
+0x51, 0xB6, 0xDE, 0x80, 0x48, 0xA1, 0x30, 0xED, 0xF9, 0x39, 0x4F, 0x55, 0xFE, 0x3C, 0x4B, 0x53, 
+0x1E, 0x21, 0xA3, 0x53, 0x98, 0xB3, 0x24, 0xE7, 0x84, 0x62, 0x57, 0x7F, 0x84, 0x5C, 0x49, 0xCE, 
+0x56, 0x20, 0x72, 0x28, 0xD6, 0xC7, 0xB0, 0xCE, 0x92, 0x44, 0xA4, 0x0B, 0xC8, 0x15, 0xDB, 0xE4, 
+0xB0, 0x66, 0x45, 0xCE, 0x63, 0x87, 0x15, 0xB7, 0x37, 0xF4, 0x7A, 0x29, 0x72, 0x95, 0xC9, 0xCD, 
+0x7B, 0x1E, 0x65, 0x32, 0x46, 0x31, 0x7E, 0xFC, 0xA4, 0xE5, 0xF4, 0x26, 0x8B, 0x58, 0xA2, 0x19, 
+0x32, 0x4C, 0xC6, 0xFC, 0x5C, 0x44, 0xDC, 0xB6, 0x00, 0x29, 0xD2, 0x85, 0x8B, 0xE2, 0x79, 0x21, 
+0xF3, 0x4C, 0xBA, 0x9D, 0xFC, 0x20, 0x56, 0x3C, 0x57, 0x6C, 0xB5, 0xB6, 0x18, 0x52, 0x7E, 0xC1, 
+0x73, 0x05, 0x92, 0x88, 0xC1, 0x92, 0x27, 0x31, 0x24, 0x48, 0x26, 0xD9, 0xB8, 0x88, 0x2A, 0x71, 
+0xE1, 0x90, 0x21, 0xA2, 0x6F, 0x8B, 0xD5, 0x9A, 0xC7, 0x70, 0xB1, 0xE4, 0x29, 0x3F, 0xE7, 0xB2, 
+0xC9, 0x74, 0xB4, 0x64, 0xE9, 0x82, 0xE7, 0xF5, 0xFE, 0xE4, 0x5C, 0x3D, 0x53, 0x0E, 0x8E, 0x06, 
+0x72, 0x77, 0xE0, 0xE6, 0x45, 0x92, 0x80, 0xE4, 0xEB, 0x84, 0x45, 0x66, 0xD8, 0x50, 0xF9, 0x2A, 
+0x36, 0x06, 0x23, 0xC4, 0xD1, 0x81, 0x04, 0x31, 0x10, 0x6C, 0x0E, 0x51, 0x21, 0x25, 0x4F, 0x55, 
+0xB2, 0x81, 0x7C, 0x99, 0x5D, 0x54, 0x58, 0x1A, 0x52, 0x81, 0x3B, 0xC8, 0xA5, 0x86, 0xB8, 0xC2, 
+0xF4, 0x9D, 0x64, 0x2B, 0x6E, 0x3B, 0x64, 0xF8, 0x79, 0xC7, 0xD3, 0x18, 0x47, 0x9B, 0x00, 0x20, 
+0xDF, 0xA4, 0x11, 0xF8, 0x92, 0xFF, 0xA9, 0xE0, 0xB9, 0x7A, 0x96, 0x8A, 0x15, 0x53, 0x22, 0x4B, 
+0x75, 0x3B, 0x11, 0xF7, 0x1B, 0xB3, 0x03, 0xB9, 0xC8, 0x0A, 0x55, 0x6A, 0xC3, 0x85, 0x48, 0xE3, 
+0xEC, 0x22, 0xCC, 0xD2, 0x24, 0x63, 0xA4, 0x69, 0x45, 0x1A, 0x61, 0x7B, 0xBF, 0x0F, 0x57, 0x66, 
+0xCA, 0x89, 0xFC, 0x59, 0xA1, 0x96, 0x3C, 0x55, 0x22, 0x62, 0x5A, 0x1D, 0x69, 0xF8, 0x4E, 0x55, 
+0x26, 0xD9, 0x82, 0x87, 0x0B, 0xAE, 0x5E, 0x2B, 0xBE, 0xF2, 0xBD, 0x06, 0x9C, 0xD7, 0x3F, 0xEE, 
+0x89, 0x39, 0xF8, 0x5F, 0x35, 0xDB, 0xFF, 0xE5, 0x2F, 0x2D, 0x94, 0x5F, 0x4D, 0xA7, 0xE0, 0x29, 
+0x59, 0x70, 0x0F, 0xC9, 0x1A, 0x9E, 0x90, 0x0A, 0xB2, 0x12, 0x2E, 0x25, 0x9F, 0xC3, 0x14, 0xBC, 
+0x5D, 0xEF, 0xB8, 0x27, 0xB9, 0x2A, 0x64, 0x7A, 0xDC, 0xBB, 0xEE, 0x99, 0x51, 0x09, 0xCD, 0x10, 
+0xD2, 0x0C, 0xF5, 0xB1, 0x53, 0x01, 0xE8, 0x3F, 0xBB, 0xD0, 0xF4, 0xCB, 0x1E, 0xB3, 0x38, 0x7E, 
+0x89, 0x53, 0xE9, 0x8D, 0xC8, 0x15, 0x4F, 0xB9, 0xF4, 0xBD, 0x75, 0xB6, 0xCE, 0x11, 0x89, 0x17, 
+0x54, 0x52, 0xA0, 0xD9, 0x86, 0x3C, 0x59, 0x6A, 0xEB, 0x22, 0x5F, 0xDE, 0x99, 0x94, 0x2B, 0xBF, 
+0xCF, 0x14, 0x5B, 0x25, 0xAD, 0x7B, 0x08, 0xE9, 0xBA, 0x77, 0x8D, 0x58, 0x52, 0xA1, 0x3E, 0x2C, 
+0xF9, 0x8A, 0xFB, 0x06, 0x65, 0xB3, 0xC9, 0x5A, 0x66, 0x2A, 0x8B, 0xB2, 0x04, 0xA6, 0x88, 0x79, 
+0x2E, 0x12, 0x3E, 0xF1, 0x90, 0x5E, 0x0B, 0x75, 0x96, 0xAB, 0x94, 0xD4, 0x10, 0xE1, 0xA8, 0x17, 
+0xF8, 0xEA, 0x0E, 0xB0, 0xA3, 0xF1, 0xA3, 0x70, 0x18, 0x0E, 0xC3, 0x11, 0xB1, 0x9C, 0x73, 0xF5, 
+0x82, 0xAF, 0xB2, 0xB7, 0x59, 0x4C, 0x2C, 0x5D, 0x03, 0x4F, 0x72, 0x0E, 0x57, 0xBD, 0x39, 0x57, 
+0xD1, 0xF2, 0xB4, 0x54, 0x51, 0xFC, 0x96, 0x2B, 0x26, 0x15, 0x8D, 0xCF, 0x29, 0x19, 0x3A, 0xBF, 
+0x4F, 0xB6, 0xE5, 0x5D, 0x91, 0x2F, 0x69, 0xE2, 0xA7, 0x3C, 0xA9, 0xAC, 0x5E, 0x94, 0xA5, 0x4A, 
+0xA4, 0x05, 0xCF, 0x21, 0x4B, 0x93, 0x0D, 0xB0, 0x1C, 0xED, 0x65, 0x82, 0x96, 0xBD, 0x77, 0xDD, 
+0xBB, 0x60, 0x42, 0x7D, 0x97, 0x49, 0xF2, 0x2C, 0x44, 0xF5, 0xB8, 0x67, 0x47, 0x17, 0xEA, 0xDF, 
+0xE0, 0x8A, 0xA4, 0xA4, 0x36, 0x6B, 0x9E, 0xCD, 0xE1, 0x8D, 0x75, 0x47, 0x5A, 0xEE, 0x45, 0x1A, 
+0xF3, 0xB9, 0x48, 0x71, 0x7C, 0xCA, 0x89, 0x41, 0x4C, 0xD2, 0x84, 0x58, 0x73, 0x39, 0xCF, 0xE4, 
+0x8A, 0xA5, 0x11, 0x0F, 0xD3, 0xEC, 0xC2, 0x37, 0xD2, 0x2F, 0x89, 0x22, 0x7C, 0x96, 0xF0, 0x30, 
+0xC9, 0x16, 0xBE, 0xF7, 0x5C, 0xDB, 0x0E, 0x04, 0x10, 0x2C, 0x11, 0x7F, 0xE6, 0x31, 0x1A, 0x7F, 
+0x0F, 0x1E, 0x82, 0xDF, 0xC2, 0x03, 0x03, 0x4B, 0xA5, 0x1F, 0xAA, 0xEC, 0x3B, 0x71, 0xC9, 0x63, 
+0x7F, 0xD4, 0x87, 0x87, 0xE0, 0xC1, 0x2A, 0xB7, 0xAA, 0x62, 0x5D, 0xA5, 0xE5, 0xCC, 0x52, 0xDA, 
+0x31, 0x94, 0x24, 0x67, 0xF1, 0x26, 0x80, 0x75, 0xB6, 0x2E, 0x12, 0xA6, 0x50, 0x62, 0x17, 0x42, 
+0x2D, 0x21, 0x62, 0xD1, 0x92, 0xC7, 0xE4, 0xEE, 0xC2, 0x30, 0xDC, 0xE9, 0x1F, 0xF7, 0xB4, 0x67, 
+0xFC, 0xF1, 0x75, 0x85, 0x91, 0x74, 0xC9, 0x8E, 0x53, 0xAD, 0x17, 0x2F, 0xF3, 0x35, 0x97, 0x2C, 
+0x8D, 0x33, 0x60, 0xDA, 0x10, 0x85, 0x7F, 0xCC, 0xC3, 0x30, 0x44, 0x9E, 0x72, 0xAE, 0x8C, 0x99, 
+0xF1, 0x5D, 0x09, 0x07, 0x30, 0x1A, 0x0E, 0x35, 0xC6, 0x6A, 0x08, 0x92, 0x6C, 0x81, 0x70, 0xC8, 
+0x7A, 0x6D, 0x7A, 0x48, 0xBE, 0xCA, 0xCE, 0xF9, 0xD6, 0x19, 0xB2, 0x15, 0xB6, 0xC8, 0xB9, 0x44, 
+0xFD, 0xBB, 0x11, 0x48, 0xE4, 0x7F, 0x40, 0x63, 0x89, 0x30, 0x29, 0x3B, 0x17, 0x0B, 0xA6, 0xF8, 
+0xCF, 0x42, 0x2D, 0x3F, 0x48, 0x96, 0xE6, 0x82, 0xE6, 0xBD, 0x97, 0x64, 0x0B, 0x91, 0x86, 0x4B, 
+0xB5, 0x4A, 0x3C, 0x62, 0xB9, 0x64, 0x78, 0x4B, 0x83, 0x42, 0x26, 0xD8, 0x87, 0x38, 0x8B, 0x8A, 
+0x15, 0x4F, 0x55, 0x38, 0xCB, 0xE2, 0x4D, 0x18, 0x25, 0x2C, 0xCF, 0xD1, 0xC0, 0xA0, 0xB5, 0xF1, 
+0xBD, 0x35, 0x5B, 0xF0, 0x01, 0xBF, 0x14, 0x38, 0x04, 0x0D, 0x39, 0xD5, 0xCC, 0xEE, 0x96, 0xA9, 
+0x5D, 0xC8, 0xE4, 0xB8, 0x77, 0x1D, 0xC0, 0xD8, 0x48, 0xB1, 0x64, 0xC9, 0x99, 0xE8, 0xA5, 0x6E, 
+0x2A, 0x7C, 0xFE, 0x90, 0x2D, 0x16, 0x09, 0xFF, 0x56, 0xA1, 0x3B, 0x2B, 0x39, 0x5B, 0x70, 0xF5, 
+0x32, 0xE1, 0xF8, 0xF3, 0xDB, 0xCD, 0xEB, 0xD8, 0xF7, 0x08, 0x72, 0xA0, 0x08, 0x74, 0x30, 0x53, 
+0xA9, 0x57, 0x1A, 0xAE, 0x9C, 0x9D, 0xF3, 0x98, 0x10, 0x6F, 0x35, 0x5E, 0xD4, 0xD8, 0xEA, 0xA1, 
+0x0B, 0x8F, 0x73, 0x26, 0x66, 0xF2, 0xCC, 0xBB, 0x55, 0x2A, 0x08, 0x35, 0x28, 0xF1, 0x94, 0xA0, 
+0xF6, 0x87, 0xE1, 0xF5, 0xE6, 0x56, 0x5A, 0x71, 0x89, 0xF4, 0xEB, 0x28, 0x4B, 0x7D, 0xB4, 0x92, 
+0x81, 0x8E, 0x9A, 0x48, 0x54, 0x75, 0x69, 0x74, 0xD8, 0xFE, 0x28, 0x11, 0xD1, 0x99, 0x6B, 0xF8, 
+0x2B, 0x49, 0x5E, 0x88, 0x24, 0xF9, 0x96, 0xBF, 0x60, 0xF2, 0x0C, 0xA6, 0xF0, 0xD5, 0xB6, 0xAE, 
+0xA0, 0x0D, 0x62, 0x22, 0xCD, 0x9B, 0x9C, 0x29, 0x29, 0x16, 0x0B, 0x2E, 0x89, 0x35, 0x47, 0x5D, 
+0x2A, 0xA4, 0xC8, 0x5F, 0x7D, 0x38, 0xB7, 0x34, 0x51, 0x19, 0x81, 0x97, 0x7C, 0x65, 0xE7, 0x5C, 
+0x26, 0x6C, 0x73, 0x87, 0xA1, 0x2D, 0x71, 0x0C, 0x4C, 0x9B, 0x6A, 0x88, 0x7F, 0x0D, 0x35, 0x31, 
+0x41, 0x10, 0x0A, 0x1E, 0xA6, 0x0D, 0x8C, 0xE1, 0x9F, 0x0A, 0x2E, 0x37, 0xA7, 0x3C, 0xE1, 0x91, 
+0xCA, 0xA4, 0xEF, 0x85, 0x1A, 0x8D, 0x88, 0x32, 0x07, 0x41, 0xCA, 0x2F, 0x4C, 0xE3, 0x92, 0x7A, 
+0x24, 0x39, 0x53, 0xDC, 0x30, 0xF0, 0xFD, 0xA9, 0xEF, 0x2D, 0x95, 0x5A, 0x4F, 0x76, 0x77, 0x2F, 
+0x2E, 0x2E, 0xC2, 0x8B, 0xBD, 0x30, 0x93, 0x8B, 0xDD, 0xF1, 0x70, 0x38, 0xDC, 0xCD, 0xCF, 0x17, 
+0x5E, 0x00, 0x1E, 0xFE, 0x85, 0x93, 0x59, 0x23, 0x0A, 0x29, 0x0A, 0x54, 0x52, 0xCC, 0x0A, 0xC5, 
+0x71, 0x6C, 0x59, 0x9E, 0x23, 0x54, 0x45, 0x1B, 0xAA, 0x9F, 0x83, 0x94, 0x5F, 0x6C, 0x6F, 0x7B, 
+0x2E, 0xF8, 0xC5, 0xB7, 0xD9, 0x25, 0xB6, 0x1E, 0xC2, 0x10, 0xC6, 0xFB, 0x30, 0xDE, 0xDF, 0x0E, 
+0x3D, 0x17, 0x49, 0x82, 0xA0, 0x69, 0x96, 0xF2, 0xED, 0x50, 0xB9, 0x92, 0xD9, 0x19, 0x46, 0x19, 
+0x9E, 0x91, 0xDC, 0xF3, 0x2C, 0xC9, 0xE4, 0x6D, 0xF0, 0x83, 0x0B, 0x11, 0xAB, 0x25, 0xB6, 0x1A, 
+0xDB, 0xF9, 0x56, 0x69, 0x84, 0x6D, 0x28, 0xD2, 0x94, 0xCB, 0x57, 0x1F, 0xDE, 0xBE, 0x81, 0x29, 
+0xFC, 0xF2, 0x64, 0xCD, 0xD4, 0x12, 0xE2, 0xE9, 0xCE, 0xDB, 0xF1, 0x08, 0x46, 0xE3, 0xF0, 0xD1, 
+0xD1, 0xB3, 0x23, 0x38, 0x82, 0x21, 0x8C, 0xF0, 0xDF, 0x51, 0x38, 0x1E, 0xC1, 0x1E, 0x3C, 0x82, 
+0x47, 0x30, 0xA4, 0x7F, 0x2D, 0xD0, 0x9F, 0x77, 0x4E, 0x9E, 0xEC, 0x62, 0xD3, 0x93, 0x5F, 0x8E, 
+0x7B, 0xCE, 0xD8, 0x36, 0x67, 0x60, 0x5E, 0xA4, 0x83, 0x9C, 0x2B, 0x6B, 0xCC, 0x2C, 0x0B, 0x0D, 
+0xA8, 0x55, 0x96, 0xA5, 0x03, 0x29, 0x72, 0x03, 0x55, 0xFA, 0x92, 0x4E, 0x8E, 0x7B, 0xE0, 0xFC, 
+0xF3, 0x24, 0x12, 0x32, 0x4A, 0x38, 0x44, 0x97, 0xD3, 0x9D, 0xD1, 0x78, 0x07, 0xA2, 0x8D, 0xFE, 
+0x5B, 0x4E, 0x77, 0x0E, 0x90, 0x45, 0xFD, 0xF9, 0xA4, 0xDE, 0x06, 0x17, 0x91, 0x70, 0x39, 0xD2, 
+0x90, 0x1B, 0xFC, 0x7B, 0x07, 0x2E, 0xC7, 0xE6, 0x71, 0x3C, 0xDD, 0xD9, 0xC3, 0x96, 0x08, 0x74, 
+0x5B, 0xBB, 0x71, 0xA3, 0xE1, 0xF8, 0xD6, 0x96, 0xFB, 0xE1, 0xD8, 0xB4, 0xD5, 0xBF, 0xB0, 0xF5, 
+0x41, 0x78, 0xB8, 0xAF, 0xDB, 0xD3, 0xAF, 0xDB, 0x68, 0x3F, 0x0E, 0xF7, 0x0E, 0x0D, 0xDB, 0xFA, 
+0x27, 0x71, 0x70, 0x14, 0x3E, 0x7A, 0xAC, 0x91, 0xE8, 0x9F, 0xB7, 0x61, 0x31, 0x18, 0x0C, 0x0B, 
+0x7B, 0xA6, 0xE9, 0xF8, 0xB6, 0x76, 0xE3, 0x46, 0xC3, 0xF1, 0x9D, 0x5B, 0x56, 0x3D, 0x37, 0xBC, 
+0xD6, 0xBB, 0xAE, 0xFB, 0x72, 0xF7, 0xBE, 0xEB, 0x96, 0x8D, 0xAE, 0x13, 0x8D, 0x16, 0x8E, 0x9B, 
+0x35, 0x94, 0x74, 0xEF, 0x76, 0x15, 0x45, 0x45, 0x76, 0x34, 0xB4, 0xE5, 0x2C, 0xD6, 0x6B, 0x9E, 
+0xC6, 0xCF, 0x97, 0x22, 0x89, 0x7D, 0x83, 0xA1, 0x7F, 0xDC, 0x33, 0x96, 0xB4, 0x89, 0x8B, 0x45, 
+0x4A, 0x9C, 0xF3, 0xF6, 0x04, 0xFD, 0xBB, 0x7B, 0xC0, 0xAD, 0xAD, 0x9A, 0xB6, 0x64, 0x93, 0x90, 
+0xE9, 0xC1, 0xE8, 0x78, 0x21, 0xB3, 0x22, 0x8D, 0x07, 0x11, 0x9A, 0x9F, 0x09, 0xFC, 0x6E, 0xC8, 
+0x86, 0xF3, 0x11, 0x87, 0xAF, 0xC4, 0x6A, 0x9D, 0x49, 0xC5, 0x52, 0x75, 0x5C, 0x43, 0x4C, 0x9C, 
+0x7F, 0x09, 0x36, 0xB0, 0x9F, 0xE6, 0xF4, 0x4F, 0x93, 0x50, 0x69, 0x1A, 0xB6, 0xC9, 0x4A, 0x47, 
+0x70, 0x9F, 0x21, 0xAE, 0x7B, 0x36, 0xD4, 0xE0, 0xAD, 0x6E, 0xB6, 0x64, 0xB1, 0x1D, 0xEE, 0xBA, 
+0x1E, 0x7A, 0xE6, 0xF5, 0x68, 0x29, 0x00, 0xAD, 0x17, 0xF0, 0xD4, 0x84, 0x48, 0x30, 0x01, 0x2F, 
+0x11, 0x8B, 0xA5, 0x6A, 0x04, 0x85, 0x7E, 0x1F, 0xA6, 0x27, 0xF5, 0x55, 0x49, 0xD4, 0xBD, 0x22, 
+0xD1, 0x01, 0xB8, 0x8E, 0x82, 0xFC, 0xD2, 0xFD, 0x94, 0xB1, 0x62, 0x07, 0xCE, 0xB6, 0xFE, 0x5A, 
+0x29, 0x55, 0x2A, 0xEC, 0x4E, 0x2D, 0xF3, 0xB5, 0x73, 0x16, 0xD9, 0x96, 0xAE, 0xAD, 0x47, 0xA7, 
+0x5C, 0x34, 0x9F, 0xEC, 0x5C, 0x0C, 0xE0, 0x0E, 0x73, 0xD3, 0x62, 0x6D, 0xBB, 0xEA, 0xEB, 0x00, 
+0xF6, 0x9B, 0x31, 0x70, 0x33, 0x02, 0x14, 0x39, 0x8A, 0x38, 0x00, 0x46, 0x1B, 0x22, 0xDC, 0xEE, 
+0xA1, 0x35, 0x02, 0xE4, 0x66, 0xD8, 0x71, 0x73, 0xB4, 0x82, 0xE3, 0x60, 0xF0, 0xF5, 0xC1, 0x6E, 
+0x44, 0xE0, 0x4B, 0x4D, 0x0C, 0x71, 0x97, 0x58, 0x7F, 0x7D, 0x57, 0x5C, 0xCE, 0x8F, 0x2D, 0x34, 
+0xFE, 0xDF, 0x79, 0xFE, 0xBF, 0xF3, 0xBC, 0xAF, 0xF3, 0xBC, 0x6E, 0x2E, 0x23, 0xAB, 0xAD, 0x10, 
+0x13, 0xDB, 0xAB, 0xCB, 0x9B, 0x16, 0x05, 0x76, 0x13, 0x18, 0x5B, 0x79, 0x7D, 0xFC, 0xFC, 0x3C, 
+0x4B, 0x15, 0xBF, 0x54, 0xBE, 0x37, 0xA6, 0x75, 0x7A, 0xB9, 0x8B, 0x12, 0xC6, 0x7A, 0x07, 0x3E, 
+0x0F, 0xE7, 0x59, 0xAA, 0xC2, 0x39, 0x5B, 0x89, 0x04, 0xD7, 0x2E, 0x3B, 0x1E, 0xED, 0xD7, 0x7B, 
+0x01, 0xE4, 0x2C, 0xCD, 0x07, 0x39, 0x97, 0x62, 0xBE, 0xD3, 0xD9, 0x8E, 0xBC, 0x07, 0xEE, 0x70, 
+0xFD, 0xEE, 0x28, 0x62, 0x7B, 0x6C, 0xEE, 0xD9, 0xE5, 0xC3, 0x42, 0xB2, 0x58, 0xF0, 0x54, 0x7D, 
+0xE0, 0xAB, 0x35, 0x4C, 0x91, 0x65, 0xB3, 0x7C, 0x40, 0x24, 0x4C, 0xFE, 0xC1, 0x7C, 0xF6, 0x87, 
+0x01, 0xE8, 0xFF, 0xB4, 0xF1, 0x70, 0x9B, 0xA1, 0x47, 0xA5, 0x28, 0xFC, 0x54, 0x65, 0x6B, 0x04, 
+0xF4, 0xE4, 0x62, 0xC6, 0xFC, 0xF1, 0xFE, 0x41, 0x00, 0xA3, 0x83, 0xC7, 0x01, 0x8C, 0x46, 0x01, 
+0x0C, 0xC3, 0x83, 0xBE, 0x77, 0x63, 0xC3, 0xD1, 0xB6, 0x86, 0xA3, 0x7E, 0xB5, 0xDA, 0xB1, 0xCD, 
+0x5F, 0x15, 0xAB, 0xCF, 0xE0, 0xF6, 0x55, 0xB1, 0xDA, 0xC2, 0xEC, 0xC1, 0x51, 0x00, 0xA3, 0xBD, 
+0x61, 0x00, 0xE3, 0xFD, 0xC3, 0x36, 0xB3, 0xAD, 0x76, 0xA3, 0x6D, 0xED, 0xBA, 0x78, 0x3D, 0xCD, 
+0x44, 0xF2, 0x19, 0xCC, 0x62, 0xB3, 0x2D, 0xDC, 0x8E, 0x0E, 0x03, 0x18, 0x3D, 0x46, 0x29, 0x8D, 
+0x8F, 0xDA, 0xDC, 0xB6, 0x1B, 0x8E, 0xB6, 0x35, 0xEC, 0x62, 0xF7, 0x0D, 0x3A, 0xD3, 0xCF, 0xE0, 
+0x97, 0xDA, 0x6D, 0xD3, 0x85, 0x83, 0x51, 0x00, 0xA3, 0xA3, 0x51, 0x00, 0x7B, 0x1D, 0xE2, 0xED, 
+0x68, 0x39, 0xDA, 0xD6, 0xD2, 0x70, 0x4C, 0x9E, 0x7C, 0x8A, 0x8B, 0xDF, 0x6A, 0xAF, 0xD1, 0x8F, 
+0xD4, 0x65, 0x80, 0x26, 0x7E, 0xB3, 0xE6, 0x14, 0x14, 0xA4, 0xDC, 0x0B, 0x7A, 0xB8, 0x43, 0x37, 
+0xC1, 0x0D, 0x32, 0x36, 0xE3, 0x49, 0x3E, 0x81, 0x8F, 0x9F, 0xF4, 0xBB, 0x9C, 0x2B, 0x7C, 0xEA, 
+0x99, 0x2F, 0x13, 0xF0, 0x50, 0x25, 0xBD, 0xA0, 0x37, 0xCB, 0x64, 0xCC, 0xE5, 0x73, 0x1D, 0x6E, 
+0x79, 0xBF, 0x9B, 0x1F, 0x1C, 0xF1, 0xE1, 0x0C, 0xDF, 0x97, 0x61, 0x9A, 0xF9, 0xE6, 0xAA, 0xB2, 
+0xA5, 0x83, 0xD8, 0x15, 0x4F, 0xF1, 0xA8, 0x63, 0x02, 0xC3, 0x70, 0x3F, 0xE8, 0xE1, 0xB2, 0x76, 
+0x02, 0xB4, 0xA7, 0xD2, 0x5B, 0xE3, 0xC1, 0xDB, 0x7B, 0x16, 0x8B, 0x22, 0x9F, 0xC0, 0xBE, 0x79, 
+0x7E, 0x85, 0xD1, 0x84, 0x7D, 0x79, 0x68, 0x5E, 0x7E, 0xDB, 0x24, 0xE6, 0x30, 0xA2, 0x01, 0x1A, 
+0x5C, 0xCE, 0xE7, 0xF5, 0x2F, 0x3F, 0xE3, 0x82, 0x77, 0x02, 0x63, 0xDB, 0x1F, 0xF3, 0xBC, 0x17, 
+0xF4, 0x96, 0x22, 0x8E, 0x79, 0x3A, 0xD1, 0x2E, 0xBD, 0x77, 0x1D, 0x38, 0x12, 0x78, 0x55, 0xAC, 
+0x78, 0xCC, 0xE2, 0xB6, 0x10, 0xF6, 0x66, 0x8F, 0xC7, 0xF3, 0xC3, 0x9B, 0x84, 0xF0, 0xAA, 0x58, 
+0xFD, 0x06, 0x32, 0x28, 0xF9, 0xF8, 0x95, 0x64, 0x80, 0x2C, 0xD5, 0x45, 0x70, 0x5A, 0xF0, 0x24, 
+0x6B, 0x0B, 0x60, 0x34, 0x9C, 0x1D, 0x3D, 0x1E, 0xDD, 0x24, 0x00, 0x9C, 0x75, 0xBF, 0x81, 0x04, 
+0x4A, 0x46, 0xFE, 0x6E, 0x12, 0x78, 0x53, 0xAC, 0x44, 0x9A, 0xE5, 0xA2, 0x53, 0x11, 0xE6, 0xB3, 
+0xD9, 0x7C, 0xBC, 0x7F, 0x93, 0x1C, 0x68, 0x32, 0xFF, 0x16, 0xD3, 0xC1, 0x72, 0xF2, 0xAB, 0x0A, 
+0xA2, 0xF7, 0x09, 0x85, 0x91, 0xAD, 0xD1, 0xA7, 0xE7, 0x68, 0x36, 0xCC, 0xD9, 0xB4, 0x38, 0xE7, 
+0x96, 0xEB, 0x15, 0x13, 0xB4, 0x5B, 0xF9, 0x2C, 0x5F, 0xF3, 0x48, 0xBD, 0xC7, 0x5D, 0x66, 0x33, 
+0x99, 0x82, 0xDE, 0x3A, 0x29, 0x16, 0x42, 0x37, 0x4C, 0xF8, 0x82, 0xA7, 0xF1, 0x04, 0xAE, 0x20, 
+0x16, 0xF9, 0x3A, 0x61, 0x1B, 0x03, 0x04, 0xD7, 0x41, 0x4F, 0x65, 0x59, 0xA2, 0xC4, 0x1A, 0xC1, 
+0x56, 0x59, 0x8C, 0xC6, 0x4A, 0xA4, 0x31, 0xBF, 0xF4, 0x82, 0x9E, 0x40, 0x7F, 0x9E, 0xF3, 0x48, 
+0x95, 0x28, 0x5B, 0x82, 0xB6, 0x76, 0xF1, 0x20, 0x80, 0xEA, 0x8F, 0x61, 0x78, 0xD4, 0xF7, 0x82, 
+0x9E, 0x12, 0x2A, 0xE1, 0x95, 0xAE, 0xCC, 0xC7, 0x47, 0x7B, 0x8F, 0x68, 0x10, 0xE3, 0x4D, 0xF9, 
+0x76, 0x7F, 0x76, 0x70, 0x70, 0xB8, 0xD7, 0x1E, 0x5A, 0x7E, 0xC0, 0x1F, 0xF1, 0x99, 0xD7, 0x90, 
+0xD0, 0x28, 0xE8, 0xAD, 0x59, 0x8C, 0x27, 0xA6, 0x13, 0x18, 0x8D, 0x83, 0x5E, 0x94, 0xC9, 0xB4, 
+0x1A, 0x9F, 0xC7, 0x41, 0xCF, 0xF4, 0x8E, 0xD0, 0xE4, 0x56, 0x46, 0xB3, 0xEC, 0xF2, 0x9D, 0x6D, 
+0xB5, 0x8F, 0x81, 0x52, 0xD0, 0xCB, 0x23, 0x96, 0x70, 0x92, 0xCC, 0x06, 0xFF, 0x58, 0x48, 0x81, 
+0xC2, 0xE9, 0x95, 0xC2, 0xD1, 0x0D, 0xA3, 0x72, 0x04, 0xF7, 0xE6, 0xFB, 0x34, 0xD3, 0x63, 0xC9, 
+0x2E, 0xF4, 0x18, 0x3A, 0x26, 0x6B, 0xC6, 0x17, 0x22, 0x7D, 0xA6, 0xFE, 0x99, 0xCB, 0xCC, 0xB6, 
+0x54, 0x22, 0x3A, 0x43, 0xF4, 0x50, 0xB1, 0x3B, 0x0C, 0x00, 0xE3, 0x25, 0x7C, 0x99, 0x8B, 0x3F, 
+0xF3, 0x09, 0x8C, 0x46, 0x70, 0x0D, 0xC4, 0xCD, 0xA5, 0xC3, 0x43, 0xD7, 0x00, 0xDD, 0x11, 0x59, 
+0x80, 0x29, 0x15, 0xEF, 0x33, 0x45, 0x47, 0x0D, 0x13, 0xF4, 0x89, 0xAC, 0x50, 0xD9, 0xE9, 0x99, 
+0x58, 0x97, 0xDD, 0x1F, 0x0F, 0x91, 0x22, 0xD2, 0xA4, 0xB1, 0x65, 0x91, 0x06, 0xBD, 0x02, 0x33, 
+0xF2, 0xE8, 0x5A, 0xF1, 0x38, 0x25, 0x00, 0x76, 0x29, 0xF2, 0x09, 0x78, 0xB8, 0x5F, 0xDA, 0x54, 
+0x03, 0xE4, 0x29, 0x61, 0x9B, 0xAC, 0x50, 0x35, 0xA6, 0xAE, 0x40, 0x65, 0x6B, 0xCD, 0x9B, 0xC4, 
+0x69, 0xA7, 0x7F, 0xCE, 0x32, 0xA5, 0xB2, 0xD5, 0x04, 0x0E, 0x02, 0x48, 0xF8, 0x5C, 0x4D, 0xE0, 
+0x00, 0x7B, 0x1D, 0xF4, 0x98, 0x3D, 0xDE, 0x26, 0xB9, 0x17, 0xD2, 0xFC, 0xC6, 0xAD, 0xE0, 0xA0, 
+0xC7, 0x59, 0x4E, 0x28, 0x3D, 0xCE, 0x72, 0xFE, 0x43, 0xA1, 0xFE, 0xA9, 0xC0, 0xA8, 0x94, 0x62, 
+0xDC, 0xEB, 0x6A, 0xC3, 0x9B, 0xA5, 0x67, 0xCF, 0x6F, 0x0E, 0x6A, 0x6B, 0x19, 0x29, 0x9D, 0x51, 
+0x6D, 0x85, 0xCA, 0x46, 0x14, 0xB8, 0xF1, 0xAD, 0x31, 0xDF, 0x12, 0x70, 0x8C, 0x0E, 0x31, 0xE0, 
+0x70, 0x9B, 0xDE, 0x31, 0x9C, 0x3B, 0xA4, 0xA8, 0x61, 0x7B, 0xC3, 0xAD, 0xF1, 0xDC, 0xB0, 0x6C, 
+0x58, 0x4F, 0xB3, 0x69, 0xC5, 0x1E, 0xA6, 0x03, 0xF7, 0x8E, 0x3F, 0xAE, 0x1C, 0x4B, 0xD9, 0x98, 
+0x90, 0xE3, 0x83, 0xC3, 0x3D, 0xDE, 0x19, 0x79, 0xB8, 0x1D, 0x69, 0xCC, 0xD7, 0x71, 0xCD, 0xE0, 
+0x1E, 0xFC, 0x8A, 0x06, 0xB7, 0x64, 0xE7, 0x9E, 0x06, 0x57, 0x13, 0x11, 0x25, 0xDD, 0xF1, 0x30, 
+0xE8, 0x5D, 0xFF, 0xD6, 0x66, 0x96, 0xA7, 0x6C, 0x96, 0xF0, 0xB8, 0x44, 0xFE, 0xAB, 0x59, 0xDD, 
+0x83, 0xDF, 0xC0, 0xEC, 0x0E, 0x6F, 0x37, 0xBB, 0x86, 0x6D, 0x62, 0xE4, 0xBB, 0xBA, 0x99, 0x1A, 
+0x07, 0x70, 0xC1, 0xB5, 0x75, 0xF0, 0x66, 0x59, 0x12, 0x7B, 0x28, 0x1A, 0x64, 0xAD, 0x01, 0xB7, 
+0xE7, 0xC0, 0x1D, 0x0E, 0x87, 0x04, 0x16, 0x99, 0x54, 0x00, 0x12, 0x35, 0x21, 0x9F, 0x80, 0x1F, 
+0xE9, 0xF9, 0x4C, 0x7B, 0x61, 0xE6, 0xF7, 0xC7, 0xE1, 0xA7, 0x90, 0x14, 0x1C, 0xB3, 0x1A, 0xBC, 
+0xEF, 0xC5, 0x39, 0x4F, 0xBC, 0xC0, 0x46, 0x14, 0xB5, 0x06, 0xBF, 0x7C, 0x7D, 0x65, 0x1E, 0xC3, 
+0x35, 0x93, 0x39, 0x8F, 0xC3, 0xCD, 0xF5, 0xEF, 0x7F, 0xE9, 0x5D, 0x77, 0x3A, 0x89, 0x86, 0x73, 
+0x58, 0x67, 0xFA, 0x24, 0x0E, 0x47, 0x83, 0x76, 0xFC, 0x3A, 0x1D, 0xC1, 0x8A, 0x5D, 0xA2, 0xCC, 
+0x86, 0xC1, 0x17, 0xF8, 0x18, 0xED, 0x01, 0xDE, 0xF0, 0x74, 0x81, 0x83, 0x31, 0xEC, 0x39, 0x2E, 
+0xA1, 0x89, 0xAD, 0xE1, 0x14, 0x86, 0x8E, 0x14, 0x0F, 0xAC, 0x14, 0x2D, 0x41, 0xB3, 0xF6, 0x76, 
+0xC6, 0xF6, 0x31, 0xF1, 0xFB, 0x01, 0x71, 0xBF, 0x11, 0x2B, 0xA1, 0x28, 0x24, 0xB1, 0x52, 0x9F, 
+0x80, 0x7F, 0xCE, 0x92, 0x82, 0x93, 0xE0, 0xE8, 0x17, 0xE6, 0x2E, 0xFC, 0xDE, 0xEB, 0x95, 0x2E, 
+0xAC, 0xA5, 0xF4, 0xBF, 0x82, 0x9F, 0xF9, 0x12, 0x37, 0xE1, 0x6C, 0x88, 0x60, 0x4E, 0x97, 0x31, 
+0x8D, 0x9B, 0x35, 0xAF, 0x6D, 0xE3, 0xD7, 0x36, 0x0A, 0x9F, 0x25, 0x89, 0xEF, 0x85, 0x25, 0xCF, 
+0xE7, 0x7C, 0x10, 0x31, 0x19, 0x7B, 0xFD, 0x70, 0x9E, 0xC9, 0x97, 0x2C, 0x5A, 0xFA, 0x3C, 0xD1, 
+0x9B, 0xAE, 0x3C, 0xD9, 0xBA, 0xDF, 0x3A, 0x58, 0x71, 0x25, 0x45, 0x84, 0x5B, 0xA3, 0xE6, 0x85, 
+0xA2, 0xB5, 0x5C, 0xF9, 0xB8, 0x2C, 0x56, 0x22, 0x16, 0x6A, 0xE3, 0xBC, 0xCA, 0x33, 0xA1, 0xB3, 
+0x13, 0xEC, 0x71, 0x83, 0xBB, 0x47, 0x3C, 0x6D, 0xEE, 0x11, 0xDB, 0x0D, 0x4B, 0xBD, 0x57, 0x4C, 
+0x59, 0x1F, 0xD6, 0x88, 0x97, 0x8C, 0x62, 0x2E, 0xE0, 0x09, 0xC4, 0x79, 0xA8, 0x43, 0x4A, 0xF4, 
+0x6A, 0xB2, 0xE0, 0x76, 0xB5, 0xDA, 0xDA, 0x60, 0xA6, 0xFC, 0x4D, 0x9C, 0x52, 0xB8, 0x91, 0xB3, 
+0x73, 0x6C, 0x32, 0x0E, 0xF5, 0x36, 0x0D, 0x3E, 0x5B, 0xA6, 0x34, 0x33, 0xD4, 0x21, 0xDA, 0x5A, 
+0x6A, 0x73, 0x80, 0xB3, 0xAF, 0xA4, 0xA9, 0xB3, 0x1D, 0x7B, 0x25, 0xE6, 0x3F, 0xC8, 0xBF, 0xFE, 
+0xD7, 0x5C, 0x44, 0xD9, 0x04, 0x70, 0x9D, 0xCA, 0x25, 0x53, 0x85, 0x64, 0x3B, 0xCE, 0x76, 0x7C, 
+0xD3, 0x83, 0xA3, 0xF8, 0xB5, 0xFC, 0xFA, 0xDD, 0x07, 0x34, 0x5B, 0xA4, 0x4D, 0xAE, 0xDD, 0xB0, 
+0x6F, 0x16, 0xAB, 0x3B, 0xE5, 0xC6, 0x6B, 0xBD, 0x33, 0xE5, 0x70, 0x6C, 0xEB, 0xD0, 0xE8, 0x4E, 
+0x1D, 0x32, 0xCB, 0xD5, 0x5B, 0x3B, 0x53, 0x91, 0xBB, 0x6B, 0x87, 0xAA, 0x16, 0x6E, 0xA7, 0xF4, 
+0xEA, 0x73, 0x5B, 0xA7, 0xB4, 0x42, 0x6D, 0xE9, 0xD0, 0xF8, 0x4E, 0x1D, 0xA2, 0xC5, 0xE7, 0xAD, 
+0xDD, 0xD1, 0x84, 0xEE, 0xDA, 0x15, 0xAB, 0xE7, 0x55, 0x37, 0xF4, 0x12, 0x72, 0x5B, 0x37, 0xCC, 
+0x59, 0xCA, 0x96, 0x7E, 0xEC, 0xDD, 0xA9, 0x1F, 0xCE, 0x12, 0xF2, 0xD6, 0xDE, 0x18, 0x7A, 0x77, 
+0xED, 0x4E, 0x79, 0xD4, 0xE3, 0xE8, 0x1A, 0xAD, 0x04, 0xB1, 0x3F, 0x37, 0x90, 0xC2, 0xBE, 0x0C, 
+0x88, 0x55, 0xAF, 0xAF, 0xB7, 0xFE, 0x3F, 0xF0, 0x4B, 0x8A, 0x3C, 0xF1, 0xDD, 0xF1, 0x5D, 0x5B, 
+0xD2, 0x29, 0x55, 0xB9, 0x9B, 0x4A, 0x7F, 0xDB, 0xF9, 0x6D, 0xA2, 0x99, 0xB0, 0xB4, 0x9F, 0x21, 
+0x6E, 0xD1, 0x5E, 0x51, 0xA6, 0xF4, 0x04, 0x86, 0x70, 0xDD, 0x30, 0x04, 0x64, 0x2E, 0x75, 0x30, 
+0x2C, 0x79, 0x1A, 0x73, 0xC9, 0xE3, 0x9F, 0xD0, 0xC6, 0xE7, 0x26, 0xB6, 0xFC, 0x99, 0xB3, 0xB3, 
+0xB7, 0x6C, 0x6D, 0x92, 0xF7, 0xB8, 0xE6, 0x09, 0x06, 0x27, 0xB8, 0x00, 0x90, 0xD9, 0x9A, 0x4B, 
+0xB5, 0x99, 0xE8, 0x64, 0x5C, 0xED, 0x1A, 0x1C, 0xDB, 0xAB, 0xB3, 0x7B, 0x63, 0x9F, 0x27, 0x01, 
+0x9C, 0xF1, 0x4D, 0x00, 0xC6, 0x8D, 0x5C, 0x95, 0xC9, 0xE1, 0x30, 0x6D, 0x10, 0xC5, 0x7E, 0xFB, 
+0x3C, 0xB1, 0xF9, 0x93, 0x08, 0x43, 0xF0, 0x1A, 0xF6, 0xEA, 0x1A, 0x93, 0x47, 0x6B, 0xF0, 0x39, 
+0xC1, 0x07, 0x84, 0x8D, 0xBA, 0x62, 0x93, 0xE9, 0x3E, 0x9E, 0xF1, 0xCD, 0x27, 0xD2, 0x25, 0x43, 
+0x55, 0xDB, 0x4E, 0xAB, 0x2E, 0x0E, 0x88, 0x06, 0xB0, 0x69, 0xA9, 0x64, 0x2D, 0xEB, 0x2E, 0x84, 
+0x2B, 0x1C, 0x24, 0x22, 0xA3, 0x03, 0x08, 0x7D, 0x9C, 0xC7, 0x13, 0x78, 0xF0, 0xA0, 0xD6, 0x49, 
+0x8F, 0x62, 0x8A, 0x14, 0xBD, 0x1B, 0x01, 0xF6, 0x81, 0x27, 0xF5, 0x51, 0xE6, 0x97, 0xAA, 0x89, 
+0xFB, 0x95, 0x5A, 0x25, 0xD4, 0x1A, 0x13, 0xD5, 0xEE, 0x84, 0x9B, 0x00, 0x2B, 0xDC, 0xE6, 0xF0, 
+0x08, 0xDF, 0x36, 0x71, 0x9F, 0xA2, 0x9E, 0x50, 0x73, 0xCC, 0xA7, 0x73, 0x06, 0x60, 0x0B, 0x0D, 
+0xAD, 0x57, 0x98, 0xC6, 0xE8, 0xC2, 0x13, 0x29, 0xFA, 0xF4, 0x11, 0x5F, 0x3B, 0x22, 0xB3, 0x9A, 
+0x43, 0x1A, 0xF8, 0x1C, 0x73, 0x11, 0x8D, 0xD6, 0x68, 0x8D, 0x71, 0xCF, 0x25, 0x14, 0x97, 0xEB, 
+0x2C, 0x61, 0x4A, 0x07, 0xA8, 0x3A, 0xA2, 0x08, 0x60, 0x25, 0x52, 0x5A, 0xBC, 0x06, 0x3A, 0x45, 
+0x92, 0xBE, 0x05, 0xC0, 0x4D, 0xBC, 0x5B, 0x9D, 0x61, 0x9C, 0xF1, 0x8D, 0xA5, 0x8A, 0xC1, 0xC7, 
+0x5F, 0x90, 0xC5, 0x95, 0x48, 0xAB, 0xDF, 0xEC, 0xB2, 0xFC, 0x5D, 0x61, 0x2A, 0x5F, 0x59, 0x84, 
+0x75, 0xF7, 0x56, 0x71, 0x4D, 0x6A, 0x77, 0xC6, 0x37, 0x46, 0xEF, 0x0C, 0xC0, 0x74, 0x0A, 0xA5, 
+0xF3, 0xB5, 0x42, 0x73, 0xDA, 0x60, 0xA8, 0x05, 0x27, 0x53, 0x18, 0x1F, 0x1C, 0xF6, 0x5D, 0x5C, 
+0x51, 0xC2, 0x99, 0xF4, 0x1D, 0xDB, 0xB0, 0x12, 0x97, 0xF7, 0xE9, 0xB4, 0x69, 0x68, 0x88, 0x68, 
+0xC6, 0x02, 0x4D, 0x80, 0x34, 0xDC, 0xE8, 0xA9, 0x99, 0xF5, 0xCE, 0x80, 0xDF, 0x93, 0x0E, 0x5C, 
+0xF5, 0xB4, 0x40, 0xA7, 0xF0, 0x96, 0xA9, 0x65, 0xB8, 0x62, 0x97, 0x3E, 0x35, 0xD1, 0x4F, 0x22, 
+0xF5, 0xA9, 0xAD, 0xD1, 0x01, 0xBB, 0x62, 0xA6, 0x40, 0x0C, 0xA6, 0x26, 0x26, 0x84, 0x01, 0x52, 
+0xE9, 0xC3, 0x2E, 0x20, 0xB0, 0x79, 0xB2, 0xA0, 0x14, 0x59, 0xBF, 0xE2, 0xB8, 0x50, 0xF7, 0x97, 
+0xFC, 0xD2, 0x9C, 0x5A, 0x1B, 0x34, 0x98, 0x71, 0x8B, 0xDF, 0x5F, 0xA7, 0x0A, 0x3F, 0x86, 0x79, 
+0x22, 0x22, 0x8E, 0x2B, 0xE0, 0xBD, 0x3E, 0xAE, 0xB0, 0xAB, 0xF3, 0x80, 0x6E, 0xC0, 0xBD, 0x00, 
+0x0E, 0xEA, 0x80, 0xB3, 0x6E, 0xC0, 0x83, 0x00, 0x1E, 0x59, 0x40, 0x23, 0xB9, 0x8F, 0x32, 0x80, 
+0x45, 0x00, 0xB3, 0x4F, 0x94, 0x49, 0xAC, 0x5B, 0x7F, 0x94, 0xA3, 0x00, 0x16, 0xA3, 0x00, 0x66, 
+0xA3, 0x4F, 0x16, 0xD1, 0x2B, 0x7E, 0xE9, 0x57, 0x92, 0xEB, 0x57, 0xA0, 0xE3, 0x00, 0x16, 0xE3, 
+0x00, 0x66, 0xE3, 0x1A, 0x68, 0x6D, 0x00, 0x6D, 0x1F, 0x49, 0x96, 0xB4, 0x82, 0xF3, 0xE5, 0x08, 
+0xD3, 0x83, 0xE5, 0x18, 0x06, 0x20, 0x47, 0x7D, 0xF8, 0x46, 0x8B, 0xB2, 0xD6, 0x51, 0x07, 0x7A, 
+0x41, 0xD0, 0x0B, 0x84, 0x5E, 0x74, 0x40, 0xCF, 0xEA, 0xD0, 0x33, 0x82, 0x9E, 0x21, 0xF4, 0xAC, 
+0x06, 0x6D, 0xBA, 0xFC, 0x8B, 0x5C, 0xCC, 0xFC, 0xAF, 0xAF, 0xE4, 0x75, 0x00, 0x5F, 0x5F, 0x2D, 
+0xE8, 0xCF, 0xD9, 0x75, 0xFF, 0x97, 0x9A, 0xFA, 0x44, 0x59, 0x1A, 0xD3, 0xC2, 0x86, 0x25, 0xEF, 
+0x75, 0x25, 0x82, 0xCF, 0x15, 0x5B, 0xF4, 0x69, 0x5D, 0x4C, 0x58, 0xAE, 0x7A, 0x94, 0x6F, 0x8C, 
+0x61, 0x7C, 0x36, 0xC0, 0x53, 0x43, 0xDC, 0x59, 0x58, 0x72, 0x16, 0x73, 0x5C, 0xFC, 0x21, 0x30, 
+0x3C, 0x85, 0x2B, 0xF0, 0x5E, 0xCF, 0x07, 0xDF, 0x67, 0x29, 0x1F, 0xBC, 0x65, 0x2A, 0x5A, 0x7A, 
+0xE6, 0xCB, 0x35, 0x4C, 0xE0, 0xEA, 0x1A, 0x25, 0xEE, 0xAA, 0x2C, 0x97, 0x0B, 0xFE, 0x4A, 0x9F, 
+0x40, 0xFA, 0xB1, 0xC9, 0x7F, 0x26, 0xD3, 0xFF, 0x4C, 0x4A, 0xB6, 0x09, 0x45, 0x4E, 0x7F, 0xD3, 
+0xA7, 0xD0, 0x9C, 0x54, 0xF6, 0xEB, 0x07, 0xF7, 0xEE, 0xA7, 0x17, 0x3C, 0xA9, 0x50, 0xD0, 0x87, 
+0x5C, 0xA4, 0x11, 0xA7, 0x64, 0x8B, 0x5A, 0xB1, 0x4B, 0xDF, 0xA6, 0xAC, 0x5B, 0xDA, 0xFD, 0x30, 
+0x42, 0x66, 0x7D, 0x2E, 0x25, 0xCE, 0x59, 0x5A, 0x52, 0x52, 0xA2, 0xF4, 0x05, 0x93, 0xA9, 0xEF, 
+0xBD, 0xB2, 0xA5, 0x33, 0x9C, 0x5A, 0xC1, 0x9C, 0x09, 0x5C, 0xC7, 0x7B, 0x01, 0x50, 0x83, 0x70, 
+0xC5, 0xF3, 0x9C, 0x2D, 0x68, 0x9A, 0x38, 0xE1, 0x8C, 0xCB, 0x5A, 0x98, 0xD0, 0x32, 0x0E, 0x4E, 
+0x60, 0xE8, 0xD4, 0x22, 0x98, 0x42, 0x18, 0x2A, 0x49, 0xF0, 0xC3, 0x30, 0xAC, 0xF5, 0xF3, 0xB8, 
+0x57, 0xAF, 0x5A, 0x79, 0xF8, 0xD0, 0x49, 0xE5, 0x26, 0x21, 0xE5, 0x6C, 0x55, 0x4A, 0xAF, 0x8E, 
+0x31, 0x80, 0x86, 0xC8, 0x9A, 0x24, 0x71, 0xF7, 0xCC, 0x81, 0xE8, 0xA2, 0xD5, 0xAA, 0xC8, 0xA9, 
+0x83, 0x58, 0x6F, 0xEB, 0xA2, 0x39, 0x45, 0x9B, 0xF8, 0x95, 0x6B, 0x38, 0xD1, 0xC7, 0x34, 0x3A, 
+0x5B, 0x4A, 0xA2, 0xD9, 0xB2, 0x43, 0x30, 0xF9, 0x9A, 0x66, 0xF1, 0x30, 0xD8, 0x82, 0x64, 0xD0, 
+0x46, 0xE2, 0x14, 0x96, 0x94, 0x35, 0x3C, 0xDB, 0x38, 0x18, 0xC2, 0xD3, 0xC6, 0xB7, 0x8F, 0xDB, 
+0xE8, 0x8C, 0x3E, 0x85, 0xAA, 0x2C, 0xFF, 0x99, 0x98, 0xD2, 0x1B, 0x97, 0x78, 0x8B, 0x4C, 0xDD, 
+0x1B, 0x3B, 0x43, 0xC5, 0x02, 0x98, 0x59, 0x2D, 0x65, 0x96, 0x02, 0x4A, 0x6D, 0x66, 0x1E, 0x9A, 
+0xD1, 0x8A, 0x79, 0x2A, 0x61, 0xD1, 0x35, 0x0D, 0x71, 0x93, 0xC3, 0x67, 0xB8, 0xEA, 0xAA, 0xF8, 
+0xC2, 0x0F, 0xB3, 0xFA, 0xAB, 0x07, 0x0F, 0x80, 0x7D, 0x64, 0x5B, 0xFA, 0xA1, 0xE1, 0x67, 0xDD, 
+0x5F, 0xEB, 0x2B, 0xE9, 0x98, 0x47, 0x59, 0x5C, 0x76, 0x61, 0x56, 0xCC, 0xE7, 0xDC, 0x71, 0xD0, 
+0x98, 0x64, 0x6B, 0x7C, 0x3F, 0x16, 0x1D, 0xFC, 0x24, 0xF8, 0x85, 0x85, 0xD1, 0xD3, 0x14, 0x01, 
+0xD0, 0xCD, 0xFE, 0x28, 0x52, 0xF5, 0xD8, 0x1F, 0xF6, 0xA9, 0xBF, 0xA3, 0x3E, 0xA8, 0xA5, 0xCC, 
+0x2E, 0xA8, 0xDD, 0x4B, 0x9C, 0x49, 0xBE, 0xF7, 0x63, 0x9A, 0x17, 0x6B, 0x4C, 0x2A, 0xE3, 0x71, 
+0x59, 0xB1, 0x46, 0x05, 0x15, 0x8A, 0xEA, 0x2B, 0x9A, 0x78, 0x4A, 0x8B, 0x18, 0xE3, 0xDC, 0x27, 
+0xC7, 0x54, 0x83, 0x18, 0xF5, 0xE1, 0x01, 0x0C, 0x2F, 0x87, 0x23, 0x4D, 0x71, 0x58, 0x66, 0x3C, 
+0x67, 0x05, 0x6D, 0xF9, 0xBA, 0xD0, 0xA3, 0x43, 0x7F, 0x1C, 0xD8, 0xE5, 0x32, 0x46, 0x0A, 0xD9, 
+0x7C, 0x9E, 0x73, 0x84, 0x1A, 0x8D, 0xAB, 0x76, 0x49, 0xB1, 0xC2, 0x75, 0x87, 0x3F, 0xDB, 0x28, 
+0x9E, 0x07, 0x54, 0x99, 0x51, 0x73, 0x6D, 0xE7, 0x6E, 0xF8, 0xAC, 0xCD, 0x17, 0x11, 0xC3, 0x78, 
+0x28, 0x93, 0xE0, 0x23, 0x62, 0xA1, 0xCB, 0xC1, 0x04, 0x3C, 0xD1, 0x8C, 0x1C, 0x83, 0x78, 0xF8, 
+0xB0, 0x6F, 0x9A, 0x7E, 0x14, 0x9F, 0x28, 0x30, 0x66, 0xB1, 0x6F, 0x18, 0x78, 0x08, 0x02, 0xBE, 
+0x01, 0x22, 0x88, 0x79, 0x8B, 0xE6, 0xE5, 0xD4, 0x74, 0xC2, 0x7C, 0x29, 0xD5, 0x44, 0x63, 0x71, 
+0x9C, 0xDB, 0x3C, 0xC9, 0x18, 0xF6, 0xC2, 0xCF, 0x88, 0x51, 0xC7, 0x6F, 0xD8, 0xDE, 0x7F, 0x87, 
+0x10, 0x7B, 0x63, 0x3F, 0x33, 0xDD, 0x87, 0x6F, 0xA8, 0xD0, 0x03, 0x76, 0xF1, 0xAF, 0x72, 0xB3, 
+0xDC, 0x2A, 0x46, 0xAE, 0x83, 0xA7, 0x62, 0x95, 0xFA, 0xFB, 0x81, 0xC5, 0xEA, 0x0A, 0xD2, 0xC1, 
+0x54, 0x6D, 0xB5, 0x9B, 0xD4, 0x8E, 0xB2, 0x1D, 0x71, 0x55, 0x7E, 0xB6, 0x6B, 0xDD, 0x1B, 0x40, 
+0x72, 0x93, 0xC1, 0xA0, 0x3F, 0x8F, 0x5B, 0x94, 0x5F, 0xD3, 0x08, 0xB6, 0x09, 0xB3, 0xF4, 0xEC, 
+0x33, 0x9A, 0x25, 0x36, 0x01, 0xE1, 0x9E, 0xED, 0x62, 0x5D, 0xF0, 0x5A, 0x5A, 0x32, 0xF2, 0x49, 
+0x13, 0xAD, 0x9E, 0x41, 0xCF, 0x31, 0x54, 0x93, 0xA6, 0xEE, 0xED, 0x1B, 0x54, 0x25, 0xD4, 0xC4, 
+0x11, 0x79, 0xB8, 0x62, 0x6B, 0xDF, 0x2F, 0x9F, 0x03, 0x10, 0xC4, 0x8C, 0x7F, 0xD5, 0x43, 0xC1, 
+0x4E, 0x48, 0xBC, 0x1F, 0xC5, 0xA7, 0xA0, 0x14, 0xE4, 0xA4, 0xFC, 0x45, 0xAF, 0x51, 0x78, 0x13, 
+0xFA, 0x93, 0x1E, 0x51, 0x28, 0x7A, 0x07, 0x9F, 0x1E, 0x13, 0xBD, 0x57, 0x48, 0x7F, 0xE9, 0xEF, 
+0x96, 0x50, 0xEF, 0xBA, 0xDF, 0x47, 0x4D, 0x22, 0x4B, 0xAF, 0xDD, 0xAB, 0xE3, 0x58, 0xA7, 0xCD, 
+0x61, 0x7F, 0x5C, 0xCE, 0x1F, 0xA3, 0x8C, 0x08, 0x4C, 0xD9, 0x94, 0x6E, 0x89, 0x27, 0x45, 0x17, 
+0x5D, 0xD5, 0xAC, 0x6F, 0x32, 0x16, 0x3B, 0xD5, 0xB2, 0x95, 0xF5, 0xA9, 0x3B, 0x6B, 0x1B, 0x24, 
+0xD4, 0x11, 0xD6, 0xDC, 0x87, 0x25, 0x41, 0x0D, 0x7D, 0x6F, 0xD7, 0x7C, 0xF0, 0x02, 0xB8, 0x82, 
+0x76, 0x14, 0x03, 0x65, 0x14, 0x73, 0x05, 0xDE, 0xB3, 0x28, 0xE2, 0x6B, 0xE5, 0x4D, 0xC0, 0x63, 
+0x6B, 0x74, 0x3F, 0xB4, 0x8C, 0xDE, 0xCD, 0x22, 0xC5, 0xD5, 0x40, 0xD7, 0xEC, 0x7A, 0x78, 0x94, 
+0xD5, 0xEF, 0x61, 0x6E, 0x61, 0xEA, 0x4B, 0x9E, 0x57, 0x39, 0x9E, 0x5F, 0x49, 0x9E, 0x87, 0xD9, 
+0x59, 0x87, 0x5D, 0x7B, 0xF5, 0xE1, 0xC3, 0x3B, 0xB2, 0x60, 0x08, 0x81, 0x45, 0x8A, 0x45, 0x5E, 
+0x49, 0x09, 0xDF, 0x31, 0x34, 0x15, 0xDF, 0x92, 0xCD, 0xA4, 0x55, 0xB9, 0xC5, 0xAF, 0xCD, 0xA8, 
+0x26, 0x51, 0x8F, 0x97, 0xBA, 0x2C, 0x72, 0x15, 0x35, 0x94, 0xB2, 0x34, 0x2B, 0xDA, 0x7E, 0x2F, 
+0x9C, 0x8B, 0x14, 0x6B, 0x76, 0x6D, 0x06, 0xE9, 0x96, 0x01, 0x81, 0x6B, 0x77, 0x9D, 0x51, 0x87, 
+0xA9, 0xBB, 0x04, 0xA6, 0xD8, 0x8F, 0x32, 0xF1, 0x9D, 0x10, 0xB1, 0xEE, 0x78, 0xD1, 0xE2, 0x22, 
+0x4A, 0x4C, 0x93, 0xA5, 0x22, 0xEB, 0xA7, 0xA4, 0x36, 0x53, 0x14, 0x43, 0x1D, 0x72, 0x62, 0x00, 
+0xBC, 0x1A, 0x01, 0x1A, 0xBC, 0xE7, 0x54, 0xFF, 0xEC, 0x97, 0x21, 0x9B, 0xEF, 0x99, 0xA2, 0x6B, 
+0x2F, 0xE8, 0x8A, 0x59, 0xAB, 0x72, 0xE9, 0xBE, 0x33, 0x42, 0x54, 0xD9, 0x5D, 0x0D, 0x93, 0x7D, 
+0x63, 0x06, 0x82, 0xFC, 0xE0, 0xDE, 0x70, 0xBF, 0xF4, 0xBB, 0x65, 0xB9, 0x7A, 0x55, 0x79, 0x5D, 
+0x36, 0x31, 0xAA, 0x42, 0x6B, 0x46, 0xEF, 0xE5, 0x07, 0x46, 0xB9, 0xAF, 0xD5, 0x38, 0x6A, 0xA0, 
+0x3F, 0xE6, 0x58, 0x80, 0xE4, 0x8C, 0xA2, 0xA9, 0x13, 0xAF, 0x14, 0x45, 0xBF, 0x70, 0xF6, 0x74, 
+0x1B, 0x15, 0xE7, 0xFA, 0x39, 0x3C, 0xB7, 0xC1, 0x96, 0x5E, 0x7D, 0xD2, 0xBB, 0x9C, 0xCB, 0x73, 
+0x2E, 0xDF, 0xE9, 0xD2, 0x49, 0x5B, 0x2B, 0xAF, 0xAB, 0x33, 0x3B, 0x2A, 0xE8, 0x6F, 0x6A, 0xA4, 
+0xED, 0xFC, 0x50, 0x97, 0x9B, 0xF6, 0xB6, 0xC5, 0xC0, 0x5C, 0x6B, 0x30, 0x29, 0xB2, 0x1E, 0x13, 
+0x53, 0xB2, 0x39, 0x17, 0x8B, 0x32, 0x06, 0xEE, 0xD7, 0xC3, 0x05, 0x9C, 0x3A, 0x1B, 0xA7, 0x20, 
+0xD4, 0x06, 0xF7, 0xED, 0x88, 0xDF, 0x09, 0xE3, 0xEB, 0x32, 0x68, 0xC5, 0x91, 0x5B, 0x60, 0x6A, 
+0x6F, 0x4A, 0x35, 0xB1, 0x6A, 0x83, 0x5C, 0x95, 0x45, 0x91, 0xB1, 0x2D, 0x88, 0x6C, 0xF0, 0x49, 
+0x5A, 0x50, 0x5F, 0x80, 0x54, 0x15, 0x99, 0x76, 0x84, 0xEC, 0x9B, 0x70, 0x5D, 0x90, 0x2B, 0x8B, 
+0xED, 0x6F, 0xE7, 0x13, 0x5A, 0xD4, 0x77, 0xCE, 0x67, 0xFB, 0xEC, 0x80, 0x58, 0x95, 0x33, 0x76, 
+0x94, 0x9E, 0xDC, 0xCF, 0x3C, 0x2A, 0xA4, 0x76, 0x84, 0xB1, 0xFB, 0xEC, 0x80, 0x24, 0xB8, 0xB1, 
+0xC9, 0x64, 0x09, 0x62, 0x9F, 0x1D, 0x10, 0x21, 0x25, 0x96, 0x38, 0x8A, 0x2C, 0x7D, 0x56, 0xA8, 
+0xCC, 0x02, 0xD6, 0xDF, 0x36, 0xD8, 0x76, 0x01, 0xED, 0x73, 0x07, 0x5F, 0x2E, 0x98, 0xFB, 0xAE, 
+0x83, 0x3F, 0x17, 0xD4, 0x7D, 0xB7, 0xAD, 0x4A, 0xB5, 0x0A, 0x96, 0xB1, 0xAA, 0xB5, 0x48, 0xB8, 
+0xD6, 0x1F, 0xD4, 0xD9, 0xD2, 0xE6, 0xB7, 0xCA, 0xE0, 0xFB, 0x40, 0x1B, 0x2E, 0x36, 0x39, 0xBE, 
+0xFD, 0xFD, 0xB8, 0xD7, 0x55, 0x3A, 0xDF, 0xBC, 0xA0, 0xE1, 0xA9, 0x36, 0x54, 0x13, 0x70, 0x2B, 
+0x3A, 0xEB, 0x45, 0xCD, 0x41, 0xC7, 0x0D, 0x15, 0x0D, 0xBE, 0x5B, 0x25, 0xCF, 0xF5, 0xD4, 0x7F, 
+0xFD, 0x29, 0x2B, 0x64, 0xC4, 0xB7, 0x1E, 0xEE, 0x50, 0x8D, 0xB4, 0xA9, 0x8A, 0xC6, 0x5A, 0x68, 
+0x13, 0x56, 0x98, 0x3B, 0x23, 0x74, 0x54, 0xE9, 0xE0, 0xF1, 0x3D, 0x73, 0x9D, 0x04, 0x5A, 0x21, 
+0xFD, 0xAB, 0xA3, 0x36, 0x32, 0x5B, 0xF3, 0xD4, 0x0B, 0xC0, 0x56, 0x0E, 0xB4, 0x6F, 0xA7, 0xD0, 
+0x3E, 0xA2, 0x4B, 0xEE, 0xC7, 0x1D, 0xB5, 0xDD, 0xC8, 0xE3, 0x73, 0xB4, 0x15, 0x50, 0xAC, 0xF1, 
+0xD6, 0x03, 0x96, 0x6E, 0x14, 0xD9, 0x84, 0x95, 0xC8, 0x73, 0xBA, 0xEF, 0x41, 0x24, 0x1C, 0x4F, 
+0x05, 0x23, 0x4B, 0x82, 0x0E, 0xB8, 0xB6, 0xB2, 0x67, 0x6B, 0xF6, 0xC9, 0x42, 0xBB, 0x33, 0xF2, 
+0x1F, 0x4E, 0x7F, 0xF8, 0x5E, 0x9F, 0xD0, 0xFA, 0x9C, 0x16, 0xC7, 0xFD, 0xFE, 0x4D, 0x78, 0xC8, 
+0x83, 0xD4, 0xD0, 0x54, 0x5C, 0xDF, 0x13, 0x95, 0xE4, 0x78, 0x29, 0x43, 0x29, 0xB3, 0x96, 0x0C, 
+0x6E, 0x6A, 0x4B, 0xF6, 0xD0, 0x11, 0x37, 0xD9, 0x93, 0x86, 0xCC, 0x2B, 0xB3, 0xB2, 0xED, 0xAA, 
+0x90, 0xAE, 0x9A, 0xFA, 0xC6, 0xE9, 0x66, 0x0B, 0xE2, 0x0B, 0x26, 0x89, 0x3D, 0x03, 0x60, 0xB1, 
+0xB3, 0x92, 0x35, 0x31, 0xC4, 0x53, 0x78, 0x27, 0xB3, 0x95, 0xC8, 0xB1, 0x04, 0x3B, 0xCF, 0x12, 
+0x2C, 0x22, 0x81, 0x09, 0xDC, 0x67, 0x03, 0xE5, 0x1D, 0xDE, 0xD1, 0x52, 0x2D, 0xE8, 0x8A, 0x94, 
+0x9D, 0x33, 0x91, 0x60, 0x36, 0x44, 0xE7, 0x26, 0x0A, 0xB1, 0x61, 0x3C, 0xA7, 0x33, 0x00, 0x7E, 
+0x19, 0x71, 0x74, 0xBA, 0x7E, 0x7B, 0xEB, 0x4B, 0xFF, 0x4B, 0x3D, 0x3F, 0xEA, 0xF7, 0xF7, 0x99, 
+0x56, 0x69, 0xB3, 0x41, 0x0E, 0x3A, 0xE0, 0xA5, 0x93, 0x08, 0xBC, 0xB4, 0xA0, 0xE7, 0x5C, 0x31, 
+0xF3, 0x85, 0xA1, 0x81, 0x5E, 0x31, 0x9C, 0x38, 0xDB, 0x56, 0xFD, 0x6E, 0xF7, 0xB9, 0x6D, 0x82, 
+0x76, 0xB8, 0xEE, 0xAA, 0xD2, 0xBF, 0xDB, 0x79, 0x53, 0xBA, 0x4F, 0xE9, 0xBA, 0x8F, 0x7B, 0xCD, 
+0x0B, 0x73, 0xB6, 0x52, 0xEA, 0xA8, 0xD8, 0xB1, 0x7E, 0xD5, 0x1C, 0xD4, 0x98, 0x1B, 0x7F, 0x74, 
+0xE0, 0x7F, 0xDB, 0x99, 0x36, 0x6E, 0x62, 0x98, 0xEF, 0x5D, 0xE9, 0x4D, 0xDD, 0xD7, 0x36, 0x34, 
+0x2F, 0x47, 0x48, 0x33, 0x65, 0x2F, 0x48, 0x88, 0xF9, 0x9C, 0x4B, 0xBC, 0xE0, 0x06, 0x7E, 0x7C, 
+0x6D, 0xD8, 0x33, 0x17, 0x23, 0x54, 0xB7, 0x8E, 0xD8, 0x2B, 0x3D, 0x4E, 0xD1, 0x5A, 0x17, 0xA5, 
+0xAB, 0x46, 0xDE, 0xDF, 0x72, 0x96, 0x17, 0x92, 0xCE, 0xB8, 0x70, 0x66, 0xE8, 0x8D, 0x96, 0xDA, 
+0xCD, 0x1B, 0x17, 0xAC, 0x6C, 0xF7, 0xE0, 0x01, 0x7C, 0x55, 0x62, 0x69, 0xF1, 0xF6, 0xB7, 0xFF, 
+0xF8, 0x57, 0xF8, 0x4E, 0x48, 0xBC, 0xEF, 0xA8, 0x42, 0x8A, 0x37, 0xC5, 0x70, 0x71, 0xCE, 0x63, 
+0xDC, 0x37, 0x98, 0x4B, 0x9E, 0x2F, 0x35, 0xAB, 0x86, 0xC7, 0x8E, 0xEB, 0x6B, 0x76, 0x77, 0xE1, 
+0x3D, 0x9F, 0x15, 0x22, 0x89, 0xDD, 0x4B, 0x6B, 0xE8, 0xF2, 0x07, 0xC9, 0x59, 0xE2, 0xAC, 0x10, 
+0xF1, 0xA2, 0x8C, 0x16, 0x8F, 0xD3, 0xAA, 0x9F, 0x76, 0x8A, 0x6B, 0xA9, 0xBC, 0xA5, 0x23, 0x4D, 
+0xDC, 0x14, 0x10, 0x71, 0x79, 0x30, 0xE4, 0xEC, 0x62, 0x60, 0xBE, 0xC3, 0xD6, 0xFC, 0x3A, 0x11, 
+0x97, 0x06, 0xA3, 0x48, 0x85, 0x7A, 0x89, 0xB0, 0x3C, 0x09, 0x53, 0x7E, 0x69, 0xC1, 0x4E, 0xC5, 
+0x0C, 0x3D, 0x58, 0xB9, 0xBA, 0x67, 0xF9, 0x8F, 0xA9, 0x40, 0xBF, 0x6B, 0xE0, 0x1F, 0x3C, 0x30, 
+0xBF, 0x3A, 0xEB, 0xEF, 0xF5, 0x79, 0xEB, 0x00, 0x21, 0x6C, 0xD1, 0x56, 0x4D, 0xD0, 0xEE, 0xB1, 
+0x99, 0xF7, 0x24, 0x5F, 0xB3, 0x14, 0x08, 0xCD, 0x74, 0x47, 0xCF, 0xEA, 0x41, 0x79, 0x31, 0x87, 
+0x48, 0x17, 0x3B, 0x27, 0xAF, 0x53, 0x11, 0x09, 0xBC, 0xE7, 0x22, 0x0C, 0xC3, 0x27, 0xBB, 0x08, 
+0x7E, 0x62, 0xD1, 0x1A, 0xC6, 0xFA, 0xD5, 0x69, 0x99, 0x66, 0x2B, 0x00, 0xCF, 0x24, 0xB5, 0xB8, 
+0xC5, 0xE0, 0xCE, 0xDE, 0xAB, 0x39, 0x3A, 0x99, 0x4E, 0x61, 0x70, 0x74, 0x74, 0x84, 0x6A, 0x5C, 
+0x7F, 0x13, 0x0E, 0x6F, 0x66, 0x94, 0x26, 0xDE, 0xE0, 0x22, 0x93, 0xF1, 0xCE, 0xC9, 0xCB, 0xF7, 
+0xEF, 0x7F, 0x78, 0xFF, 0x6B, 0x30, 0x46, 0x04, 0xCB, 0xC3, 0x4A, 0x62, 0xA8, 0xBC, 0x72, 0x44, 
+0xC4, 0x4E, 0x0A, 0x07, 0x3C, 0x85, 0x11, 0x4C, 0x80, 0xB6, 0xCF, 0x48, 0xBA, 0x71, 0x23, 0xBF, 
+0xA3, 0x76, 0x78, 0xE8, 0xD1, 0x59, 0x93, 0x4D, 0xD4, 0xE9, 0x38, 0xC6, 0x1B, 0x1D, 0x04, 0xB0, 
+0x77, 0x10, 0x54, 0xC9, 0x09, 0xF8, 0x93, 0xCF, 0xF7, 0xF7, 0xF7, 0xF7, 0x77, 0x1A, 0x7B, 0xE2, 
+0x96, 0x52, 0x2D, 0xF9, 0xE2, 0x7E, 0xD4, 0x30, 0x31, 0xF2, 0x68, 0x88, 0x24, 0x74, 0x26, 0x13, 
+0x51, 0xD3, 0x79, 0x81, 0xDB, 0xA8, 0x95, 0x59, 0x11, 0xF7, 0xA3, 0x34, 0xA4, 0xFB, 0x4E, 0x10, 
+0x7D, 0x7C, 0xF4, 0xE8, 0xD1, 0x50, 0xF7, 0xCB, 0x24, 0x2E, 0x6C, 0xA1, 0x54, 0x25, 0x2E, 0x7C, 
+0x2E, 0xA9, 0x11, 0xDF, 0x63, 0x8F, 0x19, 0x91, 0x9A, 0xB3, 0x28, 0x1A, 0x1D, 0xB8, 0xA4, 0xB6, 
+0xA1, 0xDD, 0xD9, 0x29, 0x4F, 0xBF, 0xEF, 0xA6, 0x39, 0xBA, 0xC6, 0xF5, 0xDA, 0x86, 0xE2, 0xDA, 
+0x1C, 0xF8, 0x9E, 0xC9, 0x58, 0xD2, 0x8B, 0x00, 0x4E, 0x7B, 0xC0, 0x75, 0x00, 0x27, 0x87, 0x49, 
+0x6F, 0x7E, 0x9B, 0xE7, 0x16, 0x20, 0x89, 0xDC, 0x00, 0xE1, 0xEF, 0xB7, 0x99, 0xC8, 0x55, 0x21, 
+0x79, 0x0B, 0x50, 0x4B, 0xCC, 0x40, 0xD2, 0x43, 0x6D, 0xEB, 0xEE, 0x65, 0x72, 0x5B, 0xA2, 0x6F, 
+0x3D, 0x9D, 0xF7, 0x47, 0x6B, 0x90, 0x74, 0xE3, 0x1B, 0x8C, 0x12, 0x02, 0xFC, 0xCC, 0x64, 0x7A, 
+0x1B, 0xFE, 0x01, 0x86, 0x30, 0xA6, 0xC6, 0xB5, 0x6A, 0xF9, 0x93, 0xC8, 0x0B, 0x96, 0xFC, 0x2C, 
+0xB1, 0xB6, 0x5C, 0xDE, 0x58, 0x80, 0x8A, 0x28, 0xCE, 0x09, 0x7A, 0x70, 0xA1, 0xC1, 0x2B, 0x4C, 
+0x17, 0x4C, 0x71, 0xF9, 0x86, 0x9F, 0xDF, 0x68, 0x6E, 0x3D, 0x82, 0x1A, 0x24, 0x08, 0x76, 0xA3, 
+0x3D, 0xD4, 0x5D, 0xFE, 0x52, 0x9B, 0x58, 0x49, 0xD1, 0xD1, 0xA1, 0xEA, 0x65, 0xB7, 0x05, 0x2A, 
+0x01, 0xAB, 0x1E, 0x05, 0xE0, 0x2D, 0xB9, 0x19, 0x5C, 0x6F, 0xF8, 0x7B, 0x5B, 0x19, 0x8D, 0xE6, 
+0xC9, 0x8A, 0x3E, 0x80, 0x9D, 0x92, 0x11, 0xC8, 0x31, 0x80, 0x5E, 0xD9, 0x8B, 0x8C, 0x6A, 0x94, 
+0x35, 0x6C, 0xA5, 0xED, 0xE7, 0x4C, 0xFA, 0x83, 0x01, 0xA6, 0x53, 0x0C, 0x72, 0x8E, 0x91, 0x20, 
+0x93, 0x9B, 0x7E, 0xAB, 0x55, 0x6D, 0x88, 0xB0, 0xC4, 0xBD, 0xCA, 0x79, 0x2D, 0xA7, 0x4C, 0xE3, 
+0xB4, 0x0E, 0x9B, 0x99, 0xE1, 0x30, 0x86, 0xFC, 0x76, 0xF9, 0xDE, 0x66, 0xCA, 0x1D, 0xAD, 0x7C, 
+0xF0, 0xC0, 0xD1, 0xD1, 0xDB, 0x5D, 0x5F, 0xCD, 0x8C, 0xDC, 0x36, 0x02, 0xD7, 0x9F, 0x3F, 0x06, 
+0x7F, 0xFB, 0xF7, 0xFF, 0xFC, 0xDF, 0xFF, 0xF9, 0x37, 0xBD, 0x53, 0x09, 0x3A, 0xE2, 0xBB, 0xAF, 
+0x30, 0x4B, 0x73, 0xDF, 0xE1, 0x8C, 0xAC, 0xD8, 0xEA, 0x12, 0x2E, 0x3D, 0x13, 0x79, 0xA1, 0x1A, 
+0xAD, 0x97, 0x2D, 0xD3, 0xF6, 0x1B, 0xC8, 0xF1, 0x4E, 0x32, 0x6C, 0x28, 0x09, 0x25, 0xC2, 0xBA, 
+0x3B, 0x58, 0x76, 0xBF, 0xA7, 0x45, 0xF1, 0x36, 0xF1, 0x59, 0xAF, 0xD2, 0x39, 0x3E, 0x6F, 0x12, 
+0x9E, 0x9A, 0xB9, 0x7A, 0xEB, 0xD4, 0x70, 0x30, 0x6D, 0x57, 0xEE, 0x93, 0x29, 0x1C, 0x1D, 0xDC, 
+0x97, 0xC7, 0x1B, 0x98, 0xCB, 0x6E, 0x67, 0xEB, 0x70, 0xF6, 0x68, 0xFC, 0x78, 0x78, 0x33, 0x5B, 
+0x4F, 0x60, 0x3C, 0xBC, 0xB7, 0xE4, 0x2A, 0xC5, 0xDB, 0xAE, 0xD9, 0x94, 0x0B, 0x0E, 0xCF, 0xE5, 
+0x5F, 0xFF, 0x5B, 0x89, 0xE8, 0x0E, 0xCC, 0x76, 0x2B, 0xF3, 0x97, 0x4A, 0x6A, 0xC7, 0xDC, 0x9C, 
+0x56, 0x5E, 0x3D, 0xA7, 0x8A, 0xFC, 0x45, 0xA6, 0x6E, 0xB2, 0xFC, 0xC6, 0x76, 0xC7, 0x99, 0x72, 
+0xEE, 0xF4, 0xA2, 0x77, 0x26, 0xA5, 0xEC, 0xB6, 0x96, 0x68, 0x23, 0x6B, 0x1A, 0xEA, 0xAC, 0x7B, 
+0xEB, 0xB2, 0x2E, 0xF9, 0xA9, 0x5D, 0x06, 0xE2, 0x68, 0xE8, 0xE1, 0xE1, 0xC1, 0x5E, 0x4D, 0xCE, 
+0x15, 0x23, 0x01, 0xEC, 0x3C, 0xCF, 0x70, 0xFF, 0x82, 0xC5, 0x59, 0xD7, 0x10, 0x3B, 0x44, 0x47, 
+0xF7, 0x22, 0x1A, 0xB1, 0xC7, 0x6C, 0xB8, 0x9D, 0xE8, 0xB3, 0x84, 0x4B, 0xC5, 0x6E, 0xA1, 0xB8, 
+0x77, 0x2F, 0x8A, 0x6D, 0x75, 0xAA, 0x51, 0x6C, 0xDA, 0xC8, 0xB6, 0x7E, 0x7C, 0x21, 0x81, 0x67, 
+0x09, 0x93, 0x2B, 0xE6, 0x84, 0x73, 0xF5, 0x9B, 0x4B, 0x69, 0xC3, 0xDB, 0x59, 0x26, 0xF6, 0xCB, 
+0xCD, 0x52, 0x5A, 0x0C, 0x9F, 0x6E, 0xD2, 0xC8, 0xCD, 0xE9, 0x7C, 0xFE, 0xEA, 0xD9, 0xFB, 0x0F, 
+0xFF, 0xF2, 0xDD, 0xEB, 0x97, 0x6F, 0x5E, 0x9C, 0xE2, 0x1D, 0xB1, 0x36, 0xC0, 0x73, 0xE3, 0x38, 
+0x1B, 0xAA, 0x99, 0x48, 0xEC, 0x13, 0x2D, 0x3A, 0x5F, 0xE8, 0x5C, 0x5B, 0x20, 0xC5, 0x6E, 0xEF, 
+0xCC, 0x3A, 0xC4, 0x6C, 0x66, 0x5C, 0x79, 0xD5, 0x69, 0x23, 0x4F, 0xDD, 0x5E, 0x7F, 0xDA, 0x79, 
+0xBD, 0x69, 0x79, 0x99, 0x49, 0xE3, 0xA6, 0xD4, 0x1E, 0xEE, 0xBE, 0xE9, 0xE5, 0x7D, 0xC7, 0xBE, 
+0x83, 0x16, 0x00, 0x06, 0xCE, 0x7E, 0x99, 0xD2, 0xE8, 0x1E, 0x7E, 0xD7, 0x73, 0xF7, 0xDA, 0x8B, 
+0xB3, 0x6A, 0xB7, 0xB7, 0x4C, 0x64, 0xAC, 0xAE, 0x6E, 0xC3, 0xE9, 0x4D, 0xA8, 0xF5, 0xAD, 0xAE, 
+0x0E, 0x6E, 0x87, 0xAC, 0xFE, 0x46, 0xA6, 0xAB, 0x71, 0x4E, 0xF1, 0x14, 0xDC, 0x6F, 0x13, 0xF7, 
+0x89, 0x8C, 0x5C, 0xBD, 0x27, 0x76, 0x9F, 0x8D, 0xCA, 0xB2, 0x9C, 0x4B, 0x1B, 0xF2, 0x0D, 0xC6, 
+0x42, 0xDF, 0x67, 0x98, 0x54, 0x51, 0x6E, 0xAA, 0x3C, 0x85, 0x6A, 0x8B, 0xBD, 0x63, 0xB3, 0x62, 
+0x52, 0x65, 0x37, 0x88, 0xFC, 0xE5, 0x3A, 0x8B, 0xF0, 0xC2, 0xD2, 0x0A, 0xD1, 0x09, 0x1D, 0xF5, 
+0x98, 0x7F, 0x8E, 0x5B, 0xC7, 0x7B, 0x3A, 0xDD, 0x85, 0x4E, 0x99, 0x6D, 0xC7, 0x9D, 0x4D, 0x33, 
+0xDD, 0x87, 0x5A, 0xDE, 0x88, 0x93, 0x1B, 0x69, 0x70, 0xED, 0x3C, 0xDD, 0xB1, 0xC1, 0x29, 0x91, 
+0x77, 0x44, 0x67, 0x12, 0x43, 0x78, 0x0B, 0x15, 0xDE, 0x89, 0x49, 0x37, 0x16, 0x73, 0xEC, 0xC3, 
+0xA9, 0xC2, 0xBD, 0x1B, 0xDF, 0xE3, 0xF9, 0xE0, 0xE5, 0x29, 0x9D, 0xD5, 0x2E, 0xB3, 0x02, 0x8B, 
+0x56, 0xC6, 0x83, 0x58, 0x2C, 0x04, 0x7A, 0xE0, 0x95, 0x48, 0x0B, 0xC5, 0x9D, 0x57, 0xE6, 0xB8, 
+0xD2, 0xDC, 0x2D, 0x4D, 0x5F, 0xF3, 0x67, 0x8B, 0xAC, 0x9E, 0x20, 0xE7, 0x57, 0x72, 0x18, 0x40, 
+0x8B, 0x07, 0xD8, 0x85, 0x43, 0x94, 0x4A, 0xB5, 0x5B, 0xE7, 0xE2, 0xA1, 0x64, 0x9B, 0xA7, 0xB0, 
+0xF3, 0x6C, 0x99, 0x49, 0xB6, 0x03, 0x13, 0xF8, 0x65, 0xF0, 0xF5, 0x55, 0x05, 0x70, 0xBD, 0xFA, 
+0xA5, 0xA5, 0xA0, 0xAE, 0xF6, 0x76, 0xDD, 0xFE, 0xF3, 0x25, 0xBB, 0x60, 0x08, 0x5C, 0xDF, 0x28, 
+0x9A, 0x36, 0x53, 0xB3, 0x6A, 0xA7, 0x8A, 0x4E, 0xB2, 0x4B, 0x67, 0x6E, 0x93, 0xB9, 0x7C, 0x5B, 
+0xE9, 0x7A, 0xC2, 0xC1, 0xE8, 0xB8, 0x9A, 0xCE, 0x96, 0xC2, 0xC9, 0xB4, 0x79, 0x3D, 0xB3, 0xCE, 
+0x1C, 0x2E, 0x6F, 0x49, 0xB6, 0x07, 0xBD, 0x74, 0xFA, 0xE6, 0x26, 0xB9, 0x68, 0xCA, 0x03, 0x18, 
+0x61, 0xB2, 0xCB, 0x89, 0x4E, 0x7A, 0x19, 0x0C, 0xAC, 0x4C, 0x1A, 0xA9, 0x57, 0xA2, 0x99, 0x9A, 
+0xE4, 0x90, 0x20, 0x1B, 0x6E, 0x78, 0x14, 0xF0, 0x10, 0x46, 0xC7, 0xBD, 0x99, 0xE4, 0xEC, 0x4C, 
+0x7B, 0x54, 0xDA, 0xF4, 0xA6, 0xAF, 0x27, 0xE0, 0x14, 0x0C, 0xE8, 0x6A, 0xC7, 0x32, 0xA9, 0xCA, 
+0xED, 0xA3, 0xDB, 0xE6, 0x89, 0xF6, 0x84, 0xAE, 0xAD, 0x2C, 0xCB, 0x69, 0xFC, 0xB9, 0xE0, 0x49, 
+0x6C, 0xD3, 0x2D, 0xBA, 0xCB, 0x11, 0xC4, 0xA7, 0xD0, 0x64, 0x7D, 0x74, 0xCC, 0x26, 0x73, 0x37, 
+0xF4, 0xF4, 0xA4, 0x6D, 0x3E, 0x3E, 0x12, 0xEE, 0x4F, 0x7D, 0x63, 0xE0, 0xDA, 0x43, 0xDF, 0x2E, 
+0xB0, 0xD9, 0x4E, 0xA7, 0xB4, 0x5B, 0xB5, 0x6B, 0x79, 0xDD, 0xB1, 0xA0, 0xCE, 0xB6, 0x93, 0x8E, 
+0xCA, 0x94, 0x5C, 0xC3, 0x28, 0xB4, 0x46, 0xC5, 0x96, 0x0C, 0xE8, 0x6B, 0xD4, 0x7C, 0xCF, 0x0B, 
+0x6A, 0x7E, 0x85, 0xC8, 0x53, 0x57, 0x6E, 0xEE, 0x65, 0x00, 0x36, 0x0F, 0xAA, 0xA3, 0xA7, 0x0E, 
+0xEE, 0x8F, 0x2D, 0x13, 0xFC, 0xA9, 0x6A, 0x5A, 0xC5, 0x4F, 0x7A, 0x70, 0x9D, 0xB3, 0x0A, 0x63, 
+0x43, 0x6B, 0xE5, 0x51, 0x25, 0x90, 0xFE, 0xB1, 0x5D, 0xC8, 0x0D, 0x40, 0x93, 0x3D, 0xDC, 0xDE, 
+0x93, 0x6D, 0xE6, 0x40, 0xD6, 0xEF, 0x0A, 0xD7, 0xEA, 0xDE, 0x99, 0x57, 0x58, 0xCE, 0x84, 0xCE, 
+0x3C, 0x42, 0x9E, 0x70, 0x65, 0x76, 0x77, 0xBB, 0x4A, 0x38, 0x5A, 0x45, 0x1B, 0xE8, 0xA2, 0x7F, 
+0xC0, 0x9B, 0x92, 0xD1, 0xB0, 0xAE, 0xF5, 0x4D, 0xFA, 0xF6, 0x9E, 0x2C, 0xCC, 0xE1, 0xC6, 0xBD, 
+0x62, 0x2C, 0xB4, 0x83, 0x3C, 0x11, 0x31, 0xA7, 0x8B, 0x46, 0x2D, 0x91, 0x0E, 0x09, 0x74, 0x52, 
+0xEC, 0x80, 0x73, 0x6B, 0x46, 0xDC, 0x3A, 0x83, 0xEA, 0x4A, 0xE8, 0xE6, 0x2E, 0x38, 0x7E, 0xA1, 
+0xDA, 0x3F, 0xA0, 0xCA, 0x19, 0xBC, 0xFB, 0x77, 0xC7, 0x49, 0xD9, 0x5B, 0x65, 0x2F, 0x6C, 0xBA, 
+0x94, 0x4E, 0x63, 0x1A, 0xEF, 0x63, 0xB5, 0x70, 0x95, 0xC3, 0x74, 0x78, 0x10, 0xF4, 0xDC, 0xDD, 
+0xA3, 0x09, 0xEC, 0x1F, 0x04, 0x3D, 0x93, 0xAE, 0xF4, 0xE8, 0x71, 0xD0, 0x2B, 0xFD, 0xEA, 0x04, 
+0x1E, 0x1D, 0xE8, 0x47, 0x5C, 0x7F, 0x95, 0x15, 0x94, 0x3A, 0xB6, 0xC2, 0xA2, 0xF8, 0x5E, 0x87, 
+0xCF, 0x9C, 0x90, 0x53, 0xD2, 0xF7, 0x34, 0x3B, 0x69, 0x57, 0x58, 0x06, 0x5D, 0xCB, 0xD4, 0xAA, 
+0xFD, 0x2F, 0x0B, 0xE8, 0xFE, 0x69, 0x77, 0x62, 0x8D, 0xF7, 0x5A, 0xD6, 0xCD, 0x76, 0x2D, 0x74, 
+0x2F, 0x1D, 0xC7, 0x64, 0x2D, 0x3B, 0xF4, 0x2E, 0x65, 0x18, 0x80, 0x2F, 0x28, 0x15, 0x03, 0xBE, 
+0x81, 0xC3, 0xA1, 0x49, 0xCA, 0xE8, 0x07, 0x56, 0x26, 0x63, 0x78, 0x68, 0x7C, 0x19, 0x2E, 0x02, 
+0xF1, 0x54, 0xF9, 0x1B, 0xA8, 0x4B, 0x69, 0xD8, 0x01, 0x31, 0x32, 0xA2, 0x9B, 0xC0, 0x7E, 0xD7, 
+0x67, 0x2C, 0x80, 0xD6, 0x59, 0x60, 0x8F, 0xBA, 0x5B, 0x1B, 0x9F, 0xD6, 0x48, 0x39, 0xD2, 0xDD, 
+0x72, 0x2F, 0x9A, 0x76, 0xDE, 0xE5, 0x94, 0x15, 0x47, 0x07, 0xE3, 0x65, 0x60, 0x57, 0x4A, 0xC2, 
+0x24, 0x00, 0x76, 0xF7, 0xE6, 0xD8, 0x91, 0x58, 0x95, 0x09, 0xB8, 0xA5, 0x5F, 0x0E, 0xB0, 0xAB, 
+0x1B, 0x30, 0xDD, 0xD6, 0x53, 0xA7, 0x81, 0x4D, 0xEB, 0x7B, 0x74, 0x2B, 0xA4, 0xB3, 0x15, 0x54, 
+0x15, 0x48, 0x8C, 0x87, 0x4E, 0x7D, 0xC4, 0xD1, 0x41, 0x00, 0x1D, 0xE0, 0x0F, 0xC1, 0xAF, 0x23, 
+0x1E, 0xD0, 0x5D, 0x43, 0xD8, 0x4D, 0x34, 0xF5, 0xDB, 0x09, 0xE8, 0x50, 0xA5, 0xFD, 0xDD, 0x6D, 
+0x54, 0x25, 0x1B, 0x7F, 0xDC, 0xA2, 0x4D, 0x56, 0x6D, 0x6A, 0x82, 0x77, 0xB5, 0xA5, 0x25, 0x69, 
+0xAB, 0x27, 0x9D, 0x52, 0xB5, 0x5A, 0xD2, 0x66, 0xAB, 0x77, 0xFD, 0xA9, 0xCD, 0xD8, 0x0B, 0x93, 
+0x86, 0xAB, 0x13, 0x0A, 0xB6, 0x28, 0x0F, 0x5A, 0xAF, 0x7F, 0xE4, 0x7C, 0x9D, 0x57, 0xFF, 0x2B, 
+0x87, 0xFA, 0x0C, 0xEB, 0x52, 0xAE, 0xEB, 0x80, 0xFE, 0x67, 0x20, 0xF8, 0xEB, 0xFF, 0x00, 0xB1, 
+0x69, 0x51, 0x21, 0x80, 0x64, 0x00, 0x00, 0x00
+};
+
+const char view_js_br[] PROGMEM = {
+0x1B, 0x7F, 0x64, 0x20, 0xBC, 0x0C, 0x70, 0x72, 0x4D, 0x75, 0x20, 0x07, 0x1D, 0x99, 0xDB, 0xA3, 
+0xA3, 0xA2, 0xA8, 0x9A, 0xF2, 0xC2, 0x9A, 0x71, 0xF0, 0xBA, 0xA8, 0x8D, 0xFD, 0x43, 0xAB, 0x19, 
+0x21, 0xC9, 0x6C, 0xB1, 0xBD, 0xDF, 0x2F, 0xF7, 0x79, 0xCF, 0xE5, 0x34, 0x55, 0xE0, 0x2D, 0x50, 
+0x71, 0x56, 0x4C, 0x2A, 0xBF, 0x46, 0x02, 0x61, 0x69, 0x09, 0xC9, 0x1B, 0x26, 0x5F, 0x2A, 0x1E, 
+0x63, 0xE3, 0x2F, 0xDB, 0x97, 0x41, 0xDF, 0xB7, 0x6F, 0xD3, 0xF7, 0xFE, 0x2F, 0xA7, 0x40, 0x87, 
+0x9C, 0xF0, 0xFC, 0x90, 0x64, 0xC8, 0x70, 0x23, 0xE8, 0xB8, 0x8E, 0x7D, 0xFA, 0x93, 0x99, 0xBA, 
+0xDD, 0x40, 0xBA, 0x5C, 0x45, 0x1F, 0xCF, 0xB7, 0x5F, 0xBF, 0x3E, 0x25, 0x9D, 0xA0, 0x2C, 0x03, 
+0xD7, 0x5F, 0x94, 0xF1, 0x6D, 0xB7, 0x84, 0x05, 0x43, 0xB1, 0x98, 0xDD, 0x9C, 0x1A, 0x2F, 0x41, 
+0x6A, 0xB7, 0xEF, 0x54, 0x47, 0x92, 0x2D, 0xC5, 0xEE, 0xCF, 0x0D, 0x1F, 0x2E, 0xE7, 0xC7, 0x98, 
+0x9C, 0x15, 0xB1, 0x96, 0x02, 0x48, 0x88, 0xA8, 0xB6, 0x98, 0x93, 0x98, 0x37, 0xDB, 0x07, 0x81, 
+0x78, 0xA3, 0xD0, 0x24, 0x94, 0xA4, 0x3C, 0x55, 0x25, 0xB9, 0x8D, 0x70, 0xE2, 0xFC, 0xFE, 0xFD, 
+0x59, 0xE6, 0x50, 0xE3, 0x05, 0xA4, 0x08, 0x30, 0xDB, 0x70, 0x6C, 0x4E, 0xD2, 0x25, 0xCA, 0xFD, 
+0xEB, 0x16, 0x9C, 0xFE, 0x92, 0x5A, 0xC7, 0x5F, 0x9A, 0x99, 0x63, 0xC9, 0x32, 0x34, 0x98, 0xDA, 
+0x4B, 0x6D, 0xA2, 0x57, 0xF5, 0x9E, 0xBE, 0xD4, 0x9A, 0xE9, 0x01, 0x2D, 0x12, 0xA4, 0x11, 0xE7, 
+0x1B, 0x06, 0x80, 0x51, 0xBA, 0xCE, 0x0D, 0x59, 0x4C, 0x28, 0x28, 0xA9, 0x3F, 0x99, 0xE7, 0xDB, 
+0x30, 0xAD, 0x71, 0x9A, 0xF4, 0xC9, 0xD3, 0xEE, 0xEE, 0xC5, 0x06, 0x21, 0x84, 0x10, 0x8F, 0x85, 
+0xEC, 0xF8, 0xBA, 0x89, 0x04, 0xE9, 0xDA, 0x2C, 0xD7, 0x44, 0xCC, 0x58, 0x5F, 0x23, 0x4D, 0x9E, 
+0x16, 0xB6, 0x17, 0x11, 0x42, 0xD4, 0x69, 0xD0, 0x08, 0x0E, 0x39, 0xBC, 0x5C, 0x06, 0xCD, 0x37, 
+0xE0, 0x2B, 0xE6, 0xEF, 0xAC, 0x80, 0xB0, 0x25, 0x38, 0xFA, 0xC0, 0x88, 0x85, 0xA6, 0xC7, 0x0F, 
+0xED, 0xE2, 0x19, 0x8B, 0xB2, 0x40, 0x99, 0xAE, 0xF2, 0x5B, 0x67, 0xD9, 0x76, 0xF9, 0x86, 0x8E, 
+0x9F, 0x14, 0x61, 0xB5, 0xE5, 0xB3, 0x83, 0xB4, 0x00, 0x34, 0x42, 0xF5, 0x8A, 0x5D, 0x2A, 0x21, 
+0x70, 0x02, 0x81, 0x0E, 0x8D, 0x28, 0x8E, 0x24, 0x33, 0xEB, 0x5C, 0xB2, 0x29, 0xB5, 0x70, 0x61, 
+0x70, 0x42, 0x76, 0x07, 0x28, 0xAA, 0x23, 0xF6, 0x72, 0xB7, 0x35, 0x18, 0x7B, 0xE8, 0x9F, 0x41, 
+0x30, 0xA5, 0xAC, 0xF7, 0x4A, 0xD3, 0x88, 0xBE, 0x7A, 0xF9, 0xF2, 0x1E, 0x1C, 0xC2, 0xF9, 0xF1, 
+0x79, 0x58, 0x5E, 0x0D, 0x37, 0x8E, 0x39, 0xAC, 0x13, 0xDA, 0x28, 0xF0, 0x03, 0xE9, 0x93, 0x62, 
+0xE3, 0x22, 0x84, 0x25, 0x92, 0x58, 0xD2, 0xEE, 0xA9, 0xA5, 0x8A, 0x42, 0x21, 0xA0, 0x23, 0x27, 
+0xAD, 0xC2, 0x30, 0xA3, 0xA8, 0x27, 0x5A, 0x2F, 0xE6, 0xA0, 0x40, 0x77, 0x72, 0x0F, 0xC6, 0xD3, 
+0x14, 0x01, 0xE9, 0x43, 0x7E, 0x09, 0xFF, 0x99, 0x41, 0xA8, 0x0E, 0x29, 0xB5, 0x0D, 0x07, 0x2B, 
+0xA1, 0x18, 0xA5, 0x1A, 0x9D, 0x76, 0x3F, 0x1D, 0xBB, 0xC1, 0x3B, 0xE0, 0x67, 0xE2, 0xF8, 0x10, 
+0x6F, 0xC9, 0x00, 0x0E, 0x0C, 0x14, 0x10, 0xCF, 0xBF, 0x49, 0x0A, 0x3F, 0x97, 0x76, 0x54, 0x60, 
+0xC9, 0x8E, 0x69, 0x1B, 0x5F, 0x26, 0xDF, 0x8D, 0x7D, 0x80, 0xC9, 0x5C, 0xF0, 0x09, 0xE7, 0xB6, 
+0x7E, 0x9C, 0x18, 0x3C, 0x01, 0x14, 0x11, 0x66, 0xBF, 0xAB, 0x0F, 0x0F, 0x3B, 0x01, 0x06, 0x91, 
+0xA6, 0x71, 0x12, 0x94, 0x7A, 0xAF, 0x73, 0x29, 0xBB, 0xB9, 0x21, 0xCC, 0x33, 0x37, 0x60, 0xF2, 
+0xDE, 0xE6, 0x66, 0xBE, 0xE9, 0x24, 0x1B, 0x7B, 0x7D, 0x57, 0xC1, 0x89, 0x0C, 0x22, 0x75, 0x3A, 
+0x63, 0x08, 0xC9, 0xBD, 0x2C, 0x00, 0xBD, 0x80, 0xEE, 0xC7, 0x5C, 0xB7, 0x11, 0xCA, 0xE6, 0x28, 
+0x8B, 0xB6, 0x28, 0x36, 0x96, 0x23, 0x91, 0x82, 0xF2, 0x4B, 0xC6, 0x37, 0x0E, 0xA4, 0xC3, 0x94, 
+0xB7, 0x0C, 0x9C, 0x52, 0x19, 0x48, 0x32, 0x73, 0xE9, 0x03, 0x10, 0xAB, 0xFF, 0xFF, 0xA1, 0x5E, 
+0x93, 0xAC, 0x05, 0xE4, 0x48, 0xCD, 0x42, 0xCE, 0x0A, 0xAC, 0xAA, 0x66, 0xAB, 0x82, 0x39, 0x52, 
+0x95, 0x8A, 0x39, 0x15, 0xFA, 0x92, 0x8A, 0x38, 0xE4, 0x78, 0xA8, 0x23, 0xF2, 0x7F, 0x64, 0x21, 
+0x0D, 0x44, 0xA4, 0x43, 0x25, 0x89, 0x6B, 0xE0, 0xD9, 0x43, 0xB9, 0x3B, 0x71, 0x87, 0x0C, 0x47, 
+0x68, 0x69, 0x80, 0x54, 0xF6, 0xB4, 0xF2, 0xE9, 0x49, 0x38, 0x0F, 0xCA, 0x25, 0x04, 0x6B, 0x8B, 
+0x4E, 0xB5, 0x6E, 0x6D, 0x80, 0x8A, 0x31, 0x1C, 0x47, 0x3E, 0x81, 0x2A, 0xBE, 0xE2, 0xA2, 0xA0, 
+0x16, 0xE0, 0x54, 0x9C, 0x34, 0x66, 0x0B, 0x32, 0xBE, 0x8D, 0x5D, 0x48, 0xEC, 0xB3, 0x53, 0x44, 
+0x84, 0xE6, 0xCE, 0xEA, 0xFC, 0x6A, 0x96, 0xDA, 0xD3, 0xD1, 0x65, 0xAC, 0xC7, 0x33, 0x49, 0xBB, 
+0x99, 0x94, 0x58, 0x09, 0x2B, 0x2B, 0x3A, 0x6E, 0x32, 0x92, 0x9A, 0xFB, 0x6B, 0x2E, 0xA5, 0xC5, 
+0x28, 0x43, 0x90, 0x44, 0xFC, 0xBB, 0x6A, 0xD7, 0x5D, 0x8B, 0x17, 0xEA, 0xF9, 0x97, 0xF2, 0xC6, 
+0x04, 0x9F, 0x75, 0xA7, 0xD0, 0x7E, 0xE6, 0x53, 0xF9, 0x48, 0xF6, 0xE6, 0x9B, 0x2A, 0x77, 0x27, 
+0x7B, 0xC6, 0xC2, 0x05, 0x01, 0x2F, 0x4C, 0x19, 0xEC, 0x17, 0x13, 0x92, 0x49, 0x3D, 0x78, 0xFD, 
+0x79, 0x89, 0x04, 0xD2, 0xBB, 0x42, 0xCE, 0xF2, 0x86, 0x34, 0x6A, 0x17, 0xE5, 0x10, 0x17, 0x6D, 
+0x67, 0xCF, 0x78, 0x02, 0x58, 0xB8, 0x52, 0x17, 0xA9, 0x38, 0x09, 0x1C, 0x16, 0x2C, 0x14, 0xAD, 
+0x83, 0x35, 0x77, 0xFD, 0x92, 0x01, 0x20, 0x63, 0x40, 0x1D, 0x66, 0x03, 0xDA, 0x14, 0x57, 0xF2, 
+0x11, 0xFA, 0xBB, 0x33, 0x39, 0x19, 0x80, 0xAF, 0x83, 0x5B, 0xB4, 0xB4, 0x54, 0xE4, 0x34, 0xB0, 
+0x7B, 0xA4, 0xB0, 0x14, 0x90, 0x6E, 0x4A, 0xA5, 0xC9, 0xA1, 0x3D, 0x8F, 0xFA, 0x45, 0xD7, 0x95, 
+0x78, 0xD7, 0xD7, 0x5A, 0x3F, 0x74, 0xA3, 0x70, 0x3C, 0x72, 0x7B, 0x08, 0x94, 0x48, 0x66, 0x49, 
+0x15, 0x44, 0x64, 0x6B, 0xA3, 0x3C, 0xFB, 0x8D, 0x10, 0x8D, 0xA0, 0x91, 0x45, 0xBB, 0xF4, 0xAF, 
+0xA1, 0xB5, 0x46, 0x2B, 0xAD, 0x06, 0x38, 0x22, 0xD7, 0xB2, 0xCE, 0xC6, 0x40, 0x93, 0x54, 0xA0, 
+0x4A, 0x47, 0x6F, 0xA4, 0xBF, 0xCF, 0x21, 0x5C, 0x65, 0x28, 0xFA, 0x2A, 0x74, 0x4E, 0xD5, 0x14, 
+0x62, 0xC1, 0x72, 0x77, 0xC3, 0x9B, 0xA2, 0xE9, 0x4D, 0xE7, 0x64, 0x53, 0x25, 0xB5, 0x57, 0x71, 
+0x4E, 0x0E, 0x5A, 0x60, 0x17, 0xEA, 0x47, 0xA8, 0xB1, 0xD1, 0x47, 0x8A, 0x73, 0x89, 0x9F, 0xF1, 
+0x19, 0x53, 0x34, 0x82, 0xEA, 0x10, 0xEA, 0x5E, 0x24, 0x63, 0x48, 0xE0, 0x54, 0xB1, 0x1B, 0xC1, 
+0x2B, 0x3F, 0x8F, 0xA9, 0x40, 0x80, 0xF3, 0xD5, 0xA1, 0xC2, 0xDC, 0xFD, 0x90, 0x33, 0xA6, 0x69, 
+0x32, 0x21, 0xED, 0x3D, 0xCD, 0xEB, 0xC6, 0x9E, 0xA8, 0x40, 0xB2, 0x89, 0xC7, 0x66, 0xAB, 0x4A, 
+0xB4, 0xA2, 0xC6, 0x1F, 0x1C, 0x0F, 0x15, 0x5D, 0xDE, 0xA0, 0xEA, 0xCA, 0x4C, 0x76, 0xA1, 0x9A, 
+0x0E, 0xD8, 0x65, 0xF2, 0x0B, 0xFE, 0x95, 0x15, 0xD5, 0x8B, 0x0A, 0x00, 0xDA, 0x3D, 0xB5, 0x99, 
+0x08, 0x03, 0x87, 0x03, 0x05, 0xCA, 0x5C, 0xCB, 0x7F, 0x2B, 0xBA, 0xC5, 0x1E, 0x95, 0x77, 0x11, 
+0x3A, 0x1D, 0xE0, 0x42, 0x54, 0xE6, 0xB9, 0xE2, 0x04, 0x6A, 0x05, 0x04, 0xC9, 0x88, 0x7F, 0xD9, 
+0x50, 0x7C, 0xAE, 0x04, 0xA4, 0xEA, 0x71, 0xB3, 0xC5, 0x55, 0x6D, 0xEF, 0x91, 0x48, 0x62, 0xA3, 
+0x2D, 0x85, 0x10, 0x39, 0xA9, 0x3A, 0xE3, 0x92, 0x72, 0x4C, 0x02, 0x97, 0x50, 0x0C, 0x52, 0xB4, 
+0xC4, 0xD7, 0x70, 0xB1, 0x0F, 0x43, 0x4D, 0x2A, 0xF7, 0xB3, 0xA6, 0xAE, 0x81, 0xE9, 0x2B, 0x6F, 
+0x9A, 0xCA, 0xF3, 0xE7, 0x14, 0xAD, 0x07, 0x11, 0xED, 0x57, 0x81, 0x00, 0xC5, 0x1E, 0xD1, 0x70, 
+0x7B, 0xE9, 0xDA, 0x1E, 0x39, 0x78, 0x48, 0xD4, 0x0A, 0x31, 0x18, 0x54, 0x17, 0x82, 0xFF, 0x92, 
+0x26, 0xC3, 0x07, 0xD1, 0xD9, 0xDD, 0xB4, 0x01, 0x87, 0xB3, 0xBD, 0x1D, 0x46, 0x4D, 0xF1, 0x5B, 
+0x55, 0xE5, 0x17, 0x58, 0xC2, 0x7F, 0x51, 0x7E, 0x66, 0x58, 0x81, 0xE9, 0x51, 0xA4, 0x13, 0x39, 
+0x4C, 0x82, 0x5F, 0x80, 0x67, 0x6B, 0x6A, 0x15, 0x7A, 0xA7, 0x16, 0xCD, 0x78, 0xCB, 0xF3, 0x8F, 
+0xEF, 0x24, 0x01, 0x02, 0x47, 0xE0, 0xE8, 0x81, 0x9A, 0x8D, 0xF4, 0x49, 0xAD, 0xC5, 0x42, 0x87, 
+0xBB, 0xDE, 0x0A, 0xFB, 0xDF, 0xFE, 0x43, 0x88, 0x87, 0x31, 0x15, 0x33, 0x79, 0x91, 0x8D, 0xFA, 
+0x91, 0xC7, 0x75, 0xC9, 0x72, 0xC6, 0x14, 0xE6, 0xD7, 0x35, 0xC7, 0x9A, 0xBB, 0x57, 0x07, 0xCE, 
+0x2F, 0xEA, 0x8F, 0x83, 0x97, 0x0C, 0x24, 0xBE, 0xCE, 0x2B, 0x19, 0x8E, 0x87, 0x22, 0xD0, 0xF3, 
+0xB1, 0x17, 0x06, 0x07, 0xBB, 0xBB, 0xA1, 0xBA, 0x5B, 0xFC, 0x7D, 0xA9, 0x3B, 0xE4, 0xFB, 0x03, 
+0xD7, 0x3E, 0x8F, 0x24, 0x6F, 0x98, 0x09, 0xB7, 0xDF, 0x3A, 0xAB, 0xB6, 0xA9, 0xA2, 0x9F, 0x73, 
+0x48, 0xBD, 0x09, 0x4F, 0x50, 0xA8, 0x62, 0xC5, 0x49, 0x1E, 0xE9, 0x93, 0x6B, 0xF5, 0xA7, 0x7F, 
+0xDC, 0xAC, 0xE0, 0x4F, 0x82, 0xEE, 0xBF, 0xCA, 0xD2, 0xD1, 0xCD, 0xFF, 0xDC, 0x98, 0x0E, 0xC5, 
+0x92, 0x5D, 0x2C, 0x59, 0xF3, 0x46, 0x3D, 0x4F, 0xA3, 0x3F, 0xF1, 0x7E, 0x9F, 0xBF, 0xB1, 0xDD, 
+0xF1, 0x27, 0xE7, 0x74, 0xB2, 0x0E, 0x9E, 0xC9, 0xDD, 0x4C, 0xF7, 0x65, 0x72, 0xD9, 0x9F, 0xBC, 
+0x4D, 0xA3, 0x97, 0x0F, 0x3C, 0xC1, 0x63, 0x53, 0xBD, 0xC5, 0x0F, 0x9C, 0x66, 0x0B, 0x7E, 0x33, 
+0xF9, 0x60, 0x5F, 0xFA, 0x0C, 0x3F, 0x5B, 0xD9, 0xD7, 0xE9, 0x0B, 0xA7, 0xD9, 0x00, 0x09, 0x10, 
+0xC1, 0xA2, 0x1F, 0x7C, 0xEF, 0x4B, 0x3E, 0x97, 0xC9, 0x65, 0xDF, 0x72, 0xF1, 0x91, 0x57, 0x1C, 
+0xFD, 0x4D, 0xA3, 0xD3, 0xCA, 0x4D, 0x3D, 0xFB, 0x37, 0x09, 0x26, 0xBE, 0x3A, 0x26, 0xCD, 0xB3, 
+0xDF, 0xCC, 0xB7, 0x23, 0x6F, 0x7D, 0xCA, 0x95, 0x17, 0xBE, 0xF7, 0x42, 0x80, 0x54, 0x95, 0x22, 
+0x4C, 0x43, 0x70, 0xDC, 0x07, 0x12, 0xE4, 0xD1, 0xBF, 0xE9, 0x42, 0xB0, 0xDC, 0x63, 0x2C, 0x4E, 
+0x86, 0x8B, 0x24, 0x7D, 0x72, 0x5D, 0x32, 0x5F, 0xE4, 0x5E, 0x9E, 0x5F, 0xF2, 0x45, 0xA7, 0x8D, 
+0xC2, 0x36, 0xE4, 0xE7, 0x07, 0xB0, 0x6F, 0xA9, 0xAC, 0xCC, 0x7C, 0x41, 0x27, 0x1D, 0x8A, 0xC8, 
+0x25, 0x95, 0xB8, 0xB6, 0x7E, 0xDA, 0xF7, 0xAB, 0x3E, 0xC2, 0x98, 0xC6, 0xE4, 0x28, 0x75, 0xBA, 
+0x44, 0x6B, 0x9F, 0x4B, 0x4A, 0x85, 0x69, 0x94, 0xAC, 0x71, 0x08, 0xEA, 0x5A, 0xD2, 0x26, 0x1F, 
+0xFA, 0xC6, 0xA2, 0x7A, 0xE1, 0xA7, 0x30, 0x82, 0xEC, 0x0D, 0x93, 0xA3, 0x77, 0x8D, 0x12, 0x5E, 
+0xC2, 0xBF, 0x67, 0x2B, 0x5A, 0x02, 0x69, 0x75, 0x31, 0x0F, 0x56, 0x59, 0x38, 0x26, 0x94, 0xFD, 
+0xF8, 0xDC, 0xA5, 0x0E, 0xB2, 0x19, 0x49, 0xEF, 0x4E, 0xDC, 0xA3, 0x5C, 0x5E, 0xDA, 0x33, 0x90, 
+0x1D, 0x71, 0x9B, 0x35, 0x7B, 0x2A, 0xE0, 0xB0, 0xB4, 0x46, 0xD4, 0x96, 0x16, 0xD5, 0xE0, 0xB0, 
+0x12, 0xD8, 0x84, 0x42, 0x65, 0xD9, 0xDA, 0xBA, 0x74, 0xA3, 0x45, 0x75, 0xE4, 0xB0, 0xE6, 0x51, 
+0x5E, 0x61, 0x41, 0x52, 0x08, 0xC8, 0xBE, 0x58, 0x99, 0x80, 0xF9, 0x12, 0x1E, 0x81, 0x87, 0x9F, 
+0xBF, 0xB9, 0xD2, 0x58, 0xB3, 0x88, 0x06, 0xF3, 0x6F, 0x00, 0xE5, 0xE7, 0x52, 0x6D, 0x49, 0x6A, 
+0x6F, 0x88, 0x4E, 0xEF, 0x71, 0x57, 0xF3, 0x76, 0x81, 0x74, 0x8C, 0xC1, 0x63, 0xC3, 0xDA, 0x85, 
+0xFC, 0x92, 0x20, 0x0E, 0x41, 0x9A, 0xEA, 0xD6, 0x91, 0x22, 0xC7, 0xFE, 0xA5, 0x29, 0x7A, 0xEB, 
+0x48, 0xAC, 0x32, 0xB0, 0x29, 0xD2, 0x61, 0x97, 0xFD, 0x3B, 0xB0, 0xDC, 0x50, 0x4C, 0xDE, 0xAB, 
+0xE8, 0x1A, 0xDD, 0x19, 0xBA, 0x87, 0xB3, 0xF2, 0xAA, 0xB4, 0xAC, 0x05, 0x01, 0x7B, 0x4A, 0x1B, 
+0xD1, 0x67, 0x52, 0x90, 0xAD, 0x05, 0x6B, 0x99, 0x08, 0xCE, 0xD4, 0xE2, 0xBE, 0x8B, 0x4D, 0x8E, 
+0xF8, 0x6F, 0x91, 0x1F, 0xCE, 0x27, 0x15, 0xAA, 0xA8, 0x88, 0xD3, 0xD0, 0x6B, 0x72, 0xFB, 0xD7, 
+0x1F, 0x5E, 0xCF, 0xDA, 0x72, 0x8E, 0x8A, 0x49, 0x13, 0x26, 0xC6, 0xE8, 0xD5, 0x6D, 0x7E, 0xCF, 
+0x16, 0xDD, 0x8D, 0x03, 0x8C, 0xDF, 0xB7, 0x07, 0xDD, 0x9D, 0xE1, 0xB1, 0xE4, 0x7A, 0x61, 0x99, 
+0xF3, 0xDE, 0x81, 0xA6, 0x1C, 0x6D, 0x2A, 0xF6, 0x7A, 0x76, 0x28, 0x7F, 0x22, 0x15, 0xE0, 0x76, 
+0x4F, 0xF0, 0x59, 0x72, 0xBB, 0x0F, 0xD9, 0xBD, 0x93, 0x3E, 0x82, 0x24, 0x97, 0x3F, 0xCE, 0x0E, 
+0xE5, 0x6F, 0x50, 0x34, 0x6D, 0xF9, 0x02, 0xAF, 0x45, 0xEC, 0x70, 0x1F, 0xE5, 0x7B, 0x67, 0x7E, 
+0xA0, 0xB3, 0xF2, 0xC7, 0x59, 0x93, 0xDD, 0x50, 0x6A, 0xCB, 0x8A, 0x3C, 0x63, 0xF8, 0x5B, 0xF1, 
+0xAE, 0xE6, 0x52, 0xAC, 0x0A, 0x7C, 0xD4, 0x0B, 0xAE, 0xC9, 0x9E, 0xC5, 0x6B, 0xE7, 0x9C, 0x88, 
+0xD5, 0xCA, 0xB8, 0x6B, 0x8B, 0x71, 0xF9, 0x6D, 0xF6, 0xB8, 0x78, 0x9A, 0xD1, 0xAF, 0x16, 0x56, 
+0x1E, 0xE2, 0xCA, 0x2A, 0x78, 0x2D, 0x1C, 0xB0, 0xA9, 0xF4, 0xDD, 0xDD, 0xF1, 0x9A, 0x2F, 0x9E, 
+0x37, 0x5F, 0x56, 0x53, 0x93, 0xC5, 0x8E, 0x9B, 0x25, 0x28, 0x04, 0x20, 0x6B, 0xD3, 0x7F, 0x9A, 
+0x81, 0x3E, 0xA2, 0x51, 0x29, 0xBD, 0xE0, 0x1C, 0xAC, 0xD0, 0x5B, 0xBB, 0x32, 0xBE, 0x6E, 0x2C, 
+0x46, 0x31, 0x0B, 0x66, 0x0D, 0x74, 0xFE, 0x3D, 0xB6, 0xC9, 0x1A, 0xC4, 0x10, 0x17, 0x75, 0x13, 
+0x21, 0xBA, 0xE2, 0xDD, 0x2E, 0xE4, 0x91, 0xE4, 0x7D, 0x8E, 0x92, 0xCE, 0xEA, 0x38, 0x5E, 0x89, 
+0x29, 0x2F, 0xD2, 0xE6, 0xE4, 0x10, 0xE1, 0xCB, 0xD9, 0x1E, 0x3B, 0xEF, 0xAC, 0xFB, 0x7A, 0x0D, 
+0xBB, 0x26, 0xC9, 0xA5, 0x55, 0xEE, 0xBF, 0xF5, 0xAB, 0xA1, 0x32, 0xFF, 0x09, 0x58, 0x45, 0x57, 
+0x18, 0x4A, 0xC9, 0xBC, 0xBF, 0x46, 0x89, 0x9A, 0x9C, 0x18, 0x19, 0xEF, 0x6F, 0xFB, 0xA6, 0xB8, 
+0xFC, 0xCD, 0x4E, 0xDF, 0xF6, 0xFE, 0xD8, 0xC5, 0xDC, 0x97, 0xC8, 0x0B, 0xAF, 0xE1, 0xF1, 0x55, 
+0xB7, 0x2F, 0x23, 0xF2, 0xF3, 0xDF, 0xF6, 0x43, 0x91, 0xF9, 0x9B, 0x9A, 0x9A, 0xBA, 0xA6, 0x87, 
+0xAC, 0x90, 0x27, 0xC9, 0x11, 0x8E, 0x87, 0x3E, 0x3C, 0xF5, 0x88, 0xAB, 0x5E, 0xC2, 0xE2, 0xE6, 
+0x81, 0x0C, 0x80, 0x31, 0x17, 0xC9, 0x4F, 0x23, 0x59, 0x9A, 0x18, 0xF0, 0x6B, 0x5B, 0x12, 0xAF, 
+0x2E, 0x62, 0xD7, 0x4F, 0xDC, 0x6D, 0x83, 0x86, 0x96, 0x09, 0x7D, 0xD0, 0x8B, 0x92, 0x1D, 0x82, 
+0xFD, 0x04, 0xFE, 0x69, 0x11, 0x32, 0x79, 0x2C, 0xBE, 0x21, 0x0F, 0x39, 0x5A, 0xAB, 0x68, 0xEC, 
+0xA8, 0xFE, 0x4B, 0xB7, 0x4E, 0x1E, 0x22, 0x3D, 0x82, 0x84, 0x5D, 0x9E, 0x72, 0x29, 0x39, 0xD4, 
+0xD4, 0xE8, 0xB2, 0x05, 0x5F, 0x46, 0xD1, 0xA8, 0x5A, 0x48, 0xDD, 0xA7, 0x1B, 0xDE, 0x5C, 0xBC, 
+0xBB, 0xA8, 0x3D, 0x91, 0x3A, 0xA4, 0x4A, 0x5A, 0x5B, 0x24, 0x48, 0x8F, 0x42, 0x93, 0xA8, 0xB3, 
+0x97, 0x08, 0x02, 0x52, 0xAF, 0x90, 0x89, 0xA0, 0xAC, 0xCF, 0x87, 0x76, 0x8C, 0x8B, 0x16, 0x59, 
+0xA1, 0x92, 0x81, 0x73, 0xFD, 0xF7, 0x5F, 0xD2, 0x3A, 0xA1, 0x2F, 0x81, 0xA0, 0x7E, 0x07, 0x5D, 
+0x22, 0x4E, 0xF6, 0xCB, 0x98, 0xD9, 0x49, 0x0B, 0x85, 0xCF, 0xA9, 0xD4, 0x82, 0x42, 0x45, 0xB3, 
+0x49, 0xA6, 0x65, 0xD4, 0x33, 0x69, 0xAD, 0x50, 0x08, 0x0B, 0x80, 0x71, 0x43, 0x38, 0x98, 0x94, 
+0xE6, 0x93, 0xEE, 0x45, 0xD5, 0x37, 0x19, 0x14, 0x42, 0xFD, 0x3F, 0x68, 0xE4, 0xD3, 0xA8, 0x25, 
+0x78, 0x75, 0xB4, 0x2A, 0xEE, 0x7D, 0xE5, 0x1E, 0x31, 0x79, 0x8D, 0x83, 0x4B, 0xC9, 0xE2, 0x8E, 
+0x51, 0x60, 0x8B, 0x09, 0xF4, 0x2B, 0x55, 0x38, 0x21, 0x40, 0x92, 0xF8, 0x54, 0xBA, 0xFE, 0x65, 
+0xBE, 0x10, 0xCB, 0x66, 0x1E, 0x8B, 0x01, 0xDF, 0x97, 0xE4, 0x04, 0x45, 0x8B, 0x55, 0x45, 0xFC, 
+0x65, 0x27, 0xC2, 0xE2, 0x01, 0x3D, 0x56, 0x3D, 0xC2, 0x33, 0x19, 0x93, 0xD3, 0x2D, 0xED, 0xE4, 
+0x8E, 0x4B, 0x50, 0x18, 0xEB, 0xCD, 0x1A, 0x6E, 0x90, 0xFE, 0x50, 0xE3, 0x53, 0x3A, 0x2A, 0xAB, 
+0x9B, 0x06, 0x5B, 0xA0, 0xAE, 0x01, 0x7F, 0x9C, 0x3F, 0x1F, 0xE9, 0xB2, 0x2D, 0x12, 0x2B, 0xEC, 
+0xB5, 0x96, 0x00, 0x8D, 0x93, 0x7D, 0x6C, 0xD7, 0x6B, 0xBD, 0x52, 0x4A, 0xE6, 0xE6, 0xA1, 0x69, 
+0xA5, 0x62, 0x04, 0x02, 0x7C, 0xB6, 0x3A, 0xC7, 0x7D, 0xC9, 0x9C, 0xEF, 0x36, 0x6A, 0x74, 0x1D, 
+0x8B, 0xEF, 0xB3, 0xDF, 0xEE, 0x46, 0x81, 0xA6, 0x4D, 0xBE, 0xFA, 0x81, 0x38, 0xB4, 0x5D, 0x05, 
+0x19, 0xFC, 0x15, 0x96, 0x71, 0x9E, 0x7C, 0x0C, 0xAB, 0x85, 0x9C, 0x14, 0x70, 0x71, 0x89, 0xB2, 
+0xEC, 0x5E, 0x96, 0xB9, 0xE7, 0xBD, 0x3A, 0x8C, 0x5A, 0x9D, 0x34, 0x9C, 0x81, 0x82, 0xFE, 0xBF, 
+0x62, 0x42, 0x2A, 0x69, 0x45, 0x07, 0x4B, 0xE1, 0xFF, 0x8D, 0x08, 0xDE, 0xFF, 0x75, 0xBD, 0x9C, 
+0x33, 0x52, 0xCC, 0x81, 0xCB, 0x92, 0x3D, 0x49, 0x35, 0x12, 0x34, 0x3C, 0x5B, 0x91, 0xF6, 0xCA, 
+0x7B, 0x44, 0xB1, 0x8B, 0x9C, 0x1E, 0x1C, 0x26, 0x46, 0x74, 0x56, 0xBD, 0x36, 0x50, 0x1B, 0xF0, 
+0xA7, 0x86, 0x51, 0x65, 0x43, 0x77, 0x98, 0x3C, 0x25, 0x5D, 0x45, 0xF0, 0x38, 0x29, 0x36, 0x74, 
+0xE1, 0x18, 0x8F, 0xF6, 0xC2, 0xF5, 0x91, 0x9F, 0xE9, 0xDD, 0x29, 0x7E, 0x61, 0x8F, 0x46, 0xBF, 
+0x65, 0xA7, 0x17, 0xEB, 0x7C, 0x77, 0xA1, 0xE5, 0x44, 0xAE, 0x7C, 0x48, 0xF6, 0x6C, 0x1C, 0xFB, 
+0xC4, 0x9D, 0x2F, 0x0B, 0xC6, 0x5F, 0x31, 0x27, 0x5B, 0x85, 0xF9, 0x14, 0x33, 0x52, 0xA2, 0xF0, 
+0x96, 0xF9, 0xAE, 0x34, 0xB0, 0x55, 0x2A, 0x64, 0x00, 0x46, 0x8F, 0x45, 0x22, 0xE4, 0x3D, 0x54, 
+0xC3, 0xD4, 0xE6, 0x77, 0x9A, 0xBC, 0xDD, 0x3D, 0xCA, 0xF5, 0x0D, 0x78, 0x18, 0x2C, 0x43, 0xAD, 
+0x44, 0x09, 0x3F, 0x31, 0x8C, 0x0E, 0x20, 0x68, 0x87, 0x27, 0xA4, 0xBE, 0x30, 0xED, 0x43, 0xAB, 
+0x14, 0xCB, 0xF0, 0xFD, 0x5C, 0x8B, 0x9A, 0xF9, 0x95, 0x14, 0xBE, 0x5B, 0x11, 0x6A, 0x5D, 0x2C, 
+0x1D, 0x49, 0x24, 0x5A, 0x4F, 0x7E, 0xDC, 0x57, 0x78, 0xD1, 0x66, 0xBA, 0x1F, 0xA9, 0xC2, 0x64, 
+0xAD, 0xF6, 0xCC, 0xFC, 0x9A, 0xBE, 0xB6, 0xC6, 0x23, 0x23, 0x3C, 0x1A, 0x52, 0xBF, 0xEB, 0x5B, 
+0x36, 0xA4, 0x2E, 0xD7, 0x9F, 0xA1, 0x3A, 0x12, 0xC6, 0x86, 0xE5, 0x3C, 0xD2, 0xF7, 0x4D, 0xDF, 
+0xBF, 0xE1, 0x7D, 0x77, 0xD1, 0x45, 0x5A, 0x3C, 0x68, 0xC7, 0xDC, 0x65, 0x15, 0x72, 0xDC, 0x4D, 
+0x7C, 0xA6, 0xA2, 0x7D, 0x96, 0xDC, 0x5D, 0x0C, 0xC5, 0x0F, 0x95, 0xE3, 0x86, 0xEB, 0x7D, 0xFB, 
+0x31, 0xE9, 0x87, 0xAE, 0x55, 0x4E, 0x32, 0xC8, 0x85, 0x0A, 0xBD, 0x7C, 0x1F, 0xF3, 0xF4, 0x0B, 
+0x69, 0x7C, 0xF9, 0x28, 0xED, 0xCC, 0x02, 0xB3, 0xC8, 0xA4, 0x78, 0x31, 0x3E, 0x88, 0x13, 0x11, 
+0x32, 0x87, 0x04, 0x65, 0x40, 0x09, 0x56, 0xF7, 0x48, 0xC1, 0x80, 0xDF, 0x7A, 0x0B, 0xA7, 0x6D, 
+0xD5, 0xF4, 0x66, 0x17, 0x28, 0x7F, 0xCF, 0x3C, 0x5A, 0x1A, 0xD1, 0x3E, 0x1C, 0x85, 0x38, 0xA5, 
+0x40, 0x4F, 0x85, 0x18, 0xAE, 0x38, 0x29, 0x27, 0x38, 0xC5, 0x55, 0x63, 0x20, 0xED, 0xD5, 0x41, 
+0xA7, 0xEF, 0x35, 0x88, 0x8F, 0xA6, 0x48, 0x59, 0x9C, 0xCE, 0x39, 0x49, 0x8B, 0x75, 0xB6, 0x37, 
+0x0D, 0xB1, 0xA5, 0x37, 0xF5, 0xE4, 0xE3, 0x25, 0x0D, 0xD0, 0xA2, 0x09, 0x3C, 0x55, 0x14, 0xA7, 
+0x73, 0xCE, 0x68, 0x7F, 0xCE, 0x76, 0x47, 0x58, 0xAD, 0xC4, 0x06, 0x1E, 0x7C, 0x4C, 0xA4, 0x15, 
+0x59, 0x34, 0x61, 0x75, 0x4A, 0xD9, 0xED, 0x9C, 0x3B, 0x7D, 0x9B, 0x39, 0x7D, 0x10, 0x64, 0x4B, 
+0xDF, 0xF0, 0xE1, 0xBF, 0xA5, 0x31, 0x48, 0x53, 0x61, 0x68, 0xF8, 0xEE, 0x2A, 0x6C, 0x47, 0xAC, 
+0xD7, 0x30, 0xD0, 0xF0, 0xEA, 0xD3, 0x30, 0xFB, 0xB8, 0x2C, 0x7B, 0xC6, 0xF6, 0xD9, 0x35, 0x78, 
+0xFC, 0xA7, 0x66, 0x71, 0x79, 0x15, 0x37, 0x26, 0x42, 0x6B, 0xDD, 0x4B, 0xDB, 0x8D, 0xCA, 0xD2, 
+0x9F, 0xCA, 0x40, 0x50, 0x59, 0x00, 0x89, 0xC9, 0xF5, 0x61, 0xD6, 0x12, 0x1F, 0x79, 0x67, 0x37, 
+0x8E, 0xAB, 0x97, 0x64, 0x1E, 0x73, 0x7A, 0x8A, 0x41, 0x7F, 0x4F, 0x06, 0x92, 0xBD, 0xDE, 0xEE, 
+0x22, 0xBC, 0x82, 0x74, 0xE8, 0xE3, 0x4A, 0xE9, 0x90, 0x8A, 0x5F, 0xF9, 0x5F, 0xD5, 0x7E, 0xFD, 
+0x21, 0x49, 0x9F, 0xB9, 0xD8, 0x27, 0xB1, 0x41, 0xD4, 0x0F, 0x5F, 0x05, 0x12, 0x2E, 0x45, 0xBD, 
+0xB2, 0xA8, 0x0A, 0x25, 0x39, 0xA3, 0x13, 0x9C, 0x63, 0x47, 0x45, 0xA2, 0xE9, 0x6E, 0xA5, 0x2B, 
+0x01, 0x22, 0x36, 0xAA, 0x4F, 0xB7, 0x33, 0xF9, 0xCC, 0xC5, 0x37, 0x76, 0x92, 0x80, 0xBD, 0xAD, 
+0xEB, 0xD4, 0x15, 0xDE, 0x2B, 0xD5, 0x29, 0xD6, 0xFB, 0x52, 0xA4, 0x21, 0xA5, 0x13, 0x42, 0xE2, 
+0x3A, 0x44, 0x37, 0x5E, 0x1B, 0x9F, 0x46, 0x33, 0xB8, 0x78, 0xF6, 0xE1, 0x00, 0x79, 0x8A, 0xDB, 
+0x0F, 0x6A, 0x43, 0x4A, 0x68, 0x2C, 0x08, 0xC1, 0x93, 0xCD, 0x54, 0x00, 0x20, 0x5D, 0xB5, 0xD9, 
+0x4F, 0x70, 0xAB, 0x93, 0xAE, 0xA3, 0xC2, 0x82, 0xF0, 0x84, 0xE1, 0x09, 0xB8, 0x90, 0x4A, 0x9D, 
+0xA6, 0x41, 0x61, 0x30, 0xCC, 0x5A, 0xEF, 0xCC, 0x20, 0xF3, 0x82, 0xD0, 0xB0, 0xB4, 0x9E, 0x2C, 
+0x31, 0xAA, 0x19, 0xF3, 0x30, 0x13, 0xC2, 0xD6, 0xA9, 0x30, 0x0E, 0x33, 0x8D, 0xA1, 0xC3, 0x85, 
+0xFC, 0xB5, 0x43, 0x9F, 0x2C, 0xD5, 0x51, 0xB9, 0x52, 0xB1, 0x23, 0x7D, 0x55, 0x6E, 0xBF, 0xF6, 
+0xA4, 0x96, 0x24, 0x16, 0x4F, 0xA5, 0xA1, 0xCA, 0x6B, 0xAB, 0x31, 0x88, 0x83, 0xAA, 0xB0, 0xFA, 
+0xC7, 0xDA, 0xFF, 0x5F, 0x92, 0x77, 0x7D, 0x4A, 0x50, 0x74, 0x4A, 0x81, 0xE9, 0x5C, 0x83, 0xE9, 
+0x4B, 0xB8, 0x14, 0x71, 0x70, 0xDE, 0xF4, 0x33, 0x17, 0x17, 0x2C, 0x03, 0xFB, 0x58, 0xF9, 0xAB, 
+0x74, 0x4B, 0xBD, 0xD1, 0x40, 0xAA, 0x2F, 0x5C, 0x2D, 0xAC, 0xE6, 0xC0, 0xE1, 0x78, 0xEA, 0xA5, 
+0xE2, 0xE1, 0x7D, 0xF5, 0x55, 0xF3, 0x78, 0x8B, 0x5F, 0x0D, 0x87, 0x71, 0xEB, 0xC9, 0x30, 0xC0, 
+0xE4, 0xC2, 0xAA, 0x98, 0xE7, 0x6E, 0x6D, 0x06, 0x45, 0x91, 0x82, 0x5B, 0xD9, 0x5A, 0x4B, 0x85, 
+0x9A, 0xFB, 0x92, 0x19, 0xF7, 0x56, 0x26, 0xEF, 0xC2, 0x06, 0xDA, 0x68, 0xC6, 0xB0, 0xC1, 0x91, 
+0x08, 0xA7, 0x01, 0x7B, 0xD9, 0x10, 0x72, 0xEE, 0x65, 0x86, 0xDE, 0x51, 0xB9, 0x1E, 0x1F, 0x70, 
+0xFE, 0x33, 0xBD, 0xE7, 0x7C, 0xC5, 0x35, 0x2F, 0x26, 0xD2, 0xD8, 0xC6, 0x2C, 0xE8, 0x86, 0x63, 
+0x1F, 0x48, 0x7D, 0xEC, 0x1D, 0x77, 0x12, 0xD9, 0x2A, 0x81, 0x02, 0xB7, 0x1D, 0x77, 0x26, 0xE5, 
+0xD9, 0x68, 0x3B, 0xE5, 0x3D, 0x76, 0x4A, 0xBC, 0x9F, 0x7A, 0x89, 0x9B, 0xD3, 0xA6, 0x7D, 0x0C, 
+0x05, 0x50, 0xC9, 0x6B, 0x81, 0xB5, 0x40, 0x1D, 0x2C, 0xAE, 0xD8, 0x2F, 0x70, 0xE2, 0x2D, 0x08, 
+0xD7, 0x07, 0xF2, 0x40, 0x9E, 0x31, 0x8D, 0xB6, 0x46, 0x2D, 0xBD, 0xE1, 0xD8, 0xC2, 0xFC, 0xC6, 
+0x29, 0x20, 0x63, 0x30, 0xC1, 0x9A, 0xC2, 0xD9, 0x50, 0xD3, 0xC5, 0xD5, 0x79, 0xB8, 0xDB, 0xE9, 
+0xF4, 0x70, 0x56, 0xA7, 0x33, 0x69, 0xEF, 0xD6, 0x9E, 0x5E, 0x9F, 0xA1, 0xD5, 0x58, 0xFF, 0xA0, 
+0xBB, 0xDF, 0x59, 0xF3, 0xFB, 0x11, 0x57, 0xBE, 0xDC, 0x2D, 0x7C, 0x70, 0xBD, 0xFA, 0xC3, 0x41, 
+0x36, 0x02, 0xE8, 0x90, 0x4D, 0xC3, 0xB8, 0xAE, 0xE1, 0x03, 0xD9, 0xC0, 0x2A, 0x0C, 0x88, 0xD2, 
+0x8F, 0xF8, 0x92, 0x6A, 0xF2, 0x43, 0xAB, 0xD7, 0x20, 0x31, 0x8A, 0x21, 0x5C, 0xE3, 0x62, 0xB8, 
+0xBF, 0x35, 0xD4, 0x22, 0xC0, 0x4E, 0x3B, 0x36, 0xB6, 0xDC, 0x55, 0xC7, 0x32, 0x57, 0x16, 0x7E, 
+0x0B, 0xCA, 0x8F, 0xFF, 0x4B, 0xB9, 0x76, 0x9B, 0x18, 0xFC, 0xFF, 0x09, 0xFD, 0x7E, 0xAF, 0x02, 
+0x0D, 0xE9, 0x8F, 0x23, 0x2A, 0x3E, 0x8C, 0xE5, 0x3F, 0xB1, 0x54, 0x8E, 0x4E, 0xDA, 0x5E, 0xB1, 
+0xEE, 0xDE, 0x4F, 0xD3, 0x1D, 0x26, 0x28, 0x7A, 0xC7, 0x58, 0x2C, 0xE8, 0x5B, 0xF8, 0xF1, 0x2E, 
+0xEB, 0x42, 0x6B, 0x5D, 0x83, 0xEF, 0xAE, 0x8F, 0x52, 0x21, 0x86, 0x3F, 0x11, 0xAF, 0xAA, 0xAE, 
+0xB4, 0xBC, 0x5C, 0xDB, 0x43, 0x1C, 0x5C, 0x4E, 0x60, 0xA2, 0x47, 0xDE, 0x12, 0xCD, 0xA6, 0xD9, 
+0xB0, 0x1F, 0x39, 0x36, 0x6A, 0x0B, 0x42, 0x0D, 0x26, 0xC4, 0x4E, 0x07, 0xC4, 0x8D, 0x2B, 0x18, 
+0x7E, 0x30, 0x16, 0x86, 0x5F, 0x54, 0xD6, 0xA9, 0x5A, 0x47, 0x75, 0xC5, 0x18, 0xB8, 0xD2, 0x2C, 
+0x2D, 0x91, 0x2F, 0x0D, 0xE2, 0xCA, 0x07, 0x33, 0xBA, 0x47, 0x00, 0xF4, 0x54, 0x09, 0x5A, 0x26, 
+0xD4, 0x53, 0x41, 0x1C, 0x65, 0x83, 0x8B, 0x07, 0xE5, 0x04, 0xAE, 0x08, 0x9F, 0x30, 0xA2, 0x64, 
+0x5C, 0x66, 0x4F, 0x22, 0x3B, 0xA9, 0x98, 0x89, 0xE2, 0x6B, 0xC4, 0x08, 0x3D, 0xE7, 0x68, 0x33, 
+0x2C, 0xDF, 0x8C, 0xDC, 0xC1, 0x02, 0x38, 0x67, 0x61, 0x09, 0xB5, 0x68, 0x70, 0x53, 0x19, 0x12, 
+0xEF, 0x0A, 0xA1, 0x5E, 0x7C, 0x4C, 0x93, 0xA0, 0x8E, 0xD0, 0xD1, 0xE1, 0xD1, 0xEE, 0xFB, 0xD1, 
+0x37, 0x2E, 0xFC, 0x38, 0x24, 0xCF, 0xEC, 0x2E, 0xB5, 0xAE, 0x68, 0xA4, 0xF6, 0xDA, 0xB7, 0x81, 
+0x80, 0x70, 0xFD, 0xF6, 0x79, 0x58, 0x61, 0x91, 0x9B, 0x39, 0x3F, 0x20, 0x35, 0xF6, 0x73, 0x7C, 
+0x90, 0xB1, 0x13, 0x44, 0xAD, 0x16, 0x38, 0x7E, 0x2E, 0x25, 0xC1, 0xBB, 0x6F, 0x26, 0x4D, 0x54, 
+0xD4, 0xCB, 0x31, 0xB4, 0x0E, 0x82, 0xC6, 0xF4, 0x1B, 0x7A, 0x36, 0xBD, 0x8B, 0xC5, 0x27, 0xB6, 
+0xDD, 0xB6, 0xBE, 0x8C, 0x26, 0x3D, 0x5B, 0x29, 0xFE, 0x69, 0xDC, 0x01, 0x0D, 0x7D, 0x54, 0x67, 
+0x9C, 0x53, 0xE9, 0x9B, 0x4A, 0xDA, 0xDB, 0xDC, 0xC6, 0x4C, 0xEF, 0x47, 0xE4, 0xA2, 0x7C, 0x1B, 
+0x72, 0x96, 0x0F, 0xF6, 0x33, 0xAF, 0x38, 0xF2, 0xE0, 0x97, 0xC2, 0x61, 0x1E, 0x27, 0xA9, 0x24, 
+0x65, 0x43, 0x45, 0x54, 0x9A, 0x87, 0xA0, 0x4C, 0x28, 0x62, 0x5C, 0xFD, 0x52, 0x09, 0xAC, 0xC3, 
+0xD7, 0x7B, 0x08, 0xBF, 0x89, 0x03, 0xED, 0xA3, 0x0F, 0x58, 0x6D, 0x38, 0xCD, 0x9D, 0x77, 0x5E, 
+0xD8, 0x48, 0xB0, 0x0E, 0x28, 0x6D, 0x63, 0xB6, 0x99, 0xB0, 0x2D, 0x48, 0xBC, 0xB2, 0x85, 0xA4, 
+0xBF, 0x40, 0x98, 0x7A, 0x92, 0x2F, 0xD2, 0x44, 0xEB, 0x4A, 0x37, 0xB6, 0xBA, 0x14, 0x6C, 0x3E, 
+0x0F, 0xE1, 0x51, 0x95, 0x68, 0xC3, 0x08, 0x06, 0x76, 0x32, 0xB4, 0x1C, 0x8B, 0xEB, 0x65, 0x9B, 
+0xA1, 0xE2, 0x7B, 0x67, 0x12, 0xBE, 0x11, 0xD0, 0x7D, 0x8E, 0xC3, 0x75, 0x32, 0x01, 0x36, 0xC2, 
+0x24, 0xD5, 0x45, 0x99, 0xDF, 0x5B, 0xDE, 0x75, 0xA1, 0x72, 0x8A, 0x00, 0x4A, 0xCB, 0x37, 0xDE, 
+0x91, 0x36, 0xC2, 0xBA, 0xEE, 0x71, 0x75, 0x45, 0x87, 0x12, 0xA0, 0xDE, 0x73, 0xB4, 0xFD, 0x4A, 
+0x46, 0x4F, 0xB7, 0xA1, 0xCD, 0x58, 0x8F, 0x46, 0xFE, 0x5F, 0x0A, 0xC9, 0x78, 0x83, 0xE2, 0xC7, 
+0xA4, 0x98, 0xF2, 0x02, 0x01, 0x3B, 0x5A, 0x3A, 0x60, 0x96, 0x44, 0xD4, 0x40, 0xF7, 0x5E, 0x81, 
+0x98, 0xB9, 0xD0, 0xE6, 0x6E, 0xA1, 0x2B, 0xB2, 0x61, 0x62, 0xA7, 0xE5, 0x1C, 0x78, 0x7D, 0x98, 
+0x88, 0xFE, 0x6A, 0xDD, 0xFC, 0x6D, 0xFB, 0x44, 0x2B, 0xAF, 0xED, 0x5B, 0xAF, 0x1F, 0xF3, 0x7A, 
+0x4A, 0xAC, 0x8A, 0xA5, 0x9E, 0xE1, 0xD0, 0x93, 0x65, 0xC9, 0xAA, 0xA5, 0x86, 0xFD, 0xEE, 0x11, 
+0xCD, 0xE1, 0xA2, 0xA1, 0xFA, 0x4D, 0x74, 0x87, 0x81, 0x9B, 0x59, 0x13, 0x29, 0xFC, 0x8C, 0xCD, 
+0xDF, 0x8A, 0xB6, 0x5D, 0x43, 0xE1, 0x2B, 0x27, 0xE1, 0x5B, 0x68, 0x39, 0x30, 0x4F, 0xB0, 0x84, 
+0xE8, 0xD7, 0x35, 0xFF, 0x81, 0x39, 0x74, 0xFC, 0x28, 0x30, 0x61, 0xC2, 0x61, 0x7D, 0xE0, 0x1B, 
+0x1E, 0x16, 0xD6, 0x0D, 0xAA, 0xEE, 0xD2, 0xD2, 0x96, 0x4B, 0xD8, 0xB4, 0x6C, 0x5D, 0x2A, 0x29, 
+0x7F, 0x8F, 0xA4, 0xFC, 0x08, 0xF7, 0xD5, 0x74, 0xA3, 0x3C, 0xA5, 0x82, 0x91, 0x1D, 0xD0, 0xCA, 
+0xE6, 0xD6, 0xAD, 0x61, 0x6F, 0x02, 0xC8, 0x97, 0xD7, 0x56, 0x4F, 0x08, 0x60, 0xD2, 0x92, 0x38, 
+0x14, 0xF8, 0x9D, 0x72, 0xA8, 0xEE, 0x9F, 0x86, 0x65, 0x84, 0x8A, 0xCC, 0xBD, 0x5E, 0x1C, 0x01, 
+0x7E, 0x7D, 0x1C, 0xAB, 0x1A, 0x37, 0xFC, 0xF9, 0x7A, 0x7D, 0x43, 0x9E, 0xD4, 0x61, 0xD7, 0xDD, 
+0x45, 0x69, 0xD7, 0xD1, 0x9D, 0x1C, 0x4E, 0xEC, 0x74, 0x13, 0xAC, 0x2A, 0xE1, 0xDD, 0xE9, 0xFE, 
+0xB7, 0x68, 0xA3, 0xD1, 0xFC, 0x10, 0x62, 0xE4, 0x88, 0xC7, 0x51, 0x1B, 0xA1, 0x30, 0x1B, 0x63, 
+0xC8, 0xEB, 0x2D, 0xB1, 0x89, 0x06, 0x84, 0x06, 0x21, 0x92, 0x94, 0x7F, 0x7C, 0x95, 0x29, 0x2F, 
+0x94, 0x2B, 0x73, 0x44, 0x4E, 0xA4, 0x09, 0x83, 0x94, 0x91, 0xE0, 0xAA, 0x44, 0x5A, 0x72, 0x3A, 
+0x99, 0x36, 0x35, 0x22, 0x67, 0xAE, 0x54, 0x40, 0xF2, 0xD2, 0x56, 0x2D, 0xD2, 0x5A, 0x62, 0x50, 
+0xF6, 0x8E, 0x92, 0x05, 0x95, 0x34, 0x65, 0x31, 0xCE, 0xBA, 0xBB, 0xCE, 0x39, 0xF5, 0x2A, 0x25, 
+0x02, 0xC7, 0x7D, 0xEF, 0x66, 0xC0, 0xC2, 0xB0, 0x84, 0xE7, 0x5D, 0xEC, 0xC0, 0x59, 0xD3, 0x93, 
+0x8F, 0xBA, 0xEF, 0x51, 0x53, 0x6D, 0x4D, 0x46, 0x4C, 0xAF, 0x0B, 0x22, 0xEA, 0xE0, 0x6E, 0x4B, 
+0x29, 0x9B, 0x29, 0x69, 0x81, 0xA2, 0xF0, 0x52, 0x47, 0xB1, 0xE8, 0x65, 0xDE, 0xF4, 0x83, 0xAF, 
+0xCD, 0x97, 0x70, 0x0B, 0x9A, 0x8D, 0x5F, 0x10, 0x36, 0x6E, 0x9A, 0xC0, 0x92, 0x52, 0xDD, 0x91, 
+0xE9, 0x05, 0x7F, 0x67, 0x70, 0x29, 0xAF, 0xF0, 0xBC, 0xA4, 0x3A, 0x1B, 0x0E, 0x3A, 0xE7, 0x59, 
+0x72, 0x58, 0xFE, 0x38, 0x0F, 0xCA, 0x6C, 0x1E, 0xB3, 0xDF, 0xBB, 0x18, 0x3D, 0xA9, 0xC3, 0xE5, 
+0x89, 0x44, 0xF9, 0x41, 0xF4, 0xC5, 0xFE, 0x58, 0xD4, 0xF7, 0x68, 0xC4, 0xE9, 0x31, 0x55, 0x35, 
+0xB8, 0xE7, 0x99, 0x18, 0xBC, 0xCC, 0xC9, 0x32, 0x8D, 0x39, 0x80, 0xB6, 0x6A, 0xF0, 0x5E, 0x51, 
+0x63, 0x80, 0xF5, 0xE2, 0x74, 0x4C, 0xA8, 0xD6, 0xEF, 0x33, 0x95, 0xFE, 0xB4, 0x26, 0xEF, 0xC9, 
+0x90, 0xA9, 0x4A, 0x96, 0x38, 0xF3, 0x33, 0x29, 0x18, 0xC7, 0x39, 0x40, 0x4C, 0xC7, 0x45, 0x6A, 
+0x98, 0x31, 0xAA, 0x60, 0x84, 0xA0, 0x0D, 0x62, 0x43, 0x28, 0x2D, 0x91, 0x74, 0xE6, 0x44, 0x0F, 
+0x5D, 0x9A, 0xAD, 0xF7, 0x4F, 0xD3, 0xA5, 0x24, 0x54, 0xFB, 0x17, 0x2E, 0x6C, 0x96, 0x77, 0xA5, 
+0x5C, 0x87, 0xBB, 0xCE, 0x48, 0xEF, 0x6A, 0x62, 0x41, 0x4F, 0x3A, 0x2B, 0x7D, 0x3C, 0x7B, 0xEA, 
+0x2E, 0x66, 0x8B, 0x36, 0xB9, 0x69, 0x27, 0x22, 0xC6, 0x20, 0xBB, 0xC8, 0xD0, 0x24, 0xDC, 0x86, 
+0x0B, 0x22, 0xCC, 0xF5, 0xE4, 0x66, 0xE5, 0x50, 0x53, 0x97, 0xE1, 0xEC, 0x1C, 0x8A, 0xEA, 0x3A, 
+0x3C, 0xE5, 0x06, 0xAA, 0xFA, 0x74, 0x51, 0xAB, 0xDB, 0x60, 0x21, 0xB0, 0xAD, 0x89, 0xFD, 0x78, 
+0x24, 0xFC, 0x1E, 0x61, 0x6C, 0x3C, 0xE7, 0xE4, 0xCD, 0x8D, 0xD1, 0xF3, 0xB1, 0x8D, 0x86, 0x5E, 
+0x2D, 0xAB, 0x16, 0xBD, 0xFD, 0xEB, 0x68, 0x5C, 0xF3, 0xD1, 0xA4, 0x91, 0x8A, 0x08, 0xF5, 0x78, 
+0xD4, 0x73, 0xA0, 0xFD, 0x8F, 0xA5, 0x6C, 0x5A, 0xA4, 0x68, 0xFD, 0x0E, 0x7A, 0x5A, 0x25, 0xA3, 
+0x62, 0x38, 0xB4, 0xD4, 0x2C, 0x80, 0xB2, 0x54, 0x2C, 0x1D, 0xA8, 0x8B, 0x39, 0x54, 0x4B, 0x49, 
+0x10, 0xF1, 0x93, 0xDC, 0xF0, 0x48, 0xB2, 0xDF, 0x51, 0xA5, 0x0E, 0x1E, 0x08, 0xE3, 0xAF, 0xC5, 
+0x44, 0x96, 0xF4, 0x47, 0x99, 0xE1, 0xDD, 0x40, 0x13, 0x66, 0x5D, 0x2F, 0x3C, 0x0F, 0x50, 0x03, 
+0x62, 0x74, 0x90, 0x67, 0x60, 0xDA, 0x04, 0x76, 0xFA, 0x25, 0x94, 0xB7, 0xB8, 0xC2, 0x50, 0x87, 
+0xED, 0xD7, 0xC3, 0xE4, 0x32, 0x25, 0x99, 0x74, 0xC1, 0x31, 0x27, 0x1D, 0x0E, 0x3A, 0x87, 0x1E, 
+0x73, 0x83, 0xA2, 0x53, 0x70, 0x35, 0xC4, 0x5B, 0x85, 0xD6, 0xBC, 0xD2, 0x2E, 0x83, 0x91, 0x2D, 
+0x24, 0x43, 0xB9, 0x77, 0x88, 0x44, 0xBD, 0xAA, 0x48, 0x89, 0xC8, 0x9E, 0x48, 0x96, 0x12, 0x6B, 
+0x21, 0x59, 0xD2, 0x87, 0x2B, 0x38, 0x23, 0x47, 0xF3, 0xCB, 0x27, 0xE0, 0x34, 0x18, 0xA4, 0x5B, 
+0x26, 0x55, 0xB2, 0x7E, 0x7D, 0x74, 0xDE, 0xE4, 0xF7, 0x10, 0xEC, 0x63, 0xB6, 0xE6, 0xF7, 0xA1, 
+0xD0, 0x36, 0xB1, 0xD2, 0x36, 0xDD, 0x91, 0x73, 0xB6, 0x25, 0x93, 0xEF, 0x47, 0x01, 0x26, 0x52, 
+0x78, 0xA6, 0x69, 0x30, 0xE0, 0x95, 0x8E, 0x6C, 0xE9, 0x0F, 0x07, 0xB8, 0xCF, 0xF3, 0x02, 0x16, 
+0x97, 0xAD, 0xF2, 0x88, 0xC1, 0x3D, 0x54, 0x5E, 0x78, 0xC5, 0x05, 0xED, 0x32, 0x21, 0xC2, 0x9B, 
+0x7F, 0xED, 0x80, 0x80, 0xD9, 0x5D, 0xCA, 0xA1, 0x7C, 0x09, 0x5A, 0x92, 0x47, 0xE3, 0xD2, 0x1B, 
+0xE0, 0x66, 0x78, 0x10, 0x48, 0x7B, 0xAB, 0x32, 0xB4, 0x99, 0x93, 0x0F, 0x2C, 0x66, 0x41, 0x5F, 
+0xB4, 0xD2, 0xB7, 0x4A, 0x74, 0x11, 0xFC, 0x33, 0xAE, 0xD6, 0xA6, 0x7E, 0x0C, 0x71, 0x12, 0x6B, 
+0x38, 0xC5, 0xEE, 0x8B, 0xEC, 0x23, 0x5C, 0xF2, 0xCD, 0x64, 0x23, 0xA1, 0xAA, 0x1E, 0x7B, 0xC4, 
+0xEB, 0xA1, 0x0F, 0x3B, 0x18, 0x8A, 0x6D, 0x04, 0x33, 0x3C, 0x62, 0x56, 0x3D, 0x60, 0xEF, 0x69, 
+0x30, 0x96, 0xD6, 0x84, 0x7E, 0xBA, 0xBD, 0x37, 0xCA, 0x1C, 0xDC, 0xD7, 0xE2, 0x8D, 0x6F, 0x1C, 
+0x9E, 0xC1, 0x2B, 0x55, 0x4A, 0x06, 0x09, 0xA0, 0x18, 0xBD, 0xC9, 0xCC, 0xD8, 0x55, 0x8A, 0xD4, 
+0x88, 0x9C, 0xEE, 0xED, 0xC1, 0x70, 0xA2, 0x05, 0x29, 0xC6, 0x56, 0xD0, 0xCC, 0x58, 0xB0, 0xA1, 
+0xCF, 0xE1, 0x5B, 0x6F, 0xF6, 0x1D, 0x8E, 0x68, 0x5B, 0x2E, 0x64, 0xB2, 0x2A, 0x6D, 0x24, 0xBE, 
+0x53, 0x55, 0x68, 0x6A, 0xF4, 0xEC, 0x2E, 0xB9, 0x5C, 0x08, 0xD3, 0x3D, 0x5D, 0xAB, 0x79, 0x23, 
+0x10, 0x26, 0xBA, 0x7E, 0x7E, 0xD7, 0x91, 0xF1, 0x96, 0x0E, 0x49, 0xC5, 0xEE, 0x48, 0x70, 0x27, 
+0x32, 0x8E, 0x55, 0xEF, 0x3A, 0xBF, 0x7C, 0x48, 0x3A, 0x37, 0x71, 0x39, 0xBE, 0x56, 0x5D, 0x88, 
+0xE9, 0x75, 0xFC, 0x11, 0xC5, 0x8A, 0x76, 0x5F, 0xBC, 0x10, 0xF9, 0xF8, 0x49, 0x7E, 0x08, 0x3E, 
+0xAF, 0x72, 0xAD, 0x95, 0x23, 0x1D, 0xB7, 0xE5, 0x69, 0xED, 0xD6, 0x9C, 0x2D, 0x01, 0xFB, 0x57, 
+0xC8, 0xD8, 0x03, 0x65, 0x9B, 0xE3, 0x77, 0xC5, 0x1C, 0x1E, 0xEE, 0xEF, 0x7C, 0xD3, 0x44, 0x9B, 
+0x5D, 0xAF, 0x5F, 0x42, 0x8D, 0x42, 0x16, 0xDC, 0x16, 0xC4, 0x0A, 0x33, 0xDC, 0x09, 0xB4, 0xE8, 
+0xB5, 0xD8, 0x78, 0xF0, 0xA0, 0x7B, 0x17, 0x44, 0x03, 0x8B, 0x6C, 0xD8, 0x67, 0xCE, 0x9C, 0x1C, 
+0xCC, 0x7C, 0x2B, 0x3C, 0xE1, 0x8A, 0xBC, 0x57, 0xAB, 0x5D, 0xED, 0xC3, 0x6B, 0x6E, 0x9F, 0x3B, 
+0x6E, 0x08, 0xD3, 0xD6, 0x57, 0x02, 0x27, 0xB3, 0x3A, 0x72, 0x72, 0x70, 0x5A, 0x1C, 0xB7, 0x57, 
+0x23, 0xF0, 0xD1, 0x05, 0x18, 0x2C, 0x07, 0xEE, 0x1A, 0x30, 0x6E, 0x78, 0xC5, 0x70, 0xC7, 0x96, 
+0x35, 0x79, 0x5F, 0x88, 0x14, 0x3B, 0x45, 0xFD, 0x04, 0x7A, 0x76, 0xD1, 0xD0, 0xBE, 0xDE, 0xCB, 
+0x3A, 0xDD, 0xE2, 0x1A, 0x98, 0xF6, 0x4F, 0xB4, 0x1D, 0xE0, 0xBD, 0x1D, 0xDD, 0xE7, 0x40, 0xA2, 
+0xCC, 0x84, 0x89, 0x55, 0x03, 0xB3, 0x93, 0x2A, 0x46, 0xB4, 0x1D, 0xD8, 0xD3, 0x10, 0x13, 0xED, 
+0xF4, 0xB7, 0xBA, 0xA6, 0xA8, 0xA9, 0xEE, 0x42, 0x76, 0xD2, 0x69, 0x7E, 0xA1, 0x3D, 0x13, 0x5D, 
+0xBC, 0x2A, 0xEF, 0xCB, 0x2B, 0x1C, 0xD1, 0x34, 0x2F, 0xB4, 0x0C, 0x72, 0x93, 0x76, 0x9C, 0xB5, 
+0xC5, 0x3C, 0x60, 0x1C, 0xEA, 0xDB, 0x71, 0x12, 0xA1, 0xC7, 0x79, 0x40, 0xD6, 0x1F, 0xD0, 0xD3, 
+0xA5, 0xC2, 0x8D, 0x26, 0x9D, 0xBA, 0xD3, 0x59, 0xA1, 0x5B, 0x50, 0x5D, 0xDF, 0xE8, 0xE9, 0xB7, 
+0x7C, 0xEA, 0x58, 0x68, 0x44, 0xFF, 0x06, 0xA2, 0xE9, 0x0D, 0xCF, 0x7D, 0xEF, 0x1D, 0xE4, 0x4B, 
+0xB9, 0xAE, 0xEF, 0x5E, 0xE6, 0x85, 0xA2, 0x0F, 0x6F, 0xF0, 0x5F, 0x2C, 0x97, 0xE8, 0xFA, 0x51, 
+0x7D, 0x04, 0xE6, 0x20, 0xFA, 0xCA, 0x64, 0x5F, 0x10, 0x14, 0xEF, 0x98, 0x97, 0x6C, 0xA2, 0xAF, 
+0x74, 0x0C, 0x2A, 0xA0, 0xB0, 0x19, 0x3F, 0xDB, 0xB7, 0x00, 0x03, 0x86, 0xCD, 0xEC, 0xC0, 0xC6, 
+0x7E, 0x29, 0x22, 0x70, 0xD8, 0xA8, 0x74, 0x29, 0x17, 0x89, 0x88, 0xF5, 0x7C, 0xC5, 0x62, 0x42, 
+0xC8, 0xF4, 0x07, 0xF3, 0x4B, 0x85, 0x90, 0xB9, 0xB5, 0x48, 0xD1, 0xC4, 0xB6, 0x15, 0xE9, 0xDC, 
+0x50, 0xFF, 0x5D, 0x25, 0x94, 0x52, 0xFF, 0x52, 0x29, 0xC5, 0x45, 0xF6, 0xFD, 0x43, 0x8A, 0x43, 
+0x85, 0x69, 0xCE, 0x1D, 0xC3, 0xEF, 0xFA, 0x04, 0x72, 0x6B, 0x35, 0x2A, 0x06, 0xCA, 0x68, 0xE1, 
+0x72, 0xE1, 0xD1, 0xA7, 0x52, 0xF5, 0x05, 0x55, 0x7B, 0xD5, 0x5C, 0x93, 0x5B, 0x61, 0x47, 0x3E, 
+0x81, 0xBF, 0xC9, 0xF2, 0x98, 0xC4, 0x6D, 0x3E, 0x94, 0xA4, 0x5A, 0xF2, 0xE9, 0x8C, 0x99, 0x4B, 
+0x3F, 0x04, 0xDF, 0x4A, 0x22, 0x9C, 0x20, 0xFD, 0xB8, 0xFE, 0x4C, 0x79, 0x42, 0x35, 0x91, 0x2B, 
+0x7D, 0xAD, 0xD2, 0x53, 0x25, 0x7E, 0xB6, 0x3C, 0x52, 0xCA, 0x05, 0x44, 0xB6, 0xC2, 0x69, 0x25, 
+0xBA, 0xE0, 0x96, 0xED, 0x4A, 0xB7, 0xBF, 0x7D, 0x52, 0xCE, 0x4A, 0xC6, 0x30, 0x16, 0xAC, 0x0B, 
+0x2B, 0x18, 0xFA, 0x2E, 0x1F, 0x04, 0xDA, 0x1A, 0x05, 0xB5, 0x60, 0xC9, 0x27, 0xD1, 0xE6, 0x7E, 
+0xBA, 0xC8, 0xD9, 0x75, 0xD6, 0xDC, 0xA1, 0xC0, 0xCA, 0xF9, 0xFB, 0x73, 0x5A, 0x2D, 0x07, 0x45, 
+0xB3, 0x14, 0xBF, 0x7D, 0xF6, 0x98, 0xBD, 0x16, 0xB6, 0x4D, 0x2D, 0x89, 0x3E, 0xA6, 0x47, 0x60, 
+0x3A, 0x2B, 0xEF, 0x95, 0x33, 0x37, 0xB6, 0xF7, 0xF3, 0xD5, 0x7D, 0x86, 0xD3, 0x91, 0x1A, 0x7C, 
+0x63, 0x7E, 0x9E, 0x3F, 0xB1, 0x00, 0xD2, 0xDA, 0x20, 0x2C, 0x99, 0xDF, 0xE3, 0x1D, 0x93, 0xF0, 
+0x17, 0xF1, 0x3D, 0x76, 0xA6, 0xAB, 0xF3, 0x4B, 0xF0, 0x67, 0xBC, 0x41, 0x4C, 0x3A, 0x26, 0x75, 
+0x4D, 0xDF, 0x80, 0xDC, 0x86, 0x92, 0xB7, 0x07, 0x92, 0x90, 0xFA, 0x85, 0xC9, 0x4C, 0x43, 0x82, 
+0x4B, 0xB5, 0xBE, 0xF1, 0x5A, 0x9F, 0x7D, 0x43, 0xD6, 0xF5, 0x84, 0xCB, 0x86, 0x7B, 0xEE, 0xD1, 
+0x4B, 0xD8, 0xE1, 0x7D, 0x79, 0x8E, 0x0D, 0x83, 0xEF, 0xC7, 0x7E, 0x9E, 0x63, 0x97, 0x4B, 0xFD, 
+0xFC, 0xE4, 0xC5, 0xA4, 0x05, 0x3D, 0xFF, 0x30, 0x34, 0x56, 0x0F, 0x2F, 0xD8, 0x21, 0xDD, 0xA4, 
+0xD7, 0xC4, 0xF5, 0x79, 0xBB, 0x96, 0xE2, 0x40, 0xF4, 0x97, 0xA2, 0x3D, 0xFC, 0x41, 0xD7, 0xF3, 
+0xB1, 0x51, 0xEB, 0xC4, 0xD1, 0x97, 0xE8, 0xDD, 0xFE, 0x06, 0xE1, 0x5D, 0x22, 0x2E, 0xEB, 0x78, 
+0xAE, 0x2A, 0x27, 0xB5, 0x35, 0xAD, 0xBE, 0x0E, 0x8F, 0x31, 0xB8, 0xCB, 0xEA, 0xB6, 0x5D, 0xE0, 
+0x6D, 0x6B, 0xF4, 0x67, 0xC3, 0x53, 0xE5, 0x38, 0xB3, 0x76, 0x1A, 0xA9, 0xAA, 0xAB, 0x05, 0xD4, 
+0xBC, 0x85, 0x53, 0xB3, 0x67, 0x12, 0x19, 0x4B, 0xAD, 0x75, 0xC0, 0x71, 0x0B, 0x3F, 0xD7, 0xF5, 
+0x00, 0xF7, 0x38, 0x50, 0x7C, 0xAA, 0xD5, 0xE8, 0xD7, 0x7F, 0x07, 0xEA, 0x7B, 0x99, 0xF6, 0x99, 
+0x75, 0xF8, 0xF2, 0x22, 0x0F, 0x1E, 0x39, 0x1C, 0x57, 0x36, 0xEC, 0x9A, 0xBE, 0xE1, 0xC7, 0x2D, 
+0x86, 0xF4, 0x8A, 0x56, 0x55, 0x9C, 0x52, 0x3B, 0x0D, 0xFC, 0x0C, 0x95, 0x73, 0x3E, 0x32, 0xD6, 
+0xD5, 0x86, 0x91, 0x59, 0xA9, 0xDD, 0x06, 0xB6, 0xB5, 0xFC, 0x09, 0x67, 0x9E, 0x81, 0x58, 0x52, 
+0x1E, 0xD4, 0xCF, 0xF2, 0xFD, 0x15, 0xB5, 0x7F, 0xD7, 0xFE, 0x8D, 0x2F, 0xBC, 0x3B, 0x3C, 0x35, 
+0xF7, 0x20, 0xB0, 0xAE, 0xAC, 0x10, 0xFD, 0xB1, 0x9E, 0x29, 0xAF, 0xB5, 0x22, 0x2B, 0x9A, 0x35, 
+0xEE, 0xDA, 0x2D, 0x25, 0xF3, 0x22, 0xD5, 0x11, 0x8B, 0xB5, 0x26, 0xF9, 0x14, 0xD2, 0xA5, 0x31, 
+0x03, 0x82, 0x41, 0x4A, 0x3D, 0xB5, 0xDE, 0x1D, 0x43, 0x23, 0xB3, 0x98, 0x30, 0x5A, 0x5C, 0xFB, 
+0x68, 0xC8, 0xC1, 0xFC, 0xDF, 0xB9, 0x28, 0x6A, 0xF7, 0x7A, 0x75, 0x2D, 0xD9, 0x01, 0xAF, 0xF2, 
+0xF6, 0x32, 0x76, 0x0A, 0x91, 0x58, 0x76, 0x03, 0x26, 0x9D, 0x7B, 0x12, 0x65, 0x79, 0x71, 0xF0, 
+0x21, 0xCA, 0x66, 0x78, 0xD2, 0x91, 0x5B, 0x30, 0xA4, 0x58, 0x6D, 0xA1, 0xB1, 0x21, 0xB7, 0x25, 
+0xCC, 0xC0, 0x5D, 0x1C, 0x28, 0xE8, 0xDB, 0x4C, 0x6A, 0xE9, 0x61, 0x61, 0xFE, 0x42, 0xFC, 0xBB, 
+0xCB, 0xFD, 0xE8, 0xE6, 0x5D, 0xFF, 0xFF, 0x3E, 0x79, 0xD4, 0x31, 0xF0, 0xDB, 0x5D, 0xEC, 0x08, 
+0xF3, 0xEE, 0xBD, 0x10, 0x80, 0x93, 0x40, 0x50, 0x68, 0xA2, 0x84, 0xFA, 0x2E, 0x79, 0xF5, 0x26, 
+0xDC, 0x79, 0xED, 0x05, 0x77, 0x3B, 0x01, 0x63, 0x1F, 0xC8, 0xAA, 0x6A, 0x59, 0x68, 0xA6, 0x3A, 
+0x18, 0x1C, 0x45, 0xEB, 0x7A, 0x29, 0xBE, 0x4E, 0xCF, 0x45, 0x02, 0xBF, 0xC8, 0x22, 0x12, 0x24, 
+0xD2, 0x7B, 0x39, 0xAC, 0x14, 0x59, 0x22, 0xED, 0xAB, 0x65, 0x41, 0x3B, 0xC9, 0x85, 0x42, 0xBE, 
+0x14, 0xCD, 0xCB, 0x03, 0x64, 0x06, 0xCC, 0xA0, 0xA3, 0x50, 0x05, 0x3C, 0x76, 0x70, 0x72, 0x65, 
+0xCC, 0x00, 0x0F, 0x78, 0x54, 0xBD, 0x2A, 0x17, 0x4D, 0xEF, 0xAD, 0x77, 0x2C, 0x0C, 0x9D, 0xB8, 
+0xB4, 0x11, 0x35, 0x5D, 0x63, 0xFC, 0x5C, 0x35, 0x2E, 0x0A, 0x46, 0x24, 0x74, 0x02, 0x77, 0xE3, 
+0xE6, 0x32, 0x94, 0x9C, 0xE9, 0x1C, 0x4B, 0x90, 0xEE, 0x04, 0xFC, 0xA1, 0x6F, 0x2D, 0xE3, 0xC2, 
+0xD4, 0x8F, 0x83, 0x3A, 0xDB, 0x68, 0xA2, 0xCB, 0xCA, 0xA5, 0x30, 0x39, 0x10, 0xDF, 0x58, 0xEF, 
+0xC8, 0xA4, 0x8E, 0xE2, 0xBA, 0x5C, 0xC2, 0x88, 0x2C, 0x97, 0x5F, 0xE0, 0x94, 0x77, 0x86, 0x21, 
+0x16, 0x2D, 0xC0, 0x00, 0xB1, 0x99, 0x21, 0xA2, 0xBD, 0x84, 0x9C, 0x8D, 0xAC, 0x07, 0xBF, 0xFC, 
+0x52, 0x0A, 0xF7, 0x0F, 0xDF, 0xBE, 0x0A, 0xC5, 0xE9, 0xBB, 0x12, 0x44, 0x8C, 0xFA, 0x11, 0x52, 
+0xEA, 0x4E, 0x3C, 0x64, 0x43, 0xCF, 0xBB, 0x15, 0x05, 0xE2, 0xB8, 0x5B, 0x36, 0x56, 0x83, 0x74, 
+0x19, 0x41, 0x39, 0x3E, 0xAF, 0x5A, 0x88, 0xA5, 0x45, 0xAA, 0x84, 0xBC, 0x99, 0xA0, 0xB2, 0x51, 
+0x1C, 0xE1, 0xB8, 0x0D, 0x94, 0xD2, 0xB4, 0x45, 0x3E, 0x92, 0xAD, 0x6C, 0xCA, 0xDF, 0x4C, 0x65, 
+0x8D, 0x43, 0x96, 0x47, 0x19, 0x01, 0x1B, 0x2D, 0xA2, 0xF1, 0xB5, 0x1A, 0x4E, 0x8E, 0x08, 0xF9, 
+0x40, 0x73, 0x4E, 0x15, 0x03, 0x2F, 0xEE, 0x9C, 0x55, 0xE8, 0xB8, 0x23, 0x9C, 0x16, 0xD2, 0x16, 
+0x8F, 0x30, 0x78, 0xE6, 0x13, 0x2D, 0x79, 0xF7, 0x50, 0x6B, 0xEF, 0x82, 0x26, 0x2B, 0x0C, 0x54, 
+0x93, 0xA9, 0xE1, 0x38, 0x60, 0x38, 0xF9, 0x5E, 0xDB, 0x0A, 0xAE, 0x03, 0xE9, 0x02, 0xF1, 0x40, 
+0x21, 0x1A, 0x4B, 0x57, 0xEE, 0x12, 0x2A, 0x5A, 0x2B, 0xA5, 0xA3, 0xDA, 0x04, 0xB3, 0x41, 0x94, 
+0x5C, 0xBD, 0xA2, 0x71, 0xF1, 0x47, 0x53, 0x6C, 0xD6, 0xA6, 0x5C, 0x62, 0x53, 0xCD, 0x4E, 0xF3, 
+0x6A, 0xD5, 0xE5, 0x37, 0x65, 0x2D, 0xBF, 0xD5, 0x82, 0x55, 0x95, 0x32, 0xDF, 0x6A, 0x0E, 0x02, 
+0x4E, 0x63, 0xA7, 0xFA, 0xA1, 0x72, 0x9C, 0x5C, 0x2C, 0xF5, 0x5D, 0xE0, 0x3B, 0x2C, 0x13, 0xB5, 
+0x31, 0xAA, 0xE7, 0x81, 0x2D, 0x0A, 0xEB, 0xC3, 0x2E, 0x64, 0x79, 0x67, 0x81, 0x6C, 0xE3, 0x2B, 
+0x2B, 0x36, 0x08, 0x75, 0x34, 0x72, 0xD4, 0x27, 0xEA, 0x5D, 0xC0, 0xB3, 0x2C, 0x46, 0x4C, 0x8F, 
+0xF7, 0xC0, 0xD8, 0x01, 0x90, 0x62, 0xCD, 0xEB, 0x6C, 0x68, 0xCC, 0x52, 0x5B, 0xD3, 0x6E, 0x76, 
+0xBA, 0xB5, 0x0D, 0xAB, 0xDB, 0x19, 0x31, 0x44, 0x07, 0xB0, 0x20, 0x42, 0x0B, 0x73, 0x4E, 0x35, 
+0x66, 0x6F, 0x09, 0xC8, 0xC5, 0xB9, 0x77, 0xEC, 0xF1, 0x16, 0x81, 0x44, 0x36, 0xF5, 0xA3, 0x9A, 
+0x7D, 0xFB, 0xDB, 0x39, 0x36, 0xE6, 0x72, 0x63, 0x24, 0x4E, 0x66, 0x3A, 0x7F, 0xB8, 0x83, 0x62, 
+0x1F, 0x4B, 0xB2, 0x0D, 0x04, 0xD5, 0x76, 0x18, 0x3C, 0x62, 0xFA, 0x16, 0xBA, 0x0E, 0x43, 0x6B, 
+0x2B, 0x19, 0x27, 0xE2, 0xCF, 0xB1, 0x14, 0x55, 0xE7, 0x4B, 0xEE, 0xCA, 0x39, 0x9E, 0xF6, 0x8E, 
+0x61, 0x62, 0x62, 0x2B, 0xAB, 0xE4, 0x09, 0xAB, 0xF7, 0x0C, 0x66, 0xD3, 0xEA, 0xF8, 0x08, 0xB5, 
+0xF0, 0x4D, 0xA7, 0x20, 0xCF, 0x3F, 0x2C, 0xC0, 0x68, 0x77, 0x47, 0x06, 0x65, 0x6B, 0x0E, 0x51, 
+0x26, 0x8B, 0xF9, 0x8B, 0xAD, 0x06, 0x76, 0x4A, 0x5C, 0x00, 0x00
+};
+
+const size_t view_js_len = 7159;
+const size_t view_js_br_len = 6186;
+const size_t view_js_size = 25728; // Uncompressed
+const char view_js_hash[] = "83d24673";
+
+#endif
@@ -1,263 +1,1186 @@
-#include "web_server.h"
-#include "index_html.h"
-#include "login_html.h"
-#include "style_css.h"
-#include "script_js.h"
-#include "chart_js.h"
-#include "config_html.h"
-#include "view_html.h"
-#include "view_js.h"
-
-WebServer server(80);
-
-void handleRoot() {
-    // Serve login.html at root for initial authentication
-    server.sendHeader("Content-Encoding", "gzip");
-    server.send_P(200, "text/html", login_html);
-}
-
-void handleInit() {
-    // Serve index.html 
-    server.sendHeader("Content-Encoding", "gzip");
-    server.send_P(200, "text/html", index_html);
-}
-
-void handleView() {
-    // Serve view.html
-    server.sendHeader("Content-Encoding", "gzip");
-    server.send_P(200, "text/html", view_html);
-}
-
-void handleStyle() {
-    server.sendHeader("Cache-Control", "public, max-age=31536000");
-    server.sendHeader("Content-Encoding", "gzip");
-    server.send_P(200, "text/css", style_css);
-}
-
-void handleScript() {
-    server.sendHeader("Cache-Control", "public, max-age=31536000");
-    server.sendHeader("Content-Encoding", "gzip");
-    server.send_P(200, "application/javascript", script_js);
-}
-
-void handleViewScript() {
-    server.sendHeader("Cache-Control", "public, max-age=31536000");
-    server.sendHeader("Content-Encoding", "gzip");
-    server.send_P(200, "application/javascript", view_js);
-}
-
-void handleChartLib() {
-    server.sendHeader("Cache-Control", "public, max-age=31536000");
-    server.sendHeader("Content-Encoding", "gzip");
-    server.send_P(200, "application/javascript", chart_js);
-}
-
-void handleConfig() {
-    server.sendHeader("Content-Encoding", "gzip");
-    server.send_P(200, "text/html", config_html);
-}
-
-void handleData() {
-    SystemData data = getSystemData();
-    DynamicJsonDocument doc(16384); // Increased buffer to 16KB for 100 history records
-
-    // Current Data
-    doc["temp"] = data.ambientTemp;
-    doc["humidity"] = data.ambientHumidity;
-    doc["soilTemp"] = data.soilTemp;
-    doc["soilMoisture"] = data.soilMoisture;
-    doc["soilRaw"] = data.soilRaw;     // New
-    doc["tankLevel"] = data.tankLevel;
-    doc["tankDistance"] = data.tankDistance; // New
-    doc["light"] = data.lightLevel;
-    doc["lightRaw"] = data.lightRaw;   // New
-    doc["motion"] = data.motionDetected;
-    doc["pump"] = data.pumpActive;
-    doc["tankPump"] = data.tankPumpActive;
-    doc["status"] = data.status;
-    doc["security"] = getSecurityMode();
-    doc["securityAuto"] = getSecurityAuto();
-    doc["irrigationAuto"] = getIrrigationAuto();
-    doc["tankAuto"] = getTankAuto();
-    doc["luminaryAuto"] = getLuminaryAuto();
-    doc["luminary"] = getLuminaryMode();
-    doc["securityStart"] = getSecurityStartTime();
-    doc["securityEnd"] = getSecurityEndTime();
-    
-    // Configuration Data
-    JsonObject config = doc.createNestedObject("config");
-    config["soilDry"] = SOIL_DRY;
-    config["soilWet"] = SOIL_WET;
-    config["soilThreshold"] = SOIL_MOISTURE_THRESHOLD;
-    config["tankEmpty"] = TANK_DEPTH_CM;
-    config["tankFull"] = TANK_MIN_DISTANCE;
-    config["tankCritical"] = TANK_CRITICAL_LEVEL;
-    config["lightMin"] = LIGHT_MIN_RAW;
-    config["lightMax"] = LIGHT_MAX_RAW;
-    config["lightLow"] = LIGHT_THRESHOLD_LOW;
-    config["lightHigh"] = LIGHT_THRESHOLD_HIGH;
-    config["dataSendInterval"] = DATA_SEND_INTERVAL_MIN;
-    config["serverPollingInterval"] = SERVER_POLLING_INTERVAL_SEC;
-    config["statusPollingInterval"] = STATUS_POLLING_INTERVAL_SEC;
-    
-    doc["lastMeasurementTime"] = data.lastMeasurementTime; // Timestamp relative to boot
-
-    // History Data
-    JsonArray historyArray = doc.createNestedArray("history");
-    for (const auto& record : history) {
-        JsonObject h = historyArray.createNestedObject();
-        h["temp"] = record.ambientTemp;
-        h["humidity"] = record.ambientHumidity;
-        h["soil"] = record.soilMoisture;
-        h["tank"] = record.tankLevel;
-        h["light"] = record.lightLevel;
-        h["timestamp"] = record.timestamp;
-    }
-
-    String json;
-    serializeJson(doc, json);
-    
-    Serial.println("\n=== ENVIANDO DATOS A WEB ===");
-    Serial.print("Puntos en historial: "); Serial.println(history.size());
-    Serial.print("Tamano JSON: "); Serial.print(json.length()); Serial.println(" bytes");
-    Serial.print("lastMeasurementTime: "); Serial.println(data.lastMeasurementTime);
-    if (history.size() > 0) {
-        Serial.print("Primer punto timestamp: "); Serial.println(history[0].timestamp);
-        Serial.print("Ultimo punto timestamp: "); Serial.println(history[history.size()-1].timestamp);
-    }
-    
-    // Log timing for debugging latency
-    Serial.print("Tiempo actual (millis): "); Serial.println(millis());
-    Serial.print("Diferencia desde medicion: "); Serial.print(millis() - data.lastMeasurementTime); Serial.println(" ms");
-    
-    server.send(200, "application/json", json);
-}
-
-void handleStatus() {
-    SystemData data = getSystemData();
-    DynamicJsonDocument doc(512);
-    
-    doc["pump"] = data.pumpActive;
-    doc["tankPump"] = data.tankPumpActive;
-    doc["security"] = getSecurityMode();
-    doc["luminary"] = getLuminaryMode();
-    doc["irrigationAuto"] = getIrrigationAuto();
-    doc["tankAuto"] = getTankAuto();
-    doc["securityAuto"] = getSecurityAuto();
-    doc["luminaryAuto"] = getLuminaryAuto();
-    doc["securityStart"] = getSecurityStartTime();
-    doc["securityEnd"] = getSecurityEndTime();
-    doc["status"] = data.status;
-    
-    String json;
-    serializeJson(doc, json);
-    server.send(200, "application/json", json);
-}
-
-void handleAction() {
-    if (server.hasArg("plain")) {
-        String body = server.arg("plain");
-        DynamicJsonDocument doc(1024);
-        DeserializationError error = deserializeJson(doc, body);
-        
-        if (error) {
-            server.send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
-            return;
-        }
-        
-        // Handle irrigation actions
-        // Handle irrigation actions
-        if (doc.containsKey("irrigationAuto")) {
-            setIrrigationAuto(doc["irrigationAuto"]);
-        }
-        if (doc.containsKey("forceIrrigation")) {
-            int duration = 0;
-            if (doc.containsKey("duration")) {
-                duration = doc["duration"];
-            }
-            setIrrigationManual(doc["forceIrrigation"], duration);
-        }
-        
-        // Handle configuration updates
-        if (doc.containsKey("config")) {
-            JsonObject config = doc["config"];
-            
-            if (config.containsKey("soilDry")) SOIL_DRY = config["soilDry"];
-            if (config.containsKey("soilWet")) SOIL_WET = config["soilWet"];
-            if (config.containsKey("soilThreshold")) SOIL_MOISTURE_THRESHOLD = config["soilThreshold"];
-            
-            if (config.containsKey("tankEmpty")) TANK_DEPTH_CM = config["tankEmpty"];
-            if (config.containsKey("tankFull")) TANK_MIN_DISTANCE = config["tankFull"];
-            if (config.containsKey("tankCritical")) TANK_CRITICAL_LEVEL = config["tankCritical"];
-            
-            if (config.containsKey("lightMin")) LIGHT_MIN_RAW = config["lightMin"];
-            if (config.containsKey("lightMax")) LIGHT_MAX_RAW = config["lightMax"];
-            if (config.containsKey("lightLow")) LIGHT_THRESHOLD_LOW = config["lightLow"];
-            if (config.containsKey("lightHigh")) LIGHT_THRESHOLD_HIGH = config["lightHigh"];
-            
-            if (config.containsKey("dataSendInterval")) DATA_SEND_INTERVAL_MIN = config["dataSendInterval"];
-            if (config.containsKey("serverPollingInterval")) SERVER_POLLING_INTERVAL_SEC = config["serverPollingInterval"];
-            if (config.containsKey("statusPollingInterval")) STATUS_POLLING_INTERVAL_SEC = config["statusPollingInterval"];
-            
-            Serial.println("[CONFIG] Configuration updated from web");
-        }
-        
-        // Handle tank actions
-        if (doc.containsKey("tankAuto")) {
-            setTankAuto(doc["tankAuto"]);
-        }
-        if (doc.containsKey("forceTank")) {
-            setTankManual(doc["forceTank"]);
-        }
-        
-        // Handle security actions
-        if (doc.containsKey("securityAuto")) {
-            setSecurityAuto(doc["securityAuto"]);
-        }
-        if (doc.containsKey("security")) {
-            setSecurityManual(doc["security"]);
-        }
-        if (doc.containsKey("securityStart") && doc.containsKey("securityEnd")) {
-            setSecuritySchedule(doc["securityStart"], doc["securityEnd"]);
-        }
-        if (doc.containsKey("clearAlarm")) {
-            clearAlarm();
-        }
-        
-        // Handle luminary actions
-        if (doc.containsKey("luminaryAuto")) {
-            setLuminaryAuto(doc["luminaryAuto"]);
-        }
-        if (doc.containsKey("forceLuminary")) {
-            setLuminaryManual(doc["forceLuminary"]);
-        }
-        
-        server.send(200, "application/json", "{\"success\":true}");
-    } else {
-        server.send(400, "application/json", "{\"error\":\"No body\"}");
-    }
-}
-
-void setupWebServer() {
-    Serial.println("Iniciando servidor web...");
-    
-    server.on("/", HTTP_GET, handleRoot);
-    server.on("/login.html", HTTP_GET, handleRoot);
-    server.on("/index.html", HTTP_GET, handleInit);
-    server.on("/config.html", HTTP_GET, handleConfig);
-    server.on("/style.css", HTTP_GET, handleStyle);
-    server.on("/script.js", HTTP_GET, handleScript);
-    server.on("/view.html", HTTP_GET, handleView);
-    server.on("/view.js", HTTP_GET, handleViewScript);
-    server.on("/chart.js", HTTP_GET, handleChartLib);
-    server.on("/data", HTTP_GET, handleData);
-    server.on("/status", HTTP_GET, handleStatus);
-    server.on("/action", HTTP_POST, handleAction);
-
-    server.begin();
-    Serial.println("HTTP server started");
-}
-
-void handleClient() {
-    server.handleClient();
-}
+#include "web_server.h"
+#include "web_assets.h" // Generated: node tools/build_assets.js
+#include "json_stream.h"
+#include "metrics.h"
+#include "history_binary.h"
+#include "action_parser.h"
+#include "profiler.h"
+#include "logger.h"
+#include "heap_monitor.h"
+#include "hal.h"
+#include <esp32/rom/miniz.h>
+#include <lwip/sockets.h>
+#include <errno.h>
+
+#ifndef HTTP_PORT
+#define HTTP_PORT 80 // The host build serves on 8080
+#endif
+
+HttpServer server(HTTP_PORT);
+
+// Random per boot so an ETag from before a reset never matches a new state
+uint32_t bootId = 0;
+
+// ==========================================
+// State Snapshot
+// ==========================================
+// Handlers copy what they serve under the state lock, then render and send
+// from the copy after unlockState(). A socket write can wait on a slow
+// client for up to HTTP_SEND_TIMEOUT_MS; it must never do so while loop()
+// is waiting for the lock to run automation and the pump timeout. Only the
+// server task uses the copy.
+struct StateView {
+    unsigned long version;
+    unsigned long configVersion;
+    SystemData data;
+    bool security, securityAuto, irrigationAuto, tankAuto, luminaryAuto, luminary;
+    char securityStart[6];
+    char securityEnd[6];
+    SensorStats diag[SENSOR_CHANNEL_COUNT];
+    HistoryRing history;
+};
+StateView view;
+
+// Just the versions: enough to answer a revalidation or serve the /data
+// cache, without copying the history ring
+void captureVersions() {
+    lockState();
+    view.version = getStateVersion();
+    view.configVersion = getConfigVersion();
+    unlockState();
+}
+
+void captureState() {
+    lockState();
+    view.version = getStateVersion();
+    view.configVersion = getConfigVersion();
+    view.data = getSystemData();
+    view.security = getSecurityMode();
+    view.securityAuto = getSecurityAuto();
+    view.irrigationAuto = getIrrigationAuto();
+    view.tankAuto = getTankAuto();
+    view.luminaryAuto = getLuminaryAuto();
+    view.luminary = getLuminaryMode();
+    snprintf(view.securityStart, sizeof(view.securityStart), "%s", getSecurityStartTime());
+    snprintf(view.securityEnd, sizeof(view.securityEnd), "%s", getSecurityEndTime());
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) view.diag[i] = getSensorStats((SensorChannel)i);
+    view.history = history; // MAX_HISTORY records, a plain copy
+    unlockState();
+}
+
+const size_t ETAG_SIZE = 48;
+
+// variant tells apart representations of the same state (see /history)
+const char* stateEtag(char* etag, const char* variant = "") {
+    snprintf(etag, ETAG_SIZE, "\"%lx-%lu%s\"", (unsigned long)bootId, view.version, variant);
+    return etag;
+}
+
+const char* configEtag(char* etag) {
+    snprintf(etag, ETAG_SIZE, "\"%lx-c%lu\"", (unsigned long)bootId, view.configVersion);
+    return etag;
+}
+
+void sendValidators(const char* etag) {
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", "no-cache");
+}
+
+// Conditional GET, checked after captureVersions() and before anything else
+// is copied: answers 304 when the client already holds the current version.
+// Returns true if a reply was sent; otherwise the handler captures what it
+// serves and calls sendValidators() with the version it rendered, which can
+// only be the same or newer.
+bool sendNotModified(const char* etag) {
+    if (strcmp(server.headerValue("If-None-Match"), etag) != 0) return false;
+    sendValidators(etag);
+    server.send(304);
+    return true;
+}
+
+// ==========================================
+// Static Assets
+// ==========================================
+// Every asset is stored twice, brotli and gzip; the smallest one the client
+// accepts goes out. Clients that accept neither get the gzip copy inflated
+// on the fly.
+
+// True if an Accept or Accept-Encoding header lists the token (or "*")
+// without q=0
+bool headerAccepts(const char* header, const char* coding) {
+    const char* p = header;
+    size_t codingLength = strlen(coding);
+    while (*p) {
+        while (*p == ' ' || *p == ',') p++;
+        const char* token = p;
+        while (*p && *p != ',' && *p != ';' && *p != ' ') p++;
+        size_t tokenLength = p - token;
+
+        bool refused = false;
+        while (*p && *p != ',') {
+            if (*p == 'q' && p[1] == '=') refused = atof(p + 2) == 0.0;
+            p++;
+        }
+
+        bool matches = (tokenLength == codingLength && strncasecmp(token, coding, codingLength) == 0) ||
+                       (tokenLength == 1 && *token == '*');
+        if (matches) return !refused;
+    }
+    return false;
+}
+
+// Identity fallback: inflates the gzip copy with the ROM inflater into a
+// 32 KB window. The body is sent a piece at a time, and each piece inflates
+// again from the start and skips what already went out: the memory is only
+// held while a piece is produced, and a client that leaves mid-download
+// leaves nothing allocated. Nothing sends this header today except scripts
+// and old tools, so the memory and the repeated work are only spent then.
+void sendInflated(const WebAsset& asset) {
+    const WebAsset* source = &asset;
+    size_t sent = 0;
+    server.sendStream(200, asset.contentType, [source, sent](Print& out, size_t room) mutable {
+        HeapExempt inflate;
+        tinfl_decompressor* inflator = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+        uint8_t* window = (uint8_t*)malloc(TINFL_LZ_DICT_SIZE);
+        if (!inflator || !window) {
+            free(inflator);
+            free(window);
+            LOG_ERROR("HTTP", "Out of memory inflating %s", source->path);
+            return true; // An empty piece: the server drops the connection mid-body
+        }
+
+        // Raw deflate stream between the 10-byte gzip header and 8-byte trailer
+        const uint8_t* in = (const uint8_t*)source->gzip + 10;
+        size_t inRemaining = source->gzipLength - 18;
+        size_t outPos = 0;
+        size_t produced = 0; // Body offset of window + outPos
+        bool finished = false;
+        tinfl_init(inflator);
+        while (true) {
+            size_t inBytes = inRemaining;
+            size_t outBytes = TINFL_LZ_DICT_SIZE - outPos;
+            tinfl_status status = tinfl_decompress(inflator, in, &inBytes, window, window + outPos, &outBytes, 0);
+            in += inBytes;
+            inRemaining -= inBytes;
+
+            size_t end = produced + outBytes;
+            if (sent < end) {
+                size_t take = end - sent < room ? end - sent : room;
+                out.write(window + outPos + (sent - produced), take);
+                sent += take;
+                room -= take;
+            }
+            produced = end;
+            outPos = (outPos + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+            if (status <= TINFL_STATUS_DONE) { // Done, or corrupt and dropped like above
+                finished = status == TINFL_STATUS_DONE && sent == produced;
+                break;
+            }
+            if (room == 0) break;
+        }
+
+        free(window);
+        free(inflator);
+        return !finished;
+    });
+}
+
+// Versioned URLs change with the content, so they never need revalidating.
+// Pages and the old unversioned URLs revalidate every time: one 304 round
+// trip when nothing changed.
+const char* CACHE_IMMUTABLE = "public, max-age=31536000, immutable";
+const char* CACHE_REVALIDATE = "no-cache";
+
+void sendAsset(const WebAsset& asset, const char* cacheControl) {
+    const char* accept = server.headerValue("Accept-Encoding");
+    bool brotli = headerAccepts(accept, "br");
+    bool gzip = !brotli && headerAccepts(accept, "gzip");
+
+    // Strong ETag from the content hash, one per encoding
+    char etag[ETAG_SIZE];
+    snprintf(etag, sizeof(etag), "\"%s%s\"", asset.hash, brotli ? "-br" : gzip ? "-gz" : "");
+    server.sendHeader("Cache-Control", cacheControl);
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Vary", "Accept-Encoding");
+    if (strstr(server.headerValue("If-None-Match"), etag)) {
+        server.send(304);
+        return;
+    }
+
+    if (brotli) {
+        server.sendHeader("Content-Encoding", "br");
+        server.send_P(200, asset.contentType, asset.brotli, asset.brotliLength);
+    } else if (gzip) {
+        server.sendHeader("Content-Encoding", "gzip");
+        server.send_P(200, asset.contentType, asset.gzip, asset.gzipLength);
+    } else {
+        sendInflated(asset);
+    }
+}
+
+// HTML entry points served; /metrics divides handshakes by this
+unsigned long pageLoads = 0;
+// Event streams closed for falling a whole backlog behind (see pushEvents)
+unsigned long eventStreamsDropped = 0;
+
+void handleRoot() {
+    // Serve login.html at root for initial authentication
+    pageLoads++;
+    sendAsset(ASSET_LOGIN_HTML, CACHE_REVALIDATE);
+}
+
+void handleInit() {
+    // Serve index.html 
+    pageLoads++;
+    sendAsset(ASSET_INDEX_HTML, CACHE_REVALIDATE);
+}
+
+void handleView() {
+    // Serve view.html
+    pageLoads++;
+    sendAsset(ASSET_VIEW_HTML, CACHE_REVALIDATE);
+}
+
+void handleConfig() {
+    pageLoads++;
+    sendAsset(ASSET_CONFIG_HTML, CACHE_REVALIDATE);
+}
+
+// Unversioned names, for pages cached before an update
+void handleStyle() {
+    sendAsset(ASSET_STYLE_CSS, CACHE_REVALIDATE);
+}
+
+void handleScript() {
+    sendAsset(ASSET_SCRIPT_JS, CACHE_REVALIDATE);
+}
+
+void handleViewScript() {
+    sendAsset(ASSET_VIEW_JS, CACHE_REVALIDATE);
+}
+
+void handleChartLib() {
+    sendAsset(ASSET_CHART_JS, CACHE_REVALIDATE);
+}
+
+// History Data, streamed straight from the buffer. firstRecord > 0 makes
+// this a delta that only carries the newer part of the history ring; the
+// client appends it to what it already has.
+void writeHistoryJson(JsonStreamWriter& json, size_t firstRecord, bool delta) {
+    json.field("historyDelta", delta);        // false: replace, true: append
+    if (delta) json.field("since", view.history[firstRecord - 1].timestamp); // Delta base
+    json.field("historySize", (unsigned long)view.history.size()); // Client trims to this
+    json.beginArray("history");
+    for (size_t i = firstRecord; i < view.history.size(); ++i) {
+        const SystemData& record = view.history[i];
+        json.beginObject();
+        json.field("temp", record.ambientTemp);
+        json.field("humidity", record.ambientHumidity);
+        json.field("soil", record.soilMoisture);
+        json.field("tank", record.tankLevel);
+        json.field("light", record.lightLevel);
+        json.field("timestamp", record.timestamp);
+        json.field("heapFree", (unsigned long)record.freeHeap);
+        json.field("heapBlock", (unsigned long)record.largestBlock);
+        json.endObject();
+    }
+    json.endArray();
+}
+
+// "diag": per sensor channel, keyed like its /data field,
+// [reads, failed reads, samples taken, samples kept, last read ms].
+// Counts only move in publishMeasurement(), under the same lock as the
+// readings that bump the state version, so a cached /data is never stale.
+void writeSensorDiagJson(JsonStreamWriter& json) {
+    json.beginObject("diag");
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) {
+        const SensorStats& stats = view.diag[i];
+        json.beginArray(sensorChannelName((SensorChannel)i));
+        json.field(nullptr, stats.reads);
+        json.field(nullptr, stats.failures);
+        json.field(nullptr, stats.samples);
+        json.field(nullptr, stats.valid);
+        json.field(nullptr, stats.lastUs / 1000);
+        json.endArray();
+    }
+    json.endObject();
+}
+
+void writeDataJson(JsonStreamWriter& json, size_t firstRecord = 0, bool delta = false) {
+    const SystemData& data = view.data;
+
+    json.beginObject();
+
+    // Current Data
+    json.field("temp", data.ambientTemp);
+    json.field("humidity", data.ambientHumidity);
+    json.field("soilTemp", data.soilTemp);
+    json.field("soilMoisture", data.soilMoisture);
+    json.field("soilRaw", data.soilRaw);
+    json.field("tankLevel", data.tankLevel);
+    json.field("tankDistance", data.tankDistance);
+    json.field("light", data.lightLevel);
+    json.field("lightRaw", data.lightRaw);
+    json.field("motion", data.motionDetected);
+    json.field("pump", data.pumpActive);
+    json.field("tankPump", data.tankPumpActive);
+    json.field("status", (int)data.status);
+    json.field("security", view.security);
+    json.field("securityAuto", view.securityAuto);
+    json.field("irrigationAuto", view.irrigationAuto);
+    json.field("tankAuto", view.tankAuto);
+    json.field("luminaryAuto", view.luminaryAuto);
+    json.field("luminary", view.luminary);
+    json.field("securityStart", view.securityStart);
+    json.field("securityEnd", view.securityEnd);
+
+    // Configuration lives at /config; clients refetch it when this changes
+    json.field("configVersion", view.configVersion);
+
+    json.field("lastMeasurementTime", data.lastMeasurementTime); // Timestamp relative to boot
+
+    writeSensorDiagJson(json);
+    writeHistoryJson(json, firstRecord, delta);
+
+    json.endObject();
+}
+
+// Print sink that forwards each flushed block as one HTTP chunk
+class ChunkedResponse : public Print {
+public:
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t size) override {
+        server.sendContent((const char*)data, size);
+        return size;
+    }
+};
+
+// Print sink for text bodies sent with sendStream() that are cheaper to
+// render again than to hold: the first `from` lines are skipped, then whole
+// lines are passed on while they fit in room. The next piece starts at
+// from + lines(); full() says some did not fit. Lines longer than
+// LINE_SIZE are cut.
+class LineWindow : public Print {
+public:
+    LineWindow(Print& out, size_t from, size_t room)
+        : out(out), from(from), room(room), line(0), length(0), passed(0), stopped(false) {}
+
+    size_t write(uint8_t c) override {
+        if (stopped) return 1;
+        if (c == '\n' || length < LINE_SIZE - 1) text[length++] = c;
+        if (c != '\n') return 1;
+
+        if (line++ >= from) {
+            if (length > room) {
+                stopped = true;
+                return 1;
+            }
+            out.write((const uint8_t*)text, length);
+            room -= length;
+            passed++;
+        }
+        length = 0;
+        return 1;
+    }
+    size_t write(const uint8_t* data, size_t size) override {
+        for (size_t i = 0; i < size; ++i) write(data[i]);
+        return size;
+    }
+
+    size_t lines() const { return passed; }
+    bool full() const { return stopped; }
+
+private:
+    static const size_t LINE_SIZE = 256;
+
+    Print& out;
+    size_t from;
+    size_t room;
+    size_t line;
+    size_t length;
+    size_t passed;
+    bool stopped;
+    char text[LINE_SIZE];
+};
+
+// Shared /data payload: serialized once per state version and sent as-is to
+// every client until a measurement, actuator change or config save bumps it.
+const size_t DATA_CACHE_SIZE = 8192;
+char dataCache[DATA_CACHE_SIZE];
+size_t dataCacheLength = 0;
+unsigned long dataCacheVersion = 0;
+
+void rebuildDataCache(unsigned long version) {
+    BufferPrint cache(dataCache, DATA_CACHE_SIZE);
+    {
+        JsonStreamWriter json(cache);
+        writeDataJson(json);
+    }
+
+    dataCacheLength = 0;
+    if (cache.overflowed()) {
+        LOG_WARN("DATA", "Payload exceeds cache, streaming uncached");
+        return;
+    }
+    dataCacheLength = cache.size();
+    dataCacheVersion = version;
+
+    LOG_DEBUG("DATA", "Cache rebuilt: version %lu, %u points, %u bytes", version,
+              (unsigned)view.history.size(), (unsigned)dataCacheLength);
+}
+
+// Scratch buffer for per-client responses (history deltas)
+const size_t RESPONSE_BUFFER_SIZE = 1536;
+char responseBuffer[RESPONSE_BUFFER_SIZE];
+
+// Sends what render(out) prints, with the given status and type. It normally
+// fits the scratch buffer and goes out with a Content-Length; a body that
+// does not is rendered a second time as chunked output instead of being cut
+// short. render must write the same bytes both times and flush what it
+// buffers before returning.
+template <typename Render>
+void sendRendered(const char* contentType, Render render, int code = 200) {
+    BufferPrint buffer(responseBuffer, RESPONSE_BUFFER_SIZE);
+    render(buffer);
+    if (!buffer.overflowed()) {
+        server.send(code, contentType, responseBuffer, buffer.size());
+        return;
+    }
+
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(code, contentType, "");
+    ChunkedResponse chunks;
+    render(chunks);
+    server.sendContent("");
+}
+
+// sendRendered() for the JSON render(json) writes
+template <typename Render>
+void sendJson(Render render, int code = 200) {
+    sendRendered("application/json", [&render](Print& out) {
+        JsonStreamWriter json(out);
+        render(json);
+    }, code);
+}
+
+// Index of the first record after the one stamped `since`. If that record
+// is no longer in the ring (evicted or reboot) returns 0 and delta=false, so
+// the full history goes out and the client resyncs.
+size_t recordsAfter(unsigned long since, bool& delta) {
+    for (size_t i = 0; i < view.history.size(); ++i) {
+        if (view.history[i].timestamp == since) {
+            delta = true;
+            return i + 1;
+        }
+    }
+    delta = false;
+    return 0;
+}
+
+// /data?since=<timestamp>: only the records after the client's newest one
+void sendDataDelta(unsigned long since) {
+    bool delta;
+    size_t firstRecord = recordsAfter(since, delta);
+    sendJson([firstRecord, delta](JsonStreamWriter& json) { writeDataJson(json, firstRecord, delta); });
+}
+
+void handleData() {
+    captureVersions();
+    char etag[ETAG_SIZE];
+    if (sendNotModified(stateEtag(etag))) return;
+
+    bool since = server.hasArg("since");
+    if (since || dataCacheLength == 0 || dataCacheVersion != view.version) {
+        captureState();
+        stateEtag(etag);
+    }
+    sendValidators(etag);
+
+    if (since) {
+        sendDataDelta(strtoul(server.argValue("since"), nullptr, 10));
+        return;
+    }
+
+    unsigned long version = view.version;
+    if (dataCacheLength == 0 || dataCacheVersion != version) {
+        rebuildDataCache(version);
+    }
+
+    if (dataCacheLength > 0) {
+        server.send(200, "application/json", dataCache, dataCacheLength);
+        return;
+    }
+
+    // Payload larger than the cache: it goes out chunked
+    sendJson([](JsonStreamWriter& json) { writeDataJson(json); });
+}
+
+// /history[?since=<timestamp>]: the history series on its own. Clients that
+// send Accept: application/octet-stream get the packed columnar layout from
+// history_binary.h (12 + 18 bytes per record, no text formatting); everyone
+// else gets the JSON history fields of /data.
+void handleHistory() {
+    bool binary = headerAccepts(server.headerValue("Accept"), HISTORY_BINARY_TYPE);
+    server.sendHeader("Vary", "Accept");
+    captureVersions();
+    const char* variant = binary ? "-bin" : "-json";
+    char etag[ETAG_SIZE];
+    if (sendNotModified(stateEtag(etag, variant))) return;
+    captureState();
+    sendValidators(stateEtag(etag, variant));
+
+    bool delta = false;
+    size_t firstRecord = 0;
+    if (server.hasArg("since")) {
+        firstRecord = recordsAfter(strtoul(server.argValue("since"), nullptr, 10), delta);
+    }
+    unsigned long since = delta ? view.history[firstRecord - 1].timestamp : 0;
+
+    if (binary) {
+        sendRendered(HISTORY_BINARY_TYPE, [firstRecord, delta, since](Print& out) {
+            HistoryBinaryWriter writer(out);
+            writer.write(view.history, firstRecord, delta, since);
+        });
+        return;
+    }
+    sendJson([firstRecord, delta](JsonStreamWriter& json) {
+        json.beginObject();
+        writeHistoryJson(json, firstRecord, delta);
+        json.endObject();
+    });
+}
+
+// The configuration is only written by applyConfig(), on this task, so it
+// is read in place
+void writeConfigJson(JsonStreamWriter& json) {
+    json.beginObject();
+    json.field("version", view.configVersion);
+    json.field("soilDry", SOIL_DRY);
+    json.field("soilWet", SOIL_WET);
+    json.field("soilThreshold", SOIL_MOISTURE_THRESHOLD);
+    json.field("tankEmpty", TANK_DEPTH_CM);
+    json.field("tankFull", TANK_MIN_DISTANCE);
+    json.field("tankCritical", TANK_CRITICAL_LEVEL);
+    json.field("lightMin", LIGHT_MIN_RAW);
+    json.field("lightMax", LIGHT_MAX_RAW);
+    json.field("lightLow", LIGHT_THRESHOLD_LOW);
+    json.field("lightHigh", LIGHT_THRESHOLD_HIGH);
+    json.field("dataSendInterval", DATA_SEND_INTERVAL_MIN);
+    json.field("serverPollingInterval", SERVER_POLLING_INTERVAL_SEC);
+    json.field("statusPollingInterval", STATUS_POLLING_INTERVAL_SEC);
+    json.endObject();
+}
+
+// The values are read in place (see writeConfigJson), so only the version
+// is captured
+void handleConfigData() {
+    captureVersions();
+    char etag[ETAG_SIZE];
+    if (sendNotModified(configEtag(etag))) return;
+    sendValidators(etag);
+    sendJson(writeConfigJson);
+}
+
+void writeStatusJson(JsonStreamWriter& json) {
+    json.beginObject();
+    json.field("pump", view.data.pumpActive);
+    json.field("tankPump", view.data.tankPumpActive);
+    json.field("security", view.security);
+    json.field("luminary", view.luminary);
+    json.field("irrigationAuto", view.irrigationAuto);
+    json.field("tankAuto", view.tankAuto);
+    json.field("securityAuto", view.securityAuto);
+    json.field("luminaryAuto", view.luminaryAuto);
+    json.field("securityStart", view.securityStart);
+    json.field("securityEnd", view.securityEnd);
+    json.field("status", (int)view.data.status);
+    json.field("configVersion", view.configVersion);
+    json.endObject();
+}
+
+void handleStatus() {
+    captureVersions();
+    char etag[ETAG_SIZE];
+    if (sendNotModified(stateEtag(etag))) return;
+    captureState();
+    sendValidators(stateEtag(etag));
+    sendJson(writeStatusJson);
+}
+
+// ==========================================
+// Metrics (/metrics)
+// ==========================================
+// Prometheus text format, streamed as chunked output so it can grow
+// Per-route families from HttpServer's instrumentation. Index -1 is the
+// "unmatched" series: 404s and requests rejected before routing.
+const HttpRouteStats& routeStatsAt(int i) {
+    return i < 0 ? server.unmatchedStats() : server.routeStats(i);
+}
+
+void routeLabel(char* labels, size_t size, int i) {
+    snprintf(labels, size, "route=\"%s\"", i < 0 ? "unmatched" : server.routeUri(i));
+}
+
+void writeRouteMetrics(MetricsWriter& metrics) {
+    char labels[64];
+    int routes = server.routeTotal();
+
+    metrics.family("http_route_requests_total", "counter", "Requests handled, per route");
+    for (int i = -1; i < routes; ++i) {
+        routeLabel(labels, sizeof(labels), i);
+        metrics.sample("http_route_requests_total", routeStatsAt(i).requests, labels);
+    }
+    metrics.family("http_route_errors_total", "counter", "Replies with status >= 400 or a failed socket, per route");
+    for (int i = -1; i < routes; ++i) {
+        routeLabel(labels, sizeof(labels), i);
+        metrics.sample("http_route_errors_total", routeStatsAt(i).errors, labels);
+    }
+    metrics.family("http_route_response_bytes_total", "counter", "Bytes sent including headers, per route");
+    for (int i = -1; i < routes; ++i) {
+        routeLabel(labels, sizeof(labels), i);
+        metrics.sample("http_route_response_bytes_total", routeStatsAt(i).bytesSent, labels);
+    }
+    metrics.family("http_route_duration_seconds", "histogram", "Handler run time, per route");
+    for (int i = -1; i < routes; ++i) {
+        const HttpRouteStats& stats = routeStatsAt(i);
+        routeLabel(labels, sizeof(labels), i);
+        metrics.histogram("http_route_duration_seconds", labels, HTTP_LATENCY_BOUNDS_US, stats.latency,
+                          HTTP_LATENCY_BUCKETS, (double)stats.latencySumUs, 1e6);
+    }
+    metrics.family("http_route_response_size_bytes", "histogram", "Response size including headers, per route");
+    for (int i = -1; i < routes; ++i) {
+        const HttpRouteStats& stats = routeStatsAt(i);
+        routeLabel(labels, sizeof(labels), i);
+        metrics.histogram("http_route_response_size_bytes", labels, HTTP_SIZE_BOUNDS, stats.size,
+                          HTTP_SIZE_BUCKETS, (double)stats.bytesSent);
+    }
+}
+
+void writeSensorMetrics(MetricsWriter& metrics) {
+    char labels[64];
+    SensorStats stats[SENSOR_CHANNEL_COUNT];
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) stats[i] = getSensorStats((SensorChannel)i);
+
+    metrics.family("sensor_reads_total", "counter", "Acquisitions (read calls), per sensor channel");
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) {
+        snprintf(labels, sizeof(labels), "sensor=\"%s\"", sensorChannelName((SensorChannel)i));
+        metrics.sample("sensor_reads_total", stats[i].reads, labels);
+    }
+    metrics.family("sensor_read_failures_total", "counter", "Acquisitions that returned -999");
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) {
+        snprintf(labels, sizeof(labels), "sensor=\"%s\"", sensorChannelName((SensorChannel)i));
+        metrics.sample("sensor_read_failures_total", stats[i].failures, labels);
+    }
+    metrics.family("sensor_samples_total", "counter", "Raw samples taken");
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) {
+        snprintf(labels, sizeof(labels), "sensor=\"%s\"", sensorChannelName((SensorChannel)i));
+        metrics.sample("sensor_samples_total", stats[i].samples, labels);
+    }
+    metrics.family("sensor_samples_valid_total", "counter", "Raw samples kept for the average");
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) {
+        snprintf(labels, sizeof(labels), "sensor=\"%s\"", sensorChannelName((SensorChannel)i));
+        metrics.sample("sensor_samples_valid_total", stats[i].valid, labels);
+    }
+    metrics.family("sensor_samples_rejected_total", "counter", "Raw samples dropped, by reason");
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) {
+        for (int r = 0; r < SENSOR_REJECT_COUNT; ++r) {
+            snprintf(labels, sizeof(labels), "sensor=\"%s\",reason=\"%s\"",
+                     sensorChannelName((SensorChannel)i), sensorRejectName((SensorReject)r));
+            metrics.sample("sensor_samples_rejected_total", stats[i].rejects[r], labels);
+        }
+    }
+    metrics.family("sensor_read_seconds_total", "counter", "Time spent acquiring");
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) {
+        snprintf(labels, sizeof(labels), "sensor=\"%s\"", sensorChannelName((SensorChannel)i));
+        metrics.sample("sensor_read_seconds_total", (float)(stats[i].totalUs / 1e6), labels);
+    }
+    metrics.family("sensor_read_max_seconds", "gauge", "Longest acquisition since boot");
+    for (int i = 0; i < SENSOR_CHANNEL_COUNT; ++i) {
+        snprintf(labels, sizeof(labels), "sensor=\"%s\"", sensorChannelName((SensorChannel)i));
+        metrics.sample("sensor_read_max_seconds", (float)(stats[i].maxUs / 1e6), labels);
+    }
+}
+
+void writeHeapMetrics(MetricsWriter& metrics) {
+    HeapStats heap = getHeapStats();
+    metrics.gauge("heap_free_bytes", "Free heap at the last sample", (unsigned long)heap.freeBytes);
+    metrics.gauge("heap_largest_free_block_bytes", "Largest allocatable block at the last sample",
+                  (unsigned long)heap.largestBlock);
+    metrics.gauge("heap_min_free_bytes", "Lowest free heap since boot", (unsigned long)heap.minFreeEver);
+    metrics.gauge("heap_largest_free_block_min_bytes", "Lowest largest block sampled since boot",
+                  (unsigned long)heap.minLargestBlock);
+    metrics.gauge("heap_fragmentation_ratio", "1 - largest block / free heap, at the last sample",
+                  heap.freeBytes > 0 ? 1.0f - (float)heap.largestBlock / heap.freeBytes : 0.0f);
+
+    // What the counters below can see: operator new/delete always, the C
+    // allocator only where the backend hooks it (hal.h)
+    metrics.gauge("heap_c_allocator_counted", "1 if the allocation counters include malloc, calloc, realloc and free",
+                  (unsigned long)HAL_HEAP_HOOKS);
+
+    char labels[32];
+    HeapAllocStats alloc[HEAP_SUBSYSTEM_COUNT];
+    for (int i = 0; i < HEAP_SUBSYSTEM_COUNT; ++i) alloc[i] = getHeapAllocStats((HeapSubsystem)i);
+
+    metrics.family("heap_allocations_total", "counter", "Allocations, per subsystem");
+    for (int i = 0; i < HEAP_SUBSYSTEM_COUNT; ++i) {
+        snprintf(labels, sizeof(labels), "subsystem=\"%s\"", heapSubsystemName((HeapSubsystem)i));
+        metrics.sample("heap_allocations_total", alloc[i].allocations, labels);
+    }
+    metrics.family("heap_frees_total", "counter", "Frees, per subsystem");
+    for (int i = 0; i < HEAP_SUBSYSTEM_COUNT; ++i) {
+        snprintf(labels, sizeof(labels), "subsystem=\"%s\"", heapSubsystemName((HeapSubsystem)i));
+        metrics.sample("heap_frees_total", alloc[i].frees, labels);
+    }
+    metrics.family("heap_allocated_bytes_total", "counter", "Bytes requested by allocations, per subsystem");
+    for (int i = 0; i < HEAP_SUBSYSTEM_COUNT; ++i) {
+        snprintf(labels, sizeof(labels), "subsystem=\"%s\"", heapSubsystemName((HeapSubsystem)i));
+        metrics.sample("heap_allocated_bytes_total", alloc[i].bytes, labels);
+    }
+    metrics.counter("heap_loop_allocations_total", "Allocations from loop() or the server task after setup(), expected 0",
+                    getHeapSteadyStats().allocations);
+}
+
+void writeMetrics(MetricsWriter& metrics) {
+    const HttpServerStats& http = server.stats();
+
+    metrics.counter("http_connections_accepted_total", "TCP connections accepted (handshakes)", http.connectionsAccepted);
+    metrics.counter("http_connections_rejected_total", "Connections refused with 503, all slots busy", http.connectionsRejected);
+    metrics.counter("http_idle_evictions_total", "Idle keep-alive connections closed to admit a new client", http.idleEvictions);
+    metrics.counter("http_idle_timeouts_total", "Connections closed after the keep-alive idle timeout", http.idleTimeouts);
+    metrics.counter("http_requests_total", "HTTP requests served", http.requests);
+    metrics.counter("http_keepalive_requests_total", "Requests served on a reused connection", http.keepAliveRequests);
+    metrics.counter("http_pipelined_requests_total", "Requests received before the previous response ended", http.pipelinedRequests);
+    metrics.gauge("http_open_connections", "Connections currently open", (unsigned long)server.openConnections());
+    metrics.counter("http_page_loads_total", "HTML pages served", pageLoads);
+    metrics.counter("http_event_streams_dropped_total", "Event streams closed for falling a backlog behind",
+                    eventStreamsDropped);
+    metrics.gauge("http_handshakes_per_page_load", "TCP handshakes per HTML page served",
+                  pageLoads > 0 ? (float)http.connectionsAccepted / pageLoads : 0.0f);
+
+    writeRouteMetrics(metrics);
+    writeSensorMetrics(metrics);
+    writeHeapMetrics(metrics);
+}
+
+// Tens of kilobytes, more than a connection queues: each piece is rendered
+// from the top again and only the lines after those already sent go out,
+// so every line is whole and current when it leaves
+void handleMetrics() {
+    size_t sent = 0;
+    server.sendStream(200, "text/plain; version=0.0.4", [sent](Print& out, size_t room) mutable {
+        LineWindow window(out, sent, room);
+        {
+            MetricsWriter metrics(window);
+            writeMetrics(metrics);
+        }
+        sent += window.lines();
+        return window.full();
+    });
+}
+
+// /debug/profile: loop() phase timings from profiler.h. A POST changes
+// them first: ?budget=<ms> sets the overrun budget, ?reset=1 starts a new
+// window. GET only reads, so a crawler or a prefetch cannot retune the loop.
+const unsigned long MAX_LOOP_BUDGET_MS = 60000; // Past this no pass would ever count as an overrun
+
+void handleProfile() {
+    if (server.method() == HTTP_POST) {
+        if (server.hasArg("budget")) {
+            const char* text = server.argValue("budget");
+            char* end;
+            unsigned long budget = strtoul(text, &end, 10);
+            if (end == text || *end != '\0' || budget < 1 || budget > MAX_LOOP_BUDGET_MS) {
+                server.send(400, "application/json", "{\"error\":\"budget must be 1-60000 ms\"}");
+                return;
+            }
+            lockState();
+            LOOP_BUDGET_MS = budget;
+            unlockState();
+        }
+        if (server.hasArg("reset")) profileReset();
+    }
+
+    server.sendHeader("Cache-Control", "no-store");
+    sendJson(writeProfileJson);
+}
+
+// /logs[?since=<seq>]: the log ring as text, oldest first. X-Log-Next is
+// the seq to ask for next time, so a client can tail without repeats.
+void handleLogs() {
+    uint32_t next = logNextSeq();
+    uint32_t seq = server.hasArg("since") ? strtoul(server.argValue("since"), nullptr, 10) : 0;
+
+    char nextText[12];
+    snprintf(nextText, sizeof(nextText), "%lu", (unsigned long)next);
+    server.sendHeader("X-Log-Next", nextText);
+    server.sendHeader("Cache-Control", "no-store");
+
+    // The whole ring can outgrow the output queue: a piece at a time, with
+    // seq as the place to resume
+    server.sendStream(200, "text/plain; charset=utf-8", [seq, next](Print& out, size_t room) mutable {
+        LogEntry entry;
+        char line[LOG_TAG_SIZE + LOG_TEXT_SIZE + 24];
+        while (seq < next && logRead(seq, entry) && entry.seq < next) {
+            size_t length = formatLogEntry(entry, line, sizeof(line));
+            if (length > room) return true;
+            out.write((const uint8_t*)line, length);
+            room -= length;
+            seq = entry.seq + 1;
+        }
+        return false;
+    });
+}
+
+// ==========================================
+// Server-Sent Events (/events)
+// ==========================================
+// Dashboards keep one stream open and get pushed a "state" event when an
+// actuator, mode or alarm changes and a "data" event (live readings plus
+// the new history record) when a measurement completes. Idle streams only
+// see a "ping" event every EVENT_KEEPALIVE_MS, which also reaps dead sockets.
+//
+// A stream is the raw socket taken from the server, still non-blocking.
+// Frames are queued whole in the stream's backlog and written with
+// MSG_DONTWAIT as far as the socket takes them, the rest on later passes.
+// A reader that falls a backlog behind is dropped: a stalled dashboard
+// never holds up the server task, and never gets half a frame.
+const int MAX_EVENT_CLIENTS = 4;
+const unsigned long EVENT_KEEPALIVE_MS = 30000;
+const size_t EVENT_BACKLOG_SIZE = 2048; // A full data frame and a state frame
+
+struct EventStream {
+    int fd;        // -1 when the slot is free
+    size_t queued; // Bytes in backlog
+    size_t sent;   // Of those, already written
+    char backlog[EVENT_BACKLOG_SIZE];
+};
+
+EventStream eventStreams[MAX_EVENT_CLIENTS];
+unsigned long lastEventVersion = 0;
+unsigned long lastEventMeasurement = 0;
+unsigned long lastEventKeepAlive = 0;
+
+void closeEventStream(EventStream& stream) {
+    ::close(stream.fd);
+    stream.fd = -1;
+    stream.queued = 0;
+    stream.sent = 0;
+}
+
+// Readers never send on the stream, so a readable socket has been closed
+bool eventStreamOpen(EventStream& stream) {
+    if (stream.fd < 0) return false;
+    char byte;
+    int n = ::recv(stream.fd, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+    closeEventStream(stream);
+    return false;
+}
+
+// Writes as much of the backlog as the socket takes now
+void flushEventStream(EventStream& stream) {
+    while (stream.sent < stream.queued) {
+        int n = ::send(stream.fd, stream.backlog + stream.sent, stream.queued - stream.sent, MSG_DONTWAIT);
+        if (n > 0) {
+            stream.sent += n;
+        } else {
+            if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) closeEventStream(stream);
+            return;
+        }
+    }
+    stream.queued = 0;
+    stream.sent = 0;
+}
+
+// Queues the parts of one frame whole, or drops the stream if they do not fit
+void queueEventFrame(EventStream& stream, const char* const parts[], const size_t lengths[], int count) {
+    if (stream.sent > 0) {
+        memmove(stream.backlog, stream.backlog + stream.sent, stream.queued - stream.sent);
+        stream.queued -= stream.sent;
+        stream.sent = 0;
+    }
+    size_t frame = 0;
+    for (int i = 0; i < count; ++i) frame += lengths[i];
+    if (stream.queued + frame > EVENT_BACKLOG_SIZE) {
+        LOG_WARN("HTTP", "Event stream %d bytes behind, dropped", (int)stream.queued);
+        closeEventStream(stream);
+        eventStreamsDropped++;
+        return;
+    }
+    for (int i = 0; i < count; ++i) {
+        memcpy(stream.backlog + stream.queued, parts[i], lengths[i]);
+        stream.queued += lengths[i];
+    }
+    flushEventStream(stream);
+}
+
+void queueEvent(EventStream& stream, const char* event, const char* payload, size_t length) {
+    const char* const parts[] = {"event: ", event, "\ndata: ", payload, "\n\n"};
+    const size_t lengths[] = {7, strlen(event), 7, length, 2};
+    queueEventFrame(stream, parts, lengths, 5);
+}
+
+void writeEventToAll(const char* event, const char* payload, size_t length) {
+    for (int i = 0; i < MAX_EVENT_CLIENTS; ++i) {
+        if (eventStreamOpen(eventStreams[i])) queueEvent(eventStreams[i], event, payload, length);
+    }
+}
+
+// Renders the event once into the shared scratch buffer and fans it out
+void broadcastStateEvent() {
+    BufferPrint buffer(responseBuffer, RESPONSE_BUFFER_SIZE);
+    {
+        JsonStreamWriter json(buffer);
+        writeStatusJson(json);
+    }
+    if (buffer.overflowed()) {
+        writeEventToAll("resync", "{}", 2);
+        return;
+    }
+    writeEventToAll("state", responseBuffer, buffer.size());
+}
+
+void broadcastDataEvent() {
+    // Delta against the previous record; clients whose cursor differs poll
+    size_t firstRecord = view.history.size() >= 2 ? view.history.size() - 1 : 0;
+
+    BufferPrint buffer(responseBuffer, RESPONSE_BUFFER_SIZE);
+    {
+        JsonStreamWriter json(buffer);
+        writeDataJson(json, firstRecord, firstRecord > 0);
+    }
+    if (buffer.overflowed()) {
+        writeEventToAll("resync", "{}", 2);
+        return;
+    }
+    writeEventToAll("data", responseBuffer, buffer.size());
+}
+
+bool hasEventClients() {
+    for (int i = 0; i < MAX_EVENT_CLIENTS; ++i) {
+        if (eventStreams[i].fd >= 0) return true;
+    }
+    return false;
+}
+
+void pushEvents() {
+    if (!hasEventClients()) return;
+
+    // Backlogs left by a slow reader drain a little every pass
+    for (int i = 0; i < MAX_EVENT_CLIENTS; ++i) {
+        if (eventStreams[i].fd >= 0) flushEventStream(eventStreams[i]);
+    }
+
+    lockState();
+    unsigned long version = getStateVersion();
+    unlockState();
+    if (version != lastEventVersion) {
+        captureState(); // Frames render from the copy and go out unlocked
+        lastEventVersion = view.version;
+        lastEventKeepAlive = halMillis();
+
+        unsigned long measurementTime = view.data.lastMeasurementTime;
+        if (measurementTime != lastEventMeasurement) {
+            lastEventMeasurement = measurementTime;
+            broadcastDataEvent();
+        } else {
+            broadcastStateEvent();
+        }
+    } else if (halMillis() - lastEventKeepAlive > EVENT_KEEPALIVE_MS) {
+        lastEventKeepAlive = halMillis();
+        writeEventToAll("ping", "{}", 2); // Also drops sockets that went away
+    }
+}
+
+void handleEvents() {
+    int slot = -1;
+    for (int i = 0; i < MAX_EVENT_CLIENTS; ++i) {
+        if (!eventStreamOpen(eventStreams[i])) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) {
+        server.send(503, "application/json", "{\"error\":\"Too many event streams\"}");
+        return;
+    }
+
+    // The socket outlives this request: take it from the server and answer
+    // by hand, through the backlog like every frame after it
+    EventStream& stream = eventStreams[slot];
+    stream.fd = server.detachClient();
+    if (stream.fd < 0) return;
+    static const char head[] = "HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/event-stream\r\n"
+                               "Cache-Control: no-cache\r\n"
+                               "Connection: keep-alive\r\n\r\n"
+                               "retry: 3000\n\n";
+    const char* const parts[] = {head};
+    const size_t lengths[] = {sizeof(head) - 1};
+    queueEventFrame(stream, parts, lengths, 1);
+
+    // Current state right away, so the dashboard can stop polling
+    captureState();
+    BufferPrint buffer(responseBuffer, RESPONSE_BUFFER_SIZE);
+    {
+        JsonStreamWriter json(buffer);
+        writeStatusJson(json);
+    }
+    if (stream.fd < 0) return;
+    if (buffer.overflowed()) queueEvent(stream, "resync", "{}", 2);
+    else queueEvent(stream, "state", responseBuffer, buffer.size());
+}
+
+// ==========================================
+// Actions
+// ==========================================
+// Parsed straight from the request buffer (see action_parser.h); the batch
+// is static so a 16-command body costs no heap and no server task stack.
+ActionBatch actionBatch;
+
+// Values were range-checked per field by parseActions(), so the casts to
+// the int settings below are safe
+void applyConfig(const ActionCommand& command) {
+    for (int field = 0; field < CONFIG_FIELD_COUNT; ++field) {
+        if (!(command.configMask & (1 << field))) continue;
+        float value = command.config[field];
+        switch (field) {
+            case CONFIG_SOIL_DRY: SOIL_DRY = value; break;
+            case CONFIG_SOIL_WET: SOIL_WET = value; break;
+            case CONFIG_SOIL_THRESHOLD: SOIL_MOISTURE_THRESHOLD = value; break;
+            case CONFIG_TANK_EMPTY: TANK_DEPTH_CM = value; break;
+            case CONFIG_TANK_FULL: TANK_MIN_DISTANCE = value; break;
+            case CONFIG_TANK_CRITICAL: TANK_CRITICAL_LEVEL = value; break;
+            case CONFIG_LIGHT_MIN: LIGHT_MIN_RAW = value; break;
+            case CONFIG_LIGHT_MAX: LIGHT_MAX_RAW = value; break;
+            case CONFIG_LIGHT_LOW: LIGHT_THRESHOLD_LOW = value; break;
+            case CONFIG_LIGHT_HIGH: LIGHT_THRESHOLD_HIGH = value; break;
+            case CONFIG_DATA_SEND_INTERVAL: DATA_SEND_INTERVAL_MIN = value; break;
+            case CONFIG_SERVER_POLLING_INTERVAL: SERVER_POLLING_INTERVAL_SEC = value; break;
+            case CONFIG_STATUS_POLLING_INTERVAL: STATUS_POLLING_INTERVAL_SEC = value; break;
+        }
+    }
+    LOG_INFO("CONFIG", "Configuration updated from web");
+}
+
+void applyAction(const ActionCommand& command) {
+    switch (command.type) {
+        case ACTION_IRRIGATION_AUTO: setIrrigationAuto(command.enable); break;
+        case ACTION_FORCE_IRRIGATION: setIrrigationManual(command.enable, command.duration); break;
+        case ACTION_CONFIG: applyConfig(command); break;
+        case ACTION_TANK_AUTO: setTankAuto(command.enable); break;
+        case ACTION_FORCE_TANK: setTankManual(command.enable); break;
+        case ACTION_SECURITY_AUTO: setSecurityAuto(command.enable); break;
+        case ACTION_SECURITY: setSecurityManual(command.enable); break;
+        case ACTION_SECURITY_SCHEDULE: setSecuritySchedule(command.start, command.end); break;
+        case ACTION_CLEAR_ALARM: clearAlarm(); break;
+        case ACTION_LUMINARY_AUTO: setLuminaryAuto(command.enable); break;
+        case ACTION_FORCE_LUMINARY: setLuminaryManual(command.enable); break;
+        case ACTION_UNKNOWN: break;
+    }
+}
+
+// Body: one command object, or an array of them (see action_parser.h).
+// Reply: {"success":<all applied>,"results":[{"command","ok","error"?}]},
+// one result per command in the order they were applied.
+void handleAction() {
+    if (server.bodyLength() == 0) {
+        server.send(400, "application/json", "{\"error\":\"No body\"}");
+        return;
+    }
+
+    if (!parseActions(server.body(), server.bodyLength(), actionBatch)) {
+        sendJson([](JsonStreamWriter& json) {
+            json.beginObject();
+            json.field("error", "Invalid JSON");
+            json.field("detail", actionBatch.error);
+            json.field("offset", (unsigned long)actionBatch.errorOffset);
+            json.endObject();
+        }, 400);
+        return;
+    }
+
+    // Applied as one batch under the lock; the reply is written after it
+    bool success = true;
+    lockState();
+    for (size_t i = 0; i < actionBatch.count; ++i) {
+        const ActionCommand& command = actionBatch.commands[i];
+        if (command.error) success = false;
+        else applyAction(command);
+    }
+    unlockState();
+
+    // A full batch of failures outgrows the scratch buffer; sendJson then
+    // streams it chunked
+    sendJson([success](JsonStreamWriter& json) {
+        json.beginObject();
+        json.field("success", success);
+        json.beginArray("results");
+        for (size_t i = 0; i < actionBatch.count; ++i) {
+            const ActionCommand& command = actionBatch.commands[i];
+            json.beginObject();
+            json.field("command", command.name);
+            json.field("ok", command.error == nullptr);
+            if (command.error) json.field("error", command.error);
+            json.endObject();
+        }
+        json.endArray();
+        json.endObject();
+    });
+}
+
+// ==========================================
+// Server Task
+// ==========================================
+// Requests are served from their own task, so pages keep loading while the
+// main loop is blocked sampling sensors. Handlers take the state lock only
+// to copy state (captureState) or apply actions, never across a socket
+// write, so a stalled client cannot delay automation.
+const uint32_t HTTP_TASK_STACK = 8192;
+
+void serverTask(void* parameter) {
+    HeapScope heapScope(HEAP_HTTP); // Everything this task allocates
+    while (true) {
+        server.waitForActivity(50); // Wakes early on socket activity
+        server.handleClient();
+        pushEvents();
+    }
+}
+
+void setupWebServer() {
+    LOG_INFO("HTTP", "Iniciando servidor web...");
+
+    bootId = halRandom();
+    for (int i = 0; i < MAX_EVENT_CLIENTS; ++i) eventStreams[i].fd = -1;
+    const char* headerKeys[] = {"If-None-Match", "Accept-Encoding", "Accept"};
+    server.collectHeaders(headerKeys, 3);
+    
+    server.on("/", HTTP_GET, handleRoot);
+    server.on("/login.html", HTTP_GET, handleRoot);
+    server.on("/index.html", HTTP_GET, handleInit);
+    server.on("/config.html", HTTP_GET, handleConfig);
+    server.on("/style.css", HTTP_GET, handleStyle);
+    server.on("/script.js", HTTP_GET, handleScript);
+    server.on("/view.html", HTTP_GET, handleView);
+    server.on("/view.js", HTTP_GET, handleViewScript);
+    server.on("/chart.js", HTTP_GET, handleChartLib);
+    for (size_t i = 0; i < WEB_ASSET_COUNT; ++i) {
+        const WebAsset* asset = WEB_ASSETS[i];
+        if (!asset->versioned) continue;
+        // /script.<hash>.js etc., as referenced by the pages
+        server.on(asset->path, HTTP_GET, [asset]() { sendAsset(*asset, CACHE_IMMUTABLE); });
+    }
+    server.on("/data", HTTP_GET, handleData);
+    server.on("/history", HTTP_GET, handleHistory);
+    server.on("/config", HTTP_GET, handleConfigData);
+    server.on("/status", HTTP_GET, handleStatus);
+    server.on("/action", HTTP_POST, handleAction);
+    server.on("/events", HTTP_GET, handleEvents);
+    server.on("/metrics", HTTP_GET, handleMetrics);
+    server.on("/debug/profile", HTTP_ANY, handleProfile);
+    server.on("/logs", HTTP_GET, handleLogs);
+
+    server.begin();
+    xTaskCreatePinnedToCore(serverTask, "http", HTTP_TASK_STACK, nullptr, 1, nullptr, 0);
+    LOG_INFO("HTTP", "HTTP server started");
+}